@@ -484,13 +484,19 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
             val FPS = 1
             val FRAMETIME = 2
             val SPEED = 3
+            val MEMORY_MIB = 4
             perfStatsUpdater = {
                 if (emulationViewModel.emulationStarted.value) {
                     val perfStats = NativeLibrary.getPerfStats()
                     val cpuBackend = NativeLibrary.getCpuBackend()
                     if (_binding != null) {
                         binding.showFpsText.text =
-                            String.format("FPS: %.1f\n%s", perfStats[FPS], cpuBackend)
+                            String.format(
+                                "FPS: %.1f\n%s\nRAM: %.0f MiB",
+                                perfStats[FPS],
+                                cpuBackend,
+                                perfStats[MEMORY_MIB]
+                            )
                     }
                     perfStatsUpdateHandler.postDelayed(perfStatsUpdater!!, 800)
                 }
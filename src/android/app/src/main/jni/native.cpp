@@ -25,6 +25,7 @@
 #include "common/fs/path_util.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
+#include "common/memory_accounting.h"
 #include "common/microprofile.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
@@ -305,6 +306,16 @@ void EmulationSession::RunEmulation() {
         LoadDiskCacheProgress(VideoCore::LoadCallbackStage::Complete, 0, 0);
     }
 
+    m_performance_governor = std::make_unique<PerformanceGovernor>(m_system);
+    m_system.GetPerfStats().SetFrameCallback(
+        [governor = m_performance_governor.get()](Core::PerfStats::Clock::duration work_time) {
+            governor->FrameWorked(work_time);
+        });
+    SCOPE_EXIT({
+        m_system.GetPerfStats().SetFrameCallback({});
+        m_performance_governor.reset();
+    });
+
     void(m_system.Run());
 
     if (m_system.DebuggerEnabled()) {
@@ -651,16 +662,17 @@ void Java_org_yuzu_yuzu_1emu_NativeLibrary_initializeSystem(JNIEnv* env, jclass
 }
 
 jdoubleArray Java_org_yuzu_yuzu_1emu_NativeLibrary_getPerfStats(JNIEnv* env, jclass clazz) {
-    jdoubleArray j_stats = env->NewDoubleArray(4);
+    jdoubleArray j_stats = env->NewDoubleArray(5);
 
     if (EmulationSession::GetInstance().IsRunning()) {
         jconst results = EmulationSession::GetInstance().PerfStats();
 
         // Converting the structure into an array makes it easier to pass it to the frontend
-        double stats[4] = {results.system_fps, results.average_game_fps, results.frametime,
-                           results.emulation_speed};
+        double stats[5] = {results.system_fps, results.average_game_fps, results.frametime,
+                           results.emulation_speed,
+                           static_cast<double>(Common::MemoryAccounting::GetTotal() >> 20)};
 
-        env->SetDoubleArrayRegion(j_stats, 0, 4, stats);
+        env->SetDoubleArrayRegion(j_stats, 0, 5, stats);
     }
 
     return j_stats;
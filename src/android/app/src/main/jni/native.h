@@ -10,6 +10,7 @@
 #include "frontend_common/content_manager.h"
 #include "jni/applets/software_keyboard.h"
 #include "jni/emu_window/emu_window.h"
+#include "jni/performance_governor.h"
 #include "video_core/rasterizer_interface.h"
 
 #pragma once
@@ -64,6 +65,7 @@ private:
 private:
     // Window management
     std::unique_ptr<EmuWindow_Android> m_window;
+    std::unique_ptr<PerformanceGovernor> m_performance_governor;
     ANativeWindow* m_native_window{};
 
     // Core emulation
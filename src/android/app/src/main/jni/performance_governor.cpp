@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/thread.h"
+#include "core/core.h"
+#include "jni/performance_governor.h"
+#include "video_core/renderer_base.h"
+
+namespace {
+
+/// System frames follow the 60 Hz refresh of the emulated display
+constexpr std::chrono::nanoseconds SYSTEM_FRAME_INTERVAL{1'000'000'000 / 60};
+
+/// Status from which the device starts limiting performance to cool down
+constexpr AThermalStatus THROTTLING_STATUS = ATHERMAL_STATUS_MODERATE;
+
+} // Anonymous namespace
+
+PerformanceGovernor::PerformanceGovernor(Core::System& system) : m_system{system} {
+    // The hint API is only available from Android 13, look it up instead of linking to it
+    const bool has_hints =
+        m_android_library.Open("libandroid.so") &&
+        m_android_library.GetSymbol("APerformanceHint_getManager", &m_get_manager) &&
+        m_android_library.GetSymbol("APerformanceHint_createSession", &m_create_session) &&
+        m_android_library.GetSymbol("APerformanceHint_updateTargetWorkDuration",
+                                    &m_update_target) &&
+        m_android_library.GetSymbol("APerformanceHint_reportActualWorkDuration",
+                                    &m_report_actual) &&
+        m_android_library.GetSymbol("APerformanceHint_closeSession", &m_close_session);
+    if (!has_hints) {
+        LOG_INFO(Frontend, "Performance hints are not supported on this device");
+        m_session_failed = true;
+    }
+
+    m_thermal_manager = AThermal_acquireManager();
+    if (!m_thermal_manager) {
+        return;
+    }
+    OnThermalStatus(this, AThermal_getCurrentThermalStatus(m_thermal_manager));
+    if (AThermal_registerThermalStatusListener(m_thermal_manager, OnThermalStatus, this) != 0) {
+        LOG_WARNING(Frontend, "Failed to listen to thermal status changes");
+    }
+}
+
+PerformanceGovernor::~PerformanceGovernor() {
+    if (m_thermal_manager) {
+        AThermal_unregisterThermalStatusListener(m_thermal_manager, OnThermalStatus, this);
+        AThermal_releaseManager(m_thermal_manager);
+    }
+    if (m_throttled) {
+        m_system.Renderer().SetThermalThrottling(false);
+    }
+    if (m_session) {
+        m_close_session(m_session);
+    }
+}
+
+void PerformanceGovernor::FrameWorked(std::chrono::nanoseconds work_time) {
+    if (!m_session && (m_session_failed || !CreateSession())) {
+        return;
+    }
+    const std::chrono::nanoseconds target = TargetWorkDuration();
+    if (target != m_target) {
+        m_update_target(m_session, target.count());
+        m_target = target;
+    }
+    m_report_actual(m_session, std::max<s64>(work_time.count(), 1));
+}
+
+void PerformanceGovernor::OnThermalStatus(void* data, AThermalStatus status) {
+    auto* const governor = static_cast<PerformanceGovernor*>(data);
+    const bool throttled = status >= THROTTLING_STATUS;
+
+    std::scoped_lock lock{governor->m_thermal_mutex};
+    if (throttled == governor->m_throttled) {
+        return;
+    }
+    LOG_INFO(Frontend, "Thermal status {}, {} the work done per frame", static_cast<int>(status),
+             throttled ? "reducing" : "restoring");
+    governor->m_throttled = throttled;
+    governor->m_system.Renderer().SetThermalThrottling(throttled);
+}
+
+std::chrono::nanoseconds PerformanceGovernor::TargetWorkDuration() {
+    const u16 speed_limit = Settings::values.speed_limit.GetValue();
+    if (!Settings::values.use_speed_limit.GetValue() || speed_limit == 0) {
+        return SYSTEM_FRAME_INTERVAL;
+    }
+    return SYSTEM_FRAME_INTERVAL * 100 / speed_limit;
+}
+
+bool PerformanceGovernor::CreateSession() {
+    // Threads of previous emulation sessions are still listed, keep the ones that are alive
+    std::vector<s32> thread_ids = Common::GetPerformanceThreadIds();
+    std::erase_if(thread_ids, [](s32 thread_id) {
+        std::error_code ec;
+        return !std::filesystem::exists(fmt::format("/proc/self/task/{}", thread_id), ec);
+    });
+
+    APerformanceHintManager* const manager = m_get_manager();
+    m_target = TargetWorkDuration();
+    if (manager && !thread_ids.empty()) {
+        m_session = m_create_session(manager, thread_ids.data(), thread_ids.size(),
+                                     m_target.count());
+    }
+    if (!m_session) {
+        LOG_WARNING(Frontend, "Failed to create a performance hint session");
+        m_session_failed = true;
+        return false;
+    }
+    LOG_INFO(Frontend, "Created a performance hint session for {} threads", thread_ids.size());
+    return true;
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include <android/thermal.h>
+
+#include "common/dynamic_library.h"
+
+namespace Core {
+class System;
+}
+
+struct APerformanceHintManager;
+struct APerformanceHintSession;
+
+/**
+ * Keeps the frame rate steady on devices that throttle under sustained load.
+ *
+ * The threads running the emulation are put in a hint session of the Android Dynamic Performance
+ * Framework, which is told how long each system frame took against its budget so the clocks
+ * follow the load instead of running flat out. When the device heats up, the renderer is asked
+ * to reduce the work it does for each frame until the device cools down.
+ */
+class PerformanceGovernor {
+public:
+    explicit PerformanceGovernor(Core::System& system);
+    ~PerformanceGovernor();
+
+    /// Reports the walltime the emulator spent on a system frame
+    void FrameWorked(std::chrono::nanoseconds work_time);
+
+private:
+    using GetManagerFn = APerformanceHintManager* (*)();
+    using CreateSessionFn = APerformanceHintSession* (*)(APerformanceHintManager*, const int32_t*,
+                                                        size_t, int64_t);
+    using UpdateTargetFn = int (*)(APerformanceHintSession*, int64_t);
+    using ReportActualFn = int (*)(APerformanceHintSession*, int64_t);
+    using CloseSessionFn = void (*)(APerformanceHintSession*);
+
+    static void OnThermalStatus(void* data, AThermalStatus status);
+
+    /// Returns the budget of a system frame at the current speed limit
+    static std::chrono::nanoseconds TargetWorkDuration();
+
+    /// Creates the hint session from the threads running at the time, returns true on success
+    bool CreateSession();
+
+    Core::System& m_system;
+
+    Common::DynamicLibrary m_android_library;
+    GetManagerFn m_get_manager{};
+    CreateSessionFn m_create_session{};
+    UpdateTargetFn m_update_target{};
+    ReportActualFn m_report_actual{};
+    CloseSessionFn m_close_session{};
+    APerformanceHintSession* m_session{};
+    std::chrono::nanoseconds m_target{};
+    bool m_session_failed = false;
+
+    AThermalManager* m_thermal_manager{};
+    std::mutex m_thermal_mutex;
+    bool m_throttled = false;
+};
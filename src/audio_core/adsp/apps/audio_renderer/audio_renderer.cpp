@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 
@@ -13,10 +14,15 @@
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/perf_stats.h"
 
 MICROPROFILE_DEFINE(Audio_Renderer, "Audio", "DSP_AudioRenderer", MP_RGB(60, 19, 97));
 
 namespace AudioCore::ADSP::AudioRenderer {
+namespace {
+/// Most workers decoding voices, the mixing after them is serial and bounds the speedup anyway
+constexpr u32 MaxVoiceWorkers = 4;
+} // Anonymous namespace
 
 AudioRenderer::AudioRenderer(Core::System& system_, Sink::Sink& sink_)
     : system{system_}, sink{sink_} {}
@@ -28,6 +34,13 @@ AudioRenderer::~AudioRenderer() {
 void AudioRenderer::Start() {
     CreateSinkStreams();
 
+    // Leave a core to the renderer thread and another to the emulated CPU.
+    const u32 num_workers{std::min(std::thread::hardware_concurrency() / 2, MaxVoiceWorkers)};
+    if (num_workers > 1) {
+        voice_workers = std::make_unique<VoiceWorkers>(num_workers, "DSP_AudioVoices",
+                                                       [] { return std::vector<s32>{}; });
+    }
+
     mailbox.Initialize(AppMailboxId::AudioRenderer);
 
     main_thread = std::jthread([this](std::stop_token stop_token) { Main(stop_token); });
@@ -53,6 +66,7 @@ void AudioRenderer::Stop() {
     }
     main_thread.request_stop();
     main_thread.join();
+    voice_workers.reset();
 
     for (auto& stream : streams) {
         if (stream) {
@@ -132,6 +146,7 @@ void AudioRenderer::Main(std::stop_token stop_token) {
     MicroProfileOnThreadCreate(name);
     Common::SetCurrentThreadName(name);
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    Common::SetCurrentThreadCoreClass(Common::ThreadCoreClass::Performance);
 
     // TODO: Create buffer map/unmap thread + mailbox
     // TODO: Create gMix devices, initialize them here
@@ -174,7 +189,8 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     // this is a new command list, initialize it.
                     if (command_buffer.remaining_command_count == 0) {
                         command_list_processor.Initialize(system, command_buffer.buffer,
-                                                          command_buffer.size, streams[index]);
+                                                          command_buffer.size, streams[index],
+                                                          voice_workers.get());
                     }
 
                     if (command_buffer.reset_buffer && !buffers_reset[index]) {
@@ -201,8 +217,11 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     // Process the command list
                     {
                         MICROPROFILE_SCOPE(Audio_Renderer);
+                        const auto host_start{Core::PerfStats::Clock::now()};
                         render_times_taken[index] =
                             command_list_processor.Process(index) - start_time;
+                        system.GetPerfStats().AddAudioRenderTime(
+                            Core::PerfStats::Clock::now() - host_start);
                     }
 
                     const auto end_time{system.CoreTiming().GetGlobalTimeUs().count()};
@@ -103,6 +103,8 @@ private:
     std::array<CommandListProcessor, MaxRendererSessions> command_list_processors{};
     /// The streams which will receive the processed samples
     std::array<Sink::SinkStream*, MaxRendererSessions> streams{};
+    /// Workers shared by the command lists to decode independent voices, null on few cores
+    std::unique_ptr<VoiceWorkers> voice_workers{};
     /// CPU Tick when the DSP was signalled to process, uses time rather than tick
     u64 signalled_tick{0};
 };
@@ -1,20 +1,129 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/commands.h"
+#include "common/microprofile.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/memory.h"
 
+MICROPROFILE_DEFINE(Audio_DataSource, "Audio", "DSP_DataSource", MP_RGB(60, 19, 97));
+MICROPROFILE_DEFINE(Audio_Filter, "Audio", "DSP_Filter", MP_RGB(90, 29, 127));
+MICROPROFILE_DEFINE(Audio_Mix, "Audio", "DSP_Mix", MP_RGB(120, 39, 157));
+MICROPROFILE_DEFINE(Audio_Effect, "Audio", "DSP_Effect", MP_RGB(150, 49, 187));
+MICROPROFILE_DEFINE(Audio_Resample, "Audio", "DSP_Resample", MP_RGB(60, 49, 157));
+MICROPROFILE_DEFINE(Audio_Sink, "Audio", "DSP_Sink", MP_RGB(60, 79, 187));
+MICROPROFILE_DEFINE(Audio_OtherCommand, "Audio", "DSP_Other", MP_RGB(100, 100, 100));
+
 namespace AudioCore::ADSP::AudioRenderer {
+namespace {
+/// Lists with fewer chains are processed serially, queueing them would cost more than it saves
+constexpr size_t MinParallelChains = 4;
+
+/// Returns the output buffer of a data source command, or nullopt for other commands
+std::optional<s16> GetDataSourceOutput(const Renderer::ICommand& command) {
+    switch (command.type) {
+    case Renderer::CommandId::DataSourcePcmInt16Version1:
+        return static_cast<const Renderer::PcmInt16DataSourceVersion1Command&>(command)
+            .output_index;
+    case Renderer::CommandId::DataSourcePcmInt16Version2:
+        return static_cast<const Renderer::PcmInt16DataSourceVersion2Command&>(command)
+            .output_index;
+    case Renderer::CommandId::DataSourcePcmFloatVersion1:
+        return static_cast<const Renderer::PcmFloatDataSourceVersion1Command&>(command)
+            .output_index;
+    case Renderer::CommandId::DataSourcePcmFloatVersion2:
+        return static_cast<const Renderer::PcmFloatDataSourceVersion2Command&>(command)
+            .output_index;
+    case Renderer::CommandId::DataSourceAdpcmVersion1:
+        return static_cast<const Renderer::AdpcmDataSourceVersion1Command&>(command).output_index;
+    case Renderer::CommandId::DataSourceAdpcmVersion2:
+        return static_cast<const Renderer::AdpcmDataSourceVersion2Command&>(command).output_index;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Returns the input and output buffers of a voice filter command, or nullopt for other commands
+std::optional<std::pair<s16, s16>> GetVoiceFilterBuffers(const Renderer::ICommand& command) {
+    switch (command.type) {
+    case Renderer::CommandId::BiquadFilter: {
+        const auto& biquad{static_cast<const Renderer::BiquadFilterCommand&>(command)};
+        return std::pair{biquad.input, biquad.output};
+    }
+    case Renderer::CommandId::MultiTapBiquadFilter: {
+        const auto& biquad{static_cast<const Renderer::MultiTapBiquadFilterCommand&>(command)};
+        return std::pair{biquad.input, biquad.output};
+    }
+    case Renderer::CommandId::VolumeRamp: {
+        const auto& volume{static_cast<const Renderer::VolumeRampCommand&>(command)};
+        return std::pair{volume.input_index, volume.output_index};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Returns the profiler timer of the category a command belongs to
+MicroProfileToken GetCommandToken(Renderer::CommandId type) {
+    switch (type) {
+    case Renderer::CommandId::DataSourcePcmInt16Version1:
+    case Renderer::CommandId::DataSourcePcmInt16Version2:
+    case Renderer::CommandId::DataSourcePcmFloatVersion1:
+    case Renderer::CommandId::DataSourcePcmFloatVersion2:
+    case Renderer::CommandId::DataSourceAdpcmVersion1:
+    case Renderer::CommandId::DataSourceAdpcmVersion2:
+        return MICROPROFILE_TOKEN(Audio_DataSource);
+    case Renderer::CommandId::BiquadFilter:
+    case Renderer::CommandId::MultiTapBiquadFilter:
+        return MICROPROFILE_TOKEN(Audio_Filter);
+    case Renderer::CommandId::Volume:
+    case Renderer::CommandId::VolumeRamp:
+    case Renderer::CommandId::Mix:
+    case Renderer::CommandId::MixRamp:
+    case Renderer::CommandId::MixRampGrouped:
+    case Renderer::CommandId::DepopPrepare:
+    case Renderer::CommandId::DepopForMixBuffers:
+    case Renderer::CommandId::ClearMixBuffer:
+    case Renderer::CommandId::CopyMixBuffer:
+        return MICROPROFILE_TOKEN(Audio_Mix);
+    case Renderer::CommandId::Delay:
+    case Renderer::CommandId::Aux:
+    case Renderer::CommandId::Reverb:
+    case Renderer::CommandId::I3dl2Reverb:
+    case Renderer::CommandId::LightLimiterVersion1:
+    case Renderer::CommandId::LightLimiterVersion2:
+    case Renderer::CommandId::Capture:
+    case Renderer::CommandId::Compressor:
+        return MICROPROFILE_TOKEN(Audio_Effect);
+    case Renderer::CommandId::Upsample:
+    case Renderer::CommandId::DownMix6chTo2ch:
+        return MICROPROFILE_TOKEN(Audio_Resample);
+    case Renderer::CommandId::DeviceSink:
+    case Renderer::CommandId::CircularBufferSink:
+        return MICROPROFILE_TOKEN(Audio_Sink);
+    default:
+        return MICROPROFILE_TOKEN(Audio_OtherCommand);
+    }
+}
+
+/// Processes a command, timed under its category in the profiler
+void ProcessCommand(Renderer::ICommand& command, CommandListProcessor& processor) {
+    MICROPROFILE_SCOPE_TOKEN(GetCommandToken(command.type));
+    command.Process(processor);
+}
+} // Anonymous namespace
 
 void CommandListProcessor::Initialize(Core::System& system_, CpuAddr buffer, u64 size,
-                                      Sink::SinkStream* stream_) {
+                                      Sink::SinkStream* stream_, VoiceWorkers* voice_workers_) {
     system = &system_;
     memory = &system->ApplicationMemory();
     stream = stream_;
@@ -27,6 +136,7 @@ void CommandListProcessor::Initialize(Core::System& system_, CpuAddr buffer, u64
     mix_buffers = header->samples_buffer;
     buffer_count = header->buffer_count;
     processed_command_count = 0;
+    voice_workers = voice_workers_;
 }
 
 void CommandListProcessor::SetProcessTimeMax(const u64 time) {
@@ -52,6 +162,12 @@ u64 CommandListProcessor::Process(u32 session_id) {
         current_processing_time = 0;
     }
 
+    if (processed_command_count == 0 && voice_workers && !Settings::values.dump_audio_commands &&
+        ProcessParallel()) {
+        end_time = system->CoreTiming().GetGlobalTimeUs().count();
+        return end_time - start_time_;
+    }
+
     std::string dump{fmt::format("\nSession {}\n", session_id)};
 
     for (u32 index = 0; index < command_count; index++) {
@@ -82,7 +198,7 @@ u64 CommandListProcessor::Process(u32 session_id) {
         }
 
         if (command.enabled) {
-            command.Process(*this);
+            ProcessCommand(command, *this);
         } else {
             dump += fmt::format("\tDisabled!\n");
         }
@@ -100,4 +216,139 @@ u64 CommandListProcessor::Process(u32 session_id) {
     return end_time - start_time_;
 }
 
+bool CommandListProcessor::ProcessParallel() {
+    if (!ScheduleVoiceChains()) {
+        return false;
+    }
+
+    chain_samples.resize(chain_buffers.size() * sample_count);
+    for (const auto& chain : voice_chains) {
+        voice_workers->QueueWork([this, &chain](std::vector<s32>* worker_mix_buffers) {
+            RunVoiceChain(chain, *worker_mix_buffers);
+        });
+    }
+    voice_workers->WaitForRequests();
+
+    for (const auto& scheduled : scheduled_commands) {
+        auto& command{*scheduled.command};
+        if (scheduled.chain == NoChain) {
+            if (command.enabled) {
+                ProcessCommand(command, *this);
+            }
+        } else if (&command == voice_chains[scheduled.chain].last_command) {
+            // Write the chain's buffers back, as if it had just run here.
+            const auto& chain{voice_chains[scheduled.chain]};
+            for (u32 i = chain.first_buffer; i < chain.first_buffer + chain.buffer_count; i++) {
+                const auto samples{
+                    std::span(chain_samples).subspan(i * sample_count, sample_count)};
+                std::ranges::copy(samples,
+                                  mix_buffers.subspan(chain_buffers[i] * sample_count).begin());
+            }
+        }
+
+        processed_command_count++;
+        commands += command.size;
+    }
+    return true;
+}
+
+bool CommandListProcessor::ScheduleVoiceChains() {
+    scheduled_commands.clear();
+    voice_chains.clear();
+    chain_commands.clear();
+    chain_buffers.clear();
+
+    const auto writes_buffer{[this](const VoiceChain& chain, s16 index) {
+        const auto begin{chain_buffers.begin() + chain.first_buffer};
+        return std::find(begin, begin + chain.buffer_count, index) != begin + chain.buffer_count;
+    }};
+    const auto add_command{[&](VoiceChain& chain, Renderer::ICommand& command, s16 output) {
+        if (output < 0 || static_cast<u32>(output) >= buffer_count) {
+            return false;
+        }
+        if (!writes_buffer(chain, output)) {
+            chain_buffers.push_back(output);
+            chain.buffer_count++;
+        }
+        chain_commands.push_back(&command);
+        chain.command_count++;
+        chain.last_command = &command;
+        return true;
+    }};
+
+    std::optional<u32> open_chain;
+    u8* command_ptr{commands};
+    for (u32 index = 0; index < command_count; index++) {
+        auto& command{*reinterpret_cast<Renderer::ICommand*>(command_ptr)};
+        const auto current_offset{CpuAddr(command_ptr) - CpuAddr(commands)};
+        if (command.magic != 0xCAFEBABE || current_offset + command.size > commands_buffer_size ||
+            !command.Verify(*this)) {
+            // Leave the error to the serial path.
+            return false;
+        }
+        command_ptr += command.size;
+
+        u32 chain_index{NoChain};
+        if (!command.enabled || command.type == Renderer::CommandId::Performance) {
+            // Neither touches the mix buffers, the open chain can continue past them.
+        } else if (const auto output{GetDataSourceOutput(command)}) {
+            if (!open_chain || voice_chains[*open_chain].node_id != command.node_id) {
+                open_chain = static_cast<u32>(voice_chains.size());
+                voice_chains.push_back({
+                    .node_id = command.node_id,
+                    .first_command = static_cast<u32>(chain_commands.size()),
+                    .command_count = 0,
+                    .first_buffer = static_cast<u32>(chain_buffers.size()),
+                    .buffer_count = 0,
+                    .last_command = nullptr,
+                });
+            }
+            if (!add_command(voice_chains[*open_chain], command, *output)) {
+                return false;
+            }
+            chain_index = *open_chain;
+        } else if (const auto buffers{GetVoiceFilterBuffers(command)};
+                   buffers && open_chain && voice_chains[*open_chain].node_id == command.node_id &&
+                   writes_buffer(voice_chains[*open_chain], buffers->first)) {
+            if (!add_command(voice_chains[*open_chain], command, buffers->second)) {
+                return false;
+            }
+            chain_index = *open_chain;
+        } else {
+            // Anything else may read or write the buffers of the open chain, close it.
+            open_chain.reset();
+        }
+        scheduled_commands.push_back({&command, chain_index});
+    }
+    return voice_chains.size() >= MinParallelChains;
+}
+
+void CommandListProcessor::RunVoiceChain(const VoiceChain& chain, std::vector<s32>& buffers) {
+    // Chains only read buffers they wrote before, but a data source bailing out early leaves its
+    // output as it was. Clear them so that is silence, where the serial path would leave the
+    // samples of the previous voice.
+    buffers.resize(static_cast<size_t>(buffer_count) * sample_count);
+    const auto chain_buffer{[&](u32 i) {
+        return std::span(buffers).subspan(chain_buffers[i] * sample_count, sample_count);
+    }};
+    for (u32 i = chain.first_buffer; i < chain.first_buffer + chain.buffer_count; i++) {
+        std::ranges::fill(chain_buffer(i), 0);
+    }
+
+    CommandListProcessor processor;
+    processor.system = system;
+    processor.memory = memory;
+    processor.sample_count = sample_count;
+    processor.target_sample_rate = target_sample_rate;
+    processor.mix_buffers = buffers;
+    processor.buffer_count = buffer_count;
+    for (u32 i = 0; i < chain.command_count; i++) {
+        ProcessCommand(*chain_commands[chain.first_command + i], processor);
+    }
+
+    for (u32 i = chain.first_buffer; i < chain.first_buffer + chain.buffer_count; i++) {
+        std::ranges::copy(chain_buffer(i), chain_samples.begin() + i * sample_count);
+    }
+}
+
 } // namespace AudioCore::ADSP::AudioRenderer
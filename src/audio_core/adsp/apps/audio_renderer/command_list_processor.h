@@ -4,10 +4,13 @@
 #pragma once
 
 #include <span>
+#include <string>
+#include <vector>
 
 #include "audio_core/common/common.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 
 namespace Core {
 namespace Memory {
@@ -23,10 +26,14 @@ class SinkStream;
 
 namespace Renderer {
 struct CommandListHeader;
-}
+struct ICommand;
+} // namespace Renderer
 
 namespace ADSP::AudioRenderer {
 
+/// Workers running the source commands of independent voices, each with its own mix buffers
+using VoiceWorkers = Common::StatefulThreadWorker<std::vector<s32>>;
+
 /**
  * A processor for command lists given to the AudioRenderer.
  */
@@ -39,8 +46,10 @@ public:
      * @param buffer - The command buffer to process.
      * @param size   - The size of the buffer.
      * @param stream - The stream to be used for sending the samples.
+     * @param voice_workers - Workers to decode independent voices on, or null to run serially.
      */
-    void Initialize(Core::System& system, CpuAddr buffer, u64 size, Sink::SinkStream* stream);
+    void Initialize(Core::System& system, CpuAddr buffer, u64 size, Sink::SinkStream* stream,
+                    VoiceWorkers* voice_workers = nullptr);
 
     /**
      * Set the maximum processing time for this command list.
@@ -106,6 +115,67 @@ public:
     u64 end_time{};
     /// Last command list string generated, used for dumping audio commands to console
     std::string last_dump{};
+    /// Workers the voice source commands are run on, null if they run serially
+    VoiceWorkers* voice_workers{};
+
+private:
+    /// Commands of one voice channel from its data source up to its mixes, see ProcessParallel
+    struct VoiceChain {
+        /// Node id of the voice
+        u32 node_id;
+        /// Range of this chain's commands in chain_commands
+        u32 first_command;
+        u32 command_count;
+        /// Range of the mix buffers written by this chain in chain_buffers
+        u32 first_buffer;
+        u32 buffer_count;
+        /// The last command of the chain, its buffers are copied back once it is reached
+        const Renderer::ICommand* last_command;
+    };
+
+    /// A command of the list, and the chain it belongs to or NoChain
+    struct ScheduledCommand {
+        Renderer::ICommand* command;
+        u32 chain;
+    };
+
+    static constexpr u32 NoChain = ~0U;
+
+    /**
+     * Process the command list, running the data source, biquad and volume ramp commands of
+     * each voice channel on the voice workers. Those commands only read the buffers the same
+     * chain wrote before, so each chain runs on private mix buffers and writes them back in
+     * command order, where the list reads them. Every other command runs serially, in order.
+     *
+     * @return True if the list was processed, false if it must be processed serially.
+     */
+    bool ProcessParallel();
+
+    /**
+     * Split the command list into voice chains, checking each command like the serial path.
+     *
+     * @return True if the list has enough chains to be worth processing in parallel.
+     */
+    bool ScheduleVoiceChains();
+
+    /**
+     * Run the commands of a chain on private mix buffers, and save the buffers it wrote.
+     *
+     * @param chain   - The chain to run.
+     * @param buffers - Mix buffers of the worker running the chain.
+     */
+    void RunVoiceChain(const VoiceChain& chain, std::vector<s32>& buffers);
+
+    /// Commands of the list being processed
+    std::vector<ScheduledCommand> scheduled_commands{};
+    /// Chains of the list being processed
+    std::vector<VoiceChain> voice_chains{};
+    /// Commands of every chain
+    std::vector<Renderer::ICommand*> chain_commands{};
+    /// Mix buffer indices written by every chain
+    std::vector<s16> chain_buffers{};
+    /// Samples of the buffers in chain_buffers, once their chain ran
+    std::vector<s32> chain_samples{};
 };
 
 } // namespace ADSP::AudioRenderer
@@ -1,12 +1,31 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
+
 #include "audio_core/audio_core.h"
 #include "audio_core/sink/sink_details.h"
 #include "common/settings.h"
 #include "core/core.h"
 
 namespace AudioCore {
+namespace {
+/// Sinks of the previous emulation session, kept so that a restart doesn't have to open the host
+/// audio backend again, which takes up to a second on some systems
+struct ParkedSinks {
+    std::mutex mutex;
+    Settings::AudioEngine sink_id{};
+    std::string output_device_id;
+    std::string input_device_id;
+    Sink::SinkPtr output_sink;
+    Sink::SinkPtr input_sink;
+};
+
+ParkedSinks& GetParkedSinks() {
+    static ParkedSinks parked_sinks;
+    return parked_sinks;
+}
+} // Anonymous namespace
 
 AudioCore::AudioCore(Core::System& system) : audio_manager{std::make_unique<AudioManager>()} {
     CreateSinks();
@@ -16,15 +35,46 @@ AudioCore::AudioCore(Core::System& system) : audio_manager{std::make_unique<Audi
 
 AudioCore ::~AudioCore() {
     Shutdown();
+    // The ADSP must close its streams while the sinks are still alive
+    adsp.reset();
+
+    output_sink->CloseStreams();
+    input_sink->CloseStreams();
+    ParkedSinks& parked{GetParkedSinks()};
+    std::scoped_lock lk{parked.mutex};
+    parked.sink_id = sink_id;
+    parked.output_device_id = std::move(output_device_id);
+    parked.input_device_id = std::move(input_device_id);
+    parked.output_sink = std::move(output_sink);
+    parked.input_sink = std::move(input_sink);
 }
 
 void AudioCore::CreateSinks() {
-    const auto& sink_id{Settings::values.sink_id};
-    const auto& audio_output_device_id{Settings::values.audio_output_device_id};
-    const auto& audio_input_device_id{Settings::values.audio_input_device_id};
+    sink_id = Settings::values.sink_id.GetValue();
+    output_device_id = Settings::values.audio_output_device_id.GetValue();
+    input_device_id = Settings::values.audio_input_device_id.GetValue();
+
+    ParkedSinks& parked{GetParkedSinks()};
+    std::scoped_lock lk{parked.mutex};
+    if (parked.output_sink && parked.sink_id == sink_id &&
+        parked.output_device_id == output_device_id && parked.input_device_id == input_device_id) {
+        output_sink = std::move(parked.output_sink);
+        input_sink = std::move(parked.input_sink);
+        return;
+    }
+    // Close the previous backend before opening another
+    parked.output_sink.reset();
+    parked.input_sink.reset();
+
+    output_sink = Sink::CreateSinkFromID(sink_id, output_device_id);
+    input_sink = Sink::CreateSinkFromID(sink_id, input_device_id);
+}
 
-    output_sink = Sink::CreateSinkFromID(sink_id.GetValue(), audio_output_device_id.GetValue());
-    input_sink = Sink::CreateSinkFromID(sink_id.GetValue(), audio_input_device_id.GetValue());
+void AudioCore::ReleaseParkedSinks() {
+    ParkedSinks& parked{GetParkedSinks()};
+    std::scoped_lock lk{parked.mutex};
+    parked.output_sink.reset();
+    parked.input_sink.reset();
 }
 
 void AudioCore::Shutdown() {
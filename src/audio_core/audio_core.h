@@ -4,10 +4,12 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "audio_core/adsp/adsp.h"
 #include "audio_core/audio_manager.h"
 #include "audio_core/sink/sink.h"
+#include "common/settings_enums.h"
 
 namespace Core {
 class System;
@@ -57,6 +59,12 @@ public:
      */
     ADSP::ADSP& ADSP();
 
+    /**
+     * Close the sinks kept from the previous emulation session.
+     * Must be called before the host audio backends are torn down on exit.
+     */
+    static void ReleaseParkedSinks();
+
 private:
     /**
      * Create the sinks on startup.
@@ -71,6 +79,10 @@ private:
     std::unique_ptr<Sink::Sink> input_sink;
     /// The ADSP in the sysmodule
     std::unique_ptr<ADSP::ADSP> adsp;
+    /// Settings the sinks were created with, to tell whether the next session can reuse them
+    Settings::AudioEngine sink_id{};
+    std::string output_device_id;
+    std::string input_device_id;
 };
 
 } // namespace AudioCore
@@ -4,6 +4,7 @@
 #include "audio_core/opus/decoder.h"
 #include "audio_core/opus/hardware_opus.h"
 #include "audio_core/opus/parameters.h"
+#include "audio_core/opus/work_buffer_pool.h"
 #include "common/alignment.h"
 #include "common/swap.h"
 #include "core/core.h"
@@ -19,20 +20,22 @@ OpusPacketHeader ReverseHeader(OpusPacketHeader header) {
 }
 } // namespace
 
-OpusDecoder::OpusDecoder(Core::System& system_, HardwareOpus& hardware_opus_)
-    : system{system_}, hardware_opus{hardware_opus_} {}
+OpusDecoder::OpusDecoder(Core::System& system_, HardwareOpus& hardware_opus_,
+                         WorkBufferPool& work_buffer_pool_)
+    : system{system_}, hardware_opus{hardware_opus_}, work_buffer_pool{work_buffer_pool_} {}
 
 OpusDecoder::~OpusDecoder() {
     if (decode_object_initialized) {
         hardware_opus.ShutdownDecodeObject(shared_buffer.get(), shared_buffer_size);
     }
+    work_buffer_pool.Release(std::move(shared_buffer), shared_buffer_size);
 }
 
 Result OpusDecoder::Initialize(OpusParametersEx& params, Kernel::KTransferMemory* transfer_memory,
                                u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
     shared_buffer_size = transfer_memory_size;
-    shared_buffer = std::make_unique<u8[]>(shared_buffer_size);
+    shared_buffer = work_buffer_pool.Acquire(shared_buffer_size);
     shared_memory_mapped = true;
 
     buffer_size =
@@ -63,7 +66,7 @@ Result OpusDecoder::Initialize(OpusMultiStreamParametersEx& params,
                                Kernel::KTransferMemory* transfer_memory, u64 transfer_memory_size) {
     auto frame_size{params.use_large_frame_size ? 5760 : 1920};
     shared_buffer_size = transfer_memory_size;
-    shared_buffer = std::make_unique<u8[]>(shared_buffer_size);
+    shared_buffer = work_buffer_pool.Acquire(shared_buffer_size);
     shared_memory_mapped = true;
 
     buffer_size =
@@ -16,10 +16,12 @@ class System;
 
 namespace AudioCore::OpusDecoder {
 class HardwareOpus;
+class WorkBufferPool;
 
 class OpusDecoder {
 public:
-    explicit OpusDecoder(Core::System& system, HardwareOpus& hardware_opus_);
+    explicit OpusDecoder(Core::System& system, HardwareOpus& hardware_opus_,
+                         WorkBufferPool& work_buffer_pool_);
     ~OpusDecoder();
 
     Result Initialize(OpusParametersEx& params, Kernel::KTransferMemory* transfer_memory,
@@ -36,6 +38,7 @@ public:
 private:
     Core::System& system;
     HardwareOpus& hardware_opus;
+    WorkBufferPool& work_buffer_pool;
     std::unique_ptr<u8[]> shared_buffer{};
     u64 shared_buffer_size;
     std::span<u8> in_data{};
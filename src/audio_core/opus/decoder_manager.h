@@ -5,6 +5,7 @@
 
 #include "audio_core/opus/hardware_opus.h"
 #include "audio_core/opus/parameters.h"
+#include "audio_core/opus/work_buffer_pool.h"
 #include "common/common_types.h"
 #include "core/hle/service/audio/errors.h"
 
@@ -22,6 +23,10 @@ public:
         return hardware_opus;
     }
 
+    WorkBufferPool& GetWorkBufferPool() {
+        return work_buffer_pool;
+    }
+
     Result GetWorkBufferSize(OpusParameters& params, u64& out_size);
     Result GetWorkBufferSizeEx(OpusParametersEx& params, u64& out_size);
     Result GetWorkBufferSizeExEx(OpusParametersEx& params, u64& out_size);
@@ -32,6 +37,7 @@ public:
 private:
     Core::System& system;
     HardwareOpus hardware_opus;
+    WorkBufferPool work_buffer_pool;
     std::array<u64, MaxChannels> required_workbuffer_sizes{};
 };
 
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "audio_core/adsp/apps/opus/opus_decode_object.h"
+#include "audio_core/adsp/apps/opus/opus_multistream_decode_object.h"
+#include "audio_core/opus/work_buffer_pool.h"
+
+namespace AudioCore::OpusDecoder {
+
+static_assert(sizeof(ADSP::OpusDecoder::OpusDecodeObject) <= WorkBufferPool::HeaderSize);
+static_assert(sizeof(ADSP::OpusDecoder::OpusMultiStreamDecodeObject) <=
+              WorkBufferPool::HeaderSize);
+
+std::unique_ptr<u8[]> WorkBufferPool::Acquire(u64 size) {
+    {
+        std::scoped_lock lk{mutex};
+        // Prefer the most recently released buffer, it is the likeliest to still be cached.
+        const auto it{std::find_if(entries.rbegin(), entries.rend(),
+                                   [size](const Entry& entry) { return entry.size == size; })};
+        if (it != entries.rend()) {
+            auto buffer{std::move(it->buffer)};
+            entries.erase(std::next(it).base());
+
+            // A stale decode object header would make the ADSP skip initializing the decoder.
+            std::memset(buffer.get(), 0, std::min<u64>(size, HeaderSize));
+            return buffer;
+        }
+    }
+    return std::make_unique<u8[]>(size);
+}
+
+void WorkBufferPool::Release(std::unique_ptr<u8[]> buffer, u64 size) {
+    if (!buffer) {
+        return;
+    }
+    std::scoped_lock lk{mutex};
+    if (entries.size() == MaxPooledBuffers) {
+        entries.erase(entries.begin());
+    }
+    entries.push_back({size, std::move(buffer)});
+}
+
+size_t WorkBufferPool::GetPooledCount() const {
+    std::scoped_lock lk{mutex};
+    return entries.size();
+}
+
+} // namespace AudioCore::OpusDecoder
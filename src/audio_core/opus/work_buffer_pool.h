@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace AudioCore::OpusDecoder {
+
+/**
+ * Keeps the work buffers of closed decoders, which hold their libopus state, so games creating a
+ * decoder per sound get a buffer that is already allocated and paged in.
+ */
+class WorkBufferPool {
+public:
+    /// Most buffers kept, the oldest ones are freed past it
+    static constexpr size_t MaxPooledBuffers = 8;
+
+    /// Bytes cleared at the start of a reused buffer, covering the ADSP decode object headers
+    static constexpr size_t HeaderSize = 0x40;
+
+    /**
+     * Returns a buffer of the given size, reusing a released one if there is one. The buffer
+     * starts with HeaderSize zero bytes, fresh buffers are zeroed entirely.
+     */
+    std::unique_ptr<u8[]> Acquire(u64 size);
+
+    /// Hands a buffer back, to be returned by a later Acquire of the same size
+    void Release(std::unique_ptr<u8[]> buffer, u64 size);
+
+    /// Returns the number of buffers waiting to be reused
+    size_t GetPooledCount() const;
+
+private:
+    struct Entry {
+        u64 size;
+        std::unique_ptr<u8[]> buffer;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+};
+
+} // namespace AudioCore::OpusDecoder
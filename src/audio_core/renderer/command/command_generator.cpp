@@ -23,6 +23,23 @@
 
 namespace AudioCore::Renderer {
 
+/**
+ * Get the destination linked a number of entries after the given one. This is what
+ * SplitterContext::GetDestinationData returns for the index that many entries later, without
+ * walking the list again from its start, which made iterating over a splitter quadratic.
+ *
+ * @param destination - The destination to start from, may be nullptr.
+ * @param count       - Number of links to follow.
+ * @return The destination, or nullptr past the end of the list.
+ */
+static SplitterDestinationData* SkipDestinations(SplitterDestinationData* destination,
+                                                 const u32 count) {
+    for (u32 i = 0; i < count && destination != nullptr; i++) {
+        destination = destination->GetNext();
+    }
+    return destination;
+}
+
 CommandGenerator::CommandGenerator(CommandBuffer& command_buffer_,
                                    const CommandListHeader& command_list_header_,
                                    const AudioRendererSystemContext& render_context_,
@@ -42,7 +59,6 @@ void CommandGenerator::GenerateDataSourceCommand(VoiceInfo& voice_info,
     if (voice_info.mix_id == UnusedMixId) {
         if (voice_info.splitter_id != UnusedSplitterId) {
             auto destination{splitter_context.GetDestinationData(voice_info.splitter_id, 0)};
-            u32 dest_id{0};
             while (destination != nullptr) {
                 if (destination->IsConfigured()) {
                     auto mix_id{destination->GetMixId()};
@@ -54,8 +70,7 @@ void CommandGenerator::GenerateDataSourceCommand(VoiceInfo& voice_info,
                             voice_info.was_playing);
                     }
                 }
-                dest_id++;
-                destination = splitter_context.GetDestinationData(voice_info.splitter_id, dest_id);
+                destination = SkipDestinations(destination, 1);
             }
         }
     } else {
@@ -233,8 +248,8 @@ void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
 
         if (voice_info.mix_id == UnusedMixId) {
             if (voice_info.splitter_id != UnusedSplitterId) {
-                auto i{channel};
-                auto destination{splitter_context.GetDestinationData(voice_info.splitter_id, i)};
+                auto destination{
+                    splitter_context.GetDestinationData(voice_info.splitter_id, channel)};
                 while (destination != nullptr) {
                     if (destination->IsConfigured()) {
                         const auto mix_id{destination->GetMixId()};
@@ -248,8 +263,7 @@ void CommandGenerator::GenerateVoiceCommand(VoiceInfo& voice_info) {
                             destination->MarkAsNeedToUpdateInternalState();
                         }
                     }
-                    i += voice_info.channel_count;
-                    destination = splitter_context.GetDestinationData(voice_info.splitter_id, i);
+                    destination = SkipDestinations(destination, voice_info.channel_count);
                 }
             }
         } else {
@@ -611,8 +625,7 @@ void CommandGenerator::GenerateMixCommands(MixInfo& mix_info) {
                     }
                 }
                 dest_id++;
-                destination =
-                    splitter_context.GetDestinationData(mix_info.dst_splitter_id, dest_id);
+                destination = SkipDestinations(destination, 1);
             }
         }
     } else {
@@ -91,6 +91,36 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
     return samples_to_decode;
 }
 
+void DecodeAdpcmFrame(std::span<s16, AdpcmSamplesPerFrame> out,
+                      std::span<const u8, AdpcmFrameSize> frame,
+                      const std::array<s16, 16>& coefficients, s16& yn0, s16& yn1) {
+    const u32 coeff_index{(frame[0] >> 4U) & 0xFU};
+    const s32 coeff0{coefficients[coeff_index * 2 + 0]};
+    const s32 coeff1{coefficients[coeff_index * 2 + 1]};
+    const s32 scale{frame[0] & 0xF};
+
+    // The scaled codes do not depend on the previous samples, so they are expanded first and only
+    // the predictor is left in the serial loop.
+    std::array<s32, AdpcmSamplesPerFrame> xn;
+    for (u32 i = 0; i < AdpcmSamplesPerFrame / 2; i++) {
+        const auto byte{static_cast<s8>(frame[1 + i])};
+        xn[i * 2 + 0] = ((byte >> 4) * (1 << scale) << 11) + 0x400;
+        xn[i * 2 + 1] = ((static_cast<s8>(byte << 4) >> 4) * (1 << scale) << 11) + 0x400;
+    }
+
+    s32 y0{yn0};
+    s32 y1{yn1};
+    for (u32 i = 0; i < AdpcmSamplesPerFrame; i++) {
+        const auto sample{std::clamp<s32>((xn[i] + coeff0 * y0 + coeff1 * y1) >> 11, -0x8000,
+                                          0x7FFF)};
+        y1 = y0;
+        y0 = sample;
+        out[i] = static_cast<s16>(sample);
+    }
+    yn0 = static_cast<s16>(y0);
+    yn1 = static_cast<s16>(y1);
+}
+
 /**
  * Decode ADPCM data.
  *
@@ -101,7 +131,7 @@ static u32 DecodePcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
  */
 static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
                        const DecodeArg& req) {
-    constexpr u32 SamplesPerFrame{14};
+    constexpr u32 SamplesPerFrame{AdpcmSamplesPerFrame};
     constexpr u32 NibblesPerFrame{16};
 
     if (req.buffer == 0 || req.buffer_size == 0) {
@@ -173,29 +203,27 @@ static u32 DecodeAdpcm(Core::Memory::Memory& memory, std::span<s16> out_buffer,
     while (samples_to_read > 0) {
         // Are we at a new frame?
         if ((position_in_frame % NibblesPerFrame) == 0) {
-            header = wavebuffer[read_index++];
+            header = wavebuffer[read_index];
             coeff_index = (header >> 4) & 0xF;
             scale = header & 0xF;
             coeff0 = req.coefficients[coeff_index * 2 + 0];
             coeff1 = req.coefficients[coeff_index * 2 + 1];
-            position_in_frame += 2;
 
             // Can we consume all of this frame's samples?
             if (samples_to_read >= SamplesPerFrame) {
-                // Can grab all samples until the next header
-                for (u32 i = 0; i < SamplesPerFrame / 2; i++) {
-                    auto code0{Steps[(wavebuffer[read_index] >> 4) & 0xF]};
-                    auto code1{Steps[wavebuffer[read_index] & 0xF]};
-                    read_index++;
-
-                    out_buffer[write_index++] = decode_sample(code0);
-                    out_buffer[write_index++] = decode_sample(code1);
-                }
-
-                position_in_frame += SamplesPerFrame;
+                DecodeAdpcmFrame(out_buffer.subspan(write_index).first<AdpcmSamplesPerFrame>(),
+                                 std::span<const u8, AdpcmFrameSize>{
+                                     wavebuffer.data() + read_index, AdpcmFrameSize},
+                                 req.coefficients, yn0, yn1);
+                read_index += AdpcmFrameSize;
+                write_index += SamplesPerFrame;
+                position_in_frame += NibblesPerFrame;
                 samples_to_read -= SamplesPerFrame;
                 continue;
             }
+
+            read_index++;
+            position_in_frame += 2;
         }
 
         // Decode a single sample
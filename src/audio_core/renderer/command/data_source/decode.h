@@ -17,6 +17,11 @@ class Memory;
 
 namespace AudioCore::Renderer {
 
+/// Samples in a full ADPCM frame
+constexpr u32 AdpcmSamplesPerFrame = 14;
+/// Bytes in a full ADPCM frame, its header followed by two samples per byte
+constexpr u32 AdpcmFrameSize = 1 + AdpcmSamplesPerFrame / 2;
+
 struct DecodeFromWaveBuffersArgs {
     SampleFormat sample_format;
     std::span<s32> output;
@@ -48,6 +53,19 @@ struct DecodeArg {
     u32 samples_to_read;
 };
 
+/**
+ * Decode a full ADPCM frame.
+ *
+ * @param out          - Output for the samples of the frame.
+ * @param frame        - The frame to decode.
+ * @param coefficients - Coefficients of the wavebuffer.
+ * @param yn0          - Last sample decoded, updated to the last sample of the frame.
+ * @param yn1          - Sample before yn0, updated the same way.
+ */
+void DecodeAdpcmFrame(std::span<s16, AdpcmSamplesPerFrame> out,
+                      std::span<const u8, AdpcmFrameSize> frame,
+                      const std::array<s16, 16>& coefficients, s16& yn0, s16& yn1);
+
 /**
  * Decode wavebuffers according to the given args.
  *
@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <limits>
+
+#if defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "audio_core/renderer/command/dsp_kernels.h"
+#include "audio_core/renderer/command/dsp_kernels_simd.h"
+#include "common/assert.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace AudioCore::Renderer::Dsp {
+namespace {
+
+template <size_t Q>
+s32 MixRampScalar(std::span<s32> output, std::span<const s32> input,
+                  Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+                  u32 sample_count) {
+    Common::FixedPoint<64 - Q, Q> sample{0};
+    for (u32 i = 0; i < sample_count; i++) {
+        sample = input[i] * volume;
+        output[i] = (output[i] + sample).to_int();
+        volume += ramp;
+    }
+    return sample.to_int();
+}
+
+template <size_t Q>
+void ApplyGainRampScalar(std::span<s32> output, std::span<const s32> input,
+                         Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+                         u32 sample_count) {
+    for (u32 i = 0; i < sample_count; i++) {
+        output[i] = (input[i] * volume).to_int();
+        volume += ramp;
+    }
+}
+
+template <u32 Taps>
+void ResampleFilterScalar(std::span<s32> output, std::span<const s16> input,
+                          std::span<const f32> lut,
+                          const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                          Common::FixedPoint<49, 15>& fraction, u32 samples_to_write) {
+    u32 read_index{0};
+    for (u32 i = 0; i < samples_to_write; i++) {
+        const auto lut_index{(fraction.get_frac() >> 8) * Taps};
+        Common::FixedPoint<56, 8> sum{0};
+        for (u32 tap = 0; tap < Taps; tap++) {
+            sum += Common::FixedPoint<56, 8>{input[read_index + tap] * lut[lut_index + tap]};
+        }
+        output[i] = sum.to_int_floor();
+        fraction += sample_rate_ratio;
+        read_index += static_cast<u32>(fraction.to_int_floor());
+        fraction.clear_int();
+    }
+}
+
+#if defined(ARCHITECTURE_arm64)
+/// Rounds the 64 bit products in each lane like RoundToInt and narrows them to 32 bits
+int32x2_t RoundProducts(int64x2_t products, int64x2_t fractional_mask, int64x2_t shift) {
+    const int64x2_t half = vshrq_n_s64(vandq_s64(products, fractional_mask), 1);
+    return vmovn_s64(vshlq_s64(vaddq_s64(products, half), shift));
+}
+
+template <bool MIX>
+void ApplyVolumeRampNEON(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                         u32 sample_count) {
+    const int64x2_t fractional_mask = vdupq_n_s64((s64{1} << q) - 1);
+    const int64x2_t shift = vdupq_n_s64(-static_cast<s64>(q));
+    const int64x2_t step = vdupq_n_s64(ramp * 4);
+    int64x2_t volume_low = vcombine_s64(vdup_n_s64(volume), vdup_n_s64(volume + ramp));
+    int64x2_t volume_high =
+        vcombine_s64(vdup_n_s64(volume + ramp * 2), vdup_n_s64(volume + ramp * 3));
+
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const int32x4_t samples = vld1q_s32(input + i);
+        const int32x2_t low = RoundProducts(
+            vmull_s32(vget_low_s32(samples), vmovn_s64(volume_low)), fractional_mask, shift);
+        const int32x2_t high = RoundProducts(
+            vmull_s32(vget_high_s32(samples), vmovn_s64(volume_high)), fractional_mask, shift);
+        int32x4_t result = vcombine_s32(low, high);
+        if constexpr (MIX) {
+            result = vaddq_s32(result, vld1q_s32(output + i));
+        }
+        vst1q_s32(output + i, result);
+        volume_low = vaddq_s64(volume_low, step);
+        volume_high = vaddq_s64(volume_high, step);
+    }
+    ApplyVolumeRampScalar<MIX>(output, input, volume, ramp, q, i, sample_count);
+}
+
+/// Multiplies four samples by their coefficients, truncating each product to 24.8 fixed point
+int32x4_t FilterProducts(int16x4_t samples, const f32* lut) {
+    const float32x4_t products =
+        vmulq_n_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(samples)), vld1q_f32(lut)), 256.0f);
+    return vcvtq_s32_f32(products);
+}
+
+struct NEONDot4 {
+    static s32 Run(const s16* input, const f32* lut) {
+        return vaddvq_s32(FilterProducts(vld1_s16(input), lut));
+    }
+};
+
+struct NEONDot8 {
+    static s32 Run(const s16* input, const f32* lut) {
+        const int16x8_t samples = vld1q_s16(input);
+        return vaddvq_s32(vaddq_s32(FilterProducts(vget_low_s16(samples), lut),
+                                    FilterProducts(vget_high_s16(samples), lut + 4)));
+    }
+};
+#endif
+
+Backend DetectBackend() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps = Common::GetCPUCaps();
+    if (caps.avx2) {
+        return Backend::AVX2;
+    }
+    return caps.sse4_1 ? Backend::SSE41 : Backend::Scalar;
+#elif defined(ARCHITECTURE_arm64)
+    return Backend::NEON;
+#else
+    return Backend::Scalar;
+#endif
+}
+
+std::atomic<Backend> backend{DetectBackend()};
+
+/// The vector paths multiply 32 bit lanes, check every volume of the ramp fits one
+bool FitsVectorLanes(s64 volume, s64 ramp, u32 sample_count) {
+    constexpr s64 Min = std::numeric_limits<s32>::min();
+    constexpr s64 Max = std::numeric_limits<s32>::max();
+    if (ramp < Min || ramp > Max) {
+        return false;
+    }
+    const s64 last_volume = volume + ramp * static_cast<s64>(sample_count);
+    return volume >= Min && volume <= Max && last_volume >= Min && last_volume <= Max;
+}
+
+using VolumeRampFunction = void (*)(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                                    u32 sample_count);
+
+template <bool MIX>
+VolumeRampFunction GetVolumeRampFunction() {
+    switch (backend.load(std::memory_order_relaxed)) {
+#if defined(ARCHITECTURE_x86_64)
+    case Backend::SSE41:
+        return MIX ? &MixRampSSE41 : &ApplyGainRampSSE41;
+    case Backend::AVX2:
+        return MIX ? &MixRampAVX2 : &ApplyGainRampAVX2;
+#elif defined(ARCHITECTURE_arm64)
+    case Backend::NEON:
+        return &ApplyVolumeRampNEON<MIX>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+using ResampleFunction = void (*)(s32* output, const s16* input, const f32* lut, s64 ratio,
+                                  s64& fraction, u32 samples_to_write);
+
+template <u32 Taps>
+ResampleFunction GetResampleFunction() {
+    switch (backend.load(std::memory_order_relaxed)) {
+#if defined(ARCHITECTURE_x86_64)
+    case Backend::SSE41:
+        return Taps == 4 ? &Resample4SSE41 : &Resample8SSE41;
+    case Backend::AVX2:
+        // A single output of the 4 tap filter fits an SSE register already.
+        return Taps == 4 ? &Resample4SSE41 : &Resample8AVX2;
+#elif defined(ARCHITECTURE_arm64)
+    case Backend::NEON:
+        return Taps == 4 ? &ResampleLoop<4, NEONDot4> : &ResampleLoop<8, NEONDot8>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+} // Anonymous namespace
+
+bool IsBackendSupported(Backend backend_) {
+    switch (backend_) {
+    case Backend::Scalar:
+        return true;
+#if defined(ARCHITECTURE_x86_64)
+    case Backend::SSE41:
+        return Common::GetCPUCaps().sse4_1;
+    case Backend::AVX2:
+        return Common::GetCPUCaps().avx2;
+#elif defined(ARCHITECTURE_arm64)
+    case Backend::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+Backend GetBackend() {
+    return backend.load(std::memory_order_relaxed);
+}
+
+void SetBackend(Backend backend_) {
+    ASSERT(IsBackendSupported(backend_));
+    backend.store(backend_, std::memory_order_relaxed);
+}
+
+template <size_t Q>
+s32 MixRamp(std::span<s32> output, std::span<const s32> input,
+            Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+            u32 sample_count) {
+    const auto function = GetVolumeRampFunction<true>();
+    if (function == nullptr || sample_count == 0 ||
+        !FitsVectorLanes(volume.to_raw(), ramp.to_raw(), sample_count)) {
+        return MixRampScalar<Q>(output, input, volume, ramp, sample_count);
+    }
+    function(output.data(), input.data(), volume.to_raw(), ramp.to_raw(), Q, sample_count);
+
+    const auto last_volume{Common::FixedPoint<64 - Q, Q>::from_base(
+        volume.to_raw() + ramp.to_raw() * static_cast<s64>(sample_count - 1))};
+    return (input[sample_count - 1] * last_volume).to_int();
+}
+
+template <size_t Q>
+void ApplyGainRamp(std::span<s32> output, std::span<const s32> input,
+                   Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+                   u32 sample_count) {
+    const auto function = GetVolumeRampFunction<false>();
+    if (function == nullptr || !FitsVectorLanes(volume.to_raw(), ramp.to_raw(), sample_count)) {
+        ApplyGainRampScalar<Q>(output, input, volume, ramp, sample_count);
+        return;
+    }
+    function(output.data(), input.data(), volume.to_raw(), ramp.to_raw(), Q, sample_count);
+}
+
+template <u32 Taps>
+void ResampleFilter(std::span<s32> output, std::span<const s16> input, std::span<const f32> lut,
+                    const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                    Common::FixedPoint<49, 15>& fraction, u32 samples_to_write) {
+    const auto function = GetResampleFunction<Taps>();
+    if (function == nullptr) {
+        ResampleFilterScalar<Taps>(output, input, lut, sample_rate_ratio, fraction,
+                                   samples_to_write);
+        return;
+    }
+    s64 raw_fraction = fraction.to_raw();
+    function(output.data(), input.data(), lut.data(), sample_rate_ratio.to_raw(), raw_fraction,
+             samples_to_write);
+    fraction = Common::FixedPoint<49, 15>::from_base(raw_fraction);
+}
+
+template s32 MixRamp<15>(std::span<s32>, std::span<const s32>, Common::FixedPoint<49, 15>,
+                         Common::FixedPoint<49, 15>, u32);
+template s32 MixRamp<23>(std::span<s32>, std::span<const s32>, Common::FixedPoint<41, 23>,
+                         Common::FixedPoint<41, 23>, u32);
+template void ApplyGainRamp<15>(std::span<s32>, std::span<const s32>, Common::FixedPoint<49, 15>,
+                                Common::FixedPoint<49, 15>, u32);
+template void ApplyGainRamp<23>(std::span<s32>, std::span<const s32>, Common::FixedPoint<41, 23>,
+                                Common::FixedPoint<41, 23>, u32);
+template void ResampleFilter<4>(std::span<s32>, std::span<const s16>, std::span<const f32>,
+                                const Common::FixedPoint<49, 15>&, Common::FixedPoint<49, 15>&,
+                                u32);
+template void ResampleFilter<8>(std::span<s32>, std::span<const s16>, std::span<const f32>,
+                                const Common::FixedPoint<49, 15>&, Common::FixedPoint<49, 15>&,
+                                u32);
+
+} // namespace AudioCore::Renderer::Dsp
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace AudioCore::Renderer::Dsp {
+
+/// Host code paths used by the sample kernels, selected at startup from the host CPU features.
+enum class Backend : u32 {
+    Scalar, ///< Fixed point reference implementation
+    SSE41,
+    AVX2,
+    NEON,
+};
+
+/// Returns true when the host can run the given backend.
+[[nodiscard]] bool IsBackendSupported(Backend backend);
+
+/// Returns the backend currently in use.
+[[nodiscard]] Backend GetBackend();
+
+/// Overrides the backend selected at startup. Intended for testing and benchmarking.
+void SetBackend(Backend backend);
+
+/**
+ * Mix input into output with volume applied, adding ramp to the volume after every sample.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Volume applied to the first sample.
+ * @param ramp         - Ramp applied to the volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @return The last sample mixed, with volume applied.
+ */
+template <size_t Q>
+s32 MixRamp(std::span<s32> output, std::span<const s32> input,
+            Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+            u32 sample_count);
+
+/**
+ * Apply volume to input and save it to output, adding ramp to the volume after every sample.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Volume applied to the first sample.
+ * @param ramp         - Ramp applied to the volume every sample.
+ * @param sample_count - Number of samples to process.
+ */
+template <size_t Q>
+void ApplyGainRamp(std::span<s32> output, std::span<const s32> input,
+                   Common::FixedPoint<64 - Q, Q> volume, Common::FixedPoint<64 - Q, Q> ramp,
+                   u32 sample_count);
+
+/**
+ * Resample input into output with a polyphase filter.
+ *
+ * @tparam Taps             - Number of filter taps, 4 or 8.
+ * @param output            - Output buffer.
+ * @param input             - Input buffer.
+ * @param lut               - Filter coefficients, Taps for each of the 128 phases.
+ * @param sample_rate_ratio - Input samples read per output sample.
+ * @param fraction          - Current read fraction, written back for the next call.
+ * @param samples_to_write  - Number of samples to write.
+ */
+template <u32 Taps>
+void ResampleFilter(std::span<s32> output, std::span<const s16> input, std::span<const f32> lut,
+                    const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                    Common::FixedPoint<49, 15>& fraction, u32 samples_to_write);
+
+} // namespace AudioCore::Renderer::Dsp
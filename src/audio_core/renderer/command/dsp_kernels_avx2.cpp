@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file is compiled with AVX2 enabled, only call it after checking the host CPU supports it.
+
+#include <immintrin.h>
+
+#include "audio_core/renderer/command/dsp_kernels_simd.h"
+
+namespace AudioCore::Renderer::Dsp {
+namespace {
+/// Rounds the 64 bit products in each lane like RoundToInt, the result is in the low 32 bits
+__m256i RoundProducts(__m256i products, __m256i fractional_mask, __m128i shift) {
+    const __m256i half = _mm256_srli_epi64(_mm256_and_si256(products, fractional_mask), 1);
+    return _mm256_srl_epi64(_mm256_add_epi64(products, half), shift);
+}
+
+template <bool MIX>
+void ApplyVolumeRamp(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                     u32 sample_count) {
+    const __m256i fractional_mask = _mm256_set1_epi64x((s64{1} << q) - 1);
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(q));
+    const __m256i step = _mm256_set1_epi64x(ramp * 8);
+    // Volumes of the even and odd samples, the multiply reads the low 32 bits of each lane.
+    __m256i volume_even =
+        _mm256_set_epi64x(volume + ramp * 6, volume + ramp * 4, volume + ramp * 2, volume);
+    __m256i volume_odd = _mm256_set_epi64x(volume + ramp * 7, volume + ramp * 5,
+                                           volume + ramp * 3, volume + ramp);
+
+    u32 i = 0;
+    for (; i + 8 <= sample_count; i += 8) {
+        const __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256i even = RoundProducts(_mm256_mul_epi32(samples, volume_even),
+                                           fractional_mask, shift);
+        const __m256i odd = RoundProducts(
+            _mm256_mul_epi32(_mm256_srli_epi64(samples, 32), volume_odd), fractional_mask, shift);
+        __m256i result = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        if constexpr (MIX) {
+            result = _mm256_add_epi32(
+                result, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i)));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+        volume_even = _mm256_add_epi64(volume_even, step);
+        volume_odd = _mm256_add_epi64(volume_odd, step);
+    }
+    ApplyVolumeRampScalar<MIX>(output, input, volume, ramp, q, i, sample_count);
+}
+
+struct Dot8 {
+    static s32 Run(const s16* input, const f32* lut) {
+        const __m256i samples =
+            _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+        const __m256 products =
+            _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(samples), _mm256_loadu_ps(lut)),
+                          _mm256_set1_ps(256.0f));
+        const __m256i truncated = _mm256_cvttps_epi32(products);
+        __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(truncated),
+                                    _mm256_extracti128_si256(truncated, 1));
+        sum = _mm_hadd_epi32(sum, sum);
+        sum = _mm_hadd_epi32(sum, sum);
+        return _mm_cvtsi128_si32(sum);
+    }
+};
+} // Anonymous namespace
+
+void MixRampAVX2(s32* output, const s32* input, s64 volume, s64 ramp, u32 q, u32 sample_count) {
+    ApplyVolumeRamp<true>(output, input, volume, ramp, q, sample_count);
+}
+
+void ApplyGainRampAVX2(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                       u32 sample_count) {
+    ApplyVolumeRamp<false>(output, input, volume, ramp, q, sample_count);
+}
+
+void Resample8AVX2(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                   u32 samples_to_write) {
+    ResampleLoop<8, Dot8>(output, input, lut, ratio, fraction, samples_to_write);
+}
+
+} // namespace AudioCore::Renderer::Dsp
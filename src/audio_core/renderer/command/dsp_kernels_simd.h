@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer::Dsp {
+
+// The helpers below are static, so each translation unit keeps a copy built with its own target
+// flags instead of the linker picking one of them.
+
+/**
+ * Rounds a product with q fractional bits to an integer like Common::FixedPoint::to_int, keeping
+ * the low 32 bits.
+ */
+static inline s32 RoundToInt(s64 value, u32 q) {
+    value += (value & ((s64{1} << q) - 1)) >> 1;
+    return static_cast<s32>(value >> q);
+}
+
+/**
+ * Applies a ramped volume to a range of samples, with raw fixed point volumes of q fractional
+ * bits. The vector paths multiply 32 bit lanes, callers ensure every volume fits one.
+ * When MIX is set the result is added to output, otherwise it replaces it.
+ */
+template <bool MIX>
+static void ApplyVolumeRampScalar(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                                  u32 begin, u32 end) {
+    volume += ramp * static_cast<s64>(begin);
+    for (u32 i = begin; i < end; i++) {
+        const s32 sample = RoundToInt(static_cast<s64>(input[i]) * volume, q);
+        // Wrap around like the 64 bit fixed point math truncated to 32 bits.
+        output[i] = MIX ? static_cast<s32>(static_cast<u32>(output[i]) + static_cast<u32>(sample))
+                        : sample;
+        volume += ramp;
+    }
+}
+
+/**
+ * Walks the output samples of a resample, handing each filter window to Dot::Run which returns
+ * the sum of the truncated 24.8 fixed point products.
+ */
+template <u32 Taps, typename Dot>
+static void ResampleLoop(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                  u32 samples_to_write) {
+    constexpr s64 FractionMask = (s64{1} << 15) - 1;
+    u32 read_index = 0;
+    for (u32 i = 0; i < samples_to_write; i++) {
+        const s64 lut_index = ((fraction & FractionMask) >> 8) * Taps;
+        output[i] = Dot::Run(input + read_index, lut + lut_index) >> 8;
+        fraction += ratio;
+        read_index += static_cast<u32>(fraction >> 15);
+        fraction &= FractionMask;
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+void MixRampSSE41(s32* output, const s32* input, s64 volume, s64 ramp, u32 q, u32 sample_count);
+void ApplyGainRampSSE41(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                        u32 sample_count);
+void Resample4SSE41(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                    u32 samples_to_write);
+void Resample8SSE41(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                    u32 samples_to_write);
+
+void MixRampAVX2(s32* output, const s32* input, s64 volume, s64 ramp, u32 q, u32 sample_count);
+void ApplyGainRampAVX2(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                       u32 sample_count);
+void Resample8AVX2(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                   u32 samples_to_write);
+#endif
+
+} // namespace AudioCore::Renderer::Dsp
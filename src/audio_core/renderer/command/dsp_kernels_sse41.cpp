@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file is compiled with SSE4.1 enabled, only call it after checking the host CPU supports it.
+
+#include <smmintrin.h>
+
+#include "audio_core/renderer/command/dsp_kernels_simd.h"
+
+namespace AudioCore::Renderer::Dsp {
+namespace {
+/// Rounds the 64 bit products in each lane like RoundToInt, the result is in the low 32 bits
+__m128i RoundProducts(__m128i products, __m128i fractional_mask, __m128i shift) {
+    const __m128i half = _mm_srli_epi64(_mm_and_si128(products, fractional_mask), 1);
+    return _mm_srl_epi64(_mm_add_epi64(products, half), shift);
+}
+
+template <bool MIX>
+void ApplyVolumeRamp(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                     u32 sample_count) {
+    const __m128i fractional_mask = _mm_set1_epi64x((s64{1} << q) - 1);
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(q));
+    const __m128i step = _mm_set1_epi64x(ramp * 4);
+    // Volumes of the even and odd samples, the multiply reads the low 32 bits of each lane.
+    __m128i volume_even = _mm_set_epi64x(volume + ramp * 2, volume);
+    __m128i volume_odd = _mm_set_epi64x(volume + ramp * 3, volume + ramp);
+
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i even = RoundProducts(_mm_mul_epi32(samples, volume_even),
+                                           fractional_mask, shift);
+        const __m128i odd = RoundProducts(
+            _mm_mul_epi32(_mm_srli_epi64(samples, 32), volume_odd), fractional_mask, shift);
+        __m128i result = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+        if constexpr (MIX) {
+            result = _mm_add_epi32(
+                result, _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        volume_even = _mm_add_epi64(volume_even, step);
+        volume_odd = _mm_add_epi64(volume_odd, step);
+    }
+    ApplyVolumeRampScalar<MIX>(output, input, volume, ramp, q, i, sample_count);
+}
+
+/// Sums the four lanes of a vector
+s32 HorizontalSum(__m128i values) {
+    values = _mm_hadd_epi32(values, values);
+    values = _mm_hadd_epi32(values, values);
+    return _mm_cvtsi128_si32(values);
+}
+
+/// Multiplies four samples by their coefficients, truncating each product to 24.8 fixed point
+__m128i FilterProducts(__m128i samples, const f32* lut) {
+    const __m128 products =
+        _mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(samples), _mm_loadu_ps(lut)), _mm_set1_ps(256.0f));
+    return _mm_cvttps_epi32(products);
+}
+
+struct Dot4 {
+    static s32 Run(const s16* input, const f32* lut) {
+        const __m128i samples =
+            _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+        return HorizontalSum(FilterProducts(samples, lut));
+    }
+};
+
+struct Dot8 {
+    static s32 Run(const s16* input, const f32* lut) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        const __m128i low = FilterProducts(_mm_cvtepi16_epi32(samples), lut);
+        const __m128i high =
+            FilterProducts(_mm_cvtepi16_epi32(_mm_srli_si128(samples, 8)), lut + 4);
+        return HorizontalSum(_mm_add_epi32(low, high));
+    }
+};
+} // Anonymous namespace
+
+void MixRampSSE41(s32* output, const s32* input, s64 volume, s64 ramp, u32 q, u32 sample_count) {
+    ApplyVolumeRamp<true>(output, input, volume, ramp, q, sample_count);
+}
+
+void ApplyGainRampSSE41(s32* output, const s32* input, s64 volume, s64 ramp, u32 q,
+                        u32 sample_count) {
+    ApplyVolumeRamp<false>(output, input, volume, ramp, q, sample_count);
+}
+
+void Resample4SSE41(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                    u32 samples_to_write) {
+    ResampleLoop<4, Dot4>(output, input, lut, ratio, fraction, samples_to_write);
+}
+
+void Resample8SSE41(s32* output, const s16* input, const f32* lut, s64 ratio, s64& fraction,
+                    u32 samples_to_write) {
+    ResampleLoop<8, Dot8>(output, input, lut, ratio, fraction, samples_to_write);
+}
+
+} // namespace AudioCore::Renderer::Dsp
@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <limits>
+
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/resample/downmix_6ch_to_2ch.h"
 
@@ -46,19 +49,44 @@ void DownMix6chTo2chCommand::Process(const AudioRenderer::CommandListProcessor&
     auto out_back_right{
         processor.mix_buffers.subspan(outputs[5] * processor.sample_count, processor.sample_count)};
 
-    for (u32 i = 0; i < processor.sample_count; i++) {
-        const auto left_sample{(in_front_left[i] * down_mix_coeff[0] +
-                                in_center[i] * down_mix_coeff[1] + in_lfe[i] * down_mix_coeff[2] +
-                                in_back_left[i] * down_mix_coeff[3])
-                                   .to_int()};
+    // Multiplying a sample by a coefficient is exact as a 64-bit integer product when the
+    // coefficient fits in 32 bits, which all sane mixes do, and that loop vectorizes.
+    const bool small_coeffs{std::ranges::all_of(down_mix_coeff, [](const auto coeff) {
+        return coeff.to_raw() >= std::numeric_limits<s32>::min() &&
+               coeff.to_raw() <= std::numeric_limits<s32>::max();
+    })};
+    if (small_coeffs) {
+        const auto front{static_cast<s32>(down_mix_coeff[0].to_raw())};
+        const auto center{static_cast<s32>(down_mix_coeff[1].to_raw())};
+        const auto lfe{static_cast<s32>(down_mix_coeff[2].to_raw())};
+        const auto back{static_cast<s32>(down_mix_coeff[3].to_raw())};
+        const auto to_int = [](const s64 value) {
+            return Common::FixedPoint<48, 16>::from_base(value).to_int();
+        };
+
+        for (u32 i = 0; i < processor.sample_count; i++) {
+            const s64 shared{s64{in_center[i]} * center + s64{in_lfe[i]} * lfe};
+            const s64 left{s64{in_front_left[i]} * front + shared + s64{in_back_left[i]} * back};
+            const s64 right{s64{in_front_right[i]} * front + shared +
+                            s64{in_back_right[i]} * back};
+            out_front_left[i] = to_int(left);
+            out_front_right[i] = to_int(right);
+        }
+    } else {
+        for (u32 i = 0; i < processor.sample_count; i++) {
+            const auto left_sample{
+                (in_front_left[i] * down_mix_coeff[0] + in_center[i] * down_mix_coeff[1] +
+                 in_lfe[i] * down_mix_coeff[2] + in_back_left[i] * down_mix_coeff[3])
+                    .to_int()};
 
-        const auto right_sample{(in_front_right[i] * down_mix_coeff[0] +
-                                 in_center[i] * down_mix_coeff[1] + in_lfe[i] * down_mix_coeff[2] +
-                                 in_back_right[i] * down_mix_coeff[3])
-                                    .to_int()};
+            const auto right_sample{
+                (in_front_right[i] * down_mix_coeff[0] + in_center[i] * down_mix_coeff[1] +
+                 in_lfe[i] * down_mix_coeff[2] + in_back_right[i] * down_mix_coeff[3])
+                    .to_int()};
 
-        out_front_left[i] = left_sample;
-        out_front_right[i] = right_sample;
+            out_front_left[i] = left_sample;
+            out_front_right[i] = right_sample;
+        }
     }
 
     std::memset(out_center.data(), 0, out_center.size_bytes());
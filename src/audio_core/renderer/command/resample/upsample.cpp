@@ -2,45 +2,175 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <utility>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/resample/upsample.h"
 #include "audio_core/renderer/upsampler/upsampler_info.h"
 
 namespace AudioCore::Renderer {
+
+constexpr u32 WindowSize = 10;
+constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc1{
+    0.95376587f,   -0.12872314f, 0.060028076f,  -0.032470703f, 0.017669678f,
+    -0.009124756f, 0.004272461f, -0.001739502f, 0.000579834f,  -0.000091552734f,
+};
+constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc2{
+    0.8230896f,    -0.19161987f,  0.093444824f,  -0.05090332f,   0.027557373f,
+    -0.014038086f, 0.0064697266f, -0.002532959f, 0.00079345703f, -0.00012207031f,
+};
+constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc3{
+    0.6298828f,    -0.19274902f, 0.09725952f,    -0.05319214f,  0.028625488f,
+    -0.014373779f, 0.006500244f, -0.0024719238f, 0.0007324219f, -0.000091552734f,
+};
+constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc4{
+    0.4057312f,    -0.1468811f,  0.07601929f,    -0.041656494f,  0.022216797f,
+    -0.011016846f, 0.004852295f, -0.0017700195f, 0.00048828125f, -0.000030517578f,
+};
+constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc5{
+    0.1854248f,    -0.075164795f, 0.03967285f,    -0.021728516f,  0.011474609f,
+    -0.005584717f, 0.0024108887f, -0.0008239746f, 0.00021362305f, 0.0f,
+};
+
+/// Most output samples a frame can produce on the linear path, the renderer uses 160 or 240
+constexpr u32 MaxLinearFrameSamples = 240;
+
+/// One output sample of the repeating upsampling pattern
+struct UpsamplerPhase {
+    /// Whether a new input sample is pushed to the history before producing the output
+    bool consume;
+    /// Whether the output is the center history sample, rather than filtered
+    bool direct;
+    /// Filter taps over the 20 history samples around the center, oldest first
+    std::array<s32, UpsamplerState::HistorySize> taps;
+};
+
 /**
- * Upsampling impl. Input must be 8K, 16K or 32K, output is 48K.
+ * Make a phase filtering the history, with the two windowed sinc halves merged into a single
+ * contiguous set of taps: the first one runs backwards from the center, the second one forwards
+ * from the sample after it.
+ */
+constexpr UpsamplerPhase MakeFilteredPhase(
+    bool consume, const std::array<Common::FixedPoint<17, 15>, WindowSize>& coeffs1,
+    const std::array<Common::FixedPoint<17, 15>, WindowSize>& coeffs2) {
+    UpsamplerPhase phase{.consume = consume, .direct = false, .taps{}};
+    for (u32 i = 0; i < WindowSize; i++) {
+        phase.taps[WindowSize - 1 - i] = coeffs1[i].to_raw();
+        phase.taps[WindowSize + i] = coeffs2[i].to_raw();
+    }
+    return phase;
+}
+
+constexpr UpsamplerPhase DirectPhase{.consume = true, .direct = true, .taps{}};
+
+/// 40 -> 240
+constexpr std::array<UpsamplerPhase, 6> UpsamplerPhases6{
+    DirectPhase,
+    MakeFilteredPhase(false, WindowedSinc1, WindowedSinc5),
+    MakeFilteredPhase(false, WindowedSinc2, WindowedSinc4),
+    MakeFilteredPhase(false, WindowedSinc3, WindowedSinc3),
+    MakeFilteredPhase(false, WindowedSinc4, WindowedSinc2),
+    MakeFilteredPhase(false, WindowedSinc5, WindowedSinc1),
+};
+
+/// 80 -> 240
+constexpr std::array<UpsamplerPhase, 3> UpsamplerPhases3{
+    DirectPhase,
+    MakeFilteredPhase(false, WindowedSinc2, WindowedSinc4),
+    MakeFilteredPhase(false, WindowedSinc4, WindowedSinc2),
+};
+
+/// 160 -> 240
+constexpr std::array<UpsamplerPhase, 3> UpsamplerPhases1_5{
+    DirectPhase,
+    MakeFilteredPhase(false, WindowedSinc4, WindowedSinc2),
+    MakeFilteredPhase(true, WindowedSinc2, WindowedSinc4),
+};
+
+/**
+ * Upsampling impl. over a linear copy of the history, producing the same samples and state as
+ * the ring buffer loops of SrcProcessFrame. Each filtered sample is a contiguous 20 tap dot
+ * product, and whole periods of the phase pattern are unrolled with their taps known at compile
+ * time, so the compiler can vectorize them.
  *
+ * @tparam Phases             - The repeating pattern of output samples for the ratio.
  * @param output              - Output buffer.
  * @param input               - Input buffer.
- * @param target_sample_count - Number of samples for output.
+ * @param target_sample_count - Number of samples for output, at most MaxLinearFrameSamples.
  * @param state               - Upsampler state, updated each call.
  */
-static void SrcProcessFrame(std::span<s32> output, std::span<const s32> input,
-                            const u32 target_sample_count, const u32 source_sample_count,
-                            UpsamplerState* state) {
-    static constexpr u32 WindowSize = 10;
-    static constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc1{
-        0.95376587f,   -0.12872314f, 0.060028076f,  -0.032470703f, 0.017669678f,
-        -0.009124756f, 0.004272461f, -0.001739502f, 0.000579834f,  -0.000091552734f,
-    };
-    static constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc2{
-        0.8230896f,    -0.19161987f,  0.093444824f,  -0.05090332f,   0.027557373f,
-        -0.014038086f, 0.0064697266f, -0.002532959f, 0.00079345703f, -0.00012207031f,
-    };
-    static constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc3{
-        0.6298828f,    -0.19274902f, 0.09725952f,    -0.05319214f,  0.028625488f,
-        -0.014373779f, 0.006500244f, -0.0024719238f, 0.0007324219f, -0.000091552734f,
-    };
-    static constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc4{
-        0.4057312f,    -0.1468811f,  0.07601929f,    -0.041656494f,  0.022216797f,
-        -0.011016846f, 0.004852295f, -0.0017700195f, 0.00048828125f, -0.000030517578f,
-    };
-    static constexpr std::array<Common::FixedPoint<17, 15>, WindowSize> WindowedSinc5{
-        0.1854248f,    -0.075164795f, 0.03967285f,    -0.021728516f,  0.011474609f,
-        -0.005584717f, 0.0024108887f, -0.0008239746f, 0.00021362305f, 0.0f,
+template <const auto& Phases>
+static void SrcProcessFrameLinear(std::span<s32> output, std::span<const s32> input,
+                                  const u32 target_sample_count, UpsamplerState* state) {
+    static constexpr u32 HistorySize = UpsamplerState::HistorySize;
+    static constexpr u32 NumPhases = static_cast<u32>(Phases.size());
+
+    // Unroll the history ring, oldest sample first, followed by the input pushed this frame.
+    std::array<s32, HistorySize + MaxLinearFrameSamples> samples;
+    for (u32 i = 0; i < HistorySize; i++) {
+        samples[i] = state->history[(state->history_input_index + i) % HistorySize].to_raw();
+    }
+
+    u32 newest{HistorySize - 1};
+    u32 read_index{0};
+    u32 write_index{0};
+    u32 phase_index{state->sample_index};
+
+    const auto step = [&](const UpsamplerPhase& phase) {
+        if (phase.consume) {
+            samples[++newest] = Common::FixedPoint<24, 8>(input[read_index++]).to_raw();
+        }
+
+        // The ring buffer loops read back 10 samples from here, and forward 10 after it.
+        const u32 center{newest - WindowSize};
+        if (phase.direct) {
+            output[write_index++] =
+                Common::FixedPoint<24, 8>::from_base(samples[center]).to_int_floor();
+            return;
+        }
+
+        const s32* window{&samples[center - (WindowSize - 1)]};
+        s64 result{0};
+        for (u32 i = 0; i < HistorySize; i++) {
+            result += static_cast<s64>(window[i]) * phase.taps[i];
+        }
+        output[write_index++] = static_cast<s32>(result >> (8 + 15));
     };
 
+    // Step up to the start of the pattern, then run whole periods of it, then the rest.
+    for (; phase_index != 0 && write_index < target_sample_count;
+         phase_index = (phase_index + 1) % NumPhases) {
+        step(Phases[phase_index]);
+    }
+    while (target_sample_count - write_index >= NumPhases) {
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            (step(Phases[Index]), ...);
+        }(std::make_index_sequence<NumPhases>{});
+    }
+    for (; write_index < target_sample_count; phase_index = (phase_index + 1) % NumPhases) {
+        step(Phases[phase_index]);
+    }
+
+    // Write the newest samples back to the ring, where the ring buffer loops would leave them.
+    const auto input_index{
+        static_cast<u16>((state->history_input_index + read_index) % HistorySize)};
+    for (u32 i = 0; i < HistorySize; i++) {
+        state->history[(input_index + i) % HistorySize] =
+            Common::FixedPoint<24, 8>::from_base(samples[newest - (HistorySize - 1) + i]);
+    }
+    state->history_input_index = input_index;
+    state->history_output_index =
+        static_cast<u16>((state->history_output_index + read_index) % HistorySize);
+    state->sample_index = static_cast<u8>(phase_index);
+}
+
+/**
+ * Set up the upsampler state for the ratio on its first frame.
+ *
+ * @param source_sample_count - Number of input samples of a whole frame.
+ * @param state               - Upsampler state.
+ */
+static void InitializeUpsampler(const u32 source_sample_count, UpsamplerState* state) {
     if (!state->initialized) {
         switch (source_sample_count) {
         case 40:
@@ -76,11 +206,18 @@ static void SrcProcessFrame(std::span<s32> output, std::span<const s32> input,
         state->history_end_index = UpsamplerState::HistorySize - 1;
         state->initialized = true;
     }
+}
 
-    if (target_sample_count == 0) {
-        return;
-    }
-
+/**
+ * Upsampling impl. over the history ring buffer. Input must be 8K, 16K or 32K, output is 48K.
+ *
+ * @param output              - Output buffer.
+ * @param input               - Input buffer.
+ * @param target_sample_count - Number of samples for output.
+ * @param state               - Upsampler state, updated each call.
+ */
+static void SrcProcessFrameRing(std::span<s32> output, std::span<const s32> input,
+                                const u32 target_sample_count, UpsamplerState* state) {
     u32 read_index{0};
 
     auto increment = [&]() -> void {
@@ -198,6 +335,54 @@ static void SrcProcessFrame(std::span<s32> output, std::span<const s32> input,
     }
 }
 
+void UpsampleFrame(std::span<s32> output, std::span<const s32> input, u32 target_sample_count,
+                   u32 source_sample_count, UpsamplerState* state) {
+    InitializeUpsampler(source_sample_count, state);
+    if (target_sample_count == 0) {
+        return;
+    }
+
+    // The linear path needs the layout InitializeUpsampler sets up.
+    if (state->history_start_index == 0 &&
+        state->history_end_index == UpsamplerState::HistorySize - 1 &&
+        state->history_output_index ==
+            (state->history_input_index + 9) % UpsamplerState::HistorySize &&
+        target_sample_count <= MaxLinearFrameSamples) {
+        switch (state->ratio.to_int_floor()) {
+        case 6:
+            if (state->sample_index < UpsamplerPhases6.size()) {
+                return SrcProcessFrameLinear<UpsamplerPhases6>(output, input, target_sample_count,
+                                                               state);
+            }
+            break;
+        case 3:
+            if (state->sample_index < UpsamplerPhases3.size()) {
+                return SrcProcessFrameLinear<UpsamplerPhases3>(output, input, target_sample_count,
+                                                               state);
+            }
+            break;
+        default:
+            if (state->sample_index < UpsamplerPhases1_5.size()) {
+                return SrcProcessFrameLinear<UpsamplerPhases1_5>(output, input,
+                                                                 target_sample_count, state);
+            }
+            break;
+        }
+    }
+
+    SrcProcessFrameRing(output, input, target_sample_count, state);
+}
+
+void UpsampleFrameReference(std::span<s32> output, std::span<const s32> input,
+                            u32 target_sample_count, u32 source_sample_count,
+                            UpsamplerState* state) {
+    InitializeUpsampler(source_sample_count, state);
+    if (target_sample_count == 0) {
+        return;
+    }
+    SrcProcessFrameRing(output, input, target_sample_count, state);
+}
+
 auto UpsampleCommand::Dump([[maybe_unused]] const AudioRenderer::CommandListProcessor& processor,
                            std::string& string) -> void {
     string += fmt::format("UpsampleCommand\n\tsource_sample_count {} source_sample_rate {}",
@@ -229,7 +414,7 @@ void UpsampleCommand::Process(const AudioRenderer::CommandListProcessor& process
             auto input{processor.mix_buffers.subspan(channel * processor.sample_count,
                                                      processor.sample_count)};
 
-            SrcProcessFrame(output, input, info->sample_count, source_sample_count, state);
+            UpsampleFrame(output, input, info->sample_count, source_sample_count, state);
         }
     }
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 
 #include "audio_core/renderer/command/icommand.h"
@@ -13,6 +14,33 @@ class CommandListProcessor;
 }
 
 namespace AudioCore::Renderer {
+struct UpsamplerState;
+
+/**
+ * Upsample one frame to 48K. Input must be 8K, 16K or 32K.
+ *
+ * @param output              - Output buffer.
+ * @param input               - Input buffer.
+ * @param target_sample_count - Number of samples for output.
+ * @param source_sample_count - Number of input samples of a whole frame, selects the ratio.
+ * @param state               - Upsampler state, updated each call.
+ */
+void UpsampleFrame(std::span<s32> output, std::span<const s32> input, u32 target_sample_count,
+                   u32 source_sample_count, UpsamplerState* state);
+
+/**
+ * Upsample one frame with the reference ring buffer loops, which UpsampleFrame must match
+ * exactly. Intended for testing.
+ *
+ * @param output              - Output buffer.
+ * @param input               - Input buffer.
+ * @param target_sample_count - Number of samples for output.
+ * @param source_sample_count - Number of input samples of a whole frame, selects the ratio.
+ * @param state               - Upsampler state, updated each call.
+ */
+void UpsampleFrameReference(std::span<s32> output, std::span<const s32> input,
+                            u32 target_sample_count, u32 source_sample_count,
+                            UpsamplerState* state);
 
 /**
  * AudioRenderer command for upsampling a mix buffer to 48Khz.
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <ranges>
+#include <utility>
 
 #include "audio_core/renderer/voice/voice_context.h"
 #include "common/polyfill_ranges.h"
@@ -34,6 +35,7 @@ void VoiceContext::Initialize(std::span<VoiceInfo*> sorted_voice_infos_,
     dsp_states = dsp_states_;
     voice_count = voice_count_;
     active_count = 0;
+    sort_keys.clear();
 }
 
 VoiceInfo* VoiceContext::GetSortedInfo(const u32 index) {
@@ -70,6 +72,21 @@ void VoiceContext::SetActiveCount(const u32 active_count_) {
 }
 
 void VoiceContext::SortInfo() {
+    // The order only depends on the priorities and sort orders, which rarely change between
+    // updates, so keep the previous order when none of them did.
+    bool changed{sort_keys.size() != voice_count};
+    sort_keys.resize(voice_count);
+    for (u32 i = 0; i < voice_count; i++) {
+        const std::pair key{voices[i].priority, voices[i].sort_order};
+        if (sort_keys[i] != key) {
+            sort_keys[i] = key;
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
     for (u32 i = 0; i < voice_count; i++) {
         sorted_voice_info[i] = &voices[i];
     }
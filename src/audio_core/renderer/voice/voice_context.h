@@ -4,6 +4,8 @@
 #pragma once
 
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "audio_core/renderer/voice/voice_channel_resource.h"
 #include "audio_core/renderer/voice/voice_info.h"
@@ -98,6 +100,7 @@ public:
     /**
      * Sort all voices. Results are available via GetSortedInfo.
      * Voices are sorted descendingly, according to priority, and then sort order.
+     * The previous order is kept if no priority or sort order changed since it was sorted.
      */
     void SortInfo();
 
@@ -121,6 +124,8 @@ private:
     u32 voice_count{};
     /// Number of active voices
     u32 active_count{};
+    /// Priority and sort order of each voice when they were last sorted
+    std::vector<std::pair<s32, s32>> sort_keys{};
 };
 
 } // namespace AudioCore::Renderer
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <memory>
 #include <span>
 #include <vector>
 
@@ -84,6 +86,9 @@ protected:
                                               num_frames * frame_size};
             this->ProcessAudioIn(input_buffer, num_frames);
         } else {
+            if (m_latency_tuner) {
+                m_latency_tuner->tune();
+            }
             std::span<s16> output_buffer{reinterpret_cast<s16*>(audio_data),
                                          num_frames * frame_size};
             this->ProcessAudioOutAndRender(output_buffer, num_frames);
@@ -101,11 +106,13 @@ protected:
     }
 
 private:
-    static oboe::AudioStreamBuilder* ConfigureBuilder(oboe::AudioStreamBuilder& builder,
-                                                      oboe::Direction direction) {
-        // TODO: investigate callback delay issues when using AAudio
+    static oboe::AudioStreamBuilder* ConfigureBuilder(
+        oboe::AudioStreamBuilder& builder, oboe::Direction direction,
+        oboe::AudioApi api = oboe::AudioApi::OpenSLES,
+        oboe::SharingMode sharing_mode = oboe::SharingMode::Shared) {
         return builder.setPerformanceMode(oboe::PerformanceMode::LowLatency)
-            ->setAudioApi(oboe::AudioApi::OpenSLES)
+            ->setAudioApi(api)
+            ->setSharingMode(sharing_mode)
             ->setDirection(direction)
             ->setSampleRate(TargetSampleRate)
             ->setSampleRateConversionQuality(oboe::SampleRateConversionQuality::High)
@@ -144,14 +151,40 @@ private:
             }
         }();
 
-        oboe::AudioStreamBuilder builder;
-        const auto result = ConfigureBuilder(builder, direction)
-                                ->setChannelCount(expected_channels)
-                                ->setChannelMask(expected_mask)
-                                ->setChannelConversionAllowed(true)
-                                ->setDataCallback(this)
-                                ->setErrorCallback(this)
-                                ->openStream(m_stream);
+        // Output tries an exclusive AAudio stream first, which is MMAP where the device supports
+        // it, then falls back to a shared one, and to OpenSL ES when the device refuses both.
+        // TODO: investigate callback delay issues when using AAudio for input
+        struct StreamConfig {
+            oboe::AudioApi api;
+            oboe::SharingMode sharing_mode;
+        };
+        constexpr std::array OutputConfigs{
+            StreamConfig{oboe::AudioApi::AAudio, oboe::SharingMode::Exclusive},
+            StreamConfig{oboe::AudioApi::AAudio, oboe::SharingMode::Shared},
+            StreamConfig{oboe::AudioApi::OpenSLES, oboe::SharingMode::Shared},
+        };
+        const bool try_aaudio = direction == oboe::Direction::Output &&
+                                oboe::AudioStreamBuilder::isAAudioRecommended();
+        const auto configs =
+            std::span{OutputConfigs}.subspan(try_aaudio ? 0 : OutputConfigs.size() - 1);
+
+        oboe::Result result{oboe::Result::ErrorInternal};
+        for (const auto& config : configs) {
+            oboe::AudioStreamBuilder builder;
+            result = ConfigureBuilder(builder, direction, config.api, config.sharing_mode)
+                         ->setChannelCount(expected_channels)
+                         ->setChannelMask(expected_mask)
+                         ->setChannelConversionAllowed(true)
+                         ->setDataCallback(this)
+                         ->setErrorCallback(this)
+                         ->openStream(m_stream);
+            if (result == oboe::Result::OK) {
+                break;
+            }
+            LOG_WARNING(Audio_Sink, "Failed to open Oboe {} {} stream: {}",
+                        oboe::convertToText(config.api), oboe::convertToText(config.sharing_mode),
+                        oboe::convertToText(result));
+        }
         ASSERT(result == oboe::Result::OK);
         return result == oboe::Result::OK && this->SetStreamProperties();
     }
@@ -159,7 +192,13 @@ private:
     bool SetStreamProperties() {
         ASSERT(m_stream);
 
-        m_stream->setBufferSizeInFrames(TargetSampleCount * 2);
+        if (m_stream->getAudioApi() == oboe::AudioApi::AAudio) {
+            // Start from the smallest buffer of whole bursts, the tuner grows it on underruns.
+            m_latency_tuner = std::make_unique<oboe::LatencyTuner>(*m_stream);
+        } else {
+            m_latency_tuner.reset();
+            m_stream->setBufferSizeInFrames(TargetSampleCount * 2);
+        }
         device_channels = m_stream->getChannelCount();
 
         const auto sample_rate = m_stream->getSampleRate();
@@ -167,16 +206,27 @@ private:
         const auto stream_backend =
             m_stream->getAudioApi() == oboe::AudioApi::AAudio ? "AAudio" : "OpenSLES";
 
-        LOG_INFO(Audio_Sink, "Opened Oboe {} stream with {} channels sample rate {} capacity {}",
-                 stream_backend, device_channels, sample_rate, buffer_capacity);
+        LOG_INFO(Audio_Sink,
+                 "Opened Oboe {} {} stream with {} channels sample rate {} capacity {} burst {} "
+                 "mmap {}",
+                 stream_backend, oboe::convertToText(m_stream->getSharingMode()), device_channels,
+                 sample_rate, buffer_capacity, m_stream->getFramesPerBurst(),
+                 oboe::OboeExtensions::isMMapUsed(m_stream.get()));
 
         return true;
     }
 
+    /// Tunes the buffer size of AAudio streams to the device bursts, null for OpenSL ES
+    std::unique_ptr<oboe::LatencyTuner> m_latency_tuner{};
     std::shared_ptr<oboe::AudioStream> m_stream{};
 };
 
 OboeSink::OboeSink() {
+    // Lets exclusive AAudio streams map the device buffer, skipping the mixer thread.
+    if (oboe::OboeExtensions::isMMapSupported()) {
+        oboe::OboeExtensions::setMMapEnabled(true);
+    }
+
     // TODO: This is not generally knowable
     // The channel count is distinct based on direction and can change
     device_channels = OboeSinkStream::QueryChannelCount(oboe::Direction::Output);
@@ -16,9 +16,13 @@
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/perf_stats.h"
 
 namespace AudioCore::Sink {
 
+/// Fraction of the way the stretch tempo moves towards the wanted tempo on each callback
+constexpr f64 TempoSmoothing = 0.25;
+
 void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     SCOPE_EXIT({
         queue.enqueue(buffer);
@@ -29,6 +33,8 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
         return;
     }
 
+    SCOPE_EXIT({ ReportLatency(); });
+
     constexpr s32 min{std::numeric_limits<s16>::min()};
     constexpr s32 max{std::numeric_limits<s16>::max()};
 
@@ -85,17 +91,16 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
         // We need moar samples! Not all games will provide 6 channel audio.
         // TODO: Implement some upmixing here. Currently just passthrough, with other
         // channels left as silence.
-        std::vector<s16> new_samples(samples.size() / system_channels * device_channels);
-
-        for (u32 read_index = 0, write_index = 0; read_index < samples.size();
-             read_index += system_channels, write_index += device_channels) {
+        // Frames are pushed one at a time, so the steady state does not allocate.
+        for (u32 read_index = 0; read_index < samples.size(); read_index += system_channels) {
+            std::array<s16, 6> new_frame{};
             const auto left_sample{static_cast<s16>(std::clamp(
                 static_cast<s32>(
                     static_cast<f32>(samples[read_index + static_cast<u32>(Channels::FrontLeft)]) *
                     volume),
                 min, max))};
 
-            new_samples[write_index + static_cast<u32>(Channels::FrontLeft)] = left_sample;
+            new_frame[static_cast<u32>(Channels::FrontLeft)] = left_sample;
 
             const auto right_sample{static_cast<s16>(std::clamp(
                 static_cast<s32>(
@@ -103,10 +108,10 @@ void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
                     volume),
                 min, max))};
 
-            new_samples[write_index + static_cast<u32>(Channels::FrontRight)] = right_sample;
-        }
+            new_frame[static_cast<u32>(Channels::FrontRight)] = right_sample;
 
-        samples_buffer.Push(new_samples);
+            samples_buffer.Push(new_frame);
+        }
         return;
     }
 
@@ -145,6 +150,7 @@ std::vector<s16> SinkStream::ReleaseBuffer(u64 num_samples) {
 
 void SinkStream::ClearQueue() {
     samples_buffer.Pop();
+    clear_time_stretcher = true;
     while (queue.pop()) {
     }
     queued_buffers = 0;
@@ -225,17 +231,44 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         return;
     }
 
-    while (frames_written < num_frames) {
+    if (Settings::values.audio_time_stretching.GetValue()) {
+        frames_written = StretchFrames(output_buffer, num_frames, actual_frames_written);
+    } else {
+        frames_written = PopFrames(output_buffer.data(), num_frames);
+        actual_frames_written = frames_written;
+    }
+
+    if (frames_written != 0) {
+        std::memcpy(&last_frame[0], &output_buffer[(frames_written - 1) * frame_size],
+                    frame_size_bytes);
+    }
+
+    // If not enough frames were available we've underrun, fill the remaining buffer with the
+    // last written frame.
+    const bool underran{frames_written < num_frames};
+    for (size_t i = frames_written; i < num_frames; i++) {
+        std::memcpy(&output_buffer[i * frame_size], &last_frame[0], frame_size_bytes);
+    }
+
+    UpdateTargetQueueSize(underran, actual_frames_written);
+
+    {
+        std::scoped_lock lk{sample_count_lock};
+        last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
+        min_played_sample_count = max_played_sample_count;
+        max_played_sample_count += actual_frames_written;
+    }
+}
+
+size_t SinkStream::PopFrames(s16* output, size_t num_frames) {
+    const size_t frame_size = GetDeviceChannels();
+    size_t frames_popped{0};
+
+    while (frames_popped < num_frames) {
         // If the playing buffer has been consumed or has no frames, we need a new one
         if (playing_buffer.consumed || playing_buffer.frames == 0) {
             if (!queue.try_dequeue(playing_buffer)) {
-                // If no buffer was available we've underrun, fill the remaining buffer with
-                // the last written frame and continue.
-                for (size_t i = frames_written; i < num_frames; i++) {
-                    std::memcpy(&output_buffer[i * frame_size], &last_frame[0], frame_size_bytes);
-                }
-                frames_written = num_frames;
-                continue;
+                break;
             }
             // Successfully dequeued a new buffer.
             queued_buffers--;
@@ -248,13 +281,11 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
         // Get the minimum frames available between the currently playing buffer, and the
         // amount we have left to fill
         size_t frames_available{std::min<u64>(playing_buffer.frames - playing_buffer.frames_played,
-                                              num_frames - frames_written)};
+                                              num_frames - frames_popped)};
 
-        samples_buffer.Pop(&output_buffer[frames_written * frame_size],
-                           frames_available * frame_size);
+        samples_buffer.Pop(&output[frames_popped * frame_size], frames_available * frame_size);
 
-        frames_written += frames_available;
-        actual_frames_written += frames_available;
+        frames_popped += frames_available;
         playing_buffer.frames_played += frames_available;
 
         // If that's all the frames in the current buffer, add its samples and mark it as
@@ -263,16 +294,49 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
             playing_buffer.consumed = true;
         }
     }
+    return frames_popped;
+}
 
-    std::memcpy(&last_frame[0], &output_buffer[(frames_written - 1) * frame_size],
-                frame_size_bytes);
+size_t SinkStream::StretchFrames(std::span<s16> output_buffer, size_t num_frames,
+                                 size_t& frames_consumed) {
+    const u32 num_channels = GetDeviceChannels();
+    if (!time_stretcher || time_stretcher->GetChannels() != num_channels) {
+        time_stretcher = std::make_unique<TimeStretcher>(num_channels);
+    }
+    if (clear_time_stretcher.exchange(false)) {
+        time_stretcher->Clear();
+    }
 
-    {
-        std::scoped_lock lk{sample_count_lock};
-        last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
-        min_played_sample_count = max_played_sample_count;
-        max_played_sample_count += actual_frames_written;
+    // Slow down as the queued audio drains below half of the target, so the samples last until
+    // the guest catches up rather than running out.
+    const auto queued_frames{static_cast<f64>(samples_buffer.Size() / num_channels +
+                                              time_stretcher->GetBufferedFrames())};
+    const auto low_frames{
+        static_cast<f64>(target_queue_size.load(std::memory_order_relaxed) * TargetSampleCount) /
+        2.0};
+    const f64 wanted_tempo{low_frames == 0.0 ? TimeStretcher::MaxTempo
+                                             : std::clamp(queued_frames / low_frames,
+                                                          TimeStretcher::MinTempo,
+                                                          TimeStretcher::MaxTempo)};
+    stretch_tempo += (wanted_tempo - stretch_tempo) * TempoSmoothing;
+
+    frames_consumed = 0;
+    size_t frames_written{time_stretcher->Receive(output_buffer.first(num_frames * num_channels))};
+    while (frames_written < num_frames) {
+        const auto input_space{time_stretcher->GetInputSpace()};
+        const size_t frames_wanted{input_space.size() / num_channels};
+        const size_t frames_popped{PopFrames(input_space.data(), frames_wanted)};
+        time_stretcher->CommitInput(frames_popped);
+        frames_consumed += frames_popped;
+
+        time_stretcher->Process(stretch_tempo);
+        frames_written += time_stretcher->Receive(output_buffer.subspan(
+            frames_written * num_channels, (num_frames - frames_written) * num_channels));
+        if (frames_popped < frames_wanted) {
+            break;
+        }
     }
+    return frames_written;
 }
 
 u64 SinkStream::GetExpectedPlayedSampleCount() {
@@ -288,11 +352,46 @@ u64 SinkStream::GetExpectedPlayedSampleCount() {
 
 void SinkStream::WaitFreeSpace(std::stop_token stop_token) {
     std::unique_lock lk{release_mutex};
+    const u32 target{target_queue_size.load(std::memory_order_relaxed)};
     release_cv.wait_for(lk, std::chrono::milliseconds(5),
-                        [this]() { return paused || queued_buffers < max_queue_size; });
-    if (queued_buffers > max_queue_size + 3) {
+                        [this, target]() { return paused || queued_buffers < target; });
+    if (queued_buffers > target + 3) {
         Common::CondvarWait(release_cv, lk, stop_token,
-                            [this] { return paused || queued_buffers < max_queue_size; });
+                            [this, target] { return paused || queued_buffers < target; });
+    }
+}
+
+void SinkStream::UpdateTargetQueueSize(bool underran, u64 frames_played) {
+    // A callback that stays out of buffers continues the previous underrun rather than starting
+    // a new one, so a stream the guest stopped feeding does not grow the target to its limit.
+    if (underran && (!underrunning || frames_played != 0)) {
+        stable_frames = 0;
+        pending_underruns.fetch_add(1, std::memory_order_relaxed);
+        const u32 target{target_queue_size.load(std::memory_order_relaxed)};
+        if (target < max_queue_size + MaxExtraQueuedBuffers) {
+            target_queue_size.store(target + 1, std::memory_order_relaxed);
+        }
+    } else {
+        stable_frames += frames_played;
+        if (stable_frames >= StableFramesToShrink) {
+            stable_frames = 0;
+            const u32 target{target_queue_size.load(std::memory_order_relaxed)};
+            if (target > max_queue_size) {
+                target_queue_size.store(target - 1, std::memory_order_relaxed);
+            }
+        }
+    }
+    underrunning = underran;
+}
+
+void SinkStream::ReportLatency() {
+    const u64 queued_frames{samples_buffer.Size() / device_channels};
+    auto& perf_stats{system.GetPerfStats()};
+    perf_stats.AddAudioLatency(std::chrono::duration_cast<Core::PerfStats::Clock::duration>(
+        std::chrono::nanoseconds{queued_frames * std::nano::den / TargetSampleRate}));
+    if (const u32 underruns{pending_underruns.exchange(0, std::memory_order_relaxed)};
+        underruns != 0) {
+        perf_stats.AddAudioUnderruns(underruns);
     }
 }
 
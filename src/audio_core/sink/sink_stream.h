@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "audio_core/common/common.h"
+#include "audio_core/sink/time_stretch.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "common/reader_writer_queue.h"
@@ -55,6 +56,12 @@ struct SinkBuffer {
  */
 class SinkStream {
 public:
+    /// Most buffers the queue target grows past the ring size after underruns
+    static constexpr u32 MaxExtraQueuedBuffers = 4;
+
+    /// Frames played without an underrun before the queue target shrinks back by one buffer
+    static constexpr u64 StableFramesToShrink = TargetSampleRate * 10;
+
     explicit SinkStream(Core::System& system_, StreamType type_) : system{system_}, type{type_} {}
     virtual ~SinkStream() {}
 
@@ -162,6 +169,17 @@ public:
      */
     void SetRingSize(u32 ring_size) {
         max_queue_size = ring_size;
+        target_queue_size = ring_size;
+    }
+
+    /**
+     * Get the number of buffers WaitFreeSpace lets queue up. Starts at the ring size, grows when
+     * the backend underruns, and shrinks back after a stable stretch of playback.
+     *
+     * @return The current target queue size.
+     */
+    u32 GetTargetQueueSize() const {
+        return target_queue_size.load(std::memory_order_relaxed);
     }
 
     /**
@@ -219,6 +237,42 @@ protected:
      */
     void SignalPause();
 
+private:
+    /**
+     * Adapts the queue target after a backend callback, growing it when playback underruns and
+     * shrinking it once playback was stable for long enough.
+     *
+     * @param underran      - True if the callback ran out of buffers while playing.
+     * @param frames_played - Number of frames the callback played from buffers.
+     */
+    void UpdateTargetQueueSize(bool underran, u64 frames_played);
+
+    /**
+     * Reports the queued latency and new underruns to the performance statistics.
+     */
+    void ReportLatency();
+
+    /**
+     * Pop frames of the queued buffers, releasing each buffer once all of its frames are popped.
+     *
+     * @param output     - Output buffer for the interleaved samples.
+     * @param num_frames - Maximum number of frames to pop.
+     * @return Number of frames popped, fewer than num_frames if the queue ran out.
+     */
+    size_t PopFrames(s16* output, size_t num_frames);
+
+    /**
+     * Fill the output with time-stretched frames of the queued buffers, slowing the tempo down
+     * while the queue is running low.
+     *
+     * @param output_buffer   - Output buffer to be filled with samples.
+     * @param num_frames      - Number of frames to be filled.
+     * @param frames_consumed - Set to the number of frames popped from the queued buffers.
+     * @return Number of frames written, fewer than num_frames if the queue ran out.
+     */
+    size_t StretchFrames(std::span<s16> output_buffer, size_t num_frames,
+                         size_t& frames_consumed);
+
 protected:
     /// Core system
     Core::System& system;
@@ -246,6 +300,20 @@ private:
     std::atomic<u32> queued_buffers{};
     /// The ring size for audio out buffers (usually 4, rarely 2 or 8)
     u32 max_queue_size{};
+    /// Number of buffers to queue before waiting, adapted to the backend's underruns
+    std::atomic<u32> target_queue_size{};
+    /// Frames played since the last underrun or target shrink, backend callback only
+    u64 stable_frames{};
+    /// Set while the backend callback is out of buffers, so a stall counts as one underrun
+    bool underrunning{true};
+    /// Underruns not yet reported to the performance statistics
+    std::atomic<u32> pending_underruns{};
+    /// Stretches the output while audio_time_stretching is enabled, created on first use
+    std::unique_ptr<TimeStretcher> time_stretcher;
+    /// Current tempo of the stretched output, eased towards the wanted tempo
+    f64 stretch_tempo{1.0};
+    /// Set when the queue is cleared, so the callback drops the stretcher's samples
+    std::atomic<bool> clear_time_stretcher{};
     /// Locks access to sample count tracking info
     std::mutex sample_count_lock;
     /// Minimum number of total samples that have been played since the last callback
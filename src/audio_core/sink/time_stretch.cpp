@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "audio_core/sink/time_stretch.h"
+
+namespace AudioCore::Sink {
+
+/// Sequences the output buffer holds, so a sequence can be processed before the last is read
+constexpr size_t OutputSequences = 2;
+
+TimeStretcher::TimeStretcher(u32 channels_)
+    : channels{channels_}, input(WindowFrames * channels),
+      output(OutputFramesPerSequence * OutputSequences * channels),
+      overlap(OverlapFrames * channels) {}
+
+std::span<s16> TimeStretcher::GetInputSpace() {
+    return std::span<s16>{input}.subspan(input_frames * channels);
+}
+
+void TimeStretcher::CommitInput(size_t frames) {
+    input_frames = std::min(input_frames + frames, WindowFrames);
+}
+
+void TimeStretcher::Process(f64 tempo) {
+    tempo = std::clamp(tempo, MinTempo, MaxTempo);
+
+    // Move what is left to be received to the start of the output.
+    if (output_read != 0) {
+        std::memmove(output.data(), &output[output_read * channels],
+                     (output_frames - output_read) * channels * sizeof(s16));
+        output_frames -= output_read;
+        output_read = 0;
+    }
+
+    const size_t output_capacity{output.size() / channels};
+    while (input_frames >= WindowFrames &&
+           output_frames + OutputFramesPerSequence <= output_capacity) {
+        const size_t offset{has_overlap ? FindBestOffset() : SeekFrames};
+        const s16* sequence{&input[offset * channels]};
+        s16* out{&output[output_frames * channels]};
+
+        // Cross-fade from the end of the previous sequence into the start of this one.
+        if (has_overlap) {
+            for (size_t frame = 0; frame < OverlapFrames; frame++) {
+                const auto fade_in{static_cast<s32>(frame)};
+                const auto fade_out{static_cast<s32>(OverlapFrames - frame)};
+                for (u32 channel = 0; channel < channels; channel++) {
+                    const size_t index{frame * channels + channel};
+                    out[index] = static_cast<s16>(
+                        (overlap[index] * fade_out + sequence[index] * fade_in) /
+                        static_cast<s32>(OverlapFrames));
+                }
+            }
+        } else {
+            std::memcpy(out, sequence, OverlapFrames * channels * sizeof(s16));
+        }
+
+        std::memcpy(&out[OverlapFrames * channels], &sequence[OverlapFrames * channels],
+                    (OutputFramesPerSequence - OverlapFrames) * channels * sizeof(s16));
+        std::memcpy(overlap.data(), &sequence[OutputFramesPerSequence * channels],
+                    OverlapFrames * channels * sizeof(s16));
+        has_overlap = true;
+        output_frames += OutputFramesPerSequence;
+
+        // Advance the input by the output length scaled by the tempo.
+        skip_fraction += static_cast<f64>(OutputFramesPerSequence) * tempo;
+        const auto skip{static_cast<size_t>(skip_fraction)};
+        skip_fraction -= static_cast<f64>(skip);
+        std::memmove(input.data(), &input[skip * channels],
+                     (input_frames - skip) * channels * sizeof(s16));
+        input_frames -= skip;
+    }
+}
+
+size_t TimeStretcher::Receive(std::span<s16> out) {
+    const size_t frames{std::min(out.size() / channels, output_frames - output_read)};
+    std::memcpy(out.data(), &output[output_read * channels], frames * channels * sizeof(s16));
+    output_read += frames;
+    if (output_read == output_frames) {
+        output_read = 0;
+        output_frames = 0;
+    }
+    return frames;
+}
+
+void TimeStretcher::Clear() {
+    input_frames = 0;
+    output_frames = 0;
+    output_read = 0;
+    has_overlap = false;
+    skip_fraction = 0.0;
+}
+
+size_t TimeStretcher::FindBestOffset() const {
+    const size_t overlap_samples{OverlapFrames * channels};
+    const auto score_offset = [&](size_t offset) {
+        const s16* candidate{&input[offset * channels]};
+        s64 correlation{};
+        s64 energy{};
+        for (size_t i = 0; i < overlap_samples; i++) {
+            correlation += s64{overlap[i]} * candidate[i];
+            energy += s64{candidate[i]} * candidate[i];
+        }
+        return energy == 0 ? 0.0
+                           : static_cast<f64>(correlation) / std::sqrt(static_cast<f64>(energy));
+    };
+
+    // Prefer the nominal position on ties, it is the exact continuation at a tempo of 1.0.
+    size_t best_offset{SeekFrames};
+    f64 best_score{score_offset(SeekFrames)};
+    for (size_t offset = 0; offset <= SeekFrames * 2; offset++) {
+        const f64 score{score_offset(offset)};
+        if (score > best_score) {
+            best_score = score;
+            best_offset = offset;
+        }
+    }
+    return best_offset;
+}
+
+} // namespace AudioCore::Sink
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Sink {
+
+/**
+ * WSOLA time stretcher for interleaved PCM16, changing the playback tempo without changing the
+ * pitch. Sequences of input are overlapped and cross-faded at the offset, within a small seek
+ * window, where they best match the end of the previous sequence.
+ *
+ * At a tempo of 1.0 the best match is the exact continuation of the input, so the output is the
+ * input delayed by a few milliseconds. Lower tempos repeat parts of the input to play slower.
+ *
+ * Input is written directly into the stretcher (see GetInputSpace), and nothing is allocated
+ * after construction, so it can be used from an audio backend callback.
+ */
+class TimeStretcher {
+public:
+    /// Frames of each overlapped sequence, 10ms at 48KHz
+    static constexpr size_t SequenceFrames = 480;
+    /// Frames cross-faded between two sequences
+    static constexpr size_t OverlapFrames = 96;
+    /// Frames searched for the best match on either side of the nominal position
+    static constexpr size_t SeekFrames = 48;
+    /// Frames of input needed to produce a sequence
+    static constexpr size_t WindowFrames = SequenceFrames + SeekFrames * 2;
+    /// Frames output for each sequence
+    static constexpr size_t OutputFramesPerSequence = SequenceFrames - OverlapFrames;
+
+    /// Slowest tempo supported
+    static constexpr f64 MinTempo = 0.5;
+    /// Fastest tempo supported
+    static constexpr f64 MaxTempo = 1.0;
+
+    explicit TimeStretcher(u32 channels);
+
+    /**
+     * Get the number of channels of the input and output frames.
+     *
+     * @return Number of channels.
+     */
+    u32 GetChannels() const {
+        return channels;
+    }
+
+    /**
+     * Get space to write input frames to, as many as needed to produce the next sequence.
+     * Only the frames passed to CommitInput afterwards are used.
+     *
+     * @return Space for the input samples, may be empty if no more input is needed.
+     */
+    std::span<s16> GetInputSpace();
+
+    /**
+     * Adds frames written to the space returned by GetInputSpace to the input.
+     *
+     * @param frames - Number of frames written.
+     */
+    void CommitInput(size_t frames);
+
+    /**
+     * Stretch as much of the input as possible at the given tempo.
+     *
+     * @param tempo - Ratio of input frames consumed per output frame, clamped to
+     *                [MinTempo, MaxTempo].
+     */
+    void Process(f64 tempo);
+
+    /**
+     * Read stretched frames.
+     *
+     * @param output - Output buffer for the interleaved samples.
+     * @return Number of frames read, at most output.size() / channels.
+     */
+    size_t Receive(std::span<s16> output);
+
+    /**
+     * Get the number of stretched frames waiting to be received.
+     *
+     * @return Number of output frames.
+     */
+    size_t GetOutputFrames() const {
+        return output_frames - output_read;
+    }
+
+    /**
+     * Get the number of input and output frames held, not yet received.
+     *
+     * @return Number of frames held.
+     */
+    size_t GetBufferedFrames() const {
+        return input_frames + GetOutputFrames();
+    }
+
+    /**
+     * Drop all input and output, starting over without an overlap.
+     */
+    void Clear();
+
+private:
+    /**
+     * Find the offset within the seek window where the input best matches the overlap.
+     *
+     * @return Offset of the best match, in frames from the start of the input.
+     */
+    size_t FindBestOffset() const;
+
+    /// Number of interleaved channels
+    u32 channels;
+    /// Input samples, with input_frames frames held
+    std::vector<s16> input;
+    size_t input_frames{};
+    /// Stretched samples, received from output_read up to output_frames
+    std::vector<s16> output;
+    size_t output_frames{};
+    size_t output_read{};
+    /// End of the previous sequence, cross-faded into the next one
+    std::vector<s16> overlap;
+    bool has_overlap{};
+    /// Fractional input frames left to skip from the previous sequences
+    f64 skip_fraction{};
+};
+
+} // namespace AudioCore::Sink
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/boot_timeline.h"
+#include "common/logging/log.h"
+#include "common/metrics.h"
+#include "common/trace_recorder.h"
+
+namespace Common::BootTimeline {
+
+namespace {
+/// Most stages kept between reports, the frontend may scan its caches many times before booting
+constexpr size_t MaxStages = 128;
+
+struct Stage {
+    std::string name;
+    s64 begin;
+    s64 end;
+};
+
+std::mutex mutex;
+std::vector<Stage> stages;
+s64 boot_begin{};
+bool is_booting{};
+
+f64 ToMilliseconds(s64 nanoseconds) {
+    return static_cast<f64>(nanoseconds) / 1'000'000.0;
+}
+} // Anonymous namespace
+
+void Begin() {
+    std::scoped_lock lk{mutex};
+    boot_begin = Trace::GetTimestamp();
+    is_booting = true;
+}
+
+void Record(std::string_view name, s64 begin, s64 end) {
+    std::scoped_lock lk{mutex};
+    if (stages.size() >= MaxStages) {
+        // Keep the latest stages, they are the ones belonging to the next boot
+        stages.erase(stages.begin());
+    }
+    stages.push_back(Stage{
+        .name = std::string{name},
+        .begin = begin,
+        .end = end,
+    });
+}
+
+std::string Report() {
+    std::vector<Stage> reported;
+    s64 origin;
+    {
+        std::scoped_lock lk{mutex};
+        if (!is_booting) {
+            return {};
+        }
+        is_booting = false;
+        reported = std::move(stages);
+        stages.clear();
+        origin = boot_begin;
+    }
+    const s64 first_frame = Trace::GetTimestamp();
+    std::ranges::sort(reported, {}, &Stage::begin);
+
+    std::map<std::string, s64, std::less<>> totals;
+    std::string timeline;
+    for (const Stage& stage : reported) {
+        timeline += fmt::format("\n  {:>10.1f} ms {:>10.1f} ms  {}",
+                                ToMilliseconds(stage.begin - origin),
+                                ToMilliseconds(stage.end - stage.begin), stage.name);
+        totals[stage.name] += stage.end - stage.begin;
+    }
+    LOG_INFO(Common, "First frame presented {:.1f} ms after booting, stages (start, duration):{}",
+             ToMilliseconds(first_frame - origin), timeline);
+
+    auto& registry = Metrics::GetRegistry();
+    for (const auto& [name, total] : totals) {
+        registry
+            .RegisterGauge(fmt::format("yuzu_boot_{}_milliseconds", name),
+                           "Time spent in a stage of the last boot")
+            .Set(total / 1'000'000);
+    }
+    registry
+        .RegisterGauge("yuzu_boot_first_frame_milliseconds",
+                       "Time from booting the last title to presenting its first frame")
+        .Set((first_frame - origin) / 1'000'000);
+    return timeline;
+}
+
+ScopedStage::ScopedStage(std::string_view name_) : name{name_}, begin{Trace::GetTimestamp()} {}
+
+ScopedStage::~ScopedStage() {
+    Record(name, begin, Trace::GetTimestamp());
+}
+
+} // namespace Common::BootTimeline
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "common/common_types.h"
+
+/**
+ * Timeline of the stages run to boot a title, from loading its keys to presenting its first
+ * frame, logged once that frame is presented to find what delays booting.
+ *
+ * Stages can be recorded from any thread. Those recorded before the boot begins, like the key
+ * loading done when the frontend starts, are reported with it. The time spent in each stage is
+ * also exported as a gauge of the metrics registry named after the stage.
+ */
+namespace Common::BootTimeline {
+
+/// Starts timing a boot, the stages recorded from now on are relative to this point
+void Begin();
+
+/// Records a stage that ran between two timestamps of Common::Trace::GetTimestamp
+void Record(std::string_view name, s64 begin, s64 end);
+
+/// Logs the stages recorded since the last report, called when the first frame is presented.
+/// Returns the logged timeline, one line per stage, or an empty string when no boot was begun.
+std::string Report();
+
+/// Records a stage running for the lifetime of the object
+class ScopedStage {
+public:
+    explicit ScopedStage(std::string_view name_);
+    ~ScopedStage();
+
+    ScopedStage(const ScopedStage&) = delete;
+    ScopedStage& operator=(const ScopedStage&) = delete;
+
+private:
+    std::string_view name;
+    s64 begin;
+};
+
+} // namespace Common::BootTimeline
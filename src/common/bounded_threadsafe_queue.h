@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -10,6 +11,7 @@
 #include <new>
 
 #include "common/polyfill_thread.h"
+#include "common/spin_lock.h"
 
 namespace Common {
 
@@ -160,6 +162,110 @@ private:
     std::mutex consumer_cv_mutex;
 };
 
+/**
+ * Single producer single consumer queue for low latency hand offs.
+ * Waiting threads spin for a while before parking, and the mutexes are only touched when the
+ * other side of the queue is parked, so pushing and popping is lock free while both are busy.
+ */
+template <typename T, size_t Capacity = detail::DefaultCapacity>
+class SpinningSPSCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        const size_t write_index = m_write_index.load(std::memory_order::relaxed);
+        if ((write_index - m_read_index.load(std::memory_order::acquire)) == Capacity) {
+            return false;
+        }
+        m_data[write_index % Capacity] = T(std::forward<Args>(args)...);
+        m_write_index.store(write_index + 1, std::memory_order::release);
+
+        Wake(m_consumer_parked, consumer_cv_mutex, consumer_cv);
+        return true;
+    }
+
+    template <typename... Args>
+    void EmplaceWait(Args&&... args) {
+        Wait(m_producer_parked, producer_cv_mutex, producer_cv, {}, [this] {
+            return (m_write_index.load(std::memory_order::relaxed) -
+                    m_read_index.load(std::memory_order::acquire)) < Capacity;
+        });
+        // Only the producer pushes, there is a free slot now.
+        TryEmplace(std::forward<Args>(args)...);
+    }
+
+    bool TryPop(T& t) {
+        const size_t read_index = m_read_index.load(std::memory_order::relaxed);
+        if (read_index == m_write_index.load(std::memory_order::acquire)) {
+            return false;
+        }
+        t = std::move(m_data[read_index % Capacity]);
+        m_read_index.store(read_index + 1, std::memory_order::release);
+
+        Wake(m_producer_parked, producer_cv_mutex, producer_cv);
+        return true;
+    }
+
+    /// Pops an element, returns false when stop is requested while the queue is empty.
+    bool PopWait(T& t, std::stop_token stop_token) {
+        const bool ready =
+            Wait(m_consumer_parked, consumer_cv_mutex, consumer_cv, stop_token, [this] {
+                return m_read_index.load(std::memory_order::relaxed) !=
+                       m_write_index.load(std::memory_order::acquire);
+            });
+        return ready && TryPop(t);
+    }
+
+    /// Returns the number of elements in the queue, only exact from the producer or consumer.
+    [[nodiscard]] size_t Size() const noexcept {
+        return m_write_index.load(std::memory_order::acquire) -
+               m_read_index.load(std::memory_order::acquire);
+    }
+
+private:
+    static constexpr size_t SpinIterations = 0x400;
+
+    template <typename Pred>
+    static bool Wait(std::atomic_bool& parked, std::mutex& mutex, std::condition_variable_any& cv,
+                     std::stop_token stop_token, Pred&& pred) {
+        for (size_t spin = 0; spin < SpinIterations; ++spin) {
+            if (pred()) {
+                return true;
+            }
+            ThreadPause();
+        }
+        std::unique_lock lock{mutex};
+        parked.store(true, std::memory_order::relaxed);
+
+        // Pairs with the fence in Wake, either we see the new index or the other side sees us.
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        Common::CondvarWait(cv, lock, stop_token, pred);
+        parked.store(false, std::memory_order::relaxed);
+        return pred();
+    }
+
+    static void Wake(std::atomic_bool& parked, std::mutex& mutex, std::condition_variable_any& cv) {
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (parked.load(std::memory_order::relaxed)) {
+            std::scoped_lock lock{mutex};
+            cv.notify_one();
+        }
+    }
+
+    alignas(128) std::atomic_size_t m_read_index{0};
+    alignas(128) std::atomic_size_t m_write_index{0};
+    alignas(128) std::atomic_bool m_consumer_parked{false};
+    alignas(128) std::atomic_bool m_producer_parked{false};
+
+    std::array<T, Capacity> m_data;
+
+    std::condition_variable_any producer_cv;
+    std::mutex producer_cv_mutex;
+    std::condition_variable_any consumer_cv;
+    std::mutex consumer_cv_mutex;
+};
+
 template <typename T, size_t Capacity = detail::DefaultCapacity>
 class MPSCQueue {
 public:
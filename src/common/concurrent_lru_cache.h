@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Size bounded key-value cache that can be used from several threads at once.
+ *
+ * Keys are spread over shards by their hash, each with its own lock and least recently used list,
+ * so threads looking up different keys rarely contend. Every entry has a cost, one by default,
+ * and a shard evicts its least recently used entries when its share of the capacity is exceeded.
+ * Values are returned by copy, so they stay valid after they are evicted. An eviction predicate can
+ * pin entries, those are skipped and may keep a shard over its capacity until they can be evicted.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ConcurrentLruCache {
+public:
+    static constexpr size_t DefaultNumShards = 16;
+
+    /// Returns true when a value may be evicted, it is called with its shard locked
+    using EvictPredicate = std::function<bool(const Value&)>;
+
+    /// @param capacity   Total cost of the entries kept, split evenly over the shards
+    /// @param num_shards Number of independently locked shards
+    explicit ConcurrentLruCache(size_t capacity, size_t num_shards = DefaultNumShards)
+        : ConcurrentLruCache(capacity, {}, num_shards) {}
+
+    /// @param capacity   Total cost of the entries kept, split evenly over the shards
+    /// @param can_evict  Entries it returns false for are never evicted
+    /// @param num_shards Number of independently locked shards
+    explicit ConcurrentLruCache(size_t capacity, EvictPredicate can_evict_,
+                                size_t num_shards = DefaultNumShards)
+        : shards(num_shards), can_evict{std::move(can_evict_)} {
+        const size_t shard_capacity = std::max<size_t>(capacity / num_shards, 1);
+        for (Shard& shard : shards) {
+            shard.capacity = shard_capacity;
+        }
+    }
+
+    /// Returns the value cached for a key, marking it as the most recently used
+    [[nodiscard]] std::optional<Value> Find(const Key& key) {
+        Shard& shard = GetShard(key);
+        std::scoped_lock lk{shard.mutex};
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return std::nullopt;
+        }
+        shard.items.splice(shard.items.begin(), shard.items, it->second);
+        return it->second->value;
+    }
+
+    /// Caches a value, replacing the one cached for the same key, and evicts entries over capacity
+    void Insert(const Key& key, Value value, size_t cost = 1) {
+        Shard& shard = GetShard(key);
+        std::scoped_lock lk{shard.mutex};
+        if (const auto it = shard.map.find(key); it != shard.map.end()) {
+            shard.total_cost -= it->second->cost;
+            shard.items.erase(it->second);
+            shard.map.erase(it);
+        }
+        shard.items.push_front(Item{key, std::move(value), cost});
+        shard.map.emplace(key, shard.items.begin());
+        shard.total_cost += cost;
+
+        // Keep the new entry even when it is larger than the capacity on its own
+        auto it = shard.items.end();
+        while (shard.total_cost > shard.capacity && std::prev(it) != shard.items.begin()) {
+            --it;
+            if (can_evict && !can_evict(it->value)) {
+                continue;
+            }
+            shard.total_cost -= it->cost;
+            shard.map.erase(it->key);
+            it = shard.items.erase(it);
+        }
+    }
+
+    /// Removes the value cached for a key, returns true when there was one
+    bool Erase(const Key& key) {
+        Shard& shard = GetShard(key);
+        std::scoped_lock lk{shard.mutex};
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        shard.total_cost -= it->second->cost;
+        shard.items.erase(it->second);
+        shard.map.erase(it);
+        return true;
+    }
+
+    /// Removes every cached value
+    void Clear() {
+        for (Shard& shard : shards) {
+            std::scoped_lock lk{shard.mutex};
+            shard.map.clear();
+            shard.items.clear();
+            shard.total_cost = 0;
+        }
+    }
+
+    /// Returns the total cost of the cached values
+    [[nodiscard]] size_t TotalCost() const {
+        size_t total = 0;
+        for (const Shard& shard : shards) {
+            std::scoped_lock lk{shard.mutex};
+            total += shard.total_cost;
+        }
+        return total;
+    }
+
+private:
+    struct Item {
+        Key key;
+        Value value;
+        size_t cost;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Item> items;
+        std::unordered_map<Key, typename std::list<Item>::iterator, Hash> map;
+        size_t total_cost{};
+        size_t capacity{};
+    };
+
+    Shard& GetShard(const Key& key) {
+        // Mix the hash, the maps of the shards bucket by its low bits too
+        const u64 hash = static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return shards[static_cast<size_t>(hash >> 32) % shards.size()];
+    }
+
+    std::vector<Shard> shards;
+    EvictPredicate can_evict;
+};
+
+} // namespace Common
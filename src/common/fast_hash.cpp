@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef YUZU_HAS_XXHASH
+#include <xxhash.h>
+#else
+#include "common/cityhash.h"
+#endif
+
+#include "common/fast_hash.h"
+
+namespace Common {
+
+#ifdef YUZU_HAS_XXHASH
+
+u64 FastHash64(const void* data, std::size_t size) noexcept {
+    return XXH3_64bits(data, size);
+}
+
+u64 FastHash64WithSeed(const void* data, std::size_t size, u64 seed) noexcept {
+    return XXH3_64bits_withSeed(data, size, seed);
+}
+
+u128 FastHash128(const void* data, std::size_t size) noexcept {
+    const XXH128_hash_t hash = XXH3_128bits(data, size);
+    return {hash.low64, hash.high64};
+}
+
+#else
+
+u64 FastHash64(const void* data, std::size_t size) noexcept {
+    return CityHash64(static_cast<const char*>(data), size);
+}
+
+u64 FastHash64WithSeed(const void* data, std::size_t size, u64 seed) noexcept {
+    // Seed zero must match the unseeded hash, like XXH3
+    if (seed == 0) {
+        return FastHash64(data, size);
+    }
+    return CityHash64WithSeed(static_cast<const char*>(data), size, seed);
+}
+
+u128 FastHash128(const void* data, std::size_t size) noexcept {
+    return CityHash128(static_cast<const char*>(data), size);
+}
+
+#endif
+
+} // namespace Common
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Version of the output of the hashes below. Caches that store these hashes on disk combine it
+ * with their own version through WithFastHashVersion, so builds hashing differently don't load
+ * each other's entries.
+ */
+#ifdef YUZU_HAS_XXHASH
+constexpr u32 FAST_HASH_VERSION = 1;
+#else
+// Builds without xxHash fall back to CityHash
+constexpr u32 FAST_HASH_VERSION = 2;
+#endif
+
+/// Returns the version to store in a cache keyed by these hashes
+[[nodiscard]] constexpr u32 WithFastHashVersion(u32 cache_version) {
+    return cache_version | ((FAST_HASH_VERSION - 1) << 24);
+}
+
+/// Hashes a buffer with XXH3, faster than CityHash on large inputs like shader code and textures
+[[nodiscard]] u64 FastHash64(const void* data, std::size_t size) noexcept;
+
+/// Hashes a buffer with XXH3 and a seed
+[[nodiscard]] u64 FastHash64WithSeed(const void* data, std::size_t size, u64 seed) noexcept;
+
+/// Hashes a buffer with the 128-bit variant of XXH3, the low half comes first
+[[nodiscard]] u128 FastHash128(const void* data, std::size_t size) noexcept;
+
+} // namespace Common
@@ -1,7 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <mutex>
+#include <atomic>
+#include <thread>
 
 #include "common/assert.h"
 #include "common/fiber.h"
@@ -19,10 +20,27 @@ struct Fiber::FiberImpl {
     VirtualBuffer<u8> stack;
     VirtualBuffer<u8> rewind_stack;
 
-    std::mutex guard;
+    /// Acquires the right to run this fiber, waiting for the thread running it to switch away.
+    /// Fibers are only contended when two threads race to switch to the same one, so the waiter
+    /// yields instead of sleeping on a futex that every switch would have to signal.
+    void Acquire() {
+        while (is_running.test_and_set(std::memory_order_acquire)) {
+            while (is_running.test(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// Hands the fiber over to the next thread yielding to it
+    void Release() {
+        is_running.clear(std::memory_order_release);
+    }
+
+    /// Set while the fiber runs or is being switched to, cleared once its context is saved
+    std::atomic_flag is_running;
     std::function<void()> entry_point;
     std::function<void()> rewind_point;
-    std::shared_ptr<Fiber> previous_fiber;
+    Fiber* previous_fiber{};
     bool is_thread_fiber{};
     bool released{};
 
@@ -39,8 +57,8 @@ void Fiber::SetRewindPoint(std::function<void()>&& rewind_func) {
 void Fiber::Start(boost::context::detail::transfer_t& transfer) {
     ASSERT(impl->previous_fiber != nullptr);
     impl->previous_fiber->impl->context = transfer.fctx;
-    impl->previous_fiber->impl->guard.unlock();
-    impl->previous_fiber.reset();
+    impl->previous_fiber->impl->Release();
+    impl->previous_fiber = nullptr;
     impl->entry_point();
     UNREACHABLE();
 }
@@ -82,11 +100,8 @@ Fiber::~Fiber() {
         return;
     }
     // Make sure the Fiber is not being used
-    const bool locked = impl->guard.try_lock();
-    ASSERT_MSG(locked, "Destroying a fiber that's still running");
-    if (locked) {
-        impl->guard.unlock();
-    }
+    ASSERT_MSG(!impl->is_running.test(std::memory_order_acquire),
+               "Destroying a fiber that's still running");
 }
 
 void Fiber::Exit() {
@@ -94,7 +109,7 @@ void Fiber::Exit() {
     if (!impl->is_thread_fiber) {
         return;
     }
-    impl->guard.unlock();
+    impl->Release();
     impl->released = true;
 }
 
@@ -108,26 +123,27 @@ void Fiber::Rewind() {
 }
 
 void Fiber::YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to) {
-    to.impl->guard.lock();
-    to.impl->previous_fiber = weak_from.lock();
+    to.impl->Acquire();
+    // The running fiber can't be destroyed before "to" saves its context, no reference is needed
+    to.impl->previous_fiber = weak_from.lock().get();
 
     auto transfer = boost::context::detail::jump_fcontext(to.impl->context, &to);
 
-    // "from" might no longer be valid if the thread was killed
-    if (auto from = weak_from.lock()) {
-        if (from->impl->previous_fiber == nullptr) {
-            ASSERT_MSG(false, "previous_fiber is nullptr!");
-            return;
-        }
-        from->impl->previous_fiber->impl->context = transfer.fctx;
-        from->impl->previous_fiber->impl->guard.unlock();
-        from->impl->previous_fiber.reset();
+    // The fiber resuming this one passes it as the transfer data, which stays valid even when
+    // the thread owning "from" was killed in the meantime
+    auto* const from = static_cast<Fiber*>(transfer.data);
+    if (from->impl->previous_fiber == nullptr) {
+        ASSERT_MSG(false, "previous_fiber is nullptr!");
+        return;
     }
+    from->impl->previous_fiber->impl->context = transfer.fctx;
+    from->impl->previous_fiber->impl->Release();
+    from->impl->previous_fiber = nullptr;
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
     std::shared_ptr<Fiber> fiber = std::shared_ptr<Fiber>{new Fiber()};
-    fiber->impl->guard.lock();
+    fiber->impl->Acquire();
     fiber->impl->is_thread_fiber = true;
     return fiber;
 }
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * Read-only memory mapping of a whole file.
+ * Pages are only read from disk when they are touched.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Maps the file at path, unmapping the previous file if any.
+    /// @returns True on success, false when the file does not exist, is empty or can't be mapped
+    bool Open(const std::filesystem::path& path);
+
+    /// Unmaps the file.
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return data != nullptr;
+    }
+
+    [[nodiscard]] std::span<const u8> Span() const noexcept {
+        return {data, size};
+    }
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return size;
+    }
+
+private:
+    const u8* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* mapping = nullptr;
+#endif
+};
+
+} // namespace Common::FS
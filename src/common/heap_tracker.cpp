@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <fstream>
+#include <utility>
 #include <vector>
 
 #include "common/heap_tracker.h"
@@ -60,6 +62,10 @@ void HeapTracker::Map(size_t virtual_offset, size_t host_offset, size_t length,
 
     // Finally, map.
     this->DeferredMapSeparateHeap(virtual_offset);
+
+    // Track the mapping together with its neighbors when they form a single host mapping.
+    std::scoped_lock lk{m_lock};
+    this->MergeAdjacentHeapMapsLocked(virtual_offset);
 }
 
 void HeapTracker::Unmap(size_t virtual_offset, size_t size, bool is_separate_heap) {
@@ -111,6 +117,9 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
     const VAddr end = virtual_offset + size;
     VAddr cur = virtual_offset;
 
+    // Contiguous regions that need to be reprotected are protected at once.
+    VAddr protect_begin = cur;
+
     while (cur < end) {
         VAddr next = cur;
         bool should_protect = false;
@@ -147,14 +156,47 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
         // Clamp to end.
         next = std::min(next, end);
 
-        // Reprotect, if we need to.
-        if (should_protect) {
-            m_buffer.Protect(cur, next - cur, perm);
+        // Reprotect the pending regions when this one must be skipped.
+        if (!should_protect) {
+            if (protect_begin != cur) {
+                m_buffer.Protect(protect_begin, cur - protect_begin, perm);
+            }
+            protect_begin = next;
         }
 
         // Advance.
         cur = next;
     }
+
+    // Reprotect the remaining regions.
+    if (protect_begin != end) {
+        m_buffer.Protect(protect_begin, end - protect_begin, perm);
+    }
+}
+
+bool HeapTracker::WriteProtect(size_t virtual_offset, size_t size) {
+    // Ensure no rebuild occurs while reprotecting.
+    std::shared_lock lk{m_rebuild_lock};
+
+    {
+        std::scoped_lock lk2{m_lock};
+
+        // Separate heap mappings restore their own permissions when they become resident,
+        // leave regions overlapping them to Protect. Check the mapping containing the start of
+        // the region, which begins before it after a remap, and then the first one after it.
+        if (this->GetNearestHeapMapLocked(virtual_offset) != m_mappings.end()) {
+            return false;
+        }
+        const SeparateHeapMap key{
+            .vaddr = virtual_offset,
+        };
+        const auto it = m_mappings.nfind(key);
+        if (it != m_mappings.end() && it->vaddr < virtual_offset + size) {
+            return false;
+        }
+    }
+
+    return m_buffer.WriteProtect(virtual_offset, size);
 }
 
 bool HeapTracker::DeferredMapSeparateHeap(u8* fault_address) {
@@ -216,15 +258,29 @@ void HeapTracker::RebuildSeparateHeapAddressSpace() {
     const size_t evict_count = m_resident_map_count - desired_count;
     auto it = m_resident_mappings.begin();
 
+    std::vector<std::pair<VAddr, size_t>> evicted;
+    evicted.reserve(evict_count);
+
     for (size_t i = 0; i < evict_count && it != m_resident_mappings.end(); i++) {
-        // Unmark and unmap.
+        // Unmark.
         it->is_resident = false;
-        m_buffer.Unmap(it->vaddr, it->size, false);
+        evicted.emplace_back(it->vaddr, it->size);
 
         // Advance.
         ASSERT(--m_resident_map_count >= 0);
         it = m_resident_mappings.erase(it);
     }
+
+    // Unmap, merging the evicted mappings that are adjacent in the address space.
+    std::ranges::sort(evicted);
+    for (size_t i = 0; i < evicted.size();) {
+        const VAddr vaddr = evicted[i].first;
+        size_t size = evicted[i].second;
+        for (++i; i < evicted.size() && evicted[i].first == vaddr + size; ++i) {
+            size += evicted[i].second;
+        }
+        m_buffer.Unmap(vaddr, size, false);
+    }
 }
 
 void HeapTracker::SplitHeapMap(VAddr offset, size_t size) {
@@ -270,6 +326,52 @@ void HeapTracker::SplitHeapMapLocked(VAddr offset) {
     }
 }
 
+void HeapTracker::MergeAdjacentHeapMapsLocked(VAddr offset) {
+    const auto it = this->GetNearestHeapMapLocked(offset);
+    if (it == m_mappings.end() || !it->is_resident) {
+        return;
+    }
+
+    // Resident mappings with contiguous backing memory and the same permissions are mapped by
+    // the host as a single region.
+    const auto can_merge = [](const SeparateHeapMap& left, const SeparateHeapMap& right) {
+        return left.is_resident && right.is_resident && left.perm == right.perm &&
+               left.vaddr + left.size == right.vaddr && left.paddr + left.size == right.paddr;
+    };
+
+    const auto merge = [this](SeparateHeapMap* left, SeparateHeapMap* right) {
+        // Remove the right mapping.
+        m_resident_mappings.erase(m_resident_mappings.iterator_to(*right));
+        m_mappings.erase(m_mappings.iterator_to(*right));
+        ASSERT(--m_resident_map_count >= 0);
+        ASSERT(--m_map_count >= 0);
+
+        // Extend the left mapping, ordering it with the most recent tick.
+        m_resident_mappings.erase(m_resident_mappings.iterator_to(*left));
+        left->size += right->size;
+        left->tick = std::max(left->tick, right->tick);
+        m_resident_mappings.insert(*left);
+
+        delete right;
+    };
+
+    // Merge into the left neighbor.
+    auto* map = std::addressof(*it);
+    if (it != m_mappings.begin()) {
+        auto* const left = std::addressof(*std::prev(it));
+        if (can_merge(*left, *map)) {
+            merge(left, map);
+            map = left;
+        }
+    }
+
+    // Merge the right neighbor.
+    const auto right_it = std::next(m_mappings.iterator_to(*map));
+    if (right_it != m_mappings.end() && can_merge(*map, *right_it)) {
+        merge(map, std::addressof(*right_it));
+    }
+}
+
 HeapTracker::AddrTree::iterator HeapTracker::GetNearestHeapMapLocked(VAddr offset) {
     const SeparateHeapMap key{
         .vaddr = offset,
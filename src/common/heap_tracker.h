@@ -57,6 +57,7 @@ public:
              bool is_separate_heap);
     void Unmap(size_t virtual_offset, size_t size, bool is_separate_heap);
     void Protect(size_t virtual_offset, size_t length, MemoryPermission perm);
+    bool WriteProtect(size_t virtual_offset, size_t length);
     u8* VirtualBasePointer() {
         return m_buffer.VirtualBasePointer();
     }
@@ -79,6 +80,7 @@ private:
 private:
     void SplitHeapMap(VAddr offset, size_t size);
     void SplitHeapMapLocked(VAddr offset);
+    void MergeAdjacentHeapMapsLocked(VAddr offset);
 
     AddrTree::iterator GetNearestHeapMapLocked(VAddr offset);
 
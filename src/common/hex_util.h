@@ -49,12 +49,13 @@ template <typename ContiguousContainer>
 
     constexpr std::size_t pad_width = 2;
 
-    std::string out;
-    out.reserve(std::size(data) * pad_width);
-
-    const auto format_str = fmt::runtime(upper ? "{:02X}" : "{:02x}");
+    // Large buffers are dumped through here, formatting each byte with fmt is too slow for them
+    const char* const digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string out(std::size(data) * pad_width, '\0');
+    std::size_t index = 0;
     for (const u8 c : data) {
-        out += fmt::format(format_str, c);
+        out[index++] = digits[c >> 4];
+        out[index++] = digits[c & 0xf];
     }
 
     return out;
@@ -9,7 +9,7 @@
 #include <windows.h>
 #include "common/dynamic_library.h"
 
-#elif defined(__linux__) || defined(__FreeBSD__) // ^^^ Windows ^^^ vvv Linux vvv
+#elif defined(__linux__) || defined(__FreeBSD__) || defined(__APPLE__) // ^^^ Windows ^^^ vvv POSIX
 
 #ifndef _GNU_SOURCE
 #define _GNU_SOURCE
@@ -18,17 +18,40 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/random.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include "common/scope_exit.h"
 
+#ifdef __linux__
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include "common/thread.h"
+
+// Write protection of shared memory needs Linux 6.0 or newer headers
+#if defined(UFFD_FEATURE_WP_HUGETLBFS_SHMEM) && defined(UFFD_USER_MODE_ONLY)
+#define HAS_USERFAULTFD_WP
+#endif
+#endif
+
 #ifndef MAP_NORESERVE
 #define MAP_NORESERVE 0
 #endif
 
-#endif // ^^^ Linux ^^^
+#endif // ^^^ POSIX ^^^
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
 #include <mutex>
 #include <random>
+#include <string>
+#include <thread>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -199,6 +222,29 @@ public:
         UNREACHABLE();
     }
 
+    bool EnableWriteTracking(std::function<bool(u8*)> on_write) {
+        // Write tracking is built on userfaultfd write protection, which is Linux only
+        return false;
+    }
+
+    bool EnableHugePages() {
+        // TODO: Large pages can't back views of a section mapped with 4K granularity.
+        return false;
+    }
+
+    bool WriteProtect(size_t virtual_offset, size_t length) {
+        return false;
+    }
+
+    u64 GetWriteFaultsPerSecond() const noexcept {
+        return 0;
+    }
+
+    u64 GetCommittedSize() const noexcept {
+        // The section is committed as a whole when it is created
+        return backing_size;
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -364,7 +410,7 @@ private:
     std::unordered_map<size_t, size_t> placeholder_host_pointers; ///< Placeholder backing offset
 };
 
-#elif defined(__linux__) || defined(__FreeBSD__) // ^^^ Windows ^^^ vvv Linux vvv
+#elif defined(__linux__) || defined(__FreeBSD__) || defined(__APPLE__) // ^^^ Windows ^^^ vvv POSIX
 
 #ifdef ARCHITECTURE_arm64
 
@@ -446,6 +492,15 @@ public:
 #if defined(__FreeBSD__) && __FreeBSD__ < 13
         // XXX Drop after FreeBSD 12.* reaches EOL on 2024-06-30
         fd = shm_open(SHM_ANON, O_RDWR, 0600);
+#elif defined(__APPLE__)
+        // There are no anonymous shared memory objects, unlink a named one once it is open.
+        static std::atomic<u32> object_count{};
+        const std::string name =
+            fmt::format("/HostMemory.{}.{}", getpid(), object_count.fetch_add(1));
+        fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0) {
+            shm_unlink(name.c_str());
+        }
 #else
         fd = memfd_create("HostMemory", 0);
 #endif
@@ -511,6 +566,15 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+#if defined(__linux__)
+        if (use_huge_pages && length >= HugePageSize) {
+            // Only the views aligned like the backing memory can be mapped with huge pages.
+            madvise(ret, length, MADV_HUGEPAGE);
+        }
+#endif
+
+        // The new mapping replaced any previous registration.
+        RegisterWriteTracking(virtual_base + virtual_offset, length);
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -547,6 +611,11 @@ public:
 #endif
         int ret = mprotect(virtual_base + virtual_offset, length, flags);
         ASSERT_MSG(ret == 0, "mprotect failed: {}", strerror(errno));
+
+        if (write) {
+            // Wake up any thread waiting for the region to be writable.
+            ClearWriteProtect(virtual_base + virtual_offset, length);
+        }
     }
 
     bool ClearBackingRegion(size_t physical_offset, size_t length) {
@@ -566,6 +635,101 @@ public:
         virtual_base = nullptr;
     }
 
+    bool EnableHugePages() {
+#ifdef __linux__
+        // Shared memory only uses transparent huge pages when the host allows it. Hugetlb memory
+        // can't be used instead, as its mappings must be aligned to the huge page size.
+        std::string mode;
+        std::getline(std::ifstream{"/sys/kernel/mm/transparent_hugepage/shmem_enabled"}, mode);
+        if (mode.empty() || mode.find("[never]") != std::string::npos ||
+            mode.find("[deny]") != std::string::npos) {
+            LOG_WARNING(HW_Memory, "Transparent huge pages are disabled for shared memory");
+            return false;
+        }
+        if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+            LOG_WARNING(HW_Memory, "madvise failed: {}", strerror(errno));
+            return false;
+        }
+        use_huge_pages = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool EnableWriteTracking(std::function<bool(u8*)> on_write) {
+#ifdef HAS_USERFAULTFD_WP
+        if (uffd != -1) {
+            return true;
+        }
+        // Handling faults from user mode only does not require privileges.
+        const int new_uffd = static_cast<int>(
+            syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+        if (new_uffd < 0) {
+            LOG_INFO(HW_Memory, "userfaultfd is unavailable: {}", strerror(errno));
+            return false;
+        }
+        uffdio_api api{
+            .api = UFFD_API,
+            .features = UFFD_FEATURE_PAGEFAULT_FLAG_WP | UFFD_FEATURE_WP_HUGETLBFS_SHMEM,
+            .ioctls = 0,
+        };
+        if (ioctl(new_uffd, UFFDIO_API, &api) != 0) {
+            LOG_INFO(HW_Memory, "userfaultfd write protection of shared memory is unsupported");
+            close(new_uffd);
+            return false;
+        }
+        stop_event = eventfd(0, EFD_CLOEXEC);
+        if (stop_event < 0) {
+            LOG_ERROR(HW_Memory, "eventfd failed: {}", strerror(errno));
+            close(new_uffd);
+            return false;
+        }
+        write_callback = std::move(on_write);
+        uffd = new_uffd;
+        write_fault_thread = std::thread([this] { WriteFaultThread(); });
+        LOG_INFO(HW_Memory, "Tracking writes to protected memory with userfaultfd");
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool WriteProtect(size_t virtual_offset, size_t length) {
+#ifdef HAS_USERFAULTFD_WP
+        if (uffd == -1) {
+            return false;
+        }
+        // Intersect the range with our address space.
+        AdjustMap(&virtual_offset, &length);
+
+        uffdio_writeprotect protect{
+            .range = MakeRange(virtual_base + virtual_offset, length),
+            .mode = UFFDIO_WRITEPROTECT_MODE_WP,
+        };
+        return ioctl(uffd, UFFDIO_WRITEPROTECT, &protect) == 0;
+#else
+        return false;
+#endif
+    }
+
+    u64 GetWriteFaultsPerSecond() const noexcept {
+#ifdef HAS_USERFAULTFD_WP
+        return write_faults_per_second.load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+    u64 GetCommittedSize() const noexcept {
+        // Pages of the memfd are only allocated once touched, and freed again by MADV_REMOVE
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            return 0;
+        }
+        return static_cast<u64>(st.st_blocks) * 512;
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -576,6 +740,20 @@ public:
 private:
     /// Release all resources in the object
     void Release() {
+#ifdef HAS_USERFAULTFD_WP
+        if (write_fault_thread.joinable()) {
+            const u64 value = 1;
+            [[maybe_unused]] const ssize_t written = write(stop_event, &value, sizeof(value));
+            write_fault_thread.join();
+        }
+        if (stop_event != -1) {
+            close(stop_event);
+        }
+        if (uffd != -1) {
+            close(uffd);
+        }
+#endif
+
         if (virtual_map_base != MAP_FAILED) {
             int ret = munmap(virtual_map_base, virtual_size);
             ASSERT_MSG(ret == 0, "munmap failed: {}", strerror(errno));
@@ -613,11 +791,126 @@ private:
         }
     }
 
+#ifdef HAS_USERFAULTFD_WP
+    static uffdio_range MakeRange(u8* pointer, size_t length) {
+        return {
+            .start = reinterpret_cast<u64>(pointer),
+            .len = length,
+        };
+    }
+
+    void RegisterWriteTracking(u8* pointer, size_t length) {
+        if (uffd == -1 || length == 0) {
+            return;
+        }
+        uffdio_register reg{
+            .range = MakeRange(pointer, length),
+            .mode = UFFDIO_REGISTER_MODE_WP,
+            .ioctls = 0,
+        };
+        if (ioctl(uffd, UFFDIO_REGISTER, &reg) != 0) {
+            // Write protecting the region will fail and fall back to mprotect.
+            LOG_DEBUG(HW_Memory, "Failed to register {:#x} bytes for write tracking: {}", length,
+                      strerror(errno));
+        }
+    }
+
+    void ClearWriteProtect(u8* pointer, size_t length) {
+        if (uffd == -1 || length == 0) {
+            return;
+        }
+        // This fails on regions that are not registered, which are never write protected.
+        uffdio_writeprotect protect{
+            .range = MakeRange(pointer, length),
+            .mode = 0,
+        };
+        ioctl(uffd, UFFDIO_WRITEPROTECT, &protect);
+    }
+
+    void WriteFaultThread() {
+        Common::SetCurrentThreadName("WriteTracker");
+
+        std::array<pollfd, 2> fds{{
+            {.fd = uffd, .events = POLLIN, .revents = 0},
+            {.fd = stop_event, .events = POLLIN, .revents = 0},
+        }};
+        u64 num_faults = 0;
+        auto report_time = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+        while (true) {
+            const int ready = poll(fds.data(), fds.size(), 1000);
+            if (fds[1].revents != 0) {
+                break;
+            }
+            if (ready > 0 && (fds[0].revents & POLLIN) != 0) {
+                num_faults += ResolveWriteFaults();
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= report_time) {
+                write_faults_per_second.store(num_faults, std::memory_order_relaxed);
+                if (num_faults != 0) {
+                    LOG_DEBUG(HW_Memory, "{} write faults per second", num_faults);
+                }
+                num_faults = 0;
+                report_time = now + std::chrono::seconds{1};
+            }
+        }
+    }
+
+    size_t ResolveWriteFaults() {
+        // Read every pending fault at once, several threads may be waiting on the same page.
+        std::array<uffd_msg, 64> messages;
+        const ssize_t bytes = read(uffd, messages.data(), sizeof(messages));
+        if (bytes <= 0) {
+            return 0;
+        }
+        const size_t num_messages = static_cast<size_t>(bytes) / sizeof(uffd_msg);
+
+        std::array<u8*, 64> pages;
+        size_t num_pages = 0;
+        for (size_t i = 0; i < num_messages; ++i) {
+            const uffd_msg& message = messages[i];
+            if (message.event != UFFD_EVENT_PAGEFAULT ||
+                (message.arg.pagefault.flags & UFFD_PAGEFAULT_FLAG_WP) == 0) {
+                continue;
+            }
+            pages[num_pages++] =
+                reinterpret_cast<u8*>(message.arg.pagefault.address & ~(PageAlignment - 1));
+        }
+        std::sort(pages.begin(), pages.begin() + num_pages);
+        const auto pages_end = std::unique(pages.begin(), pages.begin() + num_pages);
+
+        for (auto it = pages.begin(); it != pages_end; ++it) {
+            u8* const page = *it;
+            if (write_callback(page)) {
+                // Retry the faulting accesses, the page should be writable now.
+                uffdio_range range{MakeRange(page, PageAlignment)};
+                ioctl(uffd, UFFDIO_WAKE, &range);
+            } else {
+                // Retry with the page protected, so the signal handler reports the access.
+                mprotect(page, PageAlignment, PROT_READ);
+                ClearWriteProtect(page, PageAlignment);
+            }
+        }
+        return num_messages;
+    }
+
+    int uffd{-1};       // userfaultfd file descriptor used for write tracking
+    int stop_event{-1}; // eventfd signaled to stop the fault thread
+    std::function<bool(u8*)> write_callback;
+    std::thread write_fault_thread;
+    std::atomic<u64> write_faults_per_second{};
+#else
+    void RegisterWriteTracking(u8* pointer, size_t length) {}
+
+    void ClearWriteProtect(u8* pointer, size_t length) {}
+#endif
+
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
+    bool use_huge_pages{};
     FreeRegionManager free_manager{};
 };
 
-#else // ^^^ Linux ^^^ vvv Generic vvv
+#else // ^^^ POSIX ^^^ vvv Generic vvv
 
 class HostMemory::Impl {
 public:
@@ -639,6 +932,26 @@ public:
 
     void EnableDirectMappedAddress() {}
 
+    bool EnableWriteTracking(std::function<bool(u8*)> on_write) {
+        return false;
+    }
+
+    bool EnableHugePages() {
+        return false;
+    }
+
+    bool WriteProtect(size_t virtual_offset, size_t length) {
+        return false;
+    }
+
+    u64 GetWriteFaultsPerSecond() const noexcept {
+        return 0;
+    }
+
+    u64 GetCommittedSize() const noexcept {
+        return 0;
+    }
+
     u8* backing_base{nullptr};
     u8* virtual_base{nullptr};
 };
@@ -727,4 +1040,31 @@ void HostMemory::EnableDirectMappedAddress() {
     }
 }
 
+bool HostMemory::EnableWriteTracking(std::function<bool(u8*)> on_write) {
+    return impl && impl->EnableWriteTracking(std::move(on_write));
+}
+
+bool HostMemory::EnableHugePages() {
+    return impl && impl->EnableHugePages();
+}
+
+bool HostMemory::WriteProtect(size_t virtual_offset, size_t length) {
+    ASSERT(virtual_offset % PageAlignment == 0);
+    ASSERT(length % PageAlignment == 0);
+    ASSERT(virtual_offset + length <= virtual_size);
+    if (length == 0 || !virtual_base || !impl) {
+        return false;
+    }
+    return impl->WriteProtect(virtual_offset + virtual_base_offset, length);
+}
+
+u64 HostMemory::GetWriteFaultsPerSecond() const noexcept {
+    return impl ? impl->GetWriteFaultsPerSecond() : 0;
+}
+
+u64 HostMemory::GetCommittedSize() const noexcept {
+    // The fallback buffer is committed on first touch too, its size is the upper bound
+    return impl ? impl->GetCommittedSize() : backing_size;
+}
+
 } // namespace Common
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -49,6 +50,33 @@ public:
 
     void EnableDirectMappedAddress();
 
+    /**
+     * Tracks writes to write protected regions with userfaultfd instead of signals, when the host
+     * kernel supports it. Faulting threads are blocked until the callback, which receives the
+     * written page, returns. Returning false delivers the access as a regular access violation.
+     * @returns True when write tracking is enabled
+     */
+    bool EnableWriteTracking(std::function<bool(u8*)> on_write);
+
+    /**
+     * Backs the memory with transparent huge pages where the host allows it, reducing TLB misses
+     * on large mappings. Only supported on Linux with huge pages enabled for shared memory.
+     * @returns True when huge pages are enabled
+     */
+    bool EnableHugePages();
+
+    /**
+     * Write protects a region through write tracking, Protect makes it writable again.
+     * @returns False when the region can not be tracked, Protect must be used instead
+     */
+    bool WriteProtect(size_t virtual_offset, size_t length);
+
+    /// Returns the number of tracked writes resolved in the last second
+    [[nodiscard]] u64 GetWriteFaultsPerSecond() const noexcept;
+
+    /// Returns the number of bytes of the backing memory the host has committed
+    [[nodiscard]] u64 GetCommittedSize() const noexcept;
+
     void ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value);
 
     [[nodiscard]] u8* BackingBasePointer() noexcept {
@@ -32,6 +32,10 @@
 
 namespace Common::Log {
 
+namespace detail {
+std::array<std::atomic<u8>, static_cast<size_t>(Class::Count)> enabled_levels{};
+} // namespace detail
+
 namespace {
 
 /**
@@ -177,6 +181,25 @@ public:
 
 bool initialization_in_progress_suppress_logging = true;
 
+/// Publishes the levels a filter lets through, for the checks done before formatting
+void UpdateEnabledLevels(const Filter& filter) {
+    for (size_t i = 0; i < detail::enabled_levels.size(); i++) {
+        u8 mask{};
+        for (u8 level = 0; level < static_cast<u8>(Level::Count); level++) {
+            if (filter.CheckMessage(static_cast<Class>(i), static_cast<Level>(level))) {
+                mask |= static_cast<u8>(1U << level);
+            }
+        }
+        detail::enabled_levels[i].store(mask, std::memory_order_relaxed);
+    }
+}
+
+void DisableEnabledLevels() {
+    for (auto& mask : detail::enabled_levels) {
+        mask.store(0, std::memory_order_relaxed);
+    }
+}
+
 /**
  * Static state as a singleton.
  */
@@ -202,6 +225,7 @@ public:
         instance = std::unique_ptr<Impl, decltype(&Deleter)>(new Impl(log_dir / LOG_FILE, filter),
                                                              Deleter);
         initialization_in_progress_suppress_logging = false;
+        UpdateEnabledLevels(filter);
     }
 
     static void Start() {
@@ -220,6 +244,7 @@ public:
 
     void SetGlobalFilter(const Filter& f) {
         filter = f;
+        UpdateEnabledLevels(filter);
     }
 
     void SetColorConsoleBackendEnabled(bool enabled) {
@@ -227,12 +252,24 @@ public:
     }
 
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
-                   const char* function, std::string&& message) {
+                   const char* function, const char* format, const fmt::format_args& args) {
         if (!filter.CheckMessage(log_class, log_level)) {
             return;
         }
-        message_queue.EmplaceWait(
-            CreateEntry(log_class, log_level, filename, line_num, function, std::move(message)));
+        message_queue.EmplaceWait(CreateEntry(log_class, log_level, filename, line_num, function,
+                                              fmt::vformat(format, args)));
+    }
+
+    void PushDeferredEntry(Class log_class, Level log_level, const char* filename,
+                           unsigned int line_num, const char* function, const char* format,
+                           const DeferredLogArgs& args) {
+        if (!filter.CheckMessage(log_class, log_level)) {
+            return;
+        }
+        Entry entry{CreateEntry(log_class, log_level, filename, line_num, function, {})};
+        entry.format = format;
+        entry.deferred_args = args;
+        message_queue.EmplaceWait(std::move(entry));
     }
 
 private:
@@ -246,6 +283,7 @@ private:
             Common::SetCurrentThreadName("Logger");
             Entry entry;
             const auto write_logs = [this, &entry]() {
+                FormatDeferredMessage(entry);
                 ForEachBackend([&entry](Backend& backend) { backend.Write(entry); });
             };
             while (!stop_token.stop_requested()) {
@@ -289,6 +327,19 @@ private:
         };
     }
 
+    static void FormatDeferredMessage(Entry& entry) {
+        if (!entry.deferred_args.formatter) {
+            return;
+        }
+        try {
+            entry.message = entry.deferred_args.formatter(entry.format, entry.deferred_args);
+        } catch (const fmt::format_error& error) {
+            // Formatting on the calling thread would have thrown there, do not kill the logger.
+            entry.message = fmt::format("{} (format error: {})", entry.format, error.what());
+        }
+        entry.deferred_args.formatter = nullptr;
+    }
+
     void ForEachBackend(auto lambda) {
         lambda(static_cast<Backend&>(debugger_backend));
         lambda(static_cast<Backend&>(color_console_backend));
@@ -332,6 +383,7 @@ void Stop() {
 
 void DisableLoggingInTests() {
     initialization_in_progress_suppress_logging = true;
+    DisableEnabledLevels();
 }
 
 void SetGlobalFilter(const Filter& filter) {
@@ -346,8 +398,17 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args) {
     if (!initialization_in_progress_suppress_logging) {
-        Impl::Instance().PushEntry(log_class, log_level, filename, line_num, function,
-                                   fmt::vformat(format, args));
+        Impl::Instance().PushEntry(log_class, log_level, filename, line_num, function, format,
+                                   args);
+    }
+}
+
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            const DeferredLogArgs& args) {
+    if (!initialization_in_progress_suppress_logging) {
+        Impl::Instance().PushDeferredEntry(log_class, log_level, filename, line_num, function,
+                                           format, args);
     }
 }
 } // namespace Common::Log
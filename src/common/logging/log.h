@@ -4,7 +4,14 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -22,46 +29,138 @@ constexpr const char* TrimSourcePath(std::string_view source) {
     return source.data() + idx;
 }
 
+/// Lowest level compiled in by default, messages below it are removed at compile time
+#ifdef YUZU_LOG_MINIMUM_LEVEL
+constexpr Level CompiledLogLevel = Level::YUZU_LOG_MINIMUM_LEVEL;
+#elif defined(_DEBUG)
+constexpr Level CompiledLogLevel = Level::Trace;
+#else
+constexpr Level CompiledLogLevel = Level::Debug;
+#endif
+
+/// Classes compiled in from a higher level than CompiledLogLevel, for their hot paths
+constexpr std::array<std::pair<Class, Level>, 0> CompiledClassLevels{};
+
+/// Returns the lowest level of a class compiled in
+constexpr Level GetCompiledLevel(Class log_class) {
+    for (const auto& [overridden_class, level] : CompiledClassLevels) {
+        if (overridden_class == log_class) {
+            return std::max(level, CompiledLogLevel);
+        }
+    }
+    return CompiledLogLevel;
+}
+
+namespace detail {
+/// Mask of the levels the global filter lets through, per class
+extern std::array<std::atomic<u8>, static_cast<size_t>(Class::Count)> enabled_levels;
+} // namespace detail
+
+/**
+ * Checks a message against the compiled levels and the global filter, before any of its
+ * arguments are evaluated.
+ */
+template <Class log_class, Level log_level>
+bool IsLogEnabled() {
+    if constexpr (static_cast<u8>(log_level) < static_cast<u8>(GetCompiledLevel(log_class))) {
+        return false;
+    } else {
+        const u8 mask{detail::enabled_levels[static_cast<size_t>(log_class)].load(
+            std::memory_order_relaxed)};
+        return (mask & (1U << static_cast<u8>(log_level))) != 0;
+    }
+}
+
 /// Logs a message to the global logger, using fmt
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args);
 
+/**
+ * Arguments of a log message copied by value, so the message can be formatted on the logging
+ * thread instead of the thread logging it.
+ */
+struct DeferredLogArgs {
+    /// Most arguments that can be copied
+    static constexpr size_t MaxArgs = 8;
+
+    using Formatter = std::string (*)(const char* format, const DeferredLogArgs& args);
+
+    template <typename T>
+    void Set(size_t index, const T& value) {
+        std::memcpy(&data[index], &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Get(size_t index) const {
+        T value;
+        std::memcpy(&value, &data[index], sizeof(T));
+        return value;
+    }
+
+    /// Formats the message from the arguments, null when nothing was deferred
+    Formatter formatter{};
+    std::array<u64, MaxArgs> data{};
+};
+
+/// Arguments formatted from their value alone, which are safe to format later
+template <typename T>
+constexpr bool IsDeferrableLogArg = (std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+                                    sizeof(T) <= sizeof(u64) && std::is_trivially_copyable_v<T>;
+
+template <typename... Args>
+std::string FormatDeferredLogMessage(const char* format, const DeferredLogArgs& deferred) {
+    return [&]<size_t... I>(std::index_sequence<I...>) {
+        const std::tuple<Args...> args{deferred.Get<Args>(I)...};
+        return std::apply(
+            [format](const auto&... unpacked) {
+                return fmt::vformat(format, fmt::make_format_args(unpacked...));
+            },
+            args);
+    }(std::index_sequence_for<Args...>{});
+}
+
+/// Logs a message to the global logger, formatting it on the logging thread. The format string
+/// must outlive the logger, as the string literals of the LOG_* macros do.
+void DeferredLogMessageImpl(Class log_class, Level log_level, const char* filename,
+                            unsigned int line_num, const char* function, const char* format,
+                            const DeferredLogArgs& args);
+
 template <typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, const char* format, const Args&... args) {
-    FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
-                      fmt::make_format_args(args...));
+    if constexpr (sizeof...(Args) != 0 && sizeof...(Args) <= DeferredLogArgs::MaxArgs &&
+                  (IsDeferrableLogArg<Args> && ...)) {
+        DeferredLogArgs deferred{.formatter = &FormatDeferredLogMessage<Args...>};
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (deferred.Set(I, args), ...);
+        }(std::index_sequence_for<Args...>{});
+        DeferredLogMessageImpl(log_class, log_level, filename, line_num, function, format,
+                               deferred);
+    } else {
+        FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
+                          fmt::make_format_args(args...));
+    }
 }
 
 } // namespace Common::Log
 
+#define LOG_GENERIC(log_class, log_level, ...)                                                     \
+    (Common::Log::IsLogEnabled<Common::Log::Class::log_class, Common::Log::Level::log_level>()     \
+         ? Common::Log::FmtLogMessage(Common::Log::Class::log_class,                               \
+                                      Common::Log::Level::log_level,                               \
+                                      Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,   \
+                                      __VA_ARGS__)                                                 \
+         : void(0))
+
 #ifdef _DEBUG
-#define LOG_TRACE(log_class, ...)                                                                  \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Trace,           \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
+#define LOG_TRACE(log_class, ...) LOG_GENERIC(log_class, Trace, __VA_ARGS__)
 #else
 #define LOG_TRACE(log_class, fmt, ...) (void(0))
 #endif
 
-#define LOG_DEBUG(log_class, ...)                                                                  \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Debug,           \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
-#define LOG_INFO(log_class, ...)                                                                   \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Info,            \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
-#define LOG_WARNING(log_class, ...)                                                                \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Warning,         \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
-#define LOG_ERROR(log_class, ...)                                                                  \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Error,           \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
-#define LOG_CRITICAL(log_class, ...)                                                               \
-    Common::Log::FmtLogMessage(Common::Log::Class::log_class, Common::Log::Level::Critical,        \
-                               Common::Log::TrimSourcePath(__FILE__), __LINE__, __func__,          \
-                               __VA_ARGS__)
+#define LOG_DEBUG(log_class, ...) LOG_GENERIC(log_class, Debug, __VA_ARGS__)
+#define LOG_INFO(log_class, ...) LOG_GENERIC(log_class, Info, __VA_ARGS__)
+#define LOG_WARNING(log_class, ...) LOG_GENERIC(log_class, Warning, __VA_ARGS__)
+#define LOG_ERROR(log_class, ...) LOG_GENERIC(log_class, Error, __VA_ARGS__)
+#define LOG_CRITICAL(log_class, ...) LOG_GENERIC(log_class, Critical, __VA_ARGS__)
@@ -5,6 +5,7 @@
 
 #include <chrono>
 
+#include "common/logging/log.h"
 #include "common/logging/types.h"
 
 namespace Common::Log {
@@ -21,6 +22,9 @@ struct Entry {
     unsigned int line_num = 0;
     std::string function;
     std::string message;
+    /// Format string and arguments of a message not formatted yet, see DeferredLogArgs
+    const char* format = nullptr;
+    DeferredLogArgs deferred_args{};
 };
 
 } // namespace Common::Log
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include "common/literals.h"
+#include "common/memory_accounting.h"
+#include "common/memory_detect.h"
+#include "common/metrics.h"
+#include "common/settings.h"
+
+namespace Common::MemoryAccounting {
+namespace {
+using namespace Common::Literals;
+
+constexpr size_t NumCategories = static_cast<size_t>(Category::Count);
+
+constexpr std::array<std::string_view, NumCategories> CATEGORY_NAMES{
+    "guest_memory",    "texture_cache",     "buffer_cache",    "shader_cache",
+    "staging_buffers", "file_system_cache", "scratch_buffers",
+};
+
+// Trivially destructible, so buffers released by static destructors can still be accounted
+constinit std::array<std::atomic<s64>, NumCategories> category_bytes{};
+
+struct Samplers {
+    std::mutex mutex;
+    std::array<std::function<u64()>, NumCategories> callbacks;
+};
+
+Samplers& GetSamplers() {
+    static Samplers samplers;
+    return samplers;
+}
+
+Metrics::Gauge& GetGauge(Category category) {
+    static const std::array<Metrics::Gauge*, NumCategories> gauges = [] {
+        std::array<Metrics::Gauge*, NumCategories> result{};
+        for (size_t index = 0; index < NumCategories; ++index) {
+            result[index] = &Metrics::GetRegistry().RegisterGauge(
+                fmt::format("yuzu_memory_{}_bytes", CATEGORY_NAMES[index]),
+                fmt::format("Host memory held by the {}", CATEGORY_NAMES[index]));
+        }
+        return result;
+    }();
+    return *gauges[static_cast<size_t>(category)];
+}
+} // Anonymous namespace
+
+void Add(Category category, s64 bytes) {
+    category_bytes[static_cast<size_t>(category)].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void Set(Category category, u64 bytes) {
+    category_bytes[static_cast<size_t>(category)].store(static_cast<s64>(bytes),
+                                                        std::memory_order_relaxed);
+}
+
+void SetSampler(Category category, std::function<u64()> sampler) {
+    Samplers& samplers = GetSamplers();
+    std::scoped_lock lk{samplers.mutex};
+    samplers.callbacks[static_cast<size_t>(category)] = std::move(sampler);
+    if (!samplers.callbacks[static_cast<size_t>(category)]) {
+        Set(category, 0);
+    }
+}
+
+u64 Get(Category category) {
+    const size_t index = static_cast<size_t>(category);
+    {
+        Samplers& samplers = GetSamplers();
+        std::scoped_lock lk{samplers.mutex};
+        if (samplers.callbacks[index]) {
+            Set(category, samplers.callbacks[index]());
+        }
+    }
+    const s64 bytes = category_bytes[index].load(std::memory_order_relaxed);
+    // Gauges are refreshed whenever the categories are read, at least once a frame
+    GetGauge(category).Set(bytes);
+    return static_cast<u64>(bytes);
+}
+
+u64 GetTotal() {
+    u64 total = 0;
+    for (size_t index = 0; index < NumCategories; ++index) {
+        total += Get(static_cast<Category>(index));
+    }
+    return total;
+}
+
+std::string_view GetName(Category category) {
+    return CATEGORY_NAMES[static_cast<size_t>(category)];
+}
+
+u64 GetBudget() {
+    const u64 budget_mib = Settings::values.memory_budget.GetValue();
+    if (budget_mib != 0) {
+        return budget_mib * 1_MiB;
+    }
+    return GetMemInfo().TotalPhysicalMemory / 4 * 3;
+}
+
+u64 GetExcess() {
+    const u64 total = GetTotal();
+    const u64 budget = GetBudget();
+    return total > budget ? total - budget : 0;
+}
+
+} // namespace Common::MemoryAccounting
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string_view>
+
+#include "common/common_types.h"
+
+/**
+ * Accounting of the host memory held by the subsystems that grow over a session, published as
+ * the yuzu_memory_<category>_bytes gauges of Common::Metrics.
+ *
+ * The caches charge the size of what they allocate, their own estimate of the host or device
+ * memory it takes, and the guest memory reports how much of its backing has been committed.
+ * Against the memory_budget setting this tells the caches when to collect garbage early, before
+ * the host runs out of memory.
+ */
+namespace Common::MemoryAccounting {
+
+enum class Category : u32 {
+    GuestMemory,
+    TextureCache,
+    BufferCache,
+    ShaderCache,
+    StagingBuffers,
+    FileSystemCache,
+    ScratchBuffers,
+    Count,
+};
+
+/// Adds bytes, or removes them when negative, to the memory held by a category
+void Add(Category category, s64 bytes);
+
+/// Replaces the memory held by a category, for subsystems that keep their own total
+void Set(Category category, u64 bytes);
+
+/// Reads the memory held by a category from a callback instead, an empty one stops sampling
+void SetSampler(Category category, std::function<u64()> sampler);
+
+[[nodiscard]] u64 Get(Category category);
+
+/// Returns the memory held by every category
+[[nodiscard]] u64 GetTotal();
+
+[[nodiscard]] std::string_view GetName(Category category);
+
+/// Returns the most memory the categories should hold together, in bytes, from the memory_budget
+/// setting or three quarters of the physical memory when it is zero
+[[nodiscard]] u64 GetBudget();
+
+/// Returns how many bytes the categories hold beyond the budget, zero when within it
+[[nodiscard]] u64 GetExcess();
+
+/// Memory charged to a category by one owner, released from the category when it is destroyed
+class Charge {
+public:
+    explicit Charge(Category category_) : category{category_} {}
+
+    ~Charge() {
+        MemoryAccounting::Add(category, -bytes.load(std::memory_order_relaxed));
+    }
+
+    Charge(const Charge&) = delete;
+    Charge& operator=(const Charge&) = delete;
+
+    /// Charges bytes to the category, or releases them when negative
+    void Add(s64 delta) {
+        bytes.fetch_add(delta, std::memory_order_relaxed);
+        MemoryAccounting::Add(category, delta);
+    }
+
+private:
+    Category category;
+    std::atomic<s64> bytes{};
+};
+
+} // namespace Common::MemoryAccounting
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "common/assert.h"
+#include "common/metrics.h"
+
+namespace Common::Metrics {
+
+namespace {
+std::atomic<size_t> next_shard{};
+
+template <typename T>
+T* FindEntry(std::deque<T>& entries, std::string_view name) {
+    const auto it = std::ranges::find(entries, name, &T::name);
+    return it == entries.end() ? nullptr : &*it;
+}
+
+void AppendHeader(std::string& out, const std::string& name, const std::string& help,
+                  std::string_view type) {
+    out += fmt::format("# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+} // Anonymous namespace
+
+size_t GetCurrentShard() {
+    thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) %
+                                      NumShards;
+    return shard;
+}
+
+u64 Counter::Get() const {
+    u64 total = 0;
+    for (const auto& shard : shards) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+Histogram::Histogram(std::initializer_list<f64> upper_bounds) : num_bounds{upper_bounds.size()} {
+    ASSERT(num_bounds <= MaxBuckets && std::ranges::is_sorted(upper_bounds));
+    std::ranges::copy(upper_bounds, bounds.begin());
+}
+
+void Histogram::Observe(f64 value) {
+    const auto bucket = static_cast<size_t>(
+        std::ranges::lower_bound(bounds.begin(), bounds.begin() + num_bounds, value) -
+        bounds.begin());
+    Shard& shard = shards[GetCurrentShard()];
+    shard.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    // Not fetch_add, floating point atomics are missing from some of the standard libraries used.
+    f64 sum = shard.sum.load(std::memory_order_relaxed);
+    while (!shard.sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+Histogram::Snapshot Histogram::Get() const {
+    Snapshot snapshot{
+        .upper_bounds{bounds.begin(), bounds.begin() + num_bounds},
+        .cumulative_counts = std::vector<u64>(num_bounds + 1),
+        .sum = 0.0,
+    };
+    for (const auto& shard : shards) {
+        for (size_t bucket = 0; bucket <= num_bounds; bucket++) {
+            snapshot.cumulative_counts[bucket] +=
+                shard.counts[bucket].load(std::memory_order_relaxed);
+        }
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    for (size_t bucket = 1; bucket <= num_bounds; bucket++) {
+        snapshot.cumulative_counts[bucket] += snapshot.cumulative_counts[bucket - 1];
+    }
+    return snapshot;
+}
+
+Counter& Registry::RegisterCounter(std::string_view name, std::string_view help) {
+    std::scoped_lock lk{mutex};
+    if (auto* const entry = FindEntry(counters, name)) {
+        return entry->metric;
+    }
+    return counters.emplace_back(name, help).metric;
+}
+
+Gauge& Registry::RegisterGauge(std::string_view name, std::string_view help) {
+    std::scoped_lock lk{mutex};
+    if (auto* const entry = FindEntry(gauges, name)) {
+        return entry->metric;
+    }
+    return gauges.emplace_back(name, help).metric;
+}
+
+Histogram& Registry::RegisterHistogram(std::string_view name, std::string_view help,
+                                       std::initializer_list<f64> upper_bounds) {
+    std::scoped_lock lk{mutex};
+    if (auto* const entry = FindEntry(histograms, name)) {
+        return entry->metric;
+    }
+    return histograms.emplace_back(name, help, upper_bounds).metric;
+}
+
+std::string Registry::Serialize() const {
+    std::scoped_lock lk{mutex};
+    std::string out;
+    for (const auto& entry : counters) {
+        AppendHeader(out, entry.name, entry.help, "counter");
+        out += fmt::format("{} {}\n", entry.name, entry.metric.Get());
+    }
+    for (const auto& entry : gauges) {
+        AppendHeader(out, entry.name, entry.help, "gauge");
+        out += fmt::format("{} {}\n", entry.name, entry.metric.Get());
+    }
+    for (const auto& entry : histograms) {
+        AppendHeader(out, entry.name, entry.help, "histogram");
+        const auto snapshot = entry.metric.Get();
+        for (size_t bucket = 0; bucket < snapshot.upper_bounds.size(); bucket++) {
+            out += fmt::format("{}_bucket{{le=\"{}\"}} {}\n", entry.name,
+                               snapshot.upper_bounds[bucket], snapshot.cumulative_counts[bucket]);
+        }
+        const u64 count = snapshot.cumulative_counts.back();
+        out += fmt::format("{}_bucket{{le=\"+Inf\"}} {}\n", entry.name, count);
+        out += fmt::format("{}_sum {}\n{}_count {}\n", entry.name, snapshot.sum, entry.name, count);
+    }
+    return out;
+}
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+} // namespace Common::Metrics
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+/**
+ * Registry of counters, gauges and histograms that subsystems update on their hot paths, exported
+ * in the Prometheus text format (see Core::Tools::MetricsServer).
+ *
+ * Metrics are registered once, usually into a function local static reference, and live until
+ * the program exits. Counters and histograms are sharded per thread, so threads updating the
+ * same metric do not contend on a cache line.
+ */
+namespace Common::Metrics {
+
+/// Number of shards of the sharded metrics, threads are spread over them
+constexpr size_t NumShards = 16;
+
+#ifdef __cpp_lib_hardware_interference_size
+constexpr size_t ShardAlignment = std::hardware_destructive_interference_size;
+#else
+constexpr size_t ShardAlignment = 128;
+#endif
+
+/// Returns the shard the calling thread updates
+size_t GetCurrentShard();
+
+/// Monotonically increasing count
+class Counter {
+public:
+    void Increment(u64 value = 1) {
+        shards[GetCurrentShard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    u64 Get() const;
+
+private:
+    struct alignas(ShardAlignment) Shard {
+        std::atomic<u64> value{};
+    };
+    std::array<Shard, NumShards> shards{};
+};
+
+/// Value that goes up and down
+class Gauge {
+public:
+    void Set(s64 new_value) {
+        value.store(new_value, std::memory_order_relaxed);
+    }
+
+    void Add(s64 delta) {
+        value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    s64 Get() const {
+        return value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<s64> value{};
+};
+
+/// Distribution of observed values, counted in buckets by their upper bound
+class Histogram {
+public:
+    /// Most buckets a histogram can have, not counting the implicit +Inf one
+    static constexpr size_t MaxBuckets = 15;
+
+    explicit Histogram(std::initializer_list<f64> upper_bounds);
+
+    void Observe(f64 value);
+
+    struct Snapshot {
+        std::vector<f64> upper_bounds;
+        /// Cumulative count of each bucket, then the count of every value
+        std::vector<u64> cumulative_counts;
+        f64 sum;
+    };
+    Snapshot Get() const;
+
+private:
+    struct alignas(ShardAlignment) Shard {
+        std::array<std::atomic<u64>, MaxBuckets + 1> counts{};
+        std::atomic<f64> sum{};
+    };
+
+    std::array<f64, MaxBuckets> bounds{};
+    size_t num_bounds{};
+    std::array<Shard, NumShards> shards{};
+};
+
+class Registry {
+public:
+    /// Registers a metric, or returns the one already registered under the same name
+    Counter& RegisterCounter(std::string_view name, std::string_view help);
+    Gauge& RegisterGauge(std::string_view name, std::string_view help);
+    Histogram& RegisterHistogram(std::string_view name, std::string_view help,
+                                 std::initializer_list<f64> upper_bounds);
+
+    /// Returns every metric in the Prometheus text exposition format
+    std::string Serialize() const;
+
+private:
+    template <typename T>
+    struct Entry {
+        template <typename... Args>
+        explicit Entry(std::string_view name_, std::string_view help_, Args&&... args)
+            : name{name_}, help{help_}, metric(std::forward<Args>(args)...) {}
+
+        std::string name;
+        std::string help;
+        T metric;
+    };
+
+    mutable std::mutex mutex;
+    std::deque<Entry<Counter>> counters;
+    std::deque<Entry<Gauge>> gauges;
+    std::deque<Entry<Histogram>> histograms;
+};
+
+/// Returns the registry of the whole program
+Registry& GetRegistry();
+
+} // namespace Common::Metrics
@@ -22,3 +22,36 @@ typedef void* HANDLE;
 #include <microprofile.h>
 
 #define MP_RGB(r, g, b) ((r) << 16 | (g) << 8 | (b) << 0)
+
+#if MICROPROFILE_ENABLED
+#include "common/trace_recorder.h"
+
+/// Times a scope with MicroProfile, and records it in the trace while one is captured
+class MicroProfileTraceScopeHandler {
+public:
+    explicit MicroProfileTraceScopeHandler(MicroProfileToken token_)
+        : token{token_}, tick{MicroProfileEnter(token_)},
+          begin{Common::Trace::IsCapturing() ? Common::Trace::GetTimestamp() : -1} {}
+
+    ~MicroProfileTraceScopeHandler() {
+        MicroProfileLeave(token, tick);
+        if (begin >= 0 && Common::Trace::IsCapturing()) {
+            Common::Trace::RecordScope(token, begin, Common::Trace::GetTimestamp());
+        }
+    }
+
+    MicroProfileTraceScopeHandler(const MicroProfileTraceScopeHandler&) = delete;
+    MicroProfileTraceScopeHandler& operator=(const MicroProfileTraceScopeHandler&) = delete;
+
+private:
+    MicroProfileToken token;
+    uint64_t tick;
+    int64_t begin;
+};
+
+#undef MICROPROFILE_SCOPE
+#undef MICROPROFILE_SCOPE_TOKEN
+#define MICROPROFILE_SCOPE(var) MICROPROFILE_SCOPE_TOKEN(g_mp_##var)
+#define MICROPROFILE_SCOPE_TOKEN(token)                                                            \
+    MicroProfileTraceScopeHandler MICROPROFILE_TOKEN_PASTE(foo, __LINE__)(token)
+#endif
@@ -114,6 +114,24 @@ struct PageTable {
      */
     void Resize(std::size_t address_space_width_in_bits, std::size_t page_size_in_bits);
 
+    /**
+     * Returns the number of consecutive pages starting at page_index that share the type and
+     * pointer of the first page, up to max_pages.
+     * Memory pages sharing a pointer are backed by contiguous host memory.
+     *
+     * @param page_index Index of the first page.
+     * @param max_pages  Maximum number of pages to check.
+     */
+    [[nodiscard]] std::size_t ContiguousPages(std::size_t page_index,
+                                              std::size_t max_pages) const noexcept {
+        const uintptr_t raw = pointers[page_index].Raw();
+        std::size_t num_pages = 1;
+        while (num_pages < max_pages && pointers[page_index + num_pages].Raw() == raw) {
+            ++num_pages;
+        }
+        return num_pages;
+    }
+
     std::size_t GetAddressSpaceBits() const {
         return current_address_space_width_in_bits;
     }
@@ -6,6 +6,7 @@
 #include <iterator>
 
 #include "common/make_unique_for_overwrite.h"
+#include "common/memory_accounting.h"
 
 namespace Common {
 
@@ -35,14 +36,19 @@ public:
 
     explicit ScratchBuffer(size_type initial_capacity)
         : last_requested_size{initial_capacity}, buffer_capacity{initial_capacity},
-          buffer{Common::make_unique_for_overwrite<T[]>(initial_capacity)} {}
+          buffer{Common::make_unique_for_overwrite<T[]>(initial_capacity)} {
+        Account(static_cast<s64>(initial_capacity));
+    }
 
-    ~ScratchBuffer() = default;
+    ~ScratchBuffer() {
+        Account(-static_cast<s64>(buffer_capacity));
+    }
     ScratchBuffer(const ScratchBuffer&) = delete;
     ScratchBuffer& operator=(const ScratchBuffer&) = delete;
 
     ScratchBuffer(ScratchBuffer&& other) noexcept {
         swap(other);
+        Account(-static_cast<s64>(other.buffer_capacity));
         other.last_requested_size = 0;
         other.buffer_capacity = 0;
         other.buffer.reset();
@@ -50,6 +56,7 @@ public:
 
     ScratchBuffer& operator=(ScratchBuffer&& other) noexcept {
         swap(other);
+        Account(-static_cast<s64>(other.buffer_capacity));
         other.last_requested_size = 0;
         other.buffer_capacity = 0;
         other.buffer.reset();
@@ -63,6 +70,7 @@ public:
             auto new_buffer = Common::make_unique_for_overwrite<T[]>(size);
             std::move(buffer.get(), buffer.get() + buffer_capacity, new_buffer.get());
             buffer = std::move(new_buffer);
+            Account(static_cast<s64>(size - buffer_capacity));
             buffer_capacity = size;
         }
         last_requested_size = size;
@@ -72,6 +80,7 @@ public:
     /// The previously held data will be destroyed if a reallocation occurs.
     void resize_destructive(size_type size) {
         if (size > buffer_capacity) {
+            Account(static_cast<s64>(size - buffer_capacity));
             buffer_capacity = size;
             buffer = Common::make_unique_for_overwrite<T[]>(buffer_capacity);
         }
@@ -125,6 +134,13 @@ public:
     }
 
 private:
+    static void Account(s64 num_elements) {
+        if (num_elements != 0) {
+            MemoryAccounting::Add(MemoryAccounting::Category::ScratchBuffers,
+                                  num_elements * static_cast<s64>(sizeof(T)));
+        }
+    }
+
     size_type last_requested_size{};
     size_type buffer_capacity{};
     std::unique_ptr<T[]> buffer{};
@@ -10,8 +10,10 @@
 #endif
 #include <compare>
 #include <cstddef>
+#include <deque>
 #include <filesystem>
 #include <functional>
+#include <mutex>
 #include <string_view>
 #include <type_traits>
 #include <fmt/core.h>
@@ -52,6 +54,7 @@ SWITCHABLE(Region, true);
 SWITCHABLE(RendererBackend, true);
 SWITCHABLE(ScalingFilter, false);
 SWITCHABLE(ShaderBackend, true);
+SWITCHABLE(TextureEvictionPolicy, true);
 SWITCHABLE(TimeZone, true);
 SETTING(VSyncMode, true);
 SWITCHABLE(bool, false);
@@ -136,17 +139,46 @@ void LogSettings() {
     log_path("DataStorage_SDMCDir", Common::FS::GetYuzuPath(Common::FS::YuzuPath::SDMCDir));
 }
 
+static constexpr HotSettings default_hot_settings{};
+
+namespace detail {
+std::atomic<const HotSettings*> hot_settings{&default_hot_settings};
+} // namespace detail
+
+static std::mutex hot_settings_mutex;
+// Snapshots are never freed, readers may still hold the ones published before
+static std::deque<HotSettings> published_hot_settings;
+
+void UpdateHotSettings() {
+    const HotSettings snapshot{
+        .gpu_accuracy = values.gpu_accuracy.GetValue(),
+        .use_reactive_flushing = values.use_reactive_flushing.GetValue(),
+        .use_readback_prediction = values.use_readback_prediction.GetValue(),
+        .speculative_query_results = values.speculative_query_results.GetValue(),
+        .barrier_feedback_loops = values.barrier_feedback_loops.GetValue(),
+    };
+    if (GetHotSettings() == snapshot) {
+        return;
+    }
+    std::scoped_lock lk{hot_settings_mutex};
+    if (GetHotSettings() == snapshot) {
+        return;
+    }
+    detail::hot_settings.store(&published_hot_settings.emplace_back(snapshot),
+                               std::memory_order_release);
+}
+
 void UpdateGPUAccuracy() {
-    values.current_gpu_accuracy = values.gpu_accuracy.GetValue();
+    UpdateHotSettings();
 }
 
 bool IsGPULevelExtreme() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme;
+    return GetHotSettings().gpu_accuracy == GpuAccuracy::Extreme;
 }
 
 bool IsGPULevelHigh() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme ||
-           values.current_gpu_accuracy == GpuAccuracy::High;
+    const GpuAccuracy gpu_accuracy = GetHotSettings().gpu_accuracy;
+    return gpu_accuracy == GpuAccuracy::Extreme || gpu_accuracy == GpuAccuracy::High;
 }
 
 bool IsFastmemEnabled() {
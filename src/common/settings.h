@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -74,6 +75,7 @@ SWITCHABLE(Region, true);
 SWITCHABLE(RendererBackend, true);
 SWITCHABLE(ScalingFilter, false);
 SWITCHABLE(ShaderBackend, true);
+SWITCHABLE(TextureEvictionPolicy, true);
 SWITCHABLE(TimeZone, true);
 SETTING(VSyncMode, true);
 SWITCHABLE(bool, false);
@@ -155,6 +157,7 @@ struct Values {
                                        true};
     Setting<bool, false> audio_muted{
         linkage, false, "audio_muted", Category::Audio, Specialization::Default, true, true};
+    Setting<bool> audio_time_stretching{linkage, false, "audio_time_stretching", Category::Audio};
     Setting<bool, false> dump_audio_commands{
         linkage, false, "dump_audio_commands", Category::Audio, Specialization::Default, false};
 
@@ -178,6 +181,14 @@ struct Values {
                                              true,
                                              true,
                                              &use_speed_limit};
+    // Host memory in MiB the caches may hold with the guest memory before collecting garbage
+    // early, 0 uses three quarters of the physical memory
+    Setting<u32, true> memory_budget{
+        linkage, 0, 0, 65536, "memory_budget", Category::Core, Specialization::Countable, true,
+        true};
+    // Records the guest code translated by dynarmic, and translates it again in the background
+    // on the next boot of the application
+    Setting<bool> use_jit_block_profile{linkage, false, "use_jit_block_profile", Category::Core};
 
     // Cpu
     SwitchableSetting<CpuBackend, true> cpu_backend{linkage,
@@ -244,6 +255,8 @@ struct Values {
 
     SwitchableSetting<bool> use_disk_shader_cache{linkage, true, "use_disk_shader_cache",
                                                   Category::Renderer};
+    SwitchableSetting<bool> use_disk_texture_cache{linkage, false, "use_disk_texture_cache",
+                                                   Category::RendererAdvanced};
     SwitchableSetting<bool> use_asynchronous_gpu_emulation{
         linkage, true, "use_asynchronous_gpu_emulation", Category::Renderer};
     SwitchableSetting<AstcDecodeMode, true> accelerate_astc{linkage,
@@ -290,6 +303,15 @@ struct Values {
     ResolutionScalingInfo resolution_info{};
     SwitchableSetting<ResolutionSetup> resolution_setup{linkage, ResolutionSetup::Res1X,
                                                         "resolution_setup", Category::Renderer};
+    SwitchableSetting<bool> dynamic_resolution{linkage, false, "dynamic_resolution",
+                                               Category::Renderer};
+    SwitchableSetting<u16, true> dynamic_resolution_target_fps{linkage,
+                                                               30,
+                                                               20,
+                                                               120,
+                                                               "dynamic_resolution_target_fps",
+                                                               Category::Renderer,
+                                                               Specialization::Countable};
     SwitchableSetting<ScalingFilter> scaling_filter{linkage,
                                                     ScalingFilter::Bilinear,
                                                     "scaling_filter",
@@ -335,7 +357,6 @@ struct Values {
                                                       Specialization::Default,
                                                       true,
                                                       true};
-    GpuAccuracy current_gpu_accuracy{GpuAccuracy::High};
     SwitchableSetting<AnisotropyMode, true> max_anisotropy{linkage,
 #ifdef ANDROID
                                                            AnisotropyMode::Default,
@@ -359,8 +380,23 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> low_latency_presentation{linkage, false, "low_latency_presentation",
+                                                     Category::RendererAdvanced};
+    SwitchableSetting<bool> vsync_follows_present{linkage, false, "vsync_follows_present",
+                                                  Category::RendererAdvanced};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
+    // Percentage of each frame the GPU has to be busy for force_max_clock to run its keep alive
+    // work, 0 always runs it. Needs GPU timestamps and is ignored on Android
+    SwitchableSetting<u8, true> force_max_clock_load{linkage,
+                                                     0,
+                                                     0,
+                                                     100,
+                                                     "force_max_clock_load",
+                                                     Category::RendererAdvanced,
+                                                     Specialization::Percentage};
+    SwitchableSetting<bool> vulkan_parallel_recording{linkage, false, "vulkan_parallel_recording",
+                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
 #ifdef ANDROID
                                                   false,
@@ -369,6 +405,10 @@ struct Values {
 #endif
                                                   "use_reactive_flushing",
                                                   Category::RendererAdvanced};
+    SwitchableSetting<bool> use_readback_prediction{linkage, false, "use_readback_prediction",
+                                                    Category::RendererAdvanced};
+    SwitchableSetting<bool> speculative_query_results{linkage, false, "speculative_query_results",
+                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_asynchronous_shaders{linkage, false, "use_asynchronous_shaders",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_fast_gpu_time{
@@ -387,6 +427,15 @@ struct Values {
                                                 Category::RendererAdvanced};
     SwitchableSetting<bool> barrier_feedback_loops{linkage, true, "barrier_feedback_loops",
                                                    Category::RendererAdvanced};
+    SwitchableSetting<bool> use_sparse_textures{linkage, false, "use_sparse_textures",
+                                                Category::RendererAdvanced};
+    SwitchableSetting<TextureEvictionPolicy, true> texture_eviction_policy{
+        linkage,
+        TextureEvictionPolicy::Lru,
+        TextureEvictionPolicy::Lru,
+        TextureEvictionPolicy::CostModel,
+        "texture_eviction_policy",
+        Category::RendererAdvanced};
 
     Setting<bool> renderer_debug{linkage, false, "debug", Category::RendererDebug};
     Setting<bool> renderer_shader_feedback{linkage, false, "shader_feedback",
@@ -469,6 +518,7 @@ struct Values {
     Setting<bool> controller_navigation{linkage, true, "controller_navigation", Category::Controls};
     Setting<bool> enable_joycon_driver{linkage, true, "enable_joycon_driver", Category::Controls};
     Setting<bool> enable_procon_driver{linkage, false, "enable_procon_driver", Category::Controls};
+    Setting<bool> low_latency_input{linkage, true, "low_latency_input", Category::Controls};
 
     SwitchableSetting<bool> vibration_enabled{linkage, true, "vibration_enabled",
                                               Category::Controls};
@@ -534,11 +584,17 @@ struct Values {
                                         Category::DataStorage};
     Setting<std::string> gamecard_path{linkage, std::string(), "gamecard_path",
                                        Category::DataStorage};
+    // Size in MiB of the cache of decrypted NCA blocks, 0 disables it
+    Setting<u32, true> romfs_cache_size{linkage, 256, 0, 4096, "romfs_cache_size",
+                                        Category::DataStorage};
 
     // Debugging
     bool record_frame_times;
     Setting<bool> use_gdbstub{linkage, false, "use_gdbstub", Category::Debugging};
     Setting<u16> gdbstub_port{linkage, 6543, "gdbstub_port", Category::Debugging};
+    Setting<bool> enable_metrics_server{linkage, false, "enable_metrics_server",
+                                        Category::Debugging};
+    Setting<u16> metrics_server_port{linkage, 9473, "metrics_server_port", Category::Debugging};
     Setting<std::string> program_args{linkage, std::string(), "program_args", Category::Debugging};
     Setting<bool> dump_exefs{linkage, false, "dump_exefs", Category::Debugging};
     Setting<bool> dump_nso{linkage, false, "dump_nso", Category::Debugging};
@@ -548,6 +604,7 @@ struct Values {
     Setting<bool> dump_macros{
         linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
+    Setting<bool> capture_trace{linkage, false, "capture_trace", Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
     Setting<bool> quest_flag{linkage, false, "quest_flag", Category::Debugging};
@@ -555,9 +612,23 @@ struct Values {
                                     Category::DebuggingGraphics};
     Setting<bool> disable_macro_hle{linkage, false, "disable_macro_hle",
                                     Category::DebuggingGraphics};
+    Setting<bool> profile_macros{linkage, false, "profile_macros", Category::DebuggingGraphics,
+                                 Specialization::Default, false};
+    Setting<bool> profile_gpu_passes{linkage, false, "profile_gpu_passes",
+                                     Category::DebuggingGraphics, Specialization::Default, false};
+    Setting<bool> null_renderer_caches{linkage, false, "null_renderer_caches",
+                                       Category::DebuggingGraphics, Specialization::Default,
+                                       false};
     Setting<bool> extended_logging{
         linkage, false, "extended_logging", Category::Debugging, Specialization::Default, false};
     Setting<bool> use_debug_asserts{linkage, false, "use_debug_asserts", Category::Debugging};
+    Setting<bool> profile_svcs{linkage, false, "profile_svcs", Category::Debugging,
+                               Specialization::Default, false};
+    Setting<bool> profile_guest{linkage, false, "profile_guest", Category::Debugging,
+                                Specialization::Default, false};
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Debugging};
+    Setting<bool> profile_tlb_misses{linkage, false, "profile_tlb_misses", Category::Debugging,
+                                     Specialization::Default, false};
     Setting<bool> use_auto_stub{
         linkage, false, "use_auto_stub", Category::Debugging, Specialization::Default, false};
     Setting<bool> enable_all_controllers{linkage, false, "enable_all_controllers",
@@ -586,6 +657,34 @@ struct Values {
 
 extern Values values;
 
+/// Settings read on hot paths, copied into plain fields. The snapshot is immutable once published,
+/// so a reader sees the settings of a single configuration without checking their global state.
+struct HotSettings {
+    GpuAccuracy gpu_accuracy{GpuAccuracy::High};
+#ifdef ANDROID
+    bool use_reactive_flushing{false};
+#else
+    bool use_reactive_flushing{true};
+#endif
+    bool use_readback_prediction{false};
+    bool speculative_query_results{false};
+    bool barrier_feedback_loops{true};
+
+    bool operator==(const HotSettings&) const = default;
+};
+
+namespace detail {
+extern std::atomic<const HotSettings*> hot_settings;
+} // namespace detail
+
+/// Returns the last published snapshot of the hot settings
+inline const HotSettings& GetHotSettings() {
+    return *detail::hot_settings.load(std::memory_order_acquire);
+}
+
+/// Publishes a new snapshot of the hot settings when any of them changed
+void UpdateHotSettings();
+
 void UpdateGPUAccuracy();
 bool IsGPULevelExtreme();
 bool IsGPULevelHigh();
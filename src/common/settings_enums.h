@@ -120,6 +120,8 @@ ENUM(AstcDecodeMode, Cpu, Gpu, CpuAsynchronous);
 
 ENUM(AstcRecompression, Uncompressed, Bc1, Bc3);
 
+ENUM(TextureEvictionPolicy, Lru, CostModel);
+
 ENUM(VSyncMode, Immediate, Mailbox, Fifo, FifoRelaxed);
 
 ENUM(RendererBackend, OpenGL, Vulkan, Null);
@@ -2,11 +2,18 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <string>
+#ifdef __ANDROID__
+#include <fstream>
+#include <mutex>
+#include <fmt/format.h>
+#endif
 
 #include "common/error.h"
 #include "common/logging/log.h"
 #include "common/thread.h"
+#include "common/trace_recorder.h"
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined(_WIN32)
@@ -80,10 +87,103 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
 
 #endif
 
+#ifdef __ANDROID__
+
+namespace {
+
+struct CoreLayout {
+    cpu_set_t performance;
+    cpu_set_t efficiency;
+    bool is_heterogeneous = false;
+};
+
+std::string FormatCores(const cpu_set_t& set) {
+    std::string result;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) {
+            result += result.empty() ? fmt::format("{}", cpu) : fmt::format(",{}", cpu);
+        }
+    }
+    return result;
+}
+
+CoreLayout DetectCoreLayout() {
+    CoreLayout layout{};
+    CPU_ZERO(&layout.performance);
+    CPU_ZERO(&layout.efficiency);
+
+    // Efficiency cores are the ones with the lowest maximum frequency, anything faster (prime
+    // and performance clusters) is used for latency critical threads.
+    std::vector<std::pair<int, u64>> max_frequencies;
+    const long num_cpus = std::min<long>(sysconf(_SC_NPROCESSORS_CONF), CPU_SETSIZE);
+    for (int cpu = 0; cpu < num_cpus; ++cpu) {
+        std::ifstream file{
+            fmt::format("/sys/devices/system/cpu/cpu{}/cpufreq/cpuinfo_max_freq", cpu)};
+        u64 frequency{};
+        if (file >> frequency) {
+            max_frequencies.emplace_back(cpu, frequency);
+        }
+    }
+    if (max_frequencies.empty()) {
+        LOG_INFO(Common, "Core frequencies are not available, thread placement is disabled");
+        return layout;
+    }
+    const u64 lowest_frequency =
+        std::ranges::min_element(max_frequencies, {}, &std::pair<int, u64>::second)->second;
+    for (const auto& [cpu, frequency] : max_frequencies) {
+        CPU_SET(cpu, frequency == lowest_frequency ? &layout.efficiency : &layout.performance);
+    }
+    layout.is_heterogeneous = CPU_COUNT(&layout.performance) > 0;
+    if (layout.is_heterogeneous) {
+        LOG_INFO(Common, "Thread placement: performance cores {}, efficiency cores {}",
+                 FormatCores(layout.performance), FormatCores(layout.efficiency));
+    } else {
+        LOG_INFO(Common, "All cores run at the same frequency, thread placement is disabled");
+    }
+    return layout;
+}
+
+std::mutex performance_threads_mutex;
+std::vector<s32> performance_threads;
+
+} // Anonymous namespace
+
+void SetCurrentThreadCoreClass(ThreadCoreClass core_class) {
+    static const CoreLayout layout = DetectCoreLayout();
+    if (core_class == ThreadCoreClass::Performance) {
+        std::scoped_lock lock{performance_threads_mutex};
+        performance_threads.push_back(gettid());
+    }
+    if (core_class == ThreadCoreClass::Any || !layout.is_heterogeneous) {
+        return;
+    }
+    const cpu_set_t& set =
+        core_class == ThreadCoreClass::Performance ? layout.performance : layout.efficiency;
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        LOG_WARNING(Common, "Failed to set thread affinity: {}", GetLastErrorMsg());
+    }
+}
+
+std::vector<s32> GetPerformanceThreadIds() {
+    std::scoped_lock lock{performance_threads_mutex};
+    return performance_threads;
+}
+
+#else
+
+void SetCurrentThreadCoreClass(ThreadCoreClass core_class) {}
+
+std::vector<s32> GetPerformanceThreadIds() {
+    return {};
+}
+
+#endif
+
 #ifdef _MSC_VER
 
 // Sets the debugger-visible name of the current thread.
 void SetCurrentThreadName(const char* name) {
+    Trace::SetCurrentThreadName(name);
     SetThreadDescription(GetCurrentThread(), UTF8ToUTF16W(name).data());
 }
 
@@ -92,6 +192,7 @@ void SetCurrentThreadName(const char* name) {
 // MinGW with the POSIX threading model does not support pthread_setname_np
 #if !defined(_WIN32) || defined(_MSC_VER)
 void SetCurrentThreadName(const char* name) {
+    Trace::SetCurrentThreadName(name);
 #ifdef __APPLE__
     pthread_setname_np(name);
 #elif defined(__Bitrig__) || defined(__DragonFly__) || defined(__FreeBSD__) || defined(__OpenBSD__)
@@ -114,7 +215,8 @@ void SetCurrentThreadName(const char* name) {
 
 #if defined(_WIN32)
 void SetCurrentThreadName(const char* name) {
-    // Do Nothing on MingW
+    Trace::SetCurrentThreadName(name);
+    // Do Nothing else on MingW
 }
 #endif
 
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <mutex>
 #include <thread>
+#include <vector>
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 
@@ -102,8 +103,23 @@ enum class ThreadPriority : u32 {
     Critical = 4,
 };
 
+/// Cores a thread is placed on when the host mixes cores of different performance
+enum class ThreadCoreClass : u32 {
+    Any,         ///< Left to the OS scheduler
+    Performance, ///< Latency critical threads, kept off the efficiency cores
+    Efficiency,  ///< Background workers, kept off the cores used by the emulated system
+};
+
 void SetCurrentThreadPriority(ThreadPriority new_priority);
 
+/// Restricts the current thread to the cores of a class. Only applied on Android, where the
+/// topology is read from the maximum frequency of each core; does nothing on other hosts.
+void SetCurrentThreadCoreClass(ThreadCoreClass core_class);
+
+/// Returns the host ids of the threads that asked for performance cores, including the ones that
+/// have exited since. Only tracked on Android, empty on other hosts.
+std::vector<s32> GetPerformanceThreadIds();
+
 void SetCurrentThreadName(const char* name);
 
 } // namespace Common
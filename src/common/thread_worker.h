@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -34,32 +35,43 @@ class StatefulThreadWorker {
     using StateMaker = std::conditional_t<with_state, std::function<StateType()>, DummyCallable>;
 
 public:
-    explicit StatefulThreadWorker(size_t num_workers, std::string name, StateMaker func = {})
-        : workers_queued{num_workers}, thread_name{std::move(name)} {
-        const auto lambda = [this, func](std::stop_token stop_token) {
+    explicit StatefulThreadWorker(size_t num_workers, std::string name, StateMaker func = {},
+                                  ThreadCoreClass core_class = ThreadCoreClass::Any)
+        : max_active_workers{num_workers}, workers_queued{num_workers},
+          thread_name{std::move(name)} {
+        const auto lambda = [this, func, core_class](std::stop_token stop_token) {
             Common::SetCurrentThreadName(thread_name.c_str());
+            Common::SetCurrentThreadCoreClass(core_class);
             {
                 [[maybe_unused]] std::conditional_t<with_state, StateType, int> state{func()};
                 while (!stop_token.stop_requested()) {
                     Task task;
                     {
                         std::unique_lock lock{queue_mutex};
-                        if (requests.empty()) {
+                        if (!HasRequests()) {
                             wait_condition.notify_all();
                         }
-                        Common::CondvarWait(condition, lock, stop_token,
-                                            [this] { return !requests.empty(); });
+                        Common::CondvarWait(condition, lock, stop_token, [this] {
+                            return HasRequests() && active_workers < max_active_workers;
+                        });
                         if (stop_token.stop_requested()) {
                             break;
                         }
-                        task = std::move(requests.front());
-                        requests.pop();
+                        auto& queue = priority_requests.empty() ? requests : priority_requests;
+                        task = std::move(queue.front());
+                        queue.pop();
+                        ++active_workers;
                     }
                     if constexpr (with_state) {
                         task(&state);
                     } else {
                         task();
                     }
+                    {
+                        std::scoped_lock lock{queue_mutex};
+                        --active_workers;
+                    }
+                    condition.notify_one();
                     ++work_done;
                 }
             }
@@ -78,6 +90,10 @@ public:
     StatefulThreadWorker& operator=(StatefulThreadWorker&&) = delete;
     StatefulThreadWorker(StatefulThreadWorker&&) = delete;
 
+    [[nodiscard]] size_t NumWorkers() const noexcept {
+        return threads.size();
+    }
+
     void QueueWork(Task work) {
         {
             std::unique_lock lock{queue_mutex};
@@ -87,6 +103,30 @@ public:
         condition.notify_one();
     }
 
+    /// Queues work that runs before any work queued with QueueWork that has not started yet
+    void QueuePriorityWork(Task work) {
+        {
+            std::unique_lock lock{queue_mutex};
+            priority_requests.emplace(std::move(work));
+            ++work_scheduled;
+        }
+        condition.notify_one();
+    }
+
+    /// Limits how many workers can run tasks at the same time, clamped to [1, NumWorkers()]
+    void SetMaxActiveWorkers(size_t num_workers) {
+        {
+            std::unique_lock lock{queue_mutex};
+            max_active_workers = std::clamp<size_t>(num_workers, 1, threads.size());
+        }
+        condition.notify_all();
+    }
+
+    [[nodiscard]] size_t MaxActiveWorkers() {
+        std::unique_lock lock{queue_mutex};
+        return max_active_workers;
+    }
+
     void WaitForRequests(std::stop_token stop_token = {}) {
         std::stop_callback callback(stop_token, [this] {
             for (auto& thread : threads) {
@@ -100,7 +140,14 @@ public:
     }
 
 private:
+    bool HasRequests() const noexcept {
+        return !requests.empty() || !priority_requests.empty();
+    }
+
     std::queue<Task> requests;
+    std::queue<Task> priority_requests;
+    size_t active_workers{};
+    size_t max_active_workers{};
     std::mutex queue_mutex;
     std::condition_variable_any condition;
     std::condition_variable wait_condition;
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/tlb_miss_counter.h"
+
+namespace Common {
+
+#ifdef __linux__
+
+namespace {
+
+int OpenCounter(u64 cache_id) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = cache_id | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // Count the calling thread on any CPU.
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+u64 ReadCounter(int fd) {
+    u64 value = 0;
+    if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value)) {
+        return 0;
+    }
+    return value;
+}
+
+} // Anonymous namespace
+
+TlbMissCounter::TlbMissCounter()
+    : data_fd{OpenCounter(PERF_COUNT_HW_CACHE_DTLB)},
+      instruction_fd{OpenCounter(PERF_COUNT_HW_CACHE_ITLB)} {}
+
+TlbMissCounter::~TlbMissCounter() {
+    if (data_fd >= 0) {
+        close(data_fd);
+    }
+    if (instruction_fd >= 0) {
+        close(instruction_fd);
+    }
+}
+
+TlbMissCounter::Counts TlbMissCounter::Read() const {
+    return {
+        .data_misses = ReadCounter(data_fd),
+        .instruction_misses = ReadCounter(instruction_fd),
+    };
+}
+
+#else
+
+TlbMissCounter::TlbMissCounter() = default;
+
+TlbMissCounter::~TlbMissCounter() = default;
+
+TlbMissCounter::Counts TlbMissCounter::Read() const {
+    return {};
+}
+
+#endif
+
+} // namespace Common
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Counts the data and instruction TLB misses of the calling thread with the host performance
+ * counters. Only supported on Linux, and only when perf events are allowed for the process.
+ */
+class TlbMissCounter {
+public:
+    struct Counts {
+        u64 data_misses;
+        u64 instruction_misses;
+    };
+
+    /// Starts counting for the calling thread
+    TlbMissCounter();
+    ~TlbMissCounter();
+
+    TlbMissCounter(const TlbMissCounter&) = delete;
+    TlbMissCounter& operator=(const TlbMissCounter&) = delete;
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return data_fd >= 0 || instruction_fd >= 0;
+    }
+
+    /// Returns the misses counted since the counter was created
+    [[nodiscard]] Counts Read() const;
+
+private:
+    int data_fd = -1;
+    int instruction_fd = -1;
+};
+
+} // namespace Common
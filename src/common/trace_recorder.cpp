@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/trace_recorder.h"
+
+namespace Common::Trace {
+
+namespace detail {
+std::atomic_bool capturing{false};
+} // namespace detail
+
+namespace {
+/// Most scopes recorded per thread, later ones are dropped to bound the memory used
+constexpr size_t MaxEventsPerThread = 1 << 18;
+
+/// Size the trace is built up to before it is written to the file
+constexpr size_t WriteChunkSize = 1 << 20;
+
+struct Event {
+    u64 token;
+    s64 begin;
+    s64 end;
+};
+
+struct ThreadEvents {
+    std::mutex mutex;
+    u32 id{};
+    std::string name;
+    std::vector<Event> events;
+    size_t dropped_events{};
+};
+
+std::mutex threads_mutex;
+std::vector<std::shared_ptr<ThreadEvents>> threads;
+std::filesystem::path capture_path;
+
+thread_local std::shared_ptr<ThreadEvents> current_thread;
+thread_local std::string current_thread_name;
+
+const std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
+
+ThreadEvents& GetCurrentThreadEvents() {
+    if (!current_thread) {
+        std::scoped_lock lk{threads_mutex};
+        current_thread = std::make_shared<ThreadEvents>();
+        current_thread->id = static_cast<u32>(threads.size() + 1);
+        current_thread->name = current_thread_name.empty()
+                                   ? fmt::format("Thread {}", current_thread->id)
+                                   : current_thread_name;
+        threads.push_back(current_thread);
+    }
+    return *current_thread;
+}
+
+/// Appends a string to the trace as a JSON string literal
+void AppendJsonString(std::string& out, std::string_view string) {
+    out += '"';
+    for (const char c : string) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+void AppendTimerName(std::string& out, u64 token) {
+#if MICROPROFILE_ENABLED
+    MicroProfile* profile{MicroProfileGet()};
+    const u16 timer_index{MicroProfileGetTimerIndex(token)};
+    const auto& group{profile->GroupInfo[profile->TimerToGroup[timer_index]]};
+    out += "\"name\":";
+    AppendJsonString(out, profile->TimerInfo[timer_index].pName);
+    out += ",\"cat\":";
+    AppendJsonString(out, group.pName);
+#else
+    out += fmt::format("\"name\":\"{}\"", token);
+#endif
+}
+} // Anonymous namespace
+
+void StartCapture(const std::filesystem::path& path) {
+    std::scoped_lock lk{threads_mutex};
+    for (const auto& thread : threads) {
+        std::scoped_lock thread_lk{thread->mutex};
+        thread->events.clear();
+        thread->dropped_events = 0;
+    }
+    capture_path = path;
+    detail::capturing.store(true, std::memory_order_relaxed);
+    LOG_INFO(Common, "Capturing a trace to {}", path.string());
+}
+
+void StopCapture() {
+    if (!detail::capturing.exchange(false, std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::scoped_lock lk{threads_mutex};
+    FS::IOFile file{capture_path, FS::FileAccessMode::Write, FS::FileType::TextFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common, "Could not open the trace file {}", capture_path.string());
+        return;
+    }
+
+    std::string out{"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["};
+    bool first_event{true};
+    const auto begin_event{[&] {
+        if (!first_event) {
+            out += ',';
+        }
+        first_event = false;
+        if (out.size() >= WriteChunkSize) {
+            static_cast<void>(file.WriteString(out));
+            out.clear();
+        }
+    }};
+
+    size_t event_count{};
+    for (const auto& thread : threads) {
+        std::scoped_lock thread_lk{thread->mutex};
+        begin_event();
+        out += fmt::format("{{\"ph\":\"M\",\"pid\":1,\"tid\":{},\"name\":\"thread_name\","
+                           "\"args\":{{\"name\":",
+                           thread->id);
+        AppendJsonString(out, thread->name);
+        out += "}}";
+
+        for (const auto& event : thread->events) {
+            begin_event();
+            out += fmt::format("{{\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},",
+                               thread->id, static_cast<f64>(event.begin) / 1000.0,
+                               static_cast<f64>(event.end - event.begin) / 1000.0);
+            AppendTimerName(out, event.token);
+            out += '}';
+        }
+        if (thread->dropped_events != 0) {
+            LOG_WARNING(Common, "Dropped {} scopes of thread {} from the trace",
+                        thread->dropped_events, thread->name);
+        }
+        event_count += thread->events.size();
+        thread->events.clear();
+        thread->events.shrink_to_fit();
+    }
+    out += "]}\n";
+    static_cast<void>(file.WriteString(out));
+
+    LOG_INFO(Common, "Wrote {} scopes to the trace file {}", event_count, capture_path.string());
+}
+
+s64 GetTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                time_origin)
+        .count();
+}
+
+void RecordScope(u64 token, s64 begin, s64 end) {
+    ThreadEvents& thread{GetCurrentThreadEvents()};
+    std::scoped_lock lk{thread.mutex};
+    if (thread.events.size() == MaxEventsPerThread) {
+        thread.dropped_events++;
+        return;
+    }
+    thread.events.push_back({token, begin, end});
+}
+
+void SetCurrentThreadName(const char* name) {
+    current_thread_name = name;
+    if (current_thread) {
+        std::scoped_lock lk{current_thread->mutex};
+        current_thread->name = current_thread_name;
+    }
+}
+
+} // namespace Common::Trace
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+
+#include "common/common_types.h"
+
+/**
+ * Records the MicroProfile scopes of every thread to a trace file, for sessions where the
+ * MicroProfile UI is not available (headless and Android builds) or that are analyzed offline.
+ *
+ * Traces are written in the Chrome trace event JSON format, which the Perfetto UI and
+ * chrome://tracing load directly. Scopes are recorded by the MICROPROFILE_SCOPE macros of
+ * common/microprofile.h, threads are named by Common::SetCurrentThreadName.
+ *
+ * Only host threads get a track. Guest threads run as fibers on the emulated core threads, so
+ * their scopes appear on the track of the core that ran them. GPU work is not traced either: its
+ * timestamps are in the clock domain of the device and MicroProfile GPU timers are disabled.
+ */
+namespace Common::Trace {
+
+namespace detail {
+extern std::atomic_bool capturing;
+} // namespace detail
+
+/// Starts recording scopes, dropping those of a previous capture that was not written
+void StartCapture(const std::filesystem::path& path);
+
+/// Stops recording scopes and writes them to the path given to StartCapture
+void StopCapture();
+
+/// Returns true while scopes are recorded
+inline bool IsCapturing() {
+    return detail::capturing.load(std::memory_order_relaxed);
+}
+
+/// Returns the current time in the timebase of the recorded scopes, in nanoseconds
+s64 GetTimestamp();
+
+/// Records a scope of a MicroProfile timer that ran on the calling thread
+void RecordScope(u64 token, s64 begin, s64 end);
+
+/// Names the calling thread in the trace
+void SetCurrentThreadName(const char* name);
+
+} // namespace Common::Trace
@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace Common {
@@ -11,51 +15,117 @@ namespace Common {
 /// General purpose function wrapper similar to std::function.
 /// Unlike std::function, the captured values don't have to be copyable.
 /// This class can be moved but not copied.
+/// Callables of up to INLINE_SIZE bytes that can be moved without throwing are stored inline,
+/// larger ones are allocated on the heap.
 template <typename ResultType, typename... Args>
 class UniqueFunction {
-    class CallableBase {
-    public:
-        virtual ~CallableBase() = default;
-        virtual ResultType operator()(Args&&...) = 0;
+public:
+    static constexpr std::size_t INLINE_SIZE = 48;
+
+private:
+    struct Operations {
+        ResultType (*invoke)(void* storage, Args&&... args);
+        /// Moves the callable to uninitialized storage, destroying the source
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
     };
 
     template <typename Functor>
-    class Callable final : public CallableBase {
-    public:
-        Callable(Functor&& functor_) : functor{std::move(functor_)} {}
-        ~Callable() override = default;
+    static constexpr bool IS_INLINE = sizeof(Functor) <= INLINE_SIZE &&
+                                      alignof(Functor) <= alignof(std::max_align_t) &&
+                                      std::is_nothrow_move_constructible_v<Functor>;
 
-        ResultType operator()(Args&&... args) override {
-            return functor(std::forward<Args>(args)...);
+    template <typename Functor>
+    static Functor* GetFunctor(void* storage) noexcept {
+        if constexpr (IS_INLINE<Functor>) {
+            return std::launder(static_cast<Functor*>(storage));
+        } else {
+            return *std::launder(static_cast<Functor**>(storage));
         }
+    }
 
-    private:
-        Functor functor;
+    template <typename Functor>
+    static constexpr Operations OPERATIONS{
+        .invoke = [](void* storage, Args&&... args) -> ResultType {
+            return (*GetFunctor<Functor>(storage))(std::forward<Args>(args)...);
+        },
+        .relocate = [](void* dst, void* src) noexcept {
+            if constexpr (IS_INLINE<Functor>) {
+                Functor* const functor = GetFunctor<Functor>(src);
+                ::new (dst) Functor(std::move(*functor));
+                std::destroy_at(functor);
+            } else {
+                ::new (dst) Functor*(GetFunctor<Functor>(src));
+            }
+        },
+        .destroy = [](void* storage) noexcept {
+            if constexpr (IS_INLINE<Functor>) {
+                std::destroy_at(GetFunctor<Functor>(storage));
+            } else {
+                delete GetFunctor<Functor>(storage);
+            }
+        },
     };
 
 public:
     UniqueFunction() = default;
 
     template <typename Functor>
-    UniqueFunction(Functor&& functor)
-        : callable{std::make_unique<Callable<Functor>>(std::move(functor))} {}
+        requires(!std::is_same_v<std::remove_cvref_t<Functor>, UniqueFunction>)
+    UniqueFunction(Functor&& functor) {
+        using Type = std::remove_cvref_t<Functor>;
+        if constexpr (IS_INLINE<Type>) {
+            ::new (storage.data()) Type(std::forward<Functor>(functor));
+        } else {
+            ::new (storage.data()) Type*(new Type(std::forward<Functor>(functor)));
+        }
+        operations = &OPERATIONS<Type>;
+    }
+
+    ~UniqueFunction() {
+        Reset();
+    }
 
-    UniqueFunction& operator=(UniqueFunction&& rhs) noexcept = default;
-    UniqueFunction(UniqueFunction&& rhs) noexcept = default;
+    UniqueFunction& operator=(UniqueFunction&& rhs) noexcept {
+        if (this != &rhs) {
+            Reset();
+            MoveFrom(rhs);
+        }
+        return *this;
+    }
+
+    UniqueFunction(UniqueFunction&& rhs) noexcept {
+        MoveFrom(rhs);
+    }
 
     UniqueFunction& operator=(const UniqueFunction&) = delete;
     UniqueFunction(const UniqueFunction&) = delete;
 
     ResultType operator()(Args&&... args) const {
-        return (*callable)(std::forward<Args>(args)...);
+        return operations->invoke(storage.data(), std::forward<Args>(args)...);
     }
 
     explicit operator bool() const noexcept {
-        return static_cast<bool>(callable);
+        return operations != nullptr;
     }
 
 private:
-    std::unique_ptr<CallableBase> callable;
+    void Reset() noexcept {
+        if (operations) {
+            operations->destroy(storage.data());
+            operations = nullptr;
+        }
+    }
+
+    void MoveFrom(UniqueFunction& rhs) noexcept {
+        if (rhs.operations) {
+            rhs.operations->relocate(storage.data(), rhs.storage.data());
+            operations = std::exchange(rhs.operations, nullptr);
+        }
+    }
+
+    const Operations* operations{};
+    alignas(std::max_align_t) mutable std::array<std::byte, INLINE_SIZE> storage;
 };
 
 } // namespace Common
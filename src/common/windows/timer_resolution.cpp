@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include <windows.h>
 
 #include "common/windows/timer_resolution.h"
@@ -26,6 +28,9 @@ NTSYSAPI LONG NTAPI NtDelayExecution(BOOLEAN Alertable, PLARGE_INTEGER DelayInte
 #ifndef PROCESS_POWER_THROTTLING_IGNORE_TIMER_RESOLUTION
 #define PROCESS_POWER_THROTTLING_IGNORE_TIMER_RESOLUTION 0x4
 #endif
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x2
+#endif
 
 namespace Common::Windows {
 
@@ -72,6 +77,25 @@ void SetHighQoS() {
                           sizeof(PROCESS_POWER_THROTTLING_STATE));
 }
 
+struct HighResolutionTimer {
+    HighResolutionTimer()
+        : handle{CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                        TIMER_ALL_ACCESS)} {}
+
+    ~HighResolutionTimer() {
+        if (handle) {
+            CloseHandle(handle);
+        }
+    }
+
+    HANDLE handle;
+};
+
+HANDLE GetThreadTimer() {
+    thread_local HighResolutionTimer timer;
+    return timer.handle;
+}
+
 } // Anonymous namespace
 
 nanoseconds GetMinimumTimerResolution() {
@@ -106,4 +130,21 @@ void SleepForOneTick() {
     NtDelayExecution(FALSE, &DelayInterval);
 }
 
+bool HasHighResolutionTimer() {
+    return GetThreadTimer() != nullptr;
+}
+
+void SleepFor(nanoseconds duration) {
+    const HANDLE timer = GetThreadTimer();
+    // Negative due times are relative, in 100ns units
+    const LARGE_INTEGER due_time{
+        .QuadPart{-std::max<LONGLONG>(duration.count() / 100, 1)},
+    };
+    if (!timer || !SetWaitableTimer(timer, &due_time, 0, nullptr, nullptr, FALSE)) {
+        SleepForOneTick();
+        return;
+    }
+    WaitForSingleObject(timer, INFINITE);
+}
+
 } // namespace Common::Windows
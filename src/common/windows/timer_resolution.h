@@ -35,4 +35,15 @@ std::chrono::nanoseconds SetCurrentTimerResolutionToMaximum();
 /// Sleep for one tick of the current timer resolution.
 void SleepForOneTick();
 
+/// Returns true when the calling thread can sleep with a high resolution waitable timer.
+bool HasHighResolutionTimer();
+
+/**
+ * Sleeps for the given duration with a high resolution waitable timer, falls back to sleeping
+ * for one tick of the current timer resolution when those are not supported.
+ *
+ * @param duration Time to sleep for in nanoseconds.
+ */
+void SleepFor(std::chrono::nanoseconds duration);
+
 } // namespace Common::Windows
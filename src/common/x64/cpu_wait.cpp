@@ -25,48 +25,52 @@ constexpr auto PauseCycles = 100'000U;
 } // Anonymous namespace
 
 #ifdef _MSC_VER
-__forceinline static void TPAUSE() {
+__forceinline static void TPAUSE(u32 cycles) {
     static constexpr auto RequestC02State = 0U;
-    _tpause(RequestC02State, FencedRDTSC() + PauseCycles);
+    _tpause(RequestC02State, FencedRDTSC() + cycles);
 }
 
-__forceinline static void MWAITX() {
+__forceinline static void MWAITX(u32 cycles) {
     static constexpr auto EnableWaitTimeFlag = 1U << 1;
     static constexpr auto RequestC1State = 0U;
 
     // monitor_var should be aligned to a cache line.
     alignas(64) u64 monitor_var{};
     _mm_monitorx(&monitor_var, 0, 0);
-    _mm_mwaitx(EnableWaitTimeFlag, RequestC1State, PauseCycles);
+    _mm_mwaitx(EnableWaitTimeFlag, RequestC1State, cycles);
 }
 #else
-static void TPAUSE() {
+static void TPAUSE(u32 cycles) {
     static constexpr auto RequestC02State = 0U;
-    const auto tsc = FencedRDTSC() + PauseCycles;
+    const auto tsc = FencedRDTSC() + cycles;
     const auto eax = static_cast<u32>(tsc & 0xFFFFFFFF);
     const auto edx = static_cast<u32>(tsc >> 32);
     asm volatile("tpause %0" : : "r"(RequestC02State), "d"(edx), "a"(eax));
 }
 
-static void MWAITX() {
+static void MWAITX(u32 cycles) {
     static constexpr auto EnableWaitTimeFlag = 1U << 1;
     static constexpr auto RequestC1State = 0U;
 
     // monitor_var should be aligned to a cache line.
     alignas(64) u64 monitor_var{};
     asm volatile("monitorx" : : "a"(&monitor_var), "c"(0), "d"(0));
-    asm volatile("mwaitx" : : "a"(RequestC1State), "b"(PauseCycles), "c"(EnableWaitTimeFlag));
+    asm volatile("mwaitx" : : "a"(RequestC1State), "b"(cycles), "c"(EnableWaitTimeFlag));
 }
 #endif
 
 void MicroSleep() {
+    MicroSleep(PauseCycles);
+}
+
+void MicroSleep(u32 cycles) {
     static const bool has_waitpkg = GetCPUCaps().waitpkg;
     static const bool has_monitorx = GetCPUCaps().monitorx;
 
     if (has_waitpkg) {
-        TPAUSE();
+        TPAUSE(cycles);
     } else if (has_monitorx) {
-        MWAITX();
+        MWAITX(cycles);
     } else {
         std::this_thread::yield();
     }
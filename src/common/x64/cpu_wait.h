@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include "common/common_types.h"
+
 namespace Common::X64 {
 
 void MicroSleep();
 
+/// Pauses the core for at most the given number of TSC cycles, for spins that must stay precise
+void MicroSleep(u32 cycles);
+
 } // namespace Common::X64
@@ -44,6 +44,15 @@ enum class Architecture {
     AArch32,
 };
 
+// Guest code block translated by a recompiler, with the floating point control it was built for.
+struct TranslatedBlock {
+    u64 address;
+    u32 fpcr;
+    u32 reserved;
+
+    auto operator<=>(const TranslatedBlock&) const = default;
+};
+
 /// Generic ARMv8 CPU interface
 class ArmInterface {
 public:
@@ -72,6 +81,14 @@ public:
     // Clear a range of the instruction cache for this CPU.
     virtual void InvalidateCacheRange(u64 addr, std::size_t size) = 0;
 
+    // Translate the given guest blocks on a background thread, ahead of their first execution.
+    virtual void PrewarmBlocks(std::vector<TranslatedBlock> blocks) {}
+
+    // Get the guest blocks translated by this CPU, when they are recorded.
+    virtual std::vector<TranslatedBlock> GetRecordedBlocks() const {
+        return {};
+    }
+
     // Get the current architecture.
     // This returns AArch64 when PSTATE.nRW == 0 and AArch32 when PSTATE.nRW == 1.
     virtual Architecture GetArchitecture() const = 0;
@@ -118,8 +118,8 @@ void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>
     }
 }
 
-std::vector<BacktraceEntry> GetAArch64Backtrace(Kernel::KProcess* process,
-                                                const Kernel::Svc::ThreadContext& ctx) {
+std::vector<BacktraceEntry> WalkAArch64Frames(Kernel::KProcess* process,
+                                              const Kernel::Svc::ThreadContext& ctx) {
     std::vector<BacktraceEntry> out;
     auto& memory = process->GetMemory();
     auto pc = ctx.pc, lr = ctx.lr, fp = ctx.fp;
@@ -139,13 +139,11 @@ std::vector<BacktraceEntry> GetAArch64Backtrace(Kernel::KProcess* process,
         fp = memory.Read64(fp);
     }
 
-    SymbolicateBacktrace(process, out);
-
     return out;
 }
 
-std::vector<BacktraceEntry> GetAArch32Backtrace(Kernel::KProcess* process,
-                                                const Kernel::Svc::ThreadContext& ctx) {
+std::vector<BacktraceEntry> WalkAArch32Frames(Kernel::KProcess* process,
+                                              const Kernel::Svc::ThreadContext& ctx) {
     std::vector<BacktraceEntry> out;
     auto& memory = process->GetMemory();
     auto pc = ctx.pc, lr = ctx.lr, fp = ctx.fp;
@@ -165,8 +163,6 @@ std::vector<BacktraceEntry> GetAArch32Backtrace(Kernel::KProcess* process,
         fp = memory.Read32(fp);
     }
 
-    SymbolicateBacktrace(process, out);
-
     return out;
 }
 
@@ -339,10 +335,17 @@ void InvalidateInstructionCacheRange(const Kernel::KProcess* process, u64 addres
 
 std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
                                                     const Kernel::Svc::ThreadContext& ctx) {
+    auto out = GetUnsymbolizedBacktraceFromContext(process, ctx);
+    SymbolicateBacktrace(process, out);
+    return out;
+}
+
+std::vector<BacktraceEntry> GetUnsymbolizedBacktraceFromContext(
+    Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx) {
     if (process->Is64Bit()) {
-        return GetAArch64Backtrace(process, ctx);
+        return WalkAArch64Frames(process, ctx);
     } else {
-        return GetAArch32Backtrace(process, ctx);
+        return WalkAArch32Frames(process, ctx);
     }
 }
 
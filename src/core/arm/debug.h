@@ -32,4 +32,8 @@ std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
                                                     const Kernel::Svc::ThreadContext& ctx);
 std::vector<BacktraceEntry> GetBacktrace(const Kernel::KThread* thread);
 
+/// Walks the frame records of the context, only the original addresses of the entries are set
+std::vector<BacktraceEntry> GetUnsymbolizedBacktraceFromContext(
+    Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx);
+
 } // namespace Core
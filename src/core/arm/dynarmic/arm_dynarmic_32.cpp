@@ -67,19 +67,27 @@ public:
 
     bool MemoryWriteExclusive8(u32 vaddr, u8 value, u8 expected) override {
         return CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive8(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive8(vaddr, value, expected));
     }
     bool MemoryWriteExclusive16(u32 vaddr, u16 value, u16 expected) override {
         return CheckMemoryAccess(vaddr, 2, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive16(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive16(vaddr, value, expected));
     }
     bool MemoryWriteExclusive32(u32 vaddr, u32 value, u32 expected) override {
         return CheckMemoryAccess(vaddr, 4, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive32(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive32(vaddr, value, expected));
     }
     bool MemoryWriteExclusive64(u32 vaddr, u64 value, u64 expected) override {
         return CheckMemoryAccess(vaddr, 8, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive64(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive64(vaddr, value, expected));
+    }
+
+    /// Breaks the kernel reservations on the granule written by a guest exclusive store
+    bool OnExclusiveWrite(u32 vaddr, bool written) {
+        if (written) {
+            m_parent.m_exclusive_monitor.OnGuestExclusiveWrite(vaddr);
+        }
+        return written;
     }
 
     void InterpreterFallback(u32 pc, std::size_t num_instructions) override {
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/settings.h"
+#include "common/thread.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
@@ -19,7 +22,9 @@ public:
         : m_parent{parent}, m_memory(process->GetMemory()),
           m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()},
           m_check_memory_access{m_debugger_enabled ||
-                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()} {}
+                                !Settings::values.cpuopt_ignore_memory_aborts.GetValue()},
+          m_record_blocks{Settings::values.use_jit_block_profile.GetValue() &&
+                          process->IsApplication()} {}
 
     u8 MemoryRead8(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Read);
@@ -45,9 +50,24 @@ public:
         if (!m_memory.IsValidVirtualAddressRange(vaddr, sizeof(u32))) {
             return std::nullopt;
         }
+        if (m_record_blocks) [[unlikely]] {
+            RecordCodeRead(vaddr);
+        }
         return m_memory.Read32(vaddr);
     }
 
+    void RecordCodeRead(u64 vaddr) {
+        // Blocks are decoded in order, a read that does not follow the previous one starts one.
+        if (vaddr != m_last_code_read + sizeof(u32)) {
+            m_recorded_blocks.push_back({
+                .address = vaddr,
+                .fpcr = m_parent.m_jit->GetFpcr(),
+                .reserved = 0,
+            });
+        }
+        m_last_code_read = vaddr;
+    }
+
     void MemoryWrite8(u64 vaddr, u8 value) override {
         if (CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write)) {
             m_memory.Write8(vaddr, value);
@@ -77,23 +97,31 @@ public:
 
     bool MemoryWriteExclusive8(u64 vaddr, std::uint8_t value, std::uint8_t expected) override {
         return CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive8(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive8(vaddr, value, expected));
     }
     bool MemoryWriteExclusive16(u64 vaddr, std::uint16_t value, std::uint16_t expected) override {
         return CheckMemoryAccess(vaddr, 2, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive16(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive16(vaddr, value, expected));
     }
     bool MemoryWriteExclusive32(u64 vaddr, std::uint32_t value, std::uint32_t expected) override {
         return CheckMemoryAccess(vaddr, 4, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive32(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive32(vaddr, value, expected));
     }
     bool MemoryWriteExclusive64(u64 vaddr, std::uint64_t value, std::uint64_t expected) override {
         return CheckMemoryAccess(vaddr, 8, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive64(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive64(vaddr, value, expected));
     }
     bool MemoryWriteExclusive128(u64 vaddr, Vector value, Vector expected) override {
         return CheckMemoryAccess(vaddr, 16, Kernel::DebugWatchpointType::Write) &&
-               m_memory.WriteExclusive128(vaddr, value, expected);
+               OnExclusiveWrite(vaddr, m_memory.WriteExclusive128(vaddr, value, expected));
+    }
+
+    /// Breaks the kernel reservations on the granule written by a guest exclusive store
+    bool OnExclusiveWrite(u64 vaddr, bool written) {
+        if (written) {
+            m_parent.m_exclusive_monitor.OnGuestExclusiveWrite(vaddr);
+        }
+        return written;
     }
 
     void InterpreterFallback(u64 pc, std::size_t num_instructions) override {
@@ -219,6 +247,9 @@ public:
     Kernel::KProcess* m_process{};
     const bool m_debugger_enabled{};
     const bool m_check_memory_access{};
+    const bool m_record_blocks{};
+    u64 m_last_code_read{};
+    std::vector<TranslatedBlock> m_recorded_blocks{};
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
@@ -413,13 +444,22 @@ ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProc
     ScopedJitExecution::RegisterHandler();
 }
 
-ArmDynarmic64::~ArmDynarmic64() = default;
+ArmDynarmic64::~ArmDynarmic64() {
+    m_stop_prewarm.store(true, std::memory_order_relaxed);
+    WaitForPrewarm();
+}
+
+void ArmDynarmic64::Initialize() {
+    WaitForPrewarm();
+}
 
 void ArmDynarmic64::SetTpidrroEl0(u64 value) {
     m_cb->m_tpidrro_el0 = value;
 }
 
 void ArmDynarmic64::GetContext(Kernel::Svc::ThreadContext& ctx) const {
+    WaitForPrewarm();
+
     Dynarmic::A64::Jit& j = *m_jit;
     auto gpr = j.GetRegisters();
     auto fpr = j.GetVectors();
@@ -441,6 +481,8 @@ void ArmDynarmic64::GetContext(Kernel::Svc::ThreadContext& ctx) const {
 }
 
 void ArmDynarmic64::SetContext(const Kernel::Svc::ThreadContext& ctx) {
+    WaitForPrewarm();
+
     Dynarmic::A64::Jit& j = *m_jit;
 
     // TODO: this is inconvenient
@@ -467,11 +509,51 @@ void ArmDynarmic64::SignalInterrupt(Kernel::KThread* thread) {
 }
 
 void ArmDynarmic64::ClearInstructionCache() {
+    WaitForPrewarm();
     m_jit->ClearCache();
 }
 
 void ArmDynarmic64::InvalidateCacheRange(u64 addr, std::size_t size) {
+    WaitForPrewarm();
     m_jit->InvalidateCacheRange(addr, size);
 }
 
+void ArmDynarmic64::PrewarmBlocks(std::vector<TranslatedBlock> blocks) {
+    // With ticking enabled, running the JIT calls into core timing, which is owned by the cores.
+    if (!m_uses_wall_clock || blocks.empty()) {
+        return;
+    }
+    WaitForPrewarm();
+    auto prewarm = [this, blocks = std::move(blocks)] {
+        Common::SetCurrentThreadName("JitPrewarm");
+        for (const TranslatedBlock& block : blocks) {
+            if (m_stop_prewarm.load(std::memory_order_relaxed)) {
+                break;
+            }
+            // The JIT translates the block at the PC before checking for a halt, a pending halt
+            // returns before any of it executes.
+            m_jit->SetPC(block.address);
+            m_jit->SetFpcr(block.fpcr);
+            m_jit->HaltExecution(PrewarmBlock);
+            m_jit->Run();
+            m_jit->ClearHalt(PrewarmBlock);
+        }
+    };
+    m_prewarm = std::async(std::launch::async, std::move(prewarm)).share();
+}
+
+std::vector<TranslatedBlock> ArmDynarmic64::GetRecordedBlocks() const {
+    WaitForPrewarm();
+    std::vector<TranslatedBlock> blocks{m_cb->m_recorded_blocks};
+    std::ranges::sort(blocks);
+    blocks.erase(std::ranges::unique(blocks).begin(), blocks.end());
+    return blocks;
+}
+
+void ArmDynarmic64::WaitForPrewarm() const {
+    if (m_prewarm.valid()) {
+        m_prewarm.wait();
+    }
+}
+
 } // namespace Core
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <atomic>
+#include <future>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <dynarmic/interface/A64/a64.h>
 #include "common/common_types.h"
@@ -29,6 +31,8 @@ public:
                   DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index);
     ~ArmDynarmic64() override;
 
+    void Initialize() override;
+
     Architecture GetArchitecture() const override {
         return Architecture::AArch64;
     }
@@ -48,6 +52,9 @@ public:
     void ClearInstructionCache() override;
     void InvalidateCacheRange(u64 addr, std::size_t size) override;
 
+    void PrewarmBlocks(std::vector<TranslatedBlock> blocks) override;
+    std::vector<TranslatedBlock> GetRecordedBlocks() const override;
+
 protected:
     const Kernel::DebugWatchpoint* HaltedWatchpoint() const override;
     void RewindBreakpointInstruction() override;
@@ -61,6 +68,9 @@ private:
 
     std::shared_ptr<Dynarmic::A64::Jit> MakeJit(Common::PageTable* page_table,
                                                 std::size_t address_space_bits) const;
+
+    /// Blocks until the background translation of prewarmed blocks is done with the JIT
+    void WaitForPrewarm() const;
     std::unique_ptr<DynarmicCallbacks64> m_cb{};
     std::size_t m_core_index{};
 
@@ -72,6 +82,10 @@ private:
     // Watchpoint info
     const Kernel::DebugWatchpoint* m_halted_watchpoint{};
     Kernel::Svc::ThreadContext m_breakpoint_context{};
+
+    // Background translation of the blocks of a previous session
+    std::shared_future<void> m_prewarm{};
+    std::atomic_bool m_stop_prewarm{};
 };
 
 } // namespace Core
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/arm/dynarmic/dynarmic_block_profile.h"
+
+namespace Core {
+
+namespace {
+
+constexpr std::array<char, 8> BlockProfileMagic{'y', 'u', 'z', 'u', 'j', 'i', 't', 'p'};
+// Increase when the way block entry points are recorded changes.
+constexpr u32 BlockProfileVersion = 1;
+
+static_assert(sizeof(TranslatedBlock) == 16);
+
+struct BlockProfileHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 num_blocks;
+    u64 code_hash;
+    u64 config_hash;
+};
+static_assert(sizeof(BlockProfileHeader) == 32);
+
+// Hashes every setting that changes how dynarmic splits and translates guest code.
+u64 HashCpuSettings() {
+    u64 hash = Settings::values.use_multi_core.GetValue() ? 1 : 0;
+    for (const auto category : {Settings::Category::Cpu, Settings::Category::CpuDebug,
+                                Settings::Category::CpuUnsafe}) {
+        for (const auto* setting : Settings::values.linkage.by_category[category]) {
+            const std::string value = setting->ToString();
+            hash = Common::CityHash64WithSeed(value.data(), value.size(), hash);
+        }
+    }
+    return hash;
+}
+
+} // Anonymous namespace
+
+DynarmicBlockProfile::DynarmicBlockProfile(u64 program_id, u64 code_hash_)
+    : path{Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "jit" /
+           fmt::format("{:016X}.bin", program_id)},
+      code_hash{code_hash_}, config_hash{HashCpuSettings()} {}
+
+std::vector<TranslatedBlock> DynarmicBlockProfile::Load(size_t code_size) const {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return {};
+    }
+    BlockProfileHeader header{};
+    if (!file.ReadObject(header) || header.magic != BlockProfileMagic ||
+        header.version != BlockProfileVersion || header.code_hash != code_hash ||
+        header.config_hash != config_hash) {
+        return {};
+    }
+    const u64 max_blocks = (file.GetSize() - sizeof(header)) / sizeof(TranslatedBlock);
+    if (header.num_blocks > max_blocks) {
+        LOG_WARNING(Core_ARM, "JIT block profile {} is truncated",
+                    Common::FS::PathToUTF8String(path));
+        return {};
+    }
+    std::vector<TranslatedBlock> blocks(header.num_blocks);
+    if (file.ReadSpan<TranslatedBlock>(blocks) != blocks.size() ||
+        std::ranges::any_of(blocks, [code_size](const TranslatedBlock& block) {
+            return block.address >= code_size;
+        })) {
+        return {};
+    }
+    return blocks;
+}
+
+void DynarmicBlockProfile::Save(std::span<const TranslatedBlock> blocks) const {
+    if (!Common::FS::CreateDirs(path.parent_path())) {
+        LOG_ERROR(Core_ARM, "Failed to create the JIT block profile directory");
+        return;
+    }
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    const BlockProfileHeader header{
+        .magic = BlockProfileMagic,
+        .version = BlockProfileVersion,
+        .num_blocks = static_cast<u32>(blocks.size()),
+        .code_hash = code_hash,
+        .config_hash = config_hash,
+    };
+    if (!file.WriteObject(header) || file.WriteSpan(blocks) != blocks.size()) {
+        LOG_ERROR(Core_ARM, "Failed to write JIT block profile {}",
+                  Common::FS::PathToUTF8String(path));
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/arm/arm_interface.h"
+
+namespace Core {
+
+/**
+ * Persists the entry points of the guest blocks translated by dynarmic in earlier sessions of a
+ * program, so they can be translated again before the guest runs. The profile is keyed by the
+ * hash of the loaded code and of the CPU settings, changing either discards it.
+ */
+class DynarmicBlockProfile {
+public:
+    explicit DynarmicBlockProfile(u64 program_id, u64 code_hash);
+
+    /// Returns the recorded blocks, addressed from the start of the code, empty without a profile
+    [[nodiscard]] std::vector<TranslatedBlock> Load(size_t code_size) const;
+
+    /// Replaces the profile with the given blocks, addressed from the start of the code
+    void Save(std::span<const TranslatedBlock> blocks) const;
+
+private:
+    std::filesystem::path path;
+    u64 code_hash;
+    u64 config_hash;
+};
+
+} // namespace Core
@@ -7,6 +7,7 @@
 
 #include "common/common_types.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/exclusive_reservation_table.h"
 
 namespace Core::Memory {
 class Memory;
@@ -35,10 +36,22 @@ public:
     bool ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) override;
     bool ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) override;
 
+    /// Called after an exclusive write of the recompiled guest code succeeded
+    void OnGuestExclusiveWrite(VAddr vaddr) {
+        reservations.Invalidate(vaddr);
+    }
+
 private:
     friend class ArmDynarmic32;
     friend class ArmDynarmic64;
+
+    /// Used by the recompiled guest code
     Dynarmic::ExclusiveMonitor monitor;
+
+    /// Used by the kernel, invalidated by guest exclusive writes and coherent with the others
+    /// through the compare and swap of writes
+    ExclusiveReservationTable reservations;
+
     Core::Memory::Memory& memory;
 };
 
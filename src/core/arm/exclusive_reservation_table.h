@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "core/hardware_properties.h"
+
+namespace Core {
+
+/**
+ * Lock-free tracking of the exclusive reservations of each core. Reservation granules are
+ * hashed into buckets holding a version, which is incremented by every exclusive write to the
+ * bucket. A write succeeds only if no other exclusive write to the bucket happened since the
+ * core marked the address, and if the memory still holds the value read when marking it.
+ * Cores touching unrelated granules never contend.
+ */
+class ExclusiveReservationTable {
+public:
+    /// Exclusive reservation granule of the emulated cores, in bytes
+    static constexpr size_t GranuleSize = 64;
+    static constexpr size_t NumBuckets = 4096;
+    static constexpr size_t MaxCores = Hardware::NUM_CPU_CORES;
+
+    explicit ExclusiveReservationTable(size_t num_cores_) : num_cores{num_cores_} {
+        ASSERT(num_cores <= MaxCores);
+    }
+
+    template <typename T, typename Function>
+    T ReadAndMark(size_t core_index, VAddr address, Function&& read) {
+        static_assert(sizeof(T) <= sizeof(Reservation::value));
+        Reservation& reservation = reservations[core_index];
+        reservation.version = GetBucket(address).load(std::memory_order_acquire);
+        const T value = read();
+        std::memcpy(reservation.value.data(), &value, sizeof(T));
+        reservation.address = address;
+        reservation.is_marked = true;
+        return value;
+    }
+
+    template <typename T, typename Function>
+    bool DoExclusiveOperation(size_t core_index, VAddr address, Function&& write) {
+        Reservation& reservation = reservations[core_index];
+        if (!reservation.is_marked || reservation.address != address) {
+            reservation.is_marked = false;
+            return false;
+        }
+        reservation.is_marked = false;
+
+        // Claim the granule, a concurrent exclusive write to it loses the reservation.
+        u64 version = reservation.version;
+        if (!GetBucket(address).compare_exchange_strong(version, version + 1,
+                                                        std::memory_order_acq_rel)) {
+            CountContended(core_index);
+            return false;
+        }
+        T expected;
+        std::memcpy(&expected, reservation.value.data(), sizeof(T));
+        if (!write(expected)) {
+            // The memory was modified by the guest since the reservation was marked.
+            CountContended(core_index);
+            return false;
+        }
+        return true;
+    }
+
+    void Clear(size_t core_index) {
+        reservations[core_index].is_marked = false;
+    }
+
+    /// Breaks the reservations of every core on the granule of the address
+    void Invalidate(VAddr address) {
+        GetBucket(address).fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    /// Returns how many exclusive writes failed because of a concurrent access
+    [[nodiscard]] u64 GetContendedCount() const {
+        u64 count = 0;
+        for (size_t core = 0; core < num_cores; ++core) {
+            count += reservations[core].num_contended.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+private:
+    // Only accessed by the host thread of its core.
+    struct alignas(64) Reservation {
+        VAddr address{};
+        u64 version{};
+        std::array<u8, 16> value{};
+        bool is_marked{};
+        std::atomic<u64> num_contended{};
+    };
+
+    std::atomic<u64>& GetBucket(VAddr address) {
+        const u64 granule = address / GranuleSize;
+        return buckets[(granule ^ (granule >> 12)) % NumBuckets];
+    }
+
+    void CountContended(size_t core_index) {
+        std::atomic<u64>& count = reservations[core_index].num_contended;
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    size_t num_cores;
+    std::array<Reservation, MaxCores> reservations{};
+    std::array<std::atomic<u64>, NumBuckets> buckets{};
+};
+
+} // namespace Core
@@ -1,9 +1,19 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 #include "common/arm64/native_clock.h"
 #include "common/bit_cast.h"
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
 #include "core/arm/nce/instructions.h"
@@ -22,6 +32,76 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+namespace {
+
+constexpr std::array<char, 8> PatchCacheMagic{'y', 'u', 'z', 'u', 'n', 'c', 'e', 'p'};
+// Increase when PatchInstruction handles a different set of instructions.
+constexpr u32 PatchCacheVersion = 1;
+
+struct PatchCacheHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 num_sites;
+    u64 text_hash;
+};
+static_assert(sizeof(PatchCacheHeader) == 24);
+
+std::filesystem::path GetPatchCachePath(std::span<const u8> build_id) {
+    return Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "nce" /
+           (Common::HexToString(build_id, false) + ".bin");
+}
+
+// The cache only stores the indices of the instructions that need patching. Mods may change the
+// text of a module without changing its build id, so the cache is also keyed by a text hash.
+std::optional<std::vector<u32>> LoadPatchSites(const std::filesystem::path& path, u64 text_hash,
+                                               size_t num_words) {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return std::nullopt;
+    }
+    PatchCacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != PatchCacheMagic ||
+        header.version != PatchCacheVersion || header.text_hash != text_hash) {
+        return std::nullopt;
+    }
+    // Each site patches a different word, so validate the count before allocating for it
+    const u64 sites_size = u64{header.num_sites} * sizeof(u32);
+    if (header.num_sites > num_words || sites_size > file.GetSize() - sizeof(header)) {
+        return std::nullopt;
+    }
+    std::vector<u32> sites(header.num_sites);
+    if (file.ReadSpan<u32>(sites) != sites.size() ||
+        std::ranges::any_of(sites, [num_words](u32 site) {
+            return site < ModuleCodeIndex || site >= num_words;
+        })) {
+        return std::nullopt;
+    }
+    return sites;
+}
+
+void StorePatchSites(const std::filesystem::path& path, u64 text_hash,
+                     std::span<const u32> sites) {
+    if (!Common::FS::CreateDirs(path.parent_path())) {
+        LOG_ERROR(Core_ARM, "Failed to create the NCE patch cache directory");
+        return;
+    }
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    const PatchCacheHeader header{
+        .magic = PatchCacheMagic,
+        .version = PatchCacheVersion,
+        .num_sites = static_cast<u32>(sites.size()),
+        .text_hash = text_hash,
+    };
+    if (!file.WriteObject(header) || file.WriteSpan(sites) != sites.size()) {
+        LOG_ERROR(Core_ARM, "Failed to write NCE patch cache {}",
+                  Common::FS::PathToUTF8String(path));
+    }
+}
+
+} // Anonymous namespace
+
 Patcher::Patcher() : c(m_patch_instructions) {
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
@@ -39,7 +119,7 @@ Patcher::Patcher() : c(m_patch_instructions) {
 Patcher::~Patcher() = default;
 
 bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
-                        const Kernel::CodeSet::Segment& code) {
+                        const Kernel::CodeSet::Segment& code, std::span<const u8> build_id) {
     // If we have patched modules but cannot reach the new module, then it needs its own patcher.
     const size_t image_size = program_image.size();
     if (total_program_size + image_size > MaxRelativeBranch && total_program_size > 0) {
@@ -59,64 +139,91 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     const auto text_words =
         std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
 
-    // Loop through instructions, patching as needed.
-    for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
-        const u32 inst = text_words[i];
+    // Look up the instructions found by a previous load of this text.
+    std::filesystem::path cache_path;
+    u64 text_hash{};
+    std::optional<std::vector<u32>> cached_sites;
+    if (!build_id.empty()) {
+        cache_path = GetPatchCachePath(build_id);
+        text_hash = Common::CityHash64(reinterpret_cast<const char*>(text.data()), text.size());
+        cached_sites = LoadPatchSites(cache_path, text_hash, text_words.size());
+    }
 
-        const auto AddRelocations = [&] {
-            const uintptr_t this_offset = i * sizeof(u32);
-            const uintptr_t next_offset = this_offset + sizeof(u32);
+    // Patch the cached instructions, or loop through all of them patching as needed.
+    if (cached_sites) {
+        for (const u32 i : *cached_sites) {
+            PatchInstruction(i, text_words[i]);
+        }
+    } else {
+        std::vector<u32> patched_sites;
+        for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
+            if (PatchInstruction(i, text_words[i])) {
+                patched_sites.push_back(i);
+            }
+        }
+        if (!build_id.empty()) {
+            StorePatchSites(cache_path, text_hash, patched_sites);
+        }
+    }
 
-            // Relocate from here to patch.
-            this->BranchToPatch(this_offset);
+    // Determine patching mode for the final relocation step
+    total_program_size += image_size;
+    this->mode = image_size > MaxRelativeBranch ? PatchMode::PreText : PatchMode::PostData;
+    return true;
+}
 
-            // Relocate from patch to next instruction.
-            return next_offset;
-        };
+bool Patcher::PatchInstruction(u32 index, u32 inst) {
+    const auto AddRelocations = [&] {
+        const uintptr_t this_offset = index * sizeof(u32);
+        const uintptr_t next_offset = this_offset + sizeof(u32);
 
-        // SVC
-        if (auto svc = SVC{inst}; svc.Verify()) {
-            WriteSvcTrampoline(AddRelocations(), svc.GetValue());
-            continue;
-        }
+        // Relocate from here to patch.
+        this->BranchToPatch(this_offset);
 
-        // MRS Xn, TPIDR_EL0
-        // MRS Xn, TPIDRRO_EL0
-        if (auto mrs = MRS{inst};
-            mrs.Verify() && (mrs.GetSystemReg() == TpidrroEl0 || mrs.GetSystemReg() == TpidrEl0)) {
-            const auto src_reg = mrs.GetSystemReg() == TpidrroEl0 ? oaknut::SystemReg::TPIDRRO_EL0
-                                                                  : oaknut::SystemReg::TPIDR_EL0;
-            const auto dest_reg = oaknut::XReg{static_cast<int>(mrs.GetRt())};
-            WriteMrsHandler(AddRelocations(), dest_reg, src_reg);
-            continue;
-        }
+        // Relocate from patch to next instruction.
+        return next_offset;
+    };
 
-        // MRS Xn, CNTPCT_EL0
-        if (auto mrs = MRS{inst}; mrs.Verify() && mrs.GetSystemReg() == CntpctEl0) {
-            WriteCntpctHandler(AddRelocations(), oaknut::XReg{static_cast<int>(mrs.GetRt())});
-            continue;
-        }
+    // SVC
+    if (auto svc = SVC{inst}; svc.Verify()) {
+        WriteSvcTrampoline(AddRelocations(), svc.GetValue());
+        return true;
+    }
 
-        // MRS Xn, CNTFRQ_EL0
-        if (auto mrs = MRS{inst}; mrs.Verify() && mrs.GetSystemReg() == CntfrqEl0) {
-            UNREACHABLE();
-        }
+    // MRS Xn, TPIDR_EL0
+    // MRS Xn, TPIDRRO_EL0
+    if (auto mrs = MRS{inst};
+        mrs.Verify() && (mrs.GetSystemReg() == TpidrroEl0 || mrs.GetSystemReg() == TpidrEl0)) {
+        const auto src_reg = mrs.GetSystemReg() == TpidrroEl0 ? oaknut::SystemReg::TPIDRRO_EL0
+                                                              : oaknut::SystemReg::TPIDR_EL0;
+        const auto dest_reg = oaknut::XReg{static_cast<int>(mrs.GetRt())};
+        WriteMrsHandler(AddRelocations(), dest_reg, src_reg);
+        return true;
+    }
 
-        // MSR TPIDR_EL0, Xn
-        if (auto msr = MSR{inst}; msr.Verify() && msr.GetSystemReg() == TpidrEl0) {
-            WriteMsrHandler(AddRelocations(), oaknut::XReg{static_cast<int>(msr.GetRt())});
-            continue;
-        }
+    // MRS Xn, CNTPCT_EL0
+    if (auto mrs = MRS{inst}; mrs.Verify() && mrs.GetSystemReg() == CntpctEl0) {
+        WriteCntpctHandler(AddRelocations(), oaknut::XReg{static_cast<int>(mrs.GetRt())});
+        return true;
+    }
 
-        if (auto exclusive = Exclusive{inst}; exclusive.Verify()) {
-            curr_patch->m_exclusives.push_back(i);
-        }
+    // MRS Xn, CNTFRQ_EL0
+    if (auto mrs = MRS{inst}; mrs.Verify() && mrs.GetSystemReg() == CntfrqEl0) {
+        UNREACHABLE();
     }
 
-    // Determine patching mode for the final relocation step
-    total_program_size += image_size;
-    this->mode = image_size > MaxRelativeBranch ? PatchMode::PreText : PatchMode::PostData;
-    return true;
+    // MSR TPIDR_EL0, Xn
+    if (auto msr = MSR{inst}; msr.Verify() && msr.GetSystemReg() == TpidrEl0) {
+        WriteMsrHandler(AddRelocations(), oaknut::XReg{static_cast<int>(msr.GetRt())});
+        return true;
+    }
+
+    if (auto exclusive = Exclusive{inst}; exclusive.Verify()) {
+        curr_patch->m_exclusives.push_back(index);
+        return true;
+    }
+
+    return false;
 }
 
 bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base,
@@ -31,8 +31,10 @@ public:
     explicit Patcher();
     ~Patcher();
 
+    /// Records the patches needed by a module text. When a build id is given, the instructions
+    /// to patch are cached on disk and later loads of the same text skip scanning it.
     bool PatchText(const Kernel::PhysicalMemory& program_image,
-                   const Kernel::CodeSet::Segment& code);
+                   const Kernel::CodeSet::Segment& code, std::span<const u8> build_id = {});
     bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code,
                          Kernel::PhysicalMemory& program_image, EntryTrampolines* out_trampolines);
     size_t GetSectionSize() const noexcept;
@@ -49,6 +51,8 @@ private:
         uintptr_t module_offset;
     };
 
+    bool PatchInstruction(u32 index, u32 inst);
+
     void WriteLoadContext();
     void WriteSaveContext();
     void LockContext();
@@ -4,16 +4,21 @@
 #include <array>
 #include <atomic>
 #include <exception>
+#include <future>
 #include <memory>
 #include <utility>
 
 #include "audio_core/audio_core.h"
+#include "common/boot_timeline.h"
 #include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
+#include "common/thread.h"
+#include "common/trace_recorder.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -56,6 +61,7 @@
 #include "core/reporter.h"
 #include "core/telemetry_session.h"
 #include "core/tools/freezer.h"
+#include "core/tools/metrics_server.h"
 #include "core/tools/renderdoc.h"
 #include "hid_core/hid_core.h"
 #include "network/network.h"
@@ -72,6 +78,9 @@ namespace Core {
 
 namespace {
 
+/// Number of live systems, to warn about running several of them side by side
+std::atomic<u32> live_systems{};
+
 FileSys::StorageId GetStorageIdForFrontendSlot(
     std::optional<FileSys::ContentProviderUnionSlot> slot) {
     if (!slot.has_value()) {
@@ -294,22 +303,30 @@ struct System::Impl {
         cpu_manager.Initialize();
     }
 
-    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window) {
-        /// Reset all glue registrations
-        arp_manager.ResetAll();
-
-        telemetry_session = std::make_unique<Core::TelemetrySession>();
+    SystemResultStatus InitializeVideoCore(System& system, Frontend::EmuWindow& emu_window) {
+        const Common::BootTimeline::ScopedStage boot_stage{"renderer_init"};
 
         host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
         gpu_core = VideoCore::CreateGPU(emu_window, system);
         if (!gpu_core) {
             return SystemResultStatus::ErrorVideoCore;
         }
+        return SystemResultStatus::Success;
+    }
 
-        audio_core = std::make_unique<AudioCore::AudioCore>(system);
+    void SetupForApplicationProcess(System& system) {
+        /// Reset all glue registrations
+        arp_manager.ResetAll();
 
-        service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
-        services = std::make_unique<Service::Services>(service_manager, system);
+        {
+            const Common::BootTimeline::ScopedStage boot_stage{"audio_init"};
+            audio_core = std::make_unique<AudioCore::AudioCore>(system);
+        }
+        {
+            const Common::BootTimeline::ScopedStage boot_stage{"service_registration"};
+            service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
+            services = std::make_unique<Service::Services>(service_manager, system);
+        }
 
         is_powered_on = true;
         exit_locked = false;
@@ -325,13 +342,13 @@ struct System::Impl {
         }
 
         LOG_DEBUG(Core, "Initialized OK");
-
-        return SystemResultStatus::Success;
     }
 
     SystemResultStatus Load(System& system, Frontend::EmuWindow& emu_window,
                             const std::string& filepath, u64 program_id,
                             std::size_t program_index) {
+        Common::BootTimeline::Begin();
+
         app_loader = Loader::GetLoader(system, GetGameFileFromPath(virtual_filesystem, filepath),
                                        program_id, program_index);
 
@@ -347,7 +364,19 @@ struct System::Impl {
         Kernel::KProcess::Register(system.Kernel(), main_process);
         kernel.AppendNewProcess(main_process);
         kernel.MakeApplicationProcess(main_process);
-        const auto [load_result, load_parameters] = app_loader->Load(*main_process, system);
+
+        telemetry_session = std::make_unique<Core::TelemetrySession>();
+
+        // The loader only reads the filesystem and fills the new process, so the executable is
+        // loaded while the renderer and its device are initialized. The renderer stays on this
+        // thread, which the frontend expects to own the graphics context.
+        auto load_future = std::async(std::launch::async, [this, &system, main_process] {
+            Common::SetCurrentThreadName("Loader");
+            const Common::BootTimeline::ScopedStage boot_stage{"executable_load"};
+            return app_loader->Load(*main_process, system);
+        });
+        const SystemResultStatus video_result{InitializeVideoCore(system, emu_window)};
+        const auto [load_result, load_parameters] = load_future.get();
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
             ShutdownMainProcess();
@@ -355,16 +384,16 @@ struct System::Impl {
             return static_cast<SystemResultStatus>(
                 static_cast<u32>(SystemResultStatus::ErrorLoader) + static_cast<u32>(load_result));
         }
-
-        // Set up the rest of the system.
-        SystemResultStatus init_result{SetupForApplicationProcess(system, emu_window)};
-        if (init_result != SystemResultStatus::Success) {
+        if (video_result != SystemResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
-                         static_cast<int>(init_result));
+                         static_cast<int>(video_result));
             ShutdownMainProcess();
-            return init_result;
+            return video_result;
         }
 
+        // Set up the rest of the system.
+        SetupForApplicationProcess(system);
+
         AddGlueRegistrationForProcess(*app_loader, *main_process);
         telemetry_session->AddInitialInfo(*app_loader, fs_controller, *content_provider);
 
@@ -394,6 +423,15 @@ struct System::Impl {
         GetAndResetPerfStats();
         perf_stats->BeginSystemFrame();
 
+        if (Settings::values.capture_trace) {
+            Common::Trace::StartCapture(Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir) /
+                                        "trace.json");
+        }
+        if (Settings::values.enable_metrics_server) {
+            metrics_server = std::make_unique<Tools::MetricsServer>(
+                Settings::values.metrics_server_port.GetValue());
+        }
+
         std::string name = "Unknown Game";
         if (app_loader->ReadTitle(name) != Loader::ResultStatus::Success) {
             LOG_ERROR(Core, "Failed to read title for ROM (Error {})", load_result);
@@ -424,6 +462,7 @@ struct System::Impl {
 
     void ShutdownMainProcess() {
         SetShuttingDown(true);
+        Common::Trace::StopCapture();
 
         // Log last frame performance stats if game was loaded
         if (perf_stats) {
@@ -466,6 +505,7 @@ struct System::Impl {
         gpu_core.reset();
         host1x_core.reset();
         perf_stats.reset();
+        metrics_server.reset();
         cpu_manager.Shutdown();
         debugger.reset();
         kernel.Shutdown();
@@ -591,6 +631,9 @@ struct System::Impl {
     /// Debugger
     std::unique_ptr<Core::Debugger> debugger;
 
+    /// Metrics server, running while enabled in the settings
+    std::unique_ptr<Tools::MetricsServer> metrics_server;
+
     SystemResultStatus status = SystemResultStatus::Success;
     std::string status_details = "";
 
@@ -613,9 +656,19 @@ struct System::Impl {
     std::deque<std::vector<u8>> user_channel;
 };
 
-System::System() : impl{std::make_unique<Impl>(*this)} {}
+System::System() : impl{std::make_unique<Impl>(*this)} {
+    if (live_systems.fetch_add(1, std::memory_order_relaxed) != 0) {
+        LOG_WARNING(Core, "Several systems are alive at once, they share the same settings");
+    }
+}
 
-System::~System() = default;
+System::~System() {
+    impl.reset();
+    live_systems.fetch_sub(1, std::memory_order_relaxed);
+    // Host devices kept between sessions must not outlive the system into static destruction
+    AudioCore::AudioCore::ReleaseParkedSinks();
+    VideoCore::ReleaseParkedDevices();
+}
 
 CpuManager& System::GetCpuManager() {
     return impl->cpu_manager;
@@ -700,10 +753,12 @@ std::span<GPUDirtyMemoryManager> System::GetGPUDirtyMemoryManager() {
     return impl->gpu_dirty_memory_managers;
 }
 
-void System::GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback) {
+void System::GatherGPUDirtyMemory(std::vector<std::pair<PAddr, size_t>>& ranges) {
+    ranges.clear();
     for (auto& manager : impl->gpu_dirty_memory_managers) {
-        manager.Gather(callback);
+        manager.Gather(ranges);
     }
+    GPUDirtyMemoryManager::Coalesce(ranges);
 }
 
 PerfStatsResults System::GetAndResetPerfStats() {
@@ -1064,6 +1119,7 @@ void System::Exit() {
 
 void System::ApplySettings() {
     impl->RefreshTime(*this);
+    Settings::UpdateHotSettings();
 
     if (IsPoweredOn()) {
         Renderer().RefreshBaseSettings();
@@ -10,6 +10,7 @@
 #include <mutex>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
@@ -136,6 +137,12 @@ enum class SystemResultStatus : u32 {
     ErrorLoader,         ///< The base for loader errors (too many to repeat)
 };
 
+/**
+ * The emulated console. Read-only host data, such as the keys and the decrypted shared fonts, is
+ * shared by every System of the process. Running several Systems at the same time is not
+ * supported: Settings::values and the logging backend are process-wide, so the instances would
+ * overwrite each other's configuration.
+ */
 class System {
 public:
     using CurrentBuildProcessID = std::array<u8, 0x20>;
@@ -224,7 +231,8 @@ public:
 
     std::span<GPUDirtyMemoryManager> GetGPUDirtyMemoryManager();
 
-    void GatherGPUDirtyMemory(std::function<void(PAddr, size_t)>& callback);
+    /// Gathers the memory written by the CPU since the last call as sorted, disjoint ranges
+    void GatherGPUDirtyMemory(std::vector<std::pair<PAddr, size_t>>& ranges);
 
     [[nodiscard]] size_t GetCurrentHostThreadID() const;
 
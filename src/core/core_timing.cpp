@@ -2,10 +2,18 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <tuple>
 
+#include <fmt/format.h>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
 #ifdef _WIN32
 #include "common/windows/timer_resolution.h"
 #endif
@@ -14,6 +22,7 @@
 #include "common/x64/cpu_wait.h"
 #endif
 
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "core/core_timing.h"
 #include "core/hardware_properties.h"
@@ -22,6 +31,19 @@ namespace Core::Timing {
 
 constexpr s64 MAX_SLICE_LENGTH = 10000;
 
+// Waits shorter than this spin instead of sleeping, OS timers tend to wake up this late
+constexpr s64 SPIN_MARGIN_NS = 20'000;
+#ifdef _WIN32
+constexpr s64 MAX_SLEEP_SLICE_NS = 1'000'000;
+#endif
+#ifdef ARCHITECTURE_x86_64
+constexpr u32 SPIN_PAUSE_CYCLES = 4'000;
+#endif
+
+// Upper limits of the buckets of the event overshoot histogram, the last bucket has no limit
+constexpr std::array<s64, 6> OVERSHOOT_BUCKET_LIMITS_NS{1'000,   10'000,  50'000,
+                                                        100'000, 500'000, 1'000'000};
+
 std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
@@ -48,6 +70,8 @@ CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
 
 CoreTiming::~CoreTiming() {
     Reset();
+    std::scoped_lock lock{basic_lock};
+    ForgetQueuedEvents();
 }
 
 void CoreTiming::ThreadEntry(CoreTiming& instance) {
@@ -55,6 +79,13 @@ void CoreTiming::ThreadEntry(CoreTiming& instance) {
     MicroProfileOnThreadCreate(name);
     Common::SetCurrentThreadName(name);
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+#ifdef __linux__
+    // Timer slack delays the wake ups of the timed waits by 50us by default
+    prctl(PR_SET_TIMERSLACK, 1UL);
+#endif
+#ifdef _WIN32
+    instance.has_high_resolution_timer = Common::Windows::HasHighResolutionTimer();
+#endif
     instance.on_thread_init();
     instance.ThreadLoop();
     MicroProfileOnThreadExit();
@@ -74,6 +105,7 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
+    ForgetQueuedEvents();
     event_queue.clear();
     event.Set();
 }
@@ -124,6 +156,7 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
 
         auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
         (*h).handle = h;
+        event_type->queued.push_back(h);
     }
 
     event.Set();
@@ -140,6 +173,7 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         auto h{event_queue.emplace(
             Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
         (*h).handle = h;
+        event_type->queued.push_back(h);
     }
 
     event.Set();
@@ -150,17 +184,10 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
+        for (const EventHandle& h : event_type->queued) {
             event_queue.erase(h);
         }
+        event_type->queued.clear();
 
         event_type->sequence_number++;
     }
@@ -210,19 +237,25 @@ std::optional<s64> CoreTiming::Advance() {
             const auto evt_sequence_num = event_type->sequence_number;
 
             if (evt.reschedule_time == 0) {
+                auto& queued = event_type->queued;
+                queued.erase(std::ranges::find_if(
+                    queued, [&evt](const EventHandle& h) { return &*h == &evt; }));
                 event_queue.pop();
 
                 basic_lock.unlock();
 
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
+                const s64 ns_late{GetGlobalTimeNs().count() - evt_time};
+                RecordOvershoot(ns_late);
+                event_type->callback(evt_time, std::chrono::nanoseconds{ns_late});
 
                 basic_lock.lock();
             } else {
                 basic_lock.unlock();
 
-                const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
+                const s64 ns_late{GetGlobalTimeNs().count() - evt_time};
+                RecordOvershoot(ns_late);
+                const auto new_schedule_time{
+                    event_type->callback(evt_time, std::chrono::nanoseconds{ns_late})};
 
                 basic_lock.lock();
 
@@ -245,6 +278,9 @@ std::optional<s64> CoreTiming::Advance() {
                 event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
                                                      next_schedule_time, evt.handle});
             }
+        } else {
+            // The event type was destroyed while scheduled
+            event_queue.pop();
         }
 
         global_timer = GetGlobalTimeNs().count();
@@ -265,29 +301,7 @@ void CoreTiming::ThreadLoop() {
             const auto next_time = Advance();
             if (next_time) {
                 // There are more events left in the queue, wait until the next event.
-                auto wait_time = *next_time - GetGlobalTimeNs().count();
-                if (wait_time > 0) {
-#ifdef _WIN32
-                    while (!paused && !event.IsSet() && wait_time > 0) {
-                        wait_time = *next_time - GetGlobalTimeNs().count();
-                        if (wait_time >= timer_resolution_ns) {
-                            Common::Windows::SleepForOneTick();
-                        } else {
-#ifdef ARCHITECTURE_x86_64
-                            Common::X64::MicroSleep();
-#else
-                            std::this_thread::yield();
-#endif
-                        }
-                    }
-
-                    if (event.IsSet()) {
-                        event.Reset();
-                    }
-#else
-                    event.WaitFor(std::chrono::nanoseconds(wait_time));
-#endif
-                }
+                SleepUntil(*next_time);
             } else {
                 // Queue is empty, wait until another event is scheduled and signals us to
                 // continue.
@@ -302,6 +316,84 @@ void CoreTiming::ThreadLoop() {
     }
 }
 
+void CoreTiming::SleepUntil(s64 next_time) {
+    // Sleep on the OS timers until shortly before the event is due and only spin for the rest,
+    // events still fire on time without keeping a host core busy for the whole wait.
+#ifdef _WIN32
+    const s64 spin_margin_ns{has_high_resolution_timer ? SPIN_MARGIN_NS : timer_resolution_ns};
+#else
+    const s64 spin_margin_ns{SPIN_MARGIN_NS};
+#endif
+    while (!paused) {
+        const s64 wait_time{next_time - GetGlobalTimeNs().count()};
+        if (wait_time <= 0) {
+            return;
+        }
+        if (wait_time <= spin_margin_ns) {
+            if (event.IsSet()) {
+                event.Reset();
+                return;
+            }
+#ifdef ARCHITECTURE_x86_64
+            Common::X64::MicroSleep(SPIN_PAUSE_CYCLES);
+#else
+            std::this_thread::yield();
+#endif
+            continue;
+        }
+#ifdef _WIN32
+        if (event.IsSet()) {
+            event.Reset();
+            return;
+        }
+        // Timers can't be woken up by the event, check for newly scheduled events periodically
+        const s64 sleep_time{std::min(wait_time - spin_margin_ns, MAX_SLEEP_SLICE_NS)};
+        Common::Windows::SleepFor(std::chrono::nanoseconds{sleep_time});
+#else
+        if (event.WaitFor(std::chrono::nanoseconds{wait_time - spin_margin_ns})) {
+            // An event was scheduled, it may be due before the one being waited for
+            return;
+        }
+#endif
+    }
+}
+
+void CoreTiming::RecordOvershoot(s64 ns_late) {
+    static_assert(OVERSHOOT_BUCKET_LIMITS_NS.size() + 1 ==
+                  std::tuple_size_v<decltype(overshoot_histogram)>);
+    const auto it{std::ranges::upper_bound(OVERSHOOT_BUCKET_LIMITS_NS, ns_late)};
+    ++overshoot_histogram[static_cast<size_t>(it - OVERSHOOT_BUCKET_LIMITS_NS.begin())];
+}
+
+void CoreTiming::LogOvershootHistogram() {
+    const u64 total{
+        std::accumulate(overshoot_histogram.begin(), overshoot_histogram.end(), u64{0})};
+    if (total == 0) {
+        return;
+    }
+    std::string buckets;
+    for (size_t i = 0; i < overshoot_histogram.size(); ++i) {
+        const double percent{100.0 * static_cast<double>(overshoot_histogram[i]) /
+                             static_cast<double>(total)};
+        if (i < OVERSHOOT_BUCKET_LIMITS_NS.size()) {
+            buckets +=
+                fmt::format(" <{}us: {:.1f}%", OVERSHOOT_BUCKET_LIMITS_NS[i] / 1000, percent);
+        } else {
+            buckets += fmt::format(" more: {:.1f}%", percent);
+        }
+    }
+    LOG_INFO(Core_Timing, "Event overshoot over {} events:{}", total, buckets);
+    overshoot_histogram.fill(0);
+}
+
+void CoreTiming::ForgetQueuedEvents() {
+    for (const Event& evt : event_queue) {
+        if (const auto event_type{evt.type.lock()}) {
+            event_type->queued.clear();
+        }
+    }
+}
+
 void CoreTiming::Reset() {
     paused = true;
     shutting_down = true;
@@ -312,6 +404,7 @@ void CoreTiming::Reset() {
     }
     timer_thread.reset();
     has_started = false;
+    LogOvershootHistogram();
 }
 
 std::chrono::nanoseconds CoreTiming::GetGlobalTimeNs() const {
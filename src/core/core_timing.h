@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -12,6 +13,7 @@
 #include <string>
 #include <thread>
 
+#include <boost/container/small_vector.hpp>
 #include <boost/heap/fibonacci_heap.hpp>
 
 #include "common/common_types.h"
@@ -24,19 +26,7 @@ namespace Core::Timing {
 using TimedCallback = std::function<std::optional<std::chrono::nanoseconds>(
     s64 time, std::chrono::nanoseconds ns_late)>;
 
-/// Contains the characteristics of a particular event.
-struct EventType {
-    explicit EventType(TimedCallback&& callback_, std::string&& name_)
-        : callback{std::move(callback_)}, name{std::move(name_)}, sequence_number{0} {}
-
-    /// The event's callback function.
-    TimedCallback callback;
-    /// A pointer to the name of the event.
-    const std::string name;
-    /// A monotonic sequence number, incremented when this event is
-    /// changed externally.
-    size_t sequence_number;
-};
+struct EventType;
 
 enum class UnscheduleEventType {
     Wait,
@@ -139,6 +129,8 @@ public:
 #endif
 
 private:
+    friend struct EventType;
+
     struct Event;
 
     static void ThreadEntry(CoreTiming& instance);
@@ -146,16 +138,30 @@ private:
 
     void Reset();
 
+    /// Waits until the given time, returns earlier when an event is scheduled or on pause
+    void SleepUntil(s64 next_time);
+
+    /// Adds how late an event ran to the overshoot histogram
+    void RecordOvershoot(s64 ns_late);
+
+    /// Logs and clears the overshoot histogram
+    void LogOvershootHistogram();
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
 
 #ifdef _WIN32
     s64 timer_resolution_ns;
+    bool has_high_resolution_timer{};
 #endif
 
     using heap_t =
         boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
+    using EventHandle = heap_t::handle_type;
+
+    /// Removes the queue entries of every event type, the queue must be cleared afterwards
+    void ForgetQueuedEvents();
 
     heap_t event_queue;
     u64 event_fifo_id = 0;
@@ -178,6 +184,30 @@ private:
     /// Cycle timing
     u64 cpu_ticks{};
     s64 downcount{};
+
+    /// How late events run, guarded by advance_lock
+    std::array<u64, 7> overshoot_histogram{};
+};
+
+/// Contains the characteristics of a particular event.
+struct EventType {
+    explicit EventType(TimedCallback&& callback_, std::string&& name_)
+        : callback{std::move(callback_)}, name{std::move(name_)}, sequence_number{0} {}
+
+    /// The event's callback function.
+    TimedCallback callback;
+    /// A pointer to the name of the event.
+    const std::string name;
+    /// A monotonic sequence number, incremented when this event is
+    /// changed externally.
+    size_t sequence_number;
+
+private:
+    friend class CoreTiming;
+
+    /// Queue entries of this event, unscheduling only visits these instead of the whole queue.
+    /// Guarded by the lock of the CoreTiming that scheduled them.
+    boost::container::small_vector<CoreTiming::EventHandle, 1> queued;
 };
 
 /// Creates a core timing event with the given name and callback.
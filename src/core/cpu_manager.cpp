@@ -1,10 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <optional>
+
 #include "common/fiber.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
+#include "common/tlb_miss_counter.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -195,11 +200,26 @@ void CpuManager::RunThread(std::stop_token token, std::size_t core) {
     MicroProfileOnThreadCreate(name.c_str());
     Common::SetCurrentThreadName(name.c_str());
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
+    Common::SetCurrentThreadCoreClass(Common::ThreadCoreClass::Performance);
     auto& data = core_data[core];
     data.host_context = Common::Fiber::ThreadToFiber();
 
+    // Guest code runs on this thread, so its counters cover all the threads scheduled on the core.
+    std::optional<Common::TlbMissCounter> tlb_miss_counter;
+    if (Settings::values.profile_tlb_misses) {
+        tlb_miss_counter.emplace();
+        if (!tlb_miss_counter->IsValid()) {
+            LOG_WARNING(Core, "TLB misses can't be counted on this host");
+        }
+    }
+
     // Cleanup
     SCOPE_EXIT({
+        if (tlb_miss_counter && tlb_miss_counter->IsValid()) {
+            const auto counts = tlb_miss_counter->Read();
+            LOG_INFO(Core, "{} TLB misses: {} data, {} instruction", name, counts.data_misses,
+                     counts.instruction_misses);
+        }
         data.host_context->Exit();
         MicroProfileOnThreadExit();
     });
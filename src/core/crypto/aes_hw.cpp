@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "common/assert.h"
+#include "core/crypto/aes_hw.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+namespace Core::Crypto::HW {
+namespace {
+
+// clang-format off
+constexpr std::array<u8, 256> SBox{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+// clang-format on
+
+constexpr u8 MultiplyByTwo(u8 value) {
+    return static_cast<u8>((value << 1) ^ ((value >> 7) * 0x1b));
+}
+
+constexpr u8 Multiply(u8 value, u8 factor) {
+    u8 result = 0;
+    for (; factor != 0; factor >>= 1) {
+        if ((factor & 1) != 0) {
+            result ^= value;
+        }
+        value = MultiplyByTwo(value);
+    }
+    return result;
+}
+
+std::array<u8, 16> InvMixColumns(const std::array<u8, 16>& state) {
+    std::array<u8, 16> result;
+    for (std::size_t column = 0; column < 16; column += 4) {
+        const u8* const c = state.data() + column;
+        result[column + 0] = static_cast<u8>(Multiply(c[0], 14) ^ Multiply(c[1], 11) ^
+                                             Multiply(c[2], 13) ^ Multiply(c[3], 9));
+        result[column + 1] = static_cast<u8>(Multiply(c[0], 9) ^ Multiply(c[1], 14) ^
+                                             Multiply(c[2], 11) ^ Multiply(c[3], 13));
+        result[column + 2] = static_cast<u8>(Multiply(c[0], 13) ^ Multiply(c[1], 9) ^
+                                             Multiply(c[2], 14) ^ Multiply(c[3], 11));
+        result[column + 3] = static_cast<u8>(Multiply(c[0], 11) ^ Multiply(c[1], 13) ^
+                                             Multiply(c[2], 9) ^ Multiply(c[3], 14));
+    }
+    return result;
+}
+
+bool DetectSupport() {
+#ifdef ARCHITECTURE_x86_64
+    const auto& caps = Common::GetCPUCaps();
+    return caps.aes && caps.ssse3;
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    return true;
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#else
+    return false;
+#endif
+}
+
+} // Anonymous namespace
+
+bool IsSupported() {
+    static const bool is_supported = DetectSupport();
+    return is_supported;
+}
+
+void ExpandKey(const u8* key, KeySchedule& encryption_keys, KeySchedule& decryption_keys) {
+    u8* const words = encryption_keys.round_keys[0].data();
+    std::memcpy(words, key, 16);
+    u8 round_constant = 1;
+    for (std::size_t i = 16; i < sizeof(encryption_keys.round_keys); i += 4) {
+        std::array<u8, 4> word{words[i - 4], words[i - 3], words[i - 2], words[i - 1]};
+        if (i % 16 == 0) {
+            // RotWord, SubWord and the round constant.
+            word = {static_cast<u8>(SBox[word[1]] ^ round_constant), SBox[word[2]], SBox[word[3]],
+                    SBox[word[0]]};
+            round_constant = MultiplyByTwo(round_constant);
+        }
+        for (std::size_t j = 0; j < word.size(); ++j) {
+            words[i + j] = static_cast<u8>(words[i + j - 16] ^ word[j]);
+        }
+    }
+
+    // Equivalent inverse cipher, the round keys are reversed and the inner ones pass through
+    // InvMixColumns.
+    auto& encryption = encryption_keys.round_keys;
+    auto& decryption = decryption_keys.round_keys;
+    decryption.front() = encryption.back();
+    for (std::size_t round = 1; round < encryption.size() - 1; ++round) {
+        decryption[round] = InvMixColumns(encryption[encryption.size() - 1 - round]);
+    }
+    decryption.back() = encryption.front();
+}
+
+#if !defined(ARCHITECTURE_x86_64) && !defined(ARCHITECTURE_arm64)
+
+void TranscodeCtr(const KeySchedule&, std::array<u8, 16>&, const u8*, u8*, std::size_t) {
+    UNREACHABLE_MSG("AES hardware backend is not supported on this host");
+}
+
+void TranscodeXts(const KeySchedule&, const KeySchedule&, const std::array<u8, 16>&, const u8*,
+                  u8*, std::size_t, bool) {
+    UNREACHABLE_MSG("AES hardware backend is not supported on this host");
+}
+
+#endif
+
+} // namespace Core::Crypto::HW
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Core::Crypto::HW {
+
+/// Round keys of AES-128, ready for the hardware backends
+struct alignas(16) KeySchedule {
+    std::array<std::array<u8, 16>, 11> round_keys;
+};
+
+/// Number of blocks each backend keeps in flight
+constexpr std::size_t PipelineBlocks = 8;
+
+/// Returns true when the host CPU has AES instructions used by the hardware backends
+[[nodiscard]] bool IsSupported();
+
+/// Expands an AES-128 key into the encryption schedule and the equivalent inverse cipher schedule
+void ExpandKey(const u8* key, KeySchedule& encryption_keys, KeySchedule& decryption_keys);
+
+/**
+ * Encrypts or decrypts size bytes in CTR mode. The counter is a big endian 128-bit integer,
+ * advanced by one for each block, including a trailing partial block.
+ */
+void TranscodeCtr(const KeySchedule& encryption_keys, std::array<u8, 16>& counter, const u8* src,
+                  u8* dest, std::size_t size);
+
+/**
+ * Encrypts or decrypts a single XTS data unit of size bytes, a multiple of the block size.
+ * data_keys is the encryption or decryption schedule matching the operation, the tweak is always
+ * encrypted with tweak_keys.
+ */
+void TranscodeXts(const KeySchedule& data_keys, const KeySchedule& tweak_keys,
+                  const std::array<u8, 16>& data_unit, const u8* src, u8* dest, std::size_t size,
+                  bool decrypt);
+
+} // namespace Core::Crypto::HW
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file is compiled with the crypto extensions enabled, only call it after checking the host
+// CPU supports them.
+
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include <arm_neon.h>
+
+#include "common/swap.h"
+#include "core/crypto/aes_hw.h"
+
+#ifdef _MSC_VER
+#define FORCE_INLINE __forceinline
+#else
+#define FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace Core::Crypto::HW {
+namespace {
+
+struct RoundKeys {
+    explicit RoundKeys(const KeySchedule& schedule) {
+        for (std::size_t i = 0; i < std::size(keys); ++i) {
+            keys[i] = vld1q_u8(schedule.round_keys[i].data());
+        }
+    }
+
+    uint8x16_t keys[11];
+};
+
+// The block path is force inlined and expanded with fold expressions rather than loops, so the
+// blocks stay in registers.
+template <std::size_t... I>
+FORCE_INLINE void Encrypt(const RoundKeys& round_keys, uint8x16_t (&blocks)[sizeof...(I)],
+                          std::index_sequence<I...>) {
+    for (std::size_t round = 0; round < 9; ++round) {
+        ((blocks[I] = vaesmcq_u8(vaeseq_u8(blocks[I], round_keys.keys[round]))), ...);
+    }
+    ((blocks[I] = veorq_u8(vaeseq_u8(blocks[I], round_keys.keys[9]), round_keys.keys[10])), ...);
+}
+
+template <std::size_t... I>
+FORCE_INLINE void Decrypt(const RoundKeys& round_keys, uint8x16_t (&blocks)[sizeof...(I)],
+                          std::index_sequence<I...>) {
+    for (std::size_t round = 0; round < 9; ++round) {
+        ((blocks[I] = vaesimcq_u8(vaesdq_u8(blocks[I], round_keys.keys[round]))), ...);
+    }
+    ((blocks[I] = veorq_u8(vaesdq_u8(blocks[I], round_keys.keys[9]), round_keys.keys[10])), ...);
+}
+
+/// Multiplies an XTS tweak by x in GF(2^128)
+uint8x16_t NextTweak(uint8x16_t value) {
+    // Move the top bit of each 64-bit half to the other half, the top bit of the 128-bit value is
+    // reduced with the XTS polynomial.
+    const uint64x2_t tweak = vreinterpretq_u64_u8(value);
+    const int64x2_t signs = vshrq_n_s64(vreinterpretq_s64_u64(tweak), 63);
+    const uint64x2_t carries = vandq_u64(vreinterpretq_u64_s64(vextq_s64(signs, signs, 1)),
+                                         vcombine_u64(vcreate_u64(0x87), vcreate_u64(1)));
+    return vreinterpretq_u8_u64(veorq_u64(vshlq_n_u64(tweak, 1), carries));
+}
+
+/// Big endian 128-bit counter, kept as two native integers
+struct Counter {
+    uint8x16_t Block(u64 index) const {
+        const u64 block_low = low + index;
+        const u64 block_high = block_low < low ? high + 1 : high;
+        return vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(Common::swap64(block_high)),
+                                                 vcreate_u64(Common::swap64(block_low))));
+    }
+
+    void Advance(u64 count) {
+        const u64 old_low = low;
+        low += count;
+        if (low < old_low) {
+            ++high;
+        }
+    }
+
+    u64 high;
+    u64 low;
+};
+
+template <std::size_t... I>
+FORCE_INLINE void TranscodeCtrBlocks(const RoundKeys& round_keys, Counter& counter, const u8* src,
+                                     u8* dest, std::index_sequence<I...> sequence) {
+    uint8x16_t blocks[sizeof...(I)]{counter.Block(I)...};
+    counter.Advance(sizeof...(I));
+    Encrypt(round_keys, blocks, sequence);
+    (vst1q_u8(dest + I * 16, veorq_u8(blocks[I], vld1q_u8(src + I * 16))), ...);
+}
+
+template <bool decrypt, std::size_t... I>
+FORCE_INLINE void TranscodeXtsBlocks(const RoundKeys& round_keys, uint8x16_t& tweak,
+                                     const u8* src, u8* dest, std::index_sequence<I...> sequence) {
+    uint8x16_t tweaks[sizeof...(I)];
+    uint8x16_t blocks[sizeof...(I)];
+    ((tweaks[I] = tweak, blocks[I] = veorq_u8(vld1q_u8(src + I * 16), tweak),
+      tweak = NextTweak(tweak)),
+     ...);
+    if constexpr (decrypt) {
+        Decrypt(round_keys, blocks, sequence);
+    } else {
+        Encrypt(round_keys, blocks, sequence);
+    }
+    (vst1q_u8(dest + I * 16, veorq_u8(blocks[I], tweaks[I])), ...);
+}
+
+template <bool decrypt>
+void TranscodeDataUnit(const RoundKeys& round_keys, uint8x16_t tweak, const u8* src, u8* dest,
+                       std::size_t size) {
+    std::size_t offset = 0;
+    for (; size - offset >= PipelineBlocks * 16; offset += PipelineBlocks * 16) {
+        TranscodeXtsBlocks<decrypt>(round_keys, tweak, src + offset, dest + offset,
+                                    std::make_index_sequence<PipelineBlocks>{});
+    }
+    for (; offset < size; offset += 16) {
+        TranscodeXtsBlocks<decrypt>(round_keys, tweak, src + offset, dest + offset,
+                                    std::make_index_sequence<1>{});
+    }
+}
+
+} // Anonymous namespace
+
+void TranscodeCtr(const KeySchedule& encryption_keys, std::array<u8, 16>& counter, const u8* src,
+                  u8* dest, std::size_t size) {
+    const RoundKeys round_keys{encryption_keys};
+
+    Counter value;
+    std::memcpy(&value.high, counter.data(), sizeof(value.high));
+    std::memcpy(&value.low, counter.data() + 8, sizeof(value.low));
+    value.high = Common::swap64(value.high);
+    value.low = Common::swap64(value.low);
+
+    std::size_t offset = 0;
+    for (; size - offset >= PipelineBlocks * 16; offset += PipelineBlocks * 16) {
+        TranscodeCtrBlocks(round_keys, value, src + offset, dest + offset,
+                           std::make_index_sequence<PipelineBlocks>{});
+    }
+    for (; size - offset >= 16; offset += 16) {
+        TranscodeCtrBlocks(round_keys, value, src + offset, dest + offset,
+                           std::make_index_sequence<1>{});
+    }
+    if (offset < size) {
+        // Trailing partial block.
+        std::array<u8, 16> block{};
+        std::memcpy(block.data(), src + offset, size - offset);
+        TranscodeCtrBlocks(round_keys, value, block.data(), block.data(),
+                           std::make_index_sequence<1>{});
+        std::memcpy(dest + offset, block.data(), size - offset);
+    }
+    value.high = Common::swap64(value.high);
+    value.low = Common::swap64(value.low);
+    std::memcpy(counter.data(), &value.high, sizeof(value.high));
+    std::memcpy(counter.data() + 8, &value.low, sizeof(value.low));
+}
+
+void TranscodeXts(const KeySchedule& data_keys, const KeySchedule& tweak_keys,
+                  const std::array<u8, 16>& data_unit, const u8* src, u8* dest, std::size_t size,
+                  bool decrypt) {
+    const RoundKeys round_keys{data_keys};
+    uint8x16_t tweak[1]{vld1q_u8(data_unit.data())};
+    Encrypt(RoundKeys{tweak_keys}, tweak, std::make_index_sequence<1>{});
+    if (decrypt) {
+        TranscodeDataUnit<true>(round_keys, tweak[0], src, dest, size);
+    } else {
+        TranscodeDataUnit<false>(round_keys, tweak[0], src, dest, size);
+    }
+}
+
+} // namespace Core::Crypto::HW
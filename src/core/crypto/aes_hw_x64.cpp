@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file is compiled with AES-NI enabled, only call it after checking the host CPU supports it.
+
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include <immintrin.h>
+
+#include "core/crypto/aes_hw.h"
+
+#ifdef _MSC_VER
+#define FORCE_INLINE __forceinline
+#else
+#define FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace Core::Crypto::HW {
+namespace {
+
+struct RoundKeys {
+    explicit RoundKeys(const KeySchedule& schedule) {
+        for (std::size_t i = 0; i < std::size(keys); ++i) {
+            keys[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(&schedule.round_keys[i]));
+        }
+    }
+
+    __m128i keys[11];
+};
+
+// The block path is force inlined and expanded with fold expressions rather than loops, so the
+// blocks stay in registers.
+template <std::size_t... I>
+FORCE_INLINE void Encrypt(const RoundKeys& round_keys, __m128i (&blocks)[sizeof...(I)],
+                          std::index_sequence<I...>) {
+    ((blocks[I] = _mm_xor_si128(blocks[I], round_keys.keys[0])), ...);
+    for (std::size_t round = 1; round < 10; ++round) {
+        ((blocks[I] = _mm_aesenc_si128(blocks[I], round_keys.keys[round])), ...);
+    }
+    ((blocks[I] = _mm_aesenclast_si128(blocks[I], round_keys.keys[10])), ...);
+}
+
+template <std::size_t... I>
+FORCE_INLINE void Decrypt(const RoundKeys& round_keys, __m128i (&blocks)[sizeof...(I)],
+                          std::index_sequence<I...>) {
+    ((blocks[I] = _mm_xor_si128(blocks[I], round_keys.keys[0])), ...);
+    for (std::size_t round = 1; round < 10; ++round) {
+        ((blocks[I] = _mm_aesdec_si128(blocks[I], round_keys.keys[round])), ...);
+    }
+    ((blocks[I] = _mm_aesdeclast_si128(blocks[I], round_keys.keys[10])), ...);
+}
+
+__m128i Load(const u8* src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+void Store(u8* dest, __m128i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), value);
+}
+
+/// Multiplies an XTS tweak by x in GF(2^128)
+__m128i NextTweak(__m128i tweak) {
+    // Shift each 32-bit lane left by one, carrying its top bit into the next lane. The top bit of
+    // the 128-bit value is reduced with the XTS polynomial.
+    const __m128i carries = _mm_shuffle_epi32(_mm_srai_epi32(tweak, 31), 0x93);
+    const __m128i mask = _mm_and_si128(carries, _mm_set_epi32(1, 1, 1, 0x87));
+    return _mm_xor_si128(_mm_add_epi32(tweak, tweak), mask);
+}
+
+__m128i ByteSwap(__m128i value) {
+    return _mm_shuffle_epi8(value,
+                            _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+/// Increments a little endian 128-bit counter
+__m128i Increment(__m128i value) {
+    value = _mm_add_epi64(value, _mm_set_epi64x(0, 1));
+    if (_mm_cvtsi128_si64(value) == 0) {
+        value = _mm_add_epi64(value, _mm_set_epi64x(1, 0));
+    }
+    return value;
+}
+
+template <std::size_t... I>
+FORCE_INLINE void TranscodeCtrBlocks(const RoundKeys& round_keys, __m128i& counter, const u8* src,
+                                     u8* dest, std::index_sequence<I...> sequence) {
+    constexpr u64 NumBlocks = sizeof...(I);
+    __m128i blocks[NumBlocks];
+    if (static_cast<u64>(_mm_cvtsi128_si64(counter)) <= ~0ULL - NumBlocks) {
+        // The low half does not wrap, so the counters do not depend on each other.
+        ((blocks[I] = ByteSwap(_mm_add_epi64(counter, _mm_set_epi64x(0, I)))), ...);
+        counter = _mm_add_epi64(counter, _mm_set_epi64x(0, NumBlocks));
+    } else {
+        ((blocks[I] = ByteSwap(counter), counter = Increment(counter)), ...);
+    }
+    Encrypt(round_keys, blocks, sequence);
+    (Store(dest + I * 16, _mm_xor_si128(blocks[I], Load(src + I * 16))), ...);
+}
+
+template <bool decrypt, std::size_t... I>
+FORCE_INLINE void TranscodeXtsBlocks(const RoundKeys& round_keys, __m128i& tweak, const u8* src,
+                                     u8* dest, std::index_sequence<I...> sequence) {
+    __m128i tweaks[sizeof...(I)];
+    __m128i blocks[sizeof...(I)];
+    ((tweaks[I] = tweak, blocks[I] = _mm_xor_si128(Load(src + I * 16), tweak),
+      tweak = NextTweak(tweak)),
+     ...);
+    if constexpr (decrypt) {
+        Decrypt(round_keys, blocks, sequence);
+    } else {
+        Encrypt(round_keys, blocks, sequence);
+    }
+    (Store(dest + I * 16, _mm_xor_si128(blocks[I], tweaks[I])), ...);
+}
+
+template <bool decrypt>
+void TranscodeDataUnit(const RoundKeys& round_keys, __m128i tweak, const u8* src, u8* dest,
+                       std::size_t size) {
+    std::size_t offset = 0;
+    for (; size - offset >= PipelineBlocks * 16; offset += PipelineBlocks * 16) {
+        TranscodeXtsBlocks<decrypt>(round_keys, tweak, src + offset, dest + offset,
+                                    std::make_index_sequence<PipelineBlocks>{});
+    }
+    for (; offset < size; offset += 16) {
+        TranscodeXtsBlocks<decrypt>(round_keys, tweak, src + offset, dest + offset,
+                                    std::make_index_sequence<1>{});
+    }
+}
+
+} // Anonymous namespace
+
+void TranscodeCtr(const KeySchedule& encryption_keys, std::array<u8, 16>& counter, const u8* src,
+                  u8* dest, std::size_t size) {
+    const RoundKeys round_keys{encryption_keys};
+
+    // Keep the counter as a little endian integer, so it can be incremented with 64-bit adds.
+    __m128i value = ByteSwap(Load(counter.data()));
+
+    std::size_t offset = 0;
+    for (; size - offset >= PipelineBlocks * 16; offset += PipelineBlocks * 16) {
+        TranscodeCtrBlocks(round_keys, value, src + offset, dest + offset,
+                           std::make_index_sequence<PipelineBlocks>{});
+    }
+    for (; size - offset >= 16; offset += 16) {
+        TranscodeCtrBlocks(round_keys, value, src + offset, dest + offset,
+                           std::make_index_sequence<1>{});
+    }
+    if (offset < size) {
+        // Trailing partial block.
+        alignas(16) std::array<u8, 16> block{};
+        std::memcpy(block.data(), src + offset, size - offset);
+        TranscodeCtrBlocks(round_keys, value, block.data(), block.data(),
+                           std::make_index_sequence<1>{});
+        std::memcpy(dest + offset, block.data(), size - offset);
+    }
+    Store(counter.data(), ByteSwap(value));
+}
+
+void TranscodeXts(const KeySchedule& data_keys, const KeySchedule& tweak_keys,
+                  const std::array<u8, 16>& data_unit, const u8* src, u8* dest, std::size_t size,
+                  bool decrypt) {
+    const RoundKeys round_keys{data_keys};
+    __m128i tweak[1]{Load(data_unit.data())};
+    Encrypt(RoundKeys{tweak_keys}, tweak, std::make_index_sequence<1>{});
+    if (decrypt) {
+        TranscodeDataUnit<true>(round_keys, tweak[0], src, dest, size);
+    } else {
+        TranscodeDataUnit<false>(round_keys, tweak[0], src, dest, size);
+    }
+}
+
+} // namespace Core::Crypto::HW
@@ -5,6 +5,7 @@
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "core/crypto/aes_hw.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
@@ -36,6 +37,14 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+    // AES-128 CTR and AES-128 XTS go through the hardware backend when the host supports it
+    bool use_hw = false;
+    HW::KeySchedule encryption_keys;
+    HW::KeySchedule decryption_keys;
+    HW::KeySchedule tweak_keys;
+    std::array<std::array<u8, 16>, 2> ctr_counters{};
+    std::array<u8, 16> xts_data_unit{};
 };
 
 template <typename Key, std::size_t KeySize>
@@ -57,6 +66,19 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+    if (!HW::IsSupported()) {
+        return;
+    }
+    if (mode == Mode::CTR && KeySize == 16) {
+        ctx->use_hw = true;
+        HW::ExpandKey(key.data(), ctx->encryption_keys, ctx->decryption_keys);
+    } else if (mode == Mode::XTS && KeySize == 32) {
+        ctx->use_hw = true;
+        HW::KeySchedule unused_keys;
+        HW::ExpandKey(key.data(), ctx->encryption_keys, ctx->decryption_keys);
+        HW::ExpandKey(key.data() + 16, ctx->tweak_keys, unused_keys);
+    }
 }
 
 template <typename Key, std::size_t KeySize>
@@ -69,6 +91,22 @@ template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
+    if (ctx->use_hw) {
+        if (mbedtls_cipher_get_cipher_mode(context) != MBEDTLS_MODE_XTS) {
+            HW::TranscodeCtr(ctx->encryption_keys, ctx->ctr_counters[static_cast<std::size_t>(op)],
+                             src, dest, size);
+            return;
+        }
+        // Data units that are not a multiple of the block size need ciphertext stealing, which is
+        // left to mbedtls.
+        if (size != 0 && size % 16 == 0) {
+            const bool decrypt = op == Op::Decrypt;
+            HW::TranscodeXts(decrypt ? ctx->decryption_keys : ctx->encryption_keys,
+                             ctx->tweak_keys, ctx->xts_data_unit, src, dest, size, decrypt);
+            return;
+        }
+    }
+
     mbedtls_cipher_reset(context);
 
     std::size_t written = 0;
@@ -122,6 +160,12 @@ void AESCipher<Key, KeySize>::SetIV(std::span<const u8> data) {
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data.data(), data.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, data.data(), data.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
+
+    if (ctx->use_hw && data.size() == 16) {
+        std::memcpy(ctx->ctr_counters[0].data(), data.data(), data.size());
+        std::memcpy(ctx->ctr_counters[1].data(), data.data(), data.size());
+        std::memcpy(ctx->xts_data_unit.data(), data.data(), data.size());
+    }
 }
 
 template class AESCipher<Key128>;
@@ -8,6 +8,7 @@
 #include <fstream>
 #include <locale>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <tuple>
 #include <vector>
@@ -15,6 +16,7 @@
 #include <mbedtls/cipher.h>
 #include <mbedtls/cmac.h>
 #include <mbedtls/sha256.h>
+#include "common/boot_timeline.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -639,6 +641,9 @@ KeyManager::KeyManager() {
 }
 
 void KeyManager::ReloadKeys() {
+    std::scoped_lock lock{mutex};
+    const Common::BootTimeline::ScopedStage boot_stage{"key_loading"};
+
     // Initialize keys
     const auto yuzu_keys_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::KeysDir);
 
@@ -707,7 +712,7 @@ void KeyManager::LoadFromFile(const std::filesystem::path& file_path, bool is_ti
             u128 rights_id{};
             std::memcpy(rights_id.data(), rights_id_raw.data(), rights_id_raw.size());
             Key128 key = Common::HexStringToArray<16>(out[1]);
-            s128_keys[{S128KeyType::Titlekey, rights_id[1], rights_id[0]}] = key;
+            title_keys[{rights_id[1], rights_id[0]}] = key;
         } else {
             out[0] = Common::ToLower(out[0]);
             if (const auto iter128 = Find128ByName(out[0]); iter128 != s128_file_id.end()) {
@@ -781,6 +786,7 @@ void KeyManager::LoadFromFile(const std::filesystem::path& file_path, bool is_ti
 }
 
 bool KeyManager::AreKeysLoaded() const {
+    std::scoped_lock lock{mutex};
     return !s128_keys.empty() && !s256_keys.empty();
 }
 
@@ -808,21 +814,30 @@ bool KeyManager::BaseDeriveNecessary() const {
 }
 
 bool KeyManager::HasKey(S128KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lock{mutex};
+    if (id == S128KeyType::Titlekey) {
+        return title_keys.contains({field1, field2});
+    }
     return s128_keys.find({id, field1, field2}) != s128_keys.end();
 }
 
 bool KeyManager::HasKey(S256KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lock{mutex};
     return s256_keys.find({id, field1, field2}) != s256_keys.end();
 }
 
 Key128 KeyManager::GetKey(S128KeyType id, u64 field1, u64 field2) const {
-    if (!HasKey(id, field1, field2)) {
-        return {};
+    std::scoped_lock lock{mutex};
+    if (id == S128KeyType::Titlekey) {
+        const auto it = title_keys.find({field1, field2});
+        return it != title_keys.end() ? it->second : Key128{};
     }
-    return s128_keys.at({id, field1, field2});
+    const auto it = s128_keys.find({id, field1, field2});
+    return it != s128_keys.end() ? it->second : Key128{};
 }
 
 Key256 KeyManager::GetKey(S256KeyType id, u64 field1, u64 field2) const {
+    std::scoped_lock lock{mutex};
     if (!HasKey(id, field1, field2)) {
         return {};
     }
@@ -830,6 +845,7 @@ Key256 KeyManager::GetKey(S256KeyType id, u64 field1, u64 field2) const {
 }
 
 Key256 KeyManager::GetBISKey(u8 partition_id) const {
+    std::scoped_lock lock{mutex};
     Key256 out{};
 
     for (const auto& bis_type : {BISKeyType::Crypto, BISKeyType::Tweak}) {
@@ -875,11 +891,11 @@ void KeyManager::WriteKeyToFile(KeyCategory category, std::string_view keyname,
     }
 
     void(file.WriteString(fmt::format("\n{} = {}", keyname, Common::HexToString(key))));
-    LoadFromFile(path, category == KeyCategory::Title);
 }
 
 void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
-    if (s128_keys.find({id, field1, field2}) != s128_keys.end() || key == Key128{}) {
+    std::scoped_lock lock{mutex};
+    if (HasKey(id, field1, field2) || key == Key128{}) {
         return;
     }
     if (id == S128KeyType::Titlekey) {
@@ -887,6 +903,8 @@ void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
         std::memcpy(rights_id.data(), &field2, sizeof(u64));
         std::memcpy(rights_id.data() + sizeof(u64), &field1, sizeof(u64));
         WriteKeyToFile(KeyCategory::Title, Common::HexToString(rights_id), key);
+        title_keys[{field1, field2}] = key;
+        return;
     }
 
     auto category = KeyCategory::Standard;
@@ -932,6 +950,7 @@ void KeyManager::SetKey(S128KeyType id, Key128 key, u64 field1, u64 field2) {
 }
 
 void KeyManager::SetKey(S256KeyType id, Key256 key, u64 field1, u64 field2) {
+    std::scoped_lock lock{mutex};
     if (s256_keys.find({id, field1, field2}) != s256_keys.end() || key == Key256{}) {
         return;
     }
@@ -1220,14 +1239,10 @@ void KeyManager::PopulateTickets() {
 }
 
 void KeyManager::SynthesizeTickets() {
-    for (const auto& key : s128_keys) {
-        if (key.first.type != S128KeyType::Titlekey) {
-            continue;
-        }
-        u128 rights_id{key.first.field1, key.first.field2};
+    for (const auto& [rights_id, title_key] : title_keys) {
         Key128 rights_id_2;
         std::memcpy(rights_id_2.data(), rights_id.data(), rights_id_2.size());
-        const auto ticket = Ticket::SynthesizeCommon(key.second, rights_id_2);
+        const auto ticket = Ticket::SynthesizeCommon(title_key, rights_id_2);
         common_tickets.insert_or_assign(rights_id, ticket);
     }
 }
@@ -1348,6 +1363,7 @@ const std::map<u128, Ticket>& KeyManager::GetPersonalizedTickets() const {
 }
 
 bool KeyManager::AddTicket(const Ticket& ticket) {
+    std::scoped_lock lock{mutex};
     if (!ticket.IsValid()) {
         LOG_WARNING(Crypto, "Attempted to add invalid ticket.");
         return false;
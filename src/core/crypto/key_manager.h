@@ -6,9 +6,11 @@
 #include <array>
 #include <filesystem>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
+#include <unordered_map>
 
 #include <variant>
 #include <fmt/format.h>
@@ -296,11 +298,24 @@ public:
     bool AreKeysLoaded() const;
 
 private:
+    struct TitleKeyHash {
+        size_t operator()(const u128& index) const noexcept {
+            return static_cast<size_t>(index[0] ^ (index[1] * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
     KeyManager();
 
+    // Guards the keys and tickets, files are loaded and tickets added from several threads when
+    // scanning games. Recursive as adding keys checks for them and tickets add keys.
+    mutable std::recursive_mutex mutex;
+
     std::map<KeyIndex<S128KeyType>, Key128> s128_keys;
     std::map<KeyIndex<S256KeyType>, Key256> s256_keys;
 
+    // Title keys indexed by their two key fields, there is one per title installed or dumped
+    std::unordered_map<u128, Key128, TitleKeyHash> title_keys;
+
     // Map from rights ID to ticket
     std::map<u128, Ticket> common_tickets;
     std::map<u128, Ticket> personal_tickets;
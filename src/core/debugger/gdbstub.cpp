@@ -35,6 +35,9 @@ constexpr char GDB_STUB_NACK = '-';
 constexpr char GDB_STUB_INT3 = 0x03;
 constexpr int GDB_STUB_SIGTRAP = 5;
 
+// Largest packet GDB may send, memory reads are split in requests of about half of it
+constexpr size_t GDB_STUB_PACKET_SIZE = 0x20000;
+
 constexpr char GDB_STUB_REPLY_ERR[] = "E01";
 constexpr char GDB_STUB_REPLY_OK[] = "OK";
 constexpr char GDB_STUB_REPLY_EMPTY[] = "";
@@ -71,6 +74,21 @@ static std::string EscapeGDB(std::string_view data) {
     return escaped;
 }
 
+static std::vector<u8> UnescapeGDB(std::string_view data) {
+    std::vector<u8> unescaped;
+    unescaped.reserve(data.size());
+
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i] == '}' && i + 1 < data.size()) {
+            unescaped.push_back(static_cast<u8>(data[++i] ^ 0x20));
+        } else {
+            unescaped.push_back(static_cast<u8>(data[i]));
+        }
+    }
+
+    return unescaped;
+}
+
 static std::string EscapeXML(std::string_view data) {
     std::u32string converted = U"[Encoding error]";
     try {
@@ -270,47 +288,56 @@ void GDBStub::ExecuteCommand(std::string_view packet, std::vector<DebuggerAction
         SendReply(GDB_STUB_REPLY_OK);
         break;
     }
-    case 'm': {
+    case 'm':
+    case 'x': {
         const auto sep{std::find(command.begin(), command.end(), ',') - command.begin() + 1};
         const size_t addr{static_cast<size_t>(strtoll(command.data(), nullptr, 16))};
         const size_t size{static_cast<size_t>(strtoll(command.data() + sep, nullptr, 16))};
 
-        std::vector<u8> mem(size);
-        if (GetMemory().ReadBlock(addr, mem.data(), size)) {
-            // Restore any bytes belonging to replaced instructions.
-            auto it = replaced_instructions.lower_bound(addr);
-            for (; it != replaced_instructions.end() && it->first < addr + size; it++) {
-                // Get the bytes of the instruction we previously replaced.
-                const u32 original_bytes = it->second;
-
-                // Calculate where to start writing to the output buffer.
-                const size_t output_offset = it->first - addr;
+        const auto mem{ReadMemory(addr, size)};
+        if (!mem) {
+            SendReply(GDB_STUB_REPLY_ERR);
+        } else if (packet[0] == 'm') {
+            SendReply(Common::HexToString(*mem));
+        } else {
+            // Binary replies are prefixed to tell them apart from errors.
+            std::string reply{"b"};
+            reply.append(reinterpret_cast<const char*>(mem->data()), mem->size());
+            SendReply(reply);
+        }
+        break;
+    }
+    case 'M': {
+        const auto size_sep{std::find(command.begin(), command.end(), ',') - command.begin() + 1};
+        const auto mem_sep{std::find(command.begin(), command.end(), ':') - command.begin() + 1};
 
-                // Calculate how many bytes to write.
-                // The loop condition ensures output_offset < size.
-                const size_t n = std::min<size_t>(size - output_offset, sizeof(u32));
+        const size_t addr{static_cast<size_t>(strtoll(command.data(), nullptr, 16))};
+        const size_t size{static_cast<size_t>(strtoll(command.data() + size_sep, nullptr, 16))};
 
-                // Write the bytes to the output buffer.
-                std::memcpy(mem.data() + output_offset, &original_bytes, n);
-            }
+        const auto mem_substr{std::string_view(command).substr(mem_sep)};
+        const auto mem{Common::HexStringToVector(mem_substr, false)};
 
-            SendReply(Common::HexToString(mem));
+        if (mem.size() >= size && GetMemory().WriteBlock(addr, mem.data(), size)) {
+            Core::InvalidateInstructionCacheRange(GetProcess(), addr, size);
+            SendReply(GDB_STUB_REPLY_OK);
         } else {
             SendReply(GDB_STUB_REPLY_ERR);
         }
         break;
     }
-    case 'M': {
+    case 'X': {
         const auto size_sep{std::find(command.begin(), command.end(), ',') - command.begin() + 1};
         const auto mem_sep{std::find(command.begin(), command.end(), ':') - command.begin() + 1};
 
         const size_t addr{static_cast<size_t>(strtoll(command.data(), nullptr, 16))};
         const size_t size{static_cast<size_t>(strtoll(command.data() + size_sep, nullptr, 16))};
 
-        const auto mem_substr{std::string_view(command).substr(mem_sep)};
-        const auto mem{Common::HexStringToVector(mem_substr, false)};
+        const auto mem{UnescapeGDB(std::string_view(command).substr(mem_sep))};
 
-        if (GetMemory().WriteBlock(addr, mem.data(), size)) {
+        if (size == 0) {
+            // GDB probes for support of binary writes with an empty one.
+            SendReply(GDB_STUB_REPLY_OK);
+        } else if (mem.size() >= size && GetMemory().WriteBlock(addr, mem.data(), size)) {
             Core::InvalidateInstructionCacheRange(GetProcess(), addr, size);
             SendReply(GDB_STUB_REPLY_OK);
         } else {
@@ -439,6 +466,10 @@ void GDBStub::HandleBreakpointRemove(std::string_view command) {
     }
 }
 
+static bool IsFirstChunk(std::string_view request) {
+    return strtoll(request.data(), nullptr, 16) == 0;
+}
+
 static std::string PaginateBuffer(std::string_view buffer, std::string_view request) {
     const auto amount{request.substr(request.find(',') + 1)};
     const auto offset_val{static_cast<u64>(strtoll(request.data(), nullptr, 16))};
@@ -456,8 +487,10 @@ void GDBStub::HandleQuery(std::string_view command) {
         // no tracepoint support
         SendReply("T0");
     } else if (command.starts_with("Supported")) {
-        SendReply("PacketSize=4000;qXfer:features:read+;qXfer:threads:read+;qXfer:libraries:read+;"
-                  "vContSupported+;QStartNoAckMode+");
+        SendReply(fmt::format("PacketSize={:x};qXfer:features:read+;qXfer:threads:read+;"
+                              "qXfer:libraries:read+;vContSupported+;QStartNoAckMode+;"
+                              "binary-upload+",
+                              GDB_STUB_PACKET_SIZE));
     } else if (command.starts_with("Xfer:features:read:target.xml:")) {
         const auto target_xml{arch->GetTargetXML()};
         SendReply(PaginateBuffer(target_xml, command.substr(30)));
@@ -465,18 +498,23 @@ void GDBStub::HandleQuery(std::string_view command) {
         const auto main_offset = Core::FindMainModuleEntrypoint(GetProcess());
         SendReply(fmt::format("TextSeg={:x}", GetInteger(main_offset)));
     } else if (command.starts_with("Xfer:libraries:read::")) {
-        auto modules = Core::FindModules(GetProcess());
-
-        std::string buffer;
-        buffer += R"(<?xml version="1.0"?>)";
-        buffer += "<library-list>";
-        for (const auto& [base, name] : modules) {
-            buffer += fmt::format(R"(<library name="{}"><segment address="{:#x}"/></library>)",
-                                  EscapeXML(name), base);
+        const auto request{command.substr(21)};
+        if (IsFirstChunk(request)) {
+            // Finding the modules scans the process memory, so the list is only built once for
+            // all the chunks GDB reads it in.
+            auto modules = Core::FindModules(GetProcess());
+
+            libraries_xml = R"(<?xml version="1.0"?>)";
+            libraries_xml += "<library-list>";
+            for (const auto& [base, name] : modules) {
+                libraries_xml +=
+                    fmt::format(R"(<library name="{}"><segment address="{:#x}"/></library>)",
+                                EscapeXML(name), base);
+            }
+            libraries_xml += "</library-list>";
         }
-        buffer += "</library-list>";
 
-        SendReply(PaginateBuffer(buffer, command.substr(21)));
+        SendReply(PaginateBuffer(libraries_xml, request));
     } else if (command.starts_with("fThreadInfo")) {
         // beginning of list
         const auto& threads = GetProcess()->GetThreadList();
@@ -489,25 +527,28 @@ void GDBStub::HandleQuery(std::string_view command) {
         // end of list
         SendReply("l");
     } else if (command.starts_with("Xfer:threads:read::")) {
-        std::string buffer;
-        buffer += R"(<?xml version="1.0"?>)";
-        buffer += "<threads>";
-
-        const auto& threads = GetProcess()->GetThreadList();
-        for (const auto& thread : threads) {
-            auto thread_name{Core::GetThreadName(&thread)};
-            if (!thread_name) {
-                thread_name = fmt::format("Thread {:d}", thread.GetThreadId());
+        const auto request{command.substr(19)};
+        if (IsFirstChunk(request)) {
+            threads_xml = R"(<?xml version="1.0"?>)";
+            threads_xml += "<threads>";
+
+            const auto& threads = GetProcess()->GetThreadList();
+            for (const auto& thread : threads) {
+                auto thread_name{Core::GetThreadName(&thread)};
+                if (!thread_name) {
+                    thread_name = fmt::format("Thread {:d}", thread.GetThreadId());
+                }
+
+                threads_xml +=
+                    fmt::format(R"(<thread id="{:x}" core="{:d}" name="{}">{}</thread>)",
+                                thread.GetThreadId(), thread.GetActiveCore(),
+                                EscapeXML(*thread_name), GetThreadState(&thread));
             }
 
-            buffer += fmt::format(R"(<thread id="{:x}" core="{:d}" name="{}">{}</thread>)",
-                                  thread.GetThreadId(), thread.GetActiveCore(),
-                                  EscapeXML(*thread_name), GetThreadState(&thread));
+            threads_xml += "</threads>";
         }
 
-        buffer += "</threads>";
-
-        SendReply(PaginateBuffer(buffer, command.substr(19)));
+        SendReply(PaginateBuffer(threads_xml, request));
     } else if (command.starts_with("Attached")) {
         SendReply("0");
     } else if (command.starts_with("StartNoAckMode")) {
@@ -709,6 +750,32 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
     SendReply(Common::HexToString(reply_span, false));
 }
 
+std::optional<std::vector<u8>> GDBStub::ReadMemory(VAddr addr, size_t size) {
+    std::vector<u8> mem(size);
+    if (!GetMemory().ReadBlock(addr, mem.data(), size)) {
+        return std::nullopt;
+    }
+
+    // Restore any bytes belonging to replaced instructions.
+    auto it = replaced_instructions.lower_bound(addr);
+    for (; it != replaced_instructions.end() && it->first < addr + size; it++) {
+        // Get the bytes of the instruction we previously replaced.
+        const u32 original_bytes = it->second;
+
+        // Calculate where to start writing to the output buffer.
+        const size_t output_offset = it->first - addr;
+
+        // Calculate how many bytes to write.
+        // The loop condition ensures output_offset < size.
+        const size_t n = std::min<size_t>(size - output_offset, sizeof(u32));
+
+        // Write the bytes to the output buffer.
+        std::memcpy(mem.data() + output_offset, &original_bytes, n);
+    }
+
+    return mem;
+}
+
 Kernel::KThread* GDBStub::GetThreadByID(u64 thread_id) {
     auto& threads{GetProcess()->GetThreadList()};
     for (auto& thread : threads) {
@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -46,6 +47,7 @@ private:
     void HandleBreakpointRemove(std::string_view command);
     std::vector<char>::const_iterator CommandEnd() const;
     std::optional<std::string> DetachCommand();
+    std::optional<std::vector<u8>> ReadMemory(VAddr addr, size_t size);
     Kernel::KThread* GetThreadByID(u64 thread_id);
 
     void SendReply(std::string_view data);
@@ -60,6 +62,9 @@ private:
     std::unique_ptr<GDBStubArch> arch;
     std::vector<char> current_command;
     std::map<VAddr, u32> replaced_instructions;
+    // Objects read by qXfer, kept between the requests for each of their chunks
+    std::string libraries_xml;
+    std::string threads_xml;
     bool no_ack{};
 };
 
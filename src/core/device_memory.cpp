@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/logging/log.h"
+#include "common/memory_accounting.h"
+#include "common/settings.h"
 #include "core/device_memory.h"
 #include "hle/kernel/board/nintendo/nx/k_system_control.h"
 
@@ -14,8 +17,16 @@ constexpr size_t VirtualReserveSize = 1ULL << 39;
 
 DeviceMemory::DeviceMemory()
     : buffer{Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize(),
-             VirtualReserveSize} {}
+             VirtualReserveSize} {
+    if (Settings::values.use_huge_pages && buffer.EnableHugePages()) {
+        LOG_INFO(HW_Memory, "Using transparent huge pages for the device memory");
+    }
+    Common::MemoryAccounting::SetSampler(Common::MemoryAccounting::Category::GuestMemory,
+                                         [this] { return buffer.GetCommittedSize(); });
+}
 
-DeviceMemory::~DeviceMemory() = default;
+DeviceMemory::~DeviceMemory() {
+    Common::MemoryAccounting::SetSampler(Common::MemoryAccounting::Category::GuestMemory, {});
+}
 
 } // namespace Core
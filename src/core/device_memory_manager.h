@@ -114,6 +114,9 @@ public:
 
     void UpdatePagesCachedCount(DAddr addr, size_t size, s32 delta);
 
+    /// Returns how many times the page of the address is marked as cached
+    u8 GetPageCachedCount(DAddr addr);
+
     static constexpr size_t AS_BITS = Traits::device_virtual_bits;
 
 private:
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstring>
+#include <numeric>
 #include <span>
 #include <string_view>
 #include "common/alignment.h"
@@ -199,7 +200,8 @@ RomFSBuildContext::RomFSBuildContext(VirtualDir base_, VirtualDir ext_)
 
 RomFSBuildContext::~RomFSBuildContext() = default;
 
-std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
+std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build(
+    std::vector<std::string>* out_paths) {
     const u64 dir_hash_table_entry_count = romfs_get_hash_table_count(num_dirs);
     const u64 file_hash_table_entry_count = romfs_get_hash_table_count(num_files);
     dir_hash_table_size = 4 * dir_hash_table_entry_count;
@@ -345,10 +347,31 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
                      std::make_shared<VectorVfsFile>(std::move(metadata)));
 
     // Sort the output.
-    std::sort(out.begin(), out.end(),
-              [](const auto& a, const auto& b) { return a.first < b.first; });
+    if (out_paths == nullptr) {
+        std::sort(out.begin(), out.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        return out;
+    }
 
-    return out;
+    // Sort the paths along with the output, empty files can share their offset with another.
+    std::vector<std::string> paths(out.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        paths[i + 1] = files[i]->path;
+    }
+    std::vector<size_t> order(out.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&out](size_t a, size_t b) { return out[a].first < out[b].first; });
+
+    std::vector<std::pair<u64, VirtualFile>> sorted_out;
+    sorted_out.reserve(out.size());
+    out_paths->clear();
+    out_paths->reserve(out.size());
+    for (const size_t index : order) {
+        sorted_out.push_back(std::move(out[index]));
+        out_paths->push_back(std::move(paths[index]));
+    }
+    return sorted_out;
 }
 
 } // namespace FileSys
@@ -22,7 +22,8 @@ public:
     ~RomFSBuildContext();
 
     // This finalizes the context.
-    std::vector<std::pair<u64, VirtualFile>> Build();
+    // If out_paths is set, it receives the RomFS path of each output file, empty for metadata.
+    std::vector<std::pair<u64, VirtualFile>> Build(std::vector<std::string>* out_paths = nullptr);
 
 private:
     VirtualDir base;
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "common/alignment.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
+
+namespace FileSys {
+
+BlockCache::BlockCache(size_t capacity) : m_capacity(capacity) {}
+
+BlockCache& BlockCache::GetInstance() {
+    static BlockCache instance{static_cast<size_t>(Settings::values.romfs_cache_size.GetValue()) *
+                               1_MiB};
+    return instance;
+}
+
+u64 BlockCache::AllocateStorageId() {
+    return m_next_storage_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool BlockCache::Read(u64 storage_id, u64 block_index, u8* buffer, size_t size, size_t offset) {
+    const Key key{storage_id, block_index};
+    Shard& shard = GetShard(key);
+    std::scoped_lock lk{shard.mutex};
+
+    const auto it = shard.entries.find(key);
+    if (it == shard.entries.end() || offset + size > it->second->size) {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Move the block to the front of the LRU list.
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    std::memcpy(buffer, it->second->buffer.GetBuffer() + offset, size);
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void BlockCache::Insert(u64 storage_id, u64 block_index, PooledBuffer&& buffer, size_t size) {
+    const size_t shard_capacity = m_capacity / NumShards;
+    if (size > shard_capacity) {
+        return;
+    }
+
+    const Key key{storage_id, block_index};
+    Shard& shard = GetShard(key);
+    std::scoped_lock lk{shard.mutex};
+
+    // Another reader may have inserted the block while we were reading it.
+    if (shard.entries.contains(key)) {
+        return;
+    }
+
+    // Evict the least recently used blocks until the new one fits.
+    while (shard.used_size + size > shard_capacity) {
+        Entry& victim = shard.lru.back();
+        shard.used_size -= victim.size;
+        m_memory_charge.Add(-static_cast<s64>(victim.size));
+        shard.entries.erase(victim.key);
+        shard.lru.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Entry& entry = shard.lru.emplace_front();
+    entry.key = key;
+    entry.buffer = std::move(buffer);
+    entry.size = size;
+    shard.entries.emplace(key, shard.lru.begin());
+    shard.used_size += size;
+    m_memory_charge.Add(static_cast<s64>(size));
+}
+
+void BlockCache::Erase(u64 storage_id) {
+    for (Shard& shard : m_shards) {
+        std::scoped_lock lk{shard.mutex};
+        for (auto it = shard.lru.begin(); it != shard.lru.end();) {
+            if (it->key.storage_id != storage_id) {
+                ++it;
+                continue;
+            }
+            shard.used_size -= it->size;
+            m_memory_charge.Add(-static_cast<s64>(it->size));
+            shard.entries.erase(it->key);
+            it = shard.lru.erase(it);
+        }
+    }
+}
+
+BlockCache::Statistics BlockCache::GetStatistics() const {
+    Statistics statistics{
+        .hits = m_hits.load(std::memory_order_relaxed),
+        .misses = m_misses.load(std::memory_order_relaxed),
+        .evictions = m_evictions.load(std::memory_order_relaxed),
+        .used_size = 0,
+    };
+    for (const Shard& shard : m_shards) {
+        std::scoped_lock lk{shard.mutex};
+        statistics.used_size += shard.used_size;
+    }
+    return statistics;
+}
+
+BlockCacheStorage::BlockCacheStorage(VirtualFile base_storage, BlockCache& cache)
+    : m_base_storage(std::move(base_storage)), m_cache(cache),
+      m_storage_id(cache.AllocateStorageId()), m_size(m_base_storage->GetSize()) {}
+
+BlockCacheStorage::~BlockCacheStorage() {
+    const u64 hits = m_hits.load(std::memory_order_relaxed);
+    const u64 misses = m_misses.load(std::memory_order_relaxed);
+    if (hits + misses != 0) {
+        LOG_DEBUG(Service_FS, "Block cache hit rate {:.1f}% ({} hits, {} misses)",
+                  static_cast<double>(hits) * 100.0 / static_cast<double>(hits + misses), hits,
+                  misses);
+    }
+    m_cache.Erase(m_storage_id);
+}
+
+size_t BlockCacheStorage::Read(u8* buffer, size_t size, size_t offset) const {
+    // Allow zero-size reads.
+    if (size == 0 || offset >= m_size) {
+        return 0;
+    }
+
+    // Ensure buffer is valid.
+    ASSERT(buffer != nullptr);
+
+    size = std::min(size, m_size - offset);
+    if (size >= MaxCachedReadSize || m_cache.GetCapacity() == 0) {
+        std::scoped_lock lk{m_base_mutex};
+        return m_base_storage->Read(buffer, size, offset);
+    }
+
+    size_t read_size = 0;
+    while (read_size < size) {
+        const size_t cur_offset = offset + read_size;
+        const size_t block_offset = cur_offset % BlockCache::BlockSize;
+        const size_t cur_size = std::min(size - read_size, BlockCache::BlockSize - block_offset);
+        const size_t block_read_size = this->ReadBlock(cur_offset / BlockCache::BlockSize,
+                                                       buffer + read_size, cur_size, block_offset);
+        read_size += block_read_size;
+        if (block_read_size != cur_size) {
+            break;
+        }
+    }
+    return read_size;
+}
+
+size_t BlockCacheStorage::GetSize() const {
+    return m_size;
+}
+
+size_t BlockCacheStorage::ReadBlock(u64 block_index, u8* buffer, size_t size,
+                                    size_t offset) const {
+    if (m_cache.Read(m_storage_id, block_index, buffer, size, offset)) {
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return size;
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Read and decrypt the whole block, so later reads of its neighbours hit.
+    const size_t block_start = block_index * BlockCache::BlockSize;
+    const size_t block_size = std::min(BlockCache::BlockSize, m_size - block_start);
+    PooledBuffer block(BlockCache::BlockSize, BlockCache::BlockSize);
+    size_t block_read_size;
+    {
+        std::scoped_lock lk{m_base_mutex};
+        block_read_size = m_base_storage->Read(reinterpret_cast<u8*>(block.GetBuffer()),
+                                               block_size, block_start);
+    }
+    if (block_read_size <= offset) {
+        return 0;
+    }
+
+    const size_t copy_size = std::min(size, block_read_size - offset);
+    std::memcpy(buffer, block.GetBuffer() + offset, copy_size);
+    m_cache.Insert(m_storage_id, block_index, std::move(block), block_read_size);
+    return copy_size;
+}
+
+} // namespace FileSys
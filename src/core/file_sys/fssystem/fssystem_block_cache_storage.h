@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/memory_accounting.h"
+#include "core/file_sys/fssystem/fs_i_storage.h"
+#include "core/file_sys/fssystem/fssystem_pooled_buffer.h"
+
+namespace FileSys {
+
+/**
+ * Size-bounded LRU cache of storage blocks, shared by every BlockCacheStorage. Entries are split
+ * across shards by key so concurrent readers rarely contend on the same lock.
+ */
+class BlockCache {
+    YUZU_NON_COPYABLE(BlockCache);
+    YUZU_NON_MOVEABLE(BlockCache);
+
+public:
+    static constexpr size_t BlockSize = 16_KiB;
+    static constexpr size_t NumShards = 16;
+
+    struct Statistics {
+        u64 hits;
+        u64 misses;
+        u64 evictions;
+        size_t used_size;
+    };
+
+public:
+    explicit BlockCache(size_t capacity);
+
+    /// Returns the instance used by the NCA storages, sized by the romfs_cache_size setting
+    static BlockCache& GetInstance();
+
+    /// Returns a new id to key the blocks of a storage
+    u64 AllocateStorageId();
+
+    /// Copies size bytes at offset within the cached block to buffer, returns false on a miss
+    bool Read(u64 storage_id, u64 block_index, u8* buffer, size_t size, size_t offset);
+
+    /// Inserts the first size bytes of buffer as the contents of a block
+    void Insert(u64 storage_id, u64 block_index, PooledBuffer&& buffer, size_t size);
+
+    /// Removes every block of a storage
+    void Erase(u64 storage_id);
+
+    [[nodiscard]] size_t GetCapacity() const {
+        return m_capacity;
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const;
+
+private:
+    struct Key {
+        u64 storage_id;
+        u64 block_index;
+
+        friend bool operator==(const Key&, const Key&) = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return static_cast<size_t>((key.storage_id * 0x9E3779B97F4A7C15ULL) ^ key.block_index);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        PooledBuffer buffer;
+        size_t size;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries;
+        size_t used_size = 0;
+    };
+
+    Shard& GetShard(const Key& key) {
+        return m_shards[KeyHash{}(key) % NumShards];
+    }
+
+private:
+    size_t m_capacity;
+    std::array<Shard, NumShards> m_shards;
+    std::atomic<u64> m_next_storage_id{1};
+    std::atomic<u64> m_hits{};
+    std::atomic<u64> m_misses{};
+    std::atomic<u64> m_evictions{};
+    Common::MemoryAccounting::Charge m_memory_charge{
+        Common::MemoryAccounting::Category::FileSystemCache};
+};
+
+/// Serves repeated reads of a storage from the block cache, it does not support writes
+class BlockCacheStorage : public IReadOnlyStorage {
+    YUZU_NON_COPYABLE(BlockCacheStorage);
+    YUZU_NON_MOVEABLE(BlockCacheStorage);
+
+public:
+    /// Reads at least this large bypass the cache, so bulk loads do not flush it
+    static constexpr size_t MaxCachedReadSize = 1_MiB;
+
+public:
+    explicit BlockCacheStorage(VirtualFile base_storage,
+                               BlockCache& cache = BlockCache::GetInstance());
+    ~BlockCacheStorage() override;
+
+    virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
+    virtual size_t GetSize() const override;
+
+private:
+    size_t ReadBlock(u64 block_index, u8* buffer, size_t size, size_t offset) const;
+
+private:
+    VirtualFile m_base_storage;
+    BlockCache& m_cache;
+    u64 m_storage_id;
+    size_t m_size;
+    mutable std::mutex m_base_mutex;
+    mutable std::atomic<u64> m_hits{};
+    mutable std::atomic<u64> m_misses{};
+};
+
+} // namespace FileSys
@@ -9,6 +9,7 @@
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fssystem_bucket_tree.h"
 #include "core/file_sys/fssystem/fssystem_compression_common.h"
+#include "core/file_sys/fssystem/fssystem_parallel_decompressor.h"
 #include "core/file_sys/fssystem/fssystem_pooled_buffer.h"
 #include "core/file_sys/vfs.h"
 
@@ -279,6 +280,81 @@ private:
             R_SUCCEED();
         }
 
+    private:
+        static constexpr int EntriesCountMax = 0x80;
+        struct Entries {
+            CompressionType compression_type;
+            u32 gap_from_prev;
+            u32 physical_size;
+            u32 virtual_size;
+        };
+
+        Result DecompressInParallel(std::array<const char*, EntriesCountMax>& out_decompressed,
+                                    PooledBuffer& out_buffer,
+                                    const std::array<Entries, EntriesCountMax>& entries,
+                                    s32 entry_idx, s32 entry_count, const char* buffer,
+                                    size_t buffer_size) {
+            // Gather the compressed entries held in the buffer, walking it like Read does.
+            std::array<ParallelDecompressor::Job, EntriesCountMax> jobs;
+            std::array<s32, EntriesCountMax> job_entries;
+            size_t job_count = 0;
+            size_t total_virtual_size = 0;
+            for (size_t buffer_offset = 0;
+                 entry_idx < entry_count &&
+                 ((static_cast<size_t>(entries[entry_idx].physical_size) +
+                   static_cast<size_t>(entries[entry_idx].gap_from_prev)) == 0 ||
+                  buffer_offset < buffer_size);
+                 buffer_offset += entries[entry_idx++].physical_size) {
+                buffer_offset += entries[entry_idx].gap_from_prev;
+
+                const auto compression_type = entries[entry_idx].compression_type;
+                if (compression_type == CompressionType::None ||
+                    compression_type == CompressionType::Zeros) {
+                    continue;
+                }
+                const auto decompressor = this->GetDecompressor(compression_type);
+                if (decompressor == nullptr ||
+                    buffer_offset + entries[entry_idx].physical_size > buffer_size) {
+                    // Leave it to the serial path, which reports the error.
+                    continue;
+                }
+                jobs[job_count] = {
+                    .dst = nullptr,
+                    .dst_size = entries[entry_idx].virtual_size,
+                    .src = buffer + buffer_offset,
+                    .src_size = entries[entry_idx].physical_size,
+                    .decompressor = decompressor,
+                };
+                job_entries[job_count++] = entry_idx;
+                total_virtual_size += entries[entry_idx].virtual_size;
+            }
+
+            // A single block gains nothing from the pool, decompress it in place instead.
+            if (job_count < ParallelDecompressor::MinParallelJobs ||
+                jobs[0].dst_size > PooledBuffer::GetAllocatableSizeMax()) {
+                R_SUCCEED();
+            }
+
+            // Lay the output out in one pooled buffer, the jobs that do not fit stay serial.
+            out_buffer.Allocate(total_virtual_size, jobs[0].dst_size);
+            size_t output_offset = 0;
+            size_t fitting_count = 0;
+            for (; fitting_count < job_count; ++fitting_count) {
+                auto& job = jobs[fitting_count];
+                if (output_offset + job.dst_size > out_buffer.GetSize()) {
+                    break;
+                }
+                job.dst = out_buffer.GetBuffer() + output_offset;
+                output_offset += job.dst_size;
+            }
+
+            R_TRY(ParallelDecompressor::Run(std::span(jobs.data(), fitting_count)));
+            for (size_t i = 0; i < fitting_count; ++i) {
+                out_decompressed[job_entries[i]] = static_cast<const char*>(jobs[i].dst);
+            }
+            R_SUCCEED();
+        }
+
     public:
         using ReadImplFunction = std::function<Result(void*, size_t)>;
         using ReadFunction = std::function<Result(size_t, const ReadImplFunction&)>;
@@ -293,13 +369,6 @@ private:
             R_SUCCEED_IF(size == 0);
 
             // Declare read lambda.
-            constexpr int EntriesCountMax = 0x80;
-            struct Entries {
-                CompressionType compression_type;
-                u32 gap_from_prev;
-                u32 physical_size;
-                u32 virtual_size;
-            };
             std::array<Entries, EntriesCountMax> entries;
             s32 entry_count = 0;
             Entry prev_entry = {
@@ -380,6 +449,14 @@ private:
                             m_data_storage->Read(reinterpret_cast<u8*>(buffer), cur_read_size,
                                                  required_access_physical_offset);
 
+                            // Decompress the compressed entries we read ahead of time, in
+                            // parallel when there are several of them.
+                            std::array<const char*, EntriesCountMax> decompressed{};
+                            PooledBuffer decompressed_buffer;
+                            R_TRY(this->DecompressInParallel(
+                                decompressed, decompressed_buffer, entries, entry_idx,
+                                entry_count, buffer, cur_read_size));
+
                             // Decompress the data.
                             size_t buffer_offset;
                             for (buffer_offset = 0;
@@ -450,6 +527,14 @@ private:
                                                         ASSERT(dst_size ==
                                                                entries[entry_idx].virtual_size);
 
+                                                        // Use the data if we already have it.
+                                                        if (decompressed[entry_idx] != nullptr) {
+                                                            std::memcpy(dst,
+                                                                        decompressed[entry_idx],
+                                                                        dst_size);
+                                                            R_SUCCEED();
+                                                        }
+
                                                         // Perform the decompression.
                                                         R_RETURN(decompressor(
                                                             dst, entries[entry_idx].virtual_size,
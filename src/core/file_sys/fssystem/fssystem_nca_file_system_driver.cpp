@@ -5,6 +5,7 @@
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
 #include "core/file_sys/fssystem/fssystem_alignment_matching_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
 #include "core/file_sys/fssystem/fssystem_compressed_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_integrity_verification_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
@@ -279,6 +280,13 @@ Result NcaFileSystemDriver::OpenStorageImpl(VirtualFile* out, NcaFsHeaderReader*
         storage = std::move(indirect_storage);
     }
 
+    // Cache decrypted blocks, so repeated reads of the same region skip the bucket tree lookups
+    // and decryption below.
+    if (out_header_reader->GetEncryptionType() != NcaFsHeader::EncryptionType::None ||
+        patch_info.HasIndirectTable()) {
+        storage = std::make_shared<BlockCacheStorage>(std::move(storage));
+    }
+
     // Check if we're sparse or requested to skip the integrity layer.
     if (out_header_reader->ExistsSparseLayer() || (ctx != nullptr && ctx->open_raw_storage)) {
         *out = std::move(storage);
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/thread_worker.h"
+#include "core/file_sys/errors.h"
+#include "core/file_sys/fssystem/fssystem_parallel_decompressor.h"
+
+namespace FileSys {
+
+namespace {
+
+constexpr size_t MaxWorkers = 4;
+
+Common::ThreadWorker& GetWorkers() {
+    static Common::ThreadWorker workers{
+        std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, MaxWorkers),
+        "FsDecompress"};
+    return workers;
+}
+
+/// Shared with the helpers, which may only start once the caller is done with every job
+struct Batch {
+    std::vector<ParallelDecompressor::Job> jobs;
+    std::atomic<size_t> next_job{};
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t num_done{};
+    Result result{ResultSuccess};
+
+    void Work() {
+        size_t num_ran = 0;
+        Result first_failure{ResultSuccess};
+        for (size_t index = next_job.fetch_add(1, std::memory_order_relaxed); index < jobs.size();
+             index = next_job.fetch_add(1, std::memory_order_relaxed)) {
+            const auto& job = jobs[index];
+            const Result rc = job.decompressor(job.dst, job.dst_size, job.src, job.src_size);
+            if (R_FAILED(rc) && R_SUCCEEDED(first_failure)) {
+                first_failure = rc;
+            }
+            ++num_ran;
+        }
+        if (num_ran == 0) {
+            return;
+        }
+        bool is_last;
+        {
+            std::scoped_lock lk{mutex};
+            if (R_FAILED(first_failure) && R_SUCCEEDED(result)) {
+                result = first_failure;
+            }
+            num_done += num_ran;
+            is_last = num_done == jobs.size();
+        }
+        if (is_last) {
+            cv.notify_all();
+        }
+    }
+};
+
+} // Anonymous namespace
+
+Result ParallelDecompressor::Run(std::span<const Job> jobs) {
+    if (jobs.size() < MinParallelJobs) {
+        for (const auto& job : jobs) {
+            R_TRY(job.decompressor(job.dst, job.dst_size, job.src, job.src_size));
+        }
+        R_SUCCEED();
+    }
+
+    const auto batch = std::make_shared<Batch>();
+    batch->jobs.assign(jobs.begin(), jobs.end());
+
+    auto& workers = GetWorkers();
+    const size_t num_helpers = std::min(workers.NumWorkers(), jobs.size() - 1);
+    for (size_t i = 0; i < num_helpers; ++i) {
+        workers.QueueWork([batch] { batch->Work(); });
+    }
+    batch->Work();
+
+    std::unique_lock lk{batch->mutex};
+    batch->cv.wait(lk, [&batch] { return batch->num_done == batch->jobs.size(); });
+    R_RETURN(batch->result);
+}
+
+} // namespace FileSys
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "core/file_sys/fssystem/fssystem_compression_common.h"
+
+namespace FileSys {
+
+/// Decompresses independent blocks on a worker pool shared by every compressed storage
+class ParallelDecompressor {
+public:
+    struct Job {
+        void* dst;
+        size_t dst_size;
+        const void* src;
+        size_t src_size;
+        DecompressorFunction decompressor;
+    };
+
+    /// Batches smaller than this are decompressed on the calling thread
+    static constexpr size_t MinParallelJobs = 2;
+
+    /**
+     * Runs every job and waits for them to finish. The calling thread decompresses too, so the
+     * batch completes even when the pool is busy with other readers.
+     * @returns The first failure of a job, or success
+     */
+    static Result Run(std::span<const Job> jobs);
+};
+
+} // namespace FileSys
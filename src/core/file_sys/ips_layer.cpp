@@ -4,13 +4,15 @@
 #include <algorithm>
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
+#include "common/cityhash.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
-#include "common/swap.h"
 #include "core/file_sys/ips_layer.h"
 #include "core/file_sys/vfs_vector.h"
 
@@ -36,7 +38,7 @@ constexpr std::array<std::pair<const char*, const char*>, 11> ESCAPE_CHARACTER_M
     {"\\\?", "\?"},
 }};
 
-static IPSFileType IdentifyMagic(const std::vector<u8>& magic) {
+static IPSFileType IdentifyMagic(std::span<const u8> magic) {
     if (magic.size() != 5) {
         return IPSFileType::Error;
     }
@@ -54,7 +56,7 @@ static IPSFileType IdentifyMagic(const std::vector<u8>& magic) {
     return IPSFileType::Error;
 }
 
-static bool IsEOF(IPSFileType type, const std::vector<u8>& data) {
+static bool IsEOF(IPSFileType type, std::span<const u8> data) {
     static constexpr std::array<u8, 3> eof{{'E', 'O', 'F'}};
     if (type == IPSFileType::IPS && std::equal(data.begin(), data.end(), eof.begin())) {
         return true;
@@ -68,69 +70,94 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
     if (in == nullptr || ips == nullptr)
         return nullptr;
 
-    const auto type = IdentifyMagic(ips->ReadBytes(0x5));
-    if (type == IPSFileType::Error)
-        return nullptr;
-
     auto in_data = in->ReadAllBytes();
-    if (in_data.size() == 0) {
+    if (!PatchIPS(in_data, ips)) {
         return nullptr;
     }
 
-    std::vector<u8> temp(type == IPSFileType::IPS ? 3 : 4);
-    u64 offset = 5; // After header
-    while (ips->Read(temp.data(), temp.size(), offset) == temp.size()) {
-        offset += temp.size();
-        if (IsEOF(type, temp)) {
+    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
+                                           in->GetContainingDirectory());
+}
+
+bool PatchIPS(std::vector<u8>& data, const VirtualFile& ips) {
+    if (ips == nullptr || data.empty())
+        return false;
+
+    const auto patch = ips->ReadAllBytes();
+    const auto type = IdentifyMagic(std::span(patch).first(std::min<size_t>(patch.size(), 5)));
+    if (type == IPSFileType::Error)
+        return false;
+
+    // Records are validated before any is written, so an invalid patch leaves the data untouched
+    struct Record {
+        u32 offset;
+        u32 size;
+        /// Offset of the bytes in the patch, or the value to fill with for RLE records
+        size_t source;
+        bool is_rle;
+    };
+    std::vector<Record> records;
+
+    const size_t address_size = type == IPSFileType::IPS ? 3 : 4;
+    const auto read_u16 = [&patch](size_t offset) {
+        return static_cast<u16>((patch[offset] << 8) | patch[offset + 1]);
+    };
+    size_t offset = 5; // After header
+    bool is_eof = false;
+    while (offset + address_size <= patch.size()) {
+        const std::span<const u8> address(patch.data() + offset, address_size);
+        offset += address_size;
+        if (IsEOF(type, address)) {
+            is_eof = true;
             break;
         }
 
         u32 real_offset{};
         if (type == IPSFileType::IPS32)
-            real_offset = (temp[0] << 24) | (temp[1] << 16) | (temp[2] << 8) | temp[3];
+            real_offset = (address[0] << 24) | (address[1] << 16) | (address[2] << 8) | address[3];
         else
-            real_offset = (temp[0] << 16) | (temp[1] << 8) | temp[2];
+            real_offset = (address[0] << 16) | (address[1] << 8) | address[2];
 
-        if (real_offset > in_data.size()) {
-            return nullptr;
+        if (real_offset > data.size()) {
+            return false;
         }
 
-        u16 data_size{};
-        if (ips->ReadObject(&data_size, offset) != sizeof(u16))
-            return nullptr;
-        data_size = Common::swap16(data_size);
+        if (offset + sizeof(u16) > patch.size())
+            return false;
+        const u16 data_size = read_u16(offset);
         offset += sizeof(u16);
 
         if (data_size == 0) { // RLE
-            u16 rle_size{};
-            if (ips->ReadObject(&rle_size, offset) != sizeof(u16))
-                return nullptr;
-            rle_size = Common::swap16(rle_size);
+            if (offset + sizeof(u16) + 1 > patch.size())
+                return false;
+            u32 rle_size = read_u16(offset);
             offset += sizeof(u16);
+            const u8 value = patch[offset++];
 
-            const auto data = ips->ReadByte(offset++);
-            if (!data)
-                return nullptr;
-
-            if (real_offset + rle_size > in_data.size())
-                rle_size = static_cast<u16>(in_data.size() - real_offset);
-            std::memset(in_data.data() + real_offset, *data, rle_size);
+            if (real_offset + rle_size > data.size())
+                rle_size = static_cast<u32>(data.size() - real_offset);
+            records.push_back({real_offset, rle_size, value, true});
         } else { // Standard Patch
-            auto read = data_size;
-            if (real_offset + read > in_data.size())
-                read = static_cast<u16>(in_data.size() - real_offset);
-            if (ips->Read(in_data.data() + real_offset, read, offset) != data_size)
-                return nullptr;
+            // Records that do not fit in the data make the patch invalid
+            if (real_offset + data_size > data.size() || offset + data_size > patch.size())
+                return false;
+            records.push_back({real_offset, data_size, offset, false});
             offset += data_size;
         }
     }
 
-    if (!IsEOF(type, temp)) {
-        return nullptr;
+    if (!is_eof) {
+        return false;
     }
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    for (const Record& record : records) {
+        if (record.is_rle) {
+            std::memset(data.data() + record.offset, static_cast<u8>(record.source), record.size);
+        } else {
+            std::memcpy(data.data() + record.offset, patch.data() + record.source, record.size);
+        }
+    }
+    return true;
 }
 
 struct IPSwitchCompiler::IPSwitchPatch {
@@ -140,7 +167,12 @@ struct IPSwitchCompiler::IPSwitchPatch {
 };
 
 IPSwitchCompiler::IPSwitchCompiler(VirtualFile patch_text_) : patch_text(std::move(patch_text_)) {
-    Parse();
+    Parse(patch_text->ReadAllBytes());
+}
+
+IPSwitchCompiler::IPSwitchCompiler(VirtualFile patch_text_, std::span<const u8> bytes)
+    : patch_text(std::move(patch_text_)) {
+    Parse(bytes);
 }
 
 IPSwitchCompiler::~IPSwitchCompiler() = default;
@@ -185,8 +217,7 @@ void IPSwitchCompiler::ParseFlag(const std::string& line) {
     }
 }
 
-void IPSwitchCompiler::Parse() {
-    const auto bytes = patch_text->ReadAllBytes();
+void IPSwitchCompiler::Parse(std::span<const u8> bytes) {
     std::stringstream s;
     s.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
 
@@ -321,24 +352,55 @@ VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
         return nullptr;
 
     auto in_data = in->ReadAllBytes();
+    Apply(in_data);
+
+    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
+                                           in->GetContainingDirectory());
+}
+
+void IPSwitchCompiler::Apply(std::vector<u8>& data) const {
+    if (!valid)
+        return;
 
     for (const auto& patch : patches) {
         if (!patch.enabled)
             continue;
 
         for (const auto& record : patch.records) {
-            if (record.first >= in_data.size())
+            if (record.first >= data.size())
                 continue;
             auto replace_size = record.second.size();
-            if (record.first + replace_size > in_data.size())
-                replace_size = in_data.size() - record.first;
-            for (std::size_t i = 0; i < replace_size; ++i)
-                in_data[i + record.first] = record.second[i];
+            if (record.first + replace_size > data.size())
+                replace_size = data.size() - record.first;
+            std::memcpy(data.data() + record.first, record.second.data(), replace_size);
+        }
+    }
+}
+
+std::shared_ptr<const IPSwitchCompiler> CompileIPSwitch(const VirtualFile& patch_text) {
+    // Mods rarely ship more than a handful of patches per title, the cache is only dropped as a
+    // safety net against unbounded growth
+    static constexpr size_t MAX_CACHED_PATCHES = 256;
+    static std::mutex mutex;
+    static std::unordered_map<u64, std::shared_ptr<const IPSwitchCompiler>> compiled_patches;
+
+    const auto bytes = patch_text->ReadAllBytes();
+    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    {
+        std::scoped_lock lk{mutex};
+        const auto it = compiled_patches.find(hash);
+        if (it != compiled_patches.end()) {
+            return it->second;
         }
     }
+    auto compiler = std::make_shared<const IPSwitchCompiler>(patch_text, bytes);
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    std::scoped_lock lk{mutex};
+    if (compiled_patches.size() >= MAX_CACHED_PATCHES) {
+        compiled_patches.clear();
+    }
+    compiled_patches.emplace(hash, compiler);
+    return compiler;
 }
 
 } // namespace FileSys
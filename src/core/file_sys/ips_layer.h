@@ -5,6 +5,7 @@
 
 #include <array>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "common/common_types.h"
@@ -14,20 +15,29 @@ namespace FileSys {
 
 VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips);
 
+/// Applies an IPS patch in place, leaving the data unchanged and returning false when the patch is
+/// invalid
+bool PatchIPS(std::vector<u8>& data, const VirtualFile& ips);
+
 class IPSwitchCompiler {
 public:
     explicit IPSwitchCompiler(VirtualFile patch_text);
+    /// Compiles patch text that was already read from the file
+    explicit IPSwitchCompiler(VirtualFile patch_text, std::span<const u8> bytes);
     ~IPSwitchCompiler();
 
     std::array<u8, 0x20> GetBuildID() const;
     bool IsValid() const;
     VirtualFile Apply(const VirtualFile& in) const;
 
+    /// Applies the enabled patches in place
+    void Apply(std::vector<u8>& data) const;
+
 private:
     struct IPSwitchPatch;
 
     void ParseFlag(const std::string& flag);
-    void Parse();
+    void Parse(std::span<const u8> bytes);
 
     bool valid = false;
 
@@ -40,4 +50,8 @@ private:
     std::string last_comment = "";
 };
 
+/// Returns the compiled patch of an IPSwitch file, shared by every file with the same text so each
+/// patch is parsed once for all the NSOs it is checked against
+std::shared_ptr<const IPSwitchCompiler> CompileIPSwitch(const VirtualFile& patch_text);
+
 } // namespace FileSys
@@ -21,9 +21,9 @@
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs.h"
+#include "core/file_sys/romfs_build_cache.h"
 #include "core/file_sys/vfs_cached.h"
 #include "core/file_sys/vfs_layered.h"
-#include "core/file_sys/vfs_vector.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/ns/language.h"
 #include "core/hle/service/set/settings_server.h"
@@ -212,11 +212,11 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
+                    const auto compiler = CompileIPSwitch(file);
+                    if (!compiler->IsValid())
                         continue;
 
-                    const auto this_build_id = Common::HexToString(compiler.GetBuildID());
+                    const auto this_build_id = Common::HexToString(compiler->GetBuildID());
                     if (nso_build_id == this_build_id)
                         out.push_back(file);
                 }
@@ -273,16 +273,11 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
         if (patch_file->GetExtension() == "ips") {
             LOG_INFO(Loader, "    - Applying IPS patch from mod \"{}\"",
                      patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const auto patched = PatchIPS(std::make_shared<VectorVfsFile>(out), patch_file);
-            if (patched != nullptr)
-                out = patched->ReadAllBytes();
+            PatchIPS(out, patch_file);
         } else if (patch_file->GetExtension() == "pchtxt") {
             LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"",
                      patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const IPSwitchCompiler compiler{patch_file};
-            const auto patched = compiler.Apply(std::make_shared<VectorVfsFile>(out));
-            if (patched != nullptr)
-                out = patched->ReadAllBytes();
+            CompileIPSwitch(patch_file)->Apply(out);
         }
     }
 
@@ -395,21 +390,22 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
         return;
     }
 
-    auto extracted = ExtractRomFS(romfs);
-    if (extracted == nullptr) {
+    // Reuse the layout of the last build if neither the base RomFS nor the mods changed
+    const RomFSBuildCache build_cache{title_id, type, romfs, std::move(layers),
+                                      std::move(layers_ext)};
+    auto packed = build_cache.Load();
+    if (packed != nullptr) {
+        LOG_INFO(Loader, "    RomFS: LayeredFS patches applied from the build cache");
+        romfs = std::move(packed);
         return;
     }
 
-    layers.emplace_back(std::move(extracted));
-
-    auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers));
-    if (layered == nullptr) {
+    auto extracted = ExtractRomFS(romfs);
+    if (extracted == nullptr) {
         return;
     }
 
-    auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers_ext));
-
-    auto packed = CreateRomFS(std::move(layered), std::move(layered_ext));
+    packed = build_cache.Build(std::move(extracted));
     if (packed == nullptr) {
         return;
     }
@@ -4,12 +4,18 @@
 #include <algorithm>
 #include <random>
 #include <regex>
+#include <thread>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/boot_timeline.h"
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/thread_worker.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/common_funcs.h"
@@ -18,6 +24,7 @@
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs_concat.h"
+#include "core/file_sys/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -412,28 +419,211 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
     return ids;
 }
 
+namespace {
+
+constexpr u32 ContentIndexMagic = Common::MakeMagic('R', 'C', 'I', 'X');
+constexpr u32 ContentIndexVersion = 1;
+
+/// What is known about an NCA of a registered cache, reused while its file is unchanged
+struct ContentIndexEntry {
+    u64 size{};
+    u64 modified{};
+    bool is_meta{};
+    u64 title_id{};
+    std::vector<u8> cnmt;
+};
+
+using ContentIndex = std::map<NcaID, ContentIndexEntry>;
+
+struct ContentIndexHeader {
+    u32 magic;
+    u32 version;
+    u64 num_entries;
+};
+static_assert(sizeof(ContentIndexHeader) == 0x10, "ContentIndexHeader has incorrect size.");
+
+struct ContentIndexRecord {
+    NcaID id;
+    u64 size;
+    u64 modified;
+    u64 title_id;
+    u32 is_meta;
+    u32 cnmt_size;
+};
+static_assert(sizeof(ContentIndexRecord) == 0x30, "ContentIndexRecord has incorrect size.");
+
+std::filesystem::path GetContentIndexPath(const VirtualDir& dir) {
+    const auto full_path = dir->GetFullPath();
+    if (full_path.empty()) {
+        return {};
+    }
+    return Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "content_index" /
+           fmt::format("{:016X}.bin", Common::CityHash64(full_path.data(), full_path.size()));
+}
+
+ContentIndex LoadContentIndex(const std::filesystem::path& path) {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return {};
+    }
+
+    ContentIndexHeader header{};
+    if (!file.ReadObject(header) || header.magic != ContentIndexMagic ||
+        header.version != ContentIndexVersion) {
+        return {};
+    }
+
+    const u64 file_size = file.GetSize();
+    ContentIndex index;
+    for (u64 i = 0; i < header.num_entries; ++i) {
+        ContentIndexRecord record{};
+        if (!file.ReadObject(record)) {
+            return {};
+        }
+        // A corrupt index must not make us allocate more than the file can hold
+        const s64 position = file.Tell();
+        if (position < 0 || record.cnmt_size > file_size - static_cast<u64>(position)) {
+            return {};
+        }
+        ContentIndexEntry entry{
+            .size = record.size,
+            .modified = record.modified,
+            .is_meta = record.is_meta != 0,
+            .title_id = record.title_id,
+            .cnmt = std::vector<u8>(record.cnmt_size),
+        };
+        if (file.ReadSpan(std::span{entry.cnmt}) != entry.cnmt.size()) {
+            return {};
+        }
+        index.insert_or_assign(record.id, std::move(entry));
+    }
+    return index;
+}
+
+void StoreContentIndex(const std::filesystem::path& path, const ContentIndex& index) {
+    if (!Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    const ContentIndexHeader header{
+        .magic = ContentIndexMagic,
+        .version = ContentIndexVersion,
+        .num_entries = index.size(),
+    };
+    bool success = file.IsOpen() && file.WriteObject(header);
+    for (auto it = index.begin(); it != index.end() && success; ++it) {
+        const auto& [id, entry] = *it;
+        const ContentIndexRecord record{
+            .id = id,
+            .size = entry.size,
+            .modified = entry.modified,
+            .title_id = entry.title_id,
+            .is_meta = entry.is_meta ? 1U : 0U,
+            .cnmt_size = static_cast<u32>(entry.cnmt.size()),
+        };
+        success = file.WriteObject(record) &&
+                  file.WriteSpan(std::span<const u8>{entry.cnmt}) == entry.cnmt.size();
+    }
+    if (!success) {
+        LOG_WARNING(Loader, "Failed to write the content index at {}",
+                    Common::FS::PathToUTF8String(path));
+    }
+}
+
+} // Anonymous namespace
+
 void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
-    for (const auto& id : ids) {
-        const auto file = GetFileAtID(id);
+    struct ScannedFile {
+        NcaID id;
+        VirtualFile file;
+        ContentIndexEntry entry;
+        bool is_known;
+    };
 
-        if (file == nullptr)
+    // Reuse what the index knows about the files that did not change since the last scan.
+    const auto index_path = GetContentIndexPath(dir);
+    auto index = index_path.empty() ? ContentIndex{} : LoadContentIndex(index_path);
+    std::vector<ScannedFile> scanned;
+    std::vector<size_t> new_files;
+    scanned.reserve(ids.size());
+    for (const auto& id : ids) {
+        auto file = GetFileAtID(id);
+        if (file == nullptr) {
             continue;
-        const auto nca = std::make_shared<NCA>(parser(file, id));
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
+        }
+
+        ScannedFile& cur = scanned.emplace_back(ScannedFile{.id = id, .is_known = false});
+        cur.entry.size = file->GetSize();
+        if (const auto parent = file->GetContainingDirectory(); parent != nullptr) {
+            cur.entry.modified = parent->GetFileTimeStamp(file->GetName()).modified;
+        }
+        if (const auto it = index.find(id); it != index.end() &&
+                                            it->second.size == cur.entry.size &&
+                                            it->second.modified == cur.entry.modified &&
+                                            cur.entry.modified != 0) {
+            cur.entry = std::move(it->second);
+            cur.is_known = true;
             continue;
         }
+        cur.file = std::move(file);
+        new_files.push_back(scanned.size() - 1);
+    }
 
-        const auto section0 = nca->GetSubdirectories()[0];
+    const auto parse_file = [this](ScannedFile& cur) {
+        const auto nca = std::make_shared<NCA>(parser(cur.file, cur.id));
+        cur.file = nullptr;
+        if (nca->GetStatus() != Loader::ResultStatus::Success) {
+            // Not remembered, the keys needed to parse it may show up later.
+            return;
+        }
+        cur.is_known = true;
+        if (nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
+            return;
+        }
 
+        const auto section0 = nca->GetSubdirectories()[0];
         for (const auto& section0_file : section0->GetFiles()) {
             if (section0_file->GetExtension() != "cnmt")
                 continue;
 
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
-            meta_id.insert_or_assign(nca->GetTitleId(), id);
+            cur.entry.is_meta = true;
+            cur.entry.title_id = nca->GetTitleId();
+            cur.entry.cnmt = section0_file->ReadAllBytes();
             break;
         }
+    };
+
+    // Parse the new files, the first one on this thread so lazily derived keys are ready before
+    // the others are parsed in parallel.
+    if (!new_files.empty()) {
+        parse_file(scanned[new_files.front()]);
+    }
+    if (new_files.size() > 1) {
+        Common::ThreadWorker workers{
+            std::clamp<size_t>(std::thread::hardware_concurrency(), 1, new_files.size() - 1),
+            "ContentScan"};
+        for (size_t i = 1; i < new_files.size(); ++i) {
+            workers.QueueWork([&parse_file, &cur = scanned[new_files[i]]] { parse_file(cur); });
+        }
+        workers.WaitForRequests();
+    }
+
+    ContentIndex new_index;
+    for (auto& cur : scanned) {
+        if (cur.entry.is_meta) {
+            meta.insert_or_assign(cur.entry.title_id,
+                                  CNMT(std::make_shared<VectorVfsFile>(cur.entry.cnmt)));
+            meta_id.insert_or_assign(cur.entry.title_id, cur.id);
+        }
+        if (cur.is_known) {
+            new_index.insert_or_assign(cur.id, std::move(cur.entry));
+        }
+    }
+
+    if (!index_path.empty() && (!new_files.empty() || new_index.size() != index.size())) {
+        StoreContentIndex(index_path, new_index);
     }
 }
 
@@ -457,6 +647,7 @@ void RegisteredCache::Refresh() {
     if (dir == nullptr) {
         return;
     }
+    const Common::BootTimeline::ScopedStage boot_stage{"registered_cache_scan"};
 
     const auto ids = AccumulateFiles();
     ProcessFiles(ids);
@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/file_sys/fsmitm_romfsbuild.h"
+#include "core/file_sys/romfs_build_cache.h"
+#include "core/file_sys/vfs.h"
+#include "core/file_sys/vfs_concat.h"
+#include "core/file_sys/vfs_layered.h"
+#include "core/file_sys/vfs_offset.h"
+#include "core/file_sys/vfs_vector.h"
+
+namespace FileSys {
+namespace {
+
+constexpr u32 CacheMagic = Common::MakeMagic('R', 'F', 'B', 'C');
+constexpr u32 CacheVersion = 1;
+
+struct CacheHeader {
+    u32 magic;
+    u32 version;
+    u64 fingerprint;
+    u64 num_entries;
+};
+static_assert(sizeof(CacheHeader) == 0x18, "CacheHeader has incorrect size.");
+
+enum class EntryKind : u32 {
+    Data,  // Built metadata, stored inline
+    Base,  // File of the base RomFS, stored as its offset in it
+    Layer, // File of a mod layer, stored as its path
+};
+
+struct CacheEntry {
+    u64 offset;
+    u64 size;
+    u64 base_offset;
+    EntryKind kind;
+    u32 layer;
+    u32 path_size;
+    INSERT_PADDING_BYTES(4);
+};
+static_assert(sizeof(CacheEntry) == 0x28, "CacheEntry has incorrect size.");
+
+struct BaseRomFSHeader {
+    u64 header_size;
+    std::array<u64, 8> tables;
+    u64 data_offset;
+};
+static_assert(sizeof(BaseRomFSHeader) == 0x50, "BaseRomFSHeader has incorrect size.");
+
+template <typename T>
+void AppendObject(std::string& key, const T& object) {
+    key.append(reinterpret_cast<const char*>(&object), sizeof(T));
+}
+
+void AppendTree(std::string& key, const VirtualDir& dir, const std::string& dir_path) {
+    for (const auto& file : dir->GetFiles()) {
+        key += dir_path;
+        key += '/';
+        key += file->GetName();
+        key += '\0';
+        AppendObject(key, static_cast<u64>(file->GetSize()));
+    }
+    for (const auto& subdir : dir->GetSubdirectories()) {
+        AppendTree(key, subdir, dir_path + '/' + subdir->GetName());
+    }
+}
+
+void AppendBaseMetadata(std::string& key, const VirtualFile& base_romfs) {
+    BaseRomFSHeader header{};
+    if (base_romfs->ReadObject(&header) != sizeof(header)) {
+        return;
+    }
+    AppendObject(key, header);
+    AppendObject(key, static_cast<u64>(base_romfs->GetSize()));
+
+    // The directory and file tables, the hash tables are derived from them.
+    for (const size_t table : {2, 6}) {
+        const auto data = base_romfs->ReadBytes(header.tables[table + 1], header.tables[table]);
+        key.append(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+}
+
+} // Anonymous namespace
+
+RomFSBuildCache::RomFSBuildCache(u64 title_id, ContentRecordType type, VirtualFile base_romfs_,
+                                 std::vector<VirtualDir> layers_,
+                                 std::vector<VirtualDir> ext_layers_)
+    : path{Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "romfs" /
+           fmt::format("{:016X}_{}.bin", title_id, static_cast<u32>(type))},
+      base_romfs{std::move(base_romfs_)}, layers{std::move(layers_)},
+      ext_layers{std::move(ext_layers_)} {
+    std::string key;
+    AppendBaseMetadata(key, base_romfs);
+    for (const auto& layer : layers) {
+        key += 'L';
+        AppendTree(key, layer, "");
+    }
+    for (const auto& layer : ext_layers) {
+        key += 'E';
+        AppendTree(key, layer, "");
+    }
+    fingerprint = Common::CityHash64(key.data(), key.size());
+}
+
+RomFSBuildCache::~RomFSBuildCache() = default;
+
+VirtualFile RomFSBuildCache::Load() const {
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return nullptr;
+    }
+
+    CacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != CacheMagic ||
+        header.version != CacheVersion || header.fingerprint != fingerprint) {
+        return nullptr;
+    }
+
+    std::vector<std::pair<u64, VirtualFile>> out;
+    out.reserve(header.num_entries);
+    for (u64 i = 0; i < header.num_entries; ++i) {
+        CacheEntry entry{};
+        if (!file.ReadObject(entry)) {
+            return nullptr;
+        }
+
+        VirtualFile source;
+        switch (entry.kind) {
+        case EntryKind::Data: {
+            std::vector<u8> data(entry.size);
+            if (file.ReadSpan(std::span{data}) != data.size()) {
+                return nullptr;
+            }
+            source = std::make_shared<VectorVfsFile>(std::move(data));
+            break;
+        }
+        case EntryKind::Base:
+            if (entry.base_offset + entry.size > base_romfs->GetSize()) {
+                return nullptr;
+            }
+            source = std::make_shared<OffsetVfsFile>(base_romfs, entry.size, entry.base_offset);
+            break;
+        case EntryKind::Layer: {
+            std::string layer_path(entry.path_size, '\0');
+            if (entry.layer >= layers.size() ||
+                file.ReadSpan(std::span{layer_path}) != layer_path.size()) {
+                return nullptr;
+            }
+            source = layers[entry.layer]->GetFileRelative(layer_path);
+            if (source == nullptr || source->GetSize() != entry.size) {
+                return nullptr;
+            }
+            break;
+        }
+        default:
+            return nullptr;
+        }
+        out.emplace_back(entry.offset, std::move(source));
+    }
+
+    std::string name = layers.empty() ? "" : layers.front()->GetName();
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, std::move(name), std::move(out));
+}
+
+VirtualFile RomFSBuildCache::Build(VirtualDir base_dir) const {
+    auto all_layers = layers;
+    all_layers.push_back(base_dir);
+    auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(all_layers));
+    if (layered == nullptr) {
+        return nullptr;
+    }
+    auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(ext_layers);
+
+    RomFSBuildContext ctx{layered, std::move(layered_ext)};
+    std::vector<std::string> paths;
+    auto out = ctx.Build(&paths);
+    Store(out, paths, base_dir);
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, layered->GetName(), std::move(out));
+}
+
+void RomFSBuildCache::Store(const std::vector<std::pair<u64, VirtualFile>>& out,
+                            const std::vector<std::string>& paths,
+                            const VirtualDir& base_dir) const {
+    // Describe every file by where it comes from, before writing anything.
+    std::vector<CacheEntry> entries(out.size());
+    std::vector<std::vector<u8>> data(out.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+        const auto& [offset, source] = out[i];
+        auto& entry = entries[i];
+        entry.offset = offset;
+        entry.size = source->GetSize();
+
+        if (paths[i].empty()) {
+            entry.kind = EntryKind::Data;
+            data[i] = source->ReadAllBytes();
+            continue;
+        }
+
+        // The first layer holding the path provides the file, like in LayeredVfsDirectory.
+        bool found = false;
+        for (u32 layer = 0; layer < layers.size() && !found; ++layer) {
+            const auto layer_file = layers[layer]->GetFileRelative(paths[i]);
+            if (layer_file == nullptr) {
+                continue;
+            }
+            if (layer_file != source) {
+                // Patched at build time, IPS patches are applied in memory.
+                return;
+            }
+            entry.kind = EntryKind::Layer;
+            entry.layer = layer;
+            entry.path_size = static_cast<u32>(paths[i].size());
+            found = true;
+        }
+        if (found) {
+            continue;
+        }
+
+        const auto base_file = std::dynamic_pointer_cast<OffsetVfsFile>(source);
+        if (base_file == nullptr || base_dir->GetFileRelative(paths[i]) != source) {
+            return;
+        }
+        entry.kind = EntryKind::Base;
+        entry.base_offset = base_file->GetOffset();
+    }
+
+    if (!Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_WARNING(Loader, "Failed to create the RomFS build cache at {}",
+                    Common::FS::PathToUTF8String(path));
+        return;
+    }
+
+    const CacheHeader header{
+        .magic = CacheMagic,
+        .version = CacheVersion,
+        .fingerprint = fingerprint,
+        .num_entries = entries.size(),
+    };
+    bool success = file.WriteObject(header);
+    for (size_t i = 0; i < entries.size() && success; ++i) {
+        success = file.WriteObject(entries[i]);
+        if (entries[i].kind == EntryKind::Data) {
+            success = success && file.WriteSpan(std::span<const u8>{data[i]}) == data[i].size();
+        } else if (entries[i].kind == EntryKind::Layer) {
+            success = success && file.WriteSpan(std::span<const char>{paths[i]}) == paths[i].size();
+        }
+    }
+    if (!success) {
+        LOG_WARNING(Loader, "Failed to write the RomFS build cache at {}",
+                    Common::FS::PathToUTF8String(path));
+    }
+}
+
+} // namespace FileSys
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/nca_metadata.h"
+#include "core/file_sys/vfs_types.h"
+
+namespace FileSys {
+
+/**
+ * Persistent cache of the RomFS images built from LayeredFS mods.
+ *
+ * Building only depends on the names and sizes of the layered files, so the layout is keyed by
+ * the base RomFS metadata and the file trees of the mod layers. On a hit the image is assembled
+ * from the cached layout without extracting the base RomFS or merging the layers again.
+ */
+class RomFSBuildCache {
+public:
+    RomFSBuildCache(u64 title_id, ContentRecordType type, VirtualFile base_romfs,
+                    std::vector<VirtualDir> layers, std::vector<VirtualDir> ext_layers);
+    ~RomFSBuildCache();
+
+    /// Returns the cached RomFS, or nullptr if the layers changed since it was stored
+    VirtualFile Load() const;
+
+    /// Builds the RomFS of the layers over the extracted base RomFS and stores its layout
+    VirtualFile Build(VirtualDir base_dir) const;
+
+private:
+    void Store(const std::vector<std::pair<u64, VirtualFile>>& out,
+               const std::vector<std::string>& paths, const VirtualDir& base_dir) const;
+
+    std::filesystem::path path;
+    VirtualFile base_romfs;
+    std::vector<VirtualDir> layers;
+    std::vector<VirtualDir> ext_layers;
+    u64 fingerprint{};
+};
+
+} // namespace FileSys
@@ -3,11 +3,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "core/file_sys/vfs.h"
@@ -28,6 +30,9 @@ namespace {
 
 constexpr size_t MaxOpenFiles = 512;
 
+/// Most closed files remembered by path, files that are still open are never evicted
+constexpr size_t MaxCachedFiles = 4096;
+
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(Mode mode) {
     switch (mode) {
     case Mode::Read:
@@ -46,7 +51,9 @@ constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(Mode mode) {
 
 } // Anonymous namespace
 
-RealVfsFilesystem::RealVfsFilesystem() : VfsFilesystem(nullptr) {}
+RealVfsFilesystem::RealVfsFilesystem()
+    : VfsFilesystem(nullptr),
+      cache{MaxCachedFiles, [](const std::weak_ptr<VfsFile>& file) { return file.expired(); }} {}
 RealVfsFilesystem::~RealVfsFilesystem() = default;
 
 std::string RealVfsFilesystem::GetName() const {
@@ -76,10 +83,17 @@ VfsEntryType RealVfsFilesystem::GetEntryType(std::string_view path_) const {
 VirtualFile RealVfsFilesystem::OpenFileFromEntry(std::string_view path_, std::optional<u64> size,
                                                  Mode perms) {
     const auto path = FS::SanitizePath(path_, FS::DirectorySeparator::PlatformDefault);
+    if (auto cached = cache.Find(path)) {
+        if (auto file = cached->lock(); file) {
+            return file;
+        }
+    }
+
     std::scoped_lock lk{list_lock};
 
-    if (auto it = cache.find(path); it != cache.end()) {
-        if (auto file = it->second.lock(); file) {
+    // Check again, another thread may have opened the file while the lock was taken.
+    if (auto cached = cache.Find(path)) {
+        if (auto file = cached->lock(); file) {
             return file;
         }
     }
@@ -93,7 +107,7 @@ VirtualFile RealVfsFilesystem::OpenFileFromEntry(std::string_view path_, std::op
 
     auto file = std::shared_ptr<RealVfsFile>(
         new RealVfsFile(*this, std::move(reference), path, perms, size));
-    cache[path] = file;
+    cache.Insert(path, file);
 
     return file;
 }
@@ -106,7 +120,7 @@ VirtualFile RealVfsFilesystem::CreateFile(std::string_view path_, Mode perms) {
     const auto path = FS::SanitizePath(path_, FS::DirectorySeparator::PlatformDefault);
     {
         std::scoped_lock lk{list_lock};
-        cache.erase(path);
+        cache.Erase(path);
     }
 
     // Current usages of CreateFile expect to delete the contents of an existing file.
@@ -139,8 +153,8 @@ VirtualFile RealVfsFilesystem::MoveFile(std::string_view old_path_, std::string_
     const auto new_path = FS::SanitizePath(new_path_, FS::DirectorySeparator::PlatformDefault);
     {
         std::scoped_lock lk{list_lock};
-        cache.erase(old_path);
-        cache.erase(new_path);
+        cache.Erase(old_path);
+        cache.Erase(new_path);
     }
     if (!FS::RenameFile(old_path, new_path)) {
         return nullptr;
@@ -152,7 +166,7 @@ bool RealVfsFilesystem::DeleteFile(std::string_view path_) {
     const auto path = FS::SanitizePath(path_, FS::DirectorySeparator::PlatformDefault);
     {
         std::scoped_lock lk{list_lock};
-        cache.erase(path);
+        cache.Erase(path);
     }
     return FS::RemoveFile(path);
 }
@@ -306,6 +320,18 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    std::call_once(map_flag, [this] { MapIfLarge(); });
+    if (mapped_file.IsOpen()) {
+        // Served straight from the page cache, without taking the reference lock.
+        const auto mapped = mapped_file.Span();
+        if (offset >= mapped.size()) {
+            return 0;
+        }
+        length = std::min(length, mapped.size() - offset);
+        std::memcpy(data, mapped.data() + offset, length);
+        return length;
+    }
+
     auto lk = base.RefreshReference(path, perms, *reference);
     if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
         return 0;
@@ -322,6 +348,16 @@ std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t o
     return reference->file->WriteSpan(std::span{data, length});
 }
 
+void RealVfsFile::MapIfLarge() const {
+    // Only game images and the like are worth a mapping, small files keep using the handle cache.
+    if (perms != Mode::Read || GetSize() < MinMappedFileSize) {
+        return;
+    }
+    if (!mapped_file.Open(std::filesystem::path{FS::ToU8String(path)})) {
+        LOG_WARNING(Common_Filesystem, "Failed to map {}, falling back to buffered reads", path);
+    }
+}
+
 bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
 }
@@ -3,10 +3,13 @@
 
 #pragma once
 
-#include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <string_view>
+#include "common/concurrent_lru_cache.h"
+#include "common/fs/mapped_file.h"
 #include "common/intrusive_list.h"
 #include "core/file_sys/mode.h"
 #include "core/file_sys/vfs.h"
@@ -46,7 +49,8 @@ public:
 
 private:
     using ReferenceListType = Common::IntrusiveListBaseTraits<FileReference>::ListType;
-    std::map<std::string, std::weak_ptr<VfsFile>, std::less<>> cache;
+    /// Most recently opened files, so opening a file again returns the same object
+    Common::ConcurrentLruCache<std::string, std::weak_ptr<VfsFile>> cache;
     ReferenceListType open_references;
     ReferenceListType closed_references;
     std::mutex list_lock;
@@ -75,6 +79,9 @@ class RealVfsFile : public VfsFile {
     friend class RealVfsFilesystem;
 
 public:
+    /// Read-only files at least this large are mapped into memory on their first read
+    static constexpr std::size_t MinMappedFileSize = 64 * 1024 * 1024;
+
     ~RealVfsFile() override;
 
     std::string GetName() const override;
@@ -91,6 +98,8 @@ private:
     RealVfsFile(RealVfsFilesystem& base, std::unique_ptr<FileReference> reference,
                 const std::string& path, Mode perms = Mode::Read, std::optional<u64> size = {});
 
+    void MapIfLarge() const;
+
     RealVfsFilesystem& base;
     std::unique_ptr<FileReference> reference;
     std::string path;
@@ -98,6 +107,8 @@ private:
     std::vector<std::string> path_components;
     std::optional<u64> size;
     Mode perms;
+    mutable std::once_flag map_flag;
+    mutable Common::FS::MappedFile mapped_file;
 };
 
 // An implementation of VfsDirectory that represents a directory on the user's computer.
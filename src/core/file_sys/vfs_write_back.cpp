@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "core/file_sys/vfs_write_back.h"
+
+namespace FileSys {
+
+WriteBackVfsFile::WriteBackVfsFile(VirtualFile base_)
+    : base(std::move(base_)), size(base->GetSize()) {}
+
+WriteBackVfsFile::~WriteBackVfsFile() {
+    Flush();
+}
+
+std::string WriteBackVfsFile::GetName() const {
+    return base->GetName();
+}
+
+std::size_t WriteBackVfsFile::GetSize() const {
+    std::scoped_lock lk{pending_mutex};
+    return size;
+}
+
+bool WriteBackVfsFile::Resize(std::size_t new_size) {
+    Flush();
+
+    std::scoped_lock lk{base_mutex, pending_mutex};
+    if (!base->Resize(new_size)) {
+        return false;
+    }
+    size = new_size;
+    return true;
+}
+
+VirtualDir WriteBackVfsFile::GetContainingDirectory() const {
+    return base->GetContainingDirectory();
+}
+
+bool WriteBackVfsFile::IsWritable() const {
+    return base->IsWritable();
+}
+
+bool WriteBackVfsFile::IsReadable() const {
+    return base->IsReadable();
+}
+
+std::size_t WriteBackVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    Flush();
+
+    std::scoped_lock lk{base_mutex};
+    return base->Read(data, length, offset);
+}
+
+std::size_t WriteBackVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    if (length == 0) {
+        return 0;
+    }
+
+    std::scoped_lock lk{pending_mutex};
+    const std::size_t end = offset + length;
+
+    // Find the ranges touching the new one, adjacent ranges are merged as well.
+    auto first = pending.upper_bound(offset);
+    if (first != pending.begin()) {
+        const auto prev = std::prev(first);
+        if (prev->first + prev->second.size() >= offset) {
+            first = prev;
+        }
+    }
+    auto last = first;
+    while (last != pending.end() && last->first <= end) {
+        ++last;
+    }
+
+    if (first != last && std::next(first) == last && first->first <= offset) {
+        // A single range starting before the write, extend it in place. This is the common case
+        // of sequential writes.
+        auto& range = first->second;
+        const std::size_t range_offset = offset - first->first;
+        const std::size_t old_size = range.size();
+        if (range_offset + length > old_size) {
+            range.resize(range_offset + length);
+            pending_size += range.size() - old_size;
+        }
+        std::memcpy(range.data() + range_offset, data, length);
+    } else {
+        std::size_t merged_start = offset;
+        std::size_t merged_end = end;
+        for (auto it = first; it != last; ++it) {
+            merged_start = std::min(merged_start, it->first);
+            merged_end = std::max(merged_end, it->first + it->second.size());
+        }
+
+        std::vector<u8> merged(merged_end - merged_start);
+        for (auto it = first; it != last; ++it) {
+            std::memcpy(merged.data() + (it->first - merged_start), it->second.data(),
+                        it->second.size());
+            pending_size -= it->second.size();
+        }
+        std::memcpy(merged.data() + (offset - merged_start), data, length);
+        pending_size += merged.size();
+
+        pending.erase(first, last);
+        pending.emplace(merged_start, std::move(merged));
+    }
+
+    size = std::max(size, end);
+    return length;
+}
+
+bool WriteBackVfsFile::Rename(std::string_view name) {
+    Flush();
+
+    std::scoped_lock lk{base_mutex};
+    return base->Rename(name);
+}
+
+std::string WriteBackVfsFile::GetFullPath() const {
+    return base->GetFullPath();
+}
+
+bool WriteBackVfsFile::Flush() const {
+    // Holding the base lock keeps concurrent flushes in order, so a newer write to a range always
+    // lands after an older one.
+    std::scoped_lock base_lk{base_mutex};
+
+    std::map<std::size_t, std::vector<u8>> ranges;
+    {
+        std::scoped_lock lk{pending_mutex};
+        ranges.swap(pending);
+        pending_size = 0;
+    }
+
+    bool success = true;
+    for (const auto& [offset, data] : ranges) {
+        if (base->Write(data.data(), data.size(), offset) != data.size()) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+std::size_t WriteBackVfsFile::GetPendingSize() const {
+    std::scoped_lock lk{pending_mutex};
+    return pending_size;
+}
+
+} // namespace FileSys
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+/**
+ * Buffers the writes to another VfsFile, coalescing contiguous and overlapping writes into ranges
+ * that are written back on Flush. Flush may run on another thread, writes only wait for it while
+ * it swaps the pending ranges out. Reads, resizes and renames flush first.
+ */
+class WriteBackVfsFile : public VfsFile {
+public:
+    explicit WriteBackVfsFile(VirtualFile base);
+    ~WriteBackVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+    std::string GetFullPath() const override;
+
+    /// Writes the pending ranges to the base file, returns false if any of them failed
+    bool Flush() const;
+
+    /// Returns the number of bytes waiting to be written back
+    std::size_t GetPendingSize() const;
+
+private:
+    VirtualFile base;
+
+    /// Serializes the accesses to the base file
+    mutable std::mutex base_mutex;
+
+    /// Protects the pending ranges and the size
+    mutable std::mutex pending_mutex;
+    mutable std::map<std::size_t, std::vector<u8>> pending;
+    mutable std::size_t pending_size = 0;
+    std::size_t size;
+};
+
+} // namespace FileSys
@@ -3,9 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <bit>
-#include <functional>
+#include <iterator>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -47,7 +48,8 @@ public:
                                                 std::memory_order_relaxed));
     }
 
-    void Gather(std::function<void(PAddr, size_t)>& callback) {
+    /// Appends the dirty ranges collected so far, merging runs adjacent to the previous range
+    void Gather(std::vector<std::pair<PAddr, size_t>>& ranges) {
         {
             std::scoped_lock lk(guard);
             TransformAddress t = current.exchange(default_transform, std::memory_order_relaxed);
@@ -65,8 +67,13 @@ public:
                 mask = mask >> empty_bits;
 
                 const size_t continuous_bits = std::countr_one(mask);
-                callback((static_cast<PAddr>(transform.address) << page_bits) + offset,
-                         continuous_bits << align_bits);
+                const PAddr address = (static_cast<PAddr>(transform.address) << page_bits) + offset;
+                const size_t size = continuous_bits << align_bits;
+                if (!ranges.empty() && ranges.back().first + ranges.back().second == address) {
+                    ranges.back().second += size;
+                } else {
+                    ranges.emplace_back(address, size);
+                }
                 mask = continuous_bits < align_size ? (mask >> continuous_bits) : 0;
                 offset += continuous_bits << align_bits;
             }
@@ -74,6 +81,24 @@ public:
         front_buffer.clear();
     }
 
+    /// Sorts a list of ranges and merges the ones that overlap or are adjacent
+    static void Coalesce(std::vector<std::pair<PAddr, size_t>>& ranges) {
+        if (ranges.size() < 2) {
+            return;
+        }
+        std::ranges::sort(ranges);
+        auto last = ranges.begin();
+        for (auto it = std::next(ranges.begin()); it != ranges.end(); ++it) {
+            const PAddr last_end = last->first + last->second;
+            if (it->first <= last_end) {
+                last->second = std::max(last_end, it->first + it->second) - last->first;
+            } else {
+                *++last = *it;
+            }
+        }
+        ranges.erase(std::next(last), ranges.end());
+    }
+
 private:
     struct alignas(8) TransformAddress {
         u32 address;
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "core/hle/kernel/board/nintendo/nx/k_system_control.h"
+#include "core/hle/kernel/free_page_clearer.h"
+#include "core/hle/kernel/memory_types.h"
+
+namespace Kernel {
+
+FreePageClearer::FreePageClearer(Core::System& system)
+    : m_system{system},
+      m_num_pages{Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize() / PageSize},
+      m_page_states{std::make_unique<std::atomic<PageState>[]>(m_num_pages)} {}
+
+FreePageClearer::~FreePageClearer() {
+    this->Stop();
+}
+
+void FreePageClearer::Start() {
+    ASSERT(!m_thread.joinable());
+    m_is_running = true;
+    m_thread = std::jthread([this](std::stop_token stop_token) { ThreadFunction(stop_token); });
+}
+
+void FreePageClearer::Stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    m_is_running = false;
+    m_thread.request_stop();
+    m_thread.join();
+    m_queue.clear();
+
+    LOG_DEBUG(Kernel, "{} pages were cleared in the background, {} page fills were skipped",
+              m_num_cleared_pages.load(), m_num_skipped_pages.load());
+}
+
+void FreePageClearer::OnFree(KPhysicalAddress address, size_t num_pages) {
+    const size_t page_index = this->GetPageIndex(address);
+    for (size_t index = page_index; index < page_index + num_pages; ++index) {
+        m_page_states[index].store(PageState::Free, std::memory_order_release);
+    }
+    if (!m_is_running) {
+        return;
+    }
+    {
+        std::scoped_lock lk{m_queue_mutex};
+        m_queue.push_back({page_index, num_pages});
+    }
+    m_queue_cv.notify_one();
+}
+
+void FreePageClearer::OnAllocate(KPhysicalAddress address, size_t num_pages) {
+    const size_t page_index = this->GetPageIndex(address);
+    for (size_t index = page_index; index < page_index + num_pages; ++index) {
+        std::atomic<PageState>& state = m_page_states[index];
+        PageState current = state.load(std::memory_order_acquire);
+        while (true) {
+            if (current == PageState::Clearing) {
+                // The clearing thread owns the page, wait until it is done with it.
+                state.wait(PageState::Clearing, std::memory_order_acquire);
+                current = state.load(std::memory_order_acquire);
+                continue;
+            }
+            const PageState desired =
+                current == PageState::FreeClear ? PageState::AllocatedClear : PageState::Allocated;
+            if (state.compare_exchange_weak(current, desired, std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+    }
+}
+
+void FreePageClearer::Fill(KPhysicalAddress address, size_t size, u8 fill_value) {
+    const size_t page_index = this->GetPageIndex(address);
+    const size_t num_pages = size / PageSize;
+
+    // Coalesce the pages which still have to be filled.
+    size_t fill_start = page_index;
+    size_t fill_pages = 0;
+    for (size_t index = page_index; index < page_index + num_pages; ++index) {
+        const PageState state =
+            m_page_states[index].exchange(PageState::Allocated, std::memory_order_acq_rel);
+        if (fill_value == 0 && state == PageState::AllocatedClear) {
+            if (fill_pages > 0) {
+                this->ClearPages(fill_start, fill_pages, fill_value);
+            }
+            fill_start = index + 1;
+            fill_pages = 0;
+            ++m_num_skipped_pages;
+            continue;
+        }
+        ++fill_pages;
+    }
+    if (fill_pages > 0) {
+        this->ClearPages(fill_start, fill_pages, fill_value);
+    }
+}
+
+size_t FreePageClearer::GetPageIndex(KPhysicalAddress address) const {
+    const size_t page_index = (GetInteger(address) - Core::DramMemoryMap::Base) / PageSize;
+    ASSERT(page_index < m_num_pages);
+    return page_index;
+}
+
+void FreePageClearer::ThreadFunction(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("KernelPageClearer");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+    while (!stop_token.stop_requested()) {
+        Range range;
+        {
+            std::unique_lock lk{m_queue_mutex};
+            if (!m_queue_cv.wait(lk, stop_token, [this] { return !m_queue.empty(); })) {
+                return;
+            }
+            range = m_queue.front();
+            m_queue.pop_front();
+        }
+        this->ClearRange(stop_token, range);
+    }
+}
+
+void FreePageClearer::ClearRange(std::stop_token stop_token, Range range) {
+    size_t clear_start = range.page_index;
+    size_t clear_pages = 0;
+    const auto flush = [&] {
+        if (clear_pages == 0) {
+            return;
+        }
+        this->ClearPages(clear_start, clear_pages, 0);
+        for (size_t index = clear_start; index < clear_start + clear_pages; ++index) {
+            m_page_states[index].store(PageState::FreeClear, std::memory_order_release);
+            m_page_states[index].notify_all();
+        }
+        m_num_cleared_pages += clear_pages;
+        clear_pages = 0;
+    };
+
+    // Claim runs of pages that are still free, pages allocated or cleared meanwhile are skipped.
+    for (size_t index = range.page_index; index < range.page_index + range.num_pages; ++index) {
+        if (stop_token.stop_requested()) {
+            break;
+        }
+        PageState expected = PageState::Free;
+        if (!m_page_states[index].compare_exchange_strong(expected, PageState::Clearing,
+                                                          std::memory_order_acq_rel)) {
+            flush();
+            continue;
+        }
+        if (clear_pages == 0) {
+            clear_start = index;
+        }
+        if (++clear_pages == MaxClearPages) {
+            flush();
+        }
+    }
+    flush();
+}
+
+void FreePageClearer::ClearPages(size_t page_index, size_t num_pages, u8 fill_value) {
+    m_system.DeviceMemory().buffer.ClearBackingRegion(page_index * PageSize, num_pages * PageSize,
+                                                      fill_value);
+}
+
+} // namespace Kernel
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "common/common_types.h"
+#include "core/hle/kernel/k_typed_address.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+
+/**
+ * Clears the pages freed to the memory manager on a host thread, so allocations which must be
+ * zero filled can skip the pages that were already cleared. On Linux clearing releases the host
+ * memory, which the OS lazily zero fills when the guest touches it again.
+ */
+class FreePageClearer {
+public:
+    /// Most pages cleared at once, bounds how long an allocation may wait for the clearing thread
+    static constexpr size_t MaxClearPages = 64;
+
+    explicit FreePageClearer(Core::System& system);
+    ~FreePageClearer();
+
+    FreePageClearer(const FreePageClearer&) = delete;
+    FreePageClearer& operator=(const FreePageClearer&) = delete;
+
+    /// Starts clearing the pages freed from now on, pages freed before are cleared on allocation
+    void Start();
+
+    /// Stops the clearing thread, must be called before the device memory is destroyed
+    void Stop();
+
+    /// Tracks pages returned to a page heap, and queues them to be cleared
+    void OnFree(KPhysicalAddress address, size_t num_pages);
+
+    /// Tracks pages taken from a page heap, waiting for the ones being cleared
+    void OnAllocate(KPhysicalAddress address, size_t num_pages);
+
+    /// Fills allocated pages, pages already cleared are skipped when filling with zero
+    void Fill(KPhysicalAddress address, size_t size, u8 fill_value);
+
+private:
+    enum class PageState : u8 {
+        Allocated,
+        AllocatedClear,
+        Free,
+        Clearing,
+        FreeClear,
+    };
+
+    struct Range {
+        size_t page_index;
+        size_t num_pages;
+    };
+
+    size_t GetPageIndex(KPhysicalAddress address) const;
+
+    void ThreadFunction(std::stop_token stop_token);
+    void ClearRange(std::stop_token stop_token, Range range);
+    void ClearPages(size_t page_index, size_t num_pages, u8 fill_value);
+
+    Core::System& m_system;
+    size_t m_num_pages{};
+    std::unique_ptr<std::atomic<PageState>[]> m_page_states;
+
+    std::mutex m_queue_mutex;
+    std::condition_variable_any m_queue_cv;
+    std::deque<Range> m_queue;
+    std::atomic<bool> m_is_running{};
+    std::jthread m_thread;
+
+    std::atomic<u64> m_num_cleared_pages{};
+    std::atomic<u64> m_num_skipped_pages{};
+};
+
+} // namespace Kernel
@@ -4,6 +4,7 @@
 #include <mutex>
 
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "core/core.h"
 #include "core/hle/kernel/global_scheduler_context.h"
 #include "core/hle/kernel/k_scheduler.h"
@@ -48,6 +49,22 @@ bool GlobalSchedulerContext::IsLocked() const {
     return m_scheduler_lock.IsLockedByCurrentThread();
 }
 
+void GlobalSchedulerContext::LogStatistics() const {
+    const u64 acquire_count = m_scheduler_lock.GetAcquireCount();
+    const u64 contended_count = m_scheduler_lock.GetContendedCount();
+    u64 lockless_yield_count = 0;
+    for (const LocklessYieldCount& core_count : m_lockless_yield_counts) {
+        lockless_yield_count += core_count.count.load(std::memory_order_relaxed);
+    }
+    LOG_INFO(Kernel,
+             "Scheduler lock acquired {} times, {} contended ({:.2f}%), {} yields skipped it",
+             acquire_count, contended_count,
+             acquire_count != 0 ? 100.0 * static_cast<double>(contended_count) /
+                                      static_cast<double>(acquire_count)
+                                : 0.0,
+             lockless_yield_count);
+}
+
 void GlobalSchedulerContext::RegisterDummyThreadForWakeup(KThread* thread) {
     ASSERT(this->IsLocked());
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <set>
 #include <vector>
@@ -68,15 +69,30 @@ public:
         return m_scheduler_lock;
     }
 
+    /// Notes a yield that was completed without acquiring the scheduler lock
+    void CountLocklessYield(s32 core_id) {
+        auto& count = m_lockless_yield_counts[core_id].count;
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /// Logs how often the scheduler lock was contended and how often it was skipped
+    void LogStatistics() const;
+
 private:
     friend class KScopedSchedulerLock;
     friend class KScopedSchedulerLockAndSleep;
 
+    /// Lockless yields are counted by the yielding core, one cache line per core
+    struct alignas(64) LocklessYieldCount {
+        std::atomic<u64> count;
+    };
+
     KernelCore& m_kernel;
 
     std::atomic_bool m_scheduler_update_needed{};
     KSchedulerPriorityQueue m_priority_queue;
     LockType m_scheduler_lock;
+    std::array<LocklessYieldCount, Core::Hardware::NUM_CPU_CORES> m_lockless_yield_counts{};
 
     /// Lists dummy threads pending wakeup on lock release
     std::set<KThread*> m_woken_dummy_threads;
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/demangle.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/arm/debug.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/guest_profiler.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/physical_core.h"
+
+namespace Kernel {
+namespace {
+
+/// Time between samples of each core, in emulated time
+constexpr std::chrono::nanoseconds SAMPLE_INTERVAL{std::chrono::milliseconds{1}};
+
+constexpr size_t MAX_LOGGED_FUNCTIONS = 16;
+
+} // Anonymous namespace
+
+GuestProfiler::GuestProfiler(KernelCore& kernel) : m_kernel{kernel} {
+    m_sample_event = Core::Timing::CreateEvent(
+        "GuestProfilerSample",
+        [this](s64 time, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            for (size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; ++core) {
+                m_kernel.PhysicalCore(core).RequestSample();
+            }
+            return std::nullopt;
+        });
+    m_kernel.System().CoreTiming().ScheduleLoopingEvent(SAMPLE_INTERVAL, SAMPLE_INTERVAL,
+                                                       m_sample_event);
+}
+
+GuestProfiler::~GuestProfiler() {
+    m_kernel.System().CoreTiming().UnscheduleEvent(m_sample_event);
+}
+
+void GuestProfiler::Record(KThread* thread, const Svc::ThreadContext& ctx) {
+    KProcess* const process = thread->GetOwnerProcess();
+    if (process == nullptr) {
+        return;
+    }
+    const std::vector<Core::BacktraceEntry> frames =
+        Core::GetUnsymbolizedBacktraceFromContext(process, ctx);
+
+    std::scoped_lock lk{m_mutex};
+    const auto [thread_it, is_new_thread] = m_thread_names.try_emplace(thread->GetThreadId());
+    if (is_new_thread) {
+        thread_it->second = fmt::format(
+            "{} ({})", Core::GetThreadName(thread).value_or("Thread"), thread->GetThreadId());
+        std::ranges::replace(thread_it->second, ';', ':');
+    }
+    const auto [process_it, is_new_process] = m_processes.try_emplace(process->GetProcessId());
+    ProcessSymbols& symbols = process_it->second;
+    if (is_new_process) {
+        symbols.modules = Core::FindModules(process);
+        for (const auto& [base, name] : symbols.modules) {
+            symbols.symbols.insert_or_assign(
+                name, Core::Symbols::GetSymbols(base, process->GetMemory(), process->Is64Bit()));
+        }
+    }
+
+    std::string stack = fmt::format("{};{}", process->GetName(), thread_it->second);
+    for (auto frame = frames.rbegin(); frame != frames.rend(); ++frame) {
+        stack += ';';
+        stack += GetFrameName(symbols, frame->original_address);
+    }
+    ++m_stacks[std::move(stack)];
+    ++m_num_samples;
+}
+
+const std::string& GuestProfiler::GetFrameName(ProcessSymbols& symbols, u64 address) {
+    const auto [it, is_new] = symbols.frame_names.try_emplace(address);
+    if (!is_new) {
+        return it->second;
+    }
+    auto module = symbols.modules.upper_bound(address);
+    if (module == symbols.modules.begin()) {
+        it->second = fmt::format("unknown+0x{:x}", address);
+        return it->second;
+    }
+    --module;
+    const u64 offset = address - module->first;
+    const auto symbol_set = symbols.symbols.find(module->second);
+    std::optional<std::string> symbol;
+    if (symbol_set != symbols.symbols.end()) {
+        symbol = Core::Symbols::GetSymbolName(symbol_set->second, offset);
+    }
+    // Semicolons separate the frames of folded stacks
+    it->second = symbol ? fmt::format("{}!{}", module->second, Common::DemangleSymbol(*symbol))
+                        : fmt::format("{}+0x{:x}", module->second, offset);
+    std::ranges::replace(it->second, ';', ':');
+    return it->second;
+}
+
+void GuestProfiler::Report() const {
+    std::scoped_lock lk{m_mutex};
+    if (m_num_samples == 0) {
+        return;
+    }
+
+    std::string folded;
+    std::unordered_map<std::string_view, u64> self_samples;
+    for (const auto& [stack, count] : m_stacks) {
+        folded += fmt::format("{} {}\n", stack, count);
+        const size_t leaf = stack.rfind(';');
+        self_samples[std::string_view{stack}.substr(leaf + 1)] += count;
+    }
+
+    const auto log_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir)};
+    const auto filename{log_dir / "guest_profile.folded"};
+    std::string location{Common::FS::PathToUTF8String(filename)};
+    std::ofstream file;
+    if (Common::FS::CreateDir(log_dir)) {
+        file.open(filename, std::ios::out | std::ios::trunc);
+    }
+    if (file) {
+        file << folded;
+    } else {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}", location);
+        location = "nowhere";
+    }
+
+    std::vector<std::pair<std::string_view, u64>> functions(self_samples.begin(),
+                                                            self_samples.end());
+    const size_t num_logged = std::min(functions.size(), MAX_LOGGED_FUNCTIONS);
+    std::ranges::partial_sort(functions, functions.begin() + num_logged, std::greater{},
+                              [](const auto& pair) { return pair.second; });
+    std::string summary;
+    for (size_t index = 0; index < num_logged; ++index) {
+        const auto& [name, count] = functions[index];
+        summary += fmt::format("{:6.2f}% {:8} {}\n",
+                               100.0 * static_cast<double>(count) /
+                                   static_cast<double>(m_num_samples),
+                               count, name);
+    }
+    LOG_INFO(Kernel,
+             "\nGuest functions with the most samples out of {}, stacks dumped to {}\n"
+             "======================================================================\n"
+             "{}",
+             m_num_samples, location, summary);
+}
+
+} // namespace Kernel
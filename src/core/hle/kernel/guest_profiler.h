@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "core/arm/symbols.h"
+
+namespace Core::Timing {
+struct EventType;
+}
+
+namespace Kernel {
+
+class KernelCore;
+class KProcess;
+class KThread;
+
+namespace Svc {
+struct ThreadContext;
+}
+
+/**
+ * Samples the guest call stacks of the threads running on the emulated cores.
+ * Enabled with the profile_guest setting, a CoreTiming event periodically asks each core for a
+ * sample, which is taken the next time the running thread exits guest code. The stacks are
+ * symbolized through the symbol tables of the process modules and dumped to the log directory in
+ * the folded format of flamegraph tools when the kernel shuts down.
+ */
+class GuestProfiler {
+public:
+    explicit GuestProfiler(KernelCore& kernel);
+    ~GuestProfiler();
+
+    GuestProfiler(const GuestProfiler&) = delete;
+    GuestProfiler& operator=(const GuestProfiler&) = delete;
+
+    /// Records the call stack of a thread that was running guest code with the given context
+    void Record(KThread* thread, const Svc::ThreadContext& ctx);
+
+    /// Logs the functions where the most samples were taken and dumps the folded stacks
+    void Report() const;
+
+private:
+    struct ProcessSymbols {
+        std::map<VAddr, std::string> modules;
+        std::map<std::string, Core::Symbols::Symbols, std::less<>> symbols;
+        std::unordered_map<u64, std::string> frame_names;
+    };
+
+    /// Returns the name of the frame at an address, as module!symbol or module+offset
+    static const std::string& GetFrameName(ProcessSymbols& symbols, u64 address);
+
+    KernelCore& m_kernel;
+    std::shared_ptr<Core::Timing::EventType> m_sample_event;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<u64, ProcessSymbols> m_processes;
+    std::unordered_map<u64, std::string> m_thread_names;
+    /// Number of samples taken for each stack, from the outermost frame to the innermost
+    std::unordered_map<std::string, u64> m_stacks;
+    u64 m_num_samples{};
+};
+
+} // namespace Kernel
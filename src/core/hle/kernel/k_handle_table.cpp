@@ -12,6 +12,7 @@ Result KHandleTable::Finalize() {
     {
         KScopedDisableDispatch dd{m_kernel};
         KScopedSpinLock lk(m_lock);
+        ScopedUpdate update(*this);
 
         std::swap(m_table_size, saved_table_size);
     }
@@ -43,6 +44,7 @@ bool KHandleTable::Remove(Handle handle) {
     {
         KScopedDisableDispatch dd{m_kernel};
         KScopedSpinLock lk(m_lock);
+        ScopedUpdate update(*this);
 
         if (this->IsValidHandle(handle)) [[likely]] {
             const auto index = handle_pack.index;
@@ -63,6 +65,7 @@ bool KHandleTable::Remove(Handle handle) {
 Result KHandleTable::Add(Handle* out_handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{m_kernel};
     KScopedSpinLock lk(m_lock);
+    ScopedUpdate update(*this);
 
     // Never exceed our capacity.
     R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
@@ -102,6 +105,7 @@ KScopedAutoObject<KAutoObject> KHandleTable::GetObjectForIpc(Handle handle,
 Result KHandleTable::Reserve(Handle* out_handle) {
     KScopedDisableDispatch dd{m_kernel};
     KScopedSpinLock lk(m_lock);
+    ScopedUpdate update(*this);
 
     // Never exceed our capacity.
     R_UNLESS(m_count < m_table_size, ResultOutOfHandles);
@@ -113,6 +117,7 @@ Result KHandleTable::Reserve(Handle* out_handle) {
 void KHandleTable::Unreserve(Handle handle) {
     KScopedDisableDispatch dd{m_kernel};
     KScopedSpinLock lk(m_lock);
+    ScopedUpdate update(*this);
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -132,6 +137,7 @@ void KHandleTable::Unreserve(Handle handle) {
 void KHandleTable::Register(Handle handle, KAutoObject* obj) {
     KScopedDisableDispatch dd{m_kernel};
     KScopedSpinLock lk(m_lock);
+    ScopedUpdate update(*this);
 
     // Unpack the handle.
     const auto handle_pack = HandlePack(handle);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
@@ -37,6 +38,7 @@ public:
         // Lock.
         KScopedDisableDispatch dd{m_kernel};
         KScopedSpinLock lk(m_lock);
+        ScopedUpdate update(*this);
 
         // Initialize all fields.
         m_max_count = 0;
@@ -70,19 +72,20 @@ public:
 
     template <typename T = KAutoObject>
     KScopedAutoObject<T> GetObjectWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
+        // Look up in table.
+        KAutoObject* obj = this->OpenObjectImpl(handle);
+        if (obj == nullptr) [[unlikely]] {
+            return nullptr;
+        }
 
+        KScopedAutoObject<T> result;
         if constexpr (std::is_same_v<T, KAutoObject>) {
-            return this->GetObjectImpl(handle);
+            result = obj;
         } else {
-            if (auto* obj = this->GetObjectImpl(handle); obj != nullptr) [[likely]] {
-                return obj->DynamicCast<T*>();
-            } else {
-                return nullptr;
-            }
+            result = obj->DynamicCast<T*>();
         }
+        obj->Close();
+        return result;
     }
 
     template <typename T = KAutoObject>
@@ -106,11 +109,7 @@ public:
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpcWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
-
-        return this->GetObjectImpl(handle);
+        return this->template GetObjectWithoutPseudoHandle<KAutoObject>(handle);
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpc(Handle handle, KThread* cur_thread) const;
@@ -132,30 +131,24 @@ public:
     bool GetMultipleObjects(T** out, const Handle* handles, size_t num_handles) const {
         // Try to convert and open all the handles.
         size_t num_opened;
-        {
-            // Lock the table.
-            KScopedDisableDispatch dd{m_kernel};
-            KScopedSpinLock lk(m_lock);
-            for (num_opened = 0; num_opened < num_handles; num_opened++) {
-                // Get the current handle.
-                const auto cur_handle = handles[num_opened];
-
-                // Get the object for the current handle.
-                KAutoObject* cur_object = this->GetObjectImpl(cur_handle);
-                if (cur_object == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Cast the current object to the desired type.
-                T* cur_t = cur_object->DynamicCast<T*>();
-                if (cur_t == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Open a reference to the current object.
-                cur_t->Open();
-                out[num_opened] = cur_t;
+        for (num_opened = 0; num_opened < num_handles; num_opened++) {
+            // Get the current handle.
+            const auto cur_handle = handles[num_opened];
+
+            // Get and open the object for the current handle.
+            KAutoObject* cur_object = this->OpenObjectImpl(cur_handle);
+            if (cur_object == nullptr) [[unlikely]] {
+                break;
             }
+
+            // Cast the current object to the desired type.
+            T* cur_t = cur_object->DynamicCast<T*>();
+            if (cur_t == nullptr) [[unlikely]] {
+                cur_object->Close();
+                break;
+            }
+
+            out[num_opened] = cur_t;
         }
 
         // If we converted every object, succeed.
@@ -172,6 +165,59 @@ public:
     }
 
 private:
+    // Marks the table as being modified, so lookups done without the lock are retried.
+    // Must be created with the lock held.
+    class ScopedUpdate {
+    public:
+        explicit ScopedUpdate(const KHandleTable& table) : m_sequence(table.m_sequence) {
+            m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        ~ScopedUpdate() {
+            m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_release);
+        }
+
+    private:
+        std::atomic<u32>& m_sequence;
+    };
+
+    // Looks up and opens the object of a handle. Lookups don't take the lock, they are retried
+    // when the table was modified concurrently, and fall back to the lock if that keeps happening.
+    KAutoObject* OpenObjectImpl(Handle handle) const {
+        for (size_t attempt = 0; attempt < MaxLocklessAttempts; ++attempt) {
+            const u32 sequence = m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0) [[unlikely]] {
+                continue;
+            }
+
+            // The object may be removed and destroyed concurrently. Objects are slab allocated,
+            // so the reference count is still readable, and Open fails once it reached zero.
+            KAutoObject* obj = this->GetObjectImpl(handle);
+            const bool opened = obj != nullptr && obj->Open();
+
+            // If the table was not modified, the table still held a reference while it was opened.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence) [[likely]] {
+                return opened ? obj : nullptr;
+            }
+            if (opened) {
+                obj->Close();
+            }
+        }
+
+        KScopedDisableDispatch dd{m_kernel};
+        KScopedSpinLock lk(m_lock);
+
+        KAutoObject* obj = this->GetObjectImpl(handle);
+        if (obj != nullptr) {
+            obj->Open();
+        }
+        return obj;
+    }
+
     s32 AllocateEntry() {
         ASSERT(m_count < m_table_size);
 
@@ -219,15 +265,15 @@ private:
         if (linear_id == 0) [[unlikely]] {
             return false;
         }
-        if (index >= m_table_size) [[unlikely]] {
+        if (index >= LoadRelaxed(m_table_size)) [[unlikely]] {
             return false;
         }
 
         // Check that there's an object, and our serial id is correct.
-        if (m_objects[index] == nullptr) [[unlikely]] {
+        if (LoadRelaxed(m_objects[index]) == nullptr) [[unlikely]] {
             return false;
         }
-        if (m_entry_infos[index].GetLinearId() != linear_id) [[unlikely]] {
+        if (LoadRelaxed(m_entry_infos[index].linear_id) != linear_id) [[unlikely]] {
             return false;
         }
 
@@ -242,7 +288,7 @@ private:
         }
 
         if (this->IsValidHandle(handle)) [[likely]] {
-            return m_objects[handle_pack.index];
+            return LoadRelaxed(m_objects[handle_pack.index]);
         } else {
             return nullptr;
         }
@@ -263,6 +309,12 @@ private:
         }
     }
 
+    // Table fields are read without the lock by lookups, and validated with the sequence.
+    template <typename T>
+    static T LoadRelaxed(const T& value) {
+        return std::atomic_ref<T>(const_cast<T&>(value)).load(std::memory_order_relaxed);
+    }
+
 private:
     union HandlePack {
         constexpr HandlePack() = default;
@@ -285,6 +337,7 @@ private:
 private:
     static constexpr u16 MinLinearId = 1;
     static constexpr u16 MaxLinearId = 0x7FFF;
+    static constexpr size_t MaxLocklessAttempts = 4;
 
     union EntryInfo {
         u16 linear_id;
@@ -303,6 +356,7 @@ private:
     std::array<EntryInfo, MaxTableSize> m_entry_infos{};
     std::array<KAutoObject*, MaxTableSize> m_objects{};
     mutable KSpinLock m_lock;
+    mutable std::atomic<u32> m_sequence{};
     s32 m_free_head_index{};
     u16 m_table_size{};
     u16 m_max_count{};
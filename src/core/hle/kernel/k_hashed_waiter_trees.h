@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+
+namespace Kernel {
+
+/**
+ * Waiter trees of an address arbiter or condition variable, split by a hash of the key threads
+ * wait on. Signals only walk the tree of the waited address, instead of one tree holding the
+ * waiters of every address of the process.
+ */
+template <typename Tree, size_t NumTrees = 64>
+class KHashedWaiterTrees {
+    static_assert((NumTrees & (NumTrees - 1)) == 0, "NumTrees must be a power of two");
+
+public:
+    static constexpr size_t GetIndex(u64 key) {
+        // Keys are word aligned addresses, mix neighboring words and the same word of other
+        // pages into different trees.
+        const u64 word = key >> 2;
+        return static_cast<size_t>((word ^ (word >> 10) ^ (word >> 20)) & (NumTrees - 1));
+    }
+
+    Tree& Get(u64 key) {
+        return m_trees[GetIndex(key)];
+    }
+
+private:
+    std::array<Tree, NumTrees> m_trees{};
+};
+
+} // namespace Kernel
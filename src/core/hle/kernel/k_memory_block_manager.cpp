@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/logging/log.h"
 #include "core/hle/kernel/k_memory_block_manager.h"
 
 namespace Kernel {
@@ -29,6 +30,10 @@ Result KMemoryBlockManager::Initialize(KProcessAddress st, KProcessAddress nd,
 
 void KMemoryBlockManager::Finalize(KMemoryBlockSlabManager* slab_manager,
                                    BlockCallback&& block_callback) {
+    LOG_DEBUG(Kernel, "Memory block lookups: {} cached, {} searched",
+              m_lookup_counters.cache_hits, m_lookup_counters.tree_searches);
+    this->InvalidateLookupCache();
+
     // Erase every block until we have none left.
     auto it = m_memory_block_tree.begin();
     while (it != m_memory_block_tree.end()) {
@@ -96,6 +101,7 @@ void KMemoryBlockManager::CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator*
 
         if (prev->CanMergeWith(*it)) {
             KMemoryBlock* block = std::addressof(*it);
+            this->InvalidateLookupCache();
             m_memory_block_tree.erase(it);
             prev->Add(*block);
             allocator->Free(block);
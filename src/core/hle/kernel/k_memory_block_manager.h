@@ -5,6 +5,7 @@
 
 #include <array>
 #include <functional>
+#include <optional>
 
 #include "common/common_funcs.h"
 #include "core/hle/kernel/k_dynamic_resource_manager.h"
@@ -82,6 +83,13 @@ public:
     using iterator = MemoryBlockTree::iterator;
     using const_iterator = MemoryBlockTree::const_iterator;
 
+    static constexpr size_t LookupCacheSize = 4;
+
+    struct LookupCounters {
+        u64 cache_hits;
+        u64 tree_searches;
+    };
+
 public:
     KMemoryBlockManager();
 
@@ -122,8 +130,23 @@ public:
                          size_t num_pages, KMemoryAttribute mask, KMemoryAttribute attr);
 
     iterator FindIterator(KProcessAddress address) const {
-        return m_memory_block_tree.find(KMemoryBlock(
+        // Check the recently found blocks first, state checks tend to look up the same blocks.
+        for (const std::optional<iterator>& cached : m_lookup_cache) {
+            if (cached && (*cached)->GetAddress() <= address &&
+                address <= (*cached)->GetLastAddress()) {
+                ++m_lookup_counters.cache_hits;
+                return *cached;
+            }
+        }
+
+        ++m_lookup_counters.tree_searches;
+        const iterator it = m_memory_block_tree.find(KMemoryBlock(
             address, 1, KMemoryState::Free, KMemoryPermission::None, KMemoryAttribute::None));
+        if (it != m_memory_block_tree.end()) {
+            m_lookup_cache[m_lookup_cache_index] = it;
+            m_lookup_cache_index = (m_lookup_cache_index + 1) % LookupCacheSize;
+        }
+        return it;
     }
 
     const KMemoryBlock* FindBlock(KProcessAddress address) const {
@@ -134,6 +157,10 @@ public:
         return nullptr;
     }
 
+    LookupCounters GetLookupCounters() const {
+        return m_lookup_counters;
+    }
+
     // Debug.
     bool CheckState() const;
 
@@ -141,9 +168,18 @@ private:
     void CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator* allocator, KProcessAddress address,
                            size_t num_pages);
 
+    void InvalidateLookupCache() {
+        m_lookup_cache.fill(std::nullopt);
+    }
+
     MemoryBlockTree m_memory_block_tree;
     KProcessAddress m_start_address{};
     KProcessAddress m_end_address{};
+
+    // Blocks are looked up with the page table locked, which also protects the cache.
+    mutable std::array<std::optional<iterator>, LookupCacheSize> m_lookup_cache{};
+    mutable size_t m_lookup_cache_index{};
+    mutable LookupCounters m_lookup_counters{};
 };
 
 class KScopedMemoryBlockManagerAuditor {
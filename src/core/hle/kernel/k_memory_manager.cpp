@@ -42,7 +42,8 @@ KMemoryManager::KMemoryManager(Core::System& system)
           KLightLock{system.Kernel()},
           KLightLock{system.Kernel()},
           KLightLock{system.Kernel()},
-      } {}
+      },
+      m_page_clearer{system} {}
 
 void KMemoryManager::Initialize(KVirtualAddress management_region, size_t management_region_size) {
 
@@ -101,8 +102,9 @@ void KMemoryManager::Initialize(KVirtualAddress management_region, size_t manage
         Impl* manager = std::addressof(m_managers[m_num_managers++]);
         ASSERT(m_num_managers <= m_managers.size());
 
-        const size_t cur_size = manager->Initialize(region_address, region_size, management_region,
-                                                    management_region_end, region_pool);
+        const size_t cur_size =
+            manager->Initialize(region_address, region_size, management_region,
+                                management_region_end, region_pool, std::addressof(m_page_clearer));
         management_region += cur_size;
         ASSERT(management_region <= management_region_end);
 
@@ -166,6 +168,14 @@ void KMemoryManager::Initialize(KVirtualAddress management_region, size_t manage
     for (size_t i = 0; i < m_num_managers; ++i) {
         m_managers[i].SetInitialUsedHeapSize(reserved_sizes[i]);
     }
+
+    // Clear pages freed from now on in the background. The initial heap is cleared on allocation
+    // instead, as clearing all of it at once would commit the whole backing memory on some hosts.
+    m_page_clearer.Start();
+}
+
+void KMemoryManager::Finalize() {
+    m_page_clearer.Stop();
 }
 
 Result KMemoryManager::InitializeOptimizedMemory(u64 process_id, Pool pool) {
@@ -421,9 +431,7 @@ Result KMemoryManager::AllocateForProcess(KPageGroup* out, size_t num_pages, u32
     } else {
         // Set all the allocated memory.
         for (const auto& block : *out) {
-            m_system.DeviceMemory().buffer.ClearBackingRegion(GetInteger(block.GetAddress()) -
-                                                                  Core::DramMemoryMap::Base,
-                                                              block.GetSize(), fill_pattern);
+            m_page_clearer.Fill(block.GetAddress(), block.GetSize(), fill_pattern);
         }
     }
 
@@ -432,7 +440,7 @@ Result KMemoryManager::AllocateForProcess(KPageGroup* out, size_t num_pages, u32
 
 size_t KMemoryManager::Impl::Initialize(KPhysicalAddress address, size_t size,
                                         KVirtualAddress management, KVirtualAddress management_end,
-                                        Pool p) {
+                                        Pool p, FreePageClearer* page_clearer) {
     // Calculate management sizes.
     const size_t ref_count_size = (size / PageSize) * sizeof(u16);
     const size_t optimize_map_size = CalculateOptimizedProcessOverheadSize(size);
@@ -446,6 +454,7 @@ size_t KMemoryManager::Impl::Initialize(KPhysicalAddress address, size_t size,
     // Setup region.
     m_pool = p;
     m_management_region = management;
+    m_page_clearer = page_clearer;
     m_page_reference_counts.resize(
         Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize() / PageSize);
     ASSERT(Common::IsAligned(GetInteger(m_management_region), PageSize));
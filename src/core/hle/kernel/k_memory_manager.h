@@ -7,6 +7,7 @@
 #include <tuple>
 
 #include "common/common_funcs.h"
+#include "core/hle/kernel/free_page_clearer.h"
 #include "core/hle/kernel/k_light_lock.h"
 #include "core/hle/kernel/k_memory_layout.h"
 #include "core/hle/kernel/k_page_heap.h"
@@ -51,6 +52,7 @@ public:
     explicit KMemoryManager(Core::System& system);
 
     void Initialize(KVirtualAddress management_region, size_t management_region_size);
+    void Finalize();
 
     Result InitializeOptimizedMemory(u64 process_id, Pool pool);
     void FinalizeOptimizedMemory(u64 process_id, Pool pool);
@@ -60,6 +62,11 @@ public:
     Result AllocateForProcess(KPageGroup* out, size_t num_pages, u32 option, u64 process_id,
                               u8 fill_pattern);
 
+    /// Fills newly allocated pages, skipping the ones cleared in the background
+    void FillAllocated(KPhysicalAddress address, size_t size, u8 fill_value) {
+        m_page_clearer.Fill(address, size, fill_value);
+    }
+
     Pool GetPool(KPhysicalAddress address) const {
         return this->GetManager(address).GetPool();
     }
@@ -200,15 +207,25 @@ private:
         Impl() = default;
 
         size_t Initialize(KPhysicalAddress address, size_t size, KVirtualAddress management,
-                          KVirtualAddress management_end, Pool p);
+                          KVirtualAddress management_end, Pool p, FreePageClearer* page_clearer);
 
         KPhysicalAddress AllocateBlock(s32 index, bool random) {
-            return m_heap.AllocateBlock(index, random);
+            const KPhysicalAddress block = m_heap.AllocateBlock(index, random);
+            if (block != 0) {
+                const size_t num_pages = KPageHeap::GetBlockNumPages(static_cast<size_t>(index));
+                m_page_clearer->OnAllocate(block, num_pages);
+            }
+            return block;
         }
         KPhysicalAddress AllocateAligned(s32 index, size_t num_pages, size_t align_pages) {
-            return m_heap.AllocateAligned(index, num_pages, align_pages);
+            const KPhysicalAddress block = m_heap.AllocateAligned(index, num_pages, align_pages);
+            if (block != 0) {
+                m_page_clearer->OnAllocate(block, num_pages);
+            }
+            return block;
         }
         void Free(KPhysicalAddress addr, size_t num_pages) {
+            m_page_clearer->OnFree(addr, num_pages);
             m_heap.Free(addr, num_pages);
         }
 
@@ -324,6 +341,7 @@ private:
         KPageHeap m_heap;
         std::vector<RefCount> m_page_reference_counts;
         KVirtualAddress m_management_region{};
+        FreePageClearer* m_page_clearer{};
         Pool m_pool{};
         Impl* m_next{};
         Impl* m_prev{};
@@ -367,6 +385,7 @@ private:
     size_t m_num_managers{};
     PoolArray<u64> m_optimized_process_ids{};
     PoolArray<bool> m_has_optimized_process{};
+    FreePageClearer m_page_clearer;
 };
 
 } // namespace Kernel
@@ -82,8 +82,7 @@ void InvalidateInstructionCache(KernelCore& kernel, AddressType addr, u64 size)
 }
 
 void ClearBackingRegion(Core::System& system, KPhysicalAddress addr, u64 size, u32 fill_value) {
-    system.DeviceMemory().buffer.ClearBackingRegion(GetInteger(addr) - Core::DramMemoryMap::Base,
-                                                    size, fill_value);
+    system.Kernel().MemoryManager().FillAllocated(addr, size, static_cast<u8>(fill_value));
 }
 
 template <typename AddressType>
@@ -5778,6 +5777,14 @@ void KPageTableBase::FinalizeUpdate(PageLinkedList* page_list) {
         // ASSERT(this->GetPageTableManager().GetRefCount(page) == 0);
         // this->GetPageTableManager().Free(page);
     }
+
+    // Perform the host mapping operations of the update, the table must still be locked.
+    ASSERT(this->IsLockedByCurrentThread());
+    m_memory->EndHostMappingBatch();
+}
+
+void KPageTableBase::BeginUpdate() {
+    m_memory->BeginHostMappingBatch();
 }
 
 } // namespace Kernel
@@ -173,7 +173,9 @@ private:
         PageLinkedList m_ll;
 
     public:
-        explicit KScopedPageTableUpdater(KPageTableBase* pt) : m_pt(pt), m_ll() {}
+        explicit KScopedPageTableUpdater(KPageTableBase* pt) : m_pt(pt), m_ll() {
+            m_pt->BeginUpdate();
+        }
         explicit KScopedPageTableUpdater(KPageTableBase& pt)
             : KScopedPageTableUpdater(std::addressof(pt)) {}
         ~KScopedPageTableUpdater() {
@@ -328,6 +330,10 @@ protected:
                    OperationType operation, bool reuse_ll);
     void FinalizeUpdate(PageLinkedList* page_list);
 
+    // Defers host mapping changes until FinalizeUpdate, so they are made in as few calls as
+    // possible.
+    void BeginUpdate();
+
     bool IsLockedByCurrentThread() const {
         return m_general_lock.IsLockedByCurrentThread();
     }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <bit>
 #include <concepts>
 
@@ -79,6 +80,15 @@ public:
     private:
         std::array<Entry, NumCores> m_root{};
 
+        // Queues are only modified with the scheduler lock held, but their lengths can be read
+        // without it.
+        std::array<std::atomic<u32>, NumCores> m_count{};
+
+        constexpr void AddCount(s32 core, s32 delta) {
+            const u32 count = m_count[core].load(std::memory_order_relaxed);
+            m_count[core].store(count + static_cast<u32>(delta), std::memory_order_relaxed);
+        }
+
     public:
         constexpr KPerCoreQueue() {
             for (auto& per_core_root : m_root) {
@@ -100,6 +110,7 @@ public:
             member_entry.SetNext(nullptr);
             tail_entry.SetNext(member);
             m_root[core].SetPrev(member);
+            this->AddCount(core, 1);
 
             return tail == nullptr;
         }
@@ -118,6 +129,7 @@ public:
             member_entry.SetNext(head);
             head_entry.SetPrev(member);
             m_root[core].SetNext(member);
+            this->AddCount(core, 1);
 
             return (head == nullptr);
         }
@@ -137,6 +149,7 @@ public:
             // Unlink.
             prev_entry.SetNext(next);
             next_entry.SetPrev(prev);
+            this->AddCount(core, -1);
 
             return (this->GetFront(core) == nullptr);
         }
@@ -144,6 +157,10 @@ public:
         constexpr Member* GetFront(s32 core) const {
             return m_root[core].GetNext();
         }
+
+        u32 GetCount(s32 core) const {
+            return m_count[core].load(std::memory_order_relaxed);
+        }
     };
 
     class KPriorityQueueImpl {
@@ -211,6 +228,13 @@ public:
             }
         }
 
+        u32 GetCount(s32 priority, s32 core) const {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            return priority <= LowestPriority ? m_queues[priority].GetCount(core) : 0;
+        }
+
         constexpr Member* GetNext(s32 core, const Member* member) const {
             ASSERT(IsValidCore(core));
 
@@ -337,6 +361,12 @@ public:
         return m_suggested_queue.GetFront(priority, core);
     }
 
+    /// Returns the number of threads scheduled on a core at a priority.
+    /// This can be called without the scheduler lock, the result may be stale.
+    u32 GetScheduledCount(s32 core, s32 priority) const {
+        return m_scheduled_queue.GetCount(priority, core);
+    }
+
     constexpr Member* GetScheduledNext(s32 core, const Member* member) const {
         return m_scheduled_queue.GetNext(core, member);
     }
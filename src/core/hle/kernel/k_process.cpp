@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <random>
+#include "common/cityhash.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -16,6 +18,7 @@
 
 #include "core/arm/dynarmic/arm_dynarmic_32.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
+#include "core/arm/dynarmic/dynarmic_block_profile.h"
 #ifdef HAS_NCE
 #include "core/arm/nce/arm_nce.h"
 #endif
@@ -173,6 +176,7 @@ void KProcess::Finalize() {
     }
 
     // Clear expensive resources, as the destructor is not called for guest objects.
+    this->SaveBlockProfile();
     for (auto& interface : m_arm_interfaces) {
         interface.reset();
     }
@@ -992,6 +996,9 @@ Result KProcess::Run(s32 priority, size_t stack_size) {
         main_thread->RequestSuspend(SuspendType::Debug);
     }
 
+    // Translate the code run by previous sessions while the application starts.
+    this->PrewarmInterfaces();
+
     // Run our thread.
     R_TRY(main_thread->Run());
 
@@ -1234,6 +1241,13 @@ void KProcess::LoadModule(CodeSet code_set, KProcessAddress base_addr) {
 
     this->GetMemory().WriteBlock(base_addr, code_set.memory.data(), code_set.memory.size());
 
+    if (this->UsesBlockProfile()) {
+        const auto& code = code_set.CodeSegment();
+        m_code_hash = Common::CityHash64WithSeed(
+            reinterpret_cast<const char*>(code_set.memory.data() + code.offset), code.size,
+            m_code_hash);
+    }
+
     ReprotectSegment(code_set.CodeSegment(), Svc::MemoryPermission::ReadExecute);
     ReprotectSegment(code_set.RODataSegment(), Svc::MemoryPermission::Read);
     ReprotectSegment(code_set.DataSegment(), Svc::MemoryPermission::ReadWrite);
@@ -1278,6 +1292,56 @@ void KProcess::InitializeInterfaces() {
     }
 }
 
+bool KProcess::UsesBlockProfile() const {
+#ifdef HAS_NCE
+    if (Settings::IsNceEnabled()) {
+        return false;
+    }
+#endif
+    return Settings::values.use_jit_block_profile.GetValue() && this->IsApplication() &&
+           this->Is64Bit();
+}
+
+void KProcess::PrewarmInterfaces() {
+    if (!this->UsesBlockProfile()) {
+        return;
+    }
+    m_block_profile = std::make_unique<Core::DynarmicBlockProfile>(m_program_id, m_code_hash);
+
+    std::vector<Core::TranslatedBlock> blocks = m_block_profile->Load(m_code_size);
+    if (blocks.empty()) {
+        return;
+    }
+    for (Core::TranslatedBlock& block : blocks) {
+        block.address += GetInteger(m_code_address);
+    }
+    LOG_INFO(Kernel, "Translating {} guest blocks recorded in previous sessions", blocks.size());
+    for (auto& interface : m_arm_interfaces) {
+        interface->PrewarmBlocks(blocks);
+    }
+}
+
+void KProcess::SaveBlockProfile() {
+    if (!m_block_profile) {
+        return;
+    }
+    // Keep the blocks of previous sessions that were not reached by this one.
+    std::vector<Core::TranslatedBlock> blocks = m_block_profile->Load(m_code_size);
+    const u64 code_start = GetInteger(m_code_address);
+    for (const auto& interface : m_arm_interfaces) {
+        for (Core::TranslatedBlock block : interface->GetRecordedBlocks()) {
+            if (block.address >= code_start && block.address - code_start < m_code_size) {
+                block.address -= code_start;
+                blocks.push_back(block);
+            }
+        }
+    }
+    std::ranges::sort(blocks);
+    blocks.erase(std::ranges::unique(blocks).begin(), blocks.end());
+    m_block_profile->Save(blocks);
+    m_block_profile.reset();
+}
+
 bool KProcess::InsertWatchpoint(KProcessAddress addr, u64 size, DebugWatchpointType type) {
     const auto watch{std::find_if(m_watchpoints.begin(), m_watchpoints.end(), [&](const auto& wp) {
         return wp.type == DebugWatchpointType::None;
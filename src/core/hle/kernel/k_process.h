@@ -19,6 +19,10 @@
 #include "core/hle/kernel/k_thread_local_page.h"
 #include "core/memory.h"
 
+namespace Core {
+class DynarmicBlockProfile;
+}
+
 namespace Kernel {
 
 enum class DebugWatchpointType : u8 {
@@ -128,12 +132,18 @@ private:
     std::unordered_map<u64, u64> m_post_handlers{};
 #endif
     std::unique_ptr<Core::ExclusiveMonitor> m_exclusive_monitor;
+    std::unique_ptr<Core::DynarmicBlockProfile> m_block_profile;
+    u64 m_code_hash{};
     Core::Memory::Memory m_memory;
 
 private:
     Result StartTermination();
     void FinishTermination();
 
+    bool UsesBlockProfile() const;
+    void PrewarmInterfaces();
+    void SaveBlockProfile();
+
     void PinThread(s32 core_id, KThread* thread) {
         ASSERT(0 <= core_id && core_id < static_cast<s32>(Core::Hardware::NUM_CPU_CORES));
         ASSERT(thread != nullptr);
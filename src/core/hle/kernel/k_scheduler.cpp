@@ -693,6 +693,18 @@ void KScheduler::YieldWithoutCoreMigration(KernelCore& kernel) {
     // Get a reference to the priority queue.
     auto& priority_queue = GetPriorityQueue(kernel);
 
+    // If the thread is alone at its priority on its core, moving it to the back of the queue
+    // would not change what runs next. Skip the scheduler lock in that case, a thread becoming
+    // runnable concurrently is handled as if it had been scheduled after the yield.
+    if (const s32 core_id = cur_thread.GetActiveCore();
+        core_id >= 0 && !cur_thread.IsDummyThread() &&
+        cur_thread.GetRawState() == ThreadState::Runnable &&
+        priority_queue.GetScheduledCount(core_id, cur_thread.GetPriority()) == 1) {
+        kernel.GlobalSchedulerContext().CountLocklessYield(core_id);
+        cur_thread.SetYieldScheduleCount(cur_process.GetScheduledCount());
+        return;
+    }
+
     // Perform the yield.
     {
         KScopedSchedulerLock sl{kernel};
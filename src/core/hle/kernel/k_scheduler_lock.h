@@ -33,7 +33,13 @@ public:
         } else {
             // Otherwise, we want to disable scheduling and acquire the spinlock.
             SchedulerType::DisableScheduling(m_kernel);
-            m_spin_lock.Lock();
+            if (!m_spin_lock.TryLock()) {
+                // Another thread holds the lock, note the contention and wait for it.
+                m_contended_count.fetch_add(1, std::memory_order_relaxed);
+                m_spin_lock.Lock();
+            }
+            m_acquire_count.store(m_acquire_count.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
 
             ASSERT(m_lock_count == 0);
             ASSERT(m_owner_thread == nullptr);
@@ -68,6 +74,16 @@ public:
         }
     }
 
+    /// Returns the number of times the lock was acquired by a thread not already holding it
+    u64 GetAcquireCount() const {
+        return m_acquire_count.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of acquisitions that had to wait for another thread
+    u64 GetContendedCount() const {
+        return m_contended_count.load(std::memory_order_relaxed);
+    }
+
 private:
     friend class GlobalSchedulerContext;
 
@@ -75,6 +91,8 @@ private:
     KAlignedSpinLock m_spin_lock{};
     s32 m_lock_count{};
     std::atomic<KThread*> m_owner_thread{};
+    std::atomic<u64> m_acquire_count{};
+    std::atomic<u64> m_contended_count{};
 };
 
 } // namespace Kernel
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 
 #include "common/assert.h"
@@ -10,6 +12,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/spin_lock.h"
+#include "core/hardware_properties.h"
 
 namespace Kernel {
 
@@ -63,6 +66,31 @@ public:
         m_lock.unlock();
     }
 
+    size_t AllocateBatch(void** out_objs, size_t count) {
+        m_lock.lock();
+
+        size_t num_allocated = 0;
+        for (Node* cur = m_head; cur != nullptr && num_allocated < count; cur = m_head) {
+            m_head = cur->next;
+            out_objs[num_allocated++] = cur;
+        }
+
+        m_lock.unlock();
+        return num_allocated;
+    }
+
+    void FreeBatch(void* const* objs, size_t count) {
+        m_lock.lock();
+
+        for (size_t i = 0; i < count; ++i) {
+            Node* node = static_cast<Node*>(objs[i]);
+            node->next = m_head;
+            m_head = node;
+        }
+
+        m_lock.unlock();
+    }
+
 private:
     std::atomic<Node*> m_head{};
     Common::SpinLock m_lock;
@@ -75,13 +103,41 @@ class KSlabHeapBase : protected impl::KSlabHeapImpl {
     YUZU_NON_COPYABLE(KSlabHeapBase);
     YUZU_NON_MOVEABLE(KSlabHeapBase);
 
+public:
+    static constexpr size_t NumCaches = Core::Hardware::NUM_CPU_CORES;
+    static constexpr size_t CacheSize = 16;
+
+    // Smaller heaps don't use caches, so objects held by other cores can't exhaust them.
+    static constexpr size_t MinObjectsForCaches = NumCaches * CacheSize * 8;
+
+    struct CacheStatistics {
+        u64 hits;   ///< Allocations and frees done in a core cache
+        u64 misses; ///< Allocations and frees that accessed the shared list
+    };
+
 private:
+    // Objects recently freed on a core, which are allocated again by the same core without
+    // touching the shared list.
+    struct alignas(64) Cache {
+        std::array<void*, CacheSize> objects{};
+        size_t count{};
+        std::atomic<u64> hits{};
+        std::atomic<u64> misses{};
+    };
+
     size_t m_obj_size{};
     uintptr_t m_peak{};
     uintptr_t m_start{};
     uintptr_t m_end{};
+    bool m_use_caches{};
+    std::array<Cache, NumCaches> m_caches{};
 
 private:
+    static void Count(std::atomic<u64>& counter) {
+        // Only the owning core writes its counters.
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
     void UpdatePeakImpl(uintptr_t obj) {
         const uintptr_t alloc_peak = obj + this->GetObjectSize();
         uintptr_t cur_peak = m_peak;
@@ -115,6 +171,7 @@ public:
         m_start = reinterpret_cast<uintptr_t>(memory);
         m_end = m_start + num_obj * obj_size;
         m_peak = m_start;
+        m_use_caches = num_obj >= MinObjectsForCaches;
 
         // Free the objects.
         u8* cur = reinterpret_cast<u8*>(m_end);
@@ -146,6 +203,61 @@ public:
         KSlabHeapImpl::Free(obj);
     }
 
+    // Allocation through the cache of a core, core_id is the current host thread id.
+    // Other host threads use the shared list. A core's cache is only used by its host thread,
+    // and guest threads are never switched during an allocation, so no lock is needed.
+    void* Allocate(size_t core_id) {
+        if (!m_use_caches || core_id >= NumCaches) {
+            return this->Allocate();
+        }
+
+        Cache& cache = m_caches[core_id];
+        if (cache.count == 0) {
+            // Refill half of the cache at once.
+            Count(cache.misses);
+            cache.count = KSlabHeapImpl::AllocateBatch(cache.objects.data(), CacheSize / 2);
+            if (cache.count == 0) {
+                return nullptr;
+            }
+        } else {
+            Count(cache.hits);
+        }
+        return cache.objects[--cache.count];
+    }
+
+    void Free(void* obj, size_t core_id) {
+        if (!m_use_caches || core_id >= NumCaches) {
+            this->Free(obj);
+            return;
+        }
+
+        // Don't allow freeing an object that wasn't allocated from this heap.
+        const bool contained = this->Contains(reinterpret_cast<uintptr_t>(obj));
+        ASSERT(contained);
+
+        Cache& cache = m_caches[core_id];
+        if (cache.count == CacheSize) {
+            // Return the least recently freed half of the cache at once.
+            Count(cache.misses);
+            KSlabHeapImpl::FreeBatch(cache.objects.data(), CacheSize / 2);
+            std::move(cache.objects.begin() + CacheSize / 2, cache.objects.end(),
+                      cache.objects.begin());
+            cache.count = CacheSize / 2;
+        } else {
+            Count(cache.hits);
+        }
+        cache.objects[cache.count++] = obj;
+    }
+
+    CacheStatistics GetCacheStatistics() const {
+        CacheStatistics statistics{};
+        for (const Cache& cache : m_caches) {
+            statistics.hits += cache.hits.load(std::memory_order_relaxed);
+            statistics.misses += cache.misses.load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
     size_t GetObjectIndex(const void* obj) const {
         if constexpr (SupportDynamicExpansion) {
             if (!this->Contains(reinterpret_cast<uintptr_t>(obj))) {
@@ -200,10 +312,23 @@ public:
         return obj;
     }
 
+    T* Allocate(KernelCore& kernel, size_t core_id) {
+        T* obj = static_cast<T*>(BaseHeap::Allocate(core_id));
+
+        if (obj != nullptr) [[likely]] {
+            std::construct_at(obj, kernel);
+        }
+        return obj;
+    }
+
     void Free(T* obj) {
         BaseHeap::Free(obj);
     }
 
+    void Free(T* obj, size_t core_id) {
+        BaseHeap::Free(obj, core_id);
+    }
+
     size_t GetObjectIndex(const T* obj) const {
         return BaseHeap::GetObjectIndex(obj);
     }
@@ -6,6 +6,7 @@
 #include <bitset>
 #include <functional>
 #include <memory>
+#include <string_view>
 #include <thread>
 #include <unordered_set>
 #include <utility>
@@ -14,6 +15,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
@@ -39,8 +41,10 @@
 #include "core/hle/kernel/k_system_resource.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/k_worker_task_manager.h"
+#include "core/hle/kernel/guest_profiler.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_profiler.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sm/sm.h"
@@ -68,6 +72,9 @@ struct KernelCore::Impl {
 
         global_object_list_container = std::make_unique<KAutoObjectWithListContainer>(kernel);
         global_scheduler_context = std::make_unique<Kernel::GlobalSchedulerContext>(kernel);
+        if (Settings::values.profile_svcs) {
+            svc_profiler = std::make_unique<SvcProfiler>(kernel);
+        }
 
         is_phantom_mode_for_singlecore = false;
 
@@ -82,6 +89,9 @@ struct KernelCore::Impl {
         InitializeShutdownThreads();
         InitializePhysicalCores();
         InitializePreemption(kernel);
+        if (Settings::values.profile_guest) {
+            guest_profiler = std::make_unique<GuestProfiler>(kernel);
+        }
         InitializeGlobalData(kernel);
 
         // Initialize the Dynamic Slab Heaps.
@@ -128,6 +138,18 @@ struct KernelCore::Impl {
 
         preemption_event = nullptr;
 
+        if (global_scheduler_context) {
+            global_scheduler_context->LogStatistics();
+        }
+        if (svc_profiler) {
+            svc_profiler->Report();
+            svc_profiler.reset();
+        }
+        if (guest_profiler) {
+            guest_profiler->Report();
+            guest_profiler.reset();
+        }
+
         // Cleanup persistent kernel objects
         auto CleanupObject = [](KAutoObject* obj) {
             if (obj) {
@@ -182,6 +204,11 @@ struct KernelCore::Impl {
 
         hardware_timer->Finalize();
         hardware_timer.reset();
+
+        // Stop clearing freed pages before the device memory is destroyed.
+        if (memory_manager) {
+            memory_manager->Finalize();
+        }
     }
 
     void CloseServices() {
@@ -782,6 +809,8 @@ struct KernelCore::Impl {
     std::atomic<KProcess*> application_process{};
     std::unique_ptr<Kernel::GlobalSchedulerContext> global_scheduler_context;
     std::unique_ptr<Kernel::KHardwareTimer> hardware_timer;
+    std::unique_ptr<SvcProfiler> svc_profiler;
+    std::unique_ptr<GuestProfiler> guest_profiler;
 
     Init::KSlabResourceCounts slab_resource_counts{};
     KResourceLimit* system_resource_limit{};
@@ -862,6 +891,7 @@ void KernelCore::Initialize() {
 
 void KernelCore::Shutdown() {
     impl->Shutdown();
+    LogSlabHeapStatistics();
 }
 
 void KernelCore::CloseServices() {
@@ -937,6 +967,14 @@ const Kernel::PhysicalCore& KernelCore::PhysicalCore(std::size_t id) const {
     return *impl->cores[id];
 }
 
+SvcProfiler* KernelCore::GetSvcProfiler() {
+    return impl->svc_profiler.get();
+}
+
+GuestProfiler* KernelCore::GetGuestProfiler() {
+    return impl->guest_profiler.get();
+}
+
 size_t KernelCore::CurrentPhysicalCoreIndex() const {
     const u32 core_id = impl->GetCurrentHostThreadID();
     if (core_id >= Core::Hardware::NUM_CPU_CORES) {
@@ -1331,8 +1369,36 @@ struct KernelCore::SlabHeapContainer {
     KSlabHeap<KThread::LockWithPriorityInheritanceInfo> lock_info;
     KSlabHeap<KEventInfo> event_info;
     KSlabHeap<KDebug> debug;
+
+    void LogCacheStatistics() const {
+        const auto log_heap = [](std::string_view name, const auto& heap) {
+            const auto statistics = heap.GetCacheStatistics();
+            const u64 total = statistics.hits + statistics.misses;
+            if (total == 0) {
+                return;
+            }
+            LOG_INFO(Kernel, "{} slab heap: {} of {} operations cached ({:.2f}%)", name,
+                     statistics.hits, total,
+                     100.0 * static_cast<double>(statistics.hits) / static_cast<double>(total));
+        };
+        log_heap("KClientSession", client_session);
+        log_heap("KEvent", event);
+        log_heap("KPort", port);
+        log_heap("KSession", session);
+        log_heap("KLightSession", light_session);
+        log_heap("KSharedMemoryInfo", shared_memory_info);
+        log_heap("KThread", thread);
+        log_heap("KThreadLocalPage", thread_local_page);
+        log_heap("KSessionRequest", session_request);
+        log_heap("KThreadLockInfo", lock_info);
+        log_heap("KEventInfo", event_info);
+    }
 };
 
+void KernelCore::LogSlabHeapStatistics() const {
+    slab_heap_container->LogCacheStatistics();
+}
+
 template <typename T>
 KSlabHeap<T>& KernelCore::SlabHeap() {
     if constexpr (std::is_same_v<T, KClientSession>) {
@@ -72,6 +72,8 @@ class KTransferMemory;
 class KWorkerTaskManager;
 class KCodeMemory;
 class PhysicalCore;
+class SvcProfiler;
+class GuestProfiler;
 
 namespace Init {
 struct KSlabResourceCounts;
@@ -139,6 +141,12 @@ public:
     /// Gets the sole instance of the global scheduler
     const Kernel::GlobalSchedulerContext& GlobalSchedulerContext() const;
 
+    /// Gets the SVC profiler, or nullptr when SVCs are not profiled
+    SvcProfiler* GetSvcProfiler();
+
+    /// Gets the guest profiler, or nullptr when guest code is not profiled
+    GuestProfiler* GetGuestProfiler();
+
     /// Gets the sole instance of the Scheduler assoviated with cpu core 'id'
     Kernel::KScheduler& Scheduler(std::size_t id);
 
@@ -332,6 +340,9 @@ private:
     /// Helper to encapsulate all slab heaps in a single heap allocated container
     struct SlabHeapContainer;
 
+    /// Logs how many slab heap operations were served by the per-core caches
+    void LogSlabHeapStatistics() const;
+
     std::unique_ptr<SlabHeapContainer> slab_heap_container;
 };
 
@@ -5,6 +5,7 @@
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/debugger/debugger.h"
+#include "core/hle/kernel/guest_profiler.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/kernel.h"
@@ -48,6 +49,7 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
         return true;
     };
 
+    bool sample_requested{};
     const auto ExitContext = [&]() {
         // Unlock the thread.
         interface->UnlockThread(thread);
@@ -58,6 +60,7 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
         // On exit, we no longer are running.
         m_arm_interface = nullptr;
         m_current_thread = nullptr;
+        sample_requested = std::exchange(m_sample_requested, false);
 
         system.ExitCPUProfile();
     };
@@ -97,6 +100,15 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
             ExitContext();
         }
 
+        // Sample the guest state the thread exited with, before anything is scheduled.
+        if (sample_requested) [[unlikely]] {
+            if (auto* const profiler = m_kernel.GetGuestProfiler(); profiler) {
+                Svc::ThreadContext ctx{};
+                interface->GetContext(ctx);
+                profiler->Record(thread, ctx);
+            }
+        }
+
         // Determine why we stopped.
         const bool supervisor_call = True(hr & Core::HaltReason::SupervisorCall);
         const bool prefetch_abort = True(hr & Core::HaltReason::PrefetchAbort);
@@ -235,6 +247,21 @@ void PhysicalCore::Interrupt() {
     arm_interface->SignalInterrupt(thread);
 }
 
+void PhysicalCore::RequestSample() {
+    // Lock core context.
+    std::scoped_lock lk{m_guard};
+
+    // Idle cores have nothing to sample. On single core, the next slice is sampled instead.
+    if (m_arm_interface == nullptr) {
+        m_sample_requested = m_is_single_core;
+        return;
+    }
+
+    // Make the running thread exit guest code without interrupting the kernel.
+    m_sample_requested = true;
+    m_arm_interface->SignalInterrupt(m_current_thread);
+}
+
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
     m_is_interrupted = false;
@@ -58,6 +58,9 @@ public:
     // Check if this core is interrupted.
     bool IsInterrupted() const;
 
+    // Ask for the guest profiler to sample the thread running on this core.
+    void RequestSample();
+
     std::size_t CoreIndex() const {
         return m_core_index;
     }
@@ -71,6 +74,7 @@ private:
     Core::ArmInterface* m_arm_interface{};
     KThread* m_current_thread{};
     bool m_is_interrupted{};
+    bool m_sample_requested{};
     bool m_is_single_core{};
 };
 
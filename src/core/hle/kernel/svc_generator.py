@@ -545,10 +545,12 @@ void Call(Core::System& system, u32 imm);
 PROLOGUE_CPP = """
 #include <type_traits>
 
+#include "common/metrics.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_profiler.h"
 
 namespace Kernel::Svc {
 
@@ -598,12 +600,23 @@ void Call(Core::System& system, u32 imm) {
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
 
+    static auto& svc_calls = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_svc_calls_total", "Supervisor calls made by the guest");
+    svc_calls.Increment();
+
+    auto* const svc_profiler = kernel.GetSvcProfiler();
+    const u64 svc_start_ns = svc_profiler != nullptr ? SvcProfiler::GetTimeNs() : 0;
+
     if (process.Is64Bit()) {
         Call64(system, imm, args);
     } else {
         Call32(system, imm, args);
     }
 
+    if (svc_profiler != nullptr) {
+        svc_profiler->Record(imm, svc_start_ns);
+    }
+
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
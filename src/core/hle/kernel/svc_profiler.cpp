@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_profiler.h"
+
+namespace Kernel {
+namespace {
+
+constexpr size_t MAX_LOGGED_SVCS = 16;
+constexpr size_t MAX_REPORTED_THREAD_SVCS = 8;
+
+std::string GetSvcName(u32 svc_id) {
+#define SVC_NAME(name)                                                                             \
+    case Svc::SvcId::name:                                                                         \
+        return #name
+
+    switch (static_cast<Svc::SvcId>(svc_id)) {
+        SVC_NAME(SetHeapSize);
+        SVC_NAME(SetMemoryPermission);
+        SVC_NAME(SetMemoryAttribute);
+        SVC_NAME(MapMemory);
+        SVC_NAME(UnmapMemory);
+        SVC_NAME(QueryMemory);
+        SVC_NAME(ExitProcess);
+        SVC_NAME(CreateThread);
+        SVC_NAME(StartThread);
+        SVC_NAME(ExitThread);
+        SVC_NAME(SleepThread);
+        SVC_NAME(GetThreadPriority);
+        SVC_NAME(SetThreadPriority);
+        SVC_NAME(GetThreadCoreMask);
+        SVC_NAME(SetThreadCoreMask);
+        SVC_NAME(GetCurrentProcessorNumber);
+        SVC_NAME(SignalEvent);
+        SVC_NAME(ClearEvent);
+        SVC_NAME(MapSharedMemory);
+        SVC_NAME(UnmapSharedMemory);
+        SVC_NAME(CreateTransferMemory);
+        SVC_NAME(CloseHandle);
+        SVC_NAME(ResetSignal);
+        SVC_NAME(WaitSynchronization);
+        SVC_NAME(CancelSynchronization);
+        SVC_NAME(ArbitrateLock);
+        SVC_NAME(ArbitrateUnlock);
+        SVC_NAME(WaitProcessWideKeyAtomic);
+        SVC_NAME(SignalProcessWideKey);
+        SVC_NAME(GetSystemTick);
+        SVC_NAME(ConnectToNamedPort);
+        SVC_NAME(SendSyncRequestLight);
+        SVC_NAME(SendSyncRequest);
+        SVC_NAME(SendSyncRequestWithUserBuffer);
+        SVC_NAME(SendAsyncRequestWithUserBuffer);
+        SVC_NAME(GetProcessId);
+        SVC_NAME(GetThreadId);
+        SVC_NAME(Break);
+        SVC_NAME(OutputDebugString);
+        SVC_NAME(ReturnFromException);
+        SVC_NAME(GetInfo);
+        SVC_NAME(FlushEntireDataCache);
+        SVC_NAME(FlushDataCache);
+        SVC_NAME(MapPhysicalMemory);
+        SVC_NAME(UnmapPhysicalMemory);
+        SVC_NAME(GetDebugFutureThreadInfo);
+        SVC_NAME(GetLastThreadInfo);
+        SVC_NAME(GetResourceLimitLimitValue);
+        SVC_NAME(GetResourceLimitCurrentValue);
+        SVC_NAME(SetThreadActivity);
+        SVC_NAME(GetThreadContext3);
+        SVC_NAME(WaitForAddress);
+        SVC_NAME(SignalToAddress);
+        SVC_NAME(SynchronizePreemptionState);
+        SVC_NAME(GetResourceLimitPeakValue);
+        SVC_NAME(CreateIoPool);
+        SVC_NAME(CreateIoRegion);
+        SVC_NAME(KernelDebug);
+        SVC_NAME(ChangeKernelTraceState);
+        SVC_NAME(CreateSession);
+        SVC_NAME(AcceptSession);
+        SVC_NAME(ReplyAndReceiveLight);
+        SVC_NAME(ReplyAndReceive);
+        SVC_NAME(ReplyAndReceiveWithUserBuffer);
+        SVC_NAME(CreateEvent);
+        SVC_NAME(MapIoRegion);
+        SVC_NAME(UnmapIoRegion);
+        SVC_NAME(MapPhysicalMemoryUnsafe);
+        SVC_NAME(UnmapPhysicalMemoryUnsafe);
+        SVC_NAME(SetUnsafeLimit);
+        SVC_NAME(CreateCodeMemory);
+        SVC_NAME(ControlCodeMemory);
+        SVC_NAME(SleepSystem);
+        SVC_NAME(ReadWriteRegister);
+        SVC_NAME(SetProcessActivity);
+        SVC_NAME(CreateSharedMemory);
+        SVC_NAME(MapTransferMemory);
+        SVC_NAME(UnmapTransferMemory);
+        SVC_NAME(CreateInterruptEvent);
+        SVC_NAME(QueryPhysicalAddress);
+        SVC_NAME(QueryIoMapping);
+        SVC_NAME(CreateDeviceAddressSpace);
+        SVC_NAME(AttachDeviceAddressSpace);
+        SVC_NAME(DetachDeviceAddressSpace);
+        SVC_NAME(MapDeviceAddressSpaceByForce);
+        SVC_NAME(MapDeviceAddressSpaceAligned);
+        SVC_NAME(UnmapDeviceAddressSpace);
+        SVC_NAME(InvalidateProcessDataCache);
+        SVC_NAME(StoreProcessDataCache);
+        SVC_NAME(FlushProcessDataCache);
+        SVC_NAME(DebugActiveProcess);
+        SVC_NAME(BreakDebugProcess);
+        SVC_NAME(TerminateDebugProcess);
+        SVC_NAME(GetDebugEvent);
+        SVC_NAME(ContinueDebugEvent);
+        SVC_NAME(GetProcessList);
+        SVC_NAME(GetThreadList);
+        SVC_NAME(GetDebugThreadContext);
+        SVC_NAME(SetDebugThreadContext);
+        SVC_NAME(QueryDebugProcessMemory);
+        SVC_NAME(ReadDebugProcessMemory);
+        SVC_NAME(WriteDebugProcessMemory);
+        SVC_NAME(SetHardwareBreakPoint);
+        SVC_NAME(GetDebugThreadParam);
+        SVC_NAME(GetSystemInfo);
+        SVC_NAME(CreatePort);
+        SVC_NAME(ManageNamedPort);
+        SVC_NAME(ConnectToPort);
+        SVC_NAME(SetProcessMemoryPermission);
+        SVC_NAME(MapProcessMemory);
+        SVC_NAME(UnmapProcessMemory);
+        SVC_NAME(QueryProcessMemory);
+        SVC_NAME(MapProcessCodeMemory);
+        SVC_NAME(UnmapProcessCodeMemory);
+        SVC_NAME(CreateProcess);
+        SVC_NAME(StartProcess);
+        SVC_NAME(TerminateProcess);
+        SVC_NAME(GetProcessInfo);
+        SVC_NAME(CreateResourceLimit);
+        SVC_NAME(SetResourceLimitLimitValue);
+        SVC_NAME(CallSecureMonitor);
+        SVC_NAME(MapInsecureMemory);
+        SVC_NAME(UnmapInsecureMemory);
+    }
+#undef SVC_NAME
+    return fmt::format("Unknown0x{:02X}", svc_id);
+}
+
+/// Returns an upper bound of the latency below which the given fraction of calls completed
+u64 GetPercentile(const std::array<u64, SvcProfiler::NumBuckets>& histogram, u64 num_calls,
+                  double fraction) {
+    const auto threshold = static_cast<u64>(static_cast<double>(num_calls) * fraction);
+    u64 accumulated = 0;
+    for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+        accumulated += histogram[bucket];
+        if (accumulated > threshold) {
+            return u64{1} << bucket;
+        }
+    }
+    return u64{1} << (histogram.size() - 1);
+}
+
+} // Anonymous namespace
+
+SvcProfiler::SvcProfiler(KernelCore& kernel) : m_kernel{kernel} {}
+
+SvcProfiler::~SvcProfiler() = default;
+
+u64 SvcProfiler::GetTimeNs() {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+}
+
+void SvcProfiler::Record(u32 svc_id, u64 start_ns) {
+    if (svc_id >= NumSvcs) [[unlikely]] {
+        return;
+    }
+    const u64 elapsed_ns = GetTimeNs() - start_ns;
+    CoreStatistics& core = m_cores[m_kernel.CurrentPhysicalCoreIndex()];
+
+    SvcStatistics& svc = core.svcs[svc_id];
+    ++svc.num_calls;
+    svc.total_ns += elapsed_ns;
+    svc.max_ns = std::max(svc.max_ns, elapsed_ns);
+    ++svc.histogram[std::min<size_t>(std::bit_width(elapsed_ns), NumBuckets - 1)];
+
+    const KThread* const thread = GetCurrentThreadPointer(m_kernel);
+    const auto [it, is_new] = core.threads.try_emplace(thread->GetThreadId());
+    ThreadStatistics& thread_statistics = it->second;
+    if (is_new) {
+        const KProcess* const process = thread->GetOwnerProcess();
+        if (process != nullptr) {
+            thread_statistics.process_id = process->GetProcessId();
+            thread_statistics.process_name = process->GetName();
+        }
+    }
+    thread_statistics.total_ns += elapsed_ns;
+    ++thread_statistics.num_calls[svc_id];
+}
+
+void SvcProfiler::Report() const {
+    // Merge the statistics recorded by each core.
+    std::array<SvcStatistics, NumSvcs> svcs{};
+    std::unordered_map<u64, ThreadStatistics> threads;
+    for (const CoreStatistics& core : m_cores) {
+        for (size_t svc_id = 0; svc_id < NumSvcs; ++svc_id) {
+            const SvcStatistics& src = core.svcs[svc_id];
+            SvcStatistics& dst = svcs[svc_id];
+            dst.num_calls += src.num_calls;
+            dst.total_ns += src.total_ns;
+            dst.max_ns = std::max(dst.max_ns, src.max_ns);
+            for (size_t bucket = 0; bucket < NumBuckets; ++bucket) {
+                dst.histogram[bucket] += src.histogram[bucket];
+            }
+        }
+        for (const auto& [thread_id, src] : core.threads) {
+            const auto [it, is_new] = threads.try_emplace(thread_id, src);
+            if (is_new) {
+                continue;
+            }
+            ThreadStatistics& dst = it->second;
+            dst.total_ns += src.total_ns;
+            for (size_t svc_id = 0; svc_id < NumSvcs; ++svc_id) {
+                dst.num_calls[svc_id] += src.num_calls[svc_id];
+            }
+        }
+    }
+
+    std::vector<u32> svc_ids;
+    for (u32 svc_id = 0; svc_id < NumSvcs; ++svc_id) {
+        if (svcs[svc_id].num_calls != 0) {
+            svc_ids.push_back(svc_id);
+        }
+    }
+    if (svc_ids.empty()) {
+        return;
+    }
+    std::ranges::sort(svc_ids, std::greater{},
+                      [&](u32 svc_id) { return svcs[svc_id].total_ns; });
+
+    const auto format_svc = [&](u32 svc_id) {
+        const SvcStatistics& svc = svcs[svc_id];
+        return fmt::format("{:<32} {:10} calls {:10.1f} ms {:9} ns/call p50 <{:9} ns "
+                           "p99 <{:9} ns max {:9} ns\n",
+                           GetSvcName(svc_id), svc.num_calls,
+                           static_cast<double>(svc.total_ns) / 1'000'000.0,
+                           svc.total_ns / svc.num_calls,
+                           GetPercentile(svc.histogram, svc.num_calls, 0.5),
+                           GetPercentile(svc.histogram, svc.num_calls, 0.99), svc.max_ns);
+    };
+
+    std::string report;
+    for (u32 svc_id : svc_ids) {
+        report += format_svc(svc_id);
+    }
+    report += "\nLatency histograms\n";
+    for (u32 svc_id : svc_ids) {
+        report += fmt::format("{}:", GetSvcName(svc_id));
+        const SvcStatistics& svc = svcs[svc_id];
+        for (size_t bucket = 0; bucket < NumBuckets; ++bucket) {
+            if (svc.histogram[bucket] != 0) {
+                report += fmt::format(" <{}ns={}", u64{1} << bucket, svc.histogram[bucket]);
+            }
+        }
+        report += '\n';
+    }
+
+    std::vector<std::pair<u64, const ThreadStatistics*>> sorted_threads;
+    sorted_threads.reserve(threads.size());
+    for (const auto& [thread_id, thread] : threads) {
+        sorted_threads.emplace_back(thread_id, &thread);
+    }
+    std::ranges::sort(sorted_threads, std::greater{},
+                      [](const auto& pair) { return pair.second->total_ns; });
+    report += "\nThreads\n";
+    for (const auto& [thread_id, thread] : sorted_threads) {
+        report += fmt::format("Process {} ({}) thread {}: {:.1f} ms,", thread->process_id,
+                              thread->process_name, thread_id,
+                              static_cast<double>(thread->total_ns) / 1'000'000.0);
+        std::vector<u32> thread_svc_ids;
+        for (u32 svc_id = 0; svc_id < NumSvcs; ++svc_id) {
+            if (thread->num_calls[svc_id] != 0) {
+                thread_svc_ids.push_back(svc_id);
+            }
+        }
+        const size_t num_reported = std::min(thread_svc_ids.size(), MAX_REPORTED_THREAD_SVCS);
+        std::ranges::partial_sort(thread_svc_ids, thread_svc_ids.begin() + num_reported,
+                                  std::greater{},
+                                  [&](u32 svc_id) { return thread->num_calls[svc_id]; });
+        for (size_t index = 0; index < num_reported; ++index) {
+            const u32 svc_id = thread_svc_ids[index];
+            report += fmt::format(" {}={}", GetSvcName(svc_id), thread->num_calls[svc_id]);
+        }
+        report += '\n';
+    }
+
+    const auto log_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir)};
+    const auto filename{log_dir / "svc_profile.txt"};
+    std::string location{Common::FS::PathToUTF8String(filename)};
+    std::ofstream file;
+    if (Common::FS::CreateDir(log_dir)) {
+        file.open(filename, std::ios::out | std::ios::trunc);
+    }
+    if (file) {
+        file << report;
+    } else {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}", location);
+        location = "log only";
+    }
+
+    std::string summary;
+    for (size_t index = 0; index < std::min(svc_ids.size(), MAX_LOGGED_SVCS); ++index) {
+        summary += format_svc(svc_ids[index]);
+    }
+    LOG_INFO(Kernel,
+             "\nMost expensive SVCs, full profile dumped to {}\n"
+             "======================================================================\n"
+             "{}",
+             location, summary);
+}
+
+} // namespace Kernel
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "core/hardware_properties.h"
+
+namespace Kernel {
+
+class KernelCore;
+
+/**
+ * Counts the SVCs called by each guest thread and records histograms of their host latency.
+ * Enabled with the profile_svcs setting, the report is logged and dumped to the log directory
+ * when the kernel shuts down.
+ */
+class SvcProfiler {
+public:
+    static constexpr size_t NumSvcs = 0x100;
+
+    /// Latencies are bucketed by powers of two nanoseconds, bucket N holds latencies below 2^N ns
+    static constexpr size_t NumBuckets = 40;
+
+    explicit SvcProfiler(KernelCore& kernel);
+    ~SvcProfiler();
+
+    SvcProfiler(const SvcProfiler&) = delete;
+    SvcProfiler& operator=(const SvcProfiler&) = delete;
+
+    /// Returns the host time used to measure SVC latencies
+    [[nodiscard]] static u64 GetTimeNs();
+
+    /// Records an SVC called by the current thread, which started at start_ns
+    void Record(u32 svc_id, u64 start_ns);
+
+    /// Logs the most expensive SVCs and dumps the whole profile
+    void Report() const;
+
+private:
+    struct SvcStatistics {
+        u64 num_calls;
+        u64 total_ns;
+        u64 max_ns;
+        std::array<u64, NumBuckets> histogram;
+    };
+
+    struct ThreadStatistics {
+        u64 process_id;
+        std::string process_name;
+        u64 total_ns;
+        std::array<u64, NumSvcs> num_calls;
+    };
+
+    // Only written by the host thread running the core, so recording doesn't need a lock.
+    struct alignas(64) CoreStatistics {
+        std::array<SvcStatistics, NumSvcs> svcs;
+        std::unordered_map<u64, ThreadStatistics> threads;
+    };
+
+    KernelCore& m_kernel;
+    std::array<CoreStatistics, Core::Hardware::NUM_CPU_CORES> m_cores{};
+};
+
+} // namespace Kernel
@@ -25,6 +25,7 @@ void LoopProcess(Core::System& system) {
     server_manager->RegisterNamedService("audrec:u", std::make_shared<AudRecU>(system));
     server_manager->RegisterNamedService("audren:u", std::make_shared<AudRenU>(system));
     server_manager->RegisterNamedService("hwopus", std::make_shared<HwOpus>(system));
+    server_manager->StartAdditionalHostThreads("audio", 2);
     ServerManager::RunServer(std::move(server_manager));
 }
 
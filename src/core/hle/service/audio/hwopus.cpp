@@ -18,9 +18,10 @@ using namespace AudioCore::OpusDecoder;
 
 class IHardwareOpusDecoder final : public ServiceFramework<IHardwareOpusDecoder> {
 public:
-    explicit IHardwareOpusDecoder(Core::System& system_, HardwareOpus& hardware_opus)
+    explicit IHardwareOpusDecoder(Core::System& system_, OpusDecoderManager& manager)
         : ServiceFramework{system_, "IHardwareOpusDecoder"},
-          impl{std::make_unique<AudioCore::OpusDecoder::OpusDecoder>(system_, hardware_opus)} {
+          impl{std::make_unique<AudioCore::OpusDecoder::OpusDecoder>(
+              system_, manager.GetHardwareOpus(), manager.GetWorkBufferPool())} {
         // clang-format off
         static const FunctionInfo functions[] = {
             {0, &IHardwareOpusDecoder::DecodeInterleavedOld, "DecodeInterleavedOld"},
@@ -283,7 +284,7 @@ void HwOpus::OpenHardwareOpusDecoder(HLERequestContext& ctx) {
     LOG_DEBUG(Service_Audio, "sample_rate {} channel_count {} transfer_memory_size 0x{:X}",
               params.sample_rate, params.channel_count, transfer_memory_size);
 
-    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl.GetHardwareOpus())};
+    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl)};
 
     OpusParametersEx ex{
         .sample_rate = params.sample_rate,
@@ -329,7 +330,7 @@ void HwOpus::OpenHardwareOpusDecoderForMultiStream(HLERequestContext& ctx) {
               params.sample_rate, params.channel_count, params.total_stream_count,
               params.stereo_stream_count, transfer_memory_size);
 
-    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl.GetHardwareOpus())};
+    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl)};
 
     OpusMultiStreamParametersEx ex{
         .sample_rate = params.sample_rate,
@@ -375,7 +376,7 @@ void HwOpus::OpenHardwareOpusDecoderEx(HLERequestContext& ctx) {
     LOG_DEBUG(Service_Audio, "sample_rate {} channel_count {} transfer_memory_size 0x{:X}",
               params.sample_rate, params.channel_count, transfer_memory_size);
 
-    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl.GetHardwareOpus())};
+    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl)};
 
     auto result =
         decoder->Initialize(params, transfer_memory.GetPointerUnsafe(), transfer_memory_size);
@@ -417,7 +418,7 @@ void HwOpus::OpenHardwareOpusDecoderForMultiStreamEx(HLERequestContext& ctx) {
               params.sample_rate, params.channel_count, params.total_stream_count,
               params.stereo_stream_count, params.use_large_frame_size, transfer_memory_size);
 
-    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl.GetHardwareOpus())};
+    auto decoder{std::make_shared<IHardwareOpusDecoder>(system, impl)};
 
     auto result =
         decoder->Initialize(params, transfer_memory.GetPointerUnsafe(), transfer_memory_size);
@@ -24,8 +24,10 @@
 #include "core/hle/service/filesystem/fsp_ldr.h"
 #include "core/hle/service/filesystem/fsp_pr.h"
 #include "core/hle/service/filesystem/fsp_srv.h"
+#include "core/hle/service/filesystem/read_ahead_worker.h"
 #include "core/hle/service/filesystem/romfs_controller.h"
 #include "core/hle/service/filesystem/save_data_controller.h"
+#include "core/hle/service/filesystem/write_back_worker.h"
 #include "core/hle/service/server_manager.h"
 #include "core/loader/loader.h"
 
@@ -291,7 +293,9 @@ Result VfsDirectoryServiceWrapper::GetFileTimeStampRaw(
     return ResultSuccess;
 }
 
-FileSystemController::FileSystemController(Core::System& system_) : system{system_} {}
+FileSystemController::FileSystemController(Core::System& system_)
+    : read_ahead_worker{std::make_unique<ReadAheadWorker>()},
+      write_back_worker{std::make_unique<WriteBackWorker>()}, system{system_} {}
 
 FileSystemController::~FileSystemController() = default;
 
@@ -677,6 +681,14 @@ FileSys::VirtualDir FileSystemController::GetBCATDirectory(u64 title_id) const {
     return bis_factory->GetBCATDirectory(title_id);
 }
 
+ReadAheadWorker& FileSystemController::GetReadAheadWorker() {
+    return *read_ahead_worker;
+}
+
+WriteBackWorker& FileSystemController::GetWriteBackWorker() {
+    return *write_back_worker;
+}
+
 void FileSystemController::CreateFactories(FileSys::VfsFilesystem& vfs, bool overwrite) {
     if (overwrite) {
         bis_factory = nullptr;
@@ -728,6 +740,7 @@ void LoopProcess(Core::System& system) {
     server_manager->RegisterNamedService("fsp-ldr", std::make_shared<FSP_LDR>(system));
     server_manager->RegisterNamedService("fsp:pr", std::make_shared<FSP_PR>(system));
     server_manager->RegisterNamedService("fsp-srv", std::move(FileSystemProxyFactory));
+    server_manager->StartAdditionalHostThreads("fsp", 2);
     ServerManager::RunServer(std::move(server_manager));
 }
 
@@ -43,8 +43,10 @@ class ServiceManager;
 
 namespace FileSystem {
 
+class ReadAheadWorker;
 class RomFsController;
 class SaveDataController;
+class WriteBackWorker;
 
 enum class ContentStorageId : u32 {
     System,
@@ -123,6 +125,9 @@ public:
 
     FileSys::VirtualDir GetBCATDirectory(u64 title_id) const;
 
+    ReadAheadWorker& GetReadAheadWorker();
+    WriteBackWorker& GetWriteBackWorker();
+
     // Creates the SaveData, SDMC, and BIS Factories. Should be called once and before any function
     // above is called.
     void CreateFactories(FileSys::VfsFilesystem& vfs, bool overwrite = true);
@@ -148,6 +153,9 @@ private:
     std::unique_ptr<FileSys::RegisteredCache> gamecard_registered;
     std::unique_ptr<FileSys::PlaceholderCache> gamecard_placeholder;
 
+    std::unique_ptr<ReadAheadWorker> read_ahead_worker;
+    std::unique_ptr<WriteBackWorker> write_back_worker;
+
     Core::System& system;
 };
 
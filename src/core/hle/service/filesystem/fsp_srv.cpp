@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <cinttypes>
 #include <cstring>
 #include <iterator>
@@ -12,11 +14,13 @@
 #include "common/common_types.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/settings.h"
 #include "common/string_util.h"
 #include "core/core.h"
 #include "core/file_sys/directory.h"
 #include "core/file_sys/errors.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
 #include "core/file_sys/mode.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/patch_manager.h"
@@ -24,13 +28,17 @@
 #include "core/file_sys/savedata_factory.h"
 #include "core/file_sys/system_archive/system_archive.h"
 #include "core/file_sys/vfs.h"
+#include "core/file_sys/vfs_write_back.h"
 #include "core/hle/result.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/filesystem/fsp_srv.h"
+#include "core/hle/service/filesystem/read_ahead_worker.h"
 #include "core/hle/service/filesystem/romfs_controller.h"
 #include "core/hle/service/filesystem/save_data_controller.h"
+#include "core/hle/service/filesystem/write_back_worker.h"
 #include "core/hle/service/hle_ipc.h"
 #include "core/hle/service/ipc_helpers.h"
+#include "core/perf_stats.h"
 #include "core/reporter.h"
 
 namespace Service::FileSystem {
@@ -47,6 +55,20 @@ struct SizeGetter {
     }
 };
 
+/// Accounts a read of an IFile or IStorage to the frame and to the exported metrics
+static void RecordRead(Core::System& system, std::size_t read_size,
+                       Core::PerfStats::Clock::duration read_time) {
+    static auto& bytes_read = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_fs_read_bytes_total", "Bytes read by the guest from files and storages");
+    static auto& read_seconds = Common::Metrics::GetRegistry().RegisterHistogram(
+        "yuzu_fs_read_seconds", "Host time taken by file and storage reads",
+        {0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1});
+
+    system.GetPerfStats().AddFileSystemWait(read_time);
+    bytes_read.Increment(read_size);
+    read_seconds.Observe(std::chrono::duration<f64>(read_time).count());
+}
+
 enum class FileSystemType : u8 {
     Invalid0 = 0,
     Invalid1 = 1,
@@ -97,10 +119,13 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend straight into the output buffer
+        const auto output = ctx.GetWriteBuffer();
+        const auto read_start = Core::PerfStats::Clock::now();
+        const std::size_t read_size =
+            backend->Read(output.data(), std::min<std::size_t>(length, output.size()), offset);
+        RecordRead(system, read_size, Core::PerfStats::Clock::now() - read_start);
+        ctx.CommitWriteBuffer(read_size);
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(ResultSuccess);
@@ -118,8 +143,11 @@ private:
 
 class IFile final : public ServiceFramework<IFile> {
 public:
-    explicit IFile(Core::System& system_, FileSys::VirtualFile backend_)
-        : ServiceFramework{system_, "IFile"}, backend(std::move(backend_)) {
+    explicit IFile(Core::System& system_, FileSys::VirtualFile backend_, FileSys::Mode mode,
+                   std::shared_ptr<FileSys::WriteBackVfsFile> write_back_ = nullptr)
+        : ServiceFramework{system_, "IFile"},
+          backend(write_back_ != nullptr ? write_back_ : std::move(backend_)),
+          write_back(std::move(write_back_)), read_ahead_enabled{mode == FileSys::Mode::Read} {
         static const FunctionInfo functions[] = {
             {0, &IFile::Read, "Read"},
             {1, &IFile::Write, "Write"},
@@ -132,9 +160,64 @@ public:
         RegisterHandlers(functions);
     }
 
+    ~IFile() override {
+        if (read_ahead_enabled) {
+            system.GetFileSystemController().GetReadAheadWorker().Cancel(backend);
+        }
+        if (write_back != nullptr && !write_back->Flush()) {
+            LOG_ERROR(Service_FS, "Failed to write back {}", write_back->GetFullPath());
+        }
+    }
+
 private:
+    /// Consecutive sequential reads before reading ahead
+    static constexpr u32 SequentialReadsForReadAhead = 2;
+
+    /// How far ahead of the last guest read the data is read
+    static constexpr s64 ReadAheadWindow = 2 * 1024 * 1024;
+
     FileSys::VirtualFile backend;
 
+    // Buffers the writes of save data files, the same file as backend when set
+    std::shared_ptr<FileSys::WriteBackVfsFile> write_back;
+
+    // Sequential access detection, only for files opened read only
+    bool read_ahead_enabled;
+    s64 next_sequential_offset = -1;
+    u32 num_sequential_reads = 0;
+    s64 read_ahead_end = 0;
+
+    void UpdateReadAhead(s64 offset, std::size_t read_size) {
+        if (!read_ahead_enabled || read_size == 0 ||
+            read_size >= FileSys::BlockCacheStorage::MaxCachedReadSize) {
+            return;
+        }
+        if (offset == next_sequential_offset) {
+            ++num_sequential_reads;
+        } else {
+            num_sequential_reads = 0;
+            read_ahead_end = 0;
+        }
+        next_sequential_offset = offset + static_cast<s64>(read_size);
+        if (num_sequential_reads < SequentialReadsForReadAhead) {
+            return;
+        }
+
+        // Refill the window once the guest went through half of it.
+        if (read_ahead_end - next_sequential_offset >= ReadAheadWindow / 2) {
+            return;
+        }
+        const s64 start = std::max(read_ahead_end, next_sequential_offset);
+        const s64 end = std::min(next_sequential_offset + ReadAheadWindow,
+                                 static_cast<s64>(backend->GetSize()));
+        if (start >= end) {
+            return;
+        }
+        system.GetFileSystemController().GetReadAheadWorker().Request(
+            backend, static_cast<std::size_t>(start), static_cast<std::size_t>(end - start));
+        read_ahead_end = end;
+    }
+
     void Read(HLERequestContext& ctx) {
         IPC::RequestParser rp{ctx};
         const u64 option = rp.Pop<u64>();
@@ -158,15 +241,18 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend straight into the output buffer
+        const auto output = ctx.GetWriteBuffer();
+        const auto read_start = Core::PerfStats::Clock::now();
+        const std::size_t read_size =
+            backend->Read(output.data(), std::min<std::size_t>(length, output.size()), offset);
+        RecordRead(system, read_size, Core::PerfStats::Clock::now() - read_start);
+        ctx.CommitWriteBuffer(read_size);
+        UpdateReadAhead(offset, read_size);
 
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(ResultSuccess);
-        rb.Push(static_cast<u64>(output.size()));
+        rb.Push(static_cast<u64>(read_size));
     }
 
     void Write(HLERequestContext& ctx) {
@@ -208,6 +294,11 @@ private:
                    "Could not write all bytes to file (requested={:016X}, actual={:016X}).", length,
                    written);
 
+        if (write_back != nullptr &&
+            write_back->GetPendingSize() >= WriteBackWorker::FlushThreshold) {
+            system.GetFileSystemController().GetWriteBackWorker().Request(write_back);
+        }
+
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(ResultSuccess);
     }
@@ -215,7 +306,12 @@ private:
     void Flush(HLERequestContext& ctx) {
         LOG_DEBUG(Service_FS, "called");
 
-        // Exists for SDK compatibiltity -- No need to flush file.
+        if (write_back != nullptr && !write_back->Flush()) {
+            LOG_ERROR(Service_FS, "Failed to write back {}", write_back->GetFullPath());
+            IPC::ResponseBuilder rb{ctx, 2};
+            rb.Push(ResultUnknown);
+            return;
+        }
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(ResultSuccess);
@@ -321,9 +417,10 @@ private:
 
 class IFileSystem final : public ServiceFramework<IFileSystem> {
 public:
-    explicit IFileSystem(Core::System& system_, FileSys::VirtualDir backend_, SizeGetter size_)
-        : ServiceFramework{system_, "IFileSystem"}, backend{std::move(backend_)}, size{std::move(
-                                                                                      size_)} {
+    explicit IFileSystem(Core::System& system_, FileSys::VirtualDir backend_, SizeGetter size_,
+                         bool buffer_writes_ = false)
+        : ServiceFramework{system_, "IFileSystem"}, backend{std::move(backend_)},
+          size{std::move(size_)}, buffer_writes{buffer_writes_} {
         static const FunctionInfo functions[] = {
             {0, &IFileSystem::CreateFile, "CreateFile"},
             {1, &IFileSystem::DeleteFile, "DeleteFile"},
@@ -363,6 +460,7 @@ public:
     }
 
     void DeleteFile(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const auto file_buffer = ctx.ReadBuffer();
         const std::string name = Common::StringFromBuffer(file_buffer);
 
@@ -383,6 +481,7 @@ public:
     }
 
     void DeleteDirectory(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const auto file_buffer = ctx.ReadBuffer();
         const std::string name = Common::StringFromBuffer(file_buffer);
 
@@ -393,6 +492,7 @@ public:
     }
 
     void DeleteDirectoryRecursively(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const auto file_buffer = ctx.ReadBuffer();
         const std::string name = Common::StringFromBuffer(file_buffer);
 
@@ -403,6 +503,7 @@ public:
     }
 
     void CleanDirectoryRecursively(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const auto file_buffer = ctx.ReadBuffer();
         const std::string name = Common::StringFromBuffer(file_buffer);
 
@@ -413,6 +514,7 @@ public:
     }
 
     void RenameFile(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const std::string src_name = Common::StringFromBuffer(ctx.ReadBuffer(0));
         const std::string dst_name = Common::StringFromBuffer(ctx.ReadBuffer(1));
 
@@ -432,6 +534,8 @@ public:
 
         LOG_DEBUG(Service_FS, "called. file={}, mode={}", name, mode);
 
+        FlushOpenFiles();
+
         FileSys::VirtualFile vfs_file{};
         auto result = backend.OpenFile(&vfs_file, name, mode);
         if (result != ResultSuccess) {
@@ -440,7 +544,14 @@ public:
             return;
         }
 
-        auto file = std::make_shared<IFile>(system, vfs_file);
+        std::shared_ptr<FileSys::WriteBackVfsFile> write_back;
+        if (buffer_writes && True(mode & FileSys::Mode::Write)) {
+            write_back = std::make_shared<FileSys::WriteBackVfsFile>(vfs_file);
+            std::erase_if(open_files, [](const auto& open_file) { return open_file.expired(); });
+            open_files.push_back(write_back);
+        }
+
+        auto file = std::make_shared<IFile>(system, vfs_file, mode, std::move(write_back));
 
         IPC::ResponseBuilder rb{ctx, 2, 0, 1};
         rb.Push(ResultSuccess);
@@ -491,10 +602,10 @@ public:
     }
 
     void Commit(HLERequestContext& ctx) {
-        LOG_WARNING(Service_FS, "(STUBBED) called");
+        LOG_DEBUG(Service_FS, "called");
 
         IPC::ResponseBuilder rb{ctx, 2};
-        rb.Push(ResultSuccess);
+        rb.Push(FlushOpenFiles() ? ResultSuccess : ResultUnknown);
     }
 
     void GetFreeSpaceSize(HLERequestContext& ctx) {
@@ -514,6 +625,7 @@ public:
     }
 
     void GetFileTimeStampRaw(HLERequestContext& ctx) {
+        FlushOpenFiles();
         const auto file_buffer = ctx.ReadBuffer();
         const std::string name = Common::StringFromBuffer(file_buffer);
 
@@ -573,8 +685,22 @@ public:
     }
 
 private:
+    /// Writes back the buffered writes of the files opened from this filesystem
+    bool FlushOpenFiles() {
+        bool success = true;
+        for (const auto& open_file : open_files) {
+            if (const auto file = open_file.lock(); file != nullptr && !file->Flush()) {
+                LOG_ERROR(Service_FS, "Failed to write back {}", file->GetFullPath());
+                success = false;
+            }
+        }
+        return success;
+    }
+
     VfsDirectoryServiceWrapper backend;
     SizeGetter size;
+    bool buffer_writes;
+    std::vector<std::weak_ptr<FileSys::WriteBackVfsFile>> open_files;
 };
 
 class ISaveDataInfoReader final : public ServiceFramework<ISaveDataInfoReader> {
@@ -982,8 +1108,8 @@ void FSP_SRV::OpenSaveDataFileSystem(HLERequestContext& ctx) {
         ASSERT(false);
     }
 
-    auto filesystem =
-        std::make_shared<IFileSystem>(system, std::move(dir), SizeGetter::FromStorageId(fsc, id));
+    auto filesystem = std::make_shared<IFileSystem>(
+        system, std::move(dir), SizeGetter::FromStorageId(fsc, id), true);
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(ResultSuccess);
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/thread.h"
+#include "core/file_sys/vfs.h"
+#include "core/hle/service/filesystem/read_ahead_worker.h"
+
+namespace Service::FileSystem {
+
+ReadAheadWorker::ReadAheadWorker()
+    : m_scratch(ChunkSize),
+      m_thread{[this](std::stop_token stop_token) { ThreadFunction(stop_token); }} {}
+
+ReadAheadWorker::~ReadAheadWorker() = default;
+
+void ReadAheadWorker::Request(FileSys::VirtualFile file, size_t offset, size_t size) {
+    {
+        std::scoped_lock lk{m_queue_mutex};
+        if (m_queue.size() == MaxPendingRequests) {
+            m_queue.pop_front();
+        }
+        m_queue.push_back(Range{std::move(file), offset, size});
+    }
+    m_queue_cv.notify_one();
+}
+
+void ReadAheadWorker::Cancel(const FileSys::VirtualFile& file) {
+    std::scoped_lock lk{m_queue_mutex};
+    std::erase_if(m_queue, [&file](const Range& range) { return range.file == file; });
+}
+
+void ReadAheadWorker::ThreadFunction(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("FsReadAhead");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::Low);
+    while (!stop_token.stop_requested()) {
+        Range range;
+        {
+            std::unique_lock lk{m_queue_mutex};
+            if (!m_queue_cv.wait(lk, stop_token, [this] { return !m_queue.empty(); })) {
+                return;
+            }
+            range = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // Read in chunks, so each of them fits in the block cache and stopping is responsive.
+        for (size_t offset = 0; offset < range.size && !stop_token.stop_requested();) {
+            const size_t chunk_size = std::min(ChunkSize, range.size - offset);
+            const size_t read_size =
+                range.file->Read(m_scratch.data(), chunk_size, range.offset + offset);
+            if (read_size != chunk_size) {
+                break;
+            }
+            offset += read_size;
+        }
+    }
+}
+
+} // namespace Service::FileSystem
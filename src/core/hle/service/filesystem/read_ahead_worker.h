@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs_types.h"
+
+namespace Service::FileSystem {
+
+/**
+ * Reads files ahead of sequential guest reads on a host thread. The data read is discarded, the
+ * point is to leave it decrypted in the NCA block cache by the time the guest asks for it.
+ */
+class ReadAheadWorker {
+public:
+    /// Size of each read, below the largest read the block cache accepts
+    static constexpr size_t ChunkSize = 128 * 1024;
+
+    /// Most ranges waiting to be read, the oldest ones are dropped past it
+    static constexpr size_t MaxPendingRequests = 16;
+
+    ReadAheadWorker();
+    ~ReadAheadWorker();
+
+    ReadAheadWorker(const ReadAheadWorker&) = delete;
+    ReadAheadWorker& operator=(const ReadAheadWorker&) = delete;
+
+    /// Queues a range of a file to be read
+    void Request(FileSys::VirtualFile file, size_t offset, size_t size);
+
+    /// Drops the ranges of a file that were not read yet
+    void Cancel(const FileSys::VirtualFile& file);
+
+private:
+    struct Range {
+        FileSys::VirtualFile file;
+        size_t offset;
+        size_t size;
+    };
+
+    void ThreadFunction(std::stop_token stop_token);
+
+    std::mutex m_queue_mutex;
+    std::condition_variable_any m_queue_cv;
+    std::deque<Range> m_queue;
+    std::vector<u8> m_scratch;
+    std::jthread m_thread;
+};
+
+} // namespace Service::FileSystem
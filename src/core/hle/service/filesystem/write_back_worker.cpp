@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/file_sys/vfs_write_back.h"
+#include "core/hle/service/filesystem/write_back_worker.h"
+
+namespace Service::FileSystem {
+
+WriteBackWorker::WriteBackWorker()
+    : m_thread{[this](std::stop_token stop_token) { ThreadFunction(stop_token); }} {}
+
+WriteBackWorker::~WriteBackWorker() = default;
+
+void WriteBackWorker::Request(std::shared_ptr<FileSys::WriteBackVfsFile> file) {
+    {
+        std::scoped_lock lk{m_queue_mutex};
+        if (std::find(m_queue.begin(), m_queue.end(), file) != m_queue.end()) {
+            return;
+        }
+        m_queue.push_back(std::move(file));
+    }
+    m_queue_cv.notify_one();
+}
+
+void WriteBackWorker::ThreadFunction(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("FsWriteBack");
+    while (!stop_token.stop_requested()) {
+        std::shared_ptr<FileSys::WriteBackVfsFile> file;
+        {
+            std::unique_lock lk{m_queue_mutex};
+            if (!m_queue_cv.wait(lk, stop_token, [this] { return !m_queue.empty(); })) {
+                return;
+            }
+            file = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        if (!file->Flush()) {
+            LOG_ERROR(Service_FS, "Failed to write back {}", file->GetFullPath());
+        }
+    }
+}
+
+} // namespace Service::FileSystem
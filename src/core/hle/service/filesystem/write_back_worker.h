@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "common/common_types.h"
+
+namespace FileSys {
+class WriteBackVfsFile;
+}
+
+namespace Service::FileSystem {
+
+/**
+ * Writes the buffered writes of save data files back to the host filesystem on a host thread, so
+ * guest threads do not wait for the disk while a title writes its saves in many small pieces.
+ */
+class WriteBackWorker {
+public:
+    /// Buffered bytes of a file past which it is queued to be written back
+    static constexpr size_t FlushThreshold = 256 * 1024;
+
+    WriteBackWorker();
+    ~WriteBackWorker();
+
+    WriteBackWorker(const WriteBackWorker&) = delete;
+    WriteBackWorker& operator=(const WriteBackWorker&) = delete;
+
+    /// Queues a file to be written back, if it is not queued already
+    void Request(std::shared_ptr<FileSys::WriteBackVfsFile> file);
+
+private:
+    void ThreadFunction(std::stop_token stop_token);
+
+    std::mutex m_queue_mutex;
+    std::condition_variable_any m_queue_cv;
+    std::deque<std::shared_ptr<FileSys::WriteBackVfsFile>> m_queue;
+    std::jthread m_thread;
+};
+
+} // namespace Service::FileSystem
@@ -446,6 +446,50 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+std::span<u8> HLERequestContext::GetWriteBuffer(std::size_t buffer_index) const {
+    ASSERT_OR_EXECUTE_MSG(
+        buffer_index < write_buffer_views.size(), { return {}; },
+        "Write buffer index {} is out of range", buffer_index);
+
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    const bool is_buffer_c{BufferDescriptorC().size() > buffer_index &&
+                           BufferDescriptorC()[buffer_index].Size()};
+    if (!is_buffer_b && !is_buffer_c) {
+        write_buffer_views[buffer_index] = {};
+        write_buffer_is_copy[buffer_index] = false;
+        return {};
+    }
+
+    const u64 address{is_buffer_b ? BufferDescriptorB()[buffer_index].Address()
+                                  : BufferDescriptorC()[buffer_index].Address()};
+    const std::size_t size{is_buffer_b ? BufferDescriptorB()[buffer_index].Size()
+                                       : BufferDescriptorC()[buffer_index].Size()};
+    if (u8* const pointer = memory.GetContiguousHostPointer(address, size)) {
+        write_buffer_views[buffer_index] = {pointer, size};
+        write_buffer_is_copy[buffer_index] = false;
+    } else {
+        write_buffer_data[buffer_index].resize_destructive(size);
+        write_buffer_views[buffer_index] = write_buffer_data[buffer_index];
+        write_buffer_is_copy[buffer_index] = true;
+    }
+    return write_buffer_views[buffer_index];
+}
+
+std::size_t HLERequestContext::CommitWriteBuffer(std::size_t size,
+                                                 std::size_t buffer_index) const {
+    ASSERT_OR_EXECUTE_MSG(
+        buffer_index < write_buffer_views.size(), { return 0; },
+        "Write buffer index {} is out of range", buffer_index);
+
+    const std::span<u8> view = write_buffer_views[buffer_index];
+    size = std::min(size, view.size());
+    if (write_buffer_is_copy[buffer_index] && size != 0) {
+        return WriteBuffer(view.data(), size, buffer_index);
+    }
+    return size;
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
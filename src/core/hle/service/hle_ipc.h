@@ -303,6 +303,17 @@ public:
         }
     }
 
+    /**
+     * Helper function to get a writable span of a buffer using the appropriate buffer descriptor.
+     * The span points directly to guest memory when the buffer is backed by contiguous host
+     * memory, otherwise to a scratch buffer that is written back by CommitWriteBuffer.
+     */
+    [[nodiscard]] std::span<u8> GetWriteBuffer(std::size_t buffer_index = 0) const;
+
+    /// Helper function to make the first size bytes written to a buffer from GetWriteBuffer
+    /// visible to the guest, returns the number of bytes committed
+    std::size_t CommitWriteBuffer(std::size_t size, std::size_t buffer_index = 0) const;
+
     /// Helper function to get the size of the input buffer
     [[nodiscard]] std::size_t GetReadBufferSize(std::size_t buffer_index = 0) const;
 
@@ -429,6 +440,9 @@ private:
 
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_a{};
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_x{};
+    mutable std::array<Common::ScratchBuffer<u8>, 3> write_buffer_data{};
+    mutable std::array<std::span<u8>, 3> write_buffer_views{};
+    mutable std::array<bool, 3> write_buffer_is_copy{};
 };
 
 } // namespace Service
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <chrono>
 #include <map>
 #include <span>
 #include <boost/icl/interval_set.hpp>
@@ -13,11 +14,15 @@
 #include "common/div_ceil.h"
 #include "common/elf.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
+#include "common/microprofile.h"
 #include "core/hle/service/jit/jit_context.h"
 #include "core/memory.h"
 
 using namespace Common::ELF;
 
+MICROPROFILE_DEFINE(Service_JIT_Call, "HLE", "JIT plugin call", MP_RGB(200, 120, 70));
+
 namespace Service::JIT {
 
 constexpr std::array<u8, 8> SVC0_ARM64 = {
@@ -151,10 +156,14 @@ public:
         callbacks =
             std::make_unique<DynarmicCallbacks64>(memory, local_memory, mapped_ranges, *this);
         user_config.callbacks = callbacks.get();
+        // Plugins run until they return through _stop, their blocks do not need to count cycles
+        user_config.enable_cycle_counting = false;
         jit = std::make_unique<Dynarmic::A64::Jit>(user_config);
     }
 
     bool LoadNRO(std::span<const u8> data) {
+        // Blocks translated from a previous plugin must not run in place of the new one
+        jit->ClearCache();
         local_memory.clear();
 
         relocbase = local_memory.size();
@@ -300,12 +309,26 @@ public:
     }
 
     u64 CallFunction(VAddr func) {
+        MICROPROFILE_SCOPE(Service_JIT_Call);
+        static auto& calls = Common::Metrics::GetRegistry().RegisterCounter(
+            "yuzu_jit_plugin_calls_total", "Calls into the code of JIT service plugins");
+        static auto& call_seconds = Common::Metrics::GetRegistry().RegisterHistogram(
+            "yuzu_jit_plugin_call_seconds", "Host time taken by calls into JIT service plugins",
+            {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01});
+        const auto start = std::chrono::steady_clock::now();
+
         jit->SetRegister(30, helpers["_stop"]);
         jit->SetSP(top_of_stack);
         SetupArguments();
 
+        // The translated blocks are kept between calls, the plugin code only changes when a new
+        // plugin is loaded
         jit->SetPC(func);
         jit->Run();
+
+        calls.Increment();
+        call_seconds.Observe(
+            std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count());
         return jit->GetRegister(0);
     }
 
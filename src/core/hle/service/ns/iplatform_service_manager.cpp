@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/assert.h"
@@ -99,18 +101,97 @@ static u32 GetU32Swapped(const u8* data) {
     return Common::swap32(value);
 }
 
+/// Decrypted shared fonts, identical for every service and every emulated system in the process
+struct SharedFontData {
+    /// Backing memory for the shared font data
+    Kernel::PhysicalMemory memory;
+
+    // Automatically populated based on shared_fonts dump or system archives.
+    std::vector<FontRegion> regions;
+};
+
+static std::shared_ptr<const SharedFontData> BuildSharedFonts(
+    FileSystem::FileSystemController& fsc) {
+    auto fonts = std::make_shared<SharedFontData>();
+
+    // Attempt to load shared font data from disk
+    const auto* nand = fsc.GetSystemNANDContents();
+    std::size_t offset = 0;
+    // Rebuild shared fonts from data ncas or synthesize
+
+    fonts->memory = Kernel::PhysicalMemory(SHARED_FONT_MEM_SIZE);
+    for (auto font : SHARED_FONTS) {
+        FileSys::VirtualFile romfs;
+        const auto nca =
+            nand->GetEntry(static_cast<u64>(font.first), FileSys::ContentRecordType::Data);
+        if (nca) {
+            romfs = nca->GetRomFS();
+        }
+
+        if (!romfs) {
+            romfs = FileSys::SystemArchive::SynthesizeSystemArchive(static_cast<u64>(font.first));
+        }
+
+        if (!romfs) {
+            LOG_ERROR(Service_NS, "Failed to find or synthesize {:016X}! Skipping", font.first);
+            continue;
+        }
+
+        const auto extracted_romfs = FileSys::ExtractRomFS(romfs);
+        if (!extracted_romfs) {
+            LOG_ERROR(Service_NS, "Failed to extract RomFS for {:016X}! Skipping", font.first);
+            continue;
+        }
+        const auto font_fp = extracted_romfs->GetFile(font.second);
+        if (!font_fp) {
+            LOG_ERROR(Service_NS, "{:016X} has no file \"{}\"! Skipping", font.first, font.second);
+            continue;
+        }
+        std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
+        font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
+        // We need to be BigEndian as u32s for the xor encryption
+        std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
+                       Common::swap32);
+        // Font offset and size do not account for the header
+        const FontRegion region{static_cast<u32>(offset + 8),
+                                static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
+        DecryptSharedFont(font_data_u32, fonts->memory, offset);
+        fonts->regions.push_back(region);
+    }
+    return fonts;
+}
+
+/// Returns the shared fonts, only read and decrypted again once no service holds them anymore.
+/// The system archives they come from are the same for every system of the process, so farms
+/// running several systems side by side keep one 17 MiB copy instead of one per pl service.
+static std::shared_ptr<const SharedFontData> GetSharedFonts(
+    FileSystem::FileSystemController& fsc) {
+    static std::mutex mutex;
+    static std::weak_ptr<const SharedFontData> cached_fonts;
+
+    std::scoped_lock lk{mutex};
+    if (auto fonts = cached_fonts.lock()) {
+        return fonts;
+    }
+    auto fonts = BuildSharedFonts(fsc);
+    cached_fonts = fonts;
+    return fonts;
+}
+
 struct IPlatformServiceManager::Impl {
     const FontRegion& GetSharedFontRegion(std::size_t index) const {
-        if (index >= shared_font_regions.size() || shared_font_regions.empty()) {
+        const auto& regions = shared_font->regions;
+        if (index >= regions.size() || regions.empty()) {
             // No font fallback
             return EMPTY_REGION;
         }
-        return shared_font_regions.at(index);
+        return regions.at(index);
     }
 
-    void BuildSharedFontsRawRegions(const Kernel::PhysicalMemory& input) {
+    static std::vector<FontRegion> BuildSharedFontsRawRegions(const Kernel::PhysicalMemory& input) {
         // As we can derive the xor key we can just populate the offsets
         // based on the shared memory dump
+        std::vector<FontRegion> regions;
         unsigned cur_offset = 0;
 
         for (std::size_t i = 0; i < SHARED_FONTS.size(); i++) {
@@ -122,16 +203,14 @@ struct IPlatformServiceManager::Impl {
             // Derive key within inverse xor
             const u32 KEY = GetU32Swapped(input.data() + cur_offset) ^ EXPECTED_MAGIC;
             const u32 SIZE = GetU32Swapped(input.data() + cur_offset + 4) ^ KEY;
-            shared_font_regions.push_back(FontRegion{cur_offset + 8, SIZE});
+            regions.push_back(FontRegion{cur_offset + 8, SIZE});
             cur_offset += SIZE + 8;
         }
+        return regions;
     }
 
-    /// Backing memory for the shared font data
-    std::shared_ptr<Kernel::PhysicalMemory> shared_font;
-
-    // Automatically populated based on shared_fonts dump or system archives.
-    std::vector<FontRegion> shared_font_regions;
+    /// Shared font data, shared with the other services of the process
+    std::shared_ptr<const SharedFontData> shared_font;
 };
 
 IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const char* service_name_)
@@ -158,52 +237,7 @@ IPlatformServiceManager::IPlatformServiceManager(Core::System& system_, const ch
     // clang-format on
     RegisterHandlers(functions);
 
-    auto& fsc = system.GetFileSystemController();
-
-    // Attempt to load shared font data from disk
-    const auto* nand = fsc.GetSystemNANDContents();
-    std::size_t offset = 0;
-    // Rebuild shared fonts from data ncas or synthesize
-
-    impl->shared_font = std::make_shared<Kernel::PhysicalMemory>(SHARED_FONT_MEM_SIZE);
-    for (auto font : SHARED_FONTS) {
-        FileSys::VirtualFile romfs;
-        const auto nca =
-            nand->GetEntry(static_cast<u64>(font.first), FileSys::ContentRecordType::Data);
-        if (nca) {
-            romfs = nca->GetRomFS();
-        }
-
-        if (!romfs) {
-            romfs = FileSys::SystemArchive::SynthesizeSystemArchive(static_cast<u64>(font.first));
-        }
-
-        if (!romfs) {
-            LOG_ERROR(Service_NS, "Failed to find or synthesize {:016X}! Skipping", font.first);
-            continue;
-        }
-
-        const auto extracted_romfs = FileSys::ExtractRomFS(romfs);
-        if (!extracted_romfs) {
-            LOG_ERROR(Service_NS, "Failed to extract RomFS for {:016X}! Skipping", font.first);
-            continue;
-        }
-        const auto font_fp = extracted_romfs->GetFile(font.second);
-        if (!font_fp) {
-            LOG_ERROR(Service_NS, "{:016X} has no file \"{}\"! Skipping", font.first, font.second);
-            continue;
-        }
-        std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
-        font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
-        // We need to be BigEndian as u32s for the xor encryption
-        std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
-                       Common::swap32);
-        // Font offset and size do not account for the header
-        const FontRegion region{static_cast<u32>(offset + 8),
-                                static_cast<u32>((font_data_u32.size() * sizeof(u32)) - 8)};
-        DecryptSharedFont(font_data_u32, *impl->shared_font, offset);
-        impl->shared_font_regions.push_back(region);
-    }
+    impl->shared_font = GetSharedFonts(system.GetFileSystemController());
 }
 
 IPlatformServiceManager::~IPlatformServiceManager() = default;
@@ -253,8 +287,8 @@ void IPlatformServiceManager::GetSharedMemoryNativeHandle(HLERequestContext& ctx
     LOG_DEBUG(Service_NS, "called");
 
     // Create shared font memory object
-    std::memcpy(kernel.GetFontSharedMem().GetPointer(), impl->shared_font->data(),
-                impl->shared_font->size());
+    std::memcpy(kernel.GetFontSharedMem().GetPointer(), impl->shared_font->memory.data(),
+                impl->shared_font->memory.size());
 
     IPC::ResponseBuilder rb{ctx, 2, 1};
     rb.Push(ResultSuccess);
@@ -281,7 +315,7 @@ void IPlatformServiceManager::GetSharedFontInOrderOfPriority(HLERequestContext&
     std::vector<u32> font_sizes;
 
     // TODO(ogniK): Have actual priority order
-    for (std::size_t i = 0; i < impl->shared_font_regions.size(); i++) {
+    for (std::size_t i = 0; i < impl->shared_font->regions.size(); i++) {
         font_codes.push_back(static_cast<u32>(i));
         auto region = impl->GetSharedFontRegion(i);
         font_offsets.push_back(region.offset);
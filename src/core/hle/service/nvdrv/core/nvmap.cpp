@@ -140,21 +140,26 @@ NvResult NvMap::CreateHandle(u64 size, std::shared_ptr<NvMap::Handle>& result_ou
 }
 
 std::shared_ptr<NvMap::Handle> NvMap::GetHandle(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle);
-    } catch (std::out_of_range&) {
-        return nullptr;
-    }
+    std::shared_lock lock(handles_lock);
+    const auto it = handles.find(handle);
+    return it != handles.end() ? it->second : nullptr;
 }
 
 DAddr NvMap::GetHandleAddress(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle)->d_address;
-    } catch (std::out_of_range&) {
-        return 0;
+    std::shared_lock lock(handles_lock);
+    const auto it = handles.find(handle);
+    return it != handles.end() ? it->second->d_address : 0;
+}
+
+bool NvMap::TryAddPin(Handle& handle_description) {
+    s64 pins = handle_description.pins.load(std::memory_order_acquire);
+    while (pins > 0) {
+        if (handle_description.pins.compare_exchange_weak(pins, pins + 1,
+                                                          std::memory_order_acq_rel)) {
+            return true;
+        }
     }
+    return false;
 }
 
 DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
@@ -163,6 +168,12 @@ DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
         return 0;
     }
 
+    // Pinning a mapped handle again only has to count the pin. Low area pins can map the handle
+    // into the GMMU, that is left to the locked path below.
+    if (!low_area_pin && TryAddPin(*handle_description)) {
+        return handle_description->d_address;
+    }
+
     std::scoped_lock lock(handle_description->mutex);
     const auto map_low_area = [&] {
         if (handle_description->pin_virt_address == 0) {
@@ -246,6 +257,15 @@ void NvMap::UnpinHandle(Handle::Id handle) {
         return;
     }
 
+    // Unpins that leave other pins behind don't change the mapping
+    s64 pins = handle_description->pins.load(std::memory_order_acquire);
+    while (pins > 1) {
+        if (handle_description->pins.compare_exchange_weak(pins, pins - 1,
+                                                           std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+
     std::scoped_lock lock(handle_description->mutex);
     if (--handle_description->pins < 0) {
         LOG_WARNING(Service_NVDRV, "Pin count imbalance detected!");
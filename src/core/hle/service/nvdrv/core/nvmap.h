@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <unordered_map>
 #include <assert.h>
 
@@ -51,7 +52,9 @@ public:
         using Id = u32;
         Id id; //!< A globally unique identifier for this handle
 
-        s64 pins{};
+        /// Number of pins, changes from and to zero happen with `mutex` locked. Further pins and
+        /// unpins only touch the counter, the SMMU mapping stays valid while it is not zero.
+        std::atomic<s64> pins{};
         u32 pin_virt_address{};
         std::optional<typename std::list<std::shared_ptr<Handle>>::iterator> unmap_queue_entry{};
 
@@ -157,8 +160,8 @@ private:
     std::mutex unmap_queue_lock{}; //!< Protects access to `unmap_queue`
 
     std::unordered_map<Handle::Id, std::shared_ptr<Handle>>
-        handles{};           //!< Main owning map of handles
-    std::mutex handles_lock; //!< Protects access to `handles`
+        handles{};                  //!< Main owning map of handles
+    std::shared_mutex handles_lock; //!< Protects access to `handles`, lookups share it
 
     static constexpr u32 HandleIdIncrement{
         4}; //!< Each new handle ID is an increment of 4 from the previous
@@ -167,6 +170,12 @@ private:
 
     void AddHandle(std::shared_ptr<Handle> handle);
 
+    /**
+     * @brief Adds a pin to a handle that is already pinned, without locking it
+     * @return If the pin was added
+     */
+    static bool TryAddPin(Handle& handle_description);
+
     /**
      * @brief Unmaps and frees the SMMU memory region a handle is mapped to
      * @note Both `unmap_queue_lock` and `handle_description.mutex` MUST be locked when calling this
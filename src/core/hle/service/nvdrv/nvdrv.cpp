@@ -62,6 +62,7 @@ void LoopProcess(Nvnflinger::Nvnflinger& nvnflinger, Core::System& system) {
     server_manager->RegisterNamedService("nvdrv:s", NvdrvInterfaceFactoryForSysmodules);
     server_manager->RegisterNamedService("nvdrv:t", NvdrvInterfaceFactoryForTesting);
     server_manager->RegisterNamedService("nvmemp", std::make_shared<NVMEMP>(system));
+    server_manager->StartAdditionalHostThreads("nvdrv", 2);
     nvnflinger.SetNVDrvInstance(module);
     ServerManager::RunServer(std::move(server_manager));
 }
@@ -114,7 +115,7 @@ NvResult Module::VerifyFD(DeviceFD fd) const {
         return NvResult::InvalidState;
     }
 
-    if (open_files.find(fd) == open_files.end()) {
+    if (!GetOpenDevice(fd)) {
         LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
         return NvResult::NotImplemented;
     }
@@ -122,6 +123,12 @@ NvResult Module::VerifyFD(DeviceFD fd) const {
     return NvResult::Success;
 }
 
+std::shared_ptr<Devices::nvdevice> Module::GetOpenDevice(DeviceFD fd) const {
+    std::shared_lock lock{open_files_mutex};
+    const auto itr = open_files.find(fd);
+    return itr != open_files.end() ? itr->second : nullptr;
+}
+
 DeviceFD Module::Open(const std::string& device_name, NvCore::SessionId session_id) {
     auto it = builders.find(device_name);
     if (it == builders.end()) {
@@ -129,9 +136,14 @@ DeviceFD Module::Open(const std::string& device_name, NvCore::SessionId session_
         return INVALID_NVDRV_FD;
     }
 
-    const DeviceFD fd = next_fd++;
-    auto& builder = it->second;
-    auto device = builder(fd)->second;
+    std::shared_ptr<Devices::nvdevice> device;
+    DeviceFD fd;
+    {
+        std::scoped_lock lock{open_files_mutex};
+        fd = next_fd++;
+        auto& builder = it->second;
+        device = builder(fd)->second;
+    }
 
     device->OnOpen(session_id, fd);
 
@@ -145,14 +157,14 @@ NvResult Module::Ioctl1(DeviceFD fd, Ioctl command, std::span<const u8> input,
         return NvResult::InvalidState;
     }
 
-    const auto itr = open_files.find(fd);
+    const auto device = GetOpenDevice(fd);
 
-    if (itr == open_files.end()) {
+    if (!device) {
         LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
         return NvResult::NotImplemented;
     }
 
-    return itr->second->Ioctl1(fd, command, input, output);
+    return device->Ioctl1(fd, command, input, output);
 }
 
 NvResult Module::Ioctl2(DeviceFD fd, Ioctl command, std::span<const u8> input,
@@ -162,14 +174,14 @@ NvResult Module::Ioctl2(DeviceFD fd, Ioctl command, std::span<const u8> input,
         return NvResult::InvalidState;
     }
 
-    const auto itr = open_files.find(fd);
+    const auto device = GetOpenDevice(fd);
 
-    if (itr == open_files.end()) {
+    if (!device) {
         LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
         return NvResult::NotImplemented;
     }
 
-    return itr->second->Ioctl2(fd, command, input, inline_input, output);
+    return device->Ioctl2(fd, command, input, inline_input, output);
 }
 
 NvResult Module::Ioctl3(DeviceFD fd, Ioctl command, std::span<const u8> input, std::span<u8> output,
@@ -179,14 +191,14 @@ NvResult Module::Ioctl3(DeviceFD fd, Ioctl command, std::span<const u8> input, s
         return NvResult::InvalidState;
     }
 
-    const auto itr = open_files.find(fd);
+    const auto device = GetOpenDevice(fd);
 
-    if (itr == open_files.end()) {
+    if (!device) {
         LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
         return NvResult::NotImplemented;
     }
 
-    return itr->second->Ioctl3(fd, command, input, output, inline_output);
+    return device->Ioctl3(fd, command, input, output, inline_output);
 }
 
 NvResult Module::Close(DeviceFD fd) {
@@ -195,16 +207,21 @@ NvResult Module::Close(DeviceFD fd) {
         return NvResult::InvalidState;
     }
 
-    const auto itr = open_files.find(fd);
+    std::shared_ptr<Devices::nvdevice> device;
+    {
+        std::scoped_lock lock{open_files_mutex};
+        const auto itr = open_files.find(fd);
 
-    if (itr == open_files.end()) {
-        LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
-        return NvResult::NotImplemented;
-    }
+        if (itr == open_files.end()) {
+            LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
+            return NvResult::NotImplemented;
+        }
 
-    itr->second->OnClose(fd);
+        device = std::move(itr->second);
+        open_files.erase(itr);
+    }
 
-    open_files.erase(itr);
+    device->OnClose(fd);
 
     return NvResult::Success;
 }
@@ -215,14 +232,14 @@ NvResult Module::QueryEvent(DeviceFD fd, u32 event_id, Kernel::KEvent*& event) {
         return NvResult::InvalidState;
     }
 
-    const auto itr = open_files.find(fd);
+    const auto device = GetOpenDevice(fd);
 
-    if (itr == open_files.end()) {
+    if (!device) {
         LOG_ERROR(Service_NVDRV, "Could not find DeviceFD={}!", fd);
         return NvResult::NotImplemented;
     }
 
-    event = itr->second->QueryEvent(event_id);
+    event = device->QueryEvent(event_id);
     if (!event) {
         return NvResult::BadParameter;
     }
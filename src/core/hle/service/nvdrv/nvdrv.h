@@ -7,6 +7,7 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <shared_mutex>
 #include <span>
 #include <string>
 #include <unordered_map>
@@ -68,10 +69,7 @@ public:
     /// Returns a pointer to one of the available devices, identified by its name.
     template <typename T>
     std::shared_ptr<T> GetDevice(DeviceFD fd) {
-        auto itr = open_files.find(fd);
-        if (itr == open_files.end())
-            return nullptr;
-        return std::static_pointer_cast<T>(itr->second);
+        return std::static_pointer_cast<T>(GetOpenDevice(fd));
     }
 
     NvResult VerifyFD(DeviceFD fd) const;
@@ -101,9 +99,16 @@ private:
     friend class EventInterface;
     friend class Service::Nvnflinger::Nvnflinger;
 
+    /// Returns the device referenced by a file descriptor, or nullptr if it is not open.
+    std::shared_ptr<Devices::nvdevice> GetOpenDevice(DeviceFD fd) const;
+
     /// Manages syncpoints on the host
     NvCore::Container container;
 
+    /// Sessions are served from several host threads, protects the file descriptor table.
+    /// Ioctls run without it held, devices are never shared between file descriptors.
+    mutable std::shared_mutex open_files_mutex;
+
     /// Id to use for the next open file descriptor.
     DeviceFD next_fd = 1;
 
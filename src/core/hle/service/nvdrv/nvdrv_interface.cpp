@@ -2,7 +2,10 @@
 // SPDX-FileCopyrightText: 2021 Skyline Team and Contributors
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <chrono>
+
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_event.h"
@@ -14,6 +17,31 @@
 #include "core/hle/service/nvdrv/nvdrv_interface.h"
 
 namespace Service::Nvidia {
+namespace {
+/// Returns the span an ioctl writes its output to. Output ioctls write to the guest buffer
+/// directly when possible, the output of other ioctls is discarded.
+std::span<u8> GetOutputBuffer(HLERequestContext& ctx, Ioctl command,
+                              Common::ScratchBuffer<u8>& scratch, std::size_t buffer_index) {
+    if (command.is_out != 0) {
+        return ctx.GetWriteBuffer(buffer_index);
+    }
+    scratch.resize_destructive(ctx.GetWriteBufferSize(buffer_index));
+    return scratch;
+}
+
+/// Accounts an ioctl to the exported metrics
+void RecordIoctl(std::chrono::steady_clock::time_point start) {
+    static auto& ioctls = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_nvdrv_ioctls_total", "Ioctls handled by the nvdrv devices");
+    static auto& ioctl_seconds = Common::Metrics::GetRegistry().RegisterHistogram(
+        "yuzu_nvdrv_ioctl_seconds", "Host time taken by nvdrv device ioctls",
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01});
+
+    ioctls.Increment();
+    ioctl_seconds.Observe(
+        std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count());
+}
+} // Anonymous namespace
 
 void NVDRV::Open(HLERequestContext& ctx) {
     LOG_DEBUG(Service_NVDRV, "called");
@@ -64,12 +92,14 @@ void NVDRV::Ioctl1(HLERequestContext& ctx) {
     }
 
     // Check device
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
     const auto input_buffer = ctx.ReadBuffer(0);
+    const auto output = GetOutputBuffer(ctx, command, output_buffer, 0);
 
-    const auto nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output_buffer);
+    const auto start = std::chrono::steady_clock::now();
+    const auto nv_result = nvdrv->Ioctl1(fd, command, input_buffer, output);
+    RecordIoctl(start);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        ctx.CommitWriteBuffer(output.size());
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -91,12 +121,13 @@ void NVDRV::Ioctl2(HLERequestContext& ctx) {
 
     const auto input_buffer = ctx.ReadBuffer(0);
     const auto input_inlined_buffer = ctx.ReadBuffer(1);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
+    const auto output = GetOutputBuffer(ctx, command, output_buffer, 0);
 
-    const auto nv_result =
-        nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output_buffer);
+    const auto start = std::chrono::steady_clock::now();
+    const auto nv_result = nvdrv->Ioctl2(fd, command, input_buffer, input_inlined_buffer, output);
+    RecordIoctl(start);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer);
+        ctx.CommitWriteBuffer(output.size());
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -117,14 +148,15 @@ void NVDRV::Ioctl3(HLERequestContext& ctx) {
     }
 
     const auto input_buffer = ctx.ReadBuffer(0);
-    output_buffer.resize_destructive(ctx.GetWriteBufferSize(0));
-    inline_output_buffer.resize_destructive(ctx.GetWriteBufferSize(1));
+    const auto output = GetOutputBuffer(ctx, command, output_buffer, 0);
+    const auto inline_output = GetOutputBuffer(ctx, command, inline_output_buffer, 1);
 
-    const auto nv_result =
-        nvdrv->Ioctl3(fd, command, input_buffer, output_buffer, inline_output_buffer);
+    const auto start = std::chrono::steady_clock::now();
+    const auto nv_result = nvdrv->Ioctl3(fd, command, input_buffer, output, inline_output);
+    RecordIoctl(start);
     if (command.is_out != 0) {
-        ctx.WriteBuffer(output_buffer, 0);
-        ctx.WriteBuffer(inline_output_buffer, 1);
+        ctx.CommitWriteBuffer(output.size(), 0);
+        ctx.CommitWriteBuffer(inline_output.size(), 1);
     }
 
     IPC::ResponseBuilder rb{ctx, 3};
@@ -70,7 +70,7 @@ Nvnflinger::Nvnflinger(Core::System& system_, HosBinderDriverServer& hos_binder_
         [this](s64 time,
                std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
             vsync_signal.Set();
-            return std::chrono::nanoseconds(GetNextTicks());
+            return std::chrono::nanoseconds(AlignToHostDisplay(GetNextTicks()));
         });
 
     single_composition_event = Core::Timing::CreateEvent(
@@ -80,7 +80,7 @@ Nvnflinger::Nvnflinger(Core::System& system_, HosBinderDriverServer& hos_binder_
             const auto lock_guard = Lock();
             Compose();
 
-            return std::chrono::nanoseconds(GetNextTicks());
+            return std::chrono::nanoseconds(AlignToHostDisplay(GetNextTicks()));
         });
 
     if (system.IsMulticore()) {
@@ -272,7 +272,17 @@ void Nvnflinger::Compose() {
         if (!display.HasLayers())
             continue;
 
-        // TODO(Subv): Support more than 1 layer.
+        // The renderer presents a single framebuffer, so only the bottom layer is shown. Layers
+        // above it are not composited, but their queued frames are still released, otherwise
+        // their producers would run out of buffers and stall.
+        for (size_t index = 1; index < display.GetNumLayers(); ++index) {
+            auto& consumer = display.GetLayer(index).GetConsumer();
+            android::BufferItem overlay_buffer{};
+            if (consumer.AcquireBuffer(&overlay_buffer, {}, false) == android::Status::NoError) {
+                consumer.ReleaseBuffer(overlay_buffer, android::Fence::NoFence());
+            }
+        }
+
         VI::Layer& layer = display.GetLayer(0);
 
         android::BufferItem buffer{};
@@ -336,6 +346,32 @@ s64 Nvnflinger::GetNextTicks() const {
     return static_cast<s64>(speed_scale * (1000000000.f / effective_fps));
 }
 
+s64 Nvnflinger::AlignToHostDisplay(s64 interval) const {
+    if (!Settings::values.vsync_follows_present.GetValue() || interval <= 0) {
+        return interval;
+    }
+    const auto displayed = system.GPU().GetLastDisplayTime();
+    if (!displayed) {
+        return interval;
+    }
+    const s64 since_displayed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - *displayed)
+                                    .count();
+    if (since_displayed < 0 || since_displayed > 4 * interval) {
+        // The host is not presenting right now
+        return interval;
+    }
+
+    // Offset of this vsync from the closest host refresh, assuming it refreshes once per interval
+    s64 phase = since_displayed % interval;
+    if (phase >= interval / 2) {
+        phase -= interval;
+    }
+    // Converge over a few frames, and never change one interval by enough to be visible
+    const s64 correction = std::clamp(phase / 4, -interval / 16, interval / 16);
+    return interval - correction;
+}
+
 FbShareBufferManager& Nvnflinger::GetSystemBufferManager() {
     const auto lock_guard = Lock();
 
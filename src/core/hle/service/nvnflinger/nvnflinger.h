@@ -99,6 +99,9 @@ public:
 
     [[nodiscard]] s64 GetNextTicks() const;
 
+    /// Adjusts the interval until the next vsync to move it towards the host display refresh
+    [[nodiscard]] s64 AlignToHostDisplay(s64 interval) const;
+
     FbShareBufferManager& GetSystemBufferManager();
 
 private:
@@ -4,6 +4,7 @@
 #include <fmt/format.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
@@ -105,6 +106,7 @@ void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* function
         // Usually this array is sorted by id already, so hint to insert at the end
         handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
     }
+    BuildDirectHandlerTable(direct_handlers, handlers);
 }
 
 void ServiceFrameworkBase::RegisterHandlersBaseTipc(const FunctionInfoBase* functions,
@@ -115,6 +117,35 @@ void ServiceFrameworkBase::RegisterHandlersBaseTipc(const FunctionInfoBase* func
         handlers_tipc.emplace_hint(handlers_tipc.cend(), functions[i].expected_header,
                                    functions[i]);
     }
+    BuildDirectHandlerTable(direct_handlers_tipc, handlers_tipc);
+}
+
+void ServiceFrameworkBase::BuildDirectHandlerTable(DirectHandlerTable& table,
+                                                   const HandlerMap& map) {
+    // Most services implement commands with small ids, bound the table to keep it compact
+    // when a few commands have large ids
+    constexpr u32 MaxDirectCommandId = 256;
+
+    // Map insertions may move the handlers, rebuild the whole table
+    table.clear();
+    for (const auto& [command, info] : map) {
+        if (command >= MaxDirectCommandId) {
+            break;
+        }
+        if (command >= table.size()) {
+            table.resize(command + 1);
+        }
+        table[command] = std::addressof(info);
+    }
+}
+
+const ServiceFrameworkBase::FunctionInfoBase* ServiceFrameworkBase::FindHandler(
+    const DirectHandlerTable& table, const HandlerMap& map, u32 command) {
+    if (command < table.size()) {
+        return table[command];
+    }
+    const auto itr = map.find(command);
+    return itr == map.end() ? nullptr : std::addressof(itr->second);
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
@@ -141,8 +172,7 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
 }
 
 void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
-    auto itr = handlers.find(ctx.GetCommand());
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
+    const FunctionInfoBase* info = FindHandler(direct_handlers, handlers, ctx.GetCommand());
     if (info == nullptr || info->handler_callback == nullptr) {
         return ReportUnimplementedFunction(ctx, info);
     }
@@ -152,11 +182,8 @@ void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
 }
 
 void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
-    boost::container::flat_map<u32, FunctionInfoBase>::iterator itr;
-
-    itr = handlers_tipc.find(ctx.GetCommand());
-
-    const FunctionInfoBase* info = itr == handlers_tipc.end() ? nullptr : &itr->second;
+    const FunctionInfoBase* info =
+        FindHandler(direct_handlers_tipc, handlers_tipc, ctx.GetCommand());
     if (info == nullptr || info->handler_callback == nullptr) {
         return ReportUnimplementedFunction(ctx, info);
     }
@@ -167,6 +194,10 @@ void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
                                                HLERequestContext& ctx) {
+    static auto& ipc_requests = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_ipc_requests_total", "IPC requests handled by HLE services");
+    ipc_requests.Increment();
+
     const auto guard = LockService();
 
     Result result = ResultSuccess;
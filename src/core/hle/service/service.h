@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <mutex>
 #include <string>
+#include <vector>
 #include <boost/container/flat_map.hpp>
 #include "common/common_types.h"
 #include "core/hle/service/hle_ipc.h"
@@ -102,6 +103,9 @@ private:
     using InvokerFn = void(ServiceFrameworkBase* object, HandlerFnP<ServiceFrameworkBase> member,
                            HLERequestContext& ctx);
 
+    using HandlerMap = boost::container::flat_map<u32, FunctionInfoBase>;
+    using DirectHandlerTable = std::vector<const FunctionInfoBase*>;
+
     explicit ServiceFrameworkBase(Core::System& system_, const char* service_name_,
                                   u32 max_sessions_, InvokerFn* handler_invoker_);
     ~ServiceFrameworkBase() override;
@@ -110,6 +114,10 @@ private:
     void RegisterHandlersBaseTipc(const FunctionInfoBase* functions, std::size_t n);
     void ReportUnimplementedFunction(HLERequestContext& ctx, const FunctionInfoBase* info);
 
+    static void BuildDirectHandlerTable(DirectHandlerTable& table, const HandlerMap& map);
+    static const FunctionInfoBase* FindHandler(const DirectHandlerTable& table,
+                                               const HandlerMap& map, u32 command);
+
     /// Maximum number of concurrent sessions that this service can handle.
     u32 max_sessions;
 
@@ -119,8 +127,12 @@ private:
 
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
-    boost::container::flat_map<u32, FunctionInfoBase> handlers;
-    boost::container::flat_map<u32, FunctionInfoBase> handlers_tipc;
+    HandlerMap handlers;
+    HandlerMap handlers_tipc;
+
+    /// Handlers of low command ids indexed by id, so hot commands skip the map search
+    DirectHandlerTable direct_handlers;
+    DirectHandlerTable direct_handlers_tipc;
 
     /// Used to gain exclusive access to the service members, e.g. from CoreTiming thread.
     std::mutex lock_service;
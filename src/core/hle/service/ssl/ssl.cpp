@@ -1,9 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+#include <functional>
+#include <future>
+
 #include "common/string_util.h"
+#include "common/thread_worker.h"
 
 #include "core/core.h"
+#include "core/hle/kernel/k_event.h"
 #include "core/hle/result.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/server_manager.h"
@@ -59,13 +65,49 @@ struct SslContextSharedData {
     u32 connection_count = 0;
 };
 
+/**
+ * Runs the TLS work of blocking connections on host threads, so a slow server only stalls the
+ * requests of its own connection. Requests waiting for their work are deferred, and finished work
+ * signals the deferral event of the server, which makes it retry them.
+ */
+class SslWorker {
+public:
+    static constexpr size_t NumWorkers = 4;
+
+    explicit SslWorker(Kernel::KEvent* deferral_event_)
+        : deferral_event{deferral_event_}, workers{NumWorkers, "SSLWorker"} {}
+
+    ~SslWorker() {
+        // The server only closes the readable side, the event is owned by whoever asked for it
+        workers.WaitForRequests();
+        deferral_event->Close();
+    }
+
+    /// Queues work, the future is ready once it has finished and the deferral event was signaled
+    std::future<void> QueueWork(std::function<void()>&& work) {
+        std::packaged_task<void()> task{[this, work = std::move(work)] {
+            work();
+            deferral_event->Signal();
+        }};
+        std::future<void> future = task.get_future();
+        workers.QueueWork(std::move(task));
+        return future;
+    }
+
+private:
+    Kernel::KEvent* deferral_event;
+    Common::ThreadWorker workers;
+};
+
 class ISslConnection final : public ServiceFramework<ISslConnection> {
 public:
     explicit ISslConnection(Core::System& system_in, SslVersion ssl_version_in,
                             std::shared_ptr<SslContextSharedData>& shared_data_in,
+                            std::shared_ptr<SslWorker> worker_in,
                             std::unique_ptr<SSLConnectionBackend>&& backend_in)
         : ServiceFramework{system_in, "ISslConnection"}, ssl_version{ssl_version_in},
-          shared_data{shared_data_in}, backend{std::move(backend_in)} {
+          shared_data{shared_data_in}, worker{std::move(worker_in)},
+          backend{std::move(backend_in)} {
         // clang-format off
         static const FunctionInfo functions[] = {
             {0, &ISslConnection::SetSocketDescriptor, "SetSocketDescriptor"},
@@ -113,6 +155,10 @@ public:
     }
 
     ~ISslConnection() {
+        // The pending work uses the backend and the socket
+        if (async_work.valid()) {
+            async_work.wait();
+        }
         shared_data->connection_count--;
         if (fd_to_close.has_value()) {
             const s32 fd = *fd_to_close;
@@ -134,12 +180,45 @@ public:
 private:
     SslVersion ssl_version;
     std::shared_ptr<SslContextSharedData> shared_data;
+    std::shared_ptr<SslWorker> worker;
     std::unique_ptr<SSLConnectionBackend> backend;
     std::optional<int> fd_to_close;
     bool do_not_close_socket = false;
     bool get_server_cert_chain = false;
     std::shared_ptr<Network::SocketBase> socket;
     bool did_handshake = false;
+    bool non_blocking = false;
+
+    // State of the request whose work runs on the worker
+    std::future<void> async_work;
+    std::atomic_bool async_done{};
+    Result async_result{ResultSuccess};
+    std::vector<u8> async_buffer;
+    size_t async_size{};
+
+    /// Runs the work of a request, on the worker when it can block. Returns nothing when the
+    /// request has been deferred, the handler is called again for it once the work is done.
+    std::optional<Result> RunAsync(HLERequestContext& ctx, std::function<Result()>&& work) {
+        if (!async_work.valid()) {
+            if (non_blocking) {
+                return work();
+            }
+            async_done = false;
+            async_work = worker->QueueWork([this, work = std::move(work)] {
+                async_result = work();
+                async_done.store(true, std::memory_order_release);
+            });
+            ctx.SetIsDeferred();
+            return std::nullopt;
+        }
+        if (!async_done.load(std::memory_order_acquire)) {
+            // Another connection finished its work
+            ctx.SetIsDeferred();
+            return std::nullopt;
+        }
+        async_work.get();
+        return async_result;
+    }
 
     Result SetSocketDescriptorImpl(s32* out_fd, s32 fd) {
         LOG_DEBUG(Service_SSL, "called, fd={}", fd);
@@ -192,6 +271,7 @@ private:
         if (error != Network::Errno::SUCCESS) {
             LOG_ERROR(Service_SSL, "Failed to set native socket non-block flag to {}", non_block);
         }
+        non_blocking = non_block;
         return ResultSuccess;
     }
 
@@ -296,9 +376,12 @@ private:
     }
 
     void DoHandshake(HLERequestContext& ctx) {
-        const Result res = DoHandshakeImpl();
+        const auto res = RunAsync(ctx, [this] { return DoHandshakeImpl(); });
+        if (!res) {
+            return;
+        }
         IPC::ResponseBuilder rb{ctx, 2};
-        rb.Push(res);
+        rb.Push(*res);
     }
 
     void DoHandshakeGetServerCert(HLERequestContext& ctx) {
@@ -308,7 +391,11 @@ private:
         };
         static_assert(sizeof(OutputParameters) == 0x8);
 
-        Result res = DoHandshakeImpl();
+        const auto handshake_res = RunAsync(ctx, [this] { return DoHandshakeImpl(); });
+        if (!handshake_res) {
+            return;
+        }
+        Result res = *handshake_res;
         OutputParameters out{};
         if (res == ResultSuccess) {
             std::vector<std::vector<u8>> certs;
@@ -326,24 +413,40 @@ private:
     }
 
     void Read(HLERequestContext& ctx) {
-        std::vector<u8> output_bytes(ctx.GetWriteBufferSize());
-        const Result res = ReadImpl(&output_bytes);
+        // The request context may only be used on the service thread
+        const auto res = RunAsync(ctx, [this, size = ctx.GetWriteBufferSize()] {
+            async_buffer.resize(size);
+            return ReadImpl(&async_buffer);
+        });
+        if (!res) {
+            return;
+        }
         IPC::ResponseBuilder rb{ctx, 3};
-        rb.Push(res);
-        if (res == ResultSuccess) {
-            rb.Push(static_cast<u32>(output_bytes.size()));
-            ctx.WriteBuffer(output_bytes);
+        rb.Push(*res);
+        if (*res == ResultSuccess) {
+            rb.Push(static_cast<u32>(async_buffer.size()));
+            ctx.WriteBuffer(async_buffer);
         } else {
             rb.Push(static_cast<u32>(0));
         }
     }
 
     void Write(HLERequestContext& ctx) {
-        size_t write_size{0};
-        const Result res = WriteImpl(&write_size, ctx.ReadBuffer());
+        // The data is only copied when the work is queued, retries answer from the result
+        std::vector<u8> data;
+        if (!async_work.valid()) {
+            data = ctx.ReadBufferCopy();
+        }
+        const auto res = RunAsync(ctx, [this, data = std::move(data)] {
+            async_size = 0;
+            return WriteImpl(&async_size, data);
+        });
+        if (!res) {
+            return;
+        }
         IPC::ResponseBuilder rb{ctx, 3};
-        rb.Push(res);
-        rb.Push(static_cast<u32>(write_size));
+        rb.Push(*res);
+        rb.Push(static_cast<u32>(async_size));
     }
 
     void Pending(HLERequestContext& ctx) {
@@ -391,9 +494,10 @@ private:
 
 class ISslContext final : public ServiceFramework<ISslContext> {
 public:
-    explicit ISslContext(Core::System& system_, SslVersion version)
+    explicit ISslContext(Core::System& system_, SslVersion version,
+                         std::shared_ptr<SslWorker> worker_)
         : ServiceFramework{system_, "ISslContext"}, ssl_version{version},
-          shared_data{std::make_shared<SslContextSharedData>()} {
+          shared_data{std::make_shared<SslContextSharedData>()}, worker{std::move(worker_)} {
         static const FunctionInfo functions[] = {
             {0, &ISslContext::SetOption, "SetOption"},
             {1, nullptr, "GetOption"},
@@ -416,6 +520,7 @@ public:
 private:
     SslVersion ssl_version;
     std::shared_ptr<SslContextSharedData> shared_data;
+    std::shared_ptr<SslWorker> worker;
 
     void SetOption(HLERequestContext& ctx) {
         struct Parameters {
@@ -443,7 +548,7 @@ private:
         IPC::ResponseBuilder rb{ctx, 2, 0, 1};
         rb.Push(res);
         if (res == ResultSuccess) {
-            rb.PushIpcInterface<ISslConnection>(system, ssl_version, shared_data,
+            rb.PushIpcInterface<ISslConnection>(system, ssl_version, shared_data, worker,
                                                 std::move(backend));
         }
     }
@@ -492,7 +597,8 @@ private:
 
 class ISslService final : public ServiceFramework<ISslService> {
 public:
-    explicit ISslService(Core::System& system_) : ServiceFramework{system_, "ssl"} {
+    explicit ISslService(Core::System& system_, std::shared_ptr<SslWorker> worker_)
+        : ServiceFramework{system_, "ssl"}, worker{std::move(worker_)} {
         // clang-format off
         static const FunctionInfo functions[] = {
             {0, &ISslService::CreateContext, "CreateContext"},
@@ -512,6 +618,8 @@ public:
     }
 
 private:
+    std::shared_ptr<SslWorker> worker;
+
     void CreateContext(HLERequestContext& ctx) {
         struct Parameters {
             SslVersion ssl_version;
@@ -528,7 +636,7 @@ private:
 
         IPC::ResponseBuilder rb{ctx, 2, 0, 1};
         rb.Push(ResultSuccess);
-        rb.PushIpcInterface<ISslContext>(system, parameters.ssl_version);
+        rb.PushIpcInterface<ISslContext>(system, parameters.ssl_version, worker);
     }
 
     void SetInterfaceVersion(HLERequestContext& ctx) {
@@ -545,7 +653,14 @@ private:
 void LoopProcess(Core::System& system) {
     auto server_manager = std::make_unique<ServerManager>(system);
 
-    server_manager->RegisterNamedService("ssl", std::make_shared<ISslService>(system));
+    // Deferred requests are retried on the one thread serving them, so the worker cannot signal
+    // the deferral event between a request being deferred and it being queued for a retry.
+    Kernel::KEvent* deferral_event{};
+    server_manager->ManageDeferral(&deferral_event);
+    auto worker = std::make_shared<SslWorker>(deferral_event);
+
+    server_manager->RegisterNamedService("ssl",
+                                         std::make_shared<ISslService>(system, std::move(worker)));
     ServerManager::RunServer(std::move(server_manager));
 }
 
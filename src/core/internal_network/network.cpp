@@ -2,8 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <limits>
+#include <optional>
+#include <span>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,6 +25,9 @@
 #include <poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 #else
 #error "Unimplemented platform"
 #endif
@@ -530,6 +537,144 @@ PollEvents TranslatePollRevents(short revents) {
     return result;
 }
 
+/// Incremented whenever a host socket is closed, its descriptor may be reused after that
+std::atomic<u64> socket_close_generation{};
+
+void NotifySocketClosed() {
+    socket_close_generation.fetch_add(1, std::memory_order_release);
+}
+
+#ifdef __linux__
+
+/**
+ * epoll instance of a thread that keeps the sockets it polled last registered.
+ *
+ * Guests usually poll the same sockets over and over, so registrations are only changed for the
+ * sockets whose events differ from the previous call, and waiting is a single epoll_wait that
+ * reports the ready sockets instead of building and scanning an array of every socket.
+ * The set is rebuilt after any socket has been closed, as its descriptor may have been reused.
+ */
+class EpollSet {
+public:
+    EpollSet() = default;
+
+    ~EpollSet() {
+        if (epoll_fd >= 0) {
+            close(epoll_fd);
+        }
+    }
+
+    EpollSet(const EpollSet&) = delete;
+    EpollSet& operator=(const EpollSet&) = delete;
+
+    /// Polls the sockets, returns nothing when they have to be polled with poll instead
+    std::optional<std::pair<s32, Errno>> Poll(std::vector<PollFD>& pollfds, s32 timeout) {
+        const u64 generation = socket_close_generation.load(std::memory_order_acquire);
+        if (epoll_fd < 0 || generation != close_generation) {
+            if (!Reset()) {
+                return std::nullopt;
+            }
+            close_generation = generation;
+        }
+
+        ++poll_id;
+        for (size_t i = 0; i < pollfds.size(); ++i) {
+            const int fd = pollfds[i].socket->GetFD();
+            if (fd < 0) {
+                return std::nullopt;
+            }
+            // Poll and epoll share their event bits, but epoll always reports invalid sockets
+            const u32 events =
+                static_cast<u16>(TranslatePollEvents(pollfds[i].events)) & ~u32{POLLNVAL};
+            const auto [it, inserted] = entries.try_emplace(fd);
+            Entry& entry = it->second;
+            if (!inserted && entry.poll_id == poll_id) {
+                // The same descriptor is polled twice, epoll can only register it once
+                return std::nullopt;
+            }
+            if ((inserted || entry.events != events) && !Register(fd, events, !inserted)) {
+                entries.erase(it);
+                return std::nullopt;
+            }
+            entry = {events, poll_id, i};
+            pollfds[i].revents = {};
+        }
+
+        if (entries.size() != pollfds.size()) {
+            std::erase_if(entries, [this](const auto& pair) {
+                if (pair.second.poll_id == poll_id) {
+                    return false;
+                }
+                epoll_ctl(epoll_fd, EPOLL_CTL_DEL, pair.first, nullptr);
+                return true;
+            });
+        }
+
+        ready_events.resize(pollfds.size() + 1);
+        const int result = epoll_wait(epoll_fd, ready_events.data(),
+                                      static_cast<int>(ready_events.size()), timeout);
+        if (result < 0) {
+            return std::pair{-1, GetAndLogLastError()};
+        }
+        for (const epoll_event& event : std::span{ready_events}.first(result)) {
+            const auto it = entries.find(event.data.fd);
+            if (it != entries.end()) {
+                pollfds[it->second.index].revents =
+                    TranslatePollRevents(static_cast<short>(event.events));
+            }
+        }
+        // Like poll, the interrupt socket counts as one of the ready sockets
+        return std::pair{result, Errno::SUCCESS};
+    }
+
+private:
+    struct Entry {
+        u32 events;
+        u64 poll_id;
+        size_t index;
+    };
+
+    bool Reset() {
+        if (epoll_fd >= 0) {
+            close(epoll_fd);
+        }
+        entries.clear();
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            LOG_ERROR(Network, "epoll_create1 failed, falling back to poll: {}",
+                      Common::NativeErrorToString(errno));
+            return false;
+        }
+        if (!Register(GetInterruptSocket(), EPOLLIN, false)) {
+            close(epoll_fd);
+            epoll_fd = -1;
+            return false;
+        }
+        return true;
+    }
+
+    bool Register(int fd, u32 events, bool registered) {
+        epoll_event event{.events = events, .data{.fd = fd}};
+        if (epoll_ctl(epoll_fd, registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) == 0) {
+            return true;
+        }
+        // The kernel drops the descriptors of closed sockets by itself
+        if (errno == (registered ? ENOENT : EEXIST)) {
+            return epoll_ctl(epoll_fd, registered ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event) ==
+                   0;
+        }
+        return false;
+    }
+
+    int epoll_fd = -1;
+    u64 close_generation{};
+    u64 poll_id{};
+    std::unordered_map<int, Entry> entries;
+    std::vector<epoll_event> ready_events;
+};
+
+#endif
+
 } // Anonymous namespace
 
 NetworkInstance::NetworkInstance() {
@@ -607,6 +752,13 @@ Common::Expected<std::vector<AddrInfo>, GetAddrInfoError> GetAddressInfo(
 }
 
 std::pair<s32, Errno> Poll(std::vector<PollFD>& pollfds, s32 timeout) {
+#ifdef __linux__
+    thread_local EpollSet epoll_set;
+    if (const auto result = epoll_set.Poll(pollfds, timeout)) {
+        return *result;
+    }
+#endif
+
     const size_t num = pollfds.size();
 
     std::vector<WSAPOLLFD> host_pollfds(pollfds.size());
@@ -651,6 +803,7 @@ Socket::~Socket() {
     }
     (void)closesocket(fd);
     fd = INVALID_SOCKET;
+    NotifySocketClosed();
 }
 
 Socket::Socket(Socket&& rhs) noexcept {
@@ -870,6 +1023,7 @@ Errno Socket::Close() {
     [[maybe_unused]] const int result = closesocket(fd);
     ASSERT(result == 0);
     fd = INVALID_SOCKET;
+    NotifySocketClosed();
 
     return Errno::SUCCESS;
 }
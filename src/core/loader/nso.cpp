@@ -1,17 +1,25 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cstring>
+#include <mutex>
+#include <span>
 #include <vector>
 
+#include "common/boot_timeline.h"
 #include "common/common_funcs.h"
 #include "common/hex_util.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
+#include "common/memory_accounting.h"
 #include "common/settings.h"
 #include "common/swap.h"
 #include "core/core.h"
+#include "core/file_sys/fssystem/fssystem_parallel_decompressor.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/hle/kernel/code_set.h"
 #include "core/hle/kernel/k_page_table.h"
@@ -37,20 +45,86 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
-
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
-
-    return uncompressed_data;
+Result DecompressSegment(void* dst, size_t dst_size, const void* src, size_t src_size) {
+    const int size = Common::Compression::DecompressDataLZ4(dst, dst_size, src, src_size);
+    R_UNLESS(size >= 0 && static_cast<size_t>(size) == dst_size, ResultUnknown);
+    R_SUCCEED();
 }
 
 constexpr u32 PageAlignSize(u32 size) {
     return static_cast<u32>((size + Core::Memory::YUZU_PAGEMASK) & ~Core::Memory::YUZU_PAGEMASK);
 }
+
+using namespace Common::Literals;
+
+/// Most memory held by the decompressed segments of recently loaded modules
+constexpr size_t MAX_CACHED_SEGMENTS_SIZE = 256_MiB;
+
+/**
+ * Decompressed segments of the modules loaded recently, copied instead of read and decompressed
+ * again when a title is launched twice in a session or its code layout is computed before it is
+ * loaded. Modules are identified by their whole header, which holds the SHA-256 hashes of the
+ * decompressed segments, so the modules of another title or update never match.
+ */
+class SegmentCache {
+public:
+    bool Find(const NSOHeader& header, std::span<u8> output) {
+        std::scoped_lock lk{mutex};
+        const auto it = std::ranges::find_if(entries, [&](const Entry& entry) {
+            return std::memcmp(&entry.header, &header, sizeof(NSOHeader)) == 0;
+        });
+        if (it == entries.end() || it->data.size() != output.size()) {
+            return false;
+        }
+        std::memcpy(output.data(), it->data.data(), output.size());
+        // Keep the most recently used modules at the back, the front is evicted first
+        std::rotate(it, it + 1, entries.end());
+        return true;
+    }
+
+    void Insert(const NSOHeader& header, std::span<const u8> data) {
+        using Common::MemoryAccounting::GetExcess;
+        if (!HasSegmentHashes(header) || data.size() > MAX_CACHED_SEGMENTS_SIZE ||
+            GetExcess() != 0) {
+            return;
+        }
+        std::scoped_lock lk{mutex};
+        while (total_size + data.size() > MAX_CACHED_SEGMENTS_SIZE) {
+            total_size -= entries.front().data.size();
+            charge.Add(-static_cast<s64>(entries.front().data.size()));
+            entries.erase(entries.begin());
+        }
+        entries.push_back(Entry{
+            .header = header,
+            .data = std::vector<u8>(data.begin(), data.end()),
+        });
+        total_size += data.size();
+        charge.Add(static_cast<s64>(data.size()));
+    }
+
+private:
+    struct Entry {
+        NSOHeader header;
+        std::vector<u8> data;
+    };
+
+    /// Homebrew may leave the hashes empty, its modules can't be told apart from their header
+    static bool HasSegmentHashes(const NSOHeader& header) {
+        return std::ranges::all_of(header.segment_hashes, [](const NSOHeader::SHA256Hash& hash) {
+            return std::ranges::any_of(hash, [](u8 byte) { return byte != 0; });
+        });
+    }
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    size_t total_size = 0;
+    Common::MemoryAccounting::Charge charge{Common::MemoryAccounting::Category::FileSystemCache};
+};
+
+SegmentCache& GetSegmentCache() {
+    static SegmentCache cache;
+    return cache;
+}
 } // Anonymous namespace
 
 bool NSOHeader::IsSegmentCompressed(size_t segment_num) const {
@@ -79,6 +153,8 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
                                                std::optional<FileSys::PatchManager> pm,
                                                std::vector<Core::NCE::Patcher>* patches,
                                                s32 patch_index) {
+    const Common::BootTimeline::ScopedStage boot_stage{"nso_load"};
+
     if (nso_file.GetSize() < sizeof(NSOHeader)) {
         return std::nullopt;
     }
@@ -105,43 +181,85 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         return 0;
     }();
 
-    // Build program image
+    // Lay out the program image, the segments are only read once we know they are needed
     Kernel::CodeSet codeset;
-    Kernel::PhysicalMemory program_image;
+    std::array<size_t, 3> segment_sizes{};
+    size_t image_end = module_start;
+    size_t segments_max_end = module_start;
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
-                                                  nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
-        }
-        program_image.resize(module_start + nso_header.segments[i].location +
-                             static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + module_start + nso_header.segments[i].location,
-                    data.data(), data.size());
+        segment_sizes[i] = nso_header.IsSegmentCompressed(i)
+                               ? nso_header.segments[i].size
+                               : nso_header.segments_compressed_size[i];
+        image_end = module_start + nso_header.segments[i].location + segment_sizes[i];
+        segments_max_end = std::max(segments_max_end, image_end);
         codeset.segments[i].addr = module_start + nso_header.segments[i].location;
         codeset.segments[i].offset = module_start + nso_header.segments[i].location;
         codeset.segments[i].size = nso_header.segments[i].size;
     }
 
-    if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
-        const auto arg_data{Settings::values.program_args.GetValue()};
-
+    const bool pass_arguments =
+        should_pass_arguments && !Settings::values.program_args.GetValue().empty();
+    const size_t arguments_offset = image_end;
+    if (pass_arguments) {
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
-        NSOArgumentHeader args_header{
-            NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
-        std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
-        std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
-                    arg_data.size());
+        image_end += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
     }
 
     codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
+    u32 image_size{PageAlignSize(static_cast<u32>(image_end) + nso_header.segments[2].bss_size)};
+
+    // Computing the layout only needs the contents when the code has to be patched.
+#ifdef HAS_NCE
+    const bool needs_contents = load_into_process || patches != nullptr;
+#else
+    const bool needs_contents = load_into_process;
+#endif
+    if (!needs_contents) {
+        return load_base + image_size;
+    }
+
+    // Build program image, decompressing the segments straight into it
+    Kernel::PhysicalMemory program_image(std::max<size_t>(image_size, segments_max_end));
+    const std::span<u8> segments_data(program_image.data() + module_start,
+                                      segments_max_end - module_start);
+    if (!GetSegmentCache().Find(nso_header, segments_data)) {
+        std::array<std::vector<u8>, 3> compressed_segments;
+        std::array<FileSys::ParallelDecompressor::Job, 3> jobs;
+        size_t job_count = 0;
+        for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+            u8* const segment_data = program_image.data() + codeset.segments[i].offset;
+            if (!nso_header.IsSegmentCompressed(i)) {
+                nso_file.Read(segment_data, segment_sizes[i], nso_header.segments[i].offset);
+                continue;
+            }
+            compressed_segments[i] = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
+                                                        nso_header.segments[i].offset);
+            jobs[job_count++] = {
+                .dst = segment_data,
+                .dst_size = segment_sizes[i],
+                .src = compressed_segments[i].data(),
+                .src_size = compressed_segments[i].size(),
+                .decompressor = DecompressSegment,
+            };
+        }
+        if (R_FAILED(FileSys::ParallelDecompressor::Run(std::span(jobs.data(), job_count)))) {
+            LOG_ERROR(Loader, "Failed to decompress the segments of {}", nso_file.GetName());
+            return std::nullopt;
+        }
+        GetSegmentCache().Insert(nso_header, segments_data);
+    }
     program_image.resize(image_size);
 
+    if (pass_arguments) {
+        const auto arg_data{Settings::values.program_args.GetValue()};
+        NSOArgumentHeader args_header{
+            NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
+        std::memcpy(program_image.data() + arguments_offset, &args_header,
+                    sizeof(NSOArgumentHeader));
+        std::memcpy(program_image.data() + arguments_offset + sizeof(NSOArgumentHeader),
+                    arg_data.data(), arg_data.size());
+    }
+
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
     }
@@ -167,7 +285,7 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     auto* patch = patches ? &patches->operator[](patch_index) : nullptr;
     if (patch && !load_into_process) {
         // Patch SVCs and MRS calls in the guest code
-        while (!patch->PatchText(program_image, code)) {
+        while (!patch->PatchText(program_image, code, nso_header.build_id)) {
             patch = &patches->emplace_back();
         }
     } else if (patch) {
@@ -6,10 +6,12 @@
 #include <cstring>
 #include <mutex>
 #include <span>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/atomic_ops.h"
 #include "common/common_types.h"
+#include "common/div_ceil.h"
 #include "common/heap_tracker.h"
 #include "common/logging/log.h"
 #include "common/page_table.h"
@@ -62,6 +64,14 @@ struct Memory::Impl {
 #else
         buffer = std::addressof(system.DeviceMemory().buffer);
 #endif
+
+        if (std::addressof(process) == system.ApplicationProcess() && Settings::IsNceEnabled()) {
+            // Guest addresses are host addresses, resolve writes as the access fault handler does
+            system.DeviceMemory().buffer.EnableWriteTracking([&system = system](u8* page) {
+                return system.ApplicationMemory().InvalidateNCE(reinterpret_cast<u64>(page),
+                                                                YUZU_PAGESIZE);
+            });
+        }
     }
 
     void MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
@@ -75,8 +85,14 @@ struct Memory::Impl {
                  Common::PageType::Memory);
 
         if (current_page_table->fastmem_arena) {
-            buffer->Map(GetInteger(base), GetInteger(target) - DramMemoryMap::Base, size, perms,
-                        separate_heap);
+            PushHostMapping({
+                .type = HostMapping::Type::Map,
+                .base = GetInteger(base),
+                .size = size,
+                .host_offset = GetInteger(target) - DramMemoryMap::Base,
+                .perms = perms,
+                .separate_heap = separate_heap,
+            });
         }
     }
 
@@ -88,7 +104,14 @@ struct Memory::Impl {
                  Common::PageType::Unmapped);
 
         if (current_page_table->fastmem_arena) {
-            buffer->Unmap(GetInteger(base), size, separate_heap);
+            PushHostMapping({
+                .type = HostMapping::Type::Unmap,
+                .base = GetInteger(base),
+                .size = size,
+                .host_offset = 0,
+                .perms = {},
+                .separate_heap = separate_heap,
+            });
         }
     }
 
@@ -101,6 +124,83 @@ struct Memory::Impl {
             return;
         }
 
+        PushHostMapping({
+            .type = HostMapping::Type::Protect,
+            .base = vaddr,
+            .size = size,
+            .host_offset = 0,
+            .perms = perms,
+            .separate_heap = false,
+        });
+    }
+
+    void BeginHostMappingBatch() {
+        ++host_mapping_batch_depth;
+    }
+
+    void EndHostMappingBatch() {
+        ASSERT(host_mapping_batch_depth > 0);
+        if (--host_mapping_batch_depth != 0) {
+            return;
+        }
+        for (const HostMapping& mapping : pending_host_mappings) {
+            RunHostMapping(mapping);
+        }
+        pending_host_mappings.clear();
+    }
+
+    struct HostMapping {
+        enum class Type {
+            Map,
+            Unmap,
+            Protect,
+        };
+
+        Type type;
+        u64 base;
+        u64 size;
+        u64 host_offset;
+        Common::MemoryPermission perms;
+        bool separate_heap;
+
+        /// Returns true when the operation continues this one and both can be done at once.
+        bool CanCoalesce(const HostMapping& next) const {
+            return type == next.type && base + size == next.base && perms == next.perms &&
+                   separate_heap == next.separate_heap &&
+                   (type != Type::Map || host_offset + size == next.host_offset);
+        }
+    };
+
+    void PushHostMapping(const HostMapping& mapping) {
+        if (host_mapping_batch_depth == 0) {
+            RunHostMapping(mapping);
+            return;
+        }
+        // Operations are run in order, only merge with the most recent one
+        if (!pending_host_mappings.empty() && pending_host_mappings.back().CanCoalesce(mapping)) {
+            pending_host_mappings.back().size += mapping.size;
+            return;
+        }
+        pending_host_mappings.push_back(mapping);
+    }
+
+    void RunHostMapping(const HostMapping& mapping) {
+        switch (mapping.type) {
+        case HostMapping::Type::Map:
+            buffer->Map(mapping.base, mapping.host_offset, mapping.size, mapping.perms,
+                        mapping.separate_heap);
+            break;
+        case HostMapping::Type::Unmap:
+            buffer->Unmap(mapping.base, mapping.size, mapping.separate_heap);
+            break;
+        case HostMapping::Type::Protect:
+            // Rasterizer cached pages are checked now, they may have changed while deferred
+            ProtectHostRegion(mapping.base, mapping.size, mapping.perms);
+            break;
+        }
+    }
+
+    void ProtectHostRegion(VAddr vaddr, u64 size, Common::MemoryPermission perms) {
         u64 protect_bytes{};
         u64 protect_begin{};
         for (u64 addr = vaddr; addr < vaddr + size; addr += YUZU_PAGESIZE) {
@@ -258,12 +358,22 @@ struct Memory::Impl {
         }
 
         while (remaining_size) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(YUZU_PAGESIZE) - page_offset, remaining_size);
+            std::size_t num_pages = 1;
             const auto current_vaddr =
                 static_cast<u64>((page_index << YUZU_PAGEBITS) + page_offset);
 
             const auto [pointer, type] = page_table.pointers[page_index].PointerType();
+            if (type == Common::PageType::Memory || type == Common::PageType::Unmapped) {
+                // Walk runs of contiguous host memory (or unmapped pages) at once
+                const std::size_t max_pages =
+                    1 + Common::DivCeil(remaining_size - copy_amount,
+                                        static_cast<std::size_t>(YUZU_PAGESIZE));
+                num_pages = page_table.ContiguousPages(page_index, max_pages);
+                copy_amount = std::min(copy_amount + ((num_pages - 1) << YUZU_PAGEBITS),
+                                       remaining_size);
+            }
             switch (type) {
             case Common::PageType::Unmapped: {
                 user_accessible = false;
@@ -290,7 +400,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += num_pages;
             page_offset = 0;
             increment(copy_amount);
             remaining_size -= copy_amount;
@@ -352,6 +462,22 @@ struct Memory::Impl {
         return nullptr;
     }
 
+    u8* GetContiguousHostPointer(const Common::ProcessAddress vaddr, const std::size_t size) {
+        const auto& page_table = *current_page_table;
+        if (size == 0 || !AddressSpaceContains(page_table, vaddr, size)) {
+            return nullptr;
+        }
+        const std::size_t page_index = GetInteger(vaddr) >> YUZU_PAGEBITS;
+        const std::size_t num_pages =
+            ((GetInteger(vaddr) + size - 1) >> YUZU_PAGEBITS) - page_index + 1;
+        const auto [pointer, type] = page_table.pointers[page_index].PointerType();
+        if (type != Common::PageType::Memory ||
+            page_table.ContiguousPages(page_index, num_pages) != num_pages) {
+            return nullptr;
+        }
+        return reinterpret_cast<u8*>(pointer + GetInteger(vaddr));
+    }
+
     template <bool UNSAFE>
     bool WriteBlockImpl(const Common::ProcessAddress dest_addr, const void* src_buffer,
                         const std::size_t size) {
@@ -552,13 +678,16 @@ struct Memory::Impl {
 
         if (current_page_table->fastmem_arena) {
             Common::MemoryPermission perm{};
-            if (!Settings::values.use_reactive_flushing.GetValue() || !cached) {
+            if (!Settings::GetHotSettings().use_reactive_flushing || !cached) {
                 perm |= Common::MemoryPermission::Read;
             }
             if (!cached) {
                 perm |= Common::MemoryPermission::Write;
             }
-            buffer->Protect(vaddr, size, perm);
+            // Prefer tracking writes without signals when only writes have to be caught
+            if (perm != Common::MemoryPermission::Read || !buffer->WriteProtect(vaddr, size)) {
+                buffer->Protect(vaddr, size, perm);
+            }
         }
 
         // Iterate over a contiguous CPU address space, which corresponds to the specified GPU
@@ -888,6 +1017,9 @@ struct Memory::Impl {
     std::span<Core::GPUDirtyMemoryManager> gpu_dirty_managers;
     std::mutex sys_core_guard;
 
+    u32 host_mapping_batch_depth{};
+    std::vector<HostMapping> pending_host_mappings;
+
     std::optional<Common::HeapTracker> heap_tracker;
 #ifdef __linux__
     Common::HeapTracker* buffer{};
@@ -926,6 +1058,14 @@ void Memory::ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress
     impl->ProtectRegion(page_table, GetInteger(vaddr), size, perms);
 }
 
+void Memory::BeginHostMappingBatch() {
+    impl->BeginHostMappingBatch();
+}
+
+void Memory::EndHostMappingBatch() {
+    impl->EndHostMappingBatch();
+}
+
 bool Memory::IsValidVirtualAddress(const Common::ProcessAddress vaddr) const {
     const auto& page_table = *impl->current_page_table;
     const size_t page = vaddr >> YUZU_PAGEBITS;
@@ -1036,6 +1176,10 @@ u8* Memory::GetSpan(const VAddr src_addr, const std::size_t size) {
     return impl->GetSpan(src_addr, size);
 }
 
+u8* Memory::GetContiguousHostPointer(const Common::ProcessAddress vaddr, const std::size_t size) {
+    return impl->GetContiguousHostPointer(vaddr, size);
+}
+
 bool Memory::WriteBlock(const Common::ProcessAddress dest_addr, const void* src_buffer,
                         const std::size_t size) {
     return impl->WriteBlock(dest_addr, src_buffer, size);
@@ -111,6 +111,16 @@ public:
     void ProtectRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                        Common::MemoryPermission perms);
 
+    /**
+     * Defers the host side of MapMemoryRegion, UnmapRegion and ProtectRegion until the matching
+     * EndHostMappingBatch call, merging contiguous operations of the same kind. Page table
+     * entries are still updated immediately. Batches may be nested.
+     */
+    void BeginHostMappingBatch();
+
+    /// Performs the host mapping operations deferred by the outermost batch.
+    void EndHostMappingBatch();
+
     /**
      * Checks whether or not the supplied address is a valid virtual
      * address for the current process.
@@ -369,6 +379,18 @@ public:
     const u8* GetSpan(const VAddr src_addr, const std::size_t size) const;
     u8* GetSpan(const VAddr src_addr, const std::size_t size);
 
+    /**
+     * Gets a pointer to a range of the current process' address space when it is backed by
+     * contiguous host memory, without any rasterizer cached or debug pages in between.
+     * Writes through this pointer need no further notification.
+     *
+     * @param vaddr The virtual address of the range.
+     * @param size  The size of the range, in bytes.
+     *
+     * @returns The pointer to the range, or nullptr when it is not contiguous host memory.
+     */
+    u8* GetContiguousHostPointer(Common::ProcessAddress vaddr, std::size_t size);
+
     /**
      * Writes a range of bytes into the current process' address space at the specified
      * virtual address.
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <cstring>
 #include <locale>
 #include "common/hex_util.h"
 #include "common/microprofile.h"
@@ -51,7 +53,18 @@ void StandardVmCallbacks::MemoryRead(VAddr address, void* data, u64 size) {
 }
 
 void StandardVmCallbacks::MemoryWrite(VAddr address, const void* data, u64 size) {
-    system.ApplicationMemory().WriteBlock(SanitizeAddress(address), data, size);
+    auto& memory = system.ApplicationMemory();
+    const VAddr sanitized_address = SanitizeAddress(address);
+    std::array<u8, sizeof(u64)> current_value;
+    if (sanitized_address != 0 && size <= current_value.size()) {
+        // Cheats store the same values on every run, writing them again would invalidate the
+        // pages cached by the GPU
+        memory.ReadBlock(sanitized_address, current_value.data(), size);
+        if (std::memcmp(current_value.data(), data, size) == 0) {
+            return;
+        }
+    }
+    memory.WriteBlock(sanitized_address, data, size);
 }
 
 u64 StandardVmCallbacks::HidKeysDown() {
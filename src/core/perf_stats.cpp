@@ -3,13 +3,16 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iterator>
 #include <mutex>
 #include <numeric>
 #include <sstream>
 #include <thread>
+#include <utility>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
+#include "common/boot_timeline.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -25,8 +28,43 @@ using std::chrono::microseconds;
 // booting that we shouldn't account for
 constexpr std::size_t IgnoreFrames = 5;
 
+// A game frame is a stutter when it takes this many times the average frame time, and at least
+// StutterMinExcessMs longer than it
+constexpr double StutterRatio = 2.0;
+constexpr double StutterMinExcessMs = 8.0;
+// Weight of each frame in the moving average of frame times
+constexpr double AverageFrameWeight = 0.05;
+
 namespace Core {
 
+void FrameTimeHistogram::Add(double frame_time_ms) {
+    const auto bucket = static_cast<std::size_t>(std::max(frame_time_ms, 0.0) / BucketWidth);
+    buckets[std::min(bucket, NumBuckets - 1)]++;
+    count++;
+    max = std::max(max, frame_time_ms);
+}
+
+void FrameTimeHistogram::Reset() {
+    buckets.fill(0);
+    count = 0;
+    max = 0.0;
+}
+
+double FrameTimeHistogram::GetPercentile(double fraction) const {
+    if (count == 0) {
+        return 0.0;
+    }
+    const auto target = static_cast<u32>(std::ceil(fraction * static_cast<double>(count)));
+    u32 seen = 0;
+    for (std::size_t bucket = 0; bucket < NumBuckets; bucket++) {
+        seen += buckets[bucket];
+        if (seen >= std::max(target, 1U)) {
+            return std::min(static_cast<double>(bucket + 1) * BucketWidth, max);
+        }
+    }
+    return max;
+}
+
 PerfStats::PerfStats(u64 title_id_) : title_id(title_id_) {}
 
 PerfStats::~PerfStats() {
@@ -49,6 +87,32 @@ PerfStats::~PerfStats() {
                                 Common::FS::FileType::TextFile);
         void(file.WriteString(stream.str()));
     }
+
+    // Summary of the session, for comparing runs in regression tests
+    const auto& frame_times = session_frame_times;
+    const auto summary = fmt::format(
+        "{{\n"
+        "  \"title_id\": \"{:016X}\",\n"
+        "  \"game_frames\": {},\n"
+        "  \"game_frametime_ms\": {{\"p50\": {:.2f}, \"p95\": {:.2f}, \"p99\": {:.2f}, "
+        "\"max\": {:.2f}}},\n"
+        "  \"stutters\": {{\"shader_build\": {}, \"file_system\": {}, \"unknown\": {}}}\n"
+        "}}\n",
+        title_id, frame_times.GetCount(), frame_times.GetPercentile(0.50),
+        frame_times.GetPercentile(0.95), frame_times.GetPercentile(0.99), frame_times.GetMax(),
+        session_stutters[static_cast<std::size_t>(StutterCause::ShaderBuild)],
+        session_stutters[static_cast<std::size_t>(StutterCause::FileSystem)],
+        session_stutters[static_cast<std::size_t>(StutterCause::Unknown)]);
+    auto summary_path = filepath;
+    summary_path.replace_extension(".json");
+    Common::FS::IOFile summary_file(summary_path, Common::FS::FileAccessMode::Write,
+                                    Common::FS::FileType::TextFile);
+    void(summary_file.WriteString(summary));
+}
+
+void PerfStats::SetFrameCallback(FrameCallback callback) {
+    std::scoped_lock lock{object_mutex};
+    frame_callback = std::move(callback);
 }
 
 void PerfStats::BeginSystemFrame() {
@@ -62,6 +126,10 @@ void PerfStats::EndSystemFrame() {
 
     auto frame_end = Clock::now();
     const auto frame_time = frame_end - frame_begin;
+    if (current_index == 0) {
+        // The first frame of the title is presented, booting it is over
+        Common::BootTimeline::Report();
+    }
     if (current_index < perf_history.size()) {
         perf_history[current_index++] =
             std::chrono::duration<double, std::milli>(frame_time).count();
@@ -71,10 +139,90 @@ void PerfStats::EndSystemFrame() {
 
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
+
+    if (frame_callback) {
+        frame_callback(frame_time);
+    }
 }
 
 void PerfStats::EndGameFrame() {
     game_frames.fetch_add(1, std::memory_order_relaxed);
+    const u32 shader_builds = frame_shader_builds.exchange(0, std::memory_order_relaxed);
+    const auto fs_wait =
+        std::chrono::nanoseconds{frame_fs_wait_ns.exchange(0, std::memory_order_relaxed)};
+
+    std::scoped_lock lock{object_mutex};
+
+    const auto now = Clock::now();
+    const auto previous_end = std::exchange(previous_game_frame_end, now);
+    if (previous_end == Clock::time_point{}) {
+        return;
+    }
+    const double frame_ms = std::chrono::duration<double, std::milli>(now - previous_end).count();
+    interval_frame_times.Add(frame_ms);
+    session_frame_times.Add(frame_ms);
+
+    if (session_frame_times.GetCount() <= IgnoreFrames) {
+        average_game_frame_ms = frame_ms;
+        return;
+    }
+
+    const double excess_ms = frame_ms - average_game_frame_ms;
+    if (frame_ms < average_game_frame_ms * StutterRatio || excess_ms < StutterMinExcessMs) {
+        // Stutters stay out of the average, so a burst of them is still measured against the
+        // frames around them.
+        average_game_frame_ms += (frame_ms - average_game_frame_ms) * AverageFrameWeight;
+        return;
+    }
+
+    const double fs_wait_ms = std::chrono::duration<double, std::milli>(fs_wait).count();
+    const StutterCause cause = shader_builds != 0          ? StutterCause::ShaderBuild
+                               : fs_wait_ms >= excess_ms / 2 ? StutterCause::FileSystem
+                                                             : StutterCause::Unknown;
+    interval_stutters[static_cast<std::size_t>(cause)]++;
+    session_stutters[static_cast<std::size_t>(cause)]++;
+}
+
+void PerfStats::AddShaderBuilds(u32 count) {
+    frame_shader_builds.fetch_add(count, std::memory_order_relaxed);
+}
+
+void PerfStats::AddFileSystemWait(Clock::duration wait) {
+    frame_fs_wait_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count(),
+                               std::memory_order_relaxed);
+}
+
+void PerfStats::AddPresentLatency(Clock::duration latency) {
+    std::scoped_lock lock{object_mutex};
+
+    accumulated_present_latency += latency;
+    present_latency_samples += 1;
+}
+
+void PerfStats::AddAudioLatency(Clock::duration latency) {
+    std::scoped_lock lock{object_mutex};
+
+    accumulated_audio_latency += latency;
+    audio_latency_samples += 1;
+}
+
+void PerfStats::AddAudioUnderruns(u32 count) {
+    std::scoped_lock lock{object_mutex};
+
+    audio_underruns += count;
+}
+
+void PerfStats::AddAudioRenderTime(Clock::duration render_time) {
+    std::scoped_lock lock{object_mutex};
+
+    accumulated_audio_render_time += render_time;
+    audio_render_samples += 1;
+}
+
+void PerfStats::AddGpuTime(std::chrono::nanoseconds gpu_time) {
+    std::scoped_lock lock{object_mutex};
+
+    accumulated_gpu_time += gpu_time;
 }
 
 double PerfStats::GetMeanFrametime() const {
@@ -105,6 +253,30 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .present_latency =
+            present_latency_samples == 0
+                ? 0.0
+                : duration_cast<DoubleSecs>(accumulated_present_latency).count() /
+                      static_cast<double>(present_latency_samples),
+        .audio_latency = audio_latency_samples == 0
+                             ? 0.0
+                             : duration_cast<DoubleSecs>(accumulated_audio_latency).count() /
+                                   static_cast<double>(audio_latency_samples),
+        .audio_underruns = audio_underruns,
+        .audio_render_time =
+            audio_render_samples == 0
+                ? 0.0
+                : duration_cast<DoubleSecs>(accumulated_audio_render_time).count() /
+                      static_cast<double>(audio_render_samples),
+        .gpu_frametime = current_frames == 0.0
+                             ? 0.0
+                             : duration_cast<DoubleSecs>(accumulated_gpu_time).count() /
+                                   current_frames,
+        .game_frametime_p50 = interval_frame_times.GetPercentile(0.50) / 1000.0,
+        .game_frametime_p95 = interval_frame_times.GetPercentile(0.95) / 1000.0,
+        .game_frametime_p99 = interval_frame_times.GetPercentile(0.99) / 1000.0,
+        .game_frametime_max = interval_frame_times.GetMax() / 1000.0,
+        .stutters = interval_stutters,
     };
 
     // Reset counters
@@ -113,6 +285,16 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
+    accumulated_present_latency = Clock::duration::zero();
+    present_latency_samples = 0;
+    accumulated_audio_latency = Clock::duration::zero();
+    audio_latency_samples = 0;
+    audio_underruns = 0;
+    accumulated_audio_render_time = Clock::duration::zero();
+    audio_render_samples = 0;
+    accumulated_gpu_time = std::chrono::nanoseconds{0};
+    interval_frame_times.Reset();
+    interval_stutters.fill(0);
     previous_fps = current_fps;
 
     return results;
@@ -7,11 +7,50 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <mutex>
 #include "common/common_types.h"
 
 namespace Core {
 
+/// Probable cause of a stutter, from what ran during the frame that took too long
+enum class StutterCause : u8 {
+    ShaderBuild, ///< Shaders finished building during the frame
+    FileSystem,  ///< The guest waited on file system reads for most of the spike
+    Unknown,     ///< Nothing reported explains the spike
+    Count,
+};
+
+/**
+ * Histogram of frame times in fixed buckets, to get their percentiles without keeping them.
+ */
+class FrameTimeHistogram {
+public:
+    /// Width of each bucket, in milliseconds
+    static constexpr double BucketWidth = 0.1;
+    /// Number of buckets, the last one also holds every longer frame
+    static constexpr std::size_t NumBuckets = 2000;
+
+    void Add(double frame_time_ms);
+    void Reset();
+
+    /// Returns the frame time, in milliseconds, below which the given fraction of frames fall
+    double GetPercentile(double fraction) const;
+
+    u32 GetCount() const {
+        return count;
+    }
+
+    double GetMax() const {
+        return max;
+    }
+
+private:
+    std::array<u32, NumBuckets> buckets{};
+    u32 count = 0;
+    double max = 0.0;
+};
+
 struct PerfStatsResults {
     /// System FPS (LCD VBlanks) in Hz
     double system_fps;
@@ -21,6 +60,27 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Estimated time between the guest sampling input and the frame being displayed, in seconds.
+    /// Zero when the renderer can not measure presentation.
+    double present_latency;
+    /// Average duration of audio queued for the sink when the guest submitted a buffer, in
+    /// seconds. Zero when no audio was submitted.
+    double audio_latency;
+    /// Number of times the audio sink ran out of samples while playing
+    u32 audio_underruns;
+    /// Average walltime the audio renderer took to process a command list, in seconds. Zero when
+    /// nothing was rendered.
+    double audio_render_time;
+    /// Average GPU time of the game frames, in seconds. Zero when the renderer does not time the
+    /// GPU work.
+    double gpu_frametime;
+    /// Percentiles of the time between game frames, in seconds
+    double game_frametime_p50;
+    double game_frametime_p95;
+    double game_frametime_p99;
+    double game_frametime_max;
+    /// Number of game frames that took much longer than the ones around them, by probable cause
+    std::array<u32, static_cast<std::size_t>(StutterCause::Count)> stutters;
 };
 
 /**
@@ -34,9 +94,26 @@ public:
 
     using Clock = std::chrono::steady_clock;
 
+    /// Called with the walltime of each system frame, excluding any waits
+    using FrameCallback = std::function<void(Clock::duration work_time)>;
+
+    /// Sets the callback invoked at the end of every system frame. The callback runs with the
+    /// stats locked and must not use them; once this returns, the previous one is not running.
+    void SetFrameCallback(FrameCallback callback);
+
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
+    void AddPresentLatency(Clock::duration latency);
+    void AddAudioLatency(Clock::duration latency);
+    void AddAudioUnderruns(u32 count);
+    void AddAudioRenderTime(Clock::duration render_time);
+    /// Reports GPU time spent on work the host GPU completed
+    void AddGpuTime(std::chrono::nanoseconds gpu_time);
+    /// Reports how many shaders finished building since the previous game frame
+    void AddShaderBuilds(u32 count);
+    /// Reports time the guest waited on a file system read
+    void AddFileSystemWait(Clock::duration wait);
 
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
@@ -73,6 +150,36 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
+    /// Cumulative estimated input to photon latency of the frames measured since last reset
+    Clock::duration accumulated_present_latency = Clock::duration::zero();
+    /// Cumulative number of frames with a measured presentation since last reset
+    u32 present_latency_samples = 0;
+    /// Cumulative audio latency of the buffers submitted to the sink since last reset
+    Clock::duration accumulated_audio_latency = Clock::duration::zero();
+    /// Cumulative number of buffers submitted to the sink since last reset
+    u32 audio_latency_samples = 0;
+    /// Cumulative number of audio sink underruns since last reset
+    u32 audio_underruns = 0;
+    /// Cumulative walltime of the audio command lists processed since last reset
+    Clock::duration accumulated_audio_render_time = Clock::duration::zero();
+    /// Cumulative number of audio command lists processed since last reset
+    u32 audio_render_samples = 0;
+    /// Cumulative GPU time of the work completed since last reset
+    std::chrono::nanoseconds accumulated_gpu_time{0};
+
+    /// Frame times of the game frames since last reset, and since the title started
+    FrameTimeHistogram interval_frame_times;
+    FrameTimeHistogram session_frame_times;
+    /// Point when the previous game frame ended
+    Clock::time_point previous_game_frame_end{};
+    /// Moving average of the game frame times, in milliseconds, stutters are measured against it
+    double average_game_frame_ms = 0.0;
+    /// Shaders built and file system wait time since the previous game frame
+    std::atomic<u32> frame_shader_builds = 0;
+    std::atomic<s64> frame_fs_wait_ns = 0;
+    /// Stutters detected since last reset, and since the title started
+    std::array<u32, static_cast<std::size_t>(StutterCause::Count)> interval_stutters{};
+    std::array<u32, static_cast<std::size_t>(StutterCause::Count)> session_stutters{};
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -82,6 +189,8 @@ private:
     Clock::duration previous_frame_length = Clock::duration::zero();
     /// Previously computed fps
     double previous_fps = 0;
+    /// Invoked at the end of every system frame
+    FrameCallback frame_callback;
 };
 
 class SpeedLimiter {
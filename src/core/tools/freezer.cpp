@@ -167,6 +167,12 @@ void Freezer::FrameCallback(std::chrono::nanoseconds ns_late) {
     std::scoped_lock lock{entries_mutex};
 
     for (const auto& entry : entries) {
+        // Values that are still in place are not written again, as writes invalidate the pages
+        // cached by the GPU
+        const u64 mask = entry.width == 8 ? ~u64{0} : (u64{1} << (entry.width * 8)) - 1;
+        if (MemoryReadWidth(memory, entry.width, entry.address) == (entry.value & mask)) {
+            continue;
+        }
         LOG_DEBUG(Common_Memory,
                   "Enforcing memory freeze at address={:016X}, value={:016X}, width={:02X}",
                   entry.address, entry.value, entry.width);
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "common/metrics.h"
+#include "common/polyfill_thread.h"
+#include "common/thread.h"
+#include "core/tools/metrics_server.h"
+
+namespace Tools {
+
+namespace {
+using boost::asio::ip::tcp;
+
+/// Largest request read from a client, the request itself is not looked at
+constexpr size_t RequestBufferSize = 4096;
+
+class Connection : public std::enable_shared_from_this<Connection> {
+public:
+    explicit Connection(tcp::socket&& socket_) : socket{std::move(socket_)} {}
+
+    void Start() {
+        socket.async_read_some(boost::asio::buffer(request),
+                               [self = shared_from_this()](const boost::system::error_code& error,
+                                                           size_t) {
+                                   if (!error.failed()) {
+                                       self->Respond();
+                                   }
+                               });
+    }
+
+private:
+    void Respond() {
+        const std::string body = Common::Metrics::GetRegistry().Serialize();
+        response = fmt::format("HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Content-Length: {}\r\n"
+                               "Connection: close\r\n\r\n{}",
+                               body.size(), body);
+        boost::asio::async_write(socket, boost::asio::buffer(response),
+                                 [self = shared_from_this()](const boost::system::error_code&,
+                                                             size_t) {
+                                     boost::system::error_code ignored;
+                                     self->socket.shutdown(tcp::socket::shutdown_both, ignored);
+                                 });
+    }
+
+    tcp::socket socket;
+    std::array<char, RequestBufferSize> request{};
+    std::string response;
+};
+
+void AsyncAccept(tcp::acceptor& acceptor) {
+    acceptor.async_accept([&](const boost::system::error_code& error, tcp::socket peer) {
+        if (!error.failed()) {
+            std::make_shared<Connection>(std::move(peer))->Start();
+            AsyncAccept(acceptor);
+        }
+    });
+}
+} // Anonymous namespace
+
+struct MetricsServer::Impl {
+    boost::asio::io_context io_context;
+    std::jthread thread;
+};
+
+MetricsServer::MetricsServer(u16 port) : impl{std::make_unique<Impl>()} {
+    LOG_INFO(Core, "Serving metrics on http://127.0.0.1:{}/metrics", port);
+
+    impl->thread = std::jthread([this, port](std::stop_token stop_token) {
+        Common::SetCurrentThreadName("MetricsServer");
+
+        try {
+            tcp::endpoint endpoint{boost::asio::ip::address_v4::loopback(), port};
+            tcp::acceptor acceptor{impl->io_context, endpoint};
+
+            AsyncAccept(acceptor);
+
+            while (!stop_token.stop_requested() && impl->io_context.run()) {
+            }
+        } catch (const std::exception& ex) {
+            LOG_ERROR(Core, "Stopping the metrics server: {}", ex.what());
+        }
+    });
+}
+
+MetricsServer::~MetricsServer() {
+    impl->thread.request_stop();
+    impl->io_context.stop();
+    impl->thread.join();
+}
+
+} // namespace Tools
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+
+#include "common/common_types.h"
+
+namespace Tools {
+
+/**
+ * Serves the metrics of Common::Metrics over HTTP on the loopback interface, so they can be
+ * scraped by Prometheus or read with curl while a game runs. Every request is answered with the
+ * whole registry, whatever its path.
+ */
+class MetricsServer {
+public:
+    explicit MetricsServer(u16 port);
+    ~MetricsServer();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Tools
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_shared_memory.h"
@@ -37,8 +38,8 @@ namespace Service::HID {
 
 // Updating period for each HID device.
 // Period time is obtained by measuring the number of samples in a second on HW using a homebrew
-// Correct npad_update_ns is 4ms this is overclocked to lower input lag
-constexpr auto npad_update_ns = std::chrono::nanoseconds{1 * 1000 * 1000};    // (1ms, 1000Hz)
+// Input changes are also written to the npad as they arrive, see IAppletResource
+constexpr auto npad_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000};    // (4ms, 250Hz)
 constexpr auto default_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000}; // (4ms, 1000Hz)
 constexpr auto mouse_keyboard_update_ns = std::chrono::nanoseconds{8 * 1000 * 1000}; // (8ms, 125Hz)
 constexpr auto motion_update_ns = std::chrono::nanoseconds{5 * 1000 * 1000};         // (5ms, 200Hz)
@@ -453,6 +454,26 @@ IAppletResource::IAppletResource(Core::System& system_, std::shared_ptr<Resource
             return std::nullopt;
         });
 
+    npad_input_event = Core::Timing::CreateEvent(
+        "HID::UpdatePadInputCallback",
+        [this, resource](
+            s64 time, std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
+            const auto guard = LockService();
+            npad_input_pending.store(false, std::memory_order_relaxed);
+            resource->UpdateNpad(ns_late);
+            return std::nullopt;
+        });
+
+    // Changes arriving before the pending update runs are written as a single LIFO entry
+    resource->GetNpad()->SetInputChangedCallback(aruid, [this] {
+        if (!Settings::values.low_latency_input.GetValue()) {
+            return;
+        }
+        if (!npad_input_pending.exchange(true, std::memory_order_relaxed)) {
+            system.CoreTiming().ScheduleEvent(std::chrono::nanoseconds{0}, npad_input_event);
+        }
+    });
+
     system.CoreTiming().ScheduleLoopingEvent(npad_update_ns, npad_update_ns, npad_update_event);
     system.CoreTiming().ScheduleLoopingEvent(default_update_ns, default_update_ns,
                                              default_update_event);
@@ -463,6 +484,8 @@ IAppletResource::IAppletResource(Core::System& system_, std::shared_ptr<Resource
 }
 
 IAppletResource::~IAppletResource() {
+    resource_manager->GetNpad()->SetInputChangedCallback(aruid, {});
+    system.CoreTiming().UnscheduleEvent(npad_input_event);
     system.CoreTiming().UnscheduleEvent(npad_update_event);
     system.CoreTiming().UnscheduleEvent(default_update_event);
     system.CoreTiming().UnscheduleEvent(mouse_keyboard_update_event);
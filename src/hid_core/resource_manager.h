@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "core/hle/service/kernel_helpers.h"
 #include "core/hle/service/service.h"
 
@@ -163,9 +165,11 @@ private:
     void GetSharedMemoryHandle(HLERequestContext& ctx);
 
     std::shared_ptr<Core::Timing::EventType> npad_update_event;
+    std::shared_ptr<Core::Timing::EventType> npad_input_event;
     std::shared_ptr<Core::Timing::EventType> default_update_event;
     std::shared_ptr<Core::Timing::EventType> mouse_keyboard_update_event;
     std::shared_ptr<Core::Timing::EventType> motion_update_event;
+    std::atomic_bool npad_input_pending{};
 
     u64 aruid;
     std::shared_ptr<ResourceManager> resource_manager;
@@ -10,6 +10,7 @@
 #include "common/bit_field.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/settings.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_event.h"
@@ -26,6 +27,14 @@
 
 namespace Service::HID {
 
+namespace {
+s64 GetInputTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // Anonymous namespace
+
 NPad::NPad(Core::HID::HIDCore& hid_core_, KernelHelpers::ServiceContext& service_context_)
     : hid_core{hid_core_}, service_context{service_context_}, npad_resource{service_context} {
     for (std::size_t aruid_index = 0; aruid_index < AruidIndexMax; ++aruid_index) {
@@ -122,6 +131,19 @@ void NPad::ControllerUpdate(Core::HID::ControllerTriggerType type, std::size_t c
         return;
     }
 
+    if (type == Core::HID::ControllerTriggerType::Button ||
+        type == Core::HID::ControllerTriggerType::Stick ||
+        type == Core::HID::ControllerTriggerType::Trigger) {
+        s64 expected = 0;
+        pending_input_time.compare_exchange_strong(expected, GetInputTimestamp(),
+                                                   std::memory_order_relaxed);
+        std::scoped_lock lock{input_changed_mutex};
+        for (const auto& [aruid, callback] : input_changed_callbacks) {
+            callback();
+        }
+        return;
+    }
+
     for (std::size_t aruid_index = 0; aruid_index < AruidIndexMax; aruid_index++) {
         if (controller_idx >= controller_data[aruid_index].size()) {
             return;
@@ -459,6 +481,8 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
     }
 
     std::scoped_lock lock{*applet_resource_holder.shared_mutex};
+    const s64 input_time = pending_input_time.exchange(0, std::memory_order_relaxed);
+    bool wrote_entries = false;
     for (std::size_t aruid_index = 0; aruid_index < AruidIndexMax; ++aruid_index) {
         const auto* data = applet_resource_holder.applet_resource->GetAruidDataByIndex(aruid_index);
         const auto aruid = data->aruid;
@@ -593,10 +617,19 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
             libnx_state.l_stick = pad_state.l_stick;
             libnx_state.r_stick = pad_state.r_stick;
             npad->system_ext_lifo.WriteNextEntry(pad_state);
+            wrote_entries = true;
 
             press_state |= static_cast<u64>(pad_state.npad_buttons.raw);
         }
     }
+
+    if (input_time != 0 && wrote_entries) {
+        static auto& input_latency = Common::Metrics::GetRegistry().RegisterHistogram(
+            "yuzu_hid_input_latency_seconds",
+            "Host time from an input change until it is written to the npad shared memory",
+            {0.0005, 0.001, 0.002, 0.004, 0.008, 0.016, 0.033});
+        input_latency.Observe(static_cast<f64>(GetInputTimestamp() - input_time) / 1e9);
+    }
 }
 
 Result NPad::SetSupportedNpadStyleSet(u64 aruid, Core::HID::NpadStyleSet supported_style_set) {
@@ -1329,4 +1362,13 @@ void NPad::EnableAppletToGetInput(u64 aruid) {
     }
 }
 
+void NPad::SetInputChangedCallback(u64 aruid, std::function<void()> callback) {
+    std::scoped_lock lock{input_changed_mutex};
+    if (callback) {
+        input_changed_callbacks.insert_or_assign(aruid, std::move(callback));
+    } else {
+        input_changed_callbacks.erase(aruid);
+    }
+}
+
 } // namespace Service::HID
@@ -5,8 +5,10 @@
 
 #include <array>
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <span>
+#include <unordered_map>
 
 #include "common/common_types.h"
 #include "hid_core/hid_types.h"
@@ -155,6 +157,10 @@ public:
 
     void EnableAppletToGetInput(u64 aruid);
 
+    /// Sets the function called for the applet from the input threads when buttons, sticks or
+    /// triggers change. An empty function removes the applet's callback.
+    void SetInputChangedCallback(u64 aruid, std::function<void()> callback);
+
 private:
     struct NpadControllerData {
         NpadInternalState* shared_memory = nullptr;
@@ -205,6 +211,10 @@ private:
     std::mutex* input_mutex{nullptr};
 
     std::atomic<u64> press_state{};
+    std::mutex input_changed_mutex;
+    std::unordered_map<u64, std::function<void()>> input_changed_callbacks;
+    /// Host time of the oldest input change not written to shared memory yet, zero when none
+    std::atomic<s64> pending_input_time{};
     std::array<std::array<NpadControllerData, MaxSupportedNpadIdTypes>, AruidIndexMax>
         controller_data{};
 };
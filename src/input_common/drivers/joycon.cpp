@@ -34,6 +34,7 @@ Joycons::~Joycons() {
 
 void Joycons::Reset() {
     scan_thread = {};
+    input_thread = {};
     for (const auto& device : left_joycons) {
         if (!device) {
             continue;
@@ -73,9 +74,35 @@ void Joycons::Setup() {
         device = std::make_shared<Joycon::JoyconDriver>(port++);
     }
 
+    input_thread = std::jthread([this](std::stop_token stop_token) { InputThread(stop_token); });
     scan_thread = std::jthread([this](std::stop_token stop_token) { ScanThread(stop_token); });
 }
 
+void Joycons::InputThread(std::stop_token stop_token) {
+    // Max update rate is 5ms, ensure we are always able to read a bit faster
+    constexpr auto PollInterval = std::chrono::milliseconds{1};
+
+    LOG_INFO(Input, "Joycon Adapter input thread started");
+    Common::SetCurrentThreadName("JoyconInput");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+
+    while (!stop_token.stop_requested()) {
+        std::size_t report_count = 0;
+        for (const auto* devices : {&left_joycons, &right_joycons, &pro_controller}) {
+            for (const auto& device : *devices) {
+                report_count += device->Poll();
+            }
+        }
+
+        // Only wait when every device is drained, hidapi has no way to wait on several devices
+        if (report_count == 0) {
+            std::this_thread::sleep_for(PollInterval);
+        }
+    }
+
+    LOG_INFO(Input, "Joycon Adapter input thread stopped");
+}
+
 void Joycons::ScanThread(std::stop_token stop_token) {
     constexpr u16 nintendo_vendor_id = 0x057e;
     Common::SetCurrentThreadName("JoyconScanThread");
@@ -74,6 +74,9 @@ private:
     /// Actively searches for new devices
     void ScanThread(std::stop_token stop_token);
 
+    /// Reads the reports of every connected device without blocking on any of them
+    void InputThread(std::stop_token stop_token);
+
     /// Returns true if device is valid and not registered
     bool IsDeviceNew(SDL_hid_device_info* device_info) const;
 
@@ -114,6 +117,7 @@ private:
     Common::Input::NfcState TranslateDriverResult(Common::Input::DriverResult result) const;
 
     std::jthread scan_thread;
+    std::jthread input_thread;
 
     // Joycon types are split by type to ease supporting dualjoycon configurations
     std::array<std::shared_ptr<Joycon::JoyconDriver>, MaxSupportedControllers> left_joycons{};
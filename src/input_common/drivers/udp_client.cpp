@@ -66,6 +66,26 @@ private:
     }
 
     void HandleReceive(const boost::system::error_code&, std::size_t bytes_transferred) {
+        HandlePacket(bytes_transferred);
+
+        // Servers stream pad data at up to 1000Hz per pad, the datagrams that queued up meanwhile
+        // are read right away instead of waiting on the io_service for each of them
+        for (std::size_t packet = 1; packet < MAX_BATCHED_PACKETS; ++packet) {
+            boost::system::error_code ec{};
+            if (socket.available(ec) == 0 || ec) {
+                break;
+            }
+            const std::size_t size =
+                socket.receive_from(boost::asio::buffer(receive_buffer), receive_endpoint, 0, ec);
+            if (ec) {
+                break;
+            }
+            HandlePacket(size);
+        }
+        StartReceive();
+    }
+
+    void HandlePacket(std::size_t bytes_transferred) {
         if (auto type = Response::Validate(receive_buffer.data(), bytes_transferred)) {
             switch (*type) {
             case Type::Version: {
@@ -89,7 +109,6 @@ private:
             }
             }
         }
-        StartReceive();
     }
 
     void HandleSend(const boost::system::error_code&) {
@@ -125,6 +144,8 @@ private:
     std::array<u8, PAD_DATA_SIZE> send_buffer2;
     udp::endpoint send_endpoint;
 
+    /// Most datagrams handled before the next receive is queued on the io_service
+    static constexpr std::size_t MAX_BATCHED_PACKETS = 32;
     std::array<u8, MAX_PACKET_SIZE> receive_buffer;
     udp::endpoint receive_endpoint;
 };
@@ -236,15 +257,22 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
         return;
     }
 
+    PadData& pad = pads[pad_index];
     clients[client].active = 1;
-    pads[pad_index].connected = true;
-    pads[pad_index].packet_sequence = data.packet_counter;
-
+    // Everything is published again after a reconnection, and periodically so the input engine
+    // catches up with updates it did not store while it was configuring
     const auto now = std::chrono::steady_clock::now();
+    const bool force_publish =
+        !pad.connected || now - pad.last_full_publish >= FULL_PUBLISH_INTERVAL;
+    if (force_publish) {
+        pad.last_full_publish = now;
+    }
+    pad.connected = true;
+    pad.packet_sequence = data.packet_counter;
+
     const auto time_difference = static_cast<u64>(
-        std::chrono::duration_cast<std::chrono::microseconds>(now - pads[pad_index].last_update)
-            .count());
-    pads[pad_index].last_update = now;
+        std::chrono::duration_cast<std::chrono::microseconds>(now - pad.last_update).count());
+    pad.last_update = now;
 
     // Gyroscope values are not it the correct scale from better joy.
     // Dividing by 312 allows us to make one full turn = 1 turn
@@ -263,21 +291,25 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
     const PadIdentifier identifier = GetPadIdentifier(pad_index);
     SetMotion(identifier, 0, motion);
 
+    // TODO: Use custom calibration per device
+    const std::string& touch_device = Settings::values.touch_device.GetValue();
+    if (!pad.status.touch_calibration || pad.touch_device != touch_device) {
+        const Common::ParamPackage touch_param(touch_device);
+        pad.touch_device = touch_device;
+        pad.status.touch_calibration = DeviceStatus::CalibrationData{
+            .min_x = static_cast<u16>(touch_param.Get("min_x", 100)),
+            .min_y = static_cast<u16>(touch_param.Get("min_y", 50)),
+            .max_x = static_cast<u16>(touch_param.Get("max_x", 1800)),
+            .max_y = static_cast<u16>(touch_param.Get("max_y", 850)),
+        };
+    }
+    const auto [min_x, min_y, max_x, max_y] = *pad.status.touch_calibration;
+
     for (std::size_t id = 0; id < data.touch.size(); ++id) {
         const auto touch_pad = data.touch[id];
-        const auto touch_axis_x_id =
-            static_cast<int>(id == 0 ? PadAxes::Touch1X : PadAxes::Touch2X);
-        const auto touch_axis_y_id =
-            static_cast<int>(id == 0 ? PadAxes::Touch1Y : PadAxes::Touch2Y);
-        const auto touch_button_id =
-            static_cast<int>(id == 0 ? PadButton::Touch1 : PadButton::Touch2);
-
-        // TODO: Use custom calibration per device
-        const Common::ParamPackage touch_param(Settings::values.touch_device.GetValue());
-        const u16 min_x = static_cast<u16>(touch_param.Get("min_x", 100));
-        const u16 min_y = static_cast<u16>(touch_param.Get("min_y", 50));
-        const u16 max_x = static_cast<u16>(touch_param.Get("max_x", 1800));
-        const u16 max_y = static_cast<u16>(touch_param.Get("max_y", 850));
+        const auto touch_axis_x_id = id == 0 ? PadAxes::Touch1X : PadAxes::Touch2X;
+        const auto touch_axis_y_id = id == 0 ? PadAxes::Touch1Y : PadAxes::Touch2Y;
+        const auto touch_button_id = id == 0 ? PadButton::Touch1 : PadButton::Touch2;
 
         const f32 x =
             static_cast<f32>(std::clamp(static_cast<u16>(touch_pad.x), min_x, max_x) - min_x) /
@@ -287,24 +319,24 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
             static_cast<f32>(max_y - min_y);
 
         if (touch_pad.is_active) {
-            SetAxis(identifier, touch_axis_x_id, x);
-            SetAxis(identifier, touch_axis_y_id, y);
-            SetButton(identifier, touch_button_id, true);
+            PublishAxis(pad, identifier, touch_axis_x_id, x, force_publish);
+            PublishAxis(pad, identifier, touch_axis_y_id, y, force_publish);
+            PublishButton(pad, identifier, touch_button_id, true, force_publish);
             continue;
         }
-        SetAxis(identifier, touch_axis_x_id, 0);
-        SetAxis(identifier, touch_axis_y_id, 0);
-        SetButton(identifier, touch_button_id, false);
+        PublishAxis(pad, identifier, touch_axis_x_id, 0, force_publish);
+        PublishAxis(pad, identifier, touch_axis_y_id, 0, force_publish);
+        PublishButton(pad, identifier, touch_button_id, false, force_publish);
     }
 
-    SetAxis(identifier, static_cast<int>(PadAxes::LeftStickX),
-            (data.left_stick_x - 127.0f) / 127.0f);
-    SetAxis(identifier, static_cast<int>(PadAxes::LeftStickY),
-            (data.left_stick_y - 127.0f) / 127.0f);
-    SetAxis(identifier, static_cast<int>(PadAxes::RightStickX),
-            (data.right_stick_x - 127.0f) / 127.0f);
-    SetAxis(identifier, static_cast<int>(PadAxes::RightStickY),
-            (data.right_stick_y - 127.0f) / 127.0f);
+    PublishAxis(pad, identifier, PadAxes::LeftStickX, (data.left_stick_x - 127.0f) / 127.0f,
+                force_publish);
+    PublishAxis(pad, identifier, PadAxes::LeftStickY, (data.left_stick_y - 127.0f) / 127.0f,
+                force_publish);
+    PublishAxis(pad, identifier, PadAxes::RightStickX, (data.right_stick_x - 127.0f) / 127.0f,
+                force_publish);
+    PublishAxis(pad, identifier, PadAxes::RightStickY, (data.right_stick_y - 127.0f) / 127.0f,
+                force_publish);
 
     static constexpr std::array<PadButton, 16> buttons{
         PadButton::Share,    PadButton::L3,     PadButton::R3,    PadButton::Options,
@@ -314,14 +346,38 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
 
     for (std::size_t i = 0; i < buttons.size(); ++i) {
         const bool button_status = (data.digital_button & (1U << i)) != 0;
-        const int button = static_cast<int>(buttons[i]);
-        SetButton(identifier, button, button_status);
+        PublishButton(pad, identifier, buttons[i], button_status, force_publish);
+    }
+
+    PublishButton(pad, identifier, PadButton::Home, data.home != 0, force_publish);
+    PublishButton(pad, identifier, PadButton::TouchHardPress, data.touch_hard_press != 0,
+                  force_publish);
+
+    const auto battery = GetBatteryLevel(data.info.battery);
+    if (force_publish || battery != pad.published_battery) {
+        pad.published_battery = battery;
+        SetBattery(identifier, battery);
     }
+}
 
-    SetButton(identifier, static_cast<int>(PadButton::Home), data.home != 0);
-    SetButton(identifier, static_cast<int>(PadButton::TouchHardPress), data.touch_hard_press != 0);
+void UDPClient::PublishButton(PadData& pad, const PadIdentifier& identifier, PadButton button,
+                              bool value, bool force) {
+    const u32 mask = static_cast<u32>(button);
+    if (!force && ((pad.published_buttons & mask) != 0) == value) {
+        return;
+    }
+    pad.published_buttons = value ? pad.published_buttons | mask : pad.published_buttons & ~mask;
+    SetButton(identifier, static_cast<int>(button), value);
+}
 
-    SetBattery(identifier, GetBatteryLevel(data.info.battery));
+void UDPClient::PublishAxis(PadData& pad, const PadIdentifier& identifier, PadAxes axis, f32 value,
+                            bool force) {
+    f32& published = pad.published_axes[static_cast<std::size_t>(axis)];
+    if (!force && published == value) {
+        return;
+    }
+    published = value;
+    SetAxis(identifier, static_cast<int>(axis), value);
 }
 
 void UDPClient::StartCommunication(std::size_t client, const std::string& host, u16 port) {
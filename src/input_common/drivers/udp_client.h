@@ -122,6 +122,15 @@ private:
         u64 packet_sequence{};
 
         std::chrono::time_point<std::chrono::steady_clock> last_update;
+
+        /// Touch device setting the touch calibration was read from
+        std::string touch_device;
+
+        // Values last handed to the input engine, packets only publish what changed since
+        std::chrono::time_point<std::chrono::steady_clock> last_full_publish;
+        u32 published_buttons{};
+        std::array<f32, static_cast<std::size_t>(PadAxes::Undefined)> published_axes{};
+        Common::Input::BatteryLevel published_battery{};
     };
 
     struct ClientConnection {
@@ -147,6 +156,10 @@ private:
     void OnVersion(Response::Version);
     void OnPortInfo(Response::PortInfo);
     void OnPadData(Response::PadData, std::size_t client);
+    void PublishButton(PadData& pad, const PadIdentifier& identifier, PadButton button, bool value,
+                       bool force);
+    void PublishAxis(PadData& pad, const PadIdentifier& identifier, PadAxes axis, f32 value,
+                     bool force);
     void StartCommunication(std::size_t client, const std::string& host, u16 port);
     PadIdentifier GetPadIdentifier(std::size_t pad_index) const;
     Common::UUID GetHostUUID(const std::string& host) const;
@@ -156,6 +169,8 @@ private:
     // Allocate clients for 8 udp servers
     static constexpr std::size_t MAX_UDP_CLIENTS = 8;
     static constexpr std::size_t PADS_PER_CLIENT = 4;
+    /// Longest time between updates of an unchanged input
+    static constexpr std::chrono::milliseconds FULL_PUBLISH_INTERVAL{100};
     std::array<PadData, MAX_UDP_CLIENTS * PADS_PER_CLIENT> pads{};
     std::array<ClientConnection, MAX_UDP_CLIENTS> clients{};
 };
@@ -26,7 +26,6 @@ JoyconDriver::~JoyconDriver() {
 
 void JoyconDriver::Stop() {
     is_connected = false;
-    input_thread = {};
 }
 
 Common::Input::DriverResult JoyconDriver::RequestDeviceAccess(SDL_hid_device_info* device_info) {
@@ -124,65 +123,54 @@ Common::Input::DriverResult JoyconDriver::InitializeDevice() {
 
     // Start polling for data
     is_connected = true;
-    if (!input_thread_running) {
-        input_thread =
-            std::jthread([this](std::stop_token stop_token) { InputThread(stop_token); });
-    }
 
     disable_input_thread = false;
     return Common::Input::DriverResult::Success;
 }
 
-void JoyconDriver::InputThread(std::stop_token stop_token) {
-    LOG_INFO(Input, "Joycon Adapter input thread started");
-    Common::SetCurrentThreadName("JoyconInput");
-    input_thread_running = true;
-
-    // Max update rate is 5ms, ensure we are always able to read a bit faster
-    constexpr int ThreadDelay = 3;
-    std::vector<u8> buffer(MaxBufferSize);
-
-    while (!stop_token.stop_requested()) {
-        int status = 0;
-
-        if (!IsInputThreadValid()) {
-            input_thread.request_stop();
-            continue;
-        }
+std::size_t JoyconDriver::Poll() {
+    // Reports read at once are capped so a flooding device can't starve the others
+    constexpr std::size_t MaxReportsPerPoll = 8;
 
-        // By disabling the input thread we can ensure custom commands will succeed as no package is
-        // skipped
-        if (!disable_input_thread) {
-            status = SDL_hid_read_timeout(hidapi_handle->handle, buffer.data(), buffer.size(),
-                                          ThreadDelay);
-        } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(ThreadDelay));
-        }
+    if (!is_connected.load()) {
+        return 0;
+    }
+    if (!IsInputThreadValid()) {
+        LOG_INFO(Input, "Joycon on port {} stopped responding", port);
+        is_connected = false;
+        return 0;
+    }
 
-        if (IsPayloadCorrect(status, buffer)) {
-            OnNewData(buffer);
-        }
+    std::size_t report_count = 0;
 
-        if (!vibration_queue.Empty()) {
-            VibrationValue vibration_value;
-            vibration_queue.Pop(vibration_value);
-            last_vibration_result = rumble_protocol->SendVibration(vibration_value);
+    // By disabling the input thread we can ensure custom commands will succeed as no package is
+    // skipped
+    while (!disable_input_thread && report_count < MaxReportsPerPoll) {
+        const int status = SDL_hid_read(hidapi_handle->handle, input_buffer.data(),
+                                        input_buffer.size());
+        if (!IsPayloadCorrect(status, input_buffer)) {
+            break;
         }
+        OnNewData(input_buffer, std::chrono::steady_clock::now());
+        report_count++;
+    }
 
-        // We can't keep up with vibrations. Start skipping.
-        while (vibration_queue.Size() > 6) {
-            vibration_queue.Pop();
-        }
+    if (!vibration_queue.Empty()) {
+        VibrationValue vibration_value;
+        vibration_queue.Pop(vibration_value);
+        last_vibration_result = rumble_protocol->SendVibration(vibration_value);
+    }
 
-        std::this_thread::yield();
+    // We can't keep up with vibrations. Start skipping.
+    while (vibration_queue.Size() > 6) {
+        vibration_queue.Pop();
     }
 
-    is_connected = false;
-    input_thread_running = false;
-    LOG_INFO(Input, "Joycon Adapter input thread stopped");
+    return report_count;
 }
 
-void JoyconDriver::OnNewData(std::span<u8> buffer) {
+void JoyconDriver::OnNewData(std::span<u8> buffer,
+                             std::chrono::steady_clock::time_point timestamp) {
     const auto report_mode = static_cast<ReportMode>(buffer[0]);
 
     // Packages can be a little bit inconsistent. Average the delta time to provide a smoother
@@ -191,11 +179,11 @@ void JoyconDriver::OnNewData(std::span<u8> buffer) {
     case ReportMode::STANDARD_FULL_60HZ:
     case ReportMode::NFC_IR_MODE_60HZ:
     case ReportMode::SIMPLE_HID_MODE: {
-        const auto now = std::chrono::steady_clock::now();
         const auto new_delta_time = static_cast<u64>(
-            std::chrono::duration_cast<std::chrono::microseconds>(now - last_update).count());
+            std::chrono::duration_cast<std::chrono::microseconds>(timestamp - last_update)
+                .count());
         delta_time = ((delta_time * 8) + (new_delta_time * 2)) / 10;
-        last_update = now;
+        last_update = timestamp;
         joycon_poller->UpdateColor(color);
         break;
     }
@@ -4,10 +4,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <span>
-#include <thread>
+#include <vector>
 
 #include "common/threadsafe_queue.h"
 #include "input_common/helpers/joycon_protocol/joycon_types.h"
@@ -35,6 +36,10 @@ public:
     Common::Input::DriverResult InitializeDevice();
     void Stop();
 
+    /// Reads the reports the device has sent without blocking and sends pending vibrations.
+    /// Returns the number of reports read. Only called from the input thread of Joycons.
+    std::size_t Poll();
+
     bool IsConnected() const;
     bool IsVibrationEnabled() const;
 
@@ -82,11 +87,8 @@ private:
         bool vibration{};
     };
 
-    /// Main thread, actively request new data from the handle
-    void InputThread(std::stop_token stop_token);
-
-    /// Called every time a valid package arrives
-    void OnNewData(std::span<u8> buffer);
+    /// Called every time a valid package arrives, timestamp is the time it was read at
+    void OnNewData(std::span<u8> buffer, std::chrono::steady_clock::time_point timestamp);
 
     /// Updates device configuration to enable or disable features
     Common::Input::DriverResult SetPollingMode();
@@ -159,8 +161,7 @@ private:
 
     // Thread related
     mutable std::mutex mutex;
-    std::jthread input_thread;
-    bool input_thread_running{};
+    std::vector<u8> input_buffer = std::vector<u8>(MaxBufferSize);
     bool disable_input_thread{};
 };
 
@@ -39,6 +39,10 @@ void Packet::Read(void* out_data, std::size_t size_in_bytes) {
     }
 }
 
+void Packet::Reserve(std::size_t size_in_bytes) {
+    data.reserve(size_in_bytes);
+}
+
 void Packet::Clear() {
     data.clear();
     read_pos = 0;
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include "common/common_types.h"
 
@@ -29,6 +31,13 @@ public:
      */
     void Read(void* out_data, std::size_t size_in_bytes);
 
+    /**
+     * Reserves space for the data appended later, avoiding reallocations while the packet is
+     * built
+     * @param size_in_bytes Total number of bytes the packet is expected to hold
+     */
+    void Reserve(std::size_t size_in_bytes);
+
     /**
      * Clear the packet
      * After calling Clear, the packet is empty.
@@ -102,6 +111,10 @@ public:
     Packet& Write(const std::array<T, S>& data);
 
 private:
+    /// Bytes are copied in bulk, they have no endianness to handle
+    template <typename T>
+    static constexpr bool IsByte = std::is_same_v<T, u8> || std::is_same_v<T, s8>;
+
     /**
      * Check if the packet can extract a given number of bytes
      * This function updates accordingly the state of the packet.
@@ -124,6 +137,10 @@ Packet& Packet::Read(std::vector<T>& out_data) {
     out_data.resize(size);
 
     // Then extract the data
+    if constexpr (IsByte<T>) {
+        Read(out_data.data(), size);
+        return *this;
+    }
     for (std::size_t i = 0; i < out_data.size(); ++i) {
         T character;
         Read(character);
@@ -134,6 +151,10 @@ Packet& Packet::Read(std::vector<T>& out_data) {
 
 template <typename T, std::size_t S>
 Packet& Packet::Read(std::array<T, S>& out_data) {
+    if constexpr (IsByte<T>) {
+        Read(out_data.data(), S);
+        return *this;
+    }
     for (std::size_t i = 0; i < out_data.size(); ++i) {
         T character;
         Read(character);
@@ -148,6 +169,10 @@ Packet& Packet::Write(const std::vector<T>& in_data) {
     Write(static_cast<u32>(in_data.size()));
 
     // Then insert the data
+    if constexpr (IsByte<T>) {
+        Append(in_data.data(), in_data.size());
+        return *this;
+    }
     for (std::size_t i = 0; i < in_data.size(); ++i) {
         Write(in_data[i]);
     }
@@ -156,6 +181,10 @@ Packet& Packet::Write(const std::vector<T>& in_data) {
 
 template <typename T, std::size_t S>
 Packet& Packet::Write(const std::array<T, S>& in_data) {
+    if constexpr (IsByte<T>) {
+        Append(in_data.data(), S);
+        return *this;
+    }
     for (std::size_t i = 0; i < in_data.size(); ++i) {
         Write(in_data[i]);
     }
@@ -44,6 +44,14 @@ public:
     MemberList members;                     ///< Information about the members of this room
     mutable std::shared_mutex member_mutex; ///< Mutex for locking the members list
 
+    struct MemberRoute {
+        ENetPeer* peer;      ///< The remote peer.
+        IPv4Address fake_ip; ///< The assigned fake ip address of the member.
+    };
+    /// Copy of the peers and fake IPs of the members used to relay packets without locking
+    /// member_mutex. Only the room thread changes the members, so only it uses this copy.
+    std::vector<MemberRoute> member_routes;
+
     UsernameBanList username_ban_list; ///< List of banned usernames
     IPBanList ip_ban_list;             ///< List of banned IP addresses
     mutable std::mutex ban_list_mutex; ///< Mutex for the ban lists
@@ -205,6 +213,16 @@ public:
      */
     IPv4Address GenerateFakeIPAddress();
 
+    /// Rebuilds member_routes, called by the room thread after the members change
+    void UpdateMemberRoutes();
+
+    /**
+     * Queues a received packet on the member it is addressed to, or on every member except its
+     * sender when it is a broadcast.
+     */
+    void RelayPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                     bool broadcast);
+
     /**
      * Broadcasts this packet to all members except the sender.
      * @param event The ENet event containing the data
@@ -240,7 +258,12 @@ public:
 void Room::RoomImpl::ServerLoop() {
     while (state != State::Closed) {
         ENetEvent event;
-        if (enet_host_service(server, &event, 5) > 0) {
+        if (enet_host_service(server, &event, 5) <= 0) {
+            continue;
+        }
+        // Handle every queued event before flushing, so the packets relayed for them are sent
+        // together
+        do {
             switch (event.type) {
             case ENET_EVENT_TYPE_RECEIVE:
                 switch (event.packet->data[0]) {
@@ -273,7 +296,10 @@ void Room::RoomImpl::ServerLoop() {
                     HandleModGetBanListPacket(&event);
                     break;
                 }
-                enet_packet_destroy(event.packet);
+                // Relayed packets are referenced by the peers they are queued on
+                if (event.packet->referenceCount == 0) {
+                    enet_packet_destroy(event.packet);
+                }
                 break;
             case ENET_EVENT_TYPE_DISCONNECT:
                 HandleClientDisconnection(event.peer);
@@ -282,7 +308,8 @@ void Room::RoomImpl::ServerLoop() {
             case ENET_EVENT_TYPE_CONNECT:
                 break;
             }
-        }
+        } while (enet_host_check_events(server, &event) > 0);
+        enet_host_flush(server);
     }
     // Close the connection to all members:
     SendCloseMessage();
@@ -388,6 +415,7 @@ void Room::RoomImpl::HandleJoinRequest(const ENetEvent* event) {
         std::lock_guard lock(member_mutex);
         members.push_back(std::move(member));
     }
+    UpdateMemberRoutes();
 
     // Notify everyone that the room information has changed.
     BroadcastRoomInformation();
@@ -434,6 +462,7 @@ void Room::RoomImpl::HandleModKickPacket(const ENetEvent* event) {
         enet_peer_disconnect(target_member->peer, 0);
         members.erase(target_member);
     }
+    UpdateMemberRoutes();
 
     // Announce the change to all clients.
     SendStatusMessage(IdMemberKicked, nickname, username, ip);
@@ -477,6 +506,7 @@ void Room::RoomImpl::HandleModBanPacket(const ENetEvent* event) {
         enet_peer_disconnect(target_member->peer, 0);
         members.erase(target_member);
     }
+    UpdateMemberRoutes();
 
     {
         std::lock_guard lock(ban_list_mutex);
@@ -812,9 +842,44 @@ IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
     return result_ip;
 }
 
+void Room::RoomImpl::UpdateMemberRoutes() {
+    std::shared_lock lock(member_mutex);
+    member_routes.clear();
+    for (const auto& member : members) {
+        member_routes.push_back({member.peer, member.fake_ip});
+    }
+}
+
+void Room::RoomImpl::RelayPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                                 bool broadcast) {
+    // The packet is queued as is, ENet keeps it alive until every peer has sent it
+    ENetPacket* const enet_packet = event->packet;
+    if (broadcast) { // Send the data to everyone except the sender
+        for (const auto& route : member_routes) {
+            if (route.peer != event->peer) {
+                enet_peer_send(route.peer, 0, enet_packet);
+            }
+        }
+        return;
+    }
+    // Send the data only to the destination client
+    const auto route = std::ranges::find(member_routes, destination_address, &MemberRoute::fake_ip);
+    if (route != member_routes.end()) {
+        enet_peer_send(route->peer, 0, enet_packet);
+    } else {
+        LOG_ERROR(Network,
+                  "Attempting to send to unknown IP address: "
+                  "{}.{}.{}.{}",
+                  destination_address[0], destination_address[1], destination_address[2],
+                  destination_address[3]);
+    }
+}
+
 void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
+    // Only the header is parsed, the payload is relayed without being copied
     Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    in_packet.Append(event->packet->data,
+                     std::min(event->packet->dataLength, ProxyPacketHeaderSize));
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
     in_packet.IgnoreBytes(sizeof(u8));          // Domain
@@ -831,48 +896,16 @@ void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
+    if (!in_packet) {
+        return;
     }
-    enet_host_flush(server);
+    RelayPacket(event, remote_ip, broadcast);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
+    // Only the header is parsed, the payload is relayed without being copied
     Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    in_packet.Append(event->packet->data, std::min(event->packet->dataLength, LdnPacketHeaderSize));
 
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
@@ -885,43 +918,10 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else {
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
+    if (!in_packet) {
+        return;
     }
-    enet_host_flush(server);
+    RelayPacket(event, remote_ip, broadcast);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
@@ -1029,6 +1029,7 @@ void Room::RoomImpl::HandleClientDisconnection(ENetPeer* client) {
             members.erase(member);
         }
     }
+    UpdateMemberRoutes();
 
     // Announce the change to all clients.
     enet_peer_disconnect(client, 0);
@@ -1136,6 +1137,7 @@ void Room::Destroy() {
         std::lock_guard lock(room_impl->member_mutex);
         room_impl->members.clear();
     }
+    room_impl->member_routes.clear();
     room_impl->room_information.member_slots = 0;
     room_impl->room_information.name.clear();
 }
@@ -63,6 +63,15 @@ enum RoomMessageTypes : u8 {
     IdJoinSuccessAsMod,
 };
 
+/// Size of the header of an IdProxyPacket message: its type, the local and remote endpoints, the
+/// protocol and the broadcast flag. The size of the data and the data follow.
+constexpr std::size_t ProxyPacketHeaderSize =
+    sizeof(u8) + 2 * (sizeof(u8) + sizeof(IPv4Address) + sizeof(u16)) + 2 * sizeof(u8);
+
+/// Size of the header of an IdLdnPacket message: its type, the LAN packet type, the local and
+/// remote IPs and the broadcast flag. The size of the data and the data follow.
+constexpr std::size_t LdnPacketHeaderSize = 2 * sizeof(u8) + 2 * sizeof(IPv4Address) + sizeof(u8);
+
 /// Types of system status messages
 enum StatusMessageTypes : u8 {
     IdMemberJoin = 1,  ///< Member joining
@@ -166,7 +166,10 @@ void RoomMember::RoomMemberImpl::MemberLoop() {
     while (IsConnected()) {
         std::lock_guard lock(network_mutex);
         ENetEvent event;
-        if (enet_host_service(client, &event, 5) > 0) {
+        // Handle every queued event, not only the first one, so bursts don't wait for the next
+        // service call
+        for (int status = enet_host_service(client, &event, 5); status > 0;
+             status = enet_host_check_events(client, &event)) {
             switch (event.type) {
             case ENET_EVENT_TYPE_RECEIVE:
                 switch (event.packet->data[0]) {
@@ -626,6 +629,7 @@ bool RoomMember::IsConnected() const {
 
 void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
     Packet packet;
+    packet.Reserve(ProxyPacketHeaderSize + sizeof(u32) + proxy_packet.data.size());
     packet.Write(static_cast<u8>(IdProxyPacket));
 
     packet.Write(static_cast<u8>(proxy_packet.local_endpoint.family));
@@ -645,6 +649,7 @@ void RoomMember::SendProxyPacket(const ProxyPacket& proxy_packet) {
 
 void RoomMember::SendLdnPacket(const LDNPacket& ldn_packet) {
     Packet packet;
+    packet.Reserve(LdnPacketHeaderSize + sizeof(u32) + ldn_packet.data.size());
     packet.Write(static_cast<u8>(IdLdnPacket));
 
     packet.Write(static_cast<u8>(ldn_packet.type));
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <memory>
+
+#include "common/common_types.h"
+#include "shader_recompiler/arena.h"
+
+namespace Shader {
+namespace {
+/// Size of the buffer reused across compiles, large enough for the temporaries of most shaders
+constexpr size_t INITIAL_BUFFER_SIZE = 1ULL << 20;
+
+struct ThreadArena {
+    ThreadArena()
+        : buffer{std::make_unique<std::byte[]>(INITIAL_BUFFER_SIZE)},
+          resource{buffer.get(), INITIAL_BUFFER_SIZE, std::pmr::new_delete_resource()} {}
+
+    std::unique_ptr<std::byte[]> buffer;
+    std::pmr::monotonic_buffer_resource resource;
+    u32 depth{};
+};
+
+ThreadArena& GetThreadArena() {
+    thread_local ThreadArena arena;
+    return arena;
+}
+} // Anonymous namespace
+
+CompileArenaScope::CompileArenaScope() {
+    ++GetThreadArena().depth;
+}
+
+CompileArenaScope::~CompileArenaScope() {
+    ThreadArena& arena{GetThreadArena()};
+    if (--arena.depth == 0) {
+        arena.resource.release();
+    }
+}
+
+std::pmr::memory_resource* CompileArena() noexcept {
+    ThreadArena& arena{GetThreadArena()};
+    if (arena.depth == 0) {
+        return std::pmr::new_delete_resource();
+    }
+    return &arena.resource;
+}
+
+} // namespace Shader
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory_resource>
+
+namespace Shader {
+
+/**
+ * Monotonic arena for the temporary containers of a shader compile.
+ * Each thread owns an arena that is reset when its outermost CompileArenaScope ends, the initial
+ * buffer is kept and reused by the next compile of that thread.
+ */
+class CompileArenaScope {
+public:
+    explicit CompileArenaScope();
+    ~CompileArenaScope();
+
+    CompileArenaScope(const CompileArenaScope&) = delete;
+    CompileArenaScope& operator=(const CompileArenaScope&) = delete;
+};
+
+/// Returns the arena of the calling thread, or the default heap resource outside of a scope
+[[nodiscard]] std::pmr::memory_resource* CompileArena() noexcept;
+
+} // namespace Shader
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include <tuple>
 
@@ -13,11 +14,15 @@
 #include "shader_recompiler/backend/glasm/glasm_emit_context.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
 #include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/pass_timings.h"
 #include "shader_recompiler/profile.h"
 #include "shader_recompiler/runtime_info.h"
 
 namespace Shader::Backend::GLASM {
 namespace {
+/// Body text of the last shader emitted by the thread, its capacity is reused by the next one
+thread_local std::string code_buffer;
+
 template <class Func>
 struct FuncTraits {};
 
@@ -400,7 +405,10 @@ std::string_view GetTessSpacing(TessSpacing spacing) {
 
 std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, IR::Program& program,
                       Bindings& bindings) {
+    const PassTimer pass_timer{CompilePass::EmitGLASM};
     EmitContext ctx{program, bindings, profile, runtime_info};
+    ctx.code = std::move(code_buffer);
+    ctx.code.clear();
     Precolor(program);
     EmitCode(ctx, program);
     std::string header{StageHeader(program.stage)};
@@ -458,22 +466,23 @@ std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, I
     }
     header += "TEMP ";
     for (size_t index = 0; index < ctx.reg_alloc.NumUsedRegisters(); ++index) {
-        header += fmt::format("R{},", index);
+        fmt::format_to(std::back_inserter(header), "R{},", index);
     }
     if (program.local_memory_size > 0) {
-        header += fmt::format("lmem[{}],", Common::DivCeil(program.local_memory_size, 4U));
+        fmt::format_to(std::back_inserter(header), "lmem[{}],",
+                       Common::DivCeil(program.local_memory_size, 4U));
     }
     if (program.info.uses_fswzadd) {
         header += "FSWZA[4],FSWZB[4],";
     }
     const u32 num_safety_loop_vectors{Common::DivCeil(ctx.num_safety_loop_vars, 4u)};
     for (u32 index = 0; index < num_safety_loop_vectors; ++index) {
-        header += fmt::format("loop{},", index);
+        fmt::format_to(std::back_inserter(header), "loop{},", index);
     }
     header += "RC;"
               "LONG TEMP ";
     for (size_t index = 0; index < ctx.reg_alloc.NumUsedLongRegisters(); ++index) {
-        header += fmt::format("D{},", index);
+        fmt::format_to(std::back_inserter(header), "D{},", index);
     }
     header += "DC;";
     if (program.info.uses_fswzadd) {
@@ -487,14 +496,19 @@ std::string EmitGLASM(const Profile& profile, const RuntimeInfo& runtime_info, I
                   "MOV.F FSWZB[3],-1;";
     }
     for (u32 index = 0; index < num_safety_loop_vectors; ++index) {
-        header += fmt::format("MOV.S loop{},{{0x2000,0x2000,0x2000,0x2000}};", index);
+        fmt::format_to(std::back_inserter(header), "MOV.S loop{},{{0x2000,0x2000,0x2000,0x2000}};",
+                       index);
     }
     if (ctx.uses_y_direction) {
         header += "PARAM y_direction[1]={state.material.front.ambient};";
     }
-    ctx.code.insert(0, header);
-    ctx.code += "END";
-    return ctx.code;
+    std::string source;
+    source.reserve(header.size() + ctx.code.size() + 3);
+    source += header;
+    source += ctx.code;
+    source += "END";
+    code_buffer = std::move(ctx.code);
+    return source;
 }
 
 } // namespace Shader::Backend::GLASM
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,23 +37,24 @@ public:
 
     template <typename... Args>
     void Add(const char* format_str, IR::Inst& inst, Args&&... args) {
-        code += fmt::format(fmt::runtime(format_str), reg_alloc.Define(inst),
-                            std::forward<Args>(args)...);
+        fmt::format_to(std::back_inserter(code), fmt::runtime(format_str), reg_alloc.Define(inst),
+                       std::forward<Args>(args)...);
         // TODO: Remove this
         code += '\n';
     }
 
     template <typename... Args>
     void LongAdd(const char* format_str, IR::Inst& inst, Args&&... args) {
-        code += fmt::format(fmt::runtime(format_str), reg_alloc.LongDefine(inst),
-                            std::forward<Args>(args)...);
+        fmt::format_to(std::back_inserter(code), fmt::runtime(format_str),
+                       reg_alloc.LongDefine(inst), std::forward<Args>(args)...);
         // TODO: Remove this
         code += '\n';
     }
 
     template <typename... Args>
     void Add(const char* format_str, Args&&... args) {
-        code += fmt::format(fmt::runtime(format_str), std::forward<Args>(args)...);
+        fmt::format_to(std::back_inserter(code), fmt::runtime(format_str),
+                       std::forward<Args>(args)...);
         // TODO: Remove this
         code += '\n';
     }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <iterator>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -12,9 +13,13 @@
 #include "shader_recompiler/backend/glsl/emit_glsl_instructions.h"
 #include "shader_recompiler/backend/glsl/glsl_emit_context.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Backend::GLSL {
 namespace {
+/// Body text of the last shader emitted by the thread, its capacity is reused by the next one
+thread_local std::string code_buffer;
+
 template <class Func>
 struct FuncTraits {};
 
@@ -200,12 +205,12 @@ void DefineVariables(const EmitContext& ctx, std::string& header) {
         const auto precise{!has_precise_bug && IsPreciseType(type) ? "precise " : ""};
         // Temps/return types that are never used are stored at index 0
         if (tracker.uses_temp) {
-            header += fmt::format("{}{} t{}={}(0);", precise, type_name,
-                                  ctx.var_alloc.Representation(0, type), type_name);
+            fmt::format_to(std::back_inserter(header), "{}{} t{}={}(0);", precise, type_name,
+                           ctx.var_alloc.Representation(0, type), type_name);
         }
         for (u32 index = 0; index < tracker.num_used; ++index) {
-            header += fmt::format("{}{} {}={}(0);", precise, type_name,
-                                  ctx.var_alloc.Representation(index, type), type_name);
+            fmt::format_to(std::back_inserter(header), "{}{} {}={}(0);", precise, type_name,
+                           ctx.var_alloc.Representation(index, type), type_name);
         }
     }
     for (u32 i = 0; i < ctx.num_safety_loop_vars; ++i) {
@@ -216,7 +221,10 @@ void DefineVariables(const EmitContext& ctx, std::string& header) {
 
 std::string EmitGLSL(const Profile& profile, const RuntimeInfo& runtime_info, IR::Program& program,
                      Bindings& bindings) {
+    const PassTimer pass_timer{CompilePass::EmitGLSL};
     EmitContext ctx{program, bindings, profile, runtime_info};
+    ctx.code = std::move(code_buffer);
+    ctx.code.clear();
     Precolor(program);
     EmitCode(ctx, program);
     const std::string version{fmt::format("#version 460{}\n", GlslVersionSpecifier(ctx))};
@@ -244,9 +252,13 @@ std::string EmitGLSL(const Profile& profile, const RuntimeInfo& runtime_info, IR
         ctx.header += "bool shfl_in_bounds;";
         ctx.header += "uint shfl_result;";
     }
-    ctx.code.insert(0, ctx.header);
-    ctx.code += '}';
-    return ctx.code;
+    std::string source;
+    source.reserve(ctx.header.size() + ctx.code.size() + 1);
+    source += ctx.header;
+    source += ctx.code;
+    source += '}';
+    code_buffer = std::move(ctx.code);
+    return source;
 }
 
 } // namespace Shader::Backend::GLSL
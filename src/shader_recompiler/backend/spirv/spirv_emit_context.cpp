@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/settings.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/backend/spirv/spirv_emit_context.h"
 
@@ -176,11 +177,13 @@ void DefineGenericOutput(EmitContext& ctx, size_t index, std::optional<u32> invo
             ctx.Decorate(id, spv::Decoration::XfbStride, xfb_varying->stride);
             ctx.Decorate(id, spv::Decoration::Offset, xfb_varying->offset);
         }
-        if (num_components < 4 || element > 0) {
-            const std::string_view subswizzle{swizzle.substr(element, num_components)};
-            ctx.Name(id, fmt::format("out_attr{}_{}", index, subswizzle));
-        } else {
-            ctx.Name(id, fmt::format("out_attr{}", index));
+        if (ctx.emit_debug_names) {
+            if (num_components < 4 || element > 0) {
+                const std::string_view subswizzle{swizzle.substr(element, num_components)};
+                ctx.Name(id, fmt::format("out_attr{}_{}", index, subswizzle));
+            } else {
+                ctx.Name(id, fmt::format("out_attr{}", index));
+            }
         }
         const GenericElementInfo info{
             .id = id,
@@ -257,6 +260,9 @@ std::string_view StageName(Stage stage) {
 
 template <typename... Args>
 void Name(EmitContext& ctx, Id object, std::string_view format_str, Args&&... args) {
+    if (!ctx.emit_debug_names) {
+        return;
+    }
     ctx.Name(object, fmt::format(fmt::runtime(format_str), StageName(ctx.stage),
                                  std::forward<Args>(args)...)
                          .c_str());
@@ -281,7 +287,9 @@ void DefineConstBuffers(EmitContext& ctx, const Info& info, Id UniformDefinition
         const Id id{ctx.AddGlobalVariable(struct_pointer_type, spv::StorageClass::Uniform)};
         ctx.Decorate(id, spv::Decoration::Binding, binding);
         ctx.Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        ctx.Name(id, fmt::format("c{}", desc.index));
+        if (ctx.emit_debug_names) {
+            ctx.Name(id, fmt::format("c{}", desc.index));
+        }
         for (size_t i = 0; i < desc.count; ++i) {
             ctx.cbufs[desc.index + i].*member_type = id;
         }
@@ -311,7 +319,9 @@ void DefineSsbos(EmitContext& ctx, StorageTypeDefinition& type_def,
         const Id id{ctx.AddGlobalVariable(struct_pointer, spv::StorageClass::StorageBuffer)};
         ctx.Decorate(id, spv::Decoration::Binding, binding);
         ctx.Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        ctx.Name(id, fmt::format("ssbo{}", index));
+        if (ctx.emit_debug_names) {
+            ctx.Name(id, fmt::format("ssbo{}", index));
+        }
         if (ctx.profile.supported_spirv >= 0x00010400) {
             ctx.interfaces.push_back(id);
         }
@@ -432,6 +442,24 @@ std::string NameOf(Stage stage, const Desc& desc, std::string_view prefix) {
     }
 }
 
+/// Definition lists of the last context destroyed by the thread, their capacity is reused by the
+/// next shader it emits. The Sirit module itself can't be reset, so it is built again every time.
+struct DefinitionStorage {
+    std::vector<TextureBufferDefinition> texture_buffers;
+    std::vector<ImageBufferDefinition> image_buffers;
+    std::vector<TextureDefinition> textures;
+    std::vector<ImageDefinition> images;
+    std::vector<Id> interfaces;
+};
+thread_local DefinitionStorage definition_storage;
+
+template <typename T>
+std::vector<T> TakeStorage(std::vector<T>& storage) {
+    std::vector<T> result{std::move(storage)};
+    result.clear();
+    return result;
+}
+
 Id DescType(EmitContext& ctx, Id sampled_type, Id pointer_type, u32 count) {
     if (count > 1) {
         const Id array_type{ctx.TypeArray(sampled_type, ctx.Const(count))};
@@ -442,29 +470,35 @@ Id DescType(EmitContext& ctx, Id sampled_type, Id pointer_type, u32 count) {
 }
 } // Anonymous namespace
 
-void VectorTypes::Define(Sirit::Module& sirit_ctx, Id base_type, std::string_view name) {
-    defs[0] = sirit_ctx.Name(base_type, name);
+void VectorTypes::Define(EmitContext& ctx, Id base_type, std::string_view name) {
+    defs[0] = ctx.Name(base_type, name);
 
     std::array<char, 6> def_name;
     for (int i = 1; i < 4; ++i) {
         const std::string_view def_name_view(
             def_name.data(),
             fmt::format_to_n(def_name.data(), def_name.size(), "{}x{}", name, i + 1).size);
-        defs[static_cast<size_t>(i)] =
-            sirit_ctx.Name(sirit_ctx.TypeVector(base_type, i + 1), def_name_view);
+        defs[static_cast<size_t>(i)] = ctx.Name(ctx.TypeVector(base_type, i + 1), def_name_view);
     }
 }
 
 EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_info_,
                          IR::Program& program, Bindings& bindings)
     : Sirit::Module(profile_.supported_spirv), profile{profile_}, runtime_info{runtime_info_},
-      stage{program.stage}, texture_rescaling_index{bindings.texture_scaling_index},
+      stage{program.stage},
+      emit_debug_names{Settings::values.renderer_debug || Settings::values.dump_shaders},
+      texture_rescaling_index{bindings.texture_scaling_index},
       image_rescaling_index{bindings.image_scaling_index} {
     const bool is_unified{profile.unified_descriptor_binding};
     u32& uniform_binding{is_unified ? bindings.unified : bindings.uniform_buffer};
     u32& storage_binding{is_unified ? bindings.unified : bindings.storage_buffer};
     u32& texture_binding{is_unified ? bindings.unified : bindings.texture};
     u32& image_binding{is_unified ? bindings.unified : bindings.image};
+    texture_buffers = TakeStorage(definition_storage.texture_buffers);
+    image_buffers = TakeStorage(definition_storage.image_buffers);
+    textures = TakeStorage(definition_storage.textures);
+    images = TakeStorage(definition_storage.images);
+    interfaces = TakeStorage(definition_storage.interfaces);
     AddCapability(spv::Capability::Shader);
     DefineCommonTypes(program.info);
     DefineCommonConstants();
@@ -486,7 +520,13 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     DefineRenderArea(program.info);
 }
 
-EmitContext::~EmitContext() = default;
+EmitContext::~EmitContext() {
+    definition_storage.texture_buffers = std::move(texture_buffers);
+    definition_storage.image_buffers = std::move(image_buffers);
+    definition_storage.textures = std::move(textures);
+    definition_storage.images = std::move(images);
+    definition_storage.interfaces = std::move(interfaces);
+}
 
 Id EmitContext::Def(const IR::Value& value) {
     if (!value.IsImmediate()) {
@@ -1313,7 +1353,9 @@ void EmitContext::DefineTextureBuffers(const Info& info, u32& binding) {
         const Id id{AddGlobalVariable(type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "texbuf"));
+        if (emit_debug_names) {
+            Name(id, NameOf(stage, desc, "texbuf"));
+        }
         texture_buffers.push_back({
             .id = id,
             .count = desc.count,
@@ -1339,7 +1381,9 @@ void EmitContext::DefineImageBuffers(const Info& info, u32& binding) {
         const Id id{AddGlobalVariable(pointer_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "imgbuf"));
+        if (emit_debug_names) {
+            Name(id, NameOf(stage, desc, "imgbuf"));
+        }
         image_buffers.push_back({
             .id = id,
             .image_type = image_type,
@@ -1363,7 +1407,9 @@ void EmitContext::DefineTextures(const Info& info, u32& binding, u32& scaling_in
         const Id id{AddGlobalVariable(desc_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "tex"));
+        if (emit_debug_names) {
+            Name(id, NameOf(stage, desc, "tex"));
+        }
         textures.push_back({
             .id = id,
             .sampled_type = sampled_type,
@@ -1395,7 +1441,9 @@ void EmitContext::DefineImages(const Info& info, u32& binding, u32& scaling_inde
         const Id id{AddGlobalVariable(pointer_type, spv::StorageClass::UniformConstant)};
         Decorate(id, spv::Decoration::Binding, binding);
         Decorate(id, spv::Decoration::DescriptorSet, 0U);
-        Name(id, NameOf(stage, desc, "img"));
+        if (emit_debug_names) {
+            Name(id, NameOf(stage, desc, "img"));
+        }
         images.push_back({
             .id = id,
             .image_type = image_type,
@@ -1540,7 +1588,9 @@ void EmitContext::DefineInputs(const IR::Program& program) {
         const Id type{GetAttributeType(*this, input_type)};
         const Id id{DefineInput(*this, type, true)};
         Decorate(id, spv::Decoration::Location, static_cast<u32>(index));
-        Name(id, fmt::format("in_attr{}", index));
+        if (emit_debug_names) {
+            Name(id, fmt::format("in_attr{}", index));
+        }
         input_generics[index] = GetAttributeInfo(*this, input_type, id);
 
         if (info.passthrough.Generic(index) && profile.support_geometry_shader_passthrough) {
@@ -1657,7 +1707,9 @@ void EmitContext::DefineOutputs(const IR::Program& program) {
             }
             frag_color[index] = DefineOutput(*this, F32[4], std::nullopt);
             Decorate(frag_color[index], spv::Decoration::Location, index);
-            Name(frag_color[index], fmt::format("frag_color{}", index));
+            if (emit_debug_names) {
+                Name(frag_color[index], fmt::format("frag_color{}", index));
+            }
         }
         if (info.stores_frag_depth) {
             frag_depth = DefineOutput(*this, F32[1], std::nullopt);
@@ -17,9 +17,11 @@ namespace Shader::Backend::SPIRV {
 
 using Sirit::Id;
 
+class EmitContext;
+
 class VectorTypes {
 public:
-    void Define(Sirit::Module& sirit_ctx, Id base_type, std::string_view name);
+    void Define(EmitContext& ctx, Id base_type, std::string_view name);
 
     [[nodiscard]] Id operator[](size_t size) const noexcept {
         return defs[size - 1];
@@ -202,9 +204,20 @@ public:
         return Constant(F32[1], value);
     }
 
+    /// Debug names are only emitted when they can be inspected, skipping them saves a large share
+    /// of the words of small shaders
+    Id Name(Id target, std::string_view name) {
+        return emit_debug_names ? Sirit::Module::Name(target, name) : target;
+    }
+
+    Id MemberName(Id type, u32 member, std::string_view name) {
+        return emit_debug_names ? Sirit::Module::MemberName(type, member, name) : type;
+    }
+
     const Profile& profile;
     const RuntimeInfo& runtime_info;
     Stage stage{};
+    bool emit_debug_names{};
 
     Id void_id{};
     Id U1{};
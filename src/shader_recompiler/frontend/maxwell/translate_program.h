@@ -25,6 +25,12 @@ namespace Shader::Maxwell {
 
 void ConvertLegacyToGeneric(IR::Program& program, const RuntimeInfo& runtime_info);
 
+/// Optimizes the varyings between two consecutive stages of a pipeline. Generics the consumer
+/// doesn't read are no longer stored and the ones stored as constants are folded into the
+/// consumer. Only links a fragment stage to its producer, and must not be used when transform
+/// feedback captures the outputs of the producer.
+void LinkStages(IR::Program& producer, IR::Program& consumer);
+
 // Maxwell v1 and older Nvidia cards don't support setting gl_Layer from non-geometry stages.
 // This creates a workaround by setting the layer as a generic output and creating a
 // passthrough geometry shader that reads the generic and sets the layer.
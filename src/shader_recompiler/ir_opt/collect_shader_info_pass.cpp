@@ -7,6 +7,7 @@
 #include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 #include "shader_recompiler/shader_info.h"
 
 namespace Shader::Optimization {
@@ -943,6 +944,7 @@ void GatherInfoFromHeader(Environment& env, Info& info) {
 } // Anonymous namespace
 
 void CollectShaderInfoPass(Environment& env, IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::CollectShaderInfo};
     Info& info{program.info};
     const u32 base{[&] {
         switch (program.stage) {
@@ -3,10 +3,12 @@
 
 #include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
 void ConditionalBarrierPass(IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::ConditionalBarrier};
     s32 conditional_control_flow_count{0};
     s32 conditional_return_count{0};
     for (IR::AbstractSyntaxNode& node : program.syntax_list) {
@@ -13,6 +13,7 @@
 #include "shader_recompiler/frontend/ir/modifiers.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 namespace {
@@ -1101,6 +1102,7 @@ void ConstantPropagation(Environment& env, IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void ConstantPropagationPass(Environment& env, IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::ConstantPropagation};
     const auto end{program.post_order_blocks.rend()};
     for (auto it = program.post_order_blocks.rbegin(); it != end; ++it) {
         IR::Block* const block{*it};
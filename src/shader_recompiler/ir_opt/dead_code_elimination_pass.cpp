@@ -4,10 +4,12 @@
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
 void DeadCodeEliminationPass(IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::DeadCodeElimination};
     // We iterate over the instructions in reverse order.
     // This is because removing an instruction reduces the number of uses for earlier instructions.
     for (IR::Block* const block : program.post_order_blocks) {
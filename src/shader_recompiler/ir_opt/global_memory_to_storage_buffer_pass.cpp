@@ -13,6 +13,7 @@
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 namespace {
@@ -281,8 +282,25 @@ bool MeetsBias(const StorageBufferAddr& storage_buffer, const Bias& bias) noexce
 struct LowAddrInfo {
     IR::U32 value;
     s32 imm_offset;
+    /// True when the address adds a runtime offset, the low address alone doesn't locate it
+    bool dynamic_offset;
 };
 
+/// Returns true when the instruction may build a GPU pointer out of two 32-bit words
+bool IsAddressBase(const IR::Value& value) {
+    if (value.IsImmediate()) {
+        return false;
+    }
+    switch (value.InstRecursive()->GetOpcode()) {
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::PackUint2x32:
+    case IR::Opcode::CompositeConstructU32x2:
+        return true;
+    default:
+        return false;
+    }
+}
+
 /// Tries to track the first 32-bits of a global memory instruction
 std::optional<LowAddrInfo> TrackLowAddress(IR::Inst* inst) {
     // The first argument is the low level GPU pointer to the global memory instruction
@@ -294,20 +312,25 @@ std::optional<LowAddrInfo> TrackLowAddress(IR::Inst* inst) {
     // This address is expected to either be a PackUint2x32, a IAdd64, or a CompositeConstructU32x2
     IR::Inst* addr_inst{addr.InstRecursive()};
     s32 imm_offset{0};
-    if (addr_inst->GetOpcode() == IR::Opcode::IAdd64) {
-        // If it's an IAdd64, get the immediate offset it is applying and grab the address
-        // instruction. This expects for the instruction to be canonicalized having the address on
-        // the first argument and the immediate offset on the second one.
-        const IR::U64 imm_offset_value{addr_inst->Arg(1)};
-        if (!imm_offset_value.IsImmediate()) {
-            return std::nullopt;
+    bool dynamic_offset{false};
+    while (addr_inst->GetOpcode() == IR::Opcode::IAdd64) {
+        // If it's an IAdd64, get the offset it is applying and grab the address instruction.
+        // Immediates are canonicalized to the second argument, runtime offsets (e.g. an array
+        // index) may be on either side of the address.
+        const IR::U64 lhs{addr_inst->Arg(0)};
+        const IR::U64 rhs{addr_inst->Arg(1)};
+        if (rhs.IsImmediate()) {
+            imm_offset += static_cast<s32>(static_cast<s64>(rhs.U64()));
+        } else {
+            dynamic_offset = true;
         }
-        imm_offset = static_cast<s32>(static_cast<s64>(imm_offset_value.U64()));
-        const IR::U64 iadd_addr{addr_inst->Arg(0)};
-        if (iadd_addr.IsImmediate()) {
+        if (IsAddressBase(lhs)) {
+            addr_inst = lhs.InstRecursive();
+        } else if (!rhs.IsImmediate() && IsAddressBase(rhs)) {
+            addr_inst = rhs.InstRecursive();
+        } else {
             return std::nullopt;
         }
-        addr_inst = iadd_addr.InstRecursive();
     }
     // With IAdd64 handled, now PackUint2x32 is expected
     if (addr_inst->GetOpcode() == IR::Opcode::PackUint2x32) {
@@ -326,6 +349,7 @@ std::optional<LowAddrInfo> TrackLowAddress(IR::Inst* inst) {
     return LowAddrInfo{
         .value{IR::U32{addr_inst->Arg(0)}},
         .imm_offset = imm_offset,
+        .dynamic_offset = dynamic_offset,
     };
 }
 
@@ -412,7 +436,8 @@ void CollectStorageBuffers(IR::Block& block, IR::Inst& inst, StorageInfo& info)
 IR::U32 StorageOffset(IR::Block& block, IR::Inst& inst, StorageBufferAddr buffer, u32 alignment) {
     IR::IREmitter ir{block, IR::Block::InstructionList::s_iterator_to(inst)};
     IR::U32 offset;
-    if (const std::optional<LowAddrInfo> low_addr{TrackLowAddress(&inst)}) {
+    const std::optional<LowAddrInfo> low_addr{TrackLowAddress(&inst)};
+    if (low_addr && !low_addr->dynamic_offset) {
         offset = low_addr->value;
         if (low_addr->imm_offset != 0) {
             offset = ir.IAdd(offset, ir.Imm32(low_addr->imm_offset));
@@ -521,6 +546,7 @@ void Replace(IR::Block& block, IR::Inst& inst, const IR::U32& storage_index,
 } // Anonymous namespace
 
 void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateInfo& host_info) {
+    const PassTimer pass_timer{CompilePass::GlobalMemoryToStorageBuffer};
     StorageInfo info;
     for (IR::Block* const block : program.post_order_blocks) {
         for (IR::Inst& inst : block->Instructions()) {
@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <bit>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/metrics.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
+
+namespace Shader::Optimization {
+namespace {
+enum class Availability {
+    /// The instruction can't be numbered
+    None,
+    /// The result only depends on the arguments, it is available in every dominated block
+    Global,
+    /// The result depends on memory, it is available until the next side effect in the block
+    Block,
+};
+
+bool IsInRange(IR::Opcode op, IR::Opcode first, IR::Opcode last) {
+    return op >= first && op <= last;
+}
+
+Availability AvailabilityOf(const IR::Inst& inst) {
+    // Pseudo-operations are tied to their producer, they can't be shared between instructions
+    if (inst.HasAssociatedPseudoOperation()) {
+        return Availability::None;
+    }
+    const IR::Opcode op{inst.GetOpcode()};
+    // The ranges follow the sections of opcodes.inc. Warp operations and derivatives are left out,
+    // their results depend on the invocations active at the point they are executed.
+    if (IsInRange(op, IR::Opcode::CompositeConstructU32x2, IR::Opcode::UnpackDouble2x32) ||
+        IsInRange(op, IR::Opcode::FPAbs16, IR::Opcode::UGreaterThanEqual) ||
+        IsInRange(op, IR::Opcode::LogicalOr, IR::Opcode::ConvertF64U64) ||
+        IsInRange(op, IR::Opcode::GetCbufU8, IR::Opcode::GetCbufU32x2)) {
+        return Availability::Global;
+    }
+    if (IsInRange(op, IR::Opcode::LoadGlobalU8, IR::Opcode::LoadGlobal128) ||
+        IsInRange(op, IR::Opcode::LoadStorageU8, IR::Opcode::LoadStorage128) ||
+        IsInRange(op, IR::Opcode::LoadSharedU8, IR::Opcode::LoadSharedU128)) {
+        return Availability::Block;
+    }
+    switch (op) {
+    case IR::Opcode::LoadLocal:
+    case IR::Opcode::GetAttribute:
+    case IR::Opcode::GetAttributeU32:
+    case IR::Opcode::GetPatch:
+        return Availability::Block;
+    default:
+        return Availability::None;
+    }
+}
+
+bool IsCommutative(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalXor:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t HashValue(const IR::Value& value) {
+    if (!value.IsImmediate()) {
+        return std::hash<const IR::Inst*>{}(value.InstRecursive());
+    }
+    const IR::Value resolved{value.Resolve()};
+    const size_t type{static_cast<size_t>(resolved.Type())};
+    switch (resolved.Type()) {
+    case IR::Type::U1:
+        return type ^ static_cast<size_t>(resolved.U1());
+    case IR::Type::U32:
+        return type ^ (static_cast<size_t>(resolved.U32()) << 8);
+    case IR::Type::F32:
+        return type ^ (static_cast<size_t>(std::bit_cast<u32>(resolved.F32())) << 8);
+    case IR::Type::U64:
+        return type ^ std::hash<u64>{}(resolved.U64());
+    case IR::Type::Attribute:
+        return type ^ (static_cast<size_t>(resolved.Attribute()) << 8);
+    default:
+        // Collisions are resolved by comparing the values
+        return type;
+    }
+}
+
+struct InstHash {
+    size_t operator()(const IR::Inst* inst) const {
+        const size_t num_args{inst->NumArgs()};
+        size_t hash{static_cast<size_t>(inst->GetOpcode()) ^ (inst->Flags<u32>() * 31ULL)};
+        if (IsCommutative(inst->GetOpcode())) {
+            // Symmetric combination, the operands may be swapped
+            return hash ^ (HashValue(inst->Arg(0)) + HashValue(inst->Arg(1)));
+        }
+        for (size_t arg = 0; arg < num_args; ++arg) {
+            hash = (hash * 0x9E3779B97F4A7C15ULL) ^ HashValue(inst->Arg(arg));
+        }
+        return hash;
+    }
+};
+
+struct InstEqual {
+    bool operator()(const IR::Inst* lhs, const IR::Inst* rhs) const {
+        if (lhs->GetOpcode() != rhs->GetOpcode() || lhs->Flags<u32>() != rhs->Flags<u32>()) {
+            return false;
+        }
+        const auto arg{[](const IR::Inst* inst, size_t index) {
+            return inst->Arg(index).Resolve();
+        }};
+        if (IsCommutative(lhs->GetOpcode()) && arg(lhs, 0) == arg(rhs, 1) &&
+            arg(lhs, 1) == arg(rhs, 0)) {
+            return true;
+        }
+        const size_t num_args{lhs->NumArgs()};
+        for (size_t index = 0; index < num_args; ++index) {
+            if (arg(lhs, index) != arg(rhs, index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+using InstSet = std::unordered_set<IR::Inst*, InstHash, InstEqual>;
+
+using DominatorTree = std::unordered_map<const IR::Block*, std::vector<IR::Block*>>;
+
+/// Builds the dominator tree with the algorithm from "A Simple, Fast Dominance Algorithm"
+DominatorTree BuildDominatorTree(const IR::Program& program) {
+    const IR::BlockList& post_order{program.post_order_blocks};
+    std::unordered_map<const IR::Block*, size_t> post_order_index;
+    for (size_t index = 0; index < post_order.size(); ++index) {
+        post_order_index.emplace(post_order[index], index);
+    }
+    constexpr size_t UNDEFINED{~size_t{0}};
+    const size_t entry{post_order.size() - 1};
+    std::vector<size_t> idoms(post_order.size(), UNDEFINED);
+    idoms[entry] = entry;
+
+    const auto intersect{[&](size_t lhs, size_t rhs) {
+        while (lhs != rhs) {
+            while (lhs < rhs) {
+                lhs = idoms[lhs];
+            }
+            while (rhs < lhs) {
+                rhs = idoms[rhs];
+            }
+        }
+        return lhs;
+    }};
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        // Reverse post order, skipping the entry block
+        for (size_t index = entry; index-- > 0;) {
+            size_t new_idom{UNDEFINED};
+            for (const IR::Block* const pred : post_order[index]->ImmPredecessors()) {
+                const auto it{post_order_index.find(pred)};
+                if (it == post_order_index.end() || idoms[it->second] == UNDEFINED) {
+                    continue;
+                }
+                new_idom = new_idom == UNDEFINED ? it->second : intersect(it->second, new_idom);
+            }
+            if (new_idom != idoms[index]) {
+                idoms[index] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    DominatorTree tree;
+    // Children are pushed in reverse post order, so a preorder walk visits definitions first
+    for (size_t index = entry; index-- > 0;) {
+        if (idoms[index] != UNDEFINED) {
+            tree[post_order[idoms[index]]].push_back(post_order[index]);
+        }
+    }
+    return tree;
+}
+
+size_t NumberBlock(IR::Block& block, InstSet& available, std::vector<IR::Inst*>& scope_insts) {
+    InstSet block_available;
+    size_t num_removed{};
+    for (IR::Inst& inst : block.Instructions()) {
+        if (inst.MayHaveSideEffects()) {
+            // Memory may have been written, reload it
+            block_available.clear();
+            continue;
+        }
+        const Availability availability{AvailabilityOf(inst)};
+        if (availability == Availability::None) {
+            continue;
+        }
+        InstSet& set{availability == Availability::Global ? available : block_available};
+        const auto [it, inserted]{set.insert(&inst)};
+        if (inserted) {
+            if (availability == Availability::Global) {
+                scope_insts.push_back(&inst);
+            }
+            continue;
+        }
+        inst.ReplaceUsesWith(IR::Value{*it});
+        ++num_removed;
+    }
+    return num_removed;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    static auto& removed_insts = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_shader_gvn_removed_insts_total",
+        "Shader instructions replaced by an equivalent dominating instruction");
+
+    if (program.post_order_blocks.empty()) {
+        return;
+    }
+    const PassTimer pass_timer{CompilePass::GlobalValueNumbering};
+    const DominatorTree tree{BuildDominatorTree(program)};
+
+    struct Frame {
+        IR::Block* block;
+        size_t next_child;
+        size_t scope_begin;
+    };
+    InstSet available;
+    std::vector<IR::Inst*> scope_insts;
+    boost::container::small_vector<Frame, 16> stack;
+    size_t num_removed{};
+
+    const auto enter{[&](IR::Block* block) {
+        const size_t scope_begin{scope_insts.size()};
+        num_removed += NumberBlock(*block, available, scope_insts);
+        stack.push_back(Frame{block, 0, scope_begin});
+    }};
+    enter(program.post_order_blocks.back());
+    while (!stack.empty()) {
+        Frame& frame{stack.back()};
+        const auto it{tree.find(frame.block)};
+        if (it != tree.end() && frame.next_child < it->second.size()) {
+            enter(it->second[frame.next_child++]);
+            continue;
+        }
+        // Values defined in this block don't dominate its siblings
+        for (size_t index = scope_insts.size(); index > frame.scope_begin; --index) {
+            available.erase(scope_insts[index - 1]);
+        }
+        scope_insts.resize(frame.scope_begin);
+        stack.pop_back();
+    }
+    if (num_removed == 0) {
+        return;
+    }
+    removed_insts.Increment(num_removed);
+    IdentityRemovalPass(program);
+}
+
+} // namespace Shader::Optimization
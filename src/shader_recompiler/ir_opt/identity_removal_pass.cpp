@@ -6,10 +6,12 @@
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
 void IdentityRemovalPass(IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::IdentityRemoval};
     std::vector<IR::Inst*> to_invalidate;
     for (IR::Block* const block : program.blocks) {
         for (auto inst = block->begin(); inst != block->end();) {
@@ -13,6 +13,7 @@
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 #include "shader_recompiler/shader_info.h"
 
 namespace Shader::Optimization {
@@ -39,6 +40,7 @@ static bool PermittedProgramStage(Stage stage) {
 }
 
 void LayerPass(IR::Program& program, const HostTranslateInfo& host_info) {
+    const PassTimer pass_timer{CompilePass::Layer};
     if (host_info.support_viewport_index_layer || !PermittedProgramStage(program.stage)) {
         return;
     }
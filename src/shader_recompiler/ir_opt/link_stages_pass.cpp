@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <bit>
+#include <optional>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t NUM_GENERIC_COMPONENTS = IR::NUM_GENERICS * 4;
+
+size_t GenericComponent(IR::Attribute attribute) {
+    return static_cast<size_t>(attribute) - static_cast<size_t>(IR::Attribute::Generic0X);
+}
+
+IR::Attribute GenericAttribute(size_t component) {
+    return IR::Attribute::Generic0X + component;
+}
+
+bool CanLink(const IR::Program& producer, const IR::Program& consumer) {
+    if (consumer.stage != Stage::Fragment) {
+        return false;
+    }
+    if (producer.stage != Stage::VertexB && producer.stage != Stage::TessellationEval) {
+        return false;
+    }
+    // Indexed accesses may touch any generic, and legacy varyings are assigned to the generics
+    // left unused by the producer later on
+    return !producer.info.stores_indexed_attributes && !consumer.info.loads_indexed_attributes &&
+           !producer.info.stores.Legacy() && !consumer.info.loads.Legacy();
+}
+
+struct StoredValue {
+    bool is_constant{true};
+    /// Bits of the stored value, floats are compared bitwise as the generic may hold an integer
+    std::optional<u32> value;
+};
+
+/// Finds the generic components the producer always stores the same immediate to
+std::array<StoredValue, NUM_GENERIC_COMPONENTS> FindConstantStores(const IR::Program& producer) {
+    std::array<StoredValue, NUM_GENERIC_COMPONENTS> stores{};
+    for (const IR::Block* const block : producer.post_order_blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            if (inst.GetOpcode() != IR::Opcode::SetAttribute) {
+                continue;
+            }
+            const IR::Attribute attribute{inst.Arg(0).Attribute()};
+            if (!IR::IsGeneric(attribute)) {
+                continue;
+            }
+            StoredValue& stored{stores[GenericComponent(attribute)]};
+            const IR::Value value{inst.Arg(1)};
+            if (!value.IsImmediate()) {
+                stored.is_constant = false;
+                continue;
+            }
+            const u32 bits{std::bit_cast<u32>(value.F32())};
+            if (stored.value && *stored.value != bits) {
+                stored.is_constant = false;
+                continue;
+            }
+            stored.value = bits;
+        }
+    }
+    return stores;
+}
+
+/// Replaces the loads of generics the producer stores a constant to with the constant
+bool PropagateConstants(const IR::Program& producer, IR::Program& consumer) {
+    const auto stores{FindConstantStores(producer)};
+    std::array<bool, NUM_GENERIC_COMPONENTS> replaced{};
+    std::array<bool, NUM_GENERIC_COMPONENTS> still_loaded{};
+    for (IR::Block* const block : consumer.post_order_blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            const IR::Opcode opcode{inst.GetOpcode()};
+            if (opcode != IR::Opcode::GetAttribute && opcode != IR::Opcode::GetAttributeU32) {
+                continue;
+            }
+            const IR::Attribute attribute{inst.Arg(0).Attribute()};
+            if (!IR::IsGeneric(attribute)) {
+                continue;
+            }
+            const size_t component{GenericComponent(attribute)};
+            const StoredValue& stored{stores[component]};
+            if (opcode != IR::Opcode::GetAttribute || !stored.is_constant || !stored.value) {
+                still_loaded[component] = true;
+                continue;
+            }
+            inst.ReplaceUsesWith(IR::Value{std::bit_cast<f32>(*stored.value)});
+            replaced[component] = true;
+        }
+    }
+    bool changed{false};
+    for (size_t component = 0; component < NUM_GENERIC_COMPONENTS; ++component) {
+        if (replaced[component] && !still_loaded[component]) {
+            consumer.info.loads.Set(GenericAttribute(component), false);
+        }
+        changed |= replaced[component];
+    }
+    return changed;
+}
+
+/// Removes the stores of generic components the consumer does not load
+bool RemoveUnusedStores(IR::Program& producer, const IR::Program& consumer) {
+    bool changed{false};
+    for (IR::Block* const block : producer.post_order_blocks) {
+        auto& instructions{block->Instructions()};
+        for (auto it = instructions.begin(); it != instructions.end();) {
+            if (it->GetOpcode() != IR::Opcode::SetAttribute) {
+                ++it;
+                continue;
+            }
+            const IR::Attribute attribute{it->Arg(0).Attribute()};
+            if (!IR::IsGeneric(attribute) || consumer.info.loads[attribute]) {
+                ++it;
+                continue;
+            }
+            producer.info.stores.Set(attribute, false);
+            it->Invalidate();
+            it = instructions.erase(it);
+            changed = true;
+        }
+    }
+    return changed;
+}
+} // Anonymous namespace
+
+void LinkStagesPass(IR::Program& producer, IR::Program& consumer) {
+    if (!CanLink(producer, consumer)) {
+        return;
+    }
+    const PassTimer pass_timer{CompilePass::LinkStages};
+    if (PropagateConstants(producer, consumer)) {
+        IdentityRemovalPass(consumer);
+        DeadCodeEliminationPass(consumer);
+    }
+    if (RemoveUnusedStores(producer, consumer)) {
+        DeadCodeEliminationPass(producer);
+    }
+}
+
+} // namespace Shader::Optimization
@@ -7,6 +7,7 @@
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
@@ -20,6 +21,7 @@ using PositionInstVector = boost::container::small_vector<PositionInst, 24>;
 } // Anonymous namespace
 
 void PositionPass(Environment& env, IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::Position};
     if (env.ShaderStage() != Stage::VertexB || env.ReadViewportTransformState()) {
         return;
     }
@@ -8,6 +8,7 @@
 #include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 #include "shader_recompiler/shader_info.h"
 
 namespace Shader::Optimization {
@@ -337,6 +338,7 @@ void Visit(const IR::Program& program, IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void RescalingPass(IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::Rescaling};
     const bool is_fragment_shader{program.stage == Stage::Fragment};
     if (is_fragment_shader) {
         for (IR::Block* const block : program.post_order_blocks) {
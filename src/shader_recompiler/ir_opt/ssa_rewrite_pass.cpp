@@ -15,17 +15,21 @@
 
 #include <deque>
 #include <map>
+#include <memory_resource>
 #include <span>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/opcodes.h"
 #include "shader_recompiler/frontend/ir/pred.h"
 #include "shader_recompiler/frontend/ir/reg.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 namespace {
@@ -52,9 +56,20 @@ struct IndirectBranchVariable {
 
 using Variant = std::variant<IR::Reg, IR::Pred, ZeroFlagTag, SignFlagTag, CarryFlagTag,
                              OverflowFlagTag, GotoVariable, IndirectBranchVariable>;
-using ValueMap = std::unordered_map<IR::Block*, IR::Value>;
+using ValueMap = std::pmr::unordered_map<IR::Block*, IR::Value>;
+
+template <size_t... indices>
+std::array<ValueMap, sizeof...(indices)> MakeValueMaps(std::pmr::memory_resource* resource,
+                                                       std::index_sequence<indices...>) {
+    return {((void)indices, ValueMap{resource})...};
+}
 
 struct DefTable {
+    explicit DefTable(std::pmr::memory_resource* resource)
+        : preds{MakeValueMaps(resource, std::make_index_sequence<IR::NUM_USER_PREDS>{})},
+          goto_vars{resource}, indirect_branch_var{resource}, zero_flag{resource},
+          sign_flag{resource}, carry_flag{resource}, overflow_flag{resource} {}
+
     const IR::Value& Def(IR::Block* block, IR::Reg variable) {
         return block->SsaRegValue(variable);
     }
@@ -112,7 +127,7 @@ struct DefTable {
     }
 
     std::array<ValueMap, IR::NUM_USER_PREDS> preds;
-    std::unordered_map<u32, ValueMap> goto_vars;
+    std::pmr::unordered_map<u32, ValueMap> goto_vars;
     ValueMap indirect_branch_var;
     ValueMap zero_flag;
     ValueMap sign_flag;
@@ -158,6 +173,9 @@ struct ReadState {
 
 class Pass {
 public:
+    explicit Pass(std::pmr::memory_resource* resource)
+        : incomplete_phis{resource}, current_def{resource} {}
+
     template <typename Type>
     void WriteVariable(Type variable, IR::Block* block, const IR::Value& value) {
         current_def.SetDef(block, variable, value);
@@ -274,28 +292,23 @@ private:
             }
             same = op;
         }
-        // Remove the phi node from the block, it will be reinserted
-        IR::Block::InstructionList& list{block->Instructions()};
-        list.erase(IR::Block::InstructionList::s_iterator_to(phi));
-
-        // Find the first non-phi instruction and use it as an insertion point
-        IR::Block::iterator reinsert_point{std::ranges::find_if_not(list, IR::IsPhi)};
         if (same.IsEmpty()) {
             // The phi is unreachable or in the start block
-            // Insert an undefined instruction and make it the phi node replacement
-            // The "phi" node reinsertion point is specified after this instruction
-            reinsert_point = block->PrependNewInst(reinsert_point, undef_opcode);
-            same = IR::Value{&*reinsert_point};
-            ++reinsert_point;
+            // Insert an undefined instruction after the phis and make it the phi node replacement
+            const auto is_phi{[](const IR::Inst& inst) {
+                return IR::IsPhi(inst) || inst.GetOpcode() == IR::Opcode::Identity;
+            }};
+            const auto insert_point{std::ranges::find_if_not(block->Instructions(), is_phi)};
+            same = IR::Value{&*block->PrependNewInst(insert_point, undef_opcode)};
         }
-        // Reinsert the phi node and reroute all its uses to the "same" value
-        list.insert(reinsert_point, phi);
+        // The phi is left in place as an identity, identities are removed after the construction
+        // Moving it past the other phis of the block is quadratic on large blocks
         phi.ReplaceUsesWith(same);
-        // TODO: Try to recursively remove all phi users, which might have become trivial
+        // Phi users that might have become trivial are removed after the construction
         return same;
     }
 
-    std::unordered_map<IR::Block*, std::map<Variant, IR::Inst*>> incomplete_phis;
+    std::pmr::unordered_map<IR::Block*, std::pmr::map<Variant, IR::Inst*>> incomplete_phis;
     DefTable current_def;
 };
 
@@ -370,7 +383,7 @@ void VisitBlock(Pass& pass, IR::Block* block) {
 }
 
 IR::Type GetConcreteType(IR::Inst* inst) {
-    std::deque<IR::Inst*> queue;
+    std::pmr::deque<IR::Inst*> queue{CompileArena()};
     queue.push_back(inst);
     while (!queue.empty()) {
         IR::Inst* current = queue.front();
@@ -388,14 +401,81 @@ IR::Type GetConcreteType(IR::Inst* inst) {
     }
     return IR::Type::Opaque;
 }
+
+bool IsTrivialPhi(IR::Inst& phi, IR::Value& same) {
+    const size_t num_args{phi.NumArgs()};
+    for (size_t arg_index = 0; arg_index < num_args; ++arg_index) {
+        const IR::Value op{phi.Arg(arg_index).Resolve()};
+        if (op == same || op == IR::Value{&phi}) {
+            continue;
+        }
+        if (!same.IsEmpty()) {
+            return false;
+        }
+        same = op;
+    }
+    return !same.IsEmpty();
+}
+
+/// Replaces the phis that merge a single value with it.
+/// The construction doesn't revisit the users of the phis it removes, so removing one here queues
+/// the phis using it again, which is linear in the number of phi operands. Goto variables read far
+/// from their last definition leave many of these.
+void RemoveTrivialPhis(IR::Program& program) {
+    std::pmr::unordered_map<IR::Inst*, std::pmr::vector<IR::Inst*>> phi_users{CompileArena()};
+    std::pmr::vector<IR::Inst*> worklist{CompileArena()};
+    for (IR::Block* const block : program.blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            if (inst.GetOpcode() == IR::Opcode::Phi) {
+                worklist.push_back(&inst);
+            }
+        }
+    }
+    phi_users.reserve(worklist.size());
+    for (IR::Inst* const phi : worklist) {
+        const size_t num_args{phi->NumArgs()};
+        for (size_t arg_index = 0; arg_index < num_args; ++arg_index) {
+            const IR::Value arg{phi->Arg(arg_index).Resolve()};
+            if (arg.IsPhi()) {
+                phi_users[arg.Inst()].push_back(phi);
+            }
+        }
+    }
+    while (!worklist.empty()) {
+        IR::Inst* const phi{worklist.back()};
+        worklist.pop_back();
+        IR::Value same;
+        if (phi->GetOpcode() != IR::Opcode::Phi || !IsTrivialPhi(*phi, same)) {
+            continue;
+        }
+        phi->ReplaceUsesWith(same);
+
+        const auto it{phi_users.find(phi)};
+        if (it == phi_users.end()) {
+            continue;
+        }
+        std::pmr::vector<IR::Inst*> users{std::move(it->second)};
+        phi_users.erase(it);
+        worklist.insert(worklist.end(), users.begin(), users.end());
+        if (same.IsPhi()) {
+            // The users now read the replacement, so they depend on it staying non-trivial
+            auto& same_users{phi_users[same.Inst()]};
+            same_users.insert(same_users.end(), users.begin(), users.end());
+        }
+    }
+}
 } // Anonymous namespace
 
 void SsaRewritePass(IR::Program& program) {
-    Pass pass;
+    const PassTimer pass_timer{CompilePass::SsaRewrite};
+    CompileArenaScope arena_scope;
+    Pass pass{CompileArena()};
     const auto end{program.post_order_blocks.rend()};
     for (auto block = program.post_order_blocks.rbegin(); block != end; ++block) {
         VisitBlock(pass, *block);
     }
+    RemoveTrivialPhis(program);
+    IdentityRemovalPass(program);
     for (auto block = program.post_order_blocks.rbegin(); block != end; ++block) {
         for (IR::Inst& inst : (*block)->Instructions()) {
             if (inst.GetOpcode() == IR::Opcode::Phi) {
@@ -5,6 +5,7 @@
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
@@ -63,6 +64,7 @@ void AddingByteSwapsWorkaround(IR::Block& block, IR::Inst& inst) {
 } // Anonymous namespace
 
 void VendorWorkaroundPass(IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::VendorWorkaround};
     for (IR::Block* const block : program.post_order_blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             switch (inst.GetOpcode()) {
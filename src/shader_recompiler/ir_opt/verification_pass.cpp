@@ -8,6 +8,7 @@
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/pass_timings.h"
 
 namespace Shader::Optimization {
 
@@ -88,6 +89,7 @@ static void ValidatePhiNodes(const IR::Program& program) {
 }
 
 void VerificationPass(const IR::Program& program) {
+    const PassTimer pass_timer{CompilePass::Verification};
     ValidateTypes(program);
     ValidateUses(program);
     ValidateForwardDeclarations(program);
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#include "shader_recompiler/pass_timings.h"
+
+namespace Shader {
+namespace {
+thread_local PassTimings* current_timings{};
+} // Anonymous namespace
+
+std::string_view NameOf(CompilePass pass) noexcept {
+    switch (pass) {
+    case CompilePass::BuildASL:
+        return "BuildASL";
+    case CompilePass::LowerFp64ToFp32:
+        return "LowerFp64ToFp32";
+    case CompilePass::LowerFp16ToFp32:
+        return "LowerFp16ToFp32";
+    case CompilePass::LowerInt64ToInt32:
+        return "LowerInt64ToInt32";
+    case CompilePass::ConditionalBarrier:
+        return "ConditionalBarrier";
+    case CompilePass::SsaRewrite:
+        return "SsaRewrite";
+    case CompilePass::ConstantPropagation:
+        return "ConstantPropagation";
+    case CompilePass::Position:
+        return "Position";
+    case CompilePass::GlobalMemoryToStorageBuffer:
+        return "GlobalMemoryToStorageBuffer";
+    case CompilePass::Texture:
+        return "Texture";
+    case CompilePass::Rescaling:
+        return "Rescaling";
+    case CompilePass::GlobalValueNumbering:
+        return "GlobalValueNumbering";
+    case CompilePass::DeadCodeElimination:
+        return "DeadCodeElimination";
+    case CompilePass::IdentityRemoval:
+        return "IdentityRemoval";
+    case CompilePass::Verification:
+        return "Verification";
+    case CompilePass::CollectShaderInfo:
+        return "CollectShaderInfo";
+    case CompilePass::Layer:
+        return "Layer";
+    case CompilePass::VendorWorkaround:
+        return "VendorWorkaround";
+    case CompilePass::DualVertex:
+        return "DualVertex";
+    case CompilePass::LinkStages:
+        return "LinkStages";
+    case CompilePass::EmitSPIRV:
+        return "EmitSPIRV";
+    case CompilePass::EmitGLSL:
+        return "EmitGLSL";
+    case CompilePass::EmitGLASM:
+        return "EmitGLASM";
+    case CompilePass::Count:
+        break;
+    }
+    return "Invalid";
+}
+
+PassTimingsScope::PassTimingsScope(PassTimings& timings) noexcept
+    : previous{std::exchange(current_timings, &timings)} {}
+
+PassTimingsScope::~PassTimingsScope() {
+    current_timings = previous;
+}
+
+PassTimer::PassTimer(CompilePass pass_) noexcept : timings{current_timings}, pass{pass_} {
+    if (timings) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+PassTimer::~PassTimer() {
+    if (!timings) {
+        return;
+    }
+    const auto elapsed{std::chrono::steady_clock::now() - start};
+    timings->ns[static_cast<size_t>(pass)] += static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+} // namespace Shader
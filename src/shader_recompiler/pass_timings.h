@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Shader {
+
+enum class CompilePass : u32 {
+    BuildASL,
+    LowerFp64ToFp32,
+    LowerFp16ToFp32,
+    LowerInt64ToInt32,
+    ConditionalBarrier,
+    SsaRewrite,
+    ConstantPropagation,
+    Position,
+    GlobalMemoryToStorageBuffer,
+    Texture,
+    Rescaling,
+    GlobalValueNumbering,
+    DeadCodeElimination,
+    IdentityRemoval,
+    Verification,
+    CollectShaderInfo,
+    Layer,
+    VendorWorkaround,
+    DualVertex,
+    LinkStages,
+    EmitSPIRV,
+    EmitGLSL,
+    EmitGLASM,
+    Count,
+};
+
+constexpr size_t NUM_COMPILE_PASSES = static_cast<size_t>(CompilePass::Count);
+
+[[nodiscard]] std::string_view NameOf(CompilePass pass) noexcept;
+
+/// Time spent in each pass of the recompiler, in nanoseconds
+struct PassTimings {
+    PassTimings& operator+=(const PassTimings& rhs) noexcept {
+        for (size_t pass = 0; pass < NUM_COMPILE_PASSES; ++pass) {
+            ns[pass] += rhs.ns[pass];
+        }
+        return *this;
+    }
+
+    [[nodiscard]] u64 Total() const noexcept {
+        u64 total{};
+        for (const u64 value : ns) {
+            total += value;
+        }
+        return total;
+    }
+
+    std::array<u64, NUM_COMPILE_PASSES> ns{};
+};
+
+/// Directs the pass timers of the calling thread to the given timings while alive
+class PassTimingsScope {
+public:
+    explicit PassTimingsScope(PassTimings& timings) noexcept;
+    ~PassTimingsScope();
+
+    PassTimingsScope(const PassTimingsScope&) = delete;
+    PassTimingsScope& operator=(const PassTimingsScope&) = delete;
+
+private:
+    PassTimings* previous;
+};
+
+/// Adds its lifetime to a pass, does nothing when the thread is not inside a PassTimingsScope
+class PassTimer {
+public:
+    explicit PassTimer(CompilePass pass_) noexcept;
+    ~PassTimer();
+
+    PassTimer(const PassTimer&) = delete;
+    PassTimer& operator=(const PassTimer&) = delete;
+
+private:
+    PassTimings* timings;
+    CompilePass pass;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace Shader
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/opus/work_buffer_pool.h"
+#include "audio_core/renderer/command/data_source/decode.h"
+#include "common/common_types.h"
+
+namespace {
+using AudioCore::OpusDecoder::WorkBufferPool;
+using AudioCore::Renderer::AdpcmFrameSize;
+using AudioCore::Renderer::AdpcmSamplesPerFrame;
+
+/// The standard DSP-ADPCM coefficients
+constexpr std::array<s16, 16> COEFFICIENTS{
+    0x04AB, -0x0344, 0x0789, -0x0123, 0x0910, -0x02F0, 0x0200, 0x0000,
+    0x0F00, -0x0700, 0x0700, -0x0200, 0x0C00, -0x0500, 0x0600, -0x0100,
+};
+
+/// Work buffer size of a stereo decoder with large frames
+constexpr u64 WORK_BUFFER_SIZE = 0xA000;
+
+/// Decodes a frame a sample at a time, like DecodeAdpcm did before it decoded whole frames
+void DecodeAdpcmFrameReference(std::span<s16> out, std::span<const u8> frame, s16& yn0,
+                               s16& yn1) {
+    static constexpr std::array<s32, 16> Steps{
+        0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1,
+    };
+    const u32 coeff_index = (frame[0] >> 4) & 0xF;
+    const s32 scale = frame[0] & 0xF;
+    const s32 coeff0 = COEFFICIENTS[coeff_index * 2 + 0];
+    const s32 coeff1 = COEFFICIENTS[coeff_index * 2 + 1];
+    for (u32 i = 0; i < AdpcmSamplesPerFrame; i++) {
+        const u8 byte = frame[1 + i / 2];
+        const s32 code = Steps[i % 2 == 0 ? byte >> 4 : byte & 0xF];
+        const s32 prediction = coeff0 * yn0 + coeff1 * yn1;
+        const s32 sample = ((code * (1 << scale) << 11) + 0x400 + prediction) >> 11;
+        yn1 = yn0;
+        yn0 = static_cast<s16>(std::clamp<s32>(sample, -0x8000, 0x7FFF));
+        out[i] = yn0;
+    }
+}
+
+/// Returns frames with random nibbles, using the first 8 coefficient pairs and every scale
+std::vector<u8> RandomFrames(size_t frame_count) {
+    std::mt19937 rng{static_cast<u32>(frame_count)};
+    std::vector<u8> frames(frame_count * AdpcmFrameSize);
+    for (size_t i = 0; i < frames.size(); i++) {
+        frames[i] = static_cast<u8>(rng());
+        if (i % AdpcmFrameSize == 0) {
+            frames[i] &= 0x7F;
+        }
+    }
+    return frames;
+}
+
+s16 DecodeFrames(std::span<const u8> frames, std::span<s16> out) {
+    s16 yn0 = 0;
+    s16 yn1 = 0;
+    for (size_t i = 0; i < frames.size() / AdpcmFrameSize; i++) {
+        AudioCore::Renderer::DecodeAdpcmFrame(
+            out.subspan(i * AdpcmSamplesPerFrame).first<AdpcmSamplesPerFrame>(),
+            frames.subspan(i * AdpcmFrameSize).first<AdpcmFrameSize>(), COEFFICIENTS, yn0, yn1);
+    }
+    return yn0;
+}
+} // Anonymous namespace
+
+TEST_CASE("Decode[AdpcmFrame]", "[audio_core]") {
+    constexpr size_t FrameCount = 4096;
+    const std::vector<u8> frames = RandomFrames(FrameCount);
+    std::vector<s16> output(FrameCount * AdpcmSamplesPerFrame);
+    std::vector<s16> expected(FrameCount * AdpcmSamplesPerFrame);
+
+    // Start from saturated history too, so the predictor overflows the s16 range.
+    for (const s16 history : {s16{0}, s16{0x7FFF}, s16{-0x8000}}) {
+        s16 yn0 = history;
+        s16 yn1 = history;
+        s16 expected_yn0 = history;
+        s16 expected_yn1 = history;
+        for (size_t i = 0; i < FrameCount; i++) {
+            const auto frame = std::span(frames).subspan(i * AdpcmFrameSize);
+            const auto out = std::span(output).subspan(i * AdpcmSamplesPerFrame);
+            const auto expected_out = std::span(expected).subspan(i * AdpcmSamplesPerFrame);
+            AudioCore::Renderer::DecodeAdpcmFrame(out.first<AdpcmSamplesPerFrame>(),
+                                                  frame.first<AdpcmFrameSize>(), COEFFICIENTS,
+                                                  yn0, yn1);
+            DecodeAdpcmFrameReference(expected_out, frame, expected_yn0, expected_yn1);
+        }
+        REQUIRE(output == expected);
+        REQUIRE(yn0 == expected_yn0);
+        REQUIRE(yn1 == expected_yn1);
+    }
+}
+
+TEST_CASE("Decode[OpusWorkBufferPool]", "[audio_core]") {
+    WorkBufferPool pool;
+    auto buffer = pool.Acquire(WORK_BUFFER_SIZE);
+    REQUIRE(std::all_of(buffer.get(), buffer.get() + WORK_BUFFER_SIZE,
+                        [](u8 value) { return value == 0; }));
+    std::fill_n(buffer.get(), WORK_BUFFER_SIZE, u8{0xAB});
+    u8* const address = buffer.get();
+    pool.Release(std::move(buffer), WORK_BUFFER_SIZE);
+    REQUIRE(pool.GetPooledCount() == 1);
+
+    // Buffers of another size are not reused.
+    auto other = pool.Acquire(WORK_BUFFER_SIZE / 2);
+    REQUIRE(pool.GetPooledCount() == 1);
+
+    // The reused buffer has its decode object header cleared.
+    buffer = pool.Acquire(WORK_BUFFER_SIZE);
+    REQUIRE(buffer.get() == address);
+    REQUIRE(pool.GetPooledCount() == 0);
+    REQUIRE(std::all_of(buffer.get(), buffer.get() + WorkBufferPool::HeaderSize,
+                        [](u8 value) { return value == 0; }));
+    REQUIRE(buffer[WorkBufferPool::HeaderSize] == 0xAB);
+
+    for (size_t i = 0; i < WorkBufferPool::MaxPooledBuffers + 2; i++) {
+        pool.Release(std::make_unique<u8[]>(16), 16);
+    }
+    REQUIRE(pool.GetPooledCount() == WorkBufferPool::MaxPooledBuffers);
+}
+
+TEST_CASE("Decode[Benchmark]", "[.][benchmark]") {
+    // One second of 48kHz audio.
+    constexpr size_t FrameCount = 48000 / AdpcmSamplesPerFrame;
+    const std::vector<u8> frames = RandomFrames(FrameCount);
+    std::vector<s16> output(FrameCount * AdpcmSamplesPerFrame);
+
+    BENCHMARK("ADPCM, sample at a time") {
+        s16 yn0 = 0;
+        s16 yn1 = 0;
+        for (size_t i = 0; i < FrameCount; i++) {
+            DecodeAdpcmFrameReference(std::span(output).subspan(i * AdpcmSamplesPerFrame),
+                                      std::span(frames).subspan(i * AdpcmFrameSize), yn0, yn1);
+        }
+        return yn0;
+    };
+    BENCHMARK("ADPCM, frame at a time") {
+        return DecodeFrames(frames, output);
+    };
+
+    WorkBufferPool pool;
+    BENCHMARK("Opus work buffer, allocated") {
+        auto buffer = std::make_unique<u8[]>(WORK_BUFFER_SIZE);
+        return buffer[WORK_BUFFER_SIZE - 1];
+    };
+    BENCHMARK("Opus work buffer, pooled") {
+        auto buffer = pool.Acquire(WORK_BUFFER_SIZE);
+        const u8 value = buffer[WORK_BUFFER_SIZE - 1];
+        pool.Release(std::move(buffer), WORK_BUFFER_SIZE);
+        return value;
+    };
+}
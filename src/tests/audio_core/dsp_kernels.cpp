@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/dsp_kernels.h"
+#include "common/common_types.h"
+
+namespace {
+using AudioCore::Renderer::Dsp::Backend;
+namespace Dsp = AudioCore::Renderer::Dsp;
+
+constexpr std::array SIMD_BACKENDS{Backend::SSE41, Backend::AVX2, Backend::NEON};
+
+constexpr std::array SAMPLE_COUNTS{0U, 1U, 3U, 7U, 8U, 9U, 17U, 160U, 240U};
+
+struct Ramp {
+    f32 volume;
+    f32 ramp;
+};
+
+// The last one does not fit the vector lanes and takes the scalar path.
+constexpr std::array RAMPS{Ramp{1.0f, 0.0f},     Ramp{0.5f, 0.001f},  Ramp{-0.75f, -0.002f},
+                           Ramp{2.0f, -0.0125f}, Ramp{0.0f, 0.0003f}, Ramp{300.0f, 1.0f}};
+
+std::vector<s32> RandomSamples(size_t size, u32 seed) {
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<s32> distribution{-0x800000, 0x7FFFFF};
+    std::vector<s32> samples(size);
+    for (s32& sample : samples) {
+        sample = distribution(rng);
+    }
+    return samples;
+}
+
+std::vector<s16> RandomPcm(size_t size, u32 seed) {
+    std::mt19937 rng{seed};
+    std::vector<s16> samples(size);
+    for (s16& sample : samples) {
+        sample = static_cast<s16>(rng());
+    }
+    return samples;
+}
+
+std::vector<f32> RandomLut(size_t size) {
+    std::mt19937 rng{static_cast<u32>(size)};
+    std::uniform_real_distribution<f32> distribution{-1.0f, 1.0f};
+    std::vector<f32> lut(size);
+    for (f32& value : lut) {
+        value = distribution(rng);
+    }
+    return lut;
+}
+
+template <size_t Q>
+std::pair<std::vector<s32>, s32> MixRamp(Backend backend, const Ramp& ramp, u32 sample_count) {
+    Dsp::SetBackend(backend);
+    auto output = RandomSamples(sample_count, 1);
+    const auto input = RandomSamples(sample_count, 2);
+    const s32 last = Dsp::MixRamp<Q>(output, input, Common::FixedPoint<64 - Q, Q>{ramp.volume},
+                                     Common::FixedPoint<64 - Q, Q>{ramp.ramp}, sample_count);
+    return {output, last};
+}
+
+template <size_t Q>
+std::vector<s32> ApplyGainRamp(Backend backend, const Ramp& ramp, u32 sample_count) {
+    Dsp::SetBackend(backend);
+    std::vector<s32> output(sample_count);
+    const auto input = RandomSamples(sample_count, 3);
+    Dsp::ApplyGainRamp<Q>(output, input, Common::FixedPoint<64 - Q, Q>{ramp.volume},
+                          Common::FixedPoint<64 - Q, Q>{ramp.ramp}, sample_count);
+    return output;
+}
+
+template <u32 Taps>
+std::pair<std::vector<s32>, s64> Resample(Backend backend, f32 ratio, u32 sample_count) {
+    Dsp::SetBackend(backend);
+    const auto lut = RandomLut(Taps * 128);
+    const size_t input_size =
+        static_cast<size_t>(static_cast<f32>(sample_count) * ratio) + Taps + 1;
+    const auto input = RandomPcm(input_size, 4);
+    std::vector<s32> output(sample_count);
+    Common::FixedPoint<49, 15> fraction{0.25f};
+    Dsp::ResampleFilter<Taps>(output, input, lut, Common::FixedPoint<49, 15>{ratio}, fraction,
+                              sample_count);
+    return {output, fraction.to_raw()};
+}
+
+template <typename F>
+void ForEachSimdBackend(F&& func) {
+    const Backend detected_backend = Dsp::GetBackend();
+    for (const Backend backend : SIMD_BACKENDS) {
+        if (Dsp::IsBackendSupported(backend)) {
+            func(backend);
+        }
+    }
+    Dsp::SetBackend(detected_backend);
+}
+} // Anonymous namespace
+
+TEST_CASE("DspKernels[MixRamp]", "[audio_core]") {
+    ForEachSimdBackend([](Backend backend) {
+        for (const Ramp& ramp : RAMPS) {
+            for (const u32 sample_count : SAMPLE_COUNTS) {
+                REQUIRE(MixRamp<15>(backend, ramp, sample_count) ==
+                        MixRamp<15>(Backend::Scalar, ramp, sample_count));
+                REQUIRE(MixRamp<23>(backend, ramp, sample_count) ==
+                        MixRamp<23>(Backend::Scalar, ramp, sample_count));
+            }
+        }
+    });
+}
+
+TEST_CASE("DspKernels[ApplyGainRamp]", "[audio_core]") {
+    ForEachSimdBackend([](Backend backend) {
+        for (const Ramp& ramp : RAMPS) {
+            for (const u32 sample_count : SAMPLE_COUNTS) {
+                REQUIRE(ApplyGainRamp<15>(backend, ramp, sample_count) ==
+                        ApplyGainRamp<15>(Backend::Scalar, ramp, sample_count));
+                REQUIRE(ApplyGainRamp<23>(backend, ramp, sample_count) ==
+                        ApplyGainRamp<23>(Backend::Scalar, ramp, sample_count));
+            }
+        }
+    });
+}
+
+TEST_CASE("DspKernels[Resample]", "[audio_core]") {
+    ForEachSimdBackend([](Backend backend) {
+        for (const f32 ratio : {0.5f, 0.6667f, 1.0f, 1.2f, 2.0f}) {
+            for (const u32 sample_count : SAMPLE_COUNTS) {
+                REQUIRE(Resample<4>(backend, ratio, sample_count) ==
+                        Resample<4>(Backend::Scalar, ratio, sample_count));
+                REQUIRE(Resample<8>(backend, ratio, sample_count) ==
+                        Resample<8>(Backend::Scalar, ratio, sample_count));
+            }
+        }
+    });
+}
+
+TEST_CASE("DspKernels[Benchmark]", "[.][benchmark]") {
+    constexpr u32 SampleCount = 240;
+    std::vector<s32> output = RandomSamples(SampleCount, 1);
+    const std::vector<s32> input = RandomSamples(SampleCount, 2);
+    const std::vector<s16> pcm = RandomPcm(SampleCount * 2 + 8, 3);
+    const std::vector<f32> lut4 = RandomLut(4 * 128);
+    const std::vector<f32> lut8 = RandomLut(8 * 128);
+    const Common::FixedPoint<49, 15> volume{0.5f};
+    const Common::FixedPoint<49, 15> ramp{0.001f};
+    const Common::FixedPoint<49, 15> ratio{1.5f};
+
+    const Backend detected_backend = Dsp::GetBackend();
+    for (const Backend backend :
+         {Backend::Scalar, Backend::SSE41, Backend::AVX2, Backend::NEON}) {
+        if (!Dsp::IsBackendSupported(backend)) {
+            continue;
+        }
+        Dsp::SetBackend(backend);
+        const auto name = [backend](const char* command) {
+            constexpr std::array names{"Scalar", "SSE4.1", "AVX2", "NEON"};
+            return std::string{command} + ", " + names[static_cast<size_t>(backend)];
+        };
+
+        BENCHMARK(name("Mix")) {
+            return Dsp::MixRamp<15>(output, input, volume, 0, SampleCount);
+        };
+        BENCHMARK(name("MixRamp")) {
+            return Dsp::MixRamp<15>(output, input, volume, ramp, SampleCount);
+        };
+        BENCHMARK(name("VolumeRamp")) {
+            Dsp::ApplyGainRamp<15>(output, input, volume, ramp, SampleCount);
+            return output[0];
+        };
+        BENCHMARK(name("Resample, 4 taps")) {
+            Common::FixedPoint<49, 15> fraction{0};
+            Dsp::ResampleFilter<4>(output, pcm, lut4, ratio, fraction, SampleCount);
+            return output[0];
+        };
+        BENCHMARK(name("Resample, 8 taps")) {
+            Common::FixedPoint<49, 15> fraction{0};
+            Dsp::ResampleFilter<8>(output, pcm, lut8, ratio, fraction, SampleCount);
+            return output[0];
+        };
+    }
+    Dsp::SetBackend(detected_backend);
+}
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/resample/upsample.h"
+#include "audio_core/renderer/upsampler/upsampler_state.h"
+#include "common/common_types.h"
+
+namespace {
+using AudioCore::Renderer::UpsamplerState;
+
+constexpr u32 NUM_FRAMES = 200;
+
+constexpr std::array SOURCE_SAMPLE_COUNTS{40U, 80U, 160U};
+
+// Partial frames leave the phase pattern mid-period for the next frame.
+constexpr std::array TARGET_SAMPLE_COUNTS{0U, 1U, 5U, 7U, 100U, 160U, 239U, 240U};
+
+void RequireSameState(const UpsamplerState& lhs, const UpsamplerState& rhs) {
+    REQUIRE(lhs.initialized == rhs.initialized);
+    REQUIRE(lhs.sample_index == rhs.sample_index);
+    REQUIRE(lhs.history_input_index == rhs.history_input_index);
+    REQUIRE(lhs.history_output_index == rhs.history_output_index);
+    for (u32 i = 0; i < UpsamplerState::HistorySize; i++) {
+        REQUIRE(lhs.history[i].to_raw() == rhs.history[i].to_raw());
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Upsample[MatchesReference]", "[audio_core]") {
+    for (const u32 source_sample_count : SOURCE_SAMPLE_COUNTS) {
+        std::mt19937 rng{source_sample_count};
+        std::uniform_int_distribution<s32> sample_distribution{-0x800000, 0x7FFFFF};
+        std::uniform_int_distribution<size_t> count_distribution{0,
+                                                                 TARGET_SAMPLE_COUNTS.size() - 1};
+
+        UpsamplerState state{};
+        UpsamplerState reference_state{};
+        std::vector<s32> input(240);
+        std::vector<s32> output(240);
+        std::vector<s32> reference_output(240);
+        for (u32 frame = 0; frame < NUM_FRAMES; frame++) {
+            // Whole frames most of the time, with partial ones mixed in.
+            const u32 target_sample_count = frame % 3 == 0
+                                                ? TARGET_SAMPLE_COUNTS[count_distribution(rng)]
+                                                : 240U;
+            for (s32& sample : input) {
+                sample = sample_distribution(rng);
+            }
+            AudioCore::Renderer::UpsampleFrame(output, input, target_sample_count,
+                                               source_sample_count, &state);
+            AudioCore::Renderer::UpsampleFrameReference(reference_output, input,
+                                                        target_sample_count, source_sample_count,
+                                                        &reference_state);
+
+            REQUIRE(output == reference_output);
+            RequireSameState(state, reference_state);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/boot_timeline.h"
+#include "common/common_types.h"
+#include "common/metrics.h"
+#include "common/trace_recorder.h"
+
+namespace {
+constexpr s64 MILLISECOND = 1'000'000;
+
+s64 BootGauge(const std::string& name) {
+    return Common::Metrics::GetRegistry()
+        .RegisterGauge("yuzu_boot_" + name + "_milliseconds", "")
+        .Get();
+}
+} // Anonymous namespace
+
+TEST_CASE("BootTimeline[Ordering]", "[common]") {
+    // A stage recorded before the boot begins, like loading the keys, is reported with it
+    const s64 origin = Common::Trace::GetTimestamp();
+    Common::BootTimeline::Record("test_keys", origin, origin + 2 * MILLISECOND);
+    Common::BootTimeline::Begin();
+
+    // Recorded out of order from several threads
+    Common::BootTimeline::Record("test_shaders", origin + 5 * MILLISECOND,
+                                 origin + 8 * MILLISECOND);
+    Common::BootTimeline::Record("test_loader", origin + 2 * MILLISECOND,
+                                 origin + 3 * MILLISECOND);
+    Common::BootTimeline::Record("test_loader", origin + 3 * MILLISECOND,
+                                 origin + 4 * MILLISECOND);
+
+    const std::string timeline = Common::BootTimeline::Report();
+    const size_t keys = timeline.find("       2.0 ms  test_keys");
+    const size_t loader = timeline.find("       1.0 ms  test_loader");
+    const size_t shaders = timeline.find("       3.0 ms  test_shaders");
+    REQUIRE(keys != std::string::npos);
+    REQUIRE(loader != std::string::npos);
+    REQUIRE(shaders != std::string::npos);
+    REQUIRE(keys < loader);
+    REQUIRE(loader < shaders);
+    REQUIRE(timeline.find("       1.0 ms  test_loader", loader + 1) != std::string::npos);
+
+    // Repeated stages are added up in their gauge
+    REQUIRE(BootGauge("test_keys") == 2);
+    REQUIRE(BootGauge("test_loader") == 2);
+    REQUIRE(BootGauge("test_shaders") == 3);
+}
+
+TEST_CASE("BootTimeline[ReportOnce]", "[common]") {
+    Common::BootTimeline::Begin();
+    {
+        const Common::BootTimeline::ScopedStage stage{"test_scoped"};
+    }
+    REQUIRE(Common::BootTimeline::Report().find("test_scoped") != std::string::npos);
+
+    // Only the first frame after booting is reported, the stages after it wait for the next boot
+    {
+        const Common::BootTimeline::ScopedStage stage{"test_late"};
+    }
+    REQUIRE(Common::BootTimeline::Report().empty());
+
+    Common::BootTimeline::Begin();
+    REQUIRE(Common::BootTimeline::Report().find("test_late") != std::string::npos);
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stop_token>
+#include <thread>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+#include "common/common_types.h"
+
+namespace {
+constexpr u64 NUM_ITEMS = 1 << 16;
+
+/// Hands NUM_ITEMS values from a producer thread to this one, returns true when they came in order
+template <typename Queue>
+bool Transfer(Queue& queue) {
+    std::jthread producer{[&queue] {
+        for (u64 i = 0; i < NUM_ITEMS; ++i) {
+            queue.EmplaceWait(i);
+        }
+    }};
+    bool in_order = true;
+    for (u64 i = 0; i < NUM_ITEMS; ++i) {
+        u64 value{};
+        queue.PopWait(value, std::stop_token{});
+        in_order &= value == i;
+    }
+    return in_order;
+}
+} // Anonymous namespace
+
+TEST_CASE("SPSCQueue[Order]", "[common]") {
+    Common::SPSCQueue<u64, 0x100> queue;
+    REQUIRE(Transfer(queue));
+    u64 value{};
+    REQUIRE(!queue.TryPop(value));
+}
+
+TEST_CASE("SpinningSPSCQueue[Order]", "[common]") {
+    Common::SpinningSPSCQueue<u64, 0x100> queue;
+    REQUIRE(Transfer(queue));
+    REQUIRE(queue.Size() == 0);
+}
+
+TEST_CASE("SPSCQueue[Benchmark]", "[.][benchmark]") {
+    Common::SPSCQueue<u64> queue;
+    Common::SpinningSPSCQueue<u64> spinning_queue;
+
+    BENCHMARK("SPSCQueue 64k items across threads") {
+        return Transfer(queue);
+    };
+    BENCHMARK("SpinningSPSCQueue 64k items across threads") {
+        return Transfer(spinning_queue);
+    };
+}
@@ -1,9 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/cityhash.h"
+#include "common/fast_hash.h"
 
 constexpr char msg[] = "The blue frogs are singing under the crimson sky.\n"
                        "It is time to run, Robert.";
@@ -19,3 +23,53 @@ TEST_CASE("CityHash", "[common]") {
     REQUIRE(CityHash128WithSeed(msg, sizeof(msg), {0xdead, 0xbeef}) ==
             u128{0xf0307dba81199ebe, 0xd77764e0c4a9eb74});
 }
+
+TEST_CASE("FastHash", "[common]") {
+    REQUIRE(FastHash64(msg, sizeof(msg)) == FastHash64(msg, sizeof(msg)));
+    REQUIRE(FastHash64(msg, sizeof(msg)) != FastHash64(msg, sizeof(msg) - 1));
+    REQUIRE(FastHash64WithSeed(msg, sizeof(msg), 0xdead) !=
+            FastHash64WithSeed(msg, sizeof(msg), 0xbeef));
+    REQUIRE(FastHash64WithSeed(msg, sizeof(msg), 0) == FastHash64(msg, sizeof(msg)));
+}
+
+TEST_CASE("FastHash[KnownAnswers]", "[common]") {
+    // Longer than 240 bytes, so that XXH3 takes its long input path
+    std::vector<char> blob(4096);
+    for (size_t i = 0; i < blob.size(); i++) {
+        blob[i] = static_cast<char>(i * 31 + 7);
+    }
+#ifdef YUZU_HAS_XXHASH
+    // Reference XXH3 results, checked against xxHash 0.8.2 and the xxhash-rust implementation.
+    REQUIRE(FastHash64(msg, 0) == 0x2d06800538d394c2);
+    REQUIRE(FastHash128(msg, 0) == u128{0x6001c324468d497f, 0x99aa06d3014798d8});
+    REQUIRE(FastHash64(msg, sizeof(msg)) == 0xf7626818c7493e4b);
+    REQUIRE(FastHash64WithSeed(msg, sizeof(msg), 0xdead) == 0xcc015b604638eff0);
+    REQUIRE(FastHash128(msg, sizeof(msg)) == u128{0x2007b249826ab489, 0x05d6bf13bce25f55});
+    REQUIRE(FastHash64(blob.data(), blob.size()) == 0xa3c19f8174cde0bb);
+    REQUIRE(FastHash128(blob.data(), blob.size()) == u128{0xa3c19f8174cde0bb, 0x49d3842b33d51e8a});
+#else
+    // Without xxHash the fast hashes are CityHash
+    REQUIRE(FastHash64(msg, sizeof(msg)) == 0x92d5c2e9cbfbbc01);
+    REQUIRE(FastHash64WithSeed(msg, sizeof(msg), 0xdead) == 0xbfbe93f21a2820dd);
+    REQUIRE(FastHash128(msg, sizeof(msg)) == u128{0x98e60d0423747eaa, 0xd8694c5b6fcaede9});
+    REQUIRE(FastHash64(blob.data(), blob.size()) == CityHash64(blob.data(), blob.size()));
+#endif
+}
+
+TEST_CASE("FastHash benchmark", "[.][benchmark]") {
+    const std::vector<char> key(64, 'k');
+    const std::vector<char> blob(64 * 1024, 'b');
+
+    BENCHMARK("CityHash64 64 B") {
+        return CityHash64(key.data(), key.size());
+    };
+    BENCHMARK("FastHash64 64 B") {
+        return FastHash64(key.data(), key.size());
+    };
+    BENCHMARK("CityHash64 64 KiB") {
+        return CityHash64(blob.data(), blob.size());
+    };
+    BENCHMARK("FastHash64 64 KiB") {
+        return FastHash64(blob.data(), blob.size());
+    };
+}
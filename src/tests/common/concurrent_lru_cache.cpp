@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/concurrent_lru_cache.h"
+
+namespace Common {
+
+TEST_CASE("ConcurrentLruCache: Evicts the least recently used", "[common]") {
+    ConcurrentLruCache<u32, u32> cache{3, 1};
+    cache.Insert(1, 10);
+    cache.Insert(2, 20);
+    cache.Insert(3, 30);
+
+    // Looking up 1 makes 2 the least recently used.
+    REQUIRE(cache.Find(1) == 10U);
+    cache.Insert(4, 40);
+    REQUIRE(!cache.Find(2));
+    REQUIRE(cache.Find(1) == 10U);
+    REQUIRE(cache.Find(3) == 30U);
+    REQUIRE(cache.Find(4) == 40U);
+
+    REQUIRE(cache.Erase(3));
+    REQUIRE(!cache.Erase(3));
+    REQUIRE(cache.TotalCost() == 2U);
+}
+
+TEST_CASE("ConcurrentLruCache: Bounds the total cost", "[common]") {
+    ConcurrentLruCache<u32, u32> cache{10, 1};
+    cache.Insert(1, 10, 4);
+    cache.Insert(2, 20, 4);
+    cache.Insert(1, 11, 6);
+    REQUIRE(cache.TotalCost() == 10U);
+    REQUIRE(cache.Find(1) == 11U);
+
+    // An entry larger than the capacity is kept on its own.
+    cache.Insert(3, 30, 16);
+    REQUIRE(cache.TotalCost() == 16U);
+    REQUIRE(cache.Find(3) == 30U);
+}
+
+TEST_CASE("ConcurrentLruCache: Skips entries that cannot be evicted", "[common]") {
+    // Odd values are pinned
+    ConcurrentLruCache<u32, u32> cache{2, [](u32 value) { return value % 2 == 0; }, 1};
+    cache.Insert(1, 11);
+    cache.Insert(2, 20);
+    cache.Insert(3, 31);
+    REQUIRE(!cache.Find(2));
+    REQUIRE(cache.Find(1) == 11U);
+    REQUIRE(cache.Find(3) == 31U);
+
+    // Pinned entries may keep the cache over its capacity
+    cache.Insert(5, 51);
+    REQUIRE(cache.TotalCost() == 3U);
+    cache.Insert(6, 60);
+    REQUIRE(cache.TotalCost() == 4U);
+    REQUIRE(cache.Find(6) == 60U);
+
+    // Entries go as soon as they can be evicted again
+    cache.Insert(1, 10);
+    REQUIRE(!cache.Find(6));
+    REQUIRE(cache.Find(1) == 10U);
+    cache.Insert(7, 70);
+    REQUIRE(!cache.Find(1));
+    REQUIRE(cache.TotalCost() == 3U);
+}
+
+TEST_CASE("ConcurrentLruCache: Concurrent accesses", "[common]") {
+    ConcurrentLruCache<u32, u32> cache{256};
+    std::vector<std::jthread> threads;
+    for (u32 thread = 0; thread < 4; thread++) {
+        threads.emplace_back([&cache, thread] {
+            for (u32 i = 0; i < 10000; i++) {
+                const u32 key = (i * 7 + thread) % 512;
+                if (const auto value = cache.Find(key)) {
+                    REQUIRE(*value == key * 2);
+                } else {
+                    cache.Insert(key, key * 2);
+                }
+            }
+        });
+    }
+    threads.clear();
+    REQUIRE(cache.TotalCost() <= 256U);
+}
+
+} // namespace Common
@@ -11,6 +11,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -310,4 +311,20 @@ TEST_CASE("Fibers::Rewind", "[common]") {
     REQUIRE(test_control.rewinded);
 }
 
+TEST_CASE("Fibers::SwitchLatency", "[.][benchmark]") {
+    std::shared_ptr<Fiber> thread_fiber = Fiber::ThreadToFiber();
+    std::shared_ptr<Fiber> work_fiber;
+    work_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            Fiber::YieldTo(work_fiber, *thread_fiber);
+        }
+    });
+
+    BENCHMARK("Switch to a fiber and back") {
+        Fiber::YieldTo(thread_fiber, *work_fiber);
+    };
+
+    thread_fiber->Exit();
+}
+
 } // namespace Common
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/metrics.h"
+
+namespace {
+constexpr u32 NUM_THREADS = 8;
+constexpr u64 INCREMENTS_PER_THREAD = 10'000;
+} // Anonymous namespace
+
+TEST_CASE("Metrics[Counter]", "[common]") {
+    Common::Metrics::Registry registry;
+    auto& counter = registry.RegisterCounter("test_total", "Test counter");
+    REQUIRE(&registry.RegisterCounter("test_total", "Test counter") == &counter);
+    REQUIRE(counter.Get() == 0);
+
+    {
+        // Spread the increments over several shards
+        std::vector<std::jthread> threads;
+        for (u32 i = 0; i < NUM_THREADS; i++) {
+            threads.emplace_back([&counter] {
+                for (u64 j = 0; j < INCREMENTS_PER_THREAD; j++) {
+                    counter.Increment();
+                }
+            });
+        }
+    }
+    counter.Increment(5);
+    REQUIRE(counter.Get() == NUM_THREADS * INCREMENTS_PER_THREAD + 5);
+}
+
+TEST_CASE("Metrics[Gauge]", "[common]") {
+    Common::Metrics::Registry registry;
+    auto& gauge = registry.RegisterGauge("test_bytes", "Test gauge");
+    gauge.Set(10);
+    gauge.Add(-25);
+    REQUIRE(gauge.Get() == -15);
+}
+
+TEST_CASE("Metrics[Histogram]", "[common]") {
+    Common::Metrics::Registry registry;
+    auto& histogram = registry.RegisterHistogram("test_seconds", "Test histogram", {0.5, 1.0, 2.0});
+    // Bounds are inclusive, a value equal to one is counted in its bucket
+    for (const f64 value : {0.25, 0.5, 0.75, 1.0, 1.5, 4.0}) {
+        histogram.Observe(value);
+    }
+
+    const auto snapshot = histogram.Get();
+    REQUIRE(snapshot.upper_bounds == std::vector<f64>{0.5, 1.0, 2.0});
+    REQUIRE(snapshot.cumulative_counts == std::vector<u64>{2, 4, 5, 6});
+    REQUIRE(snapshot.sum == 8.0);
+}
+
+TEST_CASE("Metrics[Serialize]", "[common]") {
+    Common::Metrics::Registry registry;
+    registry.RegisterCounter("test_total", "Test counter").Increment(3);
+    registry.RegisterGauge("test_bytes", "Test gauge").Set(-7);
+    auto& histogram = registry.RegisterHistogram("test_seconds", "Test histogram", {0.5, 2.0});
+    histogram.Observe(0.25);
+    histogram.Observe(1.0);
+    histogram.Observe(3.0);
+
+    REQUIRE(registry.Serialize() == "# HELP test_total Test counter\n"
+                                    "# TYPE test_total counter\n"
+                                    "test_total 3\n"
+                                    "# HELP test_bytes Test gauge\n"
+                                    "# TYPE test_bytes gauge\n"
+                                    "test_bytes -7\n"
+                                    "# HELP test_seconds Test histogram\n"
+                                    "# TYPE test_seconds histogram\n"
+                                    "test_seconds_bucket{le=\"0.5\"} 1\n"
+                                    "test_seconds_bucket{le=\"2\"} 2\n"
+                                    "test_seconds_bucket{le=\"+Inf\"} 3\n"
+                                    "test_seconds_sum 4.25\n"
+                                    "test_seconds_count 3\n");
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/literals.h"
+#include "common/page_table.h"
+
+using namespace Common::Literals;
+
+namespace {
+constexpr size_t ADDRESS_SPACE_BITS = 32;
+constexpr size_t PAGE_BITS = 12;
+constexpr size_t PAGE_SIZE = 1ULL << PAGE_BITS;
+constexpr u64 BASE_ADDRESS = 0x10000000;
+
+/// Maps [BASE_ADDRESS, BASE_ADDRESS + host.size()) to host memory
+void MapContiguous(Common::PageTable& page_table, std::vector<u8>& host) {
+    const uintptr_t pointer = reinterpret_cast<uintptr_t>(host.data()) - BASE_ADDRESS;
+    for (size_t page = 0; page < host.size() / PAGE_SIZE; ++page) {
+        page_table.pointers[(BASE_ADDRESS >> PAGE_BITS) + page].Store(pointer,
+                                                                      Common::PageType::Memory);
+    }
+}
+
+/// Copies guest memory like Core::Memory::ReadBlock, optionally walking contiguous runs at once
+template <bool COALESCE>
+void ReadBlock(const Common::PageTable& page_table, u64 address, u8* dest, size_t size) {
+    size_t page_index = address >> PAGE_BITS;
+    size_t page_offset = address & (PAGE_SIZE - 1);
+    while (size > 0) {
+        size_t copy_amount = std::min(PAGE_SIZE - page_offset, size);
+        size_t num_pages = 1;
+        if constexpr (COALESCE) {
+            const size_t max_pages = 1 + (size - copy_amount + PAGE_SIZE - 1) / PAGE_SIZE;
+            num_pages = page_table.ContiguousPages(page_index, max_pages);
+            copy_amount = std::min(copy_amount + ((num_pages - 1) << PAGE_BITS), size);
+        }
+        const uintptr_t pointer = page_table.pointers[page_index].Pointer();
+        std::memcpy(dest, reinterpret_cast<const u8*>(pointer + (page_index << PAGE_BITS) +
+                                                      page_offset),
+                    copy_amount);
+        dest += copy_amount;
+        size -= copy_amount;
+        page_index += num_pages;
+        page_offset = 0;
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("PageTable[ContiguousPages]", "[common]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+
+    std::vector<u8> host(16 * PAGE_SIZE);
+    MapContiguous(page_table, host);
+    const size_t first_page = BASE_ADDRESS >> PAGE_BITS;
+    REQUIRE(page_table.ContiguousPages(first_page, 16) == 16);
+    REQUIRE(page_table.ContiguousPages(first_page, 5) == 5);
+    REQUIRE(page_table.ContiguousPages(first_page + 15, 16) == 1);
+
+    // Remap a page elsewhere to split the run
+    std::vector<u8> other(PAGE_SIZE);
+    page_table.pointers[first_page + 8].Store(
+        reinterpret_cast<uintptr_t>(other.data()) - (BASE_ADDRESS + 8 * PAGE_SIZE),
+        Common::PageType::Memory);
+    REQUIRE(page_table.ContiguousPages(first_page, 16) == 8);
+    REQUIRE(page_table.ContiguousPages(first_page + 8, 16) == 1);
+    REQUIRE(page_table.ContiguousPages(first_page + 9, 16) == 7);
+
+    // Unmapped runs are contiguous too
+    REQUIRE(page_table.ContiguousPages(0, 32) == 32);
+}
+
+TEST_CASE("PageTable[CoalescedReads]", "[common]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+
+    std::vector<u8> host(64 * PAGE_SIZE);
+    for (size_t i = 0; i < host.size(); ++i) {
+        host[i] = static_cast<u8>(i * 7);
+    }
+    MapContiguous(page_table, host);
+
+    for (const u64 offset : {u64{0}, u64{123}, u64{PAGE_SIZE - 1}, u64{3 * PAGE_SIZE + 17}}) {
+        const size_t size = host.size() - offset - 5;
+        std::vector<u8> page_by_page(size);
+        std::vector<u8> coalesced(size);
+        ReadBlock<false>(page_table, BASE_ADDRESS + offset, page_by_page.data(), size);
+        ReadBlock<true>(page_table, BASE_ADDRESS + offset, coalesced.data(), size);
+        REQUIRE(page_by_page == coalesced);
+        REQUIRE(std::memcmp(coalesced.data(), host.data() + offset, size) == 0);
+    }
+}
+
+TEST_CASE("PageTable[ReadBlockBenchmark]", "[.][benchmark]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+
+    std::vector<u8> host(4_MiB);
+    MapContiguous(page_table, host);
+    std::vector<u8> dest(host.size());
+
+    BENCHMARK("4 KiB page by page") {
+        ReadBlock<false>(page_table, BASE_ADDRESS, dest.data(), 4_KiB);
+    };
+    BENCHMARK("4 KiB coalesced") {
+        ReadBlock<true>(page_table, BASE_ADDRESS, dest.data(), 4_KiB);
+    };
+    BENCHMARK("64 KiB page by page") {
+        ReadBlock<false>(page_table, BASE_ADDRESS, dest.data(), 64_KiB);
+    };
+    BENCHMARK("64 KiB coalesced") {
+        ReadBlock<true>(page_table, BASE_ADDRESS, dest.data(), 64_KiB);
+    };
+    BENCHMARK("4 MiB page by page") {
+        ReadBlock<false>(page_table, BASE_ADDRESS, dest.data(), 4_MiB);
+    };
+    BENCHMARK("4 MiB coalesced") {
+        ReadBlock<true>(page_table, BASE_ADDRESS, dest.data(), 4_MiB);
+    };
+}
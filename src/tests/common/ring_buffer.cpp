@@ -7,7 +7,9 @@
 #include <numeric>
 #include <thread>
 #include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include "common/common_types.h"
 #include "common/ring_buffer.h"
 
 namespace Common {
@@ -126,4 +128,16 @@ TEST_CASE("RingBuffer: Threaded Test", "[common]") {
     printf("RingBuffer: Threaded Test: full: %zu, empty: %zu\n", full, empty);
 }
 
+TEST_CASE("RingBuffer: Benchmark", "[.][benchmark]") {
+    // Sized like the audio sink buffers, stereo samples pushed and popped a frame at a time
+    RingBuffer<s16, 0x4000> buf;
+    std::vector<s16> frame(0x400 * 2, 1);
+    std::vector<s16> output(frame.size());
+
+    BENCHMARK("Push and pop 1024 stereo samples") {
+        buf.Push(frame);
+        return buf.Pop(output.data(), output.size());
+    };
+}
+
 } // namespace Common
@@ -7,6 +7,7 @@
 #include <span>
 #include <catch2/catch_test_macros.hpp>
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 #include "common/scratch_buffer.h"
 
 namespace Common {
@@ -197,4 +198,25 @@ TEST_CASE("ScratchBuffer: Span Writes", "[common]") {
     }
 }
 
+TEST_CASE("ScratchBuffer: Memory Accounting", "[common]") {
+    using MemoryAccounting::Category;
+    const u64 initial_bytes = MemoryAccounting::Get(Category::ScratchBuffers);
+    {
+        ScratchBuffer<u32> buf(4);
+        REQUIRE(MemoryAccounting::Get(Category::ScratchBuffers) == initial_bytes + 16);
+
+        buf.resize(8);
+        buf.resize(2);
+        REQUIRE(MemoryAccounting::Get(Category::ScratchBuffers) == initial_bytes + 32);
+
+        ScratchBuffer<u32> other(16);
+        other = std::move(buf);
+        REQUIRE(MemoryAccounting::Get(Category::ScratchBuffers) == initial_bytes + 32);
+
+        ScratchBuffer<u32> moved(std::move(other));
+        REQUIRE(MemoryAccounting::Get(Category::ScratchBuffers) == initial_bytes + 32);
+    }
+    REQUIRE(MemoryAccounting::Get(Category::ScratchBuffers) == initial_bytes);
+}
+
 } // namespace Common
@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <cstddef>
+#include <new>
 #include <string>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/unique_function.h"
@@ -26,6 +30,28 @@ struct Noisy {
 
     std::string state;
 };
+
+/// Callable counting the heap allocations of its type
+template <std::size_t Size>
+struct CountedAllocations {
+    static void* operator new(std::size_t size) {
+        ++num_allocations;
+        return ::operator new(size);
+    }
+    static void operator delete(void* pointer) {
+        ++num_deallocations;
+        ::operator delete(pointer);
+    }
+
+    int operator()() const {
+        return static_cast<int>(payload[0]) + 1;
+    }
+
+    std::array<std::byte, Size> payload{};
+
+    static inline int num_allocations = 0;
+    static inline int num_deallocations = 0;
+};
 } // Anonymous namespace
 
 TEST_CASE("UniqueFunction", "[common]") {
@@ -107,3 +133,48 @@ TEST_CASE("UniqueFunction", "[common]") {
         REQUIRE(num_destroyed == 1);
     }
 }
+
+TEST_CASE("UniqueFunction[Allocations]", "[common]") {
+    SECTION("Small callables are stored inline") {
+        using Small = CountedAllocations<Common::UniqueFunction<int>::INLINE_SIZE>;
+        Small::num_allocations = 0;
+        Small::num_deallocations = 0;
+        {
+            Common::UniqueFunction<int> func = Small{};
+            Common::UniqueFunction<int> moved = std::move(func);
+            REQUIRE(!func);
+            REQUIRE(moved() == 1);
+        }
+        REQUIRE(Small::num_allocations == 0);
+        REQUIRE(Small::num_deallocations == 0);
+    }
+    SECTION("Large callables are allocated once") {
+        using Large = CountedAllocations<Common::UniqueFunction<int>::INLINE_SIZE + 1>;
+        Large::num_allocations = 0;
+        Large::num_deallocations = 0;
+        {
+            Common::UniqueFunction<int> func = Large{};
+            Common::UniqueFunction<int> moved;
+            moved = std::move(func);
+            REQUIRE(!func);
+            REQUIRE(moved() == 1);
+            REQUIRE(Large::num_allocations == 1);
+        }
+        REQUIRE(Large::num_deallocations == 1);
+    }
+}
+
+TEST_CASE("UniqueFunction[Benchmark]", "[.][benchmark]") {
+    int value = 0;
+    BENCHMARK("Construct and call a small callable") {
+        Common::UniqueFunction<void> func = [&value] { ++value; };
+        func();
+        return value;
+    };
+    BENCHMARK("Construct and call a large callable") {
+        std::array<int, 16> captured{};
+        Common::UniqueFunction<void> func = [&value, captured] { value += captured[0] + 1; };
+        func();
+        return value;
+    };
+}
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "core/crypto/aes_hw.h"
+
+namespace {
+using Block = std::array<u8, 16>;
+
+constexpr Block FIPS_KEY{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                         0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+
+struct Schedules {
+    explicit Schedules(const u8* key) {
+        Core::Crypto::HW::ExpandKey(key, encryption, decryption);
+    }
+
+    Core::Crypto::HW::KeySchedule encryption;
+    Core::Crypto::HW::KeySchedule decryption;
+};
+
+std::vector<u8> MakeData(std::size_t size) {
+    std::vector<u8> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>(i * 7 + 3);
+    }
+    return data;
+}
+} // Anonymous namespace
+
+using namespace Common::Literals;
+using namespace Core::Crypto;
+
+TEST_CASE("AES HW: Key expansion", "[core]") {
+    const Schedules keys{FIPS_KEY.data()};
+    constexpr Block last_round_key{0x13, 0x11, 0x1d, 0x7f, 0xe3, 0x94, 0x4a, 0x17,
+                                   0xf3, 0x07, 0xa7, 0x8b, 0x4d, 0x2b, 0x30, 0xc5};
+    REQUIRE(keys.encryption.round_keys[0] == FIPS_KEY);
+    REQUIRE(keys.encryption.round_keys[10] == last_round_key);
+    REQUIRE(keys.decryption.round_keys[0] == last_round_key);
+    REQUIRE(keys.decryption.round_keys[10] == FIPS_KEY);
+}
+
+TEST_CASE("AES HW: CTR", "[core]") {
+    if (!HW::IsSupported()) {
+        return;
+    }
+    SECTION("FIPS-197 block") {
+        const Schedules keys{FIPS_KEY.data()};
+        Block counter{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                      0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+        const Block zero{};
+        Block out{};
+        HW::TranscodeCtr(keys.encryption, counter, zero.data(), out.data(), out.size());
+        REQUIRE(out == Block{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7,
+                             0x80, 0x70, 0xb4, 0xc5, 0x5a});
+    }
+    SECTION("Pipelined and partial blocks match single blocks") {
+        const Schedules keys{FIPS_KEY.data()};
+        // The low half of the counter carries into the high half after two blocks.
+        constexpr Block initial_counter{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                                        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe};
+        const std::vector<u8> src = MakeData(HW::PipelineBlocks * 16 * 2 + 16 * 3 + 5);
+
+        Block counter = initial_counter;
+        std::vector<u8> pipelined(src.size());
+        HW::TranscodeCtr(keys.encryption, counter, src.data(), pipelined.data(), src.size());
+
+        Block single_counter = initial_counter;
+        std::vector<u8> single(src.size());
+        for (std::size_t offset = 0; offset < src.size(); offset += 16) {
+            const std::size_t size = std::min<std::size_t>(16, src.size() - offset);
+            HW::TranscodeCtr(keys.encryption, single_counter, src.data() + offset,
+                             single.data() + offset, size);
+        }
+        REQUIRE(pipelined == single);
+        REQUIRE(counter == single_counter);
+        REQUIRE(counter == Block{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x00, 0x00, 0x00,
+                                 0x00, 0x00, 0x00, 0x00, 0x12});
+
+        counter = initial_counter;
+        std::vector<u8> decrypted(src.size());
+        HW::TranscodeCtr(keys.encryption, counter, pipelined.data(), decrypted.data(),
+                         src.size());
+        REQUIRE(decrypted == src);
+    }
+}
+
+TEST_CASE("AES HW: XTS", "[core]") {
+    if (!HW::IsSupported()) {
+        return;
+    }
+    SECTION("IEEE 1619 vector 2") {
+        Block data_key;
+        Block tweak_key;
+        data_key.fill(0x11);
+        tweak_key.fill(0x22);
+        const Schedules data_keys{data_key.data()};
+        const Schedules tweak_keys{tweak_key.data()};
+        const Block data_unit{0x33, 0x33, 0x33, 0x33, 0x33};
+        const std::vector<u8> src(32, 0x44);
+        std::vector<u8> out(src.size());
+        HW::TranscodeXts(data_keys.encryption, tweak_keys.encryption, data_unit, src.data(),
+                         out.data(), out.size(), false);
+        const std::vector<u8> expected{0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e,
+                                       0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+                                       0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4,
+                                       0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0};
+        REQUIRE(out == expected);
+    }
+    SECTION("Round trip") {
+        const Schedules data_keys{FIPS_KEY.data()};
+        const Block tweak_key{0xff, 0xfe, 0xfd, 0xfc};
+        const Schedules tweak_keys{tweak_key.data()};
+        const Block data_unit{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x12, 0x34};
+        const std::vector<u8> src = MakeData(0x200 + 16 * 3);
+
+        std::vector<u8> encrypted(src.size());
+        HW::TranscodeXts(data_keys.encryption, tweak_keys.encryption, data_unit, src.data(),
+                         encrypted.data(), src.size(), false);
+        REQUIRE(encrypted != src);
+
+        std::vector<u8> decrypted(src.size());
+        HW::TranscodeXts(data_keys.decryption, tweak_keys.encryption, data_unit,
+                         encrypted.data(), decrypted.data(), src.size(), true);
+        REQUIRE(decrypted == src);
+    }
+}
+
+// Compares keeping several blocks in flight against transcoding one block at a time, which is
+// bound by the latency of the AES instructions.
+TEST_CASE("AES HW[Benchmark]", "[.][benchmark]") {
+    if (!HW::IsSupported()) {
+        return;
+    }
+    const Schedules keys{FIPS_KEY.data()};
+    const std::vector<u8> src = MakeData(1_MiB);
+    std::vector<u8> dest(src.size());
+    Block counter{};
+
+    BENCHMARK("CTR 1 MiB") {
+        HW::TranscodeCtr(keys.encryption, counter, src.data(), dest.data(), src.size());
+        return dest[0];
+    };
+    BENCHMARK("CTR 1 MiB, one block at a time") {
+        for (std::size_t offset = 0; offset < src.size(); offset += 16) {
+            HW::TranscodeCtr(keys.encryption, counter, src.data() + offset, dest.data() + offset,
+                             16);
+        }
+        return dest[0];
+    };
+    BENCHMARK("XTS 1 MiB, 0x200 byte sectors") {
+        Block data_unit{};
+        for (std::size_t offset = 0; offset < src.size(); offset += 0x200) {
+            data_unit[15] = static_cast<u8>(offset / 0x200);
+            HW::TranscodeXts(keys.decryption, keys.encryption, data_unit, src.data() + offset,
+                             dest.data() + offset, 0x200, true);
+        }
+        return dest[0];
+    };
+}
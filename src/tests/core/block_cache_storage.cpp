@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/literals.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
+
+namespace {
+using namespace Common::Literals;
+using FileSys::BlockCache;
+using FileSys::BlockCacheStorage;
+
+/// Pattern storage that counts the reads reaching it
+class CountingStorage : public FileSys::IReadOnlyStorage {
+public:
+    explicit CountingStorage(size_t size_) : size{size_} {}
+
+    size_t Read(u8* buffer, size_t length, size_t offset) const override {
+        ++num_reads;
+        length = std::min(length, size - offset);
+        for (size_t i = 0; i < length; ++i) {
+            buffer[i] = Pattern(offset + i);
+        }
+        return length;
+    }
+
+    size_t GetSize() const override {
+        return size;
+    }
+
+    static u8 Pattern(size_t offset) {
+        return static_cast<u8>(offset * 13 + offset / 251);
+    }
+
+    size_t size;
+    mutable size_t num_reads = 0;
+};
+
+bool Matches(const std::vector<u8>& data, size_t offset) {
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i] != CountingStorage::Pattern(offset + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+} // Anonymous namespace
+
+TEST_CASE("BlockCacheStorage: Repeated reads are served from the cache", "[core]") {
+    BlockCache cache{4_MiB};
+    const auto base = std::make_shared<CountingStorage>(BlockCache::BlockSize * 4 + 100);
+    BlockCacheStorage storage{base, cache};
+
+    // Unaligned read crossing two blocks.
+    std::vector<u8> data(BlockCache::BlockSize);
+    const size_t offset = BlockCache::BlockSize / 2 + 3;
+    REQUIRE(storage.Read(data.data(), data.size(), offset) == data.size());
+    REQUIRE(Matches(data, offset));
+    REQUIRE(base->num_reads == 2);
+
+    REQUIRE(storage.Read(data.data(), data.size(), offset) == data.size());
+    REQUIRE(Matches(data, offset));
+    REQUIRE(base->num_reads == 2);
+
+    // The last block is partial and reads are clamped to the end of the storage.
+    const size_t tail_offset = storage.GetSize() - 50;
+    REQUIRE(storage.Read(data.data(), data.size(), tail_offset) == 50);
+    data.resize(50);
+    REQUIRE(Matches(data, tail_offset));
+    REQUIRE(storage.Read(data.data(), data.size(), tail_offset) == 50);
+    REQUIRE(base->num_reads == 3);
+
+    const auto statistics = cache.GetStatistics();
+    REQUIRE(statistics.hits == 3);
+    REQUIRE(statistics.misses == 3);
+    REQUIRE(statistics.used_size == BlockCache::BlockSize * 2 + 100);
+}
+
+TEST_CASE("BlockCacheStorage: Blocks are evicted past the capacity", "[core]") {
+    // One block per shard.
+    BlockCache cache{BlockCache::BlockSize * BlockCache::NumShards};
+    const auto base = std::make_shared<CountingStorage>(BlockCache::BlockSize * 256);
+    {
+        BlockCacheStorage storage{base, cache};
+        std::vector<u8> data(16);
+        for (size_t block = 0; block < 256; ++block) {
+            const size_t offset = block * BlockCache::BlockSize + 8;
+            REQUIRE(storage.Read(data.data(), data.size(), offset) == data.size());
+            REQUIRE(Matches(data, offset));
+        }
+        const auto statistics = cache.GetStatistics();
+        REQUIRE(statistics.used_size <= cache.GetCapacity());
+        REQUIRE(statistics.evictions >= 256 - BlockCache::NumShards);
+    }
+
+    // Destroying the storage drops its blocks.
+    REQUIRE(cache.GetStatistics().used_size == 0);
+}
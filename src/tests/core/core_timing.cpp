@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
@@ -10,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -139,3 +141,58 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[Unschedule]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events{
+        Core::Timing::CreateEvent("callbackA", HostCallbackTemplate<0>),
+        Core::Timing::CreateEvent("callbackB", HostCallbackTemplate<1>),
+    };
+
+    core_timing.SyncPause(true);
+    callbacks_ran_flags.reset();
+
+    core_timing.ScheduleEvent(std::chrono::microseconds{10}, events[0]);
+    core_timing.ScheduleEvent(std::chrono::microseconds{20}, events[1]);
+    core_timing.ScheduleEvent(std::chrono::microseconds{30}, events[0]);
+    core_timing.UnscheduleEvent(events[0], Core::Timing::UnscheduleEventType::NoWait);
+
+    // Unscheduling an event that is not in the queue is a no-op
+    core_timing.UnscheduleEvent(events[0], Core::Timing::UnscheduleEventType::NoWait);
+
+    core_timing.Pause(false);
+    while (core_timing.HasPendingEvents())
+        ;
+
+    REQUIRE(!callbacks_ran_flags.test(0));
+    REQUIRE(callbacks_ran_flags.test(1));
+}
+
+TEST_CASE("CoreTiming[ScheduleBenchmark]", "[.][benchmark]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    core_timing.SyncPause(true);
+
+    // Long running looping events stay in the queue, like the ones of most services
+    std::vector<std::shared_ptr<Core::Timing::EventType>> background_events;
+    for (size_t i = 0; i < 1024; i++) {
+        background_events.push_back(
+            Core::Timing::CreateEvent("background", HostCallbackTemplate<0>));
+        core_timing.ScheduleLoopingEvent(std::chrono::seconds{10}, std::chrono::seconds{10},
+                                         background_events.back());
+    }
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < 64; i++) {
+        events.push_back(Core::Timing::CreateEvent("event", HostCallbackTemplate<1>));
+    }
+
+    BENCHMARK("Schedule and unschedule 64 events") {
+        for (const auto& event : events) {
+            core_timing.ScheduleEvent(std::chrono::seconds{5}, event);
+        }
+        for (const auto& event : events) {
+            core_timing.UnscheduleEvent(event, Core::Timing::UnscheduleEventType::NoWait);
+        }
+    };
+}
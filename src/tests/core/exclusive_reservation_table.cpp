@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/arm/exclusive_reservation_table.h"
+
+namespace {
+
+constexpr VAddr ADDRESS = 0x8000'1000;
+
+bool Increment(Core::ExclusiveReservationTable& table, size_t core, std::atomic<u32>& memory) {
+    const u32 value = table.ReadAndMark<u32>(core, ADDRESS, [&] { return memory.load(); });
+    return table.DoExclusiveOperation<u32>(core, ADDRESS, [&](u32 expected) {
+        return memory.compare_exchange_strong(expected, value + 1);
+    });
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ExclusiveReservationTable[Contended]", "[core]") {
+    Core::ExclusiveReservationTable table{2};
+    std::atomic<u32> memory{};
+
+    // Both cores mark the address, the write of the second one loses the reservation.
+    table.ReadAndMark<u32>(0, ADDRESS, [&] { return memory.load(); });
+    table.ReadAndMark<u32>(1, ADDRESS, [&] { return memory.load(); });
+    REQUIRE(table.DoExclusiveOperation<u32>(
+        0, ADDRESS, [&](u32 expected) { return memory.compare_exchange_strong(expected, 1); }));
+    REQUIRE(!table.DoExclusiveOperation<u32>(
+        1, ADDRESS, [&](u32 expected) { return memory.compare_exchange_strong(expected, 2); }));
+    REQUIRE(memory.load() == 1);
+    REQUIRE(table.GetContendedCount() == 1);
+
+    // Writes without a reservation or after clearing it fail without touching memory.
+    REQUIRE(!table.DoExclusiveOperation<u32>(0, ADDRESS, [](u32) { return true; }));
+    table.ReadAndMark<u32>(0, ADDRESS, [&] { return memory.load(); });
+    table.Clear(0);
+    REQUIRE(!table.DoExclusiveOperation<u32>(0, ADDRESS, [](u32) { return true; }));
+    REQUIRE(Increment(table, 0, memory));
+    REQUIRE(memory.load() == 2);
+}
+
+TEST_CASE("ExclusiveReservationTable[GuestWrite]", "[core]") {
+    Core::ExclusiveReservationTable table{1};
+    std::atomic<u32> memory{};
+
+    // A guest exclusive store within the granule breaks the reservation, even when the value
+    // compared by the write is unchanged.
+    table.ReadAndMark<u32>(0, ADDRESS, [&] { return memory.load(); });
+    table.Invalidate(ADDRESS + 4);
+    REQUIRE(!table.DoExclusiveOperation<u32>(
+        0, ADDRESS, [&](u32 expected) { return memory.compare_exchange_strong(expected, 1); }));
+    REQUIRE(memory.load() == 0);
+    REQUIRE(Increment(table, 0, memory));
+    REQUIRE(memory.load() == 1);
+}
+
+TEST_CASE("ExclusiveReservationTable[Increments]", "[core]") {
+    constexpr size_t NUM_CORES = Core::ExclusiveReservationTable::MaxCores;
+    constexpr u32 NUM_INCREMENTS = 20'000;
+    Core::ExclusiveReservationTable table{NUM_CORES};
+    std::atomic<u32> memory{};
+
+    std::vector<std::thread> threads;
+    for (size_t core = 0; core < NUM_CORES; ++core) {
+        threads.emplace_back([&, core] {
+            for (u32 i = 0; i < NUM_INCREMENTS; ++i) {
+                while (!Increment(table, core, memory)) {
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(memory.load() == NUM_CORES * NUM_INCREMENTS);
+}
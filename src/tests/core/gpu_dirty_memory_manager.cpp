@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/gpu_dirty_memory_manager.h"
+
+using Ranges = std::vector<std::pair<PAddr, size_t>>;
+
+TEST_CASE("GPUDirtyMemoryManager[Gather]", "[core]") {
+    Core::GPUDirtyMemoryManager manager;
+    manager.Collect(0x1000, 0x40);
+    manager.Collect(0x1040, 0x40);
+    manager.Collect(0x17C0, 0x40);
+    manager.Collect(0x1800, 0x80);
+
+    Ranges ranges;
+    manager.Gather(ranges);
+    REQUIRE(ranges == Ranges{{0x1000, 0x80}, {0x17C0, 0xC0}});
+
+    ranges.clear();
+    manager.Gather(ranges);
+    REQUIRE(ranges.empty());
+}
+
+TEST_CASE("GPUDirtyMemoryManager[Coalesce]", "[core]") {
+    Ranges ranges{{0x3000, 0x100}, {0x1000, 0x80}, {0x1040, 0x100}, {0x1140, 0x40}, {0x5000, 0x10}};
+    Core::GPUDirtyMemoryManager::Coalesce(ranges);
+    REQUIRE(ranges == Ranges{{0x1000, 0x180}, {0x3000, 0x100}, {0x5000, 0x10}});
+}
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "core/core.h"
+#include "core/hle/kernel/k_address_arbiter.h"
+#include "core/hle/kernel/k_hashed_waiter_trees.h"
+#include "core/hle/kernel/k_thread.h"
+
+namespace {
+
+using ThreadTree = Kernel::KAddressArbiter::ThreadTree;
+using HashedTrees = Kernel::KHashedWaiterTrees<ThreadTree>;
+
+constexpr size_t NUM_ADDRESSES = 1024;
+constexpr size_t WAITERS_PER_ADDRESS = 4;
+constexpr size_t NUM_ROUNDS = 64;
+
+constexpr u64 WaitedAddress(size_t index) {
+    return 0x8000'0000 + index * sizeof(u32);
+}
+
+/// Threads of the kernel, as they are queued by the address arbiter before they start waiting
+class Waiters {
+public:
+    explicit Waiters(Kernel::KernelCore& kernel) {
+        threads.reserve(NUM_ADDRESSES * WAITERS_PER_ADDRESS);
+        for (size_t index = 0; index < NUM_ADDRESSES * WAITERS_PER_ADDRESS; ++index) {
+            auto& thread = threads.emplace_back(std::make_unique<Kernel::KThread>(kernel));
+            thread->SetPriority(static_cast<s32>(index / NUM_ADDRESSES));
+        }
+    }
+
+    /// Makes every thread wait on its address in the tree given for the address
+    template <typename GetTree>
+    void Wait(GetTree&& get_tree) {
+        for (size_t index = 0; index < threads.size(); ++index) {
+            const u64 address = WaitedAddress(index % NUM_ADDRESSES);
+            ThreadTree& tree = get_tree(address);
+            threads[index]->SetAddressArbiter(&tree, address);
+            tree.insert(*threads[index]);
+        }
+    }
+
+    /// Cancels the wait of every thread still waiting, as a timeout would
+    void Cancel() {
+        for (const auto& thread : threads) {
+            if (thread->IsWaitingForAddressArbiter()) {
+                ThreadTree* const tree = thread->GetConditionVariableTree();
+                tree->erase(tree->iterator_to(*thread));
+                thread->ClearAddressArbiter();
+            }
+        }
+    }
+
+    Kernel::KThread& operator[](size_t index) {
+        return *threads[index];
+    }
+
+    size_t size() const {
+        return threads.size();
+    }
+
+private:
+    std::vector<std::unique_ptr<Kernel::KThread>> threads;
+};
+
+/// Signals up to count threads waiting on the address, the same way KAddressArbiter::Signal does
+std::vector<Kernel::KThread*> Signal(ThreadTree& tree, u64 address, s32 count) {
+    std::vector<Kernel::KThread*> signaled;
+    auto it = tree.nfind_key({address, -1});
+    while (it != tree.end() && (count <= 0 || static_cast<s32>(signaled.size()) < count) &&
+           it->GetAddressArbiterKey() == address) {
+        Kernel::KThread* const thread = std::addressof(*it);
+        thread->ClearAddressArbiter();
+        it = tree.erase(it);
+        signaled.push_back(thread);
+    }
+    return signaled;
+}
+
+// Signals one waiter of every address per round, the signaled waiter waits again right after at a
+// lower priority. Returns the signal and wait pairs done per second.
+template <typename GetTree>
+double RunSignalWait(Waiters& waiters, GetTree&& get_tree) {
+    waiters.Wait(get_tree);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < NUM_ROUNDS; ++round) {
+        for (size_t index = 0; index < NUM_ADDRESSES; ++index) {
+            const u64 address = WaitedAddress(index);
+            ThreadTree& tree = get_tree(address);
+            const std::vector<Kernel::KThread*> signaled = Signal(tree, address, 1);
+            REQUIRE(signaled.size() == 1);
+
+            Kernel::KThread& thread = *signaled.front();
+            thread.SetPriority(thread.GetPriority() + static_cast<s32>(WAITERS_PER_ADDRESS));
+            thread.SetAddressArbiter(&tree, address);
+            tree.insert(thread);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    waiters.Cancel();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(NUM_ROUNDS * NUM_ADDRESSES) / seconds;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("KHashedWaiterTrees[Index]", "[core]") {
+    constexpr u64 base = 0x2'0000'0000;
+    REQUIRE(HashedTrees::GetIndex(base) == HashedTrees::GetIndex(base));
+    REQUIRE(HashedTrees::GetIndex(base) != HashedTrees::GetIndex(base + 4));
+    REQUIRE(HashedTrees::GetIndex(base) != HashedTrees::GetIndex(base + 0x1000));
+}
+
+TEST_CASE("KHashedWaiterTrees[SignalOrder]", "[core]") {
+    Core::System system;
+    Waiters waiters{system.Kernel()};
+    HashedTrees trees;
+    waiters.Wait([&](u64 address) -> ThreadTree& { return trees.Get(address); });
+
+    // Every address shares its tree with others, only the waiters of the signaled one wake up,
+    // from the highest priority to the lowest
+    const u64 address = WaitedAddress(0);
+    const std::vector<Kernel::KThread*> signaled = Signal(trees.Get(address), address, 0);
+    REQUIRE(signaled.size() == WAITERS_PER_ADDRESS);
+    for (size_t waiter = 0; waiter < WAITERS_PER_ADDRESS; ++waiter) {
+        REQUIRE(signaled[waiter] == &waiters[waiter * NUM_ADDRESSES]);
+        REQUIRE(!signaled[waiter]->IsWaitingForAddressArbiter());
+    }
+    REQUIRE(Signal(trees.Get(address), address, 0).empty());
+
+    // The others still wait in the tree of their address
+    for (size_t index = 0; index < waiters.size(); ++index) {
+        if (index % NUM_ADDRESSES != 0) {
+            const u64 waited = WaitedAddress(index % NUM_ADDRESSES);
+            REQUIRE(waiters[index].GetConditionVariableTree() == &trees.Get(waited));
+        }
+    }
+    waiters.Cancel();
+    for (size_t index = 0; index < NUM_ADDRESSES; ++index) {
+        REQUIRE(trees.Get(WaitedAddress(index)).empty());
+    }
+}
+
+TEST_CASE("KHashedWaiterTrees[SignalWait]", "[core]") {
+    Core::System system;
+    Waiters single_waiters{system.Kernel()};
+    ThreadTree single_tree;
+    const double single_rate =
+        RunSignalWait(single_waiters, [&](u64) -> ThreadTree& { return single_tree; });
+    REQUIRE(single_tree.empty());
+
+    Waiters hashed_waiters{system.Kernel()};
+    HashedTrees hashed_trees;
+    const double hashed_rate = RunSignalWait(
+        hashed_waiters, [&](u64 address) -> ThreadTree& { return hashed_trees.Get(address); });
+
+    // Waiters were signaled in priority order, so all of them were signaled equally.
+    for (size_t index = 0; index < hashed_waiters.size(); ++index) {
+        const s32 priority = static_cast<s32>(index / NUM_ADDRESSES + NUM_ROUNDS);
+        REQUIRE(single_waiters[index].GetPriority() == priority);
+        REQUIRE(hashed_waiters[index].GetPriority() == priority);
+    }
+    SUCCEED(fmt::format("Signal and wait pairs per second: single tree {:.0f}, hashed trees {:.0f}",
+                        single_rate, hashed_rate));
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/file_sys/ips_layer.h"
+#include "core/file_sys/vfs_vector.h"
+
+namespace {
+FileSys::VirtualFile MakeFile(std::string_view text, std::string name) {
+    return std::make_shared<FileSys::VectorVfsFile>(std::vector<u8>(text.begin(), text.end()),
+                                                    std::move(name));
+}
+} // Anonymous namespace
+
+TEST_CASE("PatchIPS: Records are applied in place", "[core]") {
+    // A standard record of two bytes at 0x2 and an RLE record of three 0xAA at 0x5
+    const std::vector<u8> ips{'P', 'A', 'T', 'C', 'H', 0, 0, 2, 0, 2, 1, 2,
+                              0,   0,   5,   0,   0,   0, 3, 0xAA, 'E', 'O', 'F'};
+    const auto ips_file = std::make_shared<FileSys::VectorVfsFile>(ips, "patch.ips");
+
+    std::vector<u8> data(10, 0);
+    REQUIRE(FileSys::PatchIPS(data, ips_file));
+    const std::vector<u8> expected{0, 0, 1, 2, 0, 0xAA, 0xAA, 0xAA, 0, 0};
+    REQUIRE(data == expected);
+}
+
+TEST_CASE("PatchIPS: Invalid patches leave the data unchanged", "[core]") {
+    // The second record does not fit in the data
+    const std::vector<u8> ips{'P', 'A', 'T', 'C', 'H', 0, 0, 0, 0, 1, 7,
+                              0,   0,   3,   0,   2,   1, 2, 'E', 'O', 'F'};
+    const auto ips_file = std::make_shared<FileSys::VectorVfsFile>(ips, "patch.ips");
+
+    std::vector<u8> data(4, 0);
+    REQUIRE_FALSE(FileSys::PatchIPS(data, ips_file));
+    REQUIRE(data == std::vector<u8>(4, 0));
+}
+
+TEST_CASE("CompileIPSwitch: Patches with the same text are compiled once", "[core]") {
+    constexpr std::string_view text = "@nsobid-0123456789ABCDEF\n"
+                                      "@flag offset_shift 0x0\n"
+                                      "@enabled\n"
+                                      "00000001 0A0B\n"
+                                      "@stop\n";
+    const auto first = FileSys::CompileIPSwitch(MakeFile(text, "first.pchtxt"));
+    const auto second = FileSys::CompileIPSwitch(MakeFile(text, "second.pchtxt"));
+    REQUIRE(first == second);
+    REQUIRE(first->IsValid());
+
+    std::vector<u8> data(4, 0);
+    first->Apply(data);
+    const std::vector<u8> expected{0, 0x0A, 0x0B, 0};
+    REQUIRE(data == expected);
+}
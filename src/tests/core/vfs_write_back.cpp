@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/file_sys/vfs_vector.h"
+#include "core/file_sys/vfs_write_back.h"
+
+TEST_CASE("WriteBackVfsFile: Writes are coalesced until flushed", "[core]") {
+    const auto base = std::make_shared<FileSys::VectorVfsFile>(std::vector<u8>(16, 0));
+    FileSys::WriteBackVfsFile file{base};
+
+    constexpr std::array<u8, 4> first{1, 2, 3, 4};
+    constexpr std::array<u8, 4> second{5, 6, 7, 8};
+    constexpr std::array<u8, 2> overlap{9, 9};
+    REQUIRE(file.Write(first.data(), first.size(), 4) == first.size());
+    REQUIRE(file.Write(second.data(), second.size(), 8) == second.size());
+    REQUIRE(file.Write(overlap.data(), overlap.size(), 7) == overlap.size());
+    REQUIRE(file.GetPendingSize() == 8);
+
+    // Writes past the end grow the file, but nothing reaches the base file yet.
+    REQUIRE(file.Write(first.data(), first.size(), 18) == first.size());
+    REQUIRE(file.GetSize() == 22);
+    REQUIRE(base->ReadAllBytes() == std::vector<u8>(16, 0));
+
+    REQUIRE(file.Flush());
+    REQUIRE(file.GetPendingSize() == 0);
+    const std::vector<u8> expected{0, 0, 0, 0, 1, 2, 3, 9, 9, 6, 7, 8, 0, 0, 0, 0,
+                                   0, 0, 1, 2, 3, 4};
+    REQUIRE(base->ReadAllBytes() == expected);
+
+    // Reads see the writes that were not flushed yet.
+    REQUIRE(file.Write(second.data(), second.size(), 0) == second.size());
+    std::array<u8, 4> data{};
+    REQUIRE(file.Read(data.data(), data.size(), 0) == data.size());
+    REQUIRE(data == second);
+}
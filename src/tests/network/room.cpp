@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "network/network.h"
+#include "network/packet.h"
+#include "network/room.h"
+#include "network/room_member.h"
+#include "network/verify_user.h"
+
+namespace {
+
+template <typename Predicate>
+bool WaitFor(Predicate&& predicate, std::chrono::seconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Network::Packet byte containers", "[network]") {
+    const std::vector<u8> data{1, 2, 3, 4, 5};
+    const std::array<u8, 4> ip{192, 168, 0, 1};
+
+    Network::Packet packet;
+    packet.Reserve(sizeof(u32) + data.size() + ip.size());
+    packet.Write(data);
+    packet.Write(ip);
+    REQUIRE(packet.GetDataSize() == sizeof(u32) + data.size() + ip.size());
+
+    std::vector<u8> read_data;
+    std::array<u8, 4> read_ip{};
+    packet.Read(read_data);
+    packet.Read(read_ip);
+    REQUIRE(packet);
+    REQUIRE(read_data == data);
+    REQUIRE(read_ip == ip);
+
+    // Reading past the end invalidates the packet instead of reading garbage
+    std::array<u8, 4> past_end{};
+    packet.Read(past_end);
+    REQUIRE(!packet);
+}
+
+TEST_CASE("Network::Room relays proxy packets under load", "[.][benchmark]") {
+    constexpr u16 Port = Network::DefaultRoomPort + 1;
+    constexpr std::size_t NumMembers = 8;
+    constexpr std::size_t PacketsPerMember = 100;
+    constexpr std::size_t PayloadSize = 512;
+    constexpr std::size_t ExpectedPackets = NumMembers * (NumMembers - 1) * PacketsPerMember;
+
+    Network::RoomNetwork room_network;
+    REQUIRE(room_network.Init());
+    const auto room = room_network.GetRoom().lock();
+    REQUIRE(room->Create("Load test", "", "127.0.0.1", Port, "", Network::MaxConcurrentConnections,
+                         "", {}, std::make_unique<Network::VerifyUser::NullBackend>()));
+
+    std::atomic<std::size_t> received{};
+    std::vector<std::unique_ptr<Network::RoomMember>> members;
+    for (std::size_t i = 0; i < NumMembers; ++i) {
+        auto& member = members.emplace_back(std::make_unique<Network::RoomMember>());
+        member->BindOnProxyPacketReceived([&received](const Network::ProxyPacket&) {
+            received.fetch_add(1, std::memory_order_relaxed);
+        });
+        member->Join(fmt::format("member{}", i), "127.0.0.1", Port);
+    }
+    REQUIRE(WaitFor(
+        [&members] {
+            for (const auto& member : members) {
+                if (member->GetState() != Network::RoomMember::State::Joined) {
+                    return false;
+                }
+            }
+            return true;
+        },
+        std::chrono::seconds{5}));
+
+    const Network::ProxyPacket proxy_packet{
+        .local_endpoint{Network::Domain::INET, {192, 168, 0, 1}, 1234},
+        .remote_endpoint{Network::Domain::INET, {255, 255, 255, 255}, 1234},
+        .protocol = Network::Protocol::UDP,
+        .broadcast = true,
+        .data = std::vector<u8>(PayloadSize, 0xAB),
+    };
+
+    BENCHMARK("8 members broadcasting 100 packets each") {
+        received = 0;
+        for (std::size_t i = 0; i < PacketsPerMember; ++i) {
+            for (const auto& member : members) {
+                member->SendProxyPacket(proxy_packet);
+            }
+        }
+        WaitFor([&received] { return received.load() == ExpectedPackets; },
+                std::chrono::seconds{10});
+        return received.load();
+    };
+    REQUIRE(received.load() == ExpectedPackets);
+
+    for (const auto& member : members) {
+        member->Leave();
+    }
+    room->Destroy();
+    room_network.Shutdown();
+}
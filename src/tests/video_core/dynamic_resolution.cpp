@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/dynamic_resolution.h"
+
+namespace {
+using namespace std::chrono_literals;
+
+/// Frame time of a 30 FPS target
+constexpr std::chrono::nanoseconds TARGET{33'333'333};
+/// Pixels of a 2x resolution relative to native
+constexpr f32 SCALE_AREA = 4.0f;
+
+bool RunFrames(VideoCommon::DynamicResolution& controller, std::chrono::nanoseconds gpu_time,
+               u32 num_frames) {
+    bool is_native = controller.IsNative();
+    for (u32 frame = 0; frame < num_frames; ++frame) {
+        is_native = controller.Update(gpu_time, TARGET, SCALE_AREA);
+    }
+    return is_native;
+}
+} // Anonymous namespace
+
+TEST_CASE("DynamicResolution: Holds the resolution under the target", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(!RunFrames(controller, 30ms, 600));
+}
+
+TEST_CASE("DynamicResolution: Drops to native over the target", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(!RunFrames(controller, 40ms, 10));
+    REQUIRE(RunFrames(controller, 40ms, 30));
+}
+
+TEST_CASE("DynamicResolution: Goes back up only with headroom", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(RunFrames(controller, 40ms, 60));
+
+    // Native frames of 8 ms are estimated at 32 ms upscaled, too close to the target
+    REQUIRE(RunFrames(controller, 8ms, 600));
+
+    // Native frames of 5 ms are estimated at 20 ms upscaled
+    REQUIRE(!RunFrames(controller, 5ms, 600));
+}
+
+TEST_CASE("DynamicResolution: Waits between switches", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(RunFrames(controller, 40ms, 60));
+    REQUIRE(RunFrames(controller, 5ms, 100));
+    REQUIRE(!RunFrames(controller, 5ms, 100));
+}
+
+TEST_CASE("DynamicResolution: Resets to the configured resolution", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(RunFrames(controller, 40ms, 60));
+    controller.Reset();
+    REQUIRE(!controller.IsNative());
+
+    // The frames since the last switch start over, so a few slow ones are not enough to drop
+    REQUIRE(!RunFrames(controller, 40ms, 10));
+}
+
+TEST_CASE("DynamicResolution: Ignores frames without timed work", "[video_core]") {
+    VideoCommon::DynamicResolution controller;
+    REQUIRE(RunFrames(controller, 40ms, 60));
+    REQUIRE(RunFrames(controller, 0ns, 600));
+}
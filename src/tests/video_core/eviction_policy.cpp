@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/eviction_policy.h"
+
+namespace {
+using VideoCommon::EvictionCandidate;
+namespace EvictionCostModel = VideoCommon::EvictionCostModel;
+
+constexpr u64 MiB = 1ULL << 20;
+
+constexpr EvictionCandidate MakeCandidate(u64 size_bytes, u64 age) {
+    return EvictionCandidate{
+        .size_bytes = size_bytes,
+        .load_time_us = 0,
+        .age = age,
+        .costly_load = false,
+        .must_download = false,
+    };
+}
+} // Anonymous namespace
+
+TEST_CASE("EvictionCostModel: Ordering", "[video_core]") {
+    const EvictionCandidate plain = MakeCandidate(16 * MiB, 60);
+
+    EvictionCandidate older = plain;
+    older.age = 600;
+    REQUIRE(EvictionCostModel::Score(older) < EvictionCostModel::Score(plain));
+
+    EvictionCandidate costly = plain;
+    costly.costly_load = true;
+    REQUIRE(EvictionCostModel::Score(costly) > EvictionCostModel::Score(plain));
+
+    EvictionCandidate measured = plain;
+    measured.load_time_us = 100'000;
+    REQUIRE(EvictionCostModel::Score(measured) > EvictionCostModel::Score(costly));
+
+    EvictionCandidate download = plain;
+    download.must_download = true;
+    REQUIRE(EvictionCostModel::Score(download) > EvictionCostModel::Score(plain));
+}
+
+TEST_CASE("EvictionCostModel: Pressure and budget", "[video_core]") {
+    REQUIRE(EvictionCostModel::Pressure(100, 200, 400) == 0.0);
+    REQUIRE(EvictionCostModel::Pressure(300, 200, 400) == 0.5);
+    REQUIRE(EvictionCostModel::Pressure(500, 200, 400) == 1.0);
+
+    REQUIRE(EvictionCostModel::Budget(0.0) == 0.0);
+    REQUIRE(EvictionCostModel::Budget(0.5) == EvictionCostModel::BASE_BUDGET_PER_MIB);
+    REQUIRE(EvictionCostModel::Budget(0.75) > EvictionCostModel::Budget(0.5));
+    REQUIRE(EvictionCostModel::Budget(1.0) > EvictionCostModel::Score(MakeCandidate(MiB, 0)));
+}
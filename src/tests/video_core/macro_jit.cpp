@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "tests/video_core/maxwell_3d_context.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro.h"
+#include "video_core/macro/macro_interpreter.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include "video_core/macro/macro_jit_x64.h"
+#else
+#include "video_core/macro/macro_jit_arm64.h"
+#endif
+
+namespace {
+#ifdef ARCHITECTURE_x86_64
+using MacroJIT = Tegra::MacroJITx64;
+#else
+using MacroJIT = Tegra::MacroJITArm64;
+#endif
+
+using Tegra::Macro::ALUOperation;
+using Tegra::Macro::BranchCondition;
+using Tegra::Macro::Opcode;
+using Tegra::Macro::Operation;
+using Tegra::Macro::ResultOperation;
+
+// Macros only send to and read from the shadow scratch registers, writing to any other method
+// would reach the rasterizer which is not available in tests.
+constexpr u32 SCRATCH_METHOD = 0xD00;
+constexpr u32 EXIT = 1U << 7;
+
+u32 Alu(ALUOperation alu, ResultOperation result, u32 dst, u32 src_a, u32 src_b) {
+    Opcode op{};
+    op.operation.Assign(Operation::ALU);
+    op.alu_operation.Assign(alu);
+    op.result_operation.Assign(result);
+    op.dst.Assign(dst);
+    op.src_a.Assign(src_a);
+    op.src_b.Assign(src_b);
+    return op.raw;
+}
+
+u32 Immediate(Operation operation, ResultOperation result, u32 dst, u32 src_a, s32 imm) {
+    Opcode op{};
+    op.operation.Assign(operation);
+    op.result_operation.Assign(result);
+    op.dst.Assign(dst);
+    op.src_a.Assign(src_a);
+    op.immediate.Assign(imm);
+    return op.raw;
+}
+
+u32 AddImm(ResultOperation result, u32 dst, u32 src_a, s32 imm) {
+    return Immediate(Operation::AddImmediate, result, dst, src_a, imm);
+}
+
+u32 Bitfield(Operation operation, ResultOperation result, u32 dst, u32 src_a, u32 src_b,
+             u32 src_bit, u32 size, u32 dst_bit) {
+    Opcode op{};
+    op.operation.Assign(operation);
+    op.result_operation.Assign(result);
+    op.dst.Assign(dst);
+    op.src_a.Assign(src_a);
+    op.src_b.Assign(src_b);
+    op.bf_src_bit.Assign(src_bit);
+    op.bf_size.Assign(size);
+    op.bf_dst_bit.Assign(dst_bit);
+    return op.raw;
+}
+
+u32 Branch(BranchCondition cond, bool annul, u32 src_a, s32 offset) {
+    Opcode op{};
+    op.operation.Assign(Operation::Branch);
+    op.branch_condition.Assign(cond);
+    op.branch_annul.Assign(annul ? 1 : 0);
+    op.src_a.Assign(src_a);
+    op.immediate.Assign(offset);
+    return op.raw;
+}
+
+u32 SetScratchMethod(u32 offset) {
+    return AddImm(ResultOperation::MoveAndSetMethod, 7, 0,
+                  static_cast<s32>((SCRATCH_METHOD + offset) | (1U << 12)));
+}
+
+class MacroFixture {
+public:
+    /// Runs a macro on the interpreter and the JIT and checks that both left the same state
+    void RequireSameResult(const std::vector<u32>& code,
+                           const std::vector<std::vector<u32>>& runs) {
+        Tegra::Engines::Maxwell3D interpreted_maxwell3d{context.system, context.gpu_memory};
+        Tegra::Engines::Maxwell3D jitted_maxwell3d{context.system, context.gpu_memory};
+        Tegra::MacroInterpreter interpreter{interpreted_maxwell3d};
+        MacroJIT jit{jitted_maxwell3d};
+        for (const u32 word : code) {
+            interpreter.AddCode(0, word);
+            jit.AddCode(0, word);
+        }
+        for (const std::vector<u32>& parameters : runs) {
+            interpreter.Execute(0, parameters);
+            jit.Execute(0, parameters);
+            REQUIRE(std::ranges::equal(interpreted_maxwell3d.regs.shadow_scratch,
+                                       jitted_maxwell3d.regs.shadow_scratch));
+        }
+        REQUIRE(std::ranges::any_of(jitted_maxwell3d.regs.shadow_scratch,
+                                    [](u32 value) { return value != 0; }));
+    }
+
+    /// Times repeated runs of a macro on the interpreter and on the JIT
+    void Benchmark(const std::vector<u32>& code, const std::vector<u32>& parameters) {
+        Tegra::Engines::Maxwell3D interpreted_maxwell3d{context.system, context.gpu_memory};
+        Tegra::Engines::Maxwell3D jitted_maxwell3d{context.system, context.gpu_memory};
+        Tegra::MacroInterpreter interpreter{interpreted_maxwell3d};
+        MacroJIT jit{jitted_maxwell3d};
+        for (const u32 word : code) {
+            interpreter.AddCode(0, word);
+            jit.AddCode(0, word);
+        }
+        BENCHMARK("Interpreter") {
+            interpreter.Execute(0, parameters);
+        };
+        BENCHMARK("JIT") {
+            jit.Execute(0, parameters);
+        };
+    }
+
+private:
+    Tests::Maxwell3DContext context;
+};
+} // Anonymous namespace
+
+TEST_CASE("MacroJIT: ALU and carry", "[video_core]") {
+    const std::vector<u32> code{
+        SetScratchMethod(0),
+        AddImm(ResultOperation::IgnoreAndFetch, 2, 0, 0),
+        Alu(ALUOperation::Add, ResultOperation::MoveAndSend, 3, 1, 2),
+        Alu(ALUOperation::AddWithCarry, ResultOperation::MoveAndSend, 4, 1, 2),
+        Alu(ALUOperation::Subtract, ResultOperation::MoveAndSend, 5, 1, 2),
+        Alu(ALUOperation::SubtractWithBorrow, ResultOperation::MoveAndSend, 6, 2, 1),
+        Alu(ALUOperation::Xor, ResultOperation::MoveAndSend, 3, 1, 2),
+        Alu(ALUOperation::AndNot, ResultOperation::MoveAndSend, 3, 1, 2),
+        Alu(ALUOperation::Nand, ResultOperation::MoveAndSend, 3, 1, 2),
+        AddImm(ResultOperation::FetchAndSend, 3, 1, -5),
+        Alu(ALUOperation::Or, ResultOperation::MoveAndSend, 0, 3, 0) | EXIT,
+        AddImm(ResultOperation::MoveAndSend, 0, 3, 1),
+    };
+    MacroFixture fixture;
+    fixture.RequireSameResult(code, {
+                                        {0xFFFFFFF0, 0x20, 0x1234},
+                                        {5, 7, 9},
+                                        {0x80000000, 0x80000000, 0},
+                                    });
+}
+
+TEST_CASE("MacroJIT: Branch delay slots", "[video_core]") {
+    const std::vector<u32> code{
+        SetScratchMethod(0),
+        AddImm(ResultOperation::Move, 2, 0, 0),
+        Alu(ALUOperation::Add, ResultOperation::Move, 2, 2, 1),
+        AddImm(ResultOperation::Move, 1, 1, -1),
+        Branch(BranchCondition::NotZero, false, 1, -2),
+        Alu(ALUOperation::Add, ResultOperation::MoveAndSend, 0, 2, 0),
+        Alu(ALUOperation::Add, ResultOperation::MoveAndSend, 0, 2, 0) | EXIT,
+        AddImm(ResultOperation::Move, 0, 0, 0),
+    };
+    MacroFixture fixture;
+    fixture.RequireSameResult(code, {{4}, {1}, {9}});
+}
+
+TEST_CASE("MacroJIT: Bitfields and reads", "[video_core]") {
+    const std::vector<u32> code{
+        SetScratchMethod(0x10),
+        AddImm(ResultOperation::IgnoreAndFetch, 2, 0, 0),
+        Bitfield(Operation::ExtractInsert, ResultOperation::MoveAndSend, 3, 1, 1, 4, 8, 28),
+        Bitfield(Operation::ExtractShiftLeftImmediate, ResultOperation::MoveAndSend, 3, 2, 1, 0,
+                 12, 3),
+        Bitfield(Operation::ExtractShiftLeftRegister, ResultOperation::MoveAndSend, 3, 2, 1, 30,
+                 5, 0),
+        Branch(BranchCondition::Zero, true, 0, 2),
+        AddImm(ResultOperation::MoveAndSend, 0, 0, 0x3333),
+        Immediate(Operation::Read, ResultOperation::Move, 4, 0,
+                  static_cast<s32>(SCRATCH_METHOD + 0x10)),
+        Alu(ALUOperation::Add, ResultOperation::MoveAndSend, 0, 4, 0) | EXIT,
+        AddImm(ResultOperation::MoveAndSend, 0, 4, 1),
+    };
+    MacroFixture fixture;
+    fixture.RequireSameResult(code, {
+                                        {0xDEADBEEF, 3},
+                                        {0x12345678, 31},
+                                        {0xFFFFFFFF, 0},
+                                    });
+}
+
+TEST_CASE("MacroJIT[InterpreterBenchmark]", "[.][benchmark]") {
+    // Sends a value for each iteration of a loop, like the macros that fill constant buffers
+    const std::vector<u32> code{
+        SetScratchMethod(0),
+        AddImm(ResultOperation::Move, 2, 0, 0),
+        Alu(ALUOperation::Add, ResultOperation::Move, 2, 2, 1),
+        Bitfield(Operation::ExtractInsert, ResultOperation::MoveAndSend, 3, 2, 1, 4, 8, 16),
+        AddImm(ResultOperation::Move, 1, 1, -1),
+        Branch(BranchCondition::NotZero, false, 1, -3),
+        Alu(ALUOperation::Xor, ResultOperation::Move, 4, 2, 3),
+        Alu(ALUOperation::Add, ResultOperation::MoveAndSend, 0, 4, 0) | EXIT,
+        AddImm(ResultOperation::Move, 0, 0, 0),
+    };
+    MacroFixture fixture;
+    fixture.Benchmark(code, {64});
+}
+
+#endif // defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
@@ -0,0 +1,23 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/memory_manager.h"
+
+namespace Tests {
+
+/// System and GPU memory that Maxwell3D engines can be created on, without a renderer
+struct Maxwell3DContext {
+    Maxwell3DContext() : memory{device_memory}, gpu_memory{system, memory} {}
+
+    Core::System system;
+    Core::DeviceMemory device_memory;
+    Tegra::MaxwellDeviceMemoryManager memory;
+    Tegra::MemoryManager gpu_memory;
+};
+
+} // namespace Tests
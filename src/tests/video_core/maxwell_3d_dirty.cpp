@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "tests/video_core/maxwell_3d_context.h"
+#include "video_core/engines/maxwell_3d.h"
+
+namespace {
+using Tegra::Engines::Maxwell3D;
+
+void SetupTables(Maxwell3D& maxwell3d) {
+    auto& tables = maxwell3d.dirty.tables;
+    for (u32 method = 0; method < Maxwell3D::Regs::NUM_REGS; ++method) {
+        tables[0][method] = static_cast<u8>(1 + method % 7);
+        tables[1][method] = static_cast<u8>(method % 3 == 0 ? 0 : 8 + method / 64);
+    }
+}
+
+void WriteSink(Maxwell3D& maxwell3d) {
+    for (u32 method = 0x200; method < 0x300; method += 5) {
+        maxwell3d.method_sink.emplace_back(method, method * 3 + 1);
+    }
+    // Writes that don't change their register must not mark anything as dirty
+    maxwell3d.method_sink.emplace_back(0x400, maxwell3d.regs.reg_array[0x400]);
+    maxwell3d.ConsumeSink();
+}
+} // Anonymous namespace
+
+TEST_CASE("Maxwell3D: Batched dirty flags", "[video_core]") {
+    Tests::Maxwell3DContext context;
+    Maxwell3D per_write{context.system, context.gpu_memory};
+    Maxwell3D batched{context.system, context.gpu_memory};
+    SetupTables(per_write);
+    SetupTables(batched);
+    batched.dirty.BuildMasks();
+
+    per_write.dirty.flags.reset();
+    batched.dirty.flags.reset();
+    WriteSink(per_write);
+    WriteSink(batched);
+
+    REQUIRE(batched.dirty.flags.any());
+    REQUIRE(per_write.dirty.flags == batched.dirty.flags);
+    REQUIRE(per_write.regs.reg_array == batched.regs.reg_array);
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/multi_level_page_table.h"
+
+namespace {
+constexpr u64 ADDRESS_SPACE_BITS = 40;
+constexpr u64 PAGE_BITS = 12;
+constexpr u64 PAGE_SIZE = 1ULL << PAGE_BITS;
+constexpr u64 PAGE_MASK = PAGE_SIZE - 1;
+constexpr GPUVAddr GPU_BASE = 0x4'0000'0000;
+constexpr DAddr DEVICE_BASE = 0x1'0000'0000;
+constexpr u64 NUM_PAGES = 64;
+
+/// Translates small pages like Tegra::MemoryManager::GpuToCpuAddress
+class PageTable {
+public:
+    PageTable() : table{ADDRESS_SPACE_BITS, ADDRESS_SPACE_BITS + PAGE_BITS - 38, PAGE_BITS} {
+        entries.resize((1ULL << (ADDRESS_SPACE_BITS - PAGE_BITS)) / 64);
+        table.ReserveRange(GPU_BASE, NUM_PAGES * PAGE_SIZE);
+        for (u64 page = 0; page < NUM_PAGES; ++page) {
+            const u64 index = (GPU_BASE >> PAGE_BITS) + page;
+            entries[index / 64] |= 1ULL << (index % 64);
+            table[index] = static_cast<u32>((DEVICE_BASE >> PAGE_BITS) + page * 3);
+        }
+    }
+
+    DAddr Translate(GPUVAddr gpu_addr) const {
+        const u64 index = gpu_addr >> PAGE_BITS;
+        if (((entries[index / 64] >> (index % 64)) & 1) == 0) {
+            return 0;
+        }
+        return (static_cast<DAddr>(table[index]) << PAGE_BITS) + (gpu_addr & PAGE_MASK);
+    }
+
+private:
+    std::vector<u64> entries;
+    Common::MultiLevelPageTable<u32> table;
+};
+
+/// Direct mapped software TLB in front of the page table
+class CachedPageTable {
+public:
+    explicit CachedPageTable(const PageTable& page_table_) : page_table{page_table_} {}
+
+    DAddr Translate(GPUVAddr gpu_addr) {
+        const u64 page = gpu_addr >> PAGE_BITS;
+        Entry& entry = cache[page % cache.size()];
+        if (entry.page != page) {
+            entry.page = page;
+            entry.dev_page_addr = page_table.Translate(gpu_addr & ~PAGE_MASK);
+        }
+        return entry.dev_page_addr + (gpu_addr & PAGE_MASK);
+    }
+
+private:
+    struct Entry {
+        u64 page = ~0ULL;
+        DAddr dev_page_addr = 0;
+    };
+
+    const PageTable& page_table;
+    std::array<Entry, 256> cache{};
+};
+
+} // Anonymous namespace
+
+// The GPU page tables are flat arrays reserved in virtual memory, so an uncached translation is a
+// bitmap test and a single load. This compares it against a software TLB to tell whether caching
+// translations in Tegra::MemoryManager is worth it.
+TEST_CASE("MemoryManagerTranslation[Benchmark]", "[.][benchmark]") {
+    const PageTable page_table;
+    CachedPageTable cached_page_table{page_table};
+    for (u64 page = 0; page < NUM_PAGES; ++page) {
+        const GPUVAddr gpu_addr = GPU_BASE + page * PAGE_SIZE + 0x40;
+        REQUIRE(cached_page_table.Translate(gpu_addr) == page_table.Translate(gpu_addr));
+    }
+
+    // Repeated lookups of the same pages, like the bindings of consecutive draws.
+    BENCHMARK("Page table") {
+        DAddr sum = 0;
+        for (u64 page = 0; page < NUM_PAGES; ++page) {
+            sum += page_table.Translate(GPU_BASE + page * PAGE_SIZE + 0x40);
+        }
+        return sum;
+    };
+    BENCHMARK("Software TLB") {
+        DAddr sum = 0;
+        for (u64 page = 0; page < NUM_PAGES; ++page) {
+            sum += cached_page_table.Translate(GPU_BASE + page * PAGE_SIZE + 0x40);
+        }
+        return sum;
+    };
+}
@@ -4,7 +4,9 @@
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/alignment.h"
@@ -546,3 +548,72 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Sparse modifications") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    constexpr u64 size = HIGH_PAGE_SIZE * 64;
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    REQUIRE(!memory_track->IsRegionCpuModified(c, size));
+    memory_track->MarkRegionAsCpuModified(c + HIGH_PAGE_SIZE * 7 + WORD * 3 + PAGE * 5, PAGE);
+    memory_track->MarkRegionAsCpuModified(c + HIGH_PAGE_SIZE * 40 + WORD * 14 + PAGE * 63,
+                                          PAGE * 2);
+    REQUIRE(memory_track->IsRegionCpuModified(c, size));
+    REQUIRE(!memory_track->IsRegionCpuModified(c + HIGH_PAGE_SIZE * 8, HIGH_PAGE_SIZE * 32));
+    REQUIRE(memory_track->ModifiedCpuRegion(c + HIGH_PAGE_SIZE * 8, HIGH_PAGE_SIZE * 40) ==
+            Range{c + HIGH_PAGE_SIZE * 40 + WORD * 14 + PAGE * 63,
+                  c + HIGH_PAGE_SIZE * 40 + WORD * 15 + PAGE * 1});
+    std::vector<Range> ranges;
+    memory_track->ForEachUploadRange(c, size, [&](u64 offset, u64 range_size) {
+        ranges.emplace_back(offset, offset + range_size);
+    });
+    REQUIRE(ranges == std::vector<Range>{
+                          {c + HIGH_PAGE_SIZE * 7 + WORD * 3 + PAGE * 5,
+                           c + HIGH_PAGE_SIZE * 7 + WORD * 3 + PAGE * 6},
+                          {c + HIGH_PAGE_SIZE * 40 + WORD * 14 + PAGE * 63,
+                           c + HIGH_PAGE_SIZE * 40 + WORD * 15 + PAGE * 1},
+                      });
+    REQUIRE(!memory_track->IsRegionCpuModified(c, size));
+    REQUIRE(rasterizer.Count() == size / PAGE);
+}
+
+TEST_CASE("WordManager: Sparse modifications in large buffers") {
+    RasterizerInterface rasterizer;
+    constexpr u64 num_words = 200;
+    VideoCommon::WordManager<RasterizerInterface> manager(c, rasterizer, WORD * num_words);
+    manager.ChangeRegionState<VideoCommon::Type::CPU, false>(c, WORD * num_words);
+    REQUIRE(!manager.IsRegionModified<VideoCommon::Type::CPU>(0, WORD * num_words));
+    manager.ChangeRegionState<VideoCommon::Type::GPU, true>(c + WORD * 130 + PAGE * 2, PAGE);
+    REQUIRE(manager.ModifiedRegion<VideoCommon::Type::GPU>(0, WORD * num_words) ==
+            Range{WORD * 130 + PAGE * 2, WORD * 130 + PAGE * 3});
+    REQUIRE(!manager.IsRegionModified<VideoCommon::Type::GPU>(0, WORD * 130));
+    manager.ChangeRegionState<VideoCommon::Type::GPU, false>(c + WORD * 130, WORD);
+    REQUIRE(!manager.IsRegionModified<VideoCommon::Type::GPU>(0, WORD * num_words));
+    manager.ChangeRegionState<VideoCommon::Type::CPU, true>(c + WORD * 199, PAGE);
+    REQUIRE(manager.IsRegionModified<VideoCommon::Type::CPU>(0, WORD * num_words));
+    REQUIRE(manager.ModifiedRegion<VideoCommon::Type::CPU>(0, WORD * num_words) ==
+            Range{WORD * 199, WORD * 199 + PAGE});
+    manager.ChangeRegionState<VideoCommon::Type::CPU, true>(c, WORD * num_words);
+}
+
+TEST_CASE("MemoryTracker: Benchmark sparse queries", "[.][benchmark]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    constexpr u64 size = HIGH_PAGE_SIZE * 128;
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    for (u64 offset = 0; offset < size; offset += HIGH_PAGE_SIZE * 17) {
+        memory_track->MarkRegionAsCpuModified(c + offset, PAGE);
+    }
+    BENCHMARK("IsRegionCpuModified 64 MiB clean") {
+        return memory_track->IsRegionCpuModified(c + PAGE, HIGH_PAGE_SIZE * 16);
+    };
+    BENCHMARK("ModifiedCpuRegion 512 MiB sparse") {
+        return memory_track->ModifiedCpuRegion(c, size);
+    };
+    BENCHMARK("ForEachDownloadRange 512 MiB sparse") {
+        u64 total = 0;
+        memory_track->ForEachDownloadRange(
+            c, size, false, [&](u64 offset, u64 range_size) { total += range_size; });
+        return total;
+    };
+}
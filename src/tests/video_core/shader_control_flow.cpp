@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "shader_recompiler/backend/glasm/emit_glasm.h"
+#include "shader_recompiler/backend/glsl/emit_glsl.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/location.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+
+namespace {
+using Shader::Maxwell::Location;
+
+constexpr u64 PT = 7;
+constexpr u64 FLOW_TEST_T = 15;
+
+constexpr u64 MakeMov32I(u32 reg, u32 value) {
+    return (0x010ULL << 52) | (static_cast<u64>(value) << 20) | (PT << 16) | (0xfULL << 12) | reg;
+}
+
+constexpr u64 MakeS2RThreadId(u32 reg) {
+    constexpr u64 SR_TID_X = 33;
+    return (0x1E19ULL << 51) | (SR_TID_X << 20) | (PT << 16) | reg;
+}
+
+constexpr u64 MakeIAdd32I(u32 dest_reg, u32 src_reg, u32 value) {
+    return (0x0EULL << 57) | (static_cast<u64>(value) << 20) | (PT << 16) |
+           (static_cast<u64>(src_reg) << 8) | dest_reg;
+}
+
+/// ISETP.LT.AND pred, PT, reg, value, PT
+constexpr u64 MakeISetPLessThan(u32 pred, u32 reg, u32 value) {
+    constexpr u64 LESS_THAN = 1;
+    return (0x1BULL << 57) | (0x6ULL << 52) | (LESS_THAN << 49) | (PT << 39) |
+           (static_cast<u64>(value & 0x7ffff) << 20) | (PT << 16) |
+           (static_cast<u64>(reg) << 8) | (static_cast<u64>(pred) << 3) | PT;
+}
+
+constexpr u64 MakeBranch(u32 pred, Location pc, Location target) {
+    const u64 offset = static_cast<u64>(target.Offset() - pc.Offset() - 8) & 0xffffff;
+    return (0xE24ULL << 52) | (offset << 20) | (static_cast<u64>(pred) << 16) | FLOW_TEST_T;
+}
+
+constexpr u64 MakeExit() {
+    return (0xE30ULL << 52) | (PT << 16) | FLOW_TEST_T;
+}
+
+/// Work done by each section of the branchy shader before its branch
+enum class SectionWork {
+    /// Moves a constant to a register, most of it is folded away
+    Constants,
+    /// Computes values from the thread id that stay live, so the emitters have work
+    LiveValues,
+};
+
+/// Compute shader made of sections that conditionally skip forward or loop back over others
+class BranchyEnvironment final : public Shader::Environment {
+public:
+    explicit BranchyEnvironment(size_t num_sections, SectionWork work = SectionWork::Constants) {
+        stage = Shader::Stage::Compute;
+
+        constexpr u32 NUM_REGS = 8;
+        const bool live_values = work == SectionWork::LiveValues;
+        const int section_size = live_values ? 3 : 2;
+        Location pc{0};
+        if (live_values) {
+            for (u32 reg = 0; reg < NUM_REGS; ++reg) {
+                Write(pc, MakeS2RThreadId(reg));
+                ++pc;
+            }
+        }
+        std::vector<Location> sections;
+        for (size_t section = 0; section <= num_sections; ++section) {
+            sections.push_back(pc);
+            pc = pc + section_size;
+        }
+        for (size_t section = 0; section < num_sections; ++section) {
+            const Location begin{sections[section]};
+            const Location branch{begin + (section_size - 1)};
+            const u32 reg{static_cast<u32>(section % NUM_REGS)};
+            const u32 pred{static_cast<u32>(section % 7)};
+            const u32 value{static_cast<u32>(section)};
+            if (live_values) {
+                Write(begin, MakeIAdd32I(reg, (reg + 1) % NUM_REGS, value));
+                Write(begin + 1, MakeISetPLessThan(pred, reg, value * 3));
+            } else {
+                Write(begin, MakeMov32I(reg, value));
+            }
+            if (section % 16 == 15) {
+                // Loop over the previous sections; loops are nested, never overlapping
+                Write(branch, MakeBranch(pred, branch, sections[section - 15]));
+            } else {
+                // Skip a few sections ahead, staying inside the innermost enclosing loop
+                const size_t jump_end = section - section % 16 + 15;
+                const size_t target =
+                    std::min({section + 2 + section % 5, jump_end, num_sections});
+                Write(branch, MakeBranch(pred, branch, sections[target]));
+            }
+        }
+        Write(sections[num_sections], MakeExit());
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        return address / 8 < code.size() ? code[address / 8] : 0;
+    }
+
+    u32 ReadCbufValue(u32, u32) override {
+        return 0;
+    }
+
+    Shader::TextureType ReadTextureType(u32) override {
+        return Shader::TextureType::Color2D;
+    }
+
+    Shader::TexturePixelFormat ReadTexturePixelFormat(u32) override {
+        return Shader::TexturePixelFormat::A8B8G8R8_UNORM;
+    }
+
+    bool IsTexturePixelFormatInteger(u32) override {
+        return false;
+    }
+
+    u32 ReadViewportTransformState() override {
+        return 0;
+    }
+
+    u32 TextureBoundBuffer() const override {
+        return 0;
+    }
+
+    u32 LocalMemorySize() const override {
+        return 0;
+    }
+
+    u32 SharedMemorySize() const override {
+        return 0;
+    }
+
+    std::array<u32, 3> WorkgroupSize() const override {
+        return {1, 1, 1};
+    }
+
+    bool HasHLEMacroState() const override {
+        return false;
+    }
+
+    std::optional<Shader::ReplaceConstant> GetReplaceConstBuffer(u32, u32) override {
+        return std::nullopt;
+    }
+
+    void Dump(u64, u64) override {}
+
+private:
+    void Write(Location pc, u64 instruction) {
+        const size_t index = pc.Offset() / 8;
+        if (code.size() <= index) {
+            code.resize(index + 1);
+        }
+        code[index] = instruction;
+    }
+
+    std::vector<u64> code;
+};
+
+struct TranslatedProgram {
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block_pool;
+    Shader::ObjectPool<Shader::IR::Inst> inst_pool;
+    Shader::ObjectPool<Shader::IR::Block> block_pool;
+    Shader::IR::Program program;
+};
+
+size_t CountPhis(const Shader::IR::Program& program) {
+    size_t num_phis = 0;
+    for (const Shader::IR::Block* const block : program.blocks) {
+        const auto& insts{block->Instructions()};
+        num_phis += static_cast<size_t>(std::ranges::count_if(insts, Shader::IR::IsPhi));
+    }
+    return num_phis;
+}
+
+std::unique_ptr<TranslatedProgram> Translate(BranchyEnvironment& env) {
+    auto result{std::make_unique<TranslatedProgram>()};
+    Shader::Maxwell::Flow::CFG cfg{env, result->flow_block_pool, Location{0}};
+    result->program =
+        Shader::Maxwell::TranslateProgram(result->inst_pool, result->block_pool, env, cfg, {});
+    return result;
+}
+
+/// Runs the emitter on programs translated ahead of each run, as emitting modifies the program
+template <typename Emit>
+void BenchmarkEmit(Catch::Benchmark::Chronometer meter, BranchyEnvironment& env, Emit&& emit) {
+    std::vector<std::unique_ptr<TranslatedProgram>> programs;
+    for (int run = 0; run < meter.runs(); ++run) {
+        programs.push_back(Translate(env));
+    }
+    meter.measure([&](int run) { return emit(programs[run]->program).size(); });
+}
+} // Anonymous namespace
+
+TEST_CASE("Shader::Maxwell: Structures branchy control flow", "[video_core]") {
+    // Each goto variable gets a phi at the merges back to its reset, quadratic in the sections.
+    // The trivial ones must all be removed, leaving a number of phis linear in the sections.
+    BranchyEnvironment small_env{64};
+    BranchyEnvironment large_env{256};
+    const auto small_program{Translate(small_env)};
+    const auto large_program{Translate(large_env)};
+    const size_t small_phis = CountPhis(small_program->program);
+    REQUIRE(small_phis > 0);
+    REQUIRE(CountPhis(large_program->program) <= small_phis * 5);
+    REQUIRE(large_program->program.blocks.size() <= small_program->program.blocks.size() * 5);
+}
+
+TEST_CASE("Shader::Maxwell: Structuring large shaders", "[.][benchmark]") {
+    for (const size_t num_sections : {size_t{256}, size_t{1024}, size_t{4096}}) {
+        BranchyEnvironment env{num_sections};
+        BENCHMARK("Translate " + std::to_string(num_sections) + " sections") {
+            return Translate(env)->program.blocks.size();
+        };
+    }
+}
+
+TEST_CASE("Shader::Backend: Emitting text shaders", "[.][benchmark]") {
+    const Shader::Profile profile{
+        .support_gl_variable_aoffi = true,
+        .support_gl_sparse_textures = true,
+        .support_gl_derivative_control = true,
+    };
+    BranchyEnvironment env{1024, SectionWork::LiveValues};
+    BENCHMARK_ADVANCED("GLSL 1024 sections")(Catch::Benchmark::Chronometer meter) {
+        BenchmarkEmit(meter, env, [&](Shader::IR::Program& program) {
+            return Shader::Backend::GLSL::EmitGLSL(profile, program);
+        });
+    };
+    BENCHMARK_ADVANCED("GLASM 1024 sections")(Catch::Benchmark::Chronometer meter) {
+        BenchmarkEmit(meter, env, [&](Shader::IR::Program& program) {
+            return Shader::Backend::GLASM::EmitGLASM(profile, {}, program);
+        });
+    };
+}
+
+TEST_CASE("Shader::Backend: Emitting SPIR-V shaders", "[.][benchmark]") {
+    const Shader::Profile profile{
+        .supported_spirv = 0x00010300,
+        .support_float_controls = true,
+    };
+    // Small shaders are dominated by the setup of the emit context, large ones by the code
+    for (const size_t num_sections : {size_t{16}, size_t{1024}}) {
+        BranchyEnvironment env{num_sections, SectionWork::LiveValues};
+        const std::string name{"SPIR-V " + std::to_string(num_sections) + " sections"};
+        BENCHMARK_ADVANCED(name)(Catch::Benchmark::Chronometer meter) {
+            BenchmarkEmit(meter, env, [&](Shader::IR::Program& program) {
+                return Shader::Backend::SPIRV::EmitSPIRV(profile, program);
+            });
+        };
+    }
+}
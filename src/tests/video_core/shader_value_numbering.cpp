@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace {
+using namespace Shader;
+
+/// Program where the entry block branches to two sides that join at the merge block
+struct Diamond {
+    Diamond()
+        : entry{block_pool.Create(inst_pool)}, then_block{block_pool.Create(inst_pool)},
+          else_block{block_pool.Create(inst_pool)}, merge{block_pool.Create(inst_pool)} {
+        entry->AddBranch(then_block);
+        entry->AddBranch(else_block);
+        then_block->AddBranch(merge);
+        else_block->AddBranch(merge);
+        program.blocks = {entry, then_block, else_block, merge};
+        program.post_order_blocks = {merge, else_block, then_block, entry};
+    }
+
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    IR::Program program;
+    IR::Block* entry;
+    IR::Block* then_block;
+    IR::Block* else_block;
+    IR::Block* merge;
+};
+
+size_t CountOpcode(const IR::Block& block, IR::Opcode opcode) {
+    const auto has_opcode{[opcode](const IR::Inst& inst) { return inst.GetOpcode() == opcode; }};
+    return static_cast<size_t>(std::ranges::count_if(block.Instructions(), has_opcode));
+}
+
+IR::U32 LoadCbuf(IR::IREmitter& ir) {
+    return ir.GetCbuf(ir.Imm32(0), ir.Imm32(16));
+}
+} // Anonymous namespace
+
+TEST_CASE("Shader::Optimization: Value numbering replaces dominated expressions", "[video_core]") {
+    Diamond diamond;
+    IR::IREmitter entry{*diamond.entry};
+    const IR::U64 address{entry.Imm64(u64{0x1000})};
+    const IR::U32 sum{entry.IAdd(LoadCbuf(entry), entry.Imm32(1))};
+    entry.WriteGlobal32(address, sum);
+
+    // Same expression with the operands swapped, in a block the entry dominates
+    IR::IREmitter merge{*diamond.merge};
+    const IR::U32 redundant_sum{merge.IAdd(merge.Imm32(1), LoadCbuf(merge))};
+    merge.WriteGlobal32(address, redundant_sum);
+
+    Optimization::GlobalValueNumberingPass(diamond.program);
+
+    REQUIRE(CountOpcode(*diamond.merge, IR::Opcode::GetCbufU32) == 0);
+    REQUIRE(CountOpcode(*diamond.merge, IR::Opcode::IAdd32) == 0);
+    const IR::Inst& store{diamond.merge->Instructions().front()};
+    REQUIRE(store.GetOpcode() == IR::Opcode::WriteGlobal32);
+    REQUIRE(store.Arg(1) == sum);
+}
+
+TEST_CASE("Shader::Optimization: Value numbering keeps expressions of sibling blocks",
+          "[video_core]") {
+    Diamond diamond;
+    IR::IREmitter then_block{*diamond.then_block};
+    IR::IREmitter else_block{*diamond.else_block};
+    (void)then_block.IAdd(LoadCbuf(then_block), then_block.Imm32(1));
+    (void)else_block.IAdd(LoadCbuf(else_block), else_block.Imm32(1));
+
+    Optimization::GlobalValueNumberingPass(diamond.program);
+
+    // Neither side dominates the other
+    REQUIRE(CountOpcode(*diamond.then_block, IR::Opcode::IAdd32) == 1);
+    REQUIRE(CountOpcode(*diamond.else_block, IR::Opcode::IAdd32) == 1);
+}
+
+TEST_CASE("Shader::Optimization: Value numbering reloads memory after side effects",
+          "[video_core]") {
+    Diamond diamond;
+    IR::IREmitter entry{*diamond.entry};
+    const IR::U64 address{entry.Imm64(u64{0x1000})};
+    const IR::U32 first_load{entry.LoadGlobal32(address)};
+    const IR::U32 second_load{entry.LoadGlobal32(address)};
+    entry.WriteGlobal32(address, entry.IAdd(first_load, second_load));
+    (void)entry.LoadGlobal32(address);
+
+    // Loads are only shared within a block, other blocks may run after more side effects
+    IR::IREmitter merge{*diamond.merge};
+    (void)merge.LoadGlobal32(address);
+
+    Optimization::GlobalValueNumberingPass(diamond.program);
+
+    // The second load is merged with the first one, the load after the store is kept
+    REQUIRE(CountOpcode(*diamond.entry, IR::Opcode::LoadGlobal32) == 2);
+    REQUIRE(CountOpcode(*diamond.merge, IR::Opcode::LoadGlobal32) == 1);
+}
+
+TEST_CASE("Shader::Optimization: Value numbering keeps side effects", "[video_core]") {
+    Diamond diamond;
+    IR::IREmitter entry{*diamond.entry};
+    const IR::U64 address{entry.Imm64(u64{0x1000})};
+    const IR::U32 value{entry.Imm32(1)};
+    (void)entry.GlobalAtomicIAdd(address, value);
+    (void)entry.GlobalAtomicIAdd(address, value);
+    entry.WriteGlobal32(address, value);
+    entry.WriteGlobal32(address, value);
+
+    Optimization::GlobalValueNumberingPass(diamond.program);
+
+    REQUIRE(CountOpcode(*diamond.entry, IR::Opcode::GlobalAtomicIAdd32) == 2);
+    REQUIRE(CountOpcode(*diamond.entry, IR::Opcode::WriteGlobal32) == 2);
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/host1x/syncpoint_manager.h"
+
+using Tegra::Host1x::SyncpointManager;
+
+TEST_CASE("SyncpointManager: Wait returns once the value is reached", "[video_core]") {
+    auto manager = std::make_unique<SyncpointManager>();
+    // Actions run within the increment that reaches them, so they show the increments that
+    // release a waiter of the same value without racing with it
+    bool reached{};
+    manager->RegisterHostAction(3, 2, [&reached] { reached = true; });
+
+    std::latch started{1};
+    std::atomic<bool> woken{};
+    std::jthread waiter([&] {
+        started.count_down();
+        manager->WaitHost(3, 2);
+        woken = true;
+    });
+    started.wait();
+
+    manager->IncrementHost(3);
+    // Increments of other syncpoints and of the guest value must not release the waiter
+    manager->IncrementHost(4);
+    manager->IncrementGuest(3);
+    manager->IncrementGuest(3);
+    REQUIRE(!reached);
+    REQUIRE(!woken);
+
+    manager->IncrementHost(3);
+    REQUIRE(reached);
+    waiter.join();
+    REQUIRE(woken);
+    REQUIRE(manager->GetHostSyncpointValue(3) == 2);
+}
+
+TEST_CASE("SyncpointManager: Many waiters on one syncpoint", "[video_core]") {
+    auto manager = std::make_unique<SyncpointManager>();
+    constexpr u32 NUM_WAITERS = 16;
+    // Values seen by each waiter once it returns, checked here since assertions are not thread safe
+    std::vector<u32> woken_values(NUM_WAITERS);
+    {
+        std::vector<std::jthread> waiters;
+        for (u32 i = 1; i <= NUM_WAITERS; ++i) {
+            waiters.emplace_back([&, i] {
+                manager->WaitGuest(0, i);
+                woken_values[i - 1] = manager->GetGuestSyncpointValue(0);
+            });
+        }
+        for (u32 i = 0; i < NUM_WAITERS; ++i) {
+            manager->IncrementGuest(0);
+        }
+    }
+    for (u32 i = 1; i <= NUM_WAITERS; ++i) {
+        REQUIRE(woken_values[i - 1] >= i);
+    }
+}
+
+TEST_CASE("SyncpointManager: Wait on a reached value does not block", "[video_core]") {
+    auto manager = std::make_unique<SyncpointManager>();
+    manager->IncrementHost(1);
+    manager->WaitHost(1, 1);
+    manager->WaitHost(1, 0);
+    REQUIRE(manager->IsReadyHost(1, 1));
+}
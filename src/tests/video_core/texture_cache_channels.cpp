@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <memory>
+#include <span>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/memory.h"
+#include "tests/video_core/maxwell_3d_context.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/engines/fermi_2d.h"
+#include "video_core/engines/kepler_compute.h"
+#include "video_core/engines/kepler_memory.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
+#include "video_core/memory_manager.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_null/null_rasterizer.h"
+#include "video_core/renderer_null/null_texture_cache.h"
+
+namespace {
+constexpr GPUVAddr GPU_ADDR = 0x10'0000;
+constexpr DAddr DEVICE_ADDR = 0x1'0000'0000;
+constexpr u64 POOL_SIZE = 0x1000;
+constexpr u32 POOL_LIMIT = POOL_SIZE / 32 - 1;
+constexpr u64 NUM_POOLS = 4;
+
+/// Rasterizer of the GPU memory managers, mapping memory doesn't invalidate anything
+class MappingRasterizer final : public VideoCore::RasterizerInterface {
+public:
+    void Draw(bool is_indexed, u32 instance_count) override {}
+    void DrawTexture() override {}
+    void Clear(u32 layer_count) override {}
+    void DispatchCompute() override {}
+    void ResetCounter(VideoCommon::QueryType type) override {}
+    void Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
+               VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport) override {}
+    void BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr,
+                                   u32 size) override {}
+    void DisableGraphicsUniformBuffer(size_t stage, u32 index) override {}
+    void SignalFence(std::function<void()>&& func) override {}
+    void SyncOperation(std::function<void()>&& func) override {}
+    void SignalSyncPoint(u32 value) override {}
+    void SignalReference() override {}
+    void ReleaseFences(bool force) override {}
+    void FlushAll() override {}
+    void FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {}
+    bool MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {
+        return false;
+    }
+    VideoCore::RasterizerDownloadArea GetFlushArea(DAddr addr, u64 size) override {
+        return {};
+    }
+    void InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {}
+    void OnCacheInvalidation(PAddr addr, u64 size) override {}
+    bool OnCPUWrite(PAddr addr, u64 size) override {
+        return false;
+    }
+    void InvalidateGPUCache() override {}
+    void UnmapMemory(DAddr addr, u64 size) override {}
+    void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) override {}
+    void FlushAndInvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {}
+    void WaitForIdle() override {}
+    void FragmentBarrier() override {}
+    void TiledCacheBarrier() override {}
+    void FlushCommands() override {}
+    void TickFrame() override {}
+    Tegra::Engines::AccelerateDMAInterface& AccessAccelerateDMA() override {
+        return accelerate_dma;
+    }
+    void AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
+                                  std::span<const u8> memory) override {}
+
+private:
+    Null::AccelerateDMA accelerate_dma;
+};
+
+/// Texture cache of the null renderer, on channels whose pools are mapped to device memory
+class ChannelContext {
+public:
+    ChannelContext() : process_memory{context.system}, texture_cache{runtime, context.memory} {
+        context.memory.RegisterProcess(&process_memory);
+        gpu_memory = std::make_shared<Tegra::MemoryManager>(context.system, context.memory);
+        gpu_memory->BindRasterizer(&rasterizer);
+        gpu_memory->Map(GPU_ADDR, DEVICE_ADDR, NUM_POOLS * POOL_SIZE);
+    }
+
+    std::unique_ptr<Tegra::Control::ChannelState> CreateChannel(s32 bind_id) {
+        auto channel = std::make_unique<Tegra::Control::ChannelState>(bind_id);
+        channel->memory_manager = gpu_memory;
+        channel->maxwell_3d =
+            std::make_unique<Tegra::Engines::Maxwell3D>(context.system, *gpu_memory);
+        channel->kepler_compute =
+            std::make_unique<Tegra::Engines::KeplerCompute>(context.system, *gpu_memory);
+        texture_cache.CreateChannel(*channel);
+        return channel;
+    }
+
+    /// Tracks the pools of the channel, the way the rasterizer does before drawing
+    void SynchronizeDescriptors(Tegra::Control::ChannelState& channel) {
+        auto& regs = channel.maxwell_3d->regs;
+        regs.tex_header.address_low = static_cast<u32>(GPU_ADDR);
+        regs.tex_header.limit = POOL_LIMIT;
+        regs.tex_sampler.address_low = static_cast<u32>(GPU_ADDR + POOL_SIZE);
+        regs.tex_sampler.limit = POOL_LIMIT;
+        auto& compute_regs = channel.kepler_compute->regs;
+        compute_regs.tic.address_low = static_cast<u32>(GPU_ADDR + 2 * POOL_SIZE);
+        compute_regs.tic.limit = POOL_LIMIT;
+        compute_regs.tsc.address_low = static_cast<u32>(GPU_ADDR + 3 * POOL_SIZE);
+        compute_regs.tsc.limit = POOL_LIMIT;
+
+        texture_cache.BindToChannel(channel.bind_id);
+        texture_cache.SynchronizeGraphicsDescriptors();
+        texture_cache.SynchronizeComputeDescriptors();
+    }
+
+    u8 CachedCount(u64 pool) {
+        return context.memory.GetPageCachedCount(DEVICE_ADDR + pool * POOL_SIZE);
+    }
+
+    Null::TextureCache& TextureCache() {
+        return texture_cache;
+    }
+
+private:
+    Tests::Maxwell3DContext context;
+    Core::Memory::Memory process_memory;
+    MappingRasterizer rasterizer;
+    std::shared_ptr<Tegra::MemoryManager> gpu_memory;
+    Null::TextureCacheRuntime runtime;
+    Null::TextureCache texture_cache;
+};
+} // Anonymous namespace
+
+TEST_CASE("TextureCache: Erased channels release their pools", "[video_core]") {
+    ChannelContext context;
+    const auto first = context.CreateChannel(1);
+    const auto second = context.CreateChannel(2);
+    context.SynchronizeDescriptors(*first);
+    context.SynchronizeDescriptors(*second);
+    for (u64 pool = 0; pool < NUM_POOLS; ++pool) {
+        REQUIRE(context.CachedCount(pool) == 2);
+    }
+
+    context.TextureCache().EraseChannel(first->bind_id);
+    for (u64 pool = 0; pool < NUM_POOLS; ++pool) {
+        REQUIRE(context.CachedCount(pool) == 1);
+    }
+
+    // A channel created on the storage of the erased one tracks its pools again
+    const auto third = context.CreateChannel(3);
+    context.SynchronizeDescriptors(*third);
+    for (u64 pool = 0; pool < NUM_POOLS; ++pool) {
+        REQUIRE(context.CachedCount(pool) == 2);
+    }
+
+    context.TextureCache().EraseChannel(second->bind_id);
+    context.TextureCache().EraseChannel(third->bind_id);
+    for (u64 pool = 0; pool < NUM_POOLS; ++pool) {
+        REQUIRE(context.CachedCount(pool) == 0);
+    }
+}
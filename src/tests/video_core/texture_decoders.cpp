@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/decode_bc.h"
+#include "video_core/texture_cache/types.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using Tegra::Texture::SwizzleBackend;
+
+constexpr std::array SIMD_BACKENDS{SwizzleBackend::SSE2, SwizzleBackend::AVX2,
+                                   SwizzleBackend::NEON};
+
+struct Layout {
+    u32 bytes_per_pixel;
+    u32 width;
+    u32 height;
+    u32 depth;
+    u32 block_height;
+    u32 block_depth;
+};
+
+constexpr std::array LAYOUTS{
+    Layout{4, 256, 64, 1, 3, 0},  Layout{16, 33, 17, 1, 1, 0}, Layout{1, 7, 3, 1, 0, 0},
+    Layout{8, 100, 40, 4, 2, 1},  Layout{12, 21, 30, 2, 2, 1}, Layout{2, 130, 9, 3, 0, 2},
+    Layout{3, 64, 128, 1, 4, 0},  Layout{6, 49, 8, 1, 5, 0},
+};
+
+std::vector<u8> RandomBytes(size_t size) {
+    std::mt19937 rng{static_cast<u32>(size)};
+    std::vector<u8> bytes(size);
+    for (u8& value : bytes) {
+        value = static_cast<u8>(rng());
+    }
+    return bytes;
+}
+
+size_t SwizzledSize(const Layout& layout) {
+    return Tegra::Texture::CalculateSize(true, layout.bytes_per_pixel, layout.width,
+                                         layout.height, layout.depth, layout.block_height,
+                                         layout.block_depth);
+}
+
+size_t LinearSize(const Layout& layout) {
+    return static_cast<size_t>(layout.bytes_per_pixel) * layout.width * layout.height *
+           layout.depth;
+}
+
+std::vector<u8> Unswizzle(SwizzleBackend backend, const Layout& layout,
+                          const std::vector<u8>& input) {
+    Tegra::Texture::SetSwizzleBackend(backend);
+    std::vector<u8> output(LinearSize(layout));
+    Tegra::Texture::UnswizzleTexture(output, input, layout.bytes_per_pixel, layout.width,
+                                     layout.height, layout.depth, layout.block_height,
+                                     layout.block_depth);
+    return output;
+}
+
+std::vector<u8> Swizzle(SwizzleBackend backend, const Layout& layout,
+                        const std::vector<u8>& input) {
+    Tegra::Texture::SetSwizzleBackend(backend);
+    std::vector<u8> output(SwizzledSize(layout));
+    Tegra::Texture::SwizzleTexture(output, input, layout.bytes_per_pixel, layout.width,
+                                   layout.height, layout.depth, layout.block_height,
+                                   layout.block_depth);
+    return output;
+}
+
+std::vector<u8> UnswizzleSubrect(SwizzleBackend backend, const Layout& layout,
+                                 const std::vector<u8>& input, u32 origin_x, u32 origin_y,
+                                 u32 extent_x, u32 extent_y) {
+    Tegra::Texture::SetSwizzleBackend(backend);
+    const u32 pitch = extent_x * layout.bytes_per_pixel;
+    std::vector<u8> output(static_cast<size_t>(pitch) * layout.height * layout.depth);
+    Tegra::Texture::UnswizzleSubrect(output, input, layout.bytes_per_pixel, layout.width,
+                                     layout.height, layout.depth, origin_x, origin_y, extent_x,
+                                     extent_y, layout.block_height, layout.block_depth, pitch);
+    return output;
+}
+
+std::vector<u8> SwizzleSubrect(SwizzleBackend backend, const Layout& layout,
+                               const std::vector<u8>& input, u32 origin_x, u32 origin_y,
+                               u32 extent_x, u32 extent_y) {
+    Tegra::Texture::SetSwizzleBackend(backend);
+    const u32 pitch = extent_x * layout.bytes_per_pixel;
+    std::vector<u8> output(SwizzledSize(layout));
+    Tegra::Texture::SwizzleSubrect(output, input, layout.bytes_per_pixel, layout.width,
+                                   layout.height, layout.depth, origin_x, origin_y, extent_x,
+                                   extent_y, layout.block_height, layout.block_depth, pitch);
+    return output;
+}
+} // Anonymous namespace
+
+TEST_CASE("TextureDecoders[Swizzle]", "[video_core]") {
+    const SwizzleBackend detected_backend = Tegra::Texture::GetSwizzleBackend();
+    for (const SwizzleBackend backend : SIMD_BACKENDS) {
+        if (!Tegra::Texture::IsSwizzleBackendSupported(backend)) {
+            continue;
+        }
+        for (const Layout& layout : LAYOUTS) {
+            const std::vector<u8> swizzled = RandomBytes(SwizzledSize(layout));
+            const std::vector<u8> linear = RandomBytes(LinearSize(layout));
+
+            REQUIRE(Unswizzle(backend, layout, swizzled) ==
+                    Unswizzle(SwizzleBackend::Scalar, layout, swizzled));
+            REQUIRE(Swizzle(backend, layout, linear) ==
+                    Swizzle(SwizzleBackend::Scalar, layout, linear));
+        }
+    }
+    Tegra::Texture::SetSwizzleBackend(detected_backend);
+}
+
+TEST_CASE("TextureDecoders[SwizzleSubrect]", "[video_core]") {
+    const SwizzleBackend detected_backend = Tegra::Texture::GetSwizzleBackend();
+    for (const SwizzleBackend backend : SIMD_BACKENDS) {
+        if (!Tegra::Texture::IsSwizzleBackendSupported(backend)) {
+            continue;
+        }
+        for (const Layout& layout : LAYOUTS) {
+            const u32 origin_x = layout.width / 3;
+            const u32 origin_y = layout.height / 4;
+            const u32 extent_x = layout.width - origin_x;
+            const u32 extent_y = layout.height - origin_y;
+            const std::vector<u8> swizzled = RandomBytes(SwizzledSize(layout));
+            const std::vector<u8> linear = RandomBytes(LinearSize(layout));
+
+            REQUIRE(UnswizzleSubrect(backend, layout, swizzled, origin_x, origin_y, extent_x,
+                                     extent_y) == UnswizzleSubrect(SwizzleBackend::Scalar, layout,
+                                                                   swizzled, origin_x, origin_y,
+                                                                   extent_x, extent_y));
+            REQUIRE(SwizzleSubrect(backend, layout, linear, origin_x, origin_y, extent_x,
+                                   extent_y) == SwizzleSubrect(SwizzleBackend::Scalar, layout,
+                                                               linear, origin_x, origin_y,
+                                                               extent_x, extent_y));
+        }
+    }
+    Tegra::Texture::SetSwizzleBackend(detected_backend);
+}
+
+TEST_CASE("TextureDecoders[RoundTrip]", "[video_core]") {
+    for (const Layout& layout : LAYOUTS) {
+        const std::vector<u8> linear = RandomBytes(LinearSize(layout));
+        const std::vector<u8> swizzled = Swizzle(SwizzleBackend::Scalar, layout, linear);
+        REQUIRE(Unswizzle(SwizzleBackend::Scalar, layout, swizzled) == linear);
+    }
+}
+
+TEST_CASE("TextureDecoders[Benchmark]", "[.][benchmark]") {
+    constexpr Layout layout{4, 1024, 1024, 1, 4, 0};
+    const std::vector<u8> swizzled = RandomBytes(SwizzledSize(layout));
+    std::vector<u8> linear(LinearSize(layout));
+
+    const SwizzleBackend detected_backend = Tegra::Texture::GetSwizzleBackend();
+    BENCHMARK("Unswizzle 1024x1024 RGBA8, scalar") {
+        return Unswizzle(SwizzleBackend::Scalar, layout, swizzled);
+    };
+    BENCHMARK("Unswizzle 1024x1024 RGBA8, detected backend") {
+        return Unswizzle(detected_backend, layout, swizzled);
+    };
+    Tegra::Texture::SetSwizzleBackend(detected_backend);
+
+    // Random blocks mix all the encodings, the void extent and error paths included
+    constexpr u32 size = 256;
+    const std::vector<u8> blocks = RandomBytes((size / 4) * (size / 4) * 16);
+    std::vector<u8> decoded(size * size * 4);
+    BENCHMARK("ASTC 4x4 decode 256x256") {
+        Tegra::Texture::ASTC::Decompress(blocks, size, size, 1, 4, 4, decoded);
+    };
+    BENCHMARK("ASTC 8x8 decode 256x256") {
+        Tegra::Texture::ASTC::Decompress(std::span(blocks).first((size / 8) * (size / 8) * 16),
+                                         size, size, 1, 8, 8, decoded);
+    };
+
+    VideoCommon::BufferImageCopy copy{
+        .buffer_offset = 0,
+        .buffer_size = blocks.size(),
+        .buffer_row_length = size,
+        .buffer_image_height = size,
+        .image_subresource{},
+        .image_offset{},
+        .image_extent{size, size, 1},
+    };
+    BENCHMARK("BC1 decode 256x256") {
+        VideoCommon::DecompressBCn(std::span(blocks).first(blocks.size() / 2), decoded, copy,
+                                   VideoCore::Surface::PixelFormat::BC1_RGBA_UNORM);
+    };
+    BENCHMARK("BC7 decode 256x256") {
+        VideoCommon::DecompressBCn(blocks, decoded, copy,
+                                   VideoCore::Surface::PixelFormat::BC7_UNORM);
+    };
+}
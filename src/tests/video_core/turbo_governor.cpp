@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/turbo_governor.h"
+
+namespace {
+using namespace std::chrono_literals;
+using Clock = VideoCommon::TurboGovernor::Clock;
+
+constexpr std::chrono::nanoseconds FRAME_INTERVAL{16'666'667};
+constexpr std::chrono::nanoseconds PROBE_TIME = 200us;
+constexpr std::chrono::nanoseconds PROBE_INTERVAL = 100ms;
+
+/// Presents frames with a fixed GPU time, starting at the given time
+Clock::time_point RunFrames(VideoCommon::TurboGovernor& governor, Clock::time_point now,
+                            std::chrono::nanoseconds gpu_time, u32 num_frames) {
+    for (u32 frame = 0; frame < num_frames; ++frame) {
+        now += FRAME_INTERVAL;
+        governor.FrameTimed(gpu_time, now);
+    }
+    return now;
+}
+
+/**
+ * Simulates the keep alive thread over frames with a fixed GPU time, and returns the fraction of
+ * the time it kept the GPU busy. Boosting submits probes back to back, otherwise one probe runs
+ * every probe interval.
+ */
+f64 KeepAliveDutyCycle(VideoCommon::TurboGovernor& governor, std::chrono::nanoseconds gpu_time,
+                       u32 num_frames) {
+    Clock::time_point now{1s};
+    const Clock::time_point end = now + FRAME_INTERVAL * num_frames;
+    Clock::time_point next_frame = now + FRAME_INTERVAL;
+    std::chrono::nanoseconds busy{};
+    while (now < end) {
+        now += PROBE_TIME;
+        busy += PROBE_TIME;
+        governor.ProbeTimed(PROBE_TIME, now);
+        if (!governor.ShouldBoost(now)) {
+            now += PROBE_INTERVAL;
+        }
+        for (; next_frame <= now; next_frame += FRAME_INTERVAL) {
+            governor.FrameTimed(gpu_time, next_frame);
+        }
+    }
+    return std::chrono::duration<f64>(busy) / (now - Clock::time_point{1s});
+}
+} // Anonymous namespace
+
+TEST_CASE("TurboGovernor: Always boosts without a threshold", "[video_core]") {
+    VideoCommon::TurboGovernor governor{0.0};
+    REQUIRE(governor.ShouldBoost(Clock::time_point{1s}));
+}
+
+TEST_CASE("TurboGovernor: Boosts while the GPU is busy", "[video_core]") {
+    VideoCommon::TurboGovernor governor{0.5};
+    Clock::time_point now = RunFrames(governor, Clock::time_point{1s}, 2ms, 60);
+    REQUIRE(!governor.ShouldBoost(now));
+
+    now = RunFrames(governor, now, 14ms, 60);
+    REQUIRE(governor.ShouldBoost(now));
+
+    now = RunFrames(governor, now, 2ms, 60);
+    REQUIRE(!governor.ShouldBoost(now));
+}
+
+TEST_CASE("TurboGovernor: Ignores pauses between frames", "[video_core]") {
+    VideoCommon::TurboGovernor governor{0.5};
+    Clock::time_point now = RunFrames(governor, Clock::time_point{1s}, 14ms, 60);
+    const f64 load = governor.Load();
+
+    // A loading screen that presents once a second says nothing about the load
+    governor.FrameTimed(1ms, now + 1s);
+    REQUIRE(governor.Load() == load);
+}
+
+TEST_CASE("TurboGovernor: Boosts after clocks drop", "[video_core]") {
+    VideoCommon::TurboGovernor governor{0.5};
+    const Clock::time_point now{1s};
+    governor.ProbeTimed(200us, now);
+    governor.ProbeTimed(250us, now);
+    REQUIRE(!governor.ShouldBoost(now));
+
+    governor.ProbeTimed(600us, now);
+    REQUIRE(governor.ShouldBoost(now));
+    REQUIRE(governor.ShouldBoost(now + 500ms));
+    REQUIRE(!governor.ShouldBoost(now + 2s));
+}
+
+TEST_CASE("TurboGovernor: Keep alive duty cycle", "[video_core]") {
+    // The time the GPU spends on keep alive work stands in for the power it draws
+    VideoCommon::TurboGovernor constant{0.0};
+    VideoCommon::TurboGovernor idle{0.5};
+    VideoCommon::TurboGovernor busy{0.5};
+    const f64 constant_duty = KeepAliveDutyCycle(constant, 2ms, 600);
+    const f64 idle_duty = KeepAliveDutyCycle(idle, 2ms, 600);
+    const f64 busy_duty = KeepAliveDutyCycle(busy, 14ms, 600);
+
+    REQUIRE(constant_duty == 1.0);
+    REQUIRE(idle_duty < 0.01);
+    REQUIRE(busy_duty > 0.9);
+}
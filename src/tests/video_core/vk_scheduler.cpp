@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/dynamic_library.h"
+#include "common/settings.h"
+#include "core/frontend/emu_window.h"
+#include "video_core/renderer_vulkan/renderer_vulkan.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_state_tracker.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_instance.h"
+#include "video_core/vulkan_common/vulkan_library.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace {
+
+constexpr u32 NUM_SUBMISSIONS = 16;
+constexpr u32 COMMANDS_PER_SUBMISSION = 512;
+
+/// Headless device, created the same way as in the pipeline precompiler
+struct VulkanContext {
+    VulkanContext()
+        : library{Vulkan::OpenLibrary()},
+          instance{Vulkan::CreateInstance(*library, dld, VK_API_VERSION_1_1,
+                                          Core::Frontend::WindowSystemType::Headless, false)},
+          device{Vulkan::CreateDevice(instance, dld, nullptr)} {}
+
+    std::shared_ptr<Common::DynamicLibrary> library;
+    vk::InstanceDispatch dld;
+    vk::Instance instance;
+    Vulkan::Device device;
+};
+
+/// Records barriers over several submissions and waits until all of them have been recorded
+void RecordSubmissions(Vulkan::Scheduler& scheduler) {
+    static constexpr VkMemoryBarrier BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT,
+    };
+    for (u32 submission = 0; submission < NUM_SUBMISSIONS; ++submission) {
+        for (u32 command = 0; command < COMMANDS_PER_SUBMISSION; ++command) {
+            scheduler.Record([](vk::CommandBuffer cmdbuf) {
+                cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, BARRIER);
+            });
+        }
+        scheduler.Flush();
+    }
+    scheduler.WaitWorker();
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Scheduler[RecordingBenchmark]", "[.][benchmark]") {
+    std::unique_ptr<VulkanContext> context;
+    try {
+        context = std::make_unique<VulkanContext>();
+    } catch (const vk::Exception& exception) {
+        WARN("Skipping, no Vulkan device is available: " << exception.what());
+        return;
+    }
+    for (const bool parallel : {false, true}) {
+        // The number of recording threads is chosen when the scheduler is created
+        Settings::values.vulkan_parallel_recording.SetValue(parallel);
+        Vulkan::StateTracker state_tracker;
+        Vulkan::Scheduler scheduler{context->device, state_tracker};
+
+        BENCHMARK(parallel ? "Parallel recording" : "Single recording thread") {
+            RecordSubmissions(scheduler);
+        };
+        scheduler.Finish();
+    }
+    Settings::values.vulkan_parallel_recording.SetValue(false);
+}
@@ -7,6 +7,7 @@
 #include <memory>
 #include <numeric>
 
+#include "common/metrics.h"
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
@@ -45,7 +46,7 @@ BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, R
 
 template <class P>
 void BufferCache<P>::RunGarbageCollector() {
-    const bool aggressive_gc = total_used_memory >= critical_memory;
+    const bool aggressive_gc = total_used_memory >= critical_memory || budget_excess != 0;
     const u64 ticks_to_destroy = aggressive_gc ? 60 : 120;
     int num_iterations = aggressive_gc ? 64 : 32;
     const auto clean_up = [this, &num_iterations](BufferId buffer_id) {
@@ -63,6 +64,8 @@ void BufferCache<P>::RunGarbageCollector() {
 
 template <class P>
 void BufferCache<P>::TickFrame() {
+    frame_arena.NextFrame();
+
     // Homebrew console apps don't create or bind any channels, so this will be nullptr.
     if (!channel_state) {
         return;
@@ -84,13 +87,15 @@ void BufferCache<P>::TickFrame() {
     channel_state->uniform_cache_shots[0] = 0;
 
     const bool skip_preferred = hits * 256 < shots * 251;
-    channel_state->uniform_buffer_skip_cache_size = skip_preferred ? DEFAULT_SKIP_CACHE_SIZE : 0;
+    channel_state->uniform_buffer_skip_cache_size =
+        skip_preferred ? runtime.GetUniformBufferSkipCacheSize() : 0;
 
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
     }
-    if (total_used_memory >= minimum_memory) {
+    budget_excess = Common::MemoryAccounting::GetExcess();
+    if (total_used_memory >= minimum_memory || budget_excess != 0) {
         RunGarbageCollector();
     }
     ++frame_tick;
@@ -269,6 +274,39 @@ bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     return true;
 }
 
+template <class P>
+std::optional<std::array<std::pair<typename P::Buffer*, u32>, 2>> BufferCache<P>::ObtainCopyBuffers(
+    GPUVAddr src_address, u32 src_size, GPUVAddr dest_address, u32 dest_size) {
+    const std::optional<DAddr> cpu_src_address = gpu_memory->GpuToCpuAddress(src_address);
+    const std::optional<DAddr> cpu_dest_address = gpu_memory->GpuToCpuAddress(dest_address);
+    if (!cpu_src_address || !cpu_dest_address) {
+        return std::nullopt;
+    }
+    if (!IsRegionRegistered(*cpu_src_address, src_size) &&
+        !IsRegionRegistered(*cpu_dest_address, dest_size)) {
+        return std::nullopt;
+    }
+
+    // Creating the second buffer may join and delete the first one
+    BufferId src_buffer_id;
+    BufferId dest_buffer_id;
+    do {
+        channel_state->has_deleted_buffers = false;
+        src_buffer_id = FindBuffer(*cpu_src_address, src_size);
+        dest_buffer_id = FindBuffer(*cpu_dest_address, dest_size);
+    } while (channel_state->has_deleted_buffers);
+    Buffer& src_buffer = slot_buffers[src_buffer_id];
+    Buffer& dest_buffer = slot_buffers[dest_buffer_id];
+    SynchronizeBuffer(src_buffer, *cpu_src_address, src_size);
+    // The copy may not write every byte of the destination
+    SynchronizeBuffer(dest_buffer, *cpu_dest_address, dest_size);
+    MarkWrittenBuffer(dest_buffer_id, *cpu_dest_address, dest_size);
+    return std::array{
+        std::pair{&src_buffer, src_buffer.Offset(*cpu_src_address)},
+        std::pair{&dest_buffer, dest_buffer.Offset(*cpu_dest_address)},
+    };
+}
+
 template <class P>
 std::pair<typename P::Buffer*, u32> BufferCache<P>::ObtainBuffer(GPUVAddr gpu_addr, u32 size,
                                                                  ObtainBufferSynchronize sync_info,
@@ -549,7 +587,13 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
         it++;
     }
 
-    boost::container::small_vector<std::pair<BufferCopy, BufferId>, 16> downloads;
+    // When predicting readbacks, only ranges the guest read back before are downloaded ahead of
+    // time. Reactive flushing downloads the rest when the guest reads them, marking them for the
+    // next time they are written.
+    const auto& hot_settings = Settings::GetHotSettings();
+    const bool predict_readbacks =
+        hot_settings.use_readback_prediction && hot_settings.use_reactive_flushing;
+    std::pmr::vector<std::pair<BufferCopy, BufferId>> downloads{frame_arena.Resource()};
     u64 total_size_bytes = 0;
     u64 largest_copy = 0;
     for (const IntervalSet& intervals : committed_ranges) {
@@ -564,6 +608,10 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
                 memory_tracker.ForEachDownloadRange(
                     new_start, new_end - new_start, false,
                     [&](u64 device_addr_out, u64 range_size) {
+                        if (predict_readbacks &&
+                            !memory_tracker.IsRegionPreflushable(device_addr_out, range_size)) {
+                            return;
+                        }
                         const DAddr buffer_addr = buffer.CpuAddr();
                         const auto add_download = [&](DAddr start, DAddr end) {
                             const u64 new_offset = start - buffer_addr;
@@ -1012,6 +1060,22 @@ void BufferCache<P>::BindHostComputeUniformBuffers() {
         TouchBuffer(buffer, binding.buffer_id);
         const u32 size =
             std::min(binding.size, (*channel_state->compute_uniform_buffer_sizes)[index]);
+        if constexpr (!IS_OPENGL) {
+            // Small buffers rewritten by the guest since they were last cached, usually through
+            // inline uploads before the launch, are streamed instead of synchronized
+            const bool use_fast_buffer =
+                binding.buffer_id != NULL_BUFFER_ID &&
+                size <= channel_state->uniform_buffer_skip_cache_size &&
+                memory_tracker.IsRegionCpuModified(binding.device_addr, size) &&
+                !memory_tracker.IsRegionGpuModified(binding.device_addr, size);
+            if (use_fast_buffer) {
+                const std::span<u8> span =
+                    runtime.BindMappedUniformBuffer(0, binding_index, size);
+                device_memory.ReadBlockUnsafe(binding.device_addr, span.data(), size);
+                ++binding_index;
+                return;
+            }
+        }
         SynchronizeBuffer(buffer, binding.device_addr, size);
 
         const u32 offset = buffer.Offset(binding.device_addr);
@@ -1320,6 +1384,10 @@ void BufferCache<P>::UpdateComputeTextureBuffers() {
 template <class P>
 void BufferCache<P>::MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size) {
     memory_tracker.MarkRegionAsGpuModified(device_addr, size);
+    if constexpr (!HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT) {
+        // Indices converted from this buffer by the host are stale once the GPU writes it
+        runtime.InvalidateIndexConversions(slot_buffers[buffer_id]);
+    }
 
     const IntervalType base_interval{device_addr, device_addr + size};
     common_ranges.add(base_interval);
@@ -1478,9 +1546,11 @@ void BufferCache<P>::ChangeRegister(BufferId buffer_id) {
     const auto size = buffer.SizeBytes();
     if (insert) {
         total_used_memory += Common::AlignUp(size, 1024);
+        memory_charge.Add(static_cast<s64>(Common::AlignUp(size, 1024)));
         buffer.setLRUID(lru_cache.Insert(buffer_id, frame_tick));
     } else {
         total_used_memory -= Common::AlignUp(size, 1024);
+        memory_charge.Add(-static_cast<s64>(Common::AlignUp(size, 1024)));
         lru_cache.Free(buffer.getLRUID());
     }
     const DAddr device_addr_begin = buffer.CpuAddr();
@@ -1529,6 +1599,13 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
 template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
+    static auto& uploads = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_buffer_uploads_total", "Uploads of guest memory to cached buffers");
+    static auto& uploaded_bytes = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_buffer_uploaded_bytes_total", "Bytes of guest memory uploaded to cached buffers");
+    uploads.Increment();
+    uploaded_bytes.Increment(total_size_bytes);
+
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         MappedUploadMemory(buffer, total_size_bytes, copies);
     } else {
@@ -1578,7 +1655,7 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
             copy.src_offset += upload_staging.offset;
         }
         const bool can_reorder = runtime.CanReorderUpload(buffer, copies);
-        runtime.CopyBuffer(buffer, upload_staging.buffer, copies, true, can_reorder);
+        runtime.UploadBuffer(buffer, upload_staging, copies, can_reorder);
     }
 }
 
@@ -7,8 +7,10 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -29,6 +31,7 @@
 #include "common/div_ceil.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -39,6 +42,7 @@
 #include "video_core/engines/draw_manager.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/frame_arena.h"
 #include "video_core/memory_manager.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/slot_vector.h"
@@ -320,6 +324,11 @@ public:
 
     bool DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 amount);
 
+    /// Returns the buffers and offsets of the source and destination of a copy done on the GPU,
+    /// or nullopt when neither region is in the cache and the copy is cheaper on the CPU
+    [[nodiscard]] std::optional<std::array<std::pair<Buffer*, u32>, 2>> ObtainCopyBuffers(
+        GPUVAddr src_address, u32 src_size, GPUVAddr dest_address, u32 dest_size);
+
     bool DMAClear(GPUVAddr src_address, u64 amount, u32 value);
 
     /// Return true when a CPU region is modified from the GPU
@@ -592,10 +601,16 @@ private:
     u64 total_used_memory = 0;
     u64 minimum_memory = 0;
     u64 critical_memory = 0;
+    /// Bytes held beyond the host memory budget when the frame started
+    u64 budget_excess = 0;
+    Common::MemoryAccounting::Charge memory_charge{
+        Common::MemoryAccounting::Category::BufferCache};
     BufferId inline_buffer_id;
 
     std::array<BufferId, ((1ULL << 34) >> CACHING_PAGEBITS)> page_table;
     Common::ScratchBuffer<u8> tmp_buffer;
+
+    FrameArena frame_arena;
 };
 
 } // namespace VideoCommon
@@ -20,6 +20,7 @@ namespace VideoCommon {
 constexpr u64 PAGES_PER_WORD = 64;
 constexpr u64 BYTES_PER_PAGE = Core::DEVICE_PAGESIZE;
 constexpr u64 BYTES_PER_WORD = PAGES_PER_WORD * BYTES_PER_PAGE;
+constexpr u64 WORDS_PER_SUMMARY = 64;
 
 enum class Type {
     CPU,
@@ -29,9 +30,15 @@ enum class Type {
     Preflushable,
 };
 
-/// Vector tracking modified pages tightly packed with small vector optimization
+/**
+ * Vector tracking modified pages tightly packed with small vector optimization.
+ * A summary bitmap with one bit per word, set when the word is not zero, lets queries skip
+ * spans of 64 clean pages without reading their words.
+ */
 template <size_t stack_words = 1>
 struct WordsArray {
+    static constexpr size_t stack_summary_words = Common::DivCeil(stack_words, WORDS_PER_SUMMARY);
+
     /// Returns the pointer to the words state
     [[nodiscard]] const u64* Pointer(bool is_short) const noexcept {
         return is_short ? stack.data() : heap;
@@ -42,8 +49,20 @@ struct WordsArray {
         return is_short ? stack.data() : heap;
     }
 
-    std::array<u64, stack_words> stack{}; ///< Small buffers storage
-    u64* heap;                            ///< Not-small buffers pointer to the storage
+    /// Returns the pointer to the summary bitmap
+    [[nodiscard]] const u64* SummaryPointer(bool is_short) const noexcept {
+        return is_short ? summary_stack.data() : summary_heap;
+    }
+
+    /// Returns the pointer to the summary bitmap
+    [[nodiscard]] u64* SummaryPointer(bool is_short) noexcept {
+        return is_short ? summary_stack.data() : summary_heap;
+    }
+
+    std::array<u64, stack_words> stack{};                 ///< Small buffers storage
+    std::array<u64, stack_summary_words> summary_stack{}; ///< Small buffers summary storage
+    u64* heap;                                            ///< Not-small buffers storage
+    u64* summary_heap;                                    ///< Not-small buffers summary storage
 };
 
 template <size_t stack_words = 1>
@@ -51,6 +70,7 @@ struct Words {
     explicit Words() = default;
     explicit Words(u64 size_bytes_) : size_bytes{size_bytes_} {
         num_words = Common::DivCeil(size_bytes, BYTES_PER_WORD);
+        num_summary_words = Common::DivCeil(num_words, WORDS_PER_SUMMARY);
         if (IsShort()) {
             cpu.stack.fill(~u64{0});
             gpu.stack.fill(0);
@@ -59,12 +79,18 @@ struct Words {
             preflushable.stack.fill(0);
         } else {
             // Share allocation between CPU and GPU pages and set their default values
-            u64* const alloc = new u64[num_words * 5];
+            u64* const alloc = new u64[(num_words + num_summary_words) * 5];
             cpu.heap = alloc;
             gpu.heap = alloc + num_words;
             cached_cpu.heap = alloc + num_words * 2;
             untracked.heap = alloc + num_words * 3;
             preflushable.heap = alloc + num_words * 4;
+            u64* const summary_alloc = alloc + num_words * 5;
+            cpu.summary_heap = summary_alloc;
+            gpu.summary_heap = summary_alloc + num_summary_words;
+            cached_cpu.summary_heap = summary_alloc + num_summary_words * 2;
+            untracked.summary_heap = summary_alloc + num_summary_words * 3;
+            preflushable.summary_heap = summary_alloc + num_summary_words * 4;
             std::fill_n(cpu.heap, num_words, ~u64{0});
             std::fill_n(gpu.heap, num_words, 0);
             std::fill_n(cached_cpu.heap, num_words, 0);
@@ -78,6 +104,19 @@ struct Words {
         const u64 last_word = (~u64{0} << shift) >> shift;
         cpu.Pointer(IsShort())[NumWords() - 1] = last_word;
         untracked.Pointer(IsShort())[NumWords() - 1] = last_word;
+
+        // Every CPU and untracked word starts with pages set, the other states start clean
+        const u64 last_summary_words = num_words % WORDS_PER_SUMMARY;
+        const u64 summary_shift = (WORDS_PER_SUMMARY - last_summary_words) % WORDS_PER_SUMMARY;
+        const u64 last_summary_word = (~u64{0} << summary_shift) >> summary_shift;
+        for (WordsArray<stack_words>* const array : {&cpu, &untracked}) {
+            u64* const summary = array->SummaryPointer(IsShort());
+            std::fill_n(summary, num_summary_words, ~u64{0});
+            summary[num_summary_words - 1] = last_summary_word;
+        }
+        for (WordsArray<stack_words>* const array : {&gpu, &cached_cpu, &preflushable}) {
+            std::fill_n(array->SummaryPointer(IsShort()), num_summary_words, 0);
+        }
     }
 
     ~Words() {
@@ -88,6 +127,7 @@ struct Words {
         Release();
         size_bytes = rhs.size_bytes;
         num_words = rhs.num_words;
+        num_summary_words = rhs.num_summary_words;
         cpu = rhs.cpu;
         gpu = rhs.gpu;
         cached_cpu = rhs.cached_cpu;
@@ -98,7 +138,8 @@ struct Words {
     }
 
     Words(Words&& rhs) noexcept
-        : size_bytes{rhs.size_bytes}, num_words{rhs.num_words}, cpu{rhs.cpu}, gpu{rhs.gpu},
+        : size_bytes{rhs.size_bytes}, num_words{rhs.num_words},
+          num_summary_words{rhs.num_summary_words}, cpu{rhs.cpu}, gpu{rhs.gpu},
           cached_cpu{rhs.cached_cpu}, untracked{rhs.untracked}, preflushable{rhs.preflushable} {
         rhs.cpu.heap = nullptr;
     }
@@ -154,8 +195,40 @@ struct Words {
         }
     }
 
+    template <Type type>
+    std::span<u64> Summary() noexcept {
+        if constexpr (type == Type::CPU) {
+            return std::span<u64>(cpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::GPU) {
+            return std::span<u64>(gpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::CachedCPU) {
+            return std::span<u64>(cached_cpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Untracked) {
+            return std::span<u64>(untracked.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Preflushable) {
+            return std::span<u64>(preflushable.SummaryPointer(IsShort()), num_summary_words);
+        }
+    }
+
+    template <Type type>
+    std::span<const u64> Summary() const noexcept {
+        if constexpr (type == Type::CPU) {
+            return std::span<const u64>(cpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::GPU) {
+            return std::span<const u64>(gpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::CachedCPU) {
+            return std::span<const u64>(cached_cpu.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Untracked) {
+            return std::span<const u64>(untracked.SummaryPointer(IsShort()), num_summary_words);
+        } else if constexpr (type == Type::Preflushable) {
+            return std::span<const u64>(preflushable.SummaryPointer(IsShort()),
+                                        num_summary_words);
+        }
+    }
+
     u64 size_bytes = 0;
     size_t num_words = 0;
+    size_t num_summary_words = 0;
     WordsArray<stack_words> cpu;
     WordsArray<stack_words> gpu;
     WordsArray<stack_words> cached_cpu;
@@ -196,6 +269,20 @@ public:
 
     template <typename Func>
     void IterateWords(size_t offset, size_t size, Func&& func) const {
+        IterateWords(
+            offset, size, [](size_t) { return ~u64{0}; }, std::forward<Func>(func));
+    }
+
+    /**
+     * Iterates the words of a range, skipping words whose bit is clear in a summary bitmap
+     *
+     * @param offset  Offset in bytes from the start of the buffer
+     * @param size    Size in bytes of the range
+     * @param summary Function returning the summary word at a given summary index
+     * @param func    Function to call for each word that is not skipped
+     */
+    template <typename Summary, typename Func>
+    void IterateWords(size_t offset, size_t size, Summary&& summary, Func&& func) const {
         using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
         static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
         const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
@@ -213,7 +300,21 @@ public:
         end_word = std::min(end_word, num_words);
         end_page += diff * PAGES_PER_WORD;
         constexpr u64 base_mask{~0ULL};
-        for (size_t word_index = start_word; word_index < end_word; word_index++) {
+        size_t word_index = start_word;
+        while (word_index < end_word) {
+            const u64 summary_bits =
+                summary(word_index / WORDS_PER_SUMMARY) >> (word_index % WORDS_PER_SUMMARY);
+            const size_t skip_words =
+                std::min<size_t>(summary_bits != 0
+                                     ? std::countr_zero(summary_bits)
+                                     : WORDS_PER_SUMMARY - word_index % WORDS_PER_SUMMARY,
+                                 end_word - word_index);
+            if (skip_words != 0) {
+                word_index += skip_words;
+                start_page = 0;
+                end_page -= skip_words * PAGES_PER_WORD;
+                continue;
+            }
             const u64 mask = ExtractBits(base_mask, start_page, end_page);
             start_page = 0;
             end_page -= PAGES_PER_WORD;
@@ -224,6 +325,7 @@ public:
             } else {
                 func(word_index, mask);
             }
+            ++word_index;
         }
     }
 
@@ -275,6 +377,13 @@ public:
                     untracked_words[index] &= ~mask;
                 }
             }
+            UpdateSummary<type>(index);
+            if constexpr (type == Type::CPU || type == Type::CachedCPU) {
+                UpdateSummary<Type::Untracked>(index);
+            }
+            if constexpr (type == Type::CPU) {
+                UpdateSummary<Type::CachedCPU>(index);
+            }
         });
     }
 
@@ -301,7 +410,18 @@ public:
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        // Clearing CPU state also clears untracked pages, so those words can't be skipped
+        constexpr bool clears_untracked = clear && (type == Type::CPU || type == Type::CachedCPU);
+        const std::span<const u64> summary = words.template Summary<type>();
+        const std::span<const u64> untracked_summary = words.template Summary<Type::Untracked>();
+        const auto summary_word = [&](size_t summary_index) {
+            if constexpr (clears_untracked) {
+                return summary[summary_index] | untracked_summary[summary_index];
+            } else {
+                return summary[summary_index];
+            }
+        };
+        IterateWords(offset, size, summary_word, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -317,6 +437,13 @@ public:
                 if constexpr (type == Type::CPU) {
                     cached_words[index] &= ~word;
                 }
+                UpdateSummary<type>(index);
+                if constexpr (clears_untracked) {
+                    UpdateSummary<Type::Untracked>(index);
+                }
+                if constexpr (type == Type::CPU) {
+                    UpdateSummary<Type::CachedCPU>(index);
+                }
             }
             const size_t base_offset = index * PAGES_PER_WORD;
             IteratePages(word, [&](size_t pages_offset, size_t pages_size) {
@@ -355,8 +482,12 @@ public:
         const std::span<const u64> state_words = words.template Span<type>();
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
+        const std::span<const u64> summary = words.template Summary<type>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const auto summary_word = [summary](size_t summary_index) {
+            return summary[summary_index];
+        };
+        IterateWords(offset, size, summary_word, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -382,9 +513,13 @@ public:
         const std::span<const u64> state_words = words.template Span<type>();
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
+        const std::span<const u64> summary = words.template Summary<type>();
         u64 begin = std::numeric_limits<u64>::max();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const auto summary_word = [summary](size_t summary_index) {
+            return summary[summary_index];
+        };
+        IterateWords(offset, size, summary_word, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -418,16 +553,25 @@ public:
     }
 
     void FlushCachedWrites() noexcept {
-        const u64 num_words = NumWords();
         u64* const cached_words = Array<Type::CachedCPU>();
         u64* const untracked_words = Array<Type::Untracked>();
         u64* const cpu_words = Array<Type::CPU>();
-        for (u64 word_index = 0; word_index < num_words; ++word_index) {
-            const u64 cached_bits = cached_words[word_index];
-            NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
-            untracked_words[word_index] |= cached_bits;
-            cpu_words[word_index] |= cached_bits;
-            cached_words[word_index] = 0;
+        const std::span<u64> cached_summary = words.template Summary<Type::CachedCPU>();
+        for (size_t summary_index = 0; summary_index < cached_summary.size(); ++summary_index) {
+            // Only words with cached writes have to be flushed
+            u64 summary_bits = std::exchange(cached_summary[summary_index], 0);
+            while (summary_bits != 0) {
+                const size_t word_index = summary_index * WORDS_PER_SUMMARY +
+                                          static_cast<size_t>(std::countr_zero(summary_bits));
+                summary_bits &= summary_bits - 1;
+                const u64 cached_bits = cached_words[word_index];
+                NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
+                untracked_words[word_index] |= cached_bits;
+                cpu_words[word_index] |= cached_bits;
+                cached_words[word_index] = 0;
+                UpdateSummary<Type::Untracked>(word_index);
+                UpdateSummary<Type::CPU>(word_index);
+            }
         }
     }
 
@@ -458,6 +602,14 @@ private:
         }
     }
 
+    /// Updates the summary bit of a word after changing its state
+    template <Type type>
+    void UpdateSummary(size_t word_index) noexcept {
+        u64& summary = words.template Summary<type>()[word_index / WORDS_PER_SUMMARY];
+        const u64 bit = u64{1} << (word_index % WORDS_PER_SUMMARY);
+        summary = words.template Span<type>()[word_index] != 0 ? summary | bit : summary & ~bit;
+    }
+
     /**
      * Notify tracker about changes in the CPU tracking state of a word in the buffer
      *
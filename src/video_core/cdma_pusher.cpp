@@ -22,15 +22,26 @@ CDmaPusher::CDmaPusher(Host1x::Host1x& host1x_)
 CDmaPusher::~CDmaPusher() = default;
 
 void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
+    // The whole command buffer is decoded first, so the devices are driven from a flat list of
+    // method writes instead of interleaving them with the parser state
+    methods.clear();
+    DecodeEntries(entries);
+    for (const ChMethod& method : methods) {
+        ExecuteCommand(method);
+    }
+}
+
+void CDmaPusher::DecodeEntries(const ChCommandHeaderList& entries) {
+    methods.reserve(methods.size() + entries.size());
     for (const auto& value : entries) {
         if (mask != 0) {
             const auto lbs = static_cast<u32>(std::countr_zero(mask));
             mask &= ~(1U << lbs);
-            ExecuteCommand(offset + lbs, value.raw);
+            methods.push_back({current_class, offset + lbs, value.raw});
             continue;
         } else if (count != 0) {
             --count;
-            ExecuteCommand(offset, value.raw);
+            methods.push_back({current_class, offset, value.raw});
             if (incrementing) {
                 ++offset;
             }
@@ -57,7 +68,7 @@ void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
         case ChSubmissionMode::Immediate: {
             const u32 data = value.value & 0xfff;
             offset = value.method_offset;
-            ExecuteCommand(offset, data);
+            methods.push_back({current_class, offset, data});
             break;
         }
         default:
@@ -67,11 +78,13 @@ void CDmaPusher::ProcessEntries(ChCommandHeaderList&& entries) {
     }
 }
 
-void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
-    switch (current_class) {
+void CDmaPusher::ExecuteCommand(const ChMethod& method) {
+    const u32 state_offset = method.method;
+    const u32 data = method.argument;
+    switch (method.class_id) {
     case ChClassId::NvDec:
-        ThiStateWrite(nvdec_thi_state, offset, data);
-        switch (static_cast<ThiMethod>(offset)) {
+        ThiStateWrite(nvdec_thi_state, state_offset, data);
+        switch (static_cast<ThiMethod>(state_offset)) {
         case ThiMethod::IncSyncpt: {
             LOG_DEBUG(Service_NVDRV, "NVDEC Class IncSyncpt Method");
             const auto syncpoint_id = static_cast<u32>(data & 0xFF);
@@ -79,8 +92,8 @@ void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
             if (cond == 0) {
                 sync_manager->Increment(syncpoint_id);
             } else {
-                sync_manager->SignalDone(
-                    sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id));
+                sync_manager->SignalDone(sync_manager->IncrementWhenDone(
+                    static_cast<u32>(method.class_id), syncpoint_id));
             }
             break;
         }
@@ -94,7 +107,7 @@ void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
         }
         break;
     case ChClassId::GraphicsVic:
-        ThiStateWrite(vic_thi_state, static_cast<u32>(state_offset), {data});
+        ThiStateWrite(vic_thi_state, state_offset, data);
         switch (static_cast<ThiMethod>(state_offset)) {
         case ThiMethod::IncSyncpt: {
             LOG_DEBUG(Service_NVDRV, "VIC Class IncSyncpt Method");
@@ -103,8 +116,8 @@ void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
             if (cond == 0) {
                 sync_manager->Increment(syncpoint_id);
             } else {
-                sync_manager->SignalDone(
-                    sync_manager->IncrementWhenDone(static_cast<u32>(current_class), syncpoint_id));
+                sync_manager->SignalDone(sync_manager->IncrementWhenDone(
+                    static_cast<u32>(method.class_id), syncpoint_id));
             }
             break;
         }
@@ -121,10 +134,11 @@ void CDmaPusher::ExecuteCommand(u32 state_offset, u32 data) {
     case ChClassId::Control:
         // This device is mainly for syncpoint synchronization
         LOG_DEBUG(Service_NVDRV, "Host1X Class Method");
-        host1x_processor->ProcessMethod(static_cast<Host1x::Control::Method>(offset), data);
+        host1x_processor->ProcessMethod(static_cast<Host1x::Control::Method>(state_offset), data);
         break;
     default:
-        UNIMPLEMENTED_MSG("Current class not implemented {:X}", static_cast<u32>(current_class));
+        UNIMPLEMENTED_MSG("Current class not implemented {:X}",
+                          static_cast<u32>(method.class_id));
         break;
     }
 }
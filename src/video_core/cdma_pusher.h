@@ -64,6 +64,13 @@ struct ChCommand {
 
 using ChCommandHeaderList = std::vector<ChCommandHeader>;
 
+/// Method write decoded from a command buffer, with the class it was written to
+struct ChMethod {
+    ChClassId class_id;
+    u32 method;
+    u32 argument;
+};
+
 struct ThiRegisters {
     u32_le increment_syncpt{};
     INSERT_PADDING_WORDS(1);
@@ -96,8 +103,11 @@ public:
     void ProcessEntries(ChCommandHeaderList&& entries);
 
 private:
-    /// Invoke command class devices to execute the command based on the current state
-    void ExecuteCommand(u32 state_offset, u32 data);
+    /// Decodes the method writes of a whole command buffer, appending them to the method list
+    void DecodeEntries(const ChCommandHeaderList& entries);
+
+    /// Invoke command class devices to execute a decoded method write
+    void ExecuteCommand(const ChMethod& method);
 
     /// Write arguments value to the ThiRegisters member at the specified offset
     void ThiStateWrite(ThiRegisters& state, u32 offset, u32 argument);
@@ -115,6 +125,9 @@ private:
     u32 offset{};
     u32 mask{};
     bool incrementing{};
+
+    /// Method writes of the command buffer being processed, kept to reuse its allocation
+    std::vector<ChMethod> methods;
 };
 
 } // namespace Tegra
@@ -54,7 +54,7 @@ public:
     virtual void BindToChannel(s32 id);
 
     /// Erase channel's state.
-    void EraseChannel(s32 id);
+    virtual void EraseChannel(s32 id);
 
     Tegra::MemoryManager* GetFromID(size_t id) const {
         std::unique_lock<std::mutex> lk(config_mutex);
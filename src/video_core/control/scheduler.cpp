@@ -14,10 +14,13 @@ Scheduler::Scheduler(GPU& gpu_) : gpu{gpu_} {}
 Scheduler::~Scheduler() = default;
 
 void Scheduler::Push(s32 channel, CommandList&& entries) {
+    // Channels are processed one at a time on purpose. They share the rasterizer, whose caches
+    // and host command recording are bound to a single channel at a time, and guest syncpoint
+    // waits between channels rely on the submission order being preserved.
     std::unique_lock lk(scheduling_guard);
     auto it = channels.find(channel);
     ASSERT(it != channels.end());
-    auto channel_state = it->second;
+    ChannelState* const channel_state = it->second.get();
     gpu.BindChannel(channel_state->bind_id);
     channel_state->dma_pusher->Push(std::move(entries));
     channel_state->dma_pusher->DispatchCalls();
@@ -131,10 +131,18 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
                 dma_state.is_last_call = true;
                 index += max_write;
                 continue;
-            } else {
-                dma_state.is_last_call = dma_state.method_count <= 1;
-                CallMethod(command_header.argument);
             }
+            if (!dma_increment_once && dma_state.method >= non_puller_methods) {
+                const u32 num_sunk = SinkIncreasingMethods(commands.subspan(index));
+                if (num_sunk != 0) {
+                    dma_state.method += num_sunk;
+                    dma_state.method_count -= num_sunk;
+                    index += num_sunk;
+                    continue;
+                }
+            }
+            dma_state.is_last_call = dma_state.method_count <= 1;
+            CallMethod(command_header.argument);
 
             if (!dma_state.non_incrementing) {
                 dma_state.method++;
@@ -206,6 +214,18 @@ void DmaPusher::CallMethod(u32 argument) const {
     }
 }
 
+u32 DmaPusher::SinkIncreasingMethods(std::span<const CommandHeader> arguments) const {
+    Engines::EngineInterface* const subchannel = subchannels[dma_state.subchannel];
+    const u32 max_write =
+        static_cast<u32>(std::min<std::size_t>(dma_state.method_count, arguments.size()));
+    u32 count = 0;
+    while (count < max_write && !subchannel->execution_mask[dma_state.method + count]) {
+        subchannel->method_sink.emplace_back(dma_state.method + count, arguments[count].argument);
+        ++count;
+    }
+    return count;
+}
+
 void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     if (dma_state.method < non_puller_methods) {
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
@@ -147,6 +147,10 @@ private:
     void SetState(const CommandHeader& command_header);
 
     void CallMethod(u32 argument) const;
+
+    /// Queues the run of increasing method writes that don't need to execute immediately into
+    /// the method sink of the current subchannel, returns the number of queued writes
+    u32 SinkIncreasingMethods(std::span<const CommandHeader> arguments) const;
     void CallMultiMethod(const u32* base_start, u32 num_methods) const;
 
     Common::ScratchBuffer<CommandHeader>
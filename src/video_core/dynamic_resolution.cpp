@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/logging/log.h"
+#include "video_core/dynamic_resolution.h"
+
+namespace VideoCommon {
+namespace {
+/// Weight of the last frame in the smoothed GPU time
+constexpr f64 SMOOTHING = 0.1;
+/// Frames to wait after a switch before dropping to native resolution
+constexpr u32 MIN_FRAMES_BEFORE_NATIVE = 30;
+/// Frames to wait after a switch before going back to the configured resolution
+constexpr u32 MIN_FRAMES_BEFORE_UPSCALE = 180;
+/// Fraction of the target the estimated upscaled GPU time has to stay under to go back up
+constexpr f64 UPSCALE_HEADROOM = 0.8;
+} // Anonymous namespace
+
+bool DynamicResolution::Update(std::chrono::nanoseconds gpu_time,
+                               std::chrono::nanoseconds target, f32 scale_area) {
+    if (gpu_time.count() <= 0) {
+        // No timed work completed during the frame
+        return is_native;
+    }
+    const f64 frame_ns = static_cast<f64>(gpu_time.count());
+    average_ns =
+        frames_since_switch == 0 ? frame_ns : average_ns + SMOOTHING * (frame_ns - average_ns);
+    ++frames_since_switch;
+
+    const f64 target_ns = static_cast<f64>(target.count());
+    if (!is_native) {
+        if (frames_since_switch >= MIN_FRAMES_BEFORE_NATIVE && average_ns > target_ns) {
+            LOG_INFO(Render, "GPU time {:.2f} ms over target, rendering at native resolution",
+                     average_ns / 1e6);
+            is_native = true;
+            frames_since_switch = 0;
+        }
+        return is_native;
+    }
+    // Pixel work dominates at high resolutions, estimate the upscaled cost from the pixels drawn
+    const f64 upscaled_ns = average_ns * scale_area;
+    if (frames_since_switch >= MIN_FRAMES_BEFORE_UPSCALE &&
+        upscaled_ns < target_ns * UPSCALE_HEADROOM) {
+        LOG_INFO(Render, "Estimated GPU time {:.2f} ms under target, rendering upscaled",
+                 upscaled_ns / 1e6);
+        is_native = false;
+        frames_since_switch = 0;
+    }
+    return is_native;
+}
+
+} // namespace VideoCommon
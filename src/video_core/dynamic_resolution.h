@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Decides when render targets are drawn at native resolution instead of the configured one, to
+ * hold a frame time target when the GPU can't keep up.
+ *
+ * The scale of shaders and images is fixed when they are built, so the controller only switches
+ * between the two resolutions the texture cache can render at. The GPU time of each frame is
+ * smoothed, and switching back up needs the estimated upscaled time to leave some headroom, so
+ * frames close to the target don't toggle the resolution back and forth.
+ */
+class DynamicResolution {
+public:
+    /**
+     * Adds the GPU time of a frame.
+     *
+     * @param gpu_time   GPU time spent on the frame
+     * @param target     Frame time to hold
+     * @param scale_area Ratio between the pixels drawn upscaled and at native resolution
+     *
+     * @returns True when render targets should be drawn at native resolution
+     */
+    bool Update(std::chrono::nanoseconds gpu_time, std::chrono::nanoseconds target,
+                f32 scale_area);
+
+    [[nodiscard]] bool IsNative() const noexcept {
+        return is_native;
+    }
+
+    /// Goes back to the configured resolution and forgets the frames seen so far
+    void Reset() noexcept {
+        *this = DynamicResolution{};
+    }
+
+private:
+    f64 average_ns = 0.0;
+    u32 frames_since_switch = 0;
+    bool is_native = false;
+};
+
+} // namespace VideoCommon
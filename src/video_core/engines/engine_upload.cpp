@@ -47,6 +47,11 @@ void State::ProcessData(const u32* data, size_t num_data) {
 void State::ProcessData(std::span<const u8> read_buffer) {
     const GPUVAddr address{regs.dest.Address()};
     if (is_linear) {
+        if (regs.dest.pitch == regs.line_length_in) {
+            // Contiguous lines are written at once instead of line by line
+            rasterizer->AccelerateInlineToMemory(address, copy_size, read_buffer.first(copy_size));
+            return;
+        }
         for (size_t line = 0; line < regs.line_count; ++line) {
             const GPUVAddr dest_line = address + line * regs.dest.pitch;
             std::span<const u8> buffer(read_buffer.data() + line * regs.line_length_in,
@@ -54,6 +59,9 @@ void State::ProcessData(std::span<const u8> read_buffer) {
             rasterizer->AccelerateInlineToMemory(dest_line, regs.line_length_in, buffer);
         }
     } else {
+        if (rasterizer->AccelerateInlineToBlockLinear(regs, read_buffer)) {
+            return;
+        }
         u32 width = regs.dest.width;
         u32 x_elements = regs.line_length_in;
         u32 x_offset = regs.dest.x;
@@ -290,26 +290,53 @@ u32 Maxwell3D::ProcessShadowRam(u32 method, u32 argument) {
     return argument;
 }
 
-void Maxwell3D::ConsumeSinkImpl() {
-    SCOPE_EXIT({ method_sink.clear(); });
+template <typename Func>
+void Maxwell3D::ConsumeSinkDirty(Func&& func) {
     const auto control = shadow_state.shadow_ram_control;
     if (control == Regs::ShadowRamControl::Track ||
         control == Regs::ShadowRamControl::TrackWithFilter) {
 
         for (auto [method, value] : method_sink) {
             shadow_state.reg_array[method] = value;
-            ProcessDirtyRegisters(method, value);
+            func(method, value);
         }
         return;
     }
     if (control == Regs::ShadowRamControl::Replay) {
         for (auto [method, value] : method_sink) {
-            ProcessDirtyRegisters(method, shadow_state.reg_array[method]);
+            func(method, shadow_state.reg_array[method]);
         }
         return;
     }
     for (auto [method, value] : method_sink) {
-        ProcessDirtyRegisters(method, value);
+        func(method, value);
+    }
+}
+
+void Maxwell3D::ConsumeSinkImpl() {
+    SCOPE_EXIT({ method_sink.clear(); });
+    if (dirty.masks.empty()) {
+        ConsumeSinkDirty([this](u32 method, u32 value) { ProcessDirtyRegisters(method, value); });
+        return;
+    }
+    // Accumulate the dirty flags of the whole sink and apply them at once
+    DirtyState::Flags pending_flags{};
+    ConsumeSinkDirty([this, &pending_flags](u32 method, u32 value) {
+        if (regs.reg_array[method] == value) {
+            return;
+        }
+        regs.reg_array[method] = value;
+        pending_flags |= dirty.masks[method];
+    });
+    dirty.flags |= pending_flags;
+}
+
+void Maxwell3D::DirtyState::BuildMasks() {
+    masks.assign(Regs::NUM_REGS, Flags{});
+    for (const Table& table : tables) {
+        for (size_t method = 0; method < Regs::NUM_REGS; ++method) {
+            masks[method].set(table[method]);
+        }
     }
 }
 
@@ -463,6 +490,12 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
         return;
     }
     default:
+        if (!execution_mask[method] && executing_macro == 0 && amount != 0) {
+            // Writes to registers without side effects only leave the last value behind
+            const u32 argument = ProcessShadowRam(method, base_start[amount - 1]);
+            ProcessDirtyRegisters(method, argument);
+            break;
+        }
         for (u32 i = 0; i < amount; i++) {
             CallMethod(method, base_start[i], methods_pending - i <= 1);
         }
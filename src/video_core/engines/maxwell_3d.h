@@ -3097,6 +3097,11 @@ public:
 
         Flags flags;
         Tables tables{};
+        /// Flags set by a write to each register, the union of all tables
+        std::vector<Flags> masks;
+
+        /// Builds the per register masks, has to be called after the tables change
+        void BuildMasks();
     } dirty;
 
     std::unique_ptr<DrawManager> draw_manager;
@@ -3140,6 +3145,10 @@ private:
 
     void ProcessDirtyRegisters(u32 method, u32 argument);
 
+    /// Calls func with the method and shadow ram resolved value of each write in the sink
+    template <typename Func>
+    void ConsumeSinkDirty(Func&& func);
+
     void ConsumeSinkImpl() override;
 
     void ProcessMethodCall(u32 method, u32 argument, u32 nonshadow_argument, bool is_last_call);
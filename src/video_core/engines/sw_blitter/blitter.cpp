@@ -3,15 +3,19 @@
 
 #include <algorithm>
 #include <cmath>
+#include <optional>
 #include <vector>
 
+#include "common/alignment.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 #include "video_core/engines/sw_blitter/blitter.h"
 #include "video_core/engines/sw_blitter/converter.h"
 #include "video_core/guest_memory.h"
 #include "video_core/memory_manager.h"
 #include "video_core/surface.h"
 #include "video_core/textures/decoders.h"
+#include "video_core/textures/workers.h"
 
 namespace Tegra {
 class MemoryManager;
@@ -28,12 +32,43 @@ namespace {
 
 constexpr size_t ir_components = 4;
 
+// Smaller blits are not worth waking up the workers for
+constexpr u32 MIN_PIXELS_PER_JOB = 16 * 1024;
+constexpr u32 JOBS_PER_WORKER = 2;
+
+/// Calls func(first_row, last_row) over bands of rows covering the whole surface, large
+/// surfaces are split across the image transcode workers
+template <typename Func>
+void ForEachRowBand(u32 width, u32 height, Func&& func) {
+    const u32 min_rows_per_job = Common::DivideUp(MIN_PIXELS_PER_JOB, std::max(width, 1U));
+    if (height < min_rows_per_job * 2) {
+        func(0U, height);
+        return;
+    }
+    Common::ThreadWorker& workers{GetThreadWorkers()};
+    const u32 max_jobs = static_cast<u32>(workers.NumWorkers()) * JOBS_PER_WORKER;
+    const u32 rows_per_job = std::max(Common::DivideUp(height, max_jobs), min_rows_per_job);
+    for (u32 first_row = 0; first_row < height; first_row += rows_per_job) {
+        const u32 last_row = std::min(first_row + rows_per_job, height);
+        workers.QueueWork([&func, first_row, last_row] { func(first_row, last_row); });
+    }
+    workers.WaitForRequests();
+}
+
+/// Returns the part of a tightly packed surface holding a band of rows
+template <typename T>
+std::span<T> RowBand(std::span<T> surface, u32 width, size_t elements_per_pixel, u32 first_row,
+                     u32 last_row) {
+    const size_t row_size = width * elements_per_pixel;
+    return surface.subspan(first_row * row_size, (last_row - first_row) * row_size);
+}
+
 void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_width, u32 src_height,
-                     u32 dst_width, u32 dst_height, size_t bpp) {
+                     u32 dst_width, u32 dst_height, size_t bpp, u32 first_row, u32 last_row) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
+    size_t src_y = first_row * dy_dv;
+    for (u32 y = first_row; y < last_row; y++) {
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
             const size_t read_from = ((src_y * src_width + src_x) >> 32) * bpp;
@@ -47,11 +82,12 @@ void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_wi
 }
 
 void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32 src_width,
-                         u32 src_height, u32 dst_width, u32 dst_height) {
+                         u32 src_height, u32 dst_width, u32 dst_height, u32 first_row,
+                         u32 last_row) {
     const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
     const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
+    size_t src_y = first_row * dy_dv;
+    for (u32 y = first_row; y < last_row; y++) {
         size_t src_x = 0;
         for (u32 x = 0; x < dst_width; x++) {
             const size_t read_from = ((src_y * src_width + src_x) >> 32) * ir_components;
@@ -65,7 +101,8 @@ void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32
 }
 
 void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_width,
-              size_t src_height, size_t dst_width, size_t dst_height) {
+              size_t src_height, size_t dst_width, size_t dst_height, u32 first_row,
+              u32 last_row) {
     const auto bilinear_sample = [](std::span<const f32> x0_y0, std::span<const f32> x1_y0,
                                     std::span<const f32> x0_y1, std::span<const f32> x1_y1,
                                     f32 weight_x, f32 weight_y) {
@@ -81,7 +118,7 @@ void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_widt
         dst_width > 1 ? static_cast<f32>(src_width - 1) / static_cast<f32>(dst_width - 1) : 0.f;
     const f32 dy_dv =
         dst_height > 1 ? static_cast<f32>(src_height - 1) / static_cast<f32>(dst_height - 1) : 0.f;
-    for (u32 y = 0; y < dst_height; y++) {
+    for (u32 y = first_row; y < last_row; y++) {
         for (u32 x = 0; x < dst_width; x++) {
             const f32 x_low = std::floor(static_cast<f32>(x) * dx_du);
             const f32 y_low = std::floor(static_cast<f32>(y) * dy_dv);
@@ -117,6 +154,7 @@ struct SoftwareBlitEngine::BlitEngineImpl {
     Common::ScratchBuffer<u8> tmp_buffer;
     Common::ScratchBuffer<u8> src_buffer;
     Common::ScratchBuffer<u8> dst_buffer;
+    Common::ScratchBuffer<u8> shuffle_buffer;
     Common::ScratchBuffer<f32> intermediate_src;
     Common::ScratchBuffer<f32> intermediate_dst;
     ConverterFactory converter_factory;
@@ -173,28 +211,64 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
         src.format != dst.format || src_extent_x != dst_extent_x || src_extent_y != dst_extent_y;
 
     const auto conversion_phase_same_format = [&]() {
-        NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
-                        dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
+        ForEachRowBand(dst_extent_x, dst_extent_y, [&](u32 first_row, u32 last_row) {
+            NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
+                            dst_extent_x, dst_extent_y, dst_bytes_per_pixel, first_row,
+                            last_row);
+        });
     };
 
+    Converter* input_converter{};
+    Converter* output_converter{};
+
     const auto conversion_phase_ir = [&]() {
-        auto* input_converter = impl->converter_factory.GetFormatConverter(src.format);
         impl->intermediate_src.resize_destructive((src_copy_size / src_bytes_per_pixel) *
                                                   ir_components);
         impl->intermediate_dst.resize_destructive((dst_copy_size / dst_bytes_per_pixel) *
                                                   ir_components);
-        input_converter->ConvertTo(impl->src_buffer, impl->intermediate_src);
+        const std::span<const u8> src_pixels{impl->src_buffer};
+        const std::span<f32> src_ir{impl->intermediate_src};
+        ForEachRowBand(src_extent_x, src_extent_y, [&](u32 first_row, u32 last_row) {
+            input_converter->ConvertTo(
+                RowBand(src_pixels, src_extent_x, src_bytes_per_pixel, first_row, last_row),
+                RowBand(src_ir, src_extent_x, ir_components, first_row, last_row));
+        });
+
+        const std::span<const f32> dst_ir{impl->intermediate_dst};
+        const std::span<u8> dst_pixels{impl->dst_buffer};
+        ForEachRowBand(dst_extent_x, dst_extent_y, [&](u32 first_row, u32 last_row) {
+            if (config.filter != Fermi2D::Filter::Bilinear) {
+                NearestNeighborFast(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
+                                    src_extent_y, dst_extent_x, dst_extent_y, first_row,
+                                    last_row);
+            } else {
+                Bilinear(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
+                         src_extent_y, dst_extent_x, dst_extent_y, first_row, last_row);
+            }
+            output_converter->ConvertFrom(
+                RowBand(dst_ir, dst_extent_x, ir_components, first_row, last_row),
+                RowBand(dst_pixels, dst_extent_x, dst_bytes_per_pixel, first_row, last_row));
+        });
+    };
 
-        if (config.filter != Fermi2D::Filter::Bilinear) {
-            NearestNeighborFast(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
-                                src_extent_y, dst_extent_x, dst_extent_y);
-        } else {
-            Bilinear(impl->intermediate_src, impl->intermediate_dst, src_extent_x, src_extent_y,
-                     dst_extent_x, dst_extent_y);
+    // Formats that only reorder bytes are converted directly, then scaled in the new format
+    const auto conversion_phase_shuffle = [&](const ByteShuffle& shuffle) {
+        const bool needs_scaling = src_extent_x != dst_extent_x || src_extent_y != dst_extent_y;
+        auto& shuffled = needs_scaling ? impl->shuffle_buffer : impl->dst_buffer;
+        if (needs_scaling) {
+            impl->shuffle_buffer.resize_destructive(src_copy_size);
+        }
+        const std::span<const u8> src_pixels{impl->src_buffer};
+        const std::span<u8> shuffled_pixels{shuffled};
+        ForEachRowBand(src_extent_x, src_extent_y, [&](u32 first_row, u32 last_row) {
+            shuffle.Convert(
+                RowBand(src_pixels, src_extent_x, src_bytes_per_pixel, first_row, last_row),
+                RowBand(shuffled_pixels, src_extent_x, dst_bytes_per_pixel, first_row, last_row));
+        });
+        if (needs_scaling) {
+            impl->src_buffer.swap(impl->shuffle_buffer);
+            conversion_phase_same_format();
         }
-
-        auto* output_converter = impl->converter_factory.GetFormatConverter(dst.format);
-        output_converter->ConvertFrom(impl->intermediate_dst, impl->dst_buffer);
     };
 
     // Do actual Blit
@@ -211,10 +285,20 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
 
     // Conversion Phase
     if (no_passthrough) {
-        if (src.format != dst.format || config.filter == Fermi2D::Filter::Bilinear) {
-            conversion_phase_ir();
-        } else {
+        if (src.format == dst.format && config.filter != Fermi2D::Filter::Bilinear) {
             conversion_phase_same_format();
+        } else {
+            input_converter = impl->converter_factory.GetFormatConverter(src.format);
+            output_converter = impl->converter_factory.GetFormatConverter(dst.format);
+            const std::optional<ByteShuffle> shuffle =
+                config.filter != Fermi2D::Filter::Bilinear
+                    ? ByteShuffle::Make(*input_converter, *output_converter)
+                    : std::nullopt;
+            if (shuffle) {
+                conversion_phase_shuffle(*shuffle);
+            } else {
+                conversion_phase_ir();
+            }
         }
     } else {
         impl->dst_buffer.swap(impl->src_buffer);
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <array>
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <span>
 #include <unordered_map>
 
@@ -916,10 +918,78 @@ public:
         }
     }
 
+    std::optional<ByteLayout> GetByteLayout() const override {
+        if constexpr (IsByteLayout()) {
+            ByteLayout layout{
+                .component_type = static_cast<u32>(component_types[0]),
+                .component_bytes{-1, -1, -1, -1},
+            };
+            for (size_t i = 0; i < num_components; i++) {
+                if (component_swizzle[i] != Swizzle::None) {
+                    layout.component_bytes[static_cast<size_t>(component_swizzle[i])] =
+                        static_cast<s32>(i);
+                }
+            }
+            return layout;
+        } else {
+            return std::nullopt;
+        }
+    }
+
     ConverterImpl() = default;
     ~ConverterImpl() override = default;
+
+private:
+    static constexpr bool IsByteLayout() {
+        if (num_components != 4 || total_bytes_per_pixel != 4) {
+            return false;
+        }
+        for (size_t i = 0; i < num_components; i++) {
+            if (component_sizes[i] != 8 || component_types[i] != component_types[0]) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
+std::optional<ByteShuffle> ByteShuffle::Make(const Converter& src, const Converter& dst) {
+    const std::optional<Converter::ByteLayout> src_layout = src.GetByteLayout();
+    const std::optional<Converter::ByteLayout> dst_layout = dst.GetByteLayout();
+    if (!src_layout || !dst_layout || src_layout->component_type != dst_layout->component_type) {
+        return std::nullopt;
+    }
+    ByteShuffle shuffle;
+    for (size_t component = 0; component < 4; component++) {
+        const s32 dst_byte = dst_layout->component_bytes[component];
+        if (dst_byte < 0) {
+            // Not stored in the destination, like the float path the byte is left as zero
+            continue;
+        }
+        const s32 src_byte = src_layout->component_bytes[component];
+        if (src_byte < 0) {
+            return std::nullopt;
+        }
+        shuffle.masks[component] = 0xFFU << (dst_byte * 8);
+        shuffle.rotations[component] = ((src_byte - dst_byte) * 8) & 31;
+    }
+    return shuffle;
+}
+
+void ByteShuffle::Convert(std::span<const u8> input, std::span<u8> output) const {
+    const auto [mask0, mask1, mask2, mask3] = masks;
+    const auto [rotation0, rotation1, rotation2, rotation3] = rotations;
+    const size_t num_pixels = output.size() / sizeof(u32);
+    for (size_t pixel = 0; pixel < num_pixels; pixel++) {
+        u32 value;
+        std::memcpy(&value, &input[pixel * sizeof(u32)], sizeof(value));
+        const u32 result =
+            (std::rotr(value, rotation0) & mask0) | (std::rotr(value, rotation1) & mask1) |
+            (std::rotr(value, rotation2) & mask2) | (std::rotr(value, rotation3) & mask3);
+        std::memcpy(&output[pixel * sizeof(u32)], &result, sizeof(result));
+    }
+}
+
 struct ConverterFactory::ConverterFactoryImpl {
     std::unordered_map<RenderTargetFormat, std::unique_ptr<Converter>> converters_cache;
 };
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <optional>
 #include <span>
 
 #include "common/common_types.h"
@@ -14,9 +16,39 @@ namespace Tegra::Engines::Blitter {
 
 class Converter {
 public:
+    /// Placement of the components of formats that store each of them in its own byte
+    struct ByteLayout {
+        u32 component_type;                  ///< Encoding shared by all the components
+        std::array<s32, 4> component_bytes; ///< Byte of the R, G, B and A components, -1 if missing
+    };
+
     virtual void ConvertTo(std::span<const u8> input, std::span<f32> output) = 0;
     virtual void ConvertFrom(std::span<const f32> input, std::span<u8> output) = 0;
     virtual ~Converter() = default;
+
+    /// Returns the byte layout of the format, std::nullopt when components are not stored in
+    /// bytes of the same encoding
+    [[nodiscard]] virtual std::optional<ByteLayout> GetByteLayout() const {
+        return std::nullopt;
+    }
+};
+
+/**
+ * Converts pixels between two formats with the same byte layout encoding by moving bytes within
+ * each pixel, skipping the float representation. The loop only uses rotations and masks so the
+ * compiler can vectorize it.
+ */
+class ByteShuffle {
+public:
+    /// Returns the shuffle between two formats, std::nullopt when it can't be done with bytes
+    [[nodiscard]] static std::optional<ByteShuffle> Make(const Converter& src,
+                                                         const Converter& dst);
+
+    void Convert(std::span<const u8> input, std::span<u8> output) const;
+
+private:
+    std::array<u32, 4> masks{};    ///< Destination bits written by each component
+    std::array<int, 4> rotations{}; ///< Right rotation moving each component to its destination
 };
 
 class ConverterFactory {
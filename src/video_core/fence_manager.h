@@ -96,7 +96,7 @@ public:
         }
         if constexpr (can_async_check) {
             guard.unlock();
-            cv.notify_all();
+            cv.notify_one();
         }
         rasterizer.InvalidateGPUCache();
     }
@@ -156,7 +156,8 @@ protected:
     virtual void QueueFence(TFence& fence) = 0;
     /// Notifies that the backend fence has been signaled/reached in host GPU.
     virtual bool IsFenceSignaled(TFence& fence) const = 0;
-    /// Waits until a fence has been signalled by the host GPU.
+    /// Waits until a fence has been signalled by the host GPU, returns immediately for stubbed
+    /// fences.
     virtual void WaitFence(TFence& fence) = 0;
 
     VideoCore::RasterizerInterface& rasterizer;
@@ -202,30 +203,32 @@ private:
         Common::SetCurrentThreadName(name.c_str());
         Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
-        TFence current_fence;
-        std::deque<std::function<void()>> current_operations;
+        std::queue<TFence> current_fences;
+        std::deque<std::deque<std::function<void()>>> current_operations;
         while (!stop_token.stop_requested()) {
             {
+                // Take every queued fence at once, titles can signal hundreds of them per frame
                 std::unique_lock lock(guard);
                 cv.wait(lock, [&] { return stop_token.stop_requested() || !fences.empty(); });
                 if (stop_token.stop_requested()) [[unlikely]] {
                     return;
                 }
-                current_fence = std::move(fences.front());
-                current_operations = std::move(pending_operations.front());
-                fences.pop();
-                pending_operations.pop_front();
+                std::swap(current_fences, fences);
+                std::swap(current_operations, pending_operations);
             }
-            if (!current_fence->IsStubbed()) {
+            while (!current_fences.empty()) {
+                TFence& current_fence = current_fences.front();
                 WaitFence(current_fence);
-            }
-            PopAsyncFlushes();
-            for (auto& operation : current_operations) {
-                operation();
-            }
-            {
-                std::unique_lock lock(ring_guard);
-                delayed_destruction_ring.Push(std::move(current_fence));
+                PopAsyncFlushes();
+                for (auto& operation : current_operations.front()) {
+                    operation();
+                }
+                {
+                    std::unique_lock lock(ring_guard);
+                    delayed_destruction_ring.Push(std::move(current_fence));
+                }
+                current_fences.pop();
+                current_operations.pop_front();
             }
         }
     }
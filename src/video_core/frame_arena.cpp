@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/metrics.h"
+#include "video_core/frame_arena.h"
+
+namespace VideoCommon {
+namespace {
+/// Size of the buffer each arena starts with and reuses across frames
+constexpr size_t INITIAL_BUFFER_SIZE = 256ULL << 10;
+
+/// Forwards allocations to another resource, counting them
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream_) : upstream{upstream_} {}
+
+    /// Returns the allocations made since the last call
+    u64 TakeCount() noexcept {
+        const u64 result = count;
+        count = 0;
+        return result;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++count;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        upstream->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream;
+    u64 count{};
+};
+} // Anonymous namespace
+
+struct FrameArena::Arena {
+    Arena()
+        : buffer{std::make_unique<std::byte[]>(INITIAL_BUFFER_SIZE)},
+          heap{std::pmr::new_delete_resource()},
+          monotonic{buffer.get(), INITIAL_BUFFER_SIZE, &heap}, resource{&monotonic} {}
+
+    std::unique_ptr<std::byte[]> buffer;
+    CountingResource heap;
+    std::pmr::monotonic_buffer_resource monotonic;
+    CountingResource resource;
+};
+
+FrameArena::FrameArena() {
+    for (auto& arena : arenas) {
+        arena = std::make_unique<Arena>();
+    }
+}
+
+FrameArena::~FrameArena() = default;
+
+std::pmr::memory_resource* FrameArena::Resource() noexcept {
+    return &arenas[current_frame]->resource;
+}
+
+void FrameArena::NextFrame() {
+    static auto& arena_allocations = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_frame_arena_allocations_total", "Transient allocations served by the frame arenas");
+    static auto& heap_allocations = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_frame_arena_heap_allocations_total",
+        "Heap allocations made by the frame arenas once their buffer was used up");
+
+    current_frame = (current_frame + 1) % NUM_FRAMES;
+    Arena& arena = *arenas[current_frame];
+    arena.monotonic.release();
+    arena_allocations.Increment(arena.resource.TakeCount());
+    heap_allocations.Increment(arena.heap.TakeCount());
+}
+
+} // namespace VideoCommon
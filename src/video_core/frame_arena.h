@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Monotonic arenas for the transient containers built while a frame is recorded, like copy and
+ * download lists, so they don't hit the heap on every draw.
+ *
+ * There is an arena for each frame in flight. Allocations are released when the arena of their
+ * frame is reused, NUM_FRAMES frames later. Not thread safe, only used from the GPU thread.
+ * Allocations served by the arenas and heap allocations made by them are exported as metrics.
+ */
+class FrameArena {
+public:
+    static constexpr size_t NUM_FRAMES = 3;
+
+    explicit FrameArena();
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// Returns the memory resource of the current frame
+    [[nodiscard]] std::pmr::memory_resource* Resource() noexcept;
+
+    /// Moves to the next frame, releasing the allocations made in its arena before
+    void NextFrame();
+
+private:
+    struct Arena;
+
+    std::array<std::unique_ptr<Arena>, NUM_FRAMES> arenas;
+    size_t current_frame{};
+};
+
+} // namespace VideoCommon
@@ -7,6 +7,10 @@
 #include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/microprofile.h"
@@ -96,9 +100,10 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes(
-            [this](PAddr address, size_t size) { rasterizer->OnCacheInvalidation(address, size); });
-        system.GatherGPUDirtyMemory(callback_writes);
+        system.GatherGPUDirtyMemory(dirty_ranges);
+        if (!dirty_ranges.empty()) {
+            rasterizer->OnCacheInvalidation(dirty_ranges);
+        }
     }
 
     /// Signal the ending of command list.
@@ -215,7 +220,32 @@ struct GPU::Impl {
     }
 
     void RendererFrameEndNotify() {
-        system.GetPerfStats().EndGameFrame();
+        auto& perf_stats = system.GetPerfStats();
+        const int shaders_completed = shader_notify->ShadersCompleted();
+        const int previous_completed = std::exchange(frame_shaders_completed, shaders_completed);
+        perf_stats.AddShaderBuilds(static_cast<u32>(shaders_completed - previous_completed));
+        perf_stats.EndGameFrame();
+    }
+
+    void RendererPresentLatencyNotify(std::chrono::nanoseconds latency) {
+        system.GetPerfStats().AddPresentLatency(latency);
+    }
+
+    void RendererGpuTimeNotify(std::chrono::nanoseconds gpu_time) {
+        system.GetPerfStats().AddGpuTime(gpu_time);
+    }
+
+    void RendererFrameDisplayedNotify(std::chrono::steady_clock::time_point displayed) {
+        last_display_time.store(displayed.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> GetLastDisplayTime() const {
+        const auto displayed = last_display_time.load(std::memory_order_relaxed);
+        if (displayed == 0) {
+            return std::nullopt;
+        }
+        using Clock = std::chrono::steady_clock;
+        return Clock::time_point{Clock::duration{displayed}};
     }
 
     /// Performs any additional setup necessary in order to begin GPU emulation.
@@ -364,8 +394,12 @@ struct GPU::Impl {
     s32 new_channel_id{1};
     /// Shader build notifier
     std::unique_ptr<VideoCore::ShaderNotify> shader_notify;
+    /// Shaders completed when the previous game frame ended
+    int frame_shaders_completed{};
     /// When true, we are about to shut down emulation session, so terminate outstanding tasks
     std::atomic_bool shutting_down{};
+    /// Host steady clock time the last frame was displayed at, zero when unknown
+    std::atomic<std::chrono::steady_clock::rep> last_display_time{};
 
     std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> syncpoints{};
 
@@ -387,6 +421,9 @@ struct GPU::Impl {
     VideoCommon::GPUThread::ThreadManager gpu_thread;
     std::unique_ptr<Core::Frontend::GraphicsContext> cpu_context;
 
+    /// CPU written ranges gathered on cache invalidations, kept to reuse its allocation
+    std::vector<std::pair<PAddr, size_t>> dirty_ranges;
+
     std::unique_ptr<Tegra::Control::Scheduler> scheduler;
     std::unordered_map<s32, std::shared_ptr<Tegra::Control::ChannelState>> channels;
     Tegra::Control::ChannelState* current_channel;
@@ -526,6 +563,22 @@ void GPU::RendererFrameEndNotify() {
     impl->RendererFrameEndNotify();
 }
 
+void GPU::RendererPresentLatencyNotify(std::chrono::nanoseconds latency) {
+    impl->RendererPresentLatencyNotify(latency);
+}
+
+void GPU::RendererGpuTimeNotify(std::chrono::nanoseconds gpu_time) {
+    impl->RendererGpuTimeNotify(gpu_time);
+}
+
+void GPU::RendererFrameDisplayedNotify(std::chrono::steady_clock::time_point displayed) {
+    impl->RendererFrameDisplayedNotify(displayed);
+}
+
+std::optional<std::chrono::steady_clock::time_point> GPU::GetLastDisplayTime() const {
+    return impl->GetLastDisplayTime();
+}
+
 void GPU::Start() {
     impl->Start();
 }
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -212,6 +214,18 @@ public:
 
     void RendererFrameEndNotify();
 
+    /// Reports the estimated latency between the guest sampling input and a frame being displayed
+    void RendererPresentLatencyNotify(std::chrono::nanoseconds latency);
+
+    /// Reports the GPU time spent on the work the host GPU completed since the last report
+    void RendererGpuTimeNotify(std::chrono::nanoseconds gpu_time);
+
+    /// Reports when the host display showed a frame
+    void RendererFrameDisplayedNotify(std::chrono::steady_clock::time_point displayed);
+
+    /// Returns when the host display last showed a frame, nothing when the renderer can't tell
+    [[nodiscard]] std::optional<std::chrono::steady_clock::time_point> GetLastDisplayTime() const;
+
     void RequestSwapBuffers(const Tegra::FramebufferConfig* framebuffer,
                             std::array<Service::Nvidia::NvFence, 4>& fences, size_t num_fences);
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/assert.h"
+#include "common/metrics.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -16,6 +17,16 @@
 
 namespace VideoCommon::GPUThread {
 
+/// Accounts the time a command list waited in the queue before the GPU thread picked it up
+static void RecordQueueLatency(std::chrono::steady_clock::time_point submit_time) {
+    static auto& queue_seconds = Common::Metrics::GetRegistry().RegisterHistogram(
+        "yuzu_gpu_thread_queue_latency_seconds",
+        "Host time from a command list submission until the GPU thread starts processing it",
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05});
+    queue_seconds.Observe(
+        std::chrono::duration<f64>(std::chrono::steady_clock::now() - submit_time).count());
+}
+
 /// Runs the GPU thread
 static void RunThread(std::stop_token stop_token, Core::System& system,
                       VideoCore::RendererBase& renderer, Core::Frontend::GraphicsContext& context,
@@ -26,6 +37,7 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
 
     Common::SetCurrentThreadName(name.c_str());
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
+    Common::SetCurrentThreadCoreClass(Common::ThreadCoreClass::Performance);
     system.RegisterHostThread();
 
     auto current_context = context.Acquire();
@@ -34,12 +46,15 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
     CommandDataContainer next;
 
     while (!stop_token.stop_requested()) {
-        state.queue.PopWait(next, stop_token);
-        if (stop_token.stop_requested()) {
+        if (!state.queue.PopWait(next, stop_token)) {
             break;
         }
         if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
+            RecordQueueLatency(next.submit_time);
             scheduler.Push(submit_list->channel, std::move(submit_list->entries));
+            // Serve pending flushes as soon as their producing work is done, without waiting for
+            // the rest of the queue to drain first
+            system.GPU().TickWork();
         } else if (const auto* data = std::get_if<SwapBuffersCommand>(&next.data)) {
             renderer.SwapBuffers(data->framebuffer ? &*data->framebuffer : nullptr);
         } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
@@ -91,6 +106,10 @@ void ThreadManager::FlushRegion(DAddr addr, u64 size) {
     if (!Settings::IsGPULevelExtreme()) {
         return;
     }
+    if (!rasterizer->MustFlushRegion(addr, size)) {
+        // Nothing the host GPU has written is pending for this region
+        return;
+    }
     auto& gpu = system.GPU();
     u64 fence = gpu.RequestFlush(addr, size);
     TickGPU();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <optional>
@@ -88,16 +89,19 @@ struct CommandDataContainer {
     CommandDataContainer() = default;
 
     explicit CommandDataContainer(CommandData&& data_, u64 next_fence_, bool block_)
-        : data{std::move(data_)}, fence{next_fence_}, block(block_) {}
+        : data{std::move(data_)}, fence{next_fence_}, block(block_),
+          submit_time{std::chrono::steady_clock::now()} {}
 
     CommandData data;
     u64 fence{};
     bool block{};
+    std::chrono::steady_clock::time_point submit_time{};
 };
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    /// Producers are serialized by write_lock, the GPU thread is only woken up when it is parked
+    using CommandQueue = Common::SpinningSPSCQueue<CommandDataContainer>;
     std::mutex write_lock;
     CommandQueue queue;
     u64 last_fence{};
@@ -3,6 +3,7 @@
 
 #include "common/assert.h"
 #include "common/settings.h"
+#include "common/thread.h"
 #include "video_core/host1x/codecs/codec.h"
 #include "video_core/host1x/codecs/h264.h"
 #include "video_core/host1x/codecs/vp8.h"
@@ -15,7 +16,9 @@ namespace Tegra {
 Codec::Codec(Host1x::Host1x& host1x_, const Host1x::NvdecCommon::NvdecRegisters& regs)
     : host1x(host1x_), state{regs}, h264_decoder(std::make_unique<Decoder::H264>(host1x)),
       vp8_decoder(std::make_unique<Decoder::VP8>(host1x)),
-      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {}
+      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {
+    decode_thread = std::jthread([this](std::stop_token stop_token) { DecodeThread(stop_token); });
+}
 
 Codec::~Codec() = default;
 
@@ -59,26 +62,58 @@ void Codec::Decode() {
         }
     }();
 
-    // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data, configuration_size)) {
-        return;
-    }
-
+    // The bitstream is composed from guest memory here, decoding happens on the worker thread.
     // Only receive/store visible frames.
-    if (vp9_hidden_frame) {
-        return;
+    {
+        std::scoped_lock lock{queue_mutex};
+        pending_packets.push(PendingPacket{
+            .data{packet_data.begin(), packet_data.end()},
+            .configuration_size = configuration_size,
+            .receive_frames = !vp9_hidden_frame,
+        });
+        ++num_packets_in_flight;
     }
+    submit_cv.notify_one();
+}
 
-    // Receive output frames from decoder.
-    decode_api.ReceiveFrames(frames);
-
-    while (frames.size() > 10) {
-        LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
-        frames.pop();
+void Codec::DecodeThread(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("NvdecDecoder");
+    std::queue<std::unique_ptr<FFmpeg::Frame>> decoded_frames;
+    while (!stop_token.stop_requested()) {
+        PendingPacket packet;
+        {
+            std::unique_lock lock{queue_mutex};
+            if (!submit_cv.wait(lock, stop_token, [this] { return !pending_packets.empty(); })) {
+                return;
+            }
+            packet = std::move(pending_packets.front());
+            pending_packets.pop();
+        }
+        // Send assembled bitstream to decoder and receive its output frames.
+        if (decode_api.SendPacket(packet.data, packet.configuration_size) &&
+            packet.receive_frames) {
+            decode_api.ReceiveFrames(decoded_frames);
+        }
+        {
+            std::scoped_lock lock{queue_mutex};
+            while (!decoded_frames.empty()) {
+                frames.push(std::move(decoded_frames.front()));
+                decoded_frames.pop();
+            }
+            while (frames.size() > FFmpeg::MaxPendingFrames) {
+                LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
+                frames.pop();
+            }
+            --num_packets_in_flight;
+        }
+        decoded_cv.notify_all();
     }
 }
 
 std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
+    std::unique_lock lock{queue_mutex};
+    decoded_cv.wait(lock, [this] { return !frames.empty() || num_packets_in_flight == 0; });
+
     // Sometimes VIC will request more frames than have been decoded.
     // in this case, return a blank frame and don't overwrite previous data.
     if (frames.empty()) {
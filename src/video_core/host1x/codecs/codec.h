@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <stop_token>
 #include <string_view>
+#include <thread>
 #include <queue>
+#include <vector>
 #include "common/common_types.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
@@ -34,10 +39,10 @@ public:
     /// Sets NVDEC video stream codec
     void SetTargetCodec(Host1x::NvdecCommon::VideoCodec codec);
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, the AVFrame is decoded with ffmpeg on a worker thread
     void Decode();
 
-    /// Returns next decoded frame
+    /// Returns next decoded frame, waiting for the bitstreams submitted before it to be decoded
     [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetCurrentFrame();
 
     /// Returns the value of current_codec
@@ -47,6 +52,15 @@ public:
     [[nodiscard]] std::string_view GetCurrentCodecName() const;
 
 private:
+    struct PendingPacket {
+        std::vector<u8> data;
+        size_t configuration_size;
+        bool receive_frames;
+    };
+
+    /// Decodes the submitted bitstreams ahead of VIC
+    void DecodeThread(std::stop_token stop_token);
+
     bool initialized{};
     Host1x::NvdecCommon::VideoCodec current_codec{Host1x::NvdecCommon::VideoCodec::None};
     FFmpeg::DecodeApi decode_api;
@@ -57,7 +71,14 @@ private:
     std::unique_ptr<Decoder::VP8> vp8_decoder;
     std::unique_ptr<Decoder::VP9> vp9_decoder;
 
+    std::mutex queue_mutex;
+    std::condition_variable_any submit_cv;
+    std::condition_variable_any decoded_cv;
+    std::queue<PendingPacket> pending_packets;
+    size_t num_packets_in_flight{};
     std::queue<std::unique_ptr<FFmpeg::Frame>> frames{};
+
+    std::jthread decode_thread;
 };
 
 } // namespace Tegra
@@ -8,6 +8,7 @@
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 
 extern "C" {
+#include <libavutil/hwcontext.h>
 #ifdef LIBVA_FOUND
 // for querying VAAPI driver information
 #include <libavutil/hwcontext_vaapi.h>
@@ -47,6 +48,15 @@ AVPixelFormat GetGpuFormat(AVCodecContext* codec_context, const AVPixelFormat* p
     return codec_context->pix_fmt;
 }
 
+bool CanMapFrame(const AVFrame* frame) {
+    if (!frame->hw_frames_ctx) {
+        return false;
+    }
+    // Only map surfaces that are already laid out the way VIC expects them
+    const auto* frames_ctx = reinterpret_cast<const AVHWFramesContext*>(frame->hw_frames_ctx->data);
+    return frames_ctx->sw_format == PreferredGpuFormat;
+}
+
 std::string AVError(int errnum) {
     char errbuf[AV_ERROR_MAX_STRING_SIZE] = {};
     av_make_error_string(errbuf, sizeof(errbuf) - 1, errnum);
@@ -200,6 +210,9 @@ void DecoderContext::InitializeHardwareDecoder(const HardwareContext& context,
     m_codec_context->hw_device_ctx = av_buffer_ref(context.GetBufferRef());
     m_codec_context->get_format = GetGpuFormat;
     m_codec_context->pix_fmt = hw_pix_fmt;
+    // Mapped frames keep their surface alive until VIC consumes them, reserve enough surfaces
+    // for the pending frames and the one being converted
+    m_codec_context->extra_hw_frames = static_cast<int>(MaxPendingFrames) + 1;
 }
 
 bool DecoderContext::OpenContext(const Decoder& decoder) {
@@ -251,6 +264,15 @@ std::unique_ptr<Frame> DecoderContext::ReceiveFrame(bool* out_is_interlaced) {
             return {};
         }
 
+        // Map the decoded surface to system memory when the driver allows it, transferring it
+        // makes another copy of the whole frame
+        dst_frame->SetFormat(PreferredGpuFormat);
+        if (CanMapFrame(intermediate_frame.GetFrame()) &&
+            av_hwframe_map(dst_frame->GetFrame(), intermediate_frame.GetFrame(),
+                           AV_HWFRAME_MAP_READ) >= 0) {
+            return dst_frame;
+        }
+        av_frame_unref(dst_frame->GetFrame());
         dst_frame->SetFormat(PreferredGpuFormat);
         if (const int ret =
                 av_hwframe_transfer_data(dst_frame->GetFrame(), intermediate_frame.GetFrame(), 0);
@@ -40,6 +40,9 @@ class HardwareContext;
 class DecoderContext;
 class DeinterlaceFilter;
 
+// Maximum number of decoded frames waiting to be consumed by VIC.
+constexpr size_t MaxPendingFrames = 10;
+
 // Wraps an AVPacket, a container for compressed bitstream data.
 class Packet {
 public:
@@ -5,7 +5,6 @@
 
 #include <array>
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <list>
 #include <mutex>
@@ -67,8 +66,7 @@ public:
     }
 
 private:
-    void Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                   std::list<RegisteredAction>& action_storage);
+    void Increment(std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage);
 
     ActionHandle RegisterAction(std::atomic<u32>& syncpoint,
                                 std::list<RegisteredAction>& action_storage, u32 expected_value,
@@ -76,7 +74,10 @@ private:
 
     void DeregisterAction(std::list<RegisteredAction>& action_storage, const ActionHandle& handle);
 
-    void Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv, u32 expected_value);
+    /// Blocks on a waiter registered in the action list of the syncpoint, so only increments
+    /// reaching the expected value wake the thread
+    void Wait(std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage,
+              u32 expected_value);
 
     static constexpr size_t NUM_MAX_SYNCPOINTS = 192;
 
@@ -87,8 +88,6 @@ private:
     std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> host_action_storage;
 
     std::mutex guard;
-    std::condition_variable wait_guest_cv;
-    std::condition_variable wait_host_cv;
 };
 
 } // namespace Host1x
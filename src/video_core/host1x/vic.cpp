@@ -19,6 +19,7 @@ extern "C" {
 #include "common/logging/log.h"
 
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/nvdec.h"
 #include "video_core/host1x/vic.h"
@@ -157,12 +158,14 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         // swizzle pitch linear to block linear
         const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
         const auto size = Texture::CalculateSize(true, 4, width, height, 1, block_height, 0);
+        // Swizzle straight into guest memory, the scratch buffer is only used when the surface
+        // is not contiguous in host memory
         luma_buffer.resize_destructive(size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            output(host1x.GMMU(), output_surface_luma_address, size, &luma_buffer);
         std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * width * height);
-        Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0, 0, width, height,
+        Texture::SwizzleSubrect(output, frame_buff, 4, width, height, 1, 0, 0, width, height,
                                 block_height, 0, width * 4);
-
-        host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), size);
     } else {
         // send pitch linear frame
         const size_t linear_size = width * height * 4;
@@ -183,28 +186,37 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
 
     const auto stride = static_cast<size_t>(frame->GetStride(0));
 
-    luma_buffer.resize_destructive(aligned_width * surface_height);
-    chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
-
-    // Populate luma buffer
-    const u8* luma_src = frame->GetData(0);
-    for (std::size_t y = 0; y < frame_height; ++y) {
-        const std::size_t src = y * stride;
-        const std::size_t dst = y * aligned_width;
-        std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
+    // Planes are written straight into guest memory, the scratch buffers are only used when the
+    // surfaces are not contiguous in host memory
+    using GuestSurface =
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>;
+    const std::size_t luma_size = aligned_width * surface_height;
+    const std::size_t chroma_size = aligned_width * surface_height / 2;
+    luma_buffer.resize_destructive(luma_size);
+    chroma_buffer.resize_destructive(chroma_size);
+
+    // Populate luma surface
+    {
+        GuestSurface luma(host1x.GMMU(), output_surface_luma_address, luma_size, &luma_buffer);
+        const u8* luma_src = frame->GetData(0);
+        for (std::size_t y = 0; y < frame_height; ++y) {
+            const std::size_t src = y * stride;
+            const std::size_t dst = y * aligned_width;
+            std::memcpy(luma.data() + dst, luma_src + src, frame_width);
+        }
     }
-    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
 
     // Chroma
     const std::size_t half_height = frame_height / 2;
     const auto half_stride = static_cast<size_t>(frame->GetStride(1));
+    GuestSurface chroma(host1x.GMMU(), output_surface_chroma_address, chroma_size, &chroma_buffer);
 
     switch (frame->GetPixelFormat()) {
     case AV_PIX_FMT_YUV420P: {
         // Frame from FFmpeg software
         // Populate chroma buffer from both channels with interleaving.
         const std::size_t half_width = frame_width / 2;
-        u8* chroma_buffer_data = chroma_buffer.data();
+        u8* chroma_buffer_data = chroma.data();
         const u8* chroma_b_src = frame->GetData(1);
         const u8* chroma_r_src = frame->GetData(2);
         for (std::size_t y = 0; y < half_height; ++y) {
@@ -224,7 +236,7 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         for (std::size_t y = 0; y < half_height; ++y) {
             const std::size_t src = y * stride;
             const std::size_t dst = y * aligned_width;
-            std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+            std::memcpy(chroma.data() + dst, chroma_src + src, frame_width);
         }
         break;
     }
@@ -232,8 +244,6 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         ASSERT(false);
         break;
     }
-    host1x.GMMU().WriteBlock(output_surface_chroma_address, chroma_buffer.data(),
-                             chroma_buffer.size());
 }
 
 } // namespace Host1x
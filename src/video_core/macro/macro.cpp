@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <fstream>
 #include <optional>
@@ -21,6 +23,8 @@
 
 #ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
+#elif defined(ARCHITECTURE_arm64)
+#include "video_core/macro/macro_jit_arm64.h"
 #endif
 
 MICROPROFILE_DEFINE(MacroHLE, "GPU", "Execute macro HLE", MP_RGB(128, 192, 192));
@@ -57,7 +61,9 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d_)
     : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    ReportProfiles();
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -76,8 +82,7 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
             MICROPROFILE_SCOPE(MacroHLE);
             cache_info.hle_program->Execute(parameters, method);
         } else {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
+            ExecuteLLE(cache_info, parameters, method);
         }
     } else {
         // Macro not compiled, check if it's uploaded and if so, compile it
@@ -113,8 +118,7 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
 
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
         if (!hle_program || Settings::values.disable_macro_hle) {
-            maxwell3d.RefreshParameters();
-            cache_info.lle_program->Execute(parameters, method);
+            ExecuteLLE(cache_info, parameters, method);
         } else {
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program);
@@ -128,12 +132,65 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     }
 }
 
+void MacroEngine::ExecuteLLE(const CacheInfo& cache_info, const std::vector<u32>& parameters,
+                             u32 method) {
+    maxwell3d.RefreshParameters();
+    if (!Settings::values.profile_macros) {
+        cache_info.lle_program->Execute(parameters, method);
+        return;
+    }
+    const auto start{std::chrono::steady_clock::now()};
+    cache_info.lle_program->Execute(parameters, method);
+    const auto end{std::chrono::steady_clock::now()};
+
+    MacroProfile& profile = macro_profiles[cache_info.hash];
+    if (profile.num_calls == 0) {
+        if (const auto it = uploaded_macro_code.find(method); it != uploaded_macro_code.end()) {
+            profile.code = it->second;
+        }
+    }
+    ++profile.num_calls;
+    profile.execution_ns += static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void MacroEngine::ReportProfiles() const {
+    if (macro_profiles.empty()) {
+        return;
+    }
+    std::vector<std::pair<u64, const MacroProfile*>> profiles;
+    profiles.reserve(macro_profiles.size());
+    for (const auto& [hash, profile] : macro_profiles) {
+        profiles.emplace_back(hash, &profile);
+    }
+    constexpr size_t MAX_REPORTED_MACROS = 16;
+    const size_t num_reported = std::min(profiles.size(), MAX_REPORTED_MACROS);
+    std::ranges::partial_sort(profiles, profiles.begin() + num_reported, std::greater{},
+                              [](const auto& pair) { return pair.second->execution_ns; });
+    std::string report;
+    for (size_t index = 0; index < num_reported; ++index) {
+        const auto& [hash, profile] = profiles[index];
+        report += fmt::format("0x{:016x} {:4} words {:10} calls {:9.1f} ms {:7} ns/call\n", hash,
+                              profile->code.size(), profile->num_calls,
+                              static_cast<double>(profile->execution_ns) / 1'000'000.0,
+                              profile->execution_ns / profile->num_calls);
+        Dump(hash, profile->code);
+    }
+    LOG_INFO(HW_GPU,
+             "\nHottest macros without HLE, dumped to the macro dump directory\n"
+             "======================================================================\n"
+             "{}",
+             report);
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
     }
 #ifdef ARCHITECTURE_x86_64
     return std::make_unique<MacroJITx64>(maxwell3d);
+#elif defined(ARCHITECTURE_arm64)
+    return std::make_unique<MacroJITArm64>(maxwell3d);
 #else
     return std::make_unique<MacroInterpreter>(maxwell3d);
 #endif
@@ -134,7 +134,20 @@ private:
         bool has_hle_program{};
     };
 
+    /// Execution statistics of a macro without an HLE implementation
+    struct MacroProfile {
+        std::vector<u32> code;
+        u64 num_calls{};
+        u64 execution_ns{};
+    };
+
+    void ExecuteLLE(const CacheInfo& cache_info, const std::vector<u32>& parameters, u32 method);
+
+    /// Logs and dumps the macros that took the most time to execute
+    void ReportProfiles() const;
+
     std::unordered_map<u32, CacheInfo> macro_cache;
+    std::unordered_map<u64, MacroProfile> macro_profiles;
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
     Engines::Maxwell3D& maxwell3d;
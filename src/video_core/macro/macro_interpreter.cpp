@@ -3,6 +3,7 @@
 
 #include <array>
 #include <optional>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -14,10 +15,54 @@ MICROPROFILE_DEFINE(MacroInterp, "GPU", "Execute macro interpreter", MP_RGB(128,
 
 namespace Tegra {
 namespace {
+/// Macro instruction with its fields extracted ahead of execution, so each step only reads them
+struct DecodedOpcode {
+    Macro::Operation operation;
+    Macro::ResultOperation result_operation;
+    Macro::ALUOperation alu_operation;
+    Macro::BranchCondition branch_condition;
+    bool branch_annul;
+    bool is_exit;
+    u8 dst;
+    u8 src_a;
+    u8 src_b;
+    u8 bf_src_bit;
+    u8 bf_dst_bit;
+    u32 bitfield_mask;
+    /// Sign extended immediate, added with wrap around
+    u32 immediate;
+    /// Index of the instruction a taken branch jumps to
+    u32 branch_target;
+};
+
+std::vector<DecodedOpcode> Decode(const std::vector<u32>& code) {
+    std::vector<DecodedOpcode> decoded(code.size());
+    for (size_t index = 0; index < code.size(); ++index) {
+        const Macro::Opcode opcode{code[index]};
+        decoded[index] = DecodedOpcode{
+            .operation = opcode.operation,
+            .result_operation = opcode.result_operation,
+            .alu_operation = opcode.alu_operation,
+            .branch_condition = opcode.branch_condition,
+            .branch_annul = opcode.branch_annul != 0,
+            .is_exit = opcode.is_exit != 0,
+            .dst = static_cast<u8>(opcode.dst.Value()),
+            .src_a = static_cast<u8>(opcode.src_a.Value()),
+            .src_b = static_cast<u8>(opcode.src_b.Value()),
+            .bf_src_bit = static_cast<u8>(opcode.bf_src_bit.Value()),
+            .bf_dst_bit = static_cast<u8>(opcode.bf_dst_bit.Value()),
+            .bitfield_mask = opcode.GetBitfieldMask(),
+            .immediate = static_cast<u32>(opcode.immediate.Value()),
+            .branch_target = static_cast<u32>(index) + static_cast<u32>(opcode.immediate.Value()),
+        };
+    }
+    return decoded;
+}
+
 class MacroInterpreterImpl final : public CachedMacro {
 public:
     explicit MacroInterpreterImpl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
-        : maxwell3d{maxwell3d_}, code{code_} {}
+        : maxwell3d{maxwell3d_}, code{Decode(code_)} {}
 
     void Execute(const std::vector<u32>& params, u32 method) override;
 
@@ -44,8 +89,8 @@ private:
     /// Evaluates the branch condition and returns whether the branch should be taken or not.
     bool EvaluateBranchCondition(Macro::BranchCondition cond, u32 value) const;
 
-    /// Reads an opcode at the current program counter location.
-    Macro::Opcode GetOpcode() const;
+    /// Reads the decoded instruction at the current program counter location.
+    const DecodedOpcode& GetOpcode() const;
 
     /// Returns the specified register's value. Register 0 is hardcoded to always return 0.
     u32 GetRegister(u32 register_id) const;
@@ -67,7 +112,7 @@ private:
 
     Engines::Maxwell3D& maxwell3d;
 
-    /// Current program counter
+    /// Index of the current instruction
     u32 pc{};
     /// Program counter to execute at after the delay slot is executed.
     std::optional<u32> delayed_pc;
@@ -86,7 +131,8 @@ private:
     u32 next_parameter_index = 0;
 
     bool carry_flag = false;
-    const std::vector<u32>& code;
+    /// Code of the macro, decoded once when it is compiled
+    const std::vector<DecodedOpcode> code;
 };
 
 void MacroInterpreterImpl::Execute(const std::vector<u32>& params, u32 method) {
@@ -125,10 +171,8 @@ void MacroInterpreterImpl::Reset() {
 }
 
 bool MacroInterpreterImpl::Step(bool is_delay_slot) {
-    u32 base_address = pc;
-
-    Macro::Opcode opcode = GetOpcode();
-    pc += 4;
+    const DecodedOpcode& opcode = GetOpcode();
+    ++pc;
 
     // Update the program counter if we were delayed
     if (delayed_pc) {
@@ -153,8 +197,8 @@ bool MacroInterpreterImpl::Step(bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        src = (src >> opcode.bf_src_bit) & opcode.GetBitfieldMask();
-        dst &= ~(opcode.GetBitfieldMask() << opcode.bf_dst_bit);
+        src = (src >> opcode.bf_src_bit) & opcode.bitfield_mask;
+        dst &= ~(opcode.bitfield_mask << opcode.bf_dst_bit);
         dst |= src << opcode.bf_dst_bit;
         ProcessResult(opcode.result_operation, opcode.dst, dst);
         break;
@@ -163,7 +207,7 @@ bool MacroInterpreterImpl::Step(bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        u32 result = ((src >> dst) & opcode.GetBitfieldMask()) << opcode.bf_dst_bit;
+        u32 result = ((src >> dst) & opcode.bitfield_mask) << opcode.bf_dst_bit;
 
         ProcessResult(opcode.result_operation, opcode.dst, result);
         break;
@@ -172,7 +216,7 @@ bool MacroInterpreterImpl::Step(bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        u32 result = ((src >> opcode.bf_src_bit) & opcode.GetBitfieldMask()) << dst;
+        u32 result = ((src >> opcode.bf_src_bit) & opcode.bitfield_mask) << dst;
 
         ProcessResult(opcode.result_operation, opcode.dst, result);
         break;
@@ -189,18 +233,18 @@ bool MacroInterpreterImpl::Step(bool is_delay_slot) {
         if (taken) {
             // Ignore the delay slot if the branch has the annul bit.
             if (opcode.branch_annul) {
-                pc = base_address + opcode.GetBranchTarget();
+                pc = opcode.branch_target;
                 return true;
             }
 
-            delayed_pc = base_address + opcode.GetBranchTarget();
+            delayed_pc = opcode.branch_target;
             // Execute one more instruction due to the delay slot.
             return Step(true);
         }
         break;
     }
     default:
-        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", opcode.operation.Value());
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", opcode.operation);
         break;
     }
 
@@ -312,14 +356,14 @@ bool MacroInterpreterImpl::EvaluateBranchCondition(Macro::BranchCondition cond,
     UNREACHABLE();
 }
 
-Macro::Opcode MacroInterpreterImpl::GetOpcode() const {
-    ASSERT((pc % sizeof(u32)) == 0);
-    ASSERT(pc < code.size() * sizeof(u32));
-    return {code[pc / sizeof(u32)]};
+const DecodedOpcode& MacroInterpreterImpl::GetOpcode() const {
+    ASSERT(pc < code.size());
+    return code[pc];
 }
 
 u32 MacroInterpreterImpl::GetRegister(u32 register_id) const {
-    return registers.at(register_id);
+    // Register fields are three bits wide, so the decoded indices are always in range
+    return registers[register_id];
 }
 
 void MacroInterpreterImpl::SetRegister(u32 register_id, u32 value) {
@@ -329,7 +373,7 @@ void MacroInterpreterImpl::SetRegister(u32 register_id, u32 value) {
         return;
     }
 
-    registers.at(register_id) = value;
+    registers[register_id] = value;
 }
 
 void MacroInterpreterImpl::SetMethodAddress(u32 address) {
@@ -0,0 +1,515 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <oaknut/code_block.hpp>
+#include <oaknut/oaknut.hpp>
+
+#include "common/assert.h"
+#include "common/bit_cast.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_jit_arm64.h"
+
+MICROPROFILE_DEFINE(MacroJitArm64Compile, "GPU", "Compile macro JIT", MP_RGB(173, 255, 47));
+MICROPROFILE_DEFINE(MacroJitArm64Execute, "GPU", "Execute macro JIT", MP_RGB(255, 255, 0));
+
+namespace Tegra {
+namespace {
+using namespace oaknut::util;
+
+// All the state lives in callee saved registers so it survives the calls to Maxwell3D
+constexpr oaknut::XReg REGISTERS = X19;
+constexpr oaknut::WReg RESULT = W20;
+constexpr oaknut::XReg RESULT_64 = X20;
+constexpr oaknut::XReg PARAMETERS = X21;
+constexpr oaknut::XReg MAX_PARAMETER = X22;
+constexpr oaknut::WReg METHOD_ADDRESS = W23;
+constexpr oaknut::XReg REG_ARRAY = X24;
+constexpr oaknut::WReg CARRY = W25;
+constexpr oaknut::XReg MAXWELL3D = X26;
+
+// Space for the host code of a single macro instruction, including its copies in delay slots
+constexpr size_t CODE_SIZE_PER_INSTRUCTION = 512;
+constexpr size_t BASE_CODE_SIZE = 0x1000;
+
+void Send(Engines::Maxwell3D* maxwell3d, u32 method_address, u32 value) {
+    maxwell3d->CallMethod(Macro::MethodAddress{method_address}.address, value, true);
+}
+
+void WarnInvalidParameter(uintptr_t parameter, uintptr_t max_parameter) {
+    LOG_CRITICAL(HW_GPU,
+                 "Macro JIT: invalid parameter access 0x{:x} (0x{:x} is the last parameter)",
+                 parameter, max_parameter - sizeof(u32));
+}
+
+class MacroJITArm64Impl final : public CachedMacro {
+public:
+    explicit MacroJITArm64Impl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
+        : code{code_}, maxwell3d{maxwell3d_},
+          code_block{BASE_CODE_SIZE + code.size() * CODE_SIZE_PER_INSTRUCTION},
+          c{code_block.ptr()}, labels(code.size()), delay_slots(code.size()) {
+        Compile();
+    }
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override;
+
+private:
+    using ProgramType = void (*)(u32*, const u32*, const u32*);
+
+    struct OptimizerState {
+        bool can_skip_carry{};
+        bool zero_reg_skip{};
+        bool skip_dummy_addimmediate{};
+    };
+
+    void Optimizer_ScanFlags();
+
+    void Compile();
+    void Compile_Instruction(u32 index, bool is_delay_slot);
+
+    void Compile_ALU(Macro::Opcode opcode);
+    void Compile_AddImmediate(Macro::Opcode opcode);
+    void Compile_ExtractInsert(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftRegister(Macro::Opcode opcode);
+    void Compile_Read(Macro::Opcode opcode);
+    void Compile_Branch(u32 index, Macro::Opcode opcode);
+
+    oaknut::WReg Compile_FetchParameter();
+    oaknut::WReg Compile_GetRegister(u32 index, oaknut::WReg dst);
+    void Compile_AddImmediateTo(oaknut::WReg dst, u32 src_index, s32 immediate);
+    void Compile_ExtractBits(oaknut::WReg dst, oaknut::WReg src, u32 lsb, u32 size);
+
+    void Compile_ProcessResult(Macro::ResultOperation operation, u32 reg);
+    void Compile_Send(oaknut::WReg value);
+
+    const std::vector<u32>& code;
+    Engines::Maxwell3D& maxwell3d;
+
+    oaknut::CodeBlock code_block;
+    oaknut::CodeGenerator c;
+    ProgramType program{nullptr};
+
+    OptimizerState optimizer{};
+
+    std::vector<oaknut::Label> labels;
+    std::vector<oaknut::Label> delay_slots;
+    std::vector<std::pair<u32, u32>> delayed_branches;
+    oaknut::Label end_of_code;
+};
+
+void MacroJITArm64Impl::Execute(const std::vector<u32>& parameters, u32 method) {
+    MICROPROFILE_SCOPE(MacroJitArm64Execute);
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    std::array<u32, Macro::NUM_MACRO_REGISTERS> registers{};
+    program(registers.data(), parameters.data(), parameters.data() + parameters.size());
+}
+
+void MacroJITArm64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const oaknut::WReg src_a{Compile_GetRegister(opcode.src_a, RESULT)};
+    const oaknut::WReg src_b{Compile_GetRegister(opcode.src_b, W1)};
+
+    // The macro carry flag has the same semantics as the AArch64 one, including subtractions
+    // setting it when there is no borrow
+    const auto load_carry{[this] { c.CMP(CARRY, 1); }};
+    const auto store_carry{[this] { c.CSET(CARRY, oaknut::Cond::CS); }};
+
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        if (optimizer.can_skip_carry) {
+            c.ADD(RESULT, src_a, src_b);
+        } else {
+            c.ADDS(RESULT, src_a, src_b);
+            store_carry();
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        load_carry();
+        c.ADCS(RESULT, src_a, src_b);
+        store_carry();
+        break;
+    case Macro::ALUOperation::Subtract:
+        if (optimizer.can_skip_carry) {
+            c.SUB(RESULT, src_a, src_b);
+        } else {
+            c.SUBS(RESULT, src_a, src_b);
+            store_carry();
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        load_carry();
+        c.SBCS(RESULT, src_a, src_b);
+        store_carry();
+        break;
+    case Macro::ALUOperation::Xor:
+        c.EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        c.ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        c.AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        c.BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        c.AND(RESULT, src_a, src_b);
+        c.MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    if (optimizer.skip_dummy_addimmediate) {
+        // Games tend to use this as an exit instruction placeholder. It's to encode an instruction
+        // without doing anything. In our case we can just not emit anything.
+        if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+            return;
+        }
+    }
+    Compile_AddImmediateTo(RESULT, opcode.src_a, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, RESULT);
+    const u32 size{opcode.bf_size};
+    const u32 src_bit{opcode.bf_src_bit};
+    const u32 dst_bit{opcode.bf_dst_bit};
+    if (size != 0) {
+        // Bits shifted out of the 32-bit range are discarded, as on the interpreter
+        const oaknut::WReg src{Compile_GetRegister(opcode.src_b, W1)};
+        Compile_ExtractBits(W1, src, src_bit, size);
+        c.BFI(RESULT, W1, dst_bit, std::min(size, 32 - dst_bit));
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    const oaknut::WReg shift{Compile_GetRegister(opcode.src_a, W2)};
+    const oaknut::WReg src{Compile_GetRegister(opcode.src_b, W1)};
+    if (opcode.bf_size == 0) {
+        c.MOV(RESULT, 0);
+    } else {
+        c.LSRV(W1, src, shift);
+        Compile_ExtractBits(W1, W1, 0, opcode.bf_size);
+        c.LSL(RESULT, W1, opcode.bf_dst_bit.Value());
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    const oaknut::WReg shift{Compile_GetRegister(opcode.src_a, W2)};
+    const oaknut::WReg src{Compile_GetRegister(opcode.src_b, W1)};
+    if (opcode.bf_size == 0) {
+        c.MOV(RESULT, 0);
+    } else {
+        Compile_ExtractBits(W1, src, opcode.bf_src_bit, opcode.bf_size);
+        c.LSLV(RESULT, W1, shift);
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_AddImmediateTo(RESULT, opcode.src_a, opcode.immediate);
+
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue, out of range reads return zero
+    oaknut::Label out_of_range;
+    oaknut::Label done;
+    c.MOV(W1, static_cast<u32>(Engines::Maxwell3D::Regs::NUM_REGS));
+    c.CMP(RESULT, W1);
+    c.B(oaknut::Cond::HS, out_of_range);
+    c.LSL(X1, RESULT_64, 2);
+    c.ADD(X1, REG_ARRAY, X1);
+    c.LDR(RESULT, X1);
+    c.B(done);
+    c.l(out_of_range);
+    c.MOV(RESULT, 0);
+    c.l(done);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Send(oaknut::WReg value) {
+    c.MOV(W2, value);
+    c.MOV(W1, METHOD_ADDRESS);
+    c.MOV(X0, MAXWELL3D);
+    c.MOV(X16, Common::BitCast<u64>(&Send));
+    c.BLR(X16);
+
+    // Increment the method address by the method increment
+    c.UBFX(W0, METHOD_ADDRESS, 12, 6);
+    c.ADD(W0, METHOD_ADDRESS, W0);
+    c.BFI(METHOD_ADDRESS, W0, 0, 12);
+}
+
+void MacroJITArm64Impl::Compile_Branch(u32 index, Macro::Opcode opcode) {
+    const s32 jump_address =
+        static_cast<s32>(index) + static_cast<s32>(opcode.GetBranchTarget() / sizeof(s32));
+    const bool valid_target = jump_address >= 0 && static_cast<size_t>(jump_address) < code.size();
+    ASSERT_MSG(valid_target, "Macro branch target {} is out of bounds", jump_address);
+
+    oaknut::Label& taken{[&]() -> oaknut::Label& {
+        if (!valid_target) {
+            return end_of_code;
+        }
+        if (opcode.branch_annul) {
+            return labels[static_cast<size_t>(jump_address)];
+        }
+        // Taken branches with a delay slot execute a copy of the next instruction before jumping
+        delayed_branches.emplace_back(index, static_cast<u32>(jump_address));
+        return delay_slots[index];
+    }()};
+
+    const oaknut::WReg value{Compile_GetRegister(opcode.src_a, W0)};
+    switch (opcode.branch_condition) {
+    case Macro::BranchCondition::Zero:
+        c.CBZ(value, taken);
+        break;
+    case Macro::BranchCondition::NotZero:
+        c.CBNZ(value, taken);
+        break;
+    }
+}
+
+void MacroJITArm64Impl::Optimizer_ScanFlags() {
+    optimizer.can_skip_carry = true;
+    for (const u32 raw_op : code) {
+        Macro::Opcode op{};
+        op.raw = raw_op;
+
+        if (op.operation == Macro::Operation::ALU) {
+            // Scan for any ALU operations which actually use the carry flag, if they don't exist in
+            // our current code we can skip emitting the carry flag handling operations
+            if (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+                optimizer.can_skip_carry = false;
+            }
+        }
+    }
+}
+
+void MacroJITArm64Impl::Compile() {
+    MICROPROFILE_SCOPE(MacroJitArm64Compile);
+    code_block.unprotect();
+
+    c.STP(X29, X30, SP, PRE_INDEXED, -80);
+    c.STP(X19, X20, SP, 16);
+    c.STP(X21, X22, SP, 32);
+    c.STP(X23, X24, SP, 48);
+    c.STP(X25, X26, SP, 64);
+
+    c.MOV(REGISTERS, X0);
+    c.MOV(PARAMETERS, X1);
+    c.MOV(MAX_PARAMETER, X2);
+    c.MOV(REG_ARRAY, Common::BitCast<u64>(maxwell3d.regs.reg_array.data()));
+    c.MOV(MAXWELL3D, Common::BitCast<u64>(&maxwell3d));
+    c.MOV(RESULT, 0);
+    c.MOV(METHOD_ADDRESS, 0);
+    c.MOV(CARRY, 0);
+
+    c.STR(Compile_FetchParameter(), REGISTERS, 4);
+
+    // Track get register for zero registers and mark it as no-op
+    optimizer.zero_reg_skip = true;
+
+    // AddImmediate tends to be used as a NOP instruction, if we detect this we can
+    // completely skip the entire code path and no emit anything
+    optimizer.skip_dummy_addimmediate = true;
+
+    // Check to see if we can skip emitting certain instructions
+    Optimizer_ScanFlags();
+
+    const u32 op_count = static_cast<u32>(code.size());
+    for (u32 index = 0; index < op_count; ++index) {
+        c.l(labels[index]);
+        Compile_Instruction(index, false);
+    }
+
+    c.l(end_of_code);
+    c.LDP(X25, X26, SP, 64);
+    c.LDP(X23, X24, SP, 48);
+    c.LDP(X21, X22, SP, 32);
+    c.LDP(X19, X20, SP, 16);
+    c.LDP(X29, X30, SP, POST_INDEXED, 80);
+    c.RET();
+
+    // Out of line delay slots of taken branches, the exit flag is ignored inside a delay slot
+    for (const auto& [index, target] : delayed_branches) {
+        c.l(delay_slots[index]);
+        if (index + 1 < op_count) {
+            Compile_Instruction(index + 1, true);
+        }
+        c.B(labels[target]);
+    }
+
+    code_block.protect();
+    code_block.invalidate_all();
+    program = reinterpret_cast<ProgramType>(code_block.ptr());
+}
+
+void MacroJITArm64Impl::Compile_Instruction(u32 index, bool is_delay_slot) {
+    const Macro::Opcode opcode{code[index]};
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        if (is_delay_slot) {
+            ASSERT_MSG(false, "Executing a branch in a delay slot is not valid");
+            return;
+        }
+        Compile_Branch(index, opcode);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+    if (opcode.is_exit && !is_delay_slot) {
+        // Exit has a delay slot, execute the next instruction
+        if (index + 1 < code.size()) {
+            Compile_Instruction(index + 1, true);
+        }
+        c.B(end_of_code);
+    }
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_FetchParameter() {
+    oaknut::Label parameter_ok;
+    oaknut::Label done;
+    c.CMP(PARAMETERS, MAX_PARAMETER);
+    c.B(oaknut::Cond::LO, parameter_ok);
+    c.MOV(X0, PARAMETERS);
+    c.MOV(X1, MAX_PARAMETER);
+    c.MOV(X16, Common::BitCast<u64>(&WarnInvalidParameter));
+    c.BLR(X16);
+    c.MOV(W0, 0);
+    c.B(done);
+    c.l(parameter_ok);
+    c.LDR(W0, PARAMETERS, POST_INDEXED, 4);
+    c.l(done);
+    return W0;
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_GetRegister(u32 index, oaknut::WReg dst) {
+    if (index == 0) {
+        // Register 0 is always zero
+        c.MOV(dst, 0);
+    } else {
+        c.LDR(dst, REGISTERS, static_cast<u32>(index * sizeof(u32)));
+    }
+    return dst;
+}
+
+void MacroJITArm64Impl::Compile_AddImmediateTo(oaknut::WReg dst, u32 src_index, s32 immediate) {
+    if (optimizer.zero_reg_skip && src_index == 0) {
+        c.MOV(dst, static_cast<u32>(immediate));
+        return;
+    }
+    const oaknut::WReg src{Compile_GetRegister(src_index, dst)};
+    if (immediate >= 0 && immediate < 0x1000) {
+        c.ADD(dst, src, static_cast<u32>(immediate));
+    } else if (immediate < 0 && immediate > -0x1000) {
+        c.SUB(dst, src, static_cast<u32>(-immediate));
+    } else {
+        c.MOV(W1, static_cast<u32>(immediate));
+        c.ADD(dst, src, W1);
+    }
+}
+
+void MacroJITArm64Impl::Compile_ExtractBits(oaknut::WReg dst, oaknut::WReg src, u32 lsb,
+                                            u32 size) {
+    // Fields that go past the end of the register only have the bits within it
+    c.UBFX(dst, src, lsb, std::min(size, 32 - lsb));
+}
+
+void MacroJITArm64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    const auto SetRegister = [this](u32 reg_index, oaknut::WReg result) {
+        // Register 0 is supposed to always return 0. NOP is implemented as a store to the zero
+        // register.
+        if (reg_index == 0) {
+            return;
+        }
+        c.STR(result, REGISTERS, static_cast<u32>(reg_index * sizeof(u32)));
+    };
+    const auto SetMethodAddress = [this](oaknut::WReg reg32) { c.MOV(METHOD_ADDRESS, reg32); };
+
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        // Fetch parameter and send result.
+        SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        // Move and send result.
+        SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        // Fetch parameter and use result as Method Address.
+        SetRegister(reg, Compile_FetchParameter());
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        // Move result and use as Method Address, then fetch and send parameter.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        // Move result and use as Method Address, then send bits 12:17 of result.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        c.UBFX(RESULT, RESULT, 12, 6);
+        Compile_Send(RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+        break;
+    }
+}
+} // Anonymous namespace
+
+MacroJITArm64::MacroJITArm64(Engines::Maxwell3D& maxwell3d_)
+    : MacroEngine{maxwell3d_}, maxwell3d{maxwell3d_} {}
+
+std::unique_ptr<CachedMacro> MacroJITArm64::Compile(const std::vector<u32>& code) {
+    return std::make_unique<MacroJITArm64Impl>(maxwell3d, code);
+}
+} // namespace Tegra
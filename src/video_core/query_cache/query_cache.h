@@ -569,6 +569,12 @@ bool QueryCacheBase<Traits>::SemiFlushQueryDirty(QueryCacheBase<Traits>::QueryLo
         std::memcpy(ptr, &value_l, sizeof(value_l));
         return false;
     }
+    if (Settings::GetHotSettings().speculative_query_results &&
+        False(query_base->flags & QueryFlagBits::IsFence)) {
+        // Let the guest read the last result written to this address, the query is resolved when
+        // its fence is signaled. Fences must be waited on, the guest may spin on them.
+        return false;
+    }
     return True(query_base->flags & QueryFlagBits::IsHostManaged) &&
            False(query_base->flags & QueryFlagBits::IsGuestSynced);
 }
@@ -19,7 +19,10 @@ namespace Tegra {
 class MemoryManager;
 namespace Engines {
 class AccelerateDMAInterface;
+namespace Upload {
+struct Registers;
 }
+} // namespace Engines
 namespace Control {
 struct ChannelState;
 }
@@ -108,6 +111,13 @@ public:
     /// Notify rasterizer that any caches of the specified region are desync with guest
     virtual void OnCacheInvalidation(PAddr addr, u64 size) = 0;
 
+    /// Notify rasterizer that any caches of the specified regions are desync with guest
+    virtual void OnCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> ranges) {
+        for (const auto& [addr, size] : ranges) {
+            OnCacheInvalidation(addr, size);
+        }
+    }
+
     virtual bool OnCPUWrite(PAddr addr, u64 size) = 0;
 
     /// Sync memory between guest and host.
@@ -155,6 +165,13 @@ public:
     virtual void AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
                                           std::span<const u8> memory) = 0;
 
+    /// Attempt to swizzle an inline upload to a block linear destination without writing the
+    /// guest memory, returns false when the upload has to be swizzled on the CPU instead
+    [[nodiscard]] virtual bool AccelerateInlineToBlockLinear(
+        const Tegra::Engines::Upload::Registers& regs, std::span<const u8> memory) {
+        return false;
+    }
+
     /// Attempt to use a faster method to display the framebuffer to screen
     [[nodiscard]] virtual bool AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                  DAddr framebuffer_addr, u32 pixel_stride) {
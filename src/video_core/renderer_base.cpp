@@ -7,6 +7,7 @@
 #include "core/frontend/emu_window.h"
 #include "core/frontend/graphics_context.h"
 #include "video_core/renderer_base.h"
+#include "video_core/textures/workers.h"
 
 namespace VideoCore {
 
@@ -48,4 +49,10 @@ void RendererBase::RequestScreenshot(void* data, std::function<void(bool)> callb
     renderer_settings.screenshot_requested = true;
 }
 
+void RendererBase::SetThermalThrottling(bool throttled) {
+    // Decoding textures on a single worker spreads the same work over more time
+    auto& workers = Tegra::Texture::GetThreadWorkers();
+    workers.SetMaxActiveWorkers(throttled ? 1 : workers.NumWorkers());
+}
+
 } // namespace VideoCore
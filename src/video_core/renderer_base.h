@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 
@@ -89,6 +90,15 @@ public:
     void RequestScreenshot(void* data, std::function<void(bool)> callback,
                            const Layout::FramebufferLayout& layout);
 
+    /// Reduces the host work done for each frame while the host is thermally throttled
+    virtual void SetThermalThrottling(bool throttled);
+
+    /// Returns the GPU time of the last frame, zero when the renderer doesn't measure it.
+    /// Only valid from the thread presenting frames.
+    [[nodiscard]] virtual std::chrono::nanoseconds FrameGpuTime() const {
+        return {};
+    }
+
 protected:
     Core::Frontend::EmuWindow& render_window; ///< Reference to the render window handle.
     std::unique_ptr<Core::Frontend::GraphicsContext> context;
@@ -0,0 +1,441 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <mutex>
+
+#include "common/alignment.h"
+#include "common/microprofile.h"
+#include "common/scope_exit.h"
+#include "common/settings.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dirty_flags.h"
+#include "video_core/engines/draw_manager.h"
+#include "video_core/engines/kepler_compute.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/gpu.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/memory_manager.h"
+#include "video_core/renderer_null/null_accounting_rasterizer.h"
+
+namespace Null {
+
+MICROPROFILE_DEFINE(Null_Drawing, "Null", "Drawing", MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(Null_Compute, "Null", "Compute", MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(Null_CacheManagement, "Null", "Cache Management", MP_RGB(128, 128, 192));
+
+AccountingAccelerateDMA::AccountingAccelerateDMA(BufferCache& buffer_cache_)
+    : buffer_cache{buffer_cache_} {}
+
+bool AccountingAccelerateDMA::BufferCopy(GPUVAddr src_address, GPUVAddr dest_address,
+                                         u64 amount) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMACopy(src_address, dest_address, amount);
+}
+
+bool AccountingAccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMAClear(src_address, amount, value);
+}
+
+RasterizerAccounting::RasterizerAccounting(Tegra::GPU& gpu_,
+                                           Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : gpu{gpu_}, texture_cache(texture_cache_runtime, device_memory_),
+      buffer_cache(device_memory_, buffer_cache_runtime), shader_cache(device_memory_),
+      accelerate_dma(buffer_cache) {}
+
+RasterizerAccounting::~RasterizerAccounting() = default;
+
+void RasterizerAccounting::PrepareDraw(bool is_indexed) {
+    gpu_memory->FlushCaching();
+    if (!shader_cache.RefreshGraphicsShaders()) {
+        return;
+    }
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    texture_cache.SynchronizeGraphicsDescriptors();
+
+    const auto& regs = maxwell3d->regs;
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        // Shader stages are offset by one from programs, VertexA has no stage of its own
+        const bool is_enabled = regs.IsShaderConfigEnabled(stage + 1);
+        const auto& cbufs = maxwell3d->state.shader_stages[stage].const_buffers;
+        u32 mask = 0;
+        for (size_t index = 0; index < cbufs.size(); ++index) {
+            if (is_enabled && cbufs[index].enabled) {
+                mask |= 1U << index;
+            }
+            uniform_buffer_sizes[stage][index] = cbufs[index].size;
+        }
+        uniform_buffer_masks[stage] = mask;
+        buffer_cache.UnbindGraphicsStorageBuffers(stage);
+        buffer_cache.UnbindGraphicsTextureBuffers(stage);
+    }
+    buffer_cache.SetUniformBuffersState(uniform_buffer_masks, &uniform_buffer_sizes);
+    buffer_cache.UpdateGraphicsBuffers(is_indexed);
+    buffer_cache.BindHostGeometryBuffers(is_indexed);
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        buffer_cache.BindHostStageBuffers(stage);
+    }
+    texture_cache.UpdateRenderTargets(false);
+}
+
+void RasterizerAccounting::Draw(bool is_indexed, u32 instance_count) {
+    MICROPROFILE_SCOPE(Null_Drawing);
+    SCOPE_EXIT({ gpu.TickWork(); });
+    PrepareDraw(is_indexed);
+}
+
+void RasterizerAccounting::DrawIndirect() {
+    MICROPROFILE_SCOPE(Null_Drawing);
+    SCOPE_EXIT({ gpu.TickWork(); });
+    const auto& params = maxwell3d->draw_manager->GetIndirectParams();
+    buffer_cache.SetDrawIndirect(&params);
+    PrepareDraw(params.is_indexed);
+    buffer_cache.SetDrawIndirect(nullptr);
+}
+
+void RasterizerAccounting::DrawTexture() {
+    MICROPROFILE_SCOPE(Null_Drawing);
+    SCOPE_EXIT({ gpu.TickWork(); });
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.SynchronizeGraphicsDescriptors();
+    texture_cache.UpdateRenderTargets(false);
+
+    const auto& draw_texture_state = maxwell3d->draw_manager->GetDrawTextureState();
+    void(texture_cache.GetGraphicsSampler(draw_texture_state.src_sampler));
+    void(texture_cache.GetImageView(draw_texture_state.src_texture));
+}
+
+void RasterizerAccounting::Clear(u32 layer_count) {
+    MICROPROFILE_SCOPE(Null_Drawing);
+    gpu_memory->FlushCaching();
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.UpdateRenderTargets(true);
+}
+
+void RasterizerAccounting::DispatchCompute() {
+    MICROPROFILE_SCOPE(Null_Compute);
+    gpu_memory->FlushCaching();
+    if (!shader_cache.RefreshComputeShader()) {
+        return;
+    }
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    const auto& qmd = kepler_compute->launch_description;
+    for (size_t index = 0; index < qmd.const_buffer_config.size(); ++index) {
+        compute_uniform_buffer_sizes[index] = qmd.const_buffer_config[index].size;
+    }
+    buffer_cache.SetComputeUniformBufferState(qmd.const_buffer_enable_mask,
+                                              &compute_uniform_buffer_sizes);
+    buffer_cache.UnbindComputeStorageBuffers();
+    buffer_cache.UnbindComputeTextureBuffers();
+    texture_cache.SynchronizeComputeDescriptors();
+    buffer_cache.UpdateComputeBuffers();
+    buffer_cache.BindHostComputeBuffers();
+
+    if (const auto indirect_address = kepler_compute->GetIndirectComputeAddress()) {
+        static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::FullSynchronize;
+        const auto post_op = VideoCommon::ObtainBufferOperation::DiscardWrite;
+        void(buffer_cache.ObtainBuffer(*indirect_address, 12, sync_info, post_op));
+    }
+}
+
+void RasterizerAccounting::ResetCounter(VideoCommon::QueryType type) {}
+
+void RasterizerAccounting::Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
+                                 VideoCommon::QueryPropertiesFlags flags, u32 payload,
+                                 u32 subreport) {
+    if (!gpu_memory) {
+        return;
+    }
+    if (True(flags & VideoCommon::QueryPropertiesFlags::HasTimeout)) {
+        u64 ticks = gpu.GetTicks();
+        gpu_memory->Write<u64>(gpu_addr + 8, ticks);
+        gpu_memory->Write<u64>(gpu_addr, static_cast<u64>(payload));
+    } else {
+        gpu_memory->Write<u32>(gpu_addr, payload);
+    }
+}
+
+void RasterizerAccounting::BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr,
+                                                     u32 size) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    buffer_cache.BindGraphicsUniformBuffer(stage, index, gpu_addr, size);
+}
+
+void RasterizerAccounting::DisableGraphicsUniformBuffer(size_t stage, u32 index) {
+    buffer_cache.DisableGraphicsUniformBuffer(stage, index);
+}
+
+void RasterizerAccounting::FlushAll() {}
+
+void RasterizerAccounting::FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    MICROPROFILE_SCOPE(Null_CacheManagement);
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.DownloadMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.DownloadMemory(addr, size);
+    }
+}
+
+bool RasterizerAccounting::MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        if (buffer_cache.IsRegionGpuModified(addr, size)) {
+            return true;
+        }
+    }
+    if (!Settings::IsGPULevelHigh()) {
+        return false;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        return texture_cache.IsRegionGpuModified(addr, size);
+    }
+    return false;
+}
+
+VideoCore::RasterizerDownloadArea RasterizerAccounting::GetFlushArea(DAddr addr, u64 size) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        if (const auto area = texture_cache.GetFlushArea(addr, size)) {
+            return *area;
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        if (const auto area = buffer_cache.GetFlushArea(addr, size)) {
+            return *area;
+        }
+    }
+    return VideoCore::RasterizerDownloadArea{
+        .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
+        .end_address = Common::AlignUp(addr + size, Core::DEVICE_PAGESIZE),
+        .preemtive = true,
+    };
+}
+
+void RasterizerAccounting::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    MICROPROFILE_SCOPE(Null_CacheManagement);
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.WriteMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::ShaderCache)) {
+        shader_cache.InvalidateRegion(addr, size);
+    }
+}
+
+bool RasterizerAccounting::OnCPUWrite(DAddr addr, u64 size) {
+    MICROPROFILE_SCOPE(Null_CacheManagement);
+    if (addr == 0 || size == 0) {
+        return false;
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        if (buffer_cache.OnCPUWrite(addr, size)) {
+            return true;
+        }
+    }
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.WriteMemory(addr, size);
+    }
+    shader_cache.InvalidateRegion(addr, size);
+    return false;
+}
+
+void RasterizerAccounting::OnCacheInvalidation(DAddr addr, u64 size) {
+    MICROPROFILE_SCOPE(Null_CacheManagement);
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.WriteMemory(addr, size);
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    shader_cache.InvalidateRegion(addr, size);
+}
+
+void RasterizerAccounting::OnCacheInvalidation(
+    std::span<const std::pair<DAddr, std::size_t>> ranges) {
+    MICROPROFILE_SCOPE(Null_CacheManagement);
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : ranges) {
+            texture_cache.WriteMemory(addr, size);
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : ranges) {
+            buffer_cache.WriteMemory(addr, size);
+        }
+    }
+    for (const auto& [addr, size] : ranges) {
+        shader_cache.InvalidateRegion(addr, size);
+    }
+}
+
+void RasterizerAccounting::InvalidateGPUCache() {
+    gpu.InvalidateGPUCache();
+}
+
+void RasterizerAccounting::UnmapMemory(DAddr addr, u64 size) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.UnmapMemory(addr, size);
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    shader_cache.OnCacheInvalidation(addr, size);
+}
+
+void RasterizerAccounting::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.UnmapGPUMemory(as_id, addr, size);
+}
+
+void RasterizerAccounting::SignalFence(std::function<void()>&& func) {
+    func();
+}
+
+void RasterizerAccounting::SyncOperation(std::function<void()>&& func) {
+    func();
+}
+
+void RasterizerAccounting::SignalSyncPoint(u32 value) {
+    auto& syncpoint_manager = gpu.Host1x().GetSyncpointManager();
+    syncpoint_manager.IncrementGuest(value);
+    syncpoint_manager.IncrementHost(value);
+}
+
+void RasterizerAccounting::SignalReference() {}
+
+void RasterizerAccounting::ReleaseFences(bool) {}
+
+void RasterizerAccounting::FlushAndInvalidateRegion(DAddr addr, u64 size,
+                                                    VideoCommon::CacheType which) {
+    if (Settings::IsGPULevelExtreme()) {
+        FlushRegion(addr, size, which);
+    }
+    InvalidateRegion(addr, size, which);
+}
+
+void RasterizerAccounting::WaitForIdle() {}
+
+void RasterizerAccounting::FragmentBarrier() {}
+
+void RasterizerAccounting::TiledCacheBarrier() {}
+
+void RasterizerAccounting::FlushCommands() {}
+
+void RasterizerAccounting::TickFrame() {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.TickFrame();
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.TickFrame();
+    }
+}
+
+bool RasterizerAccounting::AccelerateSurfaceCopy(
+    const Tegra::Engines::Fermi2D::Surface& src, const Tegra::Engines::Fermi2D::Surface& dst,
+    const Tegra::Engines::Fermi2D::Config& copy_config) {
+    std::scoped_lock lock{texture_cache.mutex};
+    return texture_cache.BlitImage(dst, src, copy_config);
+}
+
+Tegra::Engines::AccelerateDMAInterface& RasterizerAccounting::AccessAccelerateDMA() {
+    return accelerate_dma;
+}
+
+void RasterizerAccounting::AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
+                                                    std::span<const u8> memory) {
+    const auto cpu_addr = gpu_memory->GpuToCpuAddress(address);
+    if (!cpu_addr) [[unlikely]] {
+        gpu_memory->WriteBlock(address, memory.data(), copy_size);
+        return;
+    }
+    gpu_memory->WriteBlockUnsafe(address, memory.data(), copy_size);
+    {
+        std::unique_lock<std::recursive_mutex> lock{buffer_cache.mutex};
+        if (!buffer_cache.InlineMemory(*cpu_addr, copy_size, memory)) {
+            buffer_cache.WriteMemory(*cpu_addr, copy_size);
+        }
+    }
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.WriteMemory(*cpu_addr, copy_size);
+    }
+    shader_cache.InvalidateRegion(*cpu_addr, copy_size);
+}
+
+bool RasterizerAccounting::AccelerateDisplay(const Tegra::FramebufferConfig& config,
+                                             DAddr framebuffer_addr, u32 pixel_stride) {
+    if (framebuffer_addr == 0) {
+        return false;
+    }
+    std::scoped_lock lock{texture_cache.mutex};
+    return texture_cache.TryFindFramebufferImageView(config, framebuffer_addr) != nullptr;
+}
+
+void RasterizerAccounting::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
+                                             const VideoCore::DiskResourceLoadCallback& callback) {
+}
+
+void RasterizerAccounting::InitializeChannel(Tegra::Control::ChannelState& channel) {
+    CreateChannel(channel);
+    // Only the flags of the caches are tracked, there is no host state to keep in sync
+    VideoCommon::Dirty::SetupDirtyFlags(channel.maxwell_3d->dirty.tables);
+    channel.maxwell_3d->dirty.BuildMasks();
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.CreateChannel(channel);
+        buffer_cache.CreateChannel(channel);
+    }
+    shader_cache.CreateChannel(channel);
+}
+
+void RasterizerAccounting::BindChannel(Tegra::Control::ChannelState& channel) {
+    const s32 channel_id = channel.bind_id;
+    BindToChannel(channel_id);
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.BindToChannel(channel_id);
+        buffer_cache.BindToChannel(channel_id);
+    }
+    shader_cache.BindToChannel(channel_id);
+    maxwell3d->dirty.flags.set();
+}
+
+void RasterizerAccounting::ReleaseChannel(s32 channel_id) {
+    EraseChannel(channel_id);
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.EraseChannel(channel_id);
+        buffer_cache.EraseChannel(channel_id);
+    }
+    shader_cache.EraseChannel(channel_id);
+}
+
+} // namespace Null
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "video_core/renderer_null/null_buffer_cache.h"
+
+namespace Null {
+
+Buffer::Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params)
+    : VideoCommon::BufferBase(null_params) {}
+
+Buffer::Buffer(BufferCacheRuntime&, DAddr cpu_addr_, u64 size_bytes_)
+    : VideoCommon::BufferBase(cpu_addr_, size_bytes_), storage(size_bytes_) {}
+
+void Buffer::ImmediateUpload(size_t offset, std::span<const u8> data) noexcept {
+    std::memcpy(storage.data() + offset, data.data(), data.size_bytes());
+}
+
+void Buffer::ImmediateDownload(size_t offset, std::span<u8> data) noexcept {
+    std::memcpy(data.data(), storage.data() + offset, data.size_bytes());
+}
+
+BufferCacheRuntime::BufferCacheRuntime() = default;
+
+StagingBufferMap BufferCacheRuntime::UploadStagingBuffer(size_t size) {
+    return upload_pool.Request(size);
+}
+
+StagingBufferMap BufferCacheRuntime::DownloadStagingBuffer(size_t size, bool) {
+    return download_pool.Request(size);
+}
+
+void BufferCacheRuntime::CopyBuffer(Buffer& dst_buffer, Buffer& src_buffer,
+                                    std::span<const VideoCommon::BufferCopy> copies, bool, bool) {
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        // Copies between overlapping ranges of the same buffer are allowed
+        std::memmove(dst_buffer.Data() + copy.dst_offset, src_buffer.Data() + copy.src_offset,
+                     copy.size);
+    }
+}
+
+void BufferCacheRuntime::ClearBuffer(Buffer& dest_buffer, u32 offset, size_t size, u32 value) {
+    u8* const data = dest_buffer.Data() + offset;
+    for (size_t index = 0; index + sizeof(u32) <= size; index += sizeof(u32)) {
+        std::memcpy(data + index, &value, sizeof(u32));
+    }
+}
+
+} // namespace Null
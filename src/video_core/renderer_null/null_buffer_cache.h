@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/buffer_cache/buffer_cache_base.h"
+#include "video_core/buffer_cache/memory_tracker_base.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/renderer_null/null_staging_buffer.h"
+#include "video_core/surface.h"
+
+namespace Null {
+
+class BufferCacheRuntime;
+
+/// Buffer backed by host memory, it keeps the data the guest uploaded so downloads stay coherent
+class Buffer : public VideoCommon::BufferBase {
+public:
+    explicit Buffer(BufferCacheRuntime&, DAddr cpu_addr, u64 size_bytes);
+    explicit Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams);
+
+    void ImmediateUpload(size_t offset, std::span<const u8> data) noexcept;
+
+    void ImmediateDownload(size_t offset, std::span<u8> data) noexcept;
+
+    void MarkUsage(u64 offset, u64 size) {}
+
+    [[nodiscard]] u8* Data() noexcept {
+        return storage.data();
+    }
+
+private:
+    std::vector<u8> storage;
+};
+
+class BufferCacheRuntime {
+    friend Buffer;
+
+    using PrimitiveTopology = Tegra::Engines::Maxwell3D::Regs::PrimitiveTopology;
+    using IndexFormat = Tegra::Engines::Maxwell3D::Regs::IndexFormat;
+
+public:
+    explicit BufferCacheRuntime();
+
+    void TickFrame(VideoCommon::SlotVector<Buffer>&) noexcept {}
+
+    void Finish() {}
+
+    u64 GetDeviceLocalMemory() const {
+        return 0;
+    }
+
+    u64 GetDeviceMemoryUsage() const {
+        return 0;
+    }
+
+    bool CanReportMemoryUsage() const {
+        return false;
+    }
+
+    u32 GetStorageBufferAlignment() const {
+        return 16;
+    }
+
+    u32 GetUniformBufferSkipCacheSize() const {
+        return VideoCommon::DEFAULT_SKIP_CACHE_SIZE;
+    }
+
+    [[nodiscard]] StagingBufferMap UploadStagingBuffer(size_t size);
+
+    [[nodiscard]] StagingBufferMap DownloadStagingBuffer(size_t size, bool deferred = false);
+
+    bool CanReorderUpload(const Buffer&, std::span<const VideoCommon::BufferCopy>) {
+        return false;
+    }
+
+    void FreeDeferredStagingBuffer(StagingBufferMap&) {}
+
+    void PreCopyBarrier() {}
+
+    void CopyBuffer(Buffer& dst_buffer, Buffer& src_buffer,
+                    std::span<const VideoCommon::BufferCopy> copies, bool barrier,
+                    bool can_reorder_upload = false);
+
+    void PostCopyBarrier() {}
+
+    void ClearBuffer(Buffer& dest_buffer, u32 offset, size_t size, u32 value);
+
+    void BindIndexBuffer(Buffer&, u32 offset, u32 size) {}
+
+    void BindQuadIndexBuffer(PrimitiveTopology, u32 first, u32 count) {}
+
+    void BindVertexBuffers(VideoCommon::HostBindings<Buffer>&) {}
+
+    void BindTransformFeedbackBuffers(VideoCommon::HostBindings<Buffer>&) {}
+
+    std::span<u8> BindMappedUniformBuffer([[maybe_unused]] size_t stage,
+                                          [[maybe_unused]] u32 binding_index, u32 size) {
+        return uniform_pool.Request(size).mapped_span;
+    }
+
+    void BindUniformBuffer(Buffer&, u32 offset, u32 size) {}
+
+    void BindStorageBuffer(Buffer&, u32 offset, u32 size, [[maybe_unused]] bool is_written) {}
+
+    void BindTextureBuffer(Buffer&, u32 offset, u32 size, VideoCore::Surface::PixelFormat) {}
+
+private:
+    StagingBufferPool upload_pool;
+    StagingBufferPool download_pool;
+    StagingBufferPool uniform_pool;
+};
+
+struct BufferCacheParams {
+    using Runtime = Null::BufferCacheRuntime;
+    using Buffer = Null::Buffer;
+    using Async_Buffer = Null::StagingBufferMap;
+    using MemoryTracker = VideoCommon::MemoryTrackerBase<Tegra::MaxwellDeviceMemoryManager>;
+
+    static constexpr bool IS_OPENGL = false;
+    static constexpr bool HAS_PERSISTENT_UNIFORM_BUFFER_BINDINGS = false;
+    static constexpr bool HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT = true;
+    static constexpr bool NEEDS_BIND_UNIFORM_INDEX = false;
+    static constexpr bool NEEDS_BIND_STORAGE_INDEX = false;
+    static constexpr bool USE_MEMORY_MAPS = false;
+    static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
+    static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = false;
+    static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = false;
+};
+
+using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
+
+} // namespace Null
@@ -52,6 +52,8 @@ bool RasterizerNull::OnCPUWrite(PAddr addr, u64 size) {
     return false;
 }
 void RasterizerNull::OnCacheInvalidation(PAddr addr, u64 size) {}
+void RasterizerNull::OnCacheInvalidation(
+    std::span<const std::pair<DAddr, std::size_t>> ranges) {}
 VideoCore::RasterizerDownloadArea RasterizerNull::GetFlushArea(PAddr addr, u64 size) {
     VideoCore::RasterizerDownloadArea new_area{
         .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
@@ -54,6 +54,7 @@ public:
     void InvalidateRegion(DAddr addr, u64 size,
                           VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
     void OnCacheInvalidation(DAddr addr, u64 size) override;
+    void OnCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> ranges) override;
     bool OnCPUWrite(DAddr addr, u64 size) override;
     VideoCore::RasterizerDownloadArea GetFlushArea(DAddr addr, u64 size) override;
     void InvalidateGPUCache() override;
@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "video_core/renderer_null/null_shader_cache.h"
+
+namespace Null {
+
+ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : VideoCommon::ShaderCache{device_memory_} {}
+
+ShaderCache::~ShaderCache() = default;
+
+bool ShaderCache::RefreshGraphicsShaders() {
+    return RefreshStages(unique_hashes);
+}
+
+bool ShaderCache::RefreshComputeShader() {
+    return ComputeShader() != nullptr;
+}
+
+} // namespace Null
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+#include "video_core/shader_cache.h"
+
+namespace Null {
+
+/// Tracks the guest shaders in use without translating them, there is no host pipeline to build
+class ShaderCache : public VideoCommon::ShaderCache {
+public:
+    explicit ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory);
+    ~ShaderCache();
+
+    /// Looks up the bound graphics shaders, returns false when they can't be read
+    [[nodiscard]] bool RefreshGraphicsShaders();
+
+    /// Looks up the bound compute shader, returns false when it can't be read
+    [[nodiscard]] bool RefreshComputeShader();
+
+private:
+    std::array<u64, 6> unique_hashes{};
+};
+
+} // namespace Null
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+#include "common/scratch_buffer.h"
+
+namespace Null {
+
+struct StagingBufferMap {
+    std::span<u8> mapped_span;
+    size_t offset = 0;
+    u32 buffer = 0;
+};
+
+/// Host memory handed out as staging buffers. The null backend consumes every staging buffer
+/// before it requests the next one from the same pool, so a single allocation is recycled.
+class StagingBufferPool {
+public:
+    [[nodiscard]] StagingBufferMap Request(size_t size) {
+        memory.resize_destructive(size);
+        return StagingBufferMap{
+            .mapped_span = std::span(memory.data(), size),
+        };
+    }
+
+private:
+    Common::ScratchBuffer<u8> memory;
+};
+
+} // namespace Null
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "common/settings.h"
+#include "video_core/renderer_null/null_texture_cache.h"
+#include "video_core/texture_cache/util.h"
+
+namespace Null {
+
+using VideoCommon::ImageFlagBits;
+
+TextureCacheRuntime::TextureCacheRuntime() : resolution{Settings::values.resolution_info} {}
+
+StagingBufferMap TextureCacheRuntime::UploadStagingBuffer(size_t size) {
+    return upload_pool.Request(size);
+}
+
+StagingBufferMap TextureCacheRuntime::DownloadStagingBuffer(size_t size, bool) {
+    return download_pool.Request(size);
+}
+
+Image::Image(TextureCacheRuntime& runtime_, const VideoCommon::ImageInfo& info_,
+             GPUVAddr gpu_addr_, VAddr cpu_addr_)
+    : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), runtime{&runtime_} {}
+
+Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBase{params} {}
+
+Image::~Image() = default;
+
+void Image::DownloadMemory(StagingBufferMap& map,
+                           std::span<const VideoCommon::BufferImageCopy> copies) {
+    for (const VideoCommon::BufferImageCopy& copy : copies) {
+        std::memset(map.mapped_span.data() + map.offset + copy.buffer_offset, 0,
+                    copy.buffer_size);
+    }
+}
+
+bool Image::IsRescaled() const noexcept {
+    return True(flags & ImageFlagBits::Rescaled);
+}
+
+bool Image::ScaleUp(bool) {
+    if (!runtime->resolution.active || True(flags & ImageFlagBits::Rescaled)) {
+        return false;
+    }
+    flags |= ImageFlagBits::Rescaled;
+    has_scaled = true;
+    return true;
+}
+
+bool Image::ScaleDown(bool) {
+    if (!runtime->resolution.active || False(flags & ImageFlagBits::Rescaled)) {
+        return false;
+    }
+    flags &= ~ImageFlagBits::Rescaled;
+    return true;
+}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageViewInfo& info,
+                     ImageId image_id_, Image& image, const SlotVector<Image>&)
+    : VideoCommon::ImageViewBase{info, image.info, image_id_, image.gpu_addr} {}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
+                     const VideoCommon::ImageViewInfo& view_info, GPUVAddr gpu_addr_)
+    : VideoCommon::ImageViewBase{info, view_info, gpu_addr_},
+      buffer_size{VideoCommon::CalculateGuestSizeInBytes(info)} {}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::NullImageViewParams& params)
+    : VideoCommon::ImageViewBase{params} {}
+
+} // namespace Null
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+#include "video_core/renderer_null/null_staging_buffer.h"
+#include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/texture_cache_base.h"
+
+namespace Settings {
+struct ResolutionScalingInfo;
+}
+
+namespace Null {
+
+class Framebuffer;
+class Image;
+class ImageView;
+
+using VideoCommon::ImageId;
+using VideoCommon::NUM_RT;
+using VideoCommon::Region2D;
+using VideoCommon::SlotVector;
+
+/// Texture cache runtime without host images, copies and blits between images are dropped
+class TextureCacheRuntime {
+public:
+    explicit TextureCacheRuntime();
+
+    void Finish() {}
+
+    StagingBufferMap UploadStagingBuffer(size_t size);
+
+    StagingBufferMap DownloadStagingBuffer(size_t size, bool deferred = false);
+
+    void FreeDeferredStagingBuffer(StagingBufferMap&) {}
+
+    void TickFrame() {}
+
+    u64 GetDeviceLocalMemory() const {
+        return 0;
+    }
+
+    u64 GetDeviceMemoryUsage() const {
+        return 0;
+    }
+
+    bool CanReportMemoryUsage() const {
+        return false;
+    }
+
+    void BlitImage(Framebuffer*, ImageView&, ImageView&, const Region2D&, const Region2D&,
+                   Tegra::Engines::Fermi2D::Filter, Tegra::Engines::Fermi2D::Operation) {}
+
+    void CopyImage(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void CopyImageMSAA(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    bool ShouldReinterpret(Image&, Image&) const noexcept {
+        return true;
+    }
+
+    void ReinterpretImage(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void ConvertImage(Framebuffer*, ImageView&, ImageView&) {}
+
+    bool CanUploadMSAA() const noexcept {
+        return true;
+    }
+
+    void AccelerateImageUpload(Image&, const StagingBufferMap&,
+                               std::span<const VideoCommon::SwizzleParameters>) {}
+
+    void InsertUploadMemoryBarrier() {}
+
+    void TransitionImageLayout(Image&) {}
+
+    bool HasBrokenTextureViewFormats() const noexcept {
+        return false;
+    }
+
+    bool HasNativeBgr() const noexcept {
+        return true;
+    }
+
+    void BarrierFeedbackLoop() const noexcept {}
+
+    const Settings::ResolutionScalingInfo& resolution;
+
+private:
+    StagingBufferPool upload_pool;
+    StagingBufferPool download_pool;
+};
+
+class Image : public VideoCommon::ImageBase {
+public:
+    explicit Image(TextureCacheRuntime&, const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                   VAddr cpu_addr);
+    explicit Image(const VideoCommon::NullImageParams&);
+
+    ~Image();
+
+    Image(const Image&) = delete;
+    Image& operator=(const Image&) = delete;
+
+    Image(Image&&) = default;
+    Image& operator=(Image&&) = default;
+
+    void UploadMemory(u32 buffer, size_t offset,
+                      std::span<const VideoCommon::BufferImageCopy> copies) {}
+
+    void UploadMemory(const StagingBufferMap& map,
+                      std::span<const VideoCommon::BufferImageCopy> copies) {}
+
+    void DownloadMemory(u32 buffer, size_t offset,
+                        std::span<const VideoCommon::BufferImageCopy> copies) {}
+
+    /// Images have no contents, downloads read back zeros
+    void DownloadMemory(StagingBufferMap& map,
+                        std::span<const VideoCommon::BufferImageCopy> copies);
+
+    bool IsRescaled() const noexcept;
+
+    bool ScaleUp(bool ignore = false);
+
+    bool ScaleDown(bool ignore = false);
+
+private:
+    TextureCacheRuntime* runtime{};
+};
+
+class ImageView : public VideoCommon::ImageViewBase {
+public:
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::ImageViewInfo&, ImageId, Image&,
+                       const SlotVector<Image>&);
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo&,
+                       const VideoCommon::ImageViewInfo&, GPUVAddr);
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::NullImageViewParams&);
+
+    [[nodiscard]] GPUVAddr GpuAddr() const noexcept {
+        return gpu_addr;
+    }
+
+    [[nodiscard]] u32 BufferSize() const noexcept {
+        return buffer_size;
+    }
+
+private:
+    u32 buffer_size = 0;
+};
+
+class ImageAlloc : public VideoCommon::ImageAllocBase {};
+
+class Sampler {
+public:
+    explicit Sampler(TextureCacheRuntime&, const Tegra::Texture::TSCEntry&) {}
+
+    [[nodiscard]] bool HasAddedAnisotropy() const noexcept {
+        return false;
+    }
+};
+
+class Framebuffer {
+public:
+    explicit Framebuffer(TextureCacheRuntime&, std::span<ImageView*, NUM_RT>, ImageView*,
+                         const VideoCommon::RenderTargets&) {}
+};
+
+struct TextureCacheParams {
+    static constexpr bool ENABLE_VALIDATION = true;
+    static constexpr bool FRAMEBUFFER_BLITS = false;
+    static constexpr bool HAS_EMULATED_COPIES = false;
+    static constexpr bool HAS_DEVICE_MEMORY_INFO = false;
+    static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = false;
+
+    using Runtime = Null::TextureCacheRuntime;
+    using Image = Null::Image;
+    using ImageAlloc = Null::ImageAlloc;
+    using ImageView = Null::ImageView;
+    using Sampler = Null::Sampler;
+    using Framebuffer = Null::Framebuffer;
+    using AsyncBuffer = Null::StagingBufferMap;
+    using BufferType = u32;
+};
+
+using TextureCache = VideoCommon::TextureCache<TextureCacheParams>;
+
+} // namespace Null
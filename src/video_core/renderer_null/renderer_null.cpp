@@ -1,15 +1,27 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/frontend/emu_window.h"
 #include "core/frontend/graphics_context.h"
+#include "video_core/renderer_null/null_accounting_rasterizer.h"
+#include "video_core/renderer_null/null_rasterizer.h"
 #include "video_core/renderer_null/renderer_null.h"
 
 namespace Null {
 
-RendererNull::RendererNull(Core::Frontend::EmuWindow& emu_window, Tegra::GPU& gpu,
+RendererNull::RendererNull(Core::Frontend::EmuWindow& emu_window,
+                           Tegra::MaxwellDeviceMemoryManager& device_memory, Tegra::GPU& gpu,
                            std::unique_ptr<Core::Frontend::GraphicsContext> context_)
-    : RendererBase(emu_window, std::move(context_)), m_gpu(gpu), m_rasterizer(gpu) {}
+    : RendererBase(emu_window, std::move(context_)), m_gpu(gpu) {
+    if (Settings::values.null_renderer_caches.GetValue()) {
+        LOG_INFO(Render, "Running the GPU caches without a host backend");
+        m_rasterizer = std::make_unique<RasterizerAccounting>(gpu, device_memory);
+    } else {
+        m_rasterizer = std::make_unique<RasterizerNull>(gpu);
+    }
+}
 
 RendererNull::~RendererNull() = default;
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <span>
 
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
@@ -21,6 +22,9 @@ struct BindlessSSBO {
 };
 static_assert(sizeof(BindlessSSBO) == sizeof(GLuint) * 4);
 
+// Largest upload written through the stream buffer, bigger ones are rare and use glBufferSubData
+constexpr size_t MAX_STREAM_UPLOAD_SIZE = 1_MiB;
+
 constexpr std::array PROGRAM_LUT{
     GL_VERTEX_PROGRAM_NV,   GL_TESS_CONTROL_PROGRAM_NV, GL_TESS_EVALUATION_PROGRAM_NV,
     GL_GEOMETRY_PROGRAM_NV, GL_FRAGMENT_PROGRAM_NV,
@@ -46,25 +50,37 @@ constexpr std::array PROGRAM_LUT{
 }
 } // Anonymous namespace
 
-Buffer::Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params)
-    : VideoCommon::BufferBase(null_params) {}
+Buffer::Buffer(BufferCacheRuntime& runtime_, VideoCommon::NullBufferParams null_params)
+    : VideoCommon::BufferBase(null_params), runtime{&runtime_} {}
 
-Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
-    : VideoCommon::BufferBase(cpu_addr_, size_bytes_) {
+Buffer::Buffer(BufferCacheRuntime& runtime_, DAddr cpu_addr_, u64 size_bytes_)
+    : VideoCommon::BufferBase(cpu_addr_, size_bytes_), runtime{&runtime_} {
     buffer.Create();
-    if (runtime.device.HasDebuggingToolAttached()) {
+    if (runtime->device.HasDebuggingToolAttached()) {
         const std::string name = fmt::format("Buffer 0x{:x}", CpuAddr());
         glObjectLabel(GL_BUFFER, buffer.handle, static_cast<GLsizei>(name.size()), name.data());
     }
     glNamedBufferData(buffer.handle, SizeBytes(), nullptr, GL_DYNAMIC_DRAW);
-    if (runtime.has_unified_vertex_buffers) {
+    if (runtime->has_unified_vertex_buffers) {
         glGetNamedBufferParameterui64vNV(buffer.handle, GL_BUFFER_GPU_ADDRESS_NV, &address);
     }
 }
 
 void Buffer::ImmediateUpload(size_t offset, std::span<const u8> data) noexcept {
+    const size_t size = data.size_bytes();
+    if (runtime->stream_buffer && size <= MAX_STREAM_UPLOAD_SIZE) {
+        // glBufferSubData stalls or copies on drivers without a fast path for it, write to the
+        // persistently mapped stream buffer and copy on the GPU instead
+        StreamBuffer& stream_buffer = *runtime->stream_buffer;
+        const auto [mapped_span, stream_offset] = stream_buffer.Request(size);
+        std::memcpy(mapped_span.data(), data.data(), size);
+        glCopyNamedBufferSubData(stream_buffer.Handle(), buffer.handle,
+                                 static_cast<GLintptr>(stream_offset),
+                                 static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        return;
+    }
     glNamedBufferSubData(buffer.handle, static_cast<GLintptr>(offset),
-                         static_cast<GLsizeiptr>(data.size_bytes()), data.data());
+                         static_cast<GLsizeiptr>(size), data.data());
 }
 
 void Buffer::ImmediateDownload(size_t offset, std::span<u8> data) noexcept {
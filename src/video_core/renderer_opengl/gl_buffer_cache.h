@@ -49,6 +49,7 @@ private:
         OGLTexture texture;
     };
 
+    BufferCacheRuntime* runtime = nullptr;
     GLuint64EXT address = 0;
     OGLBuffer buffer;
     GLenum current_residency_access = GL_NONE;
@@ -86,6 +87,11 @@ public:
     void CopyBuffer(Buffer& dst_buffer, Buffer& src_buffer,
                     std::span<const VideoCommon::BufferCopy> copies, bool);
 
+    void UploadBuffer(Buffer& buffer, const StagingBufferMap& staging,
+                      std::span<const VideoCommon::BufferCopy> copies, bool can_reorder_upload) {
+        CopyBuffer(buffer, staging.buffer, copies, true, can_reorder_upload);
+    }
+
     void PreCopyBarrier();
     void PostCopyBarrier();
     void Finish();
@@ -199,6 +205,11 @@ public:
         return static_cast<u32>(device.GetShaderStorageBufferAlignment());
     }
 
+    u32 GetUniformBufferSkipCacheSize() const {
+        // Fast uniform buffers are allocated with the default size
+        return VideoCommon::DEFAULT_SKIP_CACHE_SIZE;
+    }
+
 private:
     static constexpr std::array PABO_LUT{
         GL_VERTEX_PROGRAM_PARAMETER_BUFFER_NV,          GL_TESS_CONTROL_PROGRAM_PARAMETER_BUFFER_NV,
@@ -27,6 +27,7 @@ struct Info;
 namespace OpenGL {
 
 class Device;
+class ProgramBinaryCache;
 class ProgramManager;
 
 struct ComputePipelineKey {
@@ -50,6 +51,7 @@ class ComputePipeline {
 public:
     explicit ComputePipeline(const Device& device, TextureCache& texture_cache_,
                              BufferCache& buffer_cache_, ProgramManager& program_manager_,
+                             ProgramBinaryCache& program_binary_cache,
                              const Shader::Info& info_, std::string code, std::vector<u32> code_v,
                              bool force_context_flush = false);
 
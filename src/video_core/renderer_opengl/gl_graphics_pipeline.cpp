@@ -10,6 +10,7 @@
 #include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_opengl/gl_graphics_pipeline.h"
+#include "video_core/renderer_opengl/gl_program_binary_cache.h"
 #include "video_core/renderer_opengl/gl_shader_manager.h"
 #include "video_core/renderer_opengl/gl_shader_util.h"
 #include "video_core/renderer_opengl/gl_state_tracker.h"
@@ -171,6 +172,7 @@ ConfigureFuncPtr ConfigureFunc(const std::array<Shader::Info, 5>& infos, u32 ena
 
 GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_cache_,
                                    BufferCache& buffer_cache_, ProgramManager& program_manager_,
+                                   ProgramBinaryCache& program_binary_cache,
                                    StateTracker& state_tracker_, ShaderWorker* thread_worker,
                                    VideoCore::ShaderNotify* shader_notify,
                                    std::array<std::string, 5> sources,
@@ -232,13 +234,14 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
     }
     const bool in_parallel = thread_worker != nullptr;
     auto func{[this, sources_ = std::move(sources), sources_spirv_ = std::move(sources_spirv),
-               shader_notify, backend, in_parallel,
+               &program_binary_cache, shader_notify, backend, in_parallel,
                force_context_flush](ShaderContext::Context*) mutable {
         for (size_t stage = 0; stage < 5; ++stage) {
             switch (backend) {
             case Settings::ShaderBackend::Glsl:
                 if (!sources_[stage].empty()) {
-                    source_programs[stage] = CreateProgram(sources_[stage], Stage(stage));
+                    source_programs[stage] =
+                        program_binary_cache.CreateProgram(sources_[stage], Stage(stage));
                 }
                 break;
             case Settings::ShaderBackend::Glasm:
@@ -249,7 +252,8 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
                 break;
             case Settings::ShaderBackend::SpirV:
                 if (!sources_spirv_[stage].empty()) {
-                    source_programs[stage] = CreateProgram(sources_spirv_[stage], Stage(stage));
+                    source_programs[stage] =
+                        program_binary_cache.CreateProgram(sources_spirv_[stage], Stage(stage));
                 }
                 break;
             }
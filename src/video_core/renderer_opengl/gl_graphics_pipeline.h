@@ -9,8 +9,8 @@
 #include <utility>
 
 #include "common/bit_field.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -25,6 +25,7 @@ struct Context;
 }
 
 class Device;
+class ProgramBinaryCache;
 class ProgramManager;
 
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
@@ -46,7 +47,7 @@ struct GraphicsPipelineKey {
     VideoCommon::TransformFeedbackState xfb_state;
 
     size_t Hash() const noexcept {
-        return static_cast<size_t>(Common::CityHash64(reinterpret_cast<const char*>(this), Size()));
+        return static_cast<size_t>(Common::FastHash64(this, Size()));
     }
 
     bool operator==(const GraphicsPipelineKey& rhs) const noexcept {
@@ -73,6 +74,7 @@ class GraphicsPipeline {
 public:
     explicit GraphicsPipeline(const Device& device, TextureCache& texture_cache_,
                               BufferCache& buffer_cache_, ProgramManager& program_manager_,
+                              ProgramBinaryCache& program_binary_cache,
                               StateTracker& state_tracker_, ShaderWorker* thread_worker,
                               VideoCore::ShaderNotify* shader_notify,
                               std::array<std::string, 5> sources,
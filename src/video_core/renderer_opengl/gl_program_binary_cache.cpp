@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "common/cityhash.h"
+#include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_opengl/gl_program_binary_cache.h"
+#include "video_core/renderer_opengl/gl_shader_util.h"
+
+namespace OpenGL {
+namespace {
+constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'g', 'l', 'p', 'b'};
+constexpr u32 BINARY_CACHE_VERSION = 1;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 padding;
+    u64 driver_hash;
+};
+static_assert(sizeof(FileHeader) == 24);
+
+struct EntryHeader {
+    u64 hash;
+    u32 format;
+    u32 size;
+};
+static_assert(sizeof(EntryHeader) == 16);
+
+std::string_view GetString(GLenum name) {
+    const GLubyte* const string = glGetString(name);
+    return string ? reinterpret_cast<const char*>(string) : "";
+}
+
+u64 DriverHash() {
+    std::string driver{GetString(GL_VENDOR)};
+    driver += '\n';
+    driver += GetString(GL_RENDERER);
+    driver += '\n';
+    driver += GetString(GL_VERSION);
+    return Common::CityHash64(driver.data(), driver.size());
+}
+} // Anonymous namespace
+
+ProgramBinaryCache::ProgramBinaryCache() {
+    GLint num_formats{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    is_supported = num_formats > 0;
+    if (is_supported) {
+        driver_hash = DriverHash();
+    }
+}
+
+ProgramBinaryCache::~ProgramBinaryCache() = default;
+
+void ProgramBinaryCache::Load(const std::filesystem::path& filename) {
+    std::scoped_lock lock{mutex};
+    if (!is_supported) {
+        return;
+    }
+    binaries_filename = filename;
+    binaries.clear();
+
+    Common::FS::MappedFile mapped_file;
+    if (!mapped_file.Open(filename)) {
+        return;
+    }
+    const std::span<const u8> data{mapped_file.Span()};
+    FileHeader header{};
+    if (data.size() >= sizeof(header)) {
+        std::memcpy(&header, data.data(), sizeof(header));
+    }
+    if (header.magic != MAGIC_NUMBER || header.version != BINARY_CACHE_VERSION ||
+        header.driver_hash != driver_hash) {
+        mapped_file.Close();
+        if (Common::FS::RemoveFile(filename)) {
+            LOG_INFO(Render_OpenGL, "Deleting program binaries built by another driver");
+        } else {
+            LOG_ERROR(Common_Filesystem, "Failed to delete program binary file {}",
+                      Common::FS::PathToUTF8String(filename));
+        }
+        return;
+    }
+    size_t offset{sizeof(header)};
+    while (data.size() - offset >= sizeof(EntryHeader)) {
+        EntryHeader entry;
+        std::memcpy(&entry, data.data() + offset, sizeof(entry));
+        offset += sizeof(entry);
+        if (entry.size > data.size() - offset) {
+            LOG_WARNING(Render_OpenGL, "Truncated program binary file");
+            break;
+        }
+        const u8* const begin{data.data() + offset};
+        binaries.insert_or_assign(entry.hash,
+                                  std::make_shared<const Binary>(Binary{
+                                      .format = static_cast<GLenum>(entry.format),
+                                      .data = std::vector<u8>(begin, begin + entry.size),
+                                  }));
+        offset += entry.size;
+    }
+    LOG_INFO(Render_OpenGL, "Loaded {} program binaries", binaries.size());
+}
+
+OGLProgram ProgramBinaryCache::CreateProgram(std::string_view code, GLenum stage) {
+    const u64 hash{Common::CityHash64WithSeed(code.data(), code.size(), stage)};
+    return GetOrBuild(hash, [&] { return OpenGL::CreateProgram(code, stage); });
+}
+
+OGLProgram ProgramBinaryCache::CreateProgram(std::span<const u32> code, GLenum stage) {
+    const u64 hash{Common::CityHash64WithSeed(reinterpret_cast<const char*>(code.data()),
+                                              code.size_bytes(), stage)};
+    return GetOrBuild(hash, [&] { return OpenGL::CreateProgram(code, stage); });
+}
+
+template <typename Func>
+OGLProgram ProgramBinaryCache::GetOrBuild(u64 hash, Func&& build) {
+    if (!is_supported) {
+        return build();
+    }
+    if (OGLProgram program{LoadBinary(hash)}; program.handle != 0) {
+        return program;
+    }
+    OGLProgram program{build()};
+    StoreBinary(hash, program.handle);
+    return program;
+}
+
+OGLProgram ProgramBinaryCache::LoadBinary(u64 hash) {
+    std::shared_ptr<const Binary> binary;
+    {
+        std::scoped_lock lock{mutex};
+        const auto it{binaries.find(hash)};
+        if (it == binaries.end()) {
+            return {};
+        }
+        binary = it->second;
+    }
+    OGLProgram program;
+    program.handle = glCreateProgram();
+    glProgramParameteri(program.handle, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    glProgramBinary(program.handle, binary->format, binary->data.data(),
+                    static_cast<GLsizei>(binary->data.size()));
+    GLint link_status{};
+    glGetProgramiv(program.handle, GL_LINK_STATUS, &link_status);
+    if (link_status == GL_FALSE) {
+        // The driver rejected the binary, build it from source and replace it
+        LOG_DEBUG(Render_OpenGL, "Program binary {:016x} rejected by the driver", hash);
+        return {};
+    }
+    return program;
+}
+
+void ProgramBinaryCache::StoreBinary(u64 hash, GLuint program) try {
+    {
+        std::scoped_lock lock{mutex};
+        if (binaries_filename.empty()) {
+            return;
+        }
+    }
+    GLint link_status{};
+    glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+    GLint length{};
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (link_status == GL_FALSE || length <= 0) {
+        return;
+    }
+    Binary binary{
+        .format = 0,
+        .data = std::vector<u8>(static_cast<size_t>(length)),
+    };
+    glGetProgramBinary(program, length, nullptr, &binary.format, binary.data.data());
+
+    const EntryHeader entry{
+        .hash = hash,
+        .format = static_cast<u32>(binary.format),
+        .size = static_cast<u32>(binary.data.size()),
+    };
+    std::scoped_lock lock{mutex};
+    std::ofstream file(binaries_filename, std::ios::binary | std::ios::ate | std::ios::app);
+    file.exceptions(std::ofstream::failbit);
+    if (file.tellp() == 0) {
+        const FileHeader header{
+            .magic = MAGIC_NUMBER,
+            .version = BINARY_CACHE_VERSION,
+            .padding = 0,
+            .driver_hash = driver_hash,
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    file.write(reinterpret_cast<const char*>(&entry), sizeof(entry))
+        .write(reinterpret_cast<const char*>(binary.data.data()),
+               static_cast<std::streamsize>(binary.data.size()));
+    binaries.insert_or_assign(hash, std::make_shared<const Binary>(std::move(binary)));
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    std::scoped_lock lock{mutex};
+    if (!Common::FS::RemoveFile(binaries_filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete program binary file {}",
+                  Common::FS::PathToUTF8String(binaries_filename));
+    }
+    binaries_filename.clear();
+}
+
+} // namespace OpenGL
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "common/common_types.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+/**
+ * Persists the driver binaries of linked GLSL and SPIR-V programs, so pipelines loaded from the
+ * disk cache skip the driver compiler. Binaries are only valid for the driver that built them,
+ * the file is discarded when the vendor, renderer or version strings change.
+ * Programs can be created from any thread with a current context.
+ */
+class ProgramBinaryCache {
+public:
+    ProgramBinaryCache();
+    ~ProgramBinaryCache();
+
+    ProgramBinaryCache& operator=(const ProgramBinaryCache&) = delete;
+    ProgramBinaryCache(const ProgramBinaryCache&) = delete;
+
+    /// Loads the binaries stored in a file, new binaries are appended to it
+    void Load(const std::filesystem::path& filename);
+
+    /// Creates a separable program from GLSL code, reusing a stored binary when possible
+    [[nodiscard]] OGLProgram CreateProgram(std::string_view code, GLenum stage);
+
+    /// Creates a separable program from SPIR-V code, reusing a stored binary when possible
+    [[nodiscard]] OGLProgram CreateProgram(std::span<const u32> code, GLenum stage);
+
+private:
+    struct Binary {
+        GLenum format;
+        std::vector<u8> data;
+    };
+
+    template <typename Func>
+    OGLProgram GetOrBuild(u64 hash, Func&& build);
+
+    OGLProgram LoadBinary(u64 hash);
+
+    void StoreBinary(u64 hash, GLuint program);
+
+    bool is_supported{};
+    u64 driver_hash{};
+
+    std::mutex mutex;
+    std::filesystem::path binaries_filename;
+    std::unordered_map<u64, std::shared_ptr<const Binary>> binaries;
+};
+
+} // namespace OpenGL
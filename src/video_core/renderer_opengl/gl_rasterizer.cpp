@@ -11,6 +11,7 @@
 #include <glad/glad.h>
 
 #include "common/assert.h"
+#include "common/boot_timeline.h"
 #include "common/logging/log.h"
 #include "common/math_util.h"
 #include "common/microprofile.h"
@@ -152,6 +153,8 @@ void RasterizerOpenGL::SyncVertexInstances() {
 
 void RasterizerOpenGL::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
+    const Common::BootTimeline::ScopedStage boot_stage{"disk_resources"};
+    texture_cache.LoadDiskResources(title_id);
     shader_cache.LoadDiskResources(title_id, stop_loading, callback);
 }
 
@@ -593,6 +596,36 @@ void RasterizerOpenGL::OnCacheInvalidation(DAddr addr, u64 size) {
     shader_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerOpenGL::OnCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> ranges) {
+    MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+
+    // Same as invalidating each range on its own, taking every lock once
+    const auto is_empty{[](const std::pair<DAddr, std::size_t>& range) {
+        return range.first == 0 || range.second == 0;
+    }};
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& range : ranges) {
+            if (!is_empty(range)) {
+                texture_cache.WriteMemory(range.first, range.second);
+            }
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& range : ranges) {
+            if (!is_empty(range)) {
+                buffer_cache.WriteMemory(range.first, range.second);
+            }
+        }
+    }
+    for (const auto& range : ranges) {
+        if (!is_empty(range)) {
+            shader_cache.InvalidateRegion(range.first, range.second);
+        }
+    }
+}
+
 void RasterizerOpenGL::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -4,17 +4,20 @@
 #include <atomic>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <thread>
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/fast_hash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
 #include "shader_recompiler/backend/glsl/emit_glsl.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
@@ -41,6 +44,7 @@ using Shader::Backend::GLSL::EmitGLSL;
 using Shader::Backend::SPIRV::EmitSPIRV;
 using Shader::Maxwell::ConvertLegacyToGeneric;
 using Shader::Maxwell::GenerateGeometryPassthrough;
+using Shader::Maxwell::LinkStages;
 using Shader::Maxwell::MergeDualVertexPrograms;
 using Shader::Maxwell::TranslateProgram;
 using VideoCommon::ComputeEnvironment;
@@ -51,7 +55,7 @@ using VideoCommon::LoadPipelines;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 10;
+constexpr u32 CACHE_VERSION = Common::WithFastHashVersion(13);
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -247,6 +251,10 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
           .support_geometry_shader_passthrough = device.HasGeometryShaderPassthrough(),
           .support_conditional_barrier = device.SupportsConditionalBarriers(),
       } {
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+        // Let the driver compile programs built on this context on its own threads
+        glMaxShaderCompilerThreadsKHR(std::numeric_limits<GLuint>::max());
+    }
     if (use_asynchronous_shaders) {
         workers = CreateWorkers();
     }
@@ -266,6 +274,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         return;
     }
     shader_cache_filename = base_dir / "opengl.bin";
+    program_binary_cache.Load(base_dir / "opengl_binaries.bin");
 
     if (!workers && !strict_context_required) {
         workers = CreateWorkers();
@@ -289,7 +298,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
@@ -306,7 +315,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
         queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
@@ -451,6 +460,7 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     bool force_context_flush) try {
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
+    Shader::CompileArenaScope arena_scope;
     size_t env_index{};
     u32 total_storage_buffers{};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
@@ -496,11 +506,25 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
                 Shader::NumDescriptors(program_vb.info.storage_buffers_descriptors);
             programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
         }
+        if (programs[index].info.uses_global_memory) {
+            ReportGlobalMemoryFallback(key.unique_hashes[index]);
+        }
 
         if (programs[index].info.requires_layer_emulation) {
             layer_source_program = &programs[index];
         }
     }
+    // Transform feedback captures the outputs the fragment stage doesn't read
+    constexpr size_t fragment_index{static_cast<size_t>(Maxwell::ShaderType::Pixel)};
+    if (key.xfb_enabled == 0 && key.unique_hashes[fragment_index] != 0 &&
+        layer_source_program == nullptr) {
+        for (size_t index = fragment_index - 1; index > 0; --index) {
+            if (key.unique_hashes[index] != 0) {
+                LinkStages(programs[index], programs[fragment_index]);
+                break;
+            }
+        }
+    }
     const u32 glasm_storage_buffer_limit{device.GetMaxGLASMStorageBufferBlocks()};
     const bool glasm_use_storage_buffers{total_storage_buffers <= glasm_storage_buffer_limit};
 
@@ -542,9 +566,9 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
         previous_program = &program;
     }
     auto* const thread_worker{use_shader_workers ? workers.get() : nullptr};
-    return std::make_unique<GraphicsPipeline>(device, texture_cache, buffer_cache, program_manager,
-                                              state_tracker, thread_worker, &shader_notify, sources,
-                                              sources_spirv, infos, key, force_context_flush);
+    return std::make_unique<GraphicsPipeline>(
+        device, texture_cache, buffer_cache, program_manager, program_binary_cache, state_tracker,
+        thread_worker, &shader_notify, sources, sources_spirv, infos, key, force_context_flush);
 
 } catch (Shader::Exception& exception) {
     LOG_ERROR(Render_OpenGL, "{}", exception.what());
@@ -573,6 +597,7 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     bool force_context_flush) try {
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
+    Shader::CompileArenaScope arena_scope;
 
     Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
 
@@ -581,6 +606,9 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     }
 
     auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+    if (program.info.uses_global_memory) {
+        ReportGlobalMemoryFallback(key.unique_hash);
+    }
     const u32 num_storage_buffers{Shader::NumDescriptors(program.info.storage_buffers_descriptors)};
     Shader::RuntimeInfo info;
     info.glasm_use_storage_buffers = num_storage_buffers <= device.GetMaxGLASMStorageBufferBlocks();
@@ -600,7 +628,8 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     }
 
     return std::make_unique<ComputePipeline>(device, texture_cache, buffer_cache, program_manager,
-                                             program.info, code, code_spirv, force_context_flush);
+                                             program_binary_cache, program.info, code, code_spirv,
+                                             force_context_flush);
 } catch (Shader::Exception& exception) {
     LOG_ERROR(Render_OpenGL, "{}", exception.what());
     return nullptr;
@@ -609,7 +638,8 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
 std::unique_ptr<ShaderWorker> ShaderCache::CreateWorkers() const {
     return std::make_unique<ShaderWorker>(std::max(std::thread::hardware_concurrency(), 2U) - 1,
                                           "GlShaderBuilder",
-                                          [this] { return Context{emu_window}; });
+                                          [this] { return Context{emu_window}; },
+                                          Common::ThreadCoreClass::Efficiency);
 }
 
 } // namespace OpenGL
@@ -707,6 +707,7 @@ Image::Image(TextureCacheRuntime& runtime_, const VideoCommon::ImageInfo& info_,
         gl_type = GL_UNSIGNED_INT_8_8_8_8_REV;
 
         if (IsPixelFormatASTC(info.format) && IsAstcRecompressionEnabled()) {
+            flags |= ImageFlagBits::Recompressed;
             gl_internal_format = SelectAstcFormat(info.format, is_srgb);
             gl_format = GL_NONE;
         }
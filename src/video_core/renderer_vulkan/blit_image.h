@@ -17,6 +17,7 @@ using VideoCommon::Region2D;
 class Device;
 class Framebuffer;
 class ImageView;
+class RenderPassCache;
 class StateTracker;
 class Scheduler;
 
@@ -40,7 +41,8 @@ struct BlitDepthStencilPipelineKey {
 class BlitImageHelper {
 public:
     explicit BlitImageHelper(const Device& device, Scheduler& scheduler,
-                             StateTracker& state_tracker, DescriptorPool& descriptor_pool);
+                             StateTracker& state_tracker, DescriptorPool& descriptor_pool,
+                             RenderPassCache& render_pass_cache);
     ~BlitImageHelper();
 
     void BlitColor(const Framebuffer* dst_framebuffer, VkImageView src_image_view,
@@ -57,6 +59,12 @@ public:
                           const Region2D& src_region, Tegra::Engines::Fermi2D::Filter filter,
                           Tegra::Engines::Fermi2D::Operation operation);
 
+    /// Blits the red channel of a color image to the depth of the destination, scaled and
+    /// filtered like any other blit
+    void BlitColorToDepth(const Framebuffer* dst_framebuffer, VkImageView src_image_view,
+                          const Region2D& dst_region, const Region2D& src_region,
+                          Tegra::Engines::Fermi2D::Filter filter);
+
     void ConvertD32ToR32(const Framebuffer* dst_framebuffer, const ImageView& src_image_view);
 
     void ConvertR32ToD32(const Framebuffer* dst_framebuffer, const ImageView& src_image_view);
@@ -93,6 +101,8 @@ private:
 
     [[nodiscard]] VkPipeline FindOrEmplaceDepthStencilPipeline(const BlitImagePipelineKey& key);
 
+    [[nodiscard]] VkPipeline FindOrEmplaceColorToDepthPipeline(const BlitImagePipelineKey& key);
+
     [[nodiscard]] VkPipeline FindOrEmplaceClearColorPipeline(const BlitImagePipelineKey& key);
     [[nodiscard]] VkPipeline FindOrEmplaceClearStencilPipeline(
         const BlitDepthStencilPipelineKey& key);
@@ -115,6 +125,7 @@ private:
     const Device& device;
     Scheduler& scheduler;
     StateTracker& state_tracker;
+    RenderPassCache& render_pass_cache;
 
     vk::DescriptorSetLayout one_texture_set_layout;
     vk::DescriptorSetLayout two_textures_set_layout;
@@ -126,6 +137,7 @@ private:
     vk::ShaderModule full_screen_vert;
     vk::ShaderModule blit_color_to_color_frag;
     vk::ShaderModule blit_depth_stencil_frag;
+    vk::ShaderModule blit_color_to_depth_frag;
     vk::ShaderModule clear_color_vert;
     vk::ShaderModule clear_color_frag;
     vk::ShaderModule clear_stencil_frag;
@@ -143,6 +155,8 @@ private:
     std::vector<vk::Pipeline> blit_color_pipelines;
     std::vector<BlitImagePipelineKey> blit_depth_stencil_keys;
     std::vector<vk::Pipeline> blit_depth_stencil_pipelines;
+    std::vector<BlitImagePipelineKey> blit_color_to_depth_keys;
+    std::vector<vk::Pipeline> blit_color_to_depth_pipelines;
     std::vector<BlitImagePipelineKey> clear_color_keys;
     std::vector<vk::Pipeline> clear_color_pipelines;
     std::vector<BlitDepthStencilPipelineKey> clear_stencil_keys;
@@ -5,8 +5,8 @@
 #include <cstring>
 
 #include "common/bit_cast.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/fast_hash.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/engines/draw_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -58,10 +58,11 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     extended_dynamic_state_2_extra.Assign(features.has_extended_dynamic_state_2_extra ? 1 : 0);
     extended_dynamic_state_3_blend.Assign(features.has_extended_dynamic_state_3_blend ? 1 : 0);
     extended_dynamic_state_3_enables.Assign(features.has_extended_dynamic_state_3_enables ? 1 : 0);
+    extended_dynamic_state_3_rasterization.Assign(
+        features.has_extended_dynamic_state_3_rasterization ? 1 : 0);
     dynamic_vertex_input.Assign(features.has_dynamic_vertex_input ? 1 : 0);
     xfb_enabled.Assign(regs.transform_feedback_enabled != 0);
     ndc_minus_one_to_one.Assign(regs.depth_mode == Maxwell::DepthMode::MinusOneToOne ? 1 : 0);
-    polygon_mode.Assign(PackPolygonMode(regs.polygon_mode_front));
     tessellation_primitive.Assign(static_cast<u32>(regs.tessellation.params.domain_type.Value()));
     tessellation_spacing.Assign(static_cast<u32>(regs.tessellation.params.spacing.Value()));
     tessellation_clockwise.Assign(regs.tessellation.params.output_primitives.Value() ==
@@ -79,18 +80,31 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     depth_enabled.Assign(regs.zeta_enable != 0 ? 1 : 0);
     depth_format.Assign(static_cast<u32>(regs.zeta.format));
     y_negate.Assign(regs.window_origin.mode != Maxwell::WindowOrigin::Mode::UpperLeft ? 1 : 0);
-    provoking_vertex_last.Assign(regs.provoking_vertex == Maxwell::ProvokingVertex::Last ? 1 : 0);
-    conservative_raster_enable.Assign(regs.conservative_raster_enable != 0 ? 1 : 0);
-    smooth_lines.Assign(regs.line_anti_alias_enable != 0 ? 1 : 0);
-    alpha_to_coverage_enabled.Assign(regs.anti_alias_alpha_control.alpha_to_coverage != 0 ? 1 : 0);
-    alpha_to_one_enabled.Assign(regs.anti_alias_alpha_control.alpha_to_one != 0 ? 1 : 0);
     app_stage.Assign(maxwell3d.engine_state);
+    if (!extended_dynamic_state_3_rasterization) {
+        polygon_mode.Assign(PackPolygonMode(regs.polygon_mode_front));
+        provoking_vertex_last.Assign(regs.provoking_vertex == Maxwell::ProvokingVertex::Last ? 1
+                                                                                           : 0);
+        conservative_raster_enable.Assign(regs.conservative_raster_enable != 0 ? 1 : 0);
+        smooth_lines.Assign(regs.line_anti_alias_enable != 0 ? 1 : 0);
+        alpha_to_coverage_enabled.Assign(
+            regs.anti_alias_alpha_control.alpha_to_coverage != 0 ? 1 : 0);
+        alpha_to_one_enabled.Assign(regs.anti_alias_alpha_control.alpha_to_one != 0 ? 1 : 0);
+    }
 
     for (size_t i = 0; i < regs.rt.size(); ++i) {
         color_formats[i] = static_cast<u8>(regs.rt[i].format);
     }
-    alpha_test_ref = Common::BitCast<u32>(regs.alpha_test_ref);
-    point_size = Common::BitCast<u32>(regs.point_size);
+    // Values the shaders don't read are left out of the key, stale registers would otherwise
+    // create pipelines with identical code
+    const u32 packed_test_func = alpha_test_func.Value();
+    const bool reads_alpha_ref =
+        packed_test_func != PackComparisonOp(Maxwell::ComparisonOp::Always_GL) &&
+        packed_test_func != PackComparisonOp(Maxwell::ComparisonOp::Never_GL);
+    alpha_test_ref = reads_alpha_ref ? Common::BitCast<u32>(regs.alpha_test_ref) : 0;
+    const bool reads_point_size = topology_ == Maxwell::PrimitiveTopology::Points ||
+                                  regs.IsShaderConfigEnabled(Maxwell::ShaderType::Geometry);
+    point_size = reads_point_size ? Common::BitCast<u32>(regs.point_size) : 0;
 
     if (maxwell3d.dirty.flags[Dirty::VertexInput]) {
         if (features.has_dynamic_vertex_input) {
@@ -261,7 +275,7 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs) {
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::FastHash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <span>
 
 #include <boost/container/small_vector.hpp>
 
@@ -28,12 +29,24 @@ public:
                num_descriptors <= device->MaxPushDescriptors();
     }
 
-    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor) const {
+    /// Texel buffers are bound through buffer views, these can't be written to descriptor buffers.
+    /// Arrays of combined image samplers must be contiguous in memory.
+    bool CanUseDescriptorBuffer() const noexcept {
+        return device->IsExtDescriptorBufferSupported() && !has_texel_buffers &&
+               (!has_texture_arrays ||
+                device->GetDescriptorBufferProperties().combinedImageSamplerDescriptorSingleArray);
+    }
+
+    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor,
+                                                      bool use_descriptor_buffer = false) const {
         if (bindings.empty()) {
             return nullptr;
         }
-        const VkDescriptorSetLayoutCreateFlags flags =
+        VkDescriptorSetLayoutCreateFlags flags =
             use_push_descriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+        if (use_descriptor_buffer) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         return device->GetLogical().CreateDescriptorSetLayout({
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = nullptr,
@@ -88,6 +101,10 @@ public:
         });
     }
 
+    std::span<const VkDescriptorSetLayoutBinding> Bindings() const noexcept {
+        return bindings;
+    }
+
     void Add(const Shader::Info& info, VkShaderStageFlags stage) {
         is_compute |= (stage & VK_SHADER_STAGE_COMPUTE_BIT) != 0;
 
@@ -103,7 +120,11 @@ private:
     template <typename Descriptors>
     void Add(VkDescriptorType type, VkShaderStageFlags stage, const Descriptors& descriptors) {
         const size_t num{descriptors.size()};
+        has_texel_buffers |= num > 0 && (type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+                                         type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER);
         for (size_t i = 0; i < num; ++i) {
+            has_texture_arrays |= type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER &&
+                                  descriptors[i].count > 1;
             bindings.push_back({
                 .binding = binding,
                 .descriptorType = type,
@@ -127,6 +148,8 @@ private:
 
     const Device* device{};
     bool is_compute{};
+    bool has_texel_buffers{};
+    bool has_texture_arrays{};
     boost::container::small_vector<VkDescriptorSetLayoutBinding, 32> bindings;
     boost::container::small_vector<VkDescriptorUpdateTemplateEntry, 32> entries;
     u32 binding{};
@@ -5,6 +5,7 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -66,18 +67,109 @@ std::string BuildCommaSeparatedExtensions(
     return fmt::format("{}", fmt::join(available_extensions, ","));
 }
 
-} // Anonymous namespace
-
-Device CreateDevice(const vk::Instance& instance, const vk::InstanceDispatch& dld,
-                    VkSurfaceKHR surface) {
+vk::PhysicalDevice SelectPhysicalDevice(const vk::Instance& instance,
+                                        const vk::InstanceDispatch& dld) {
     const std::vector<VkPhysicalDevice> devices = instance.EnumeratePhysicalDevices();
     const s32 device_index = Settings::values.vulkan_device.GetValue();
     if (device_index < 0 || device_index >= static_cast<s32>(devices.size())) {
         LOG_ERROR(Render_Vulkan, "Invalid device index {}!", device_index);
         throw vk::Exception(VK_ERROR_INITIALIZATION_FAILED);
     }
-    const vk::PhysicalDevice physical_device(devices[device_index], dld);
-    return Device(*instance, physical_device, surface, dld);
+    return vk::PhysicalDevice(devices[device_index], dld);
+}
+
+/// Device context of the previous emulation session. Creating the instance and the device takes
+/// hundreds of milliseconds with some drivers.
+struct ParkedDeviceContext {
+    std::mutex mutex;
+    std::unique_ptr<DeviceContext> context;
+};
+
+ParkedDeviceContext& GetParkedDeviceContext() {
+    static ParkedDeviceContext parked_context;
+    return parked_context;
+}
+
+std::unique_ptr<DeviceContext, DeviceContextDeleter> AcquireDeviceContext(
+    Core::Frontend::GraphicsContext* graphics_context,
+    Core::Frontend::WindowSystemType window_type) {
+    const bool renderer_debug = Settings::values.renderer_debug.GetValue();
+    const s32 device_index = Settings::values.vulkan_device.GetValue();
+    {
+        ParkedDeviceContext& parked{GetParkedDeviceContext()};
+        std::scoped_lock lk{parked.mutex};
+        DeviceContext* const context = parked.context.get();
+        if (context && context->window_type == window_type &&
+            context->renderer_debug == renderer_debug && context->device_index == device_index) {
+            return std::unique_ptr<DeviceContext, DeviceContextDeleter>{parked.context.release()};
+        }
+        // Destroy the previous instance before creating another
+        parked.context.reset();
+    }
+    std::unique_ptr<DeviceContext, DeviceContextDeleter> context{new DeviceContext{}};
+    context->library = OpenLibrary(graphics_context);
+    context->instance = CreateInstance(*context->library, context->dld, VK_API_VERSION_1_1,
+                                       window_type, renderer_debug);
+    if (renderer_debug) {
+        context->debug_messenger = CreateDebugUtilsCallback(context->instance);
+    }
+    context->window_type = window_type;
+    context->renderer_debug = renderer_debug;
+    context->device_index = device_index;
+    return context;
+}
+
+DeviceContext::DeviceSettings CurrentDeviceSettings() {
+    return {
+        .enable_compute_pipelines = Settings::values.enable_compute_pipelines.GetValue(),
+        .shader_feedback = Settings::values.renderer_shader_feedback.GetValue(),
+        .nsight_aftermath = Settings::values.enable_nsight_aftermath.GetValue(),
+        .memory_scale = Settings::values.resolution_info.ScaleUp(1),
+    };
+}
+
+Device& AcquireDevice(DeviceContext& context, VkSurfaceKHR surface) {
+    // A kept device can only be reused when it presents to the surface of the new window and was
+    // created with the settings of this session, these may be changed per game
+    const DeviceContext::DeviceSettings device_settings{CurrentDeviceSettings()};
+    if (context.device && (context.device_settings != device_settings ||
+                           !context.device->GetPhysical().GetSurfaceSupportKHR(
+                               context.device->GetPresentFamily(), surface))) {
+        context.device.reset();
+    }
+    if (!context.device) {
+        context.device = std::make_unique<Device>(
+            *context.instance, SelectPhysicalDevice(context.instance, context.dld), surface,
+            context.dld);
+        context.device_settings = device_settings;
+    }
+    return *context.device;
+}
+
+} // Anonymous namespace
+
+Device CreateDevice(const vk::Instance& instance, const vk::InstanceDispatch& dld,
+                    VkSurfaceKHR surface) {
+    return Device(*instance, SelectPhysicalDevice(instance, dld), surface, dld);
+}
+
+void DeviceContextDeleter::operator()(DeviceContext* context) const {
+    std::unique_ptr<DeviceContext> owned_context{context};
+#ifndef ANDROID
+    // Android frontends may load a different driver for the next title
+    if (owned_context->is_device_lost) {
+        return;
+    }
+    ParkedDeviceContext& parked{GetParkedDeviceContext()};
+    std::scoped_lock lk{parked.mutex};
+    parked.context = std::move(owned_context);
+#endif
+}
+
+void ReleaseParkedDeviceContext() {
+    ParkedDeviceContext& parked{GetParkedDeviceContext()};
+    std::scoped_lock lk{parked.mutex};
+    parked.context.reset();
 }
 
 RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
@@ -85,24 +177,23 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
                                Tegra::MaxwellDeviceMemoryManager& device_memory_, Tegra::GPU& gpu_,
                                std::unique_ptr<Core::Frontend::GraphicsContext> context_) try
     : RendererBase(emu_window, std::move(context_)), telemetry_session(telemetry_session_),
-      device_memory(device_memory_), gpu(gpu_), library(OpenLibrary(context.get())),
-      instance(CreateInstance(*library, dld, VK_API_VERSION_1_1, render_window.GetWindowInfo().type,
-                              Settings::values.renderer_debug.GetValue())),
-      debug_messenger(Settings::values.renderer_debug ? CreateDebugUtilsCallback(instance)
-                                                      : vk::DebugUtilsMessenger{}),
+      device_memory(device_memory_), gpu(gpu_),
+      device_context(AcquireDeviceContext(context.get(), render_window.GetWindowInfo().type)),
+      dld(device_context->dld), instance(device_context->instance),
       surface(CreateSurface(instance, render_window.GetWindowInfo())),
-      device(CreateDevice(instance, dld, *surface)), memory_allocator(device), state_tracker(),
+      device(AcquireDevice(*device_context, *surface)), memory_allocator(device), state_tracker(),
       scheduler(device, state_tracker),
       swapchain(*surface, device, scheduler, render_window.GetFramebufferLayout().width,
                 render_window.GetFramebufferLayout().height),
       present_manager(instance, render_window, device, memory_allocator, scheduler, swapchain,
-                      surface),
+                      surface, gpu),
       blit_screen(device_memory, render_window, device, memory_allocator, swapchain,
                   present_manager, scheduler, screen_info),
       rasterizer(render_window, gpu, device_memory, screen_info, device, memory_allocator,
                  state_tracker, scheduler) {
     if (Settings::values.renderer_force_max_clock.GetValue() && device.ShouldBoostClocks()) {
-        turbo_mode.emplace(instance, dld);
+        // Frame GPU time is measured with the scheduler's submission timestamps
+        turbo_mode.emplace(instance, dld, device.SupportsTimestamps());
         scheduler.RegisterOnSubmit([this] { turbo_mode->QueueSubmitted(); });
     }
     Report();
@@ -113,7 +204,8 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
 
 RendererVulkan::~RendererVulkan() {
     scheduler.RegisterOnSubmit([] {});
-    void(device.GetLogical().WaitIdle());
+    // A lost device can't be handed to the next session
+    device_context->is_device_lost = device.GetLogical().WaitIdle() == VK_ERROR_DEVICE_LOST;
 }
 
 void RendererVulkan::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
@@ -140,6 +232,19 @@ void RendererVulkan::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
+    gpu.RendererGpuTimeNotify(rasterizer.FrameGpuTime());
+    if (turbo_mode) {
+        turbo_mode->FrameTimed(rasterizer.FrameGpuTime());
+    }
+}
+
+void RendererVulkan::SetThermalThrottling(bool throttled) {
+    RendererBase::SetThermalThrottling(throttled);
+    rasterizer.SetThermalThrottling(throttled);
+    if (turbo_mode) {
+        // Holding the GPU clocks up would only make the host throttle harder
+        turbo_mode->SetSuspended(throttled);
+    }
 }
 
 void RendererVulkan::Report() const {
@@ -8,6 +8,7 @@
 #include <variant>
 
 #include "common/dynamic_library.h"
+#include "core/frontend/emu_window.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
@@ -38,6 +39,41 @@ namespace Vulkan {
 Device CreateDevice(const vk::Instance& instance, const vk::InstanceDispatch& dld,
                     VkSurfaceKHR surface);
 
+/// Instance and device of the renderer, kept between emulation sessions
+struct DeviceContext {
+    std::shared_ptr<Common::DynamicLibrary> library;
+    vk::InstanceDispatch dld;
+    vk::Instance instance;
+    vk::DebugUtilsMessenger debug_messenger;
+    std::unique_ptr<Device> device;
+
+    /// Settings the context was created with, to tell whether the next session can reuse it
+    Core::Frontend::WindowSystemType window_type{};
+    bool renderer_debug{};
+    s32 device_index{};
+    bool is_device_lost{};
+
+    /// Settings read by the Device constructor, which bakes them into its features and limits
+    struct DeviceSettings {
+        bool operator==(const DeviceSettings&) const = default;
+
+        bool enable_compute_pipelines{};
+        bool shader_feedback{};
+        bool nsight_aftermath{};
+        /// Resolution scale of the texture cache memory limits
+        s32 memory_scale{};
+    };
+    DeviceSettings device_settings{};
+};
+
+/// Parks the context for the next emulation session instead of destroying it
+struct DeviceContextDeleter {
+    void operator()(DeviceContext* context) const;
+};
+
+/// Destroys the instance and device kept from the previous emulation session
+void ReleaseParkedDeviceContext();
+
 class RendererVulkan final : public VideoCore::RendererBase {
 public:
     explicit RendererVulkan(Core::TelemetrySession& telemtry_session,
@@ -48,6 +84,12 @@ public:
 
     void SwapBuffers(const Tegra::FramebufferConfig* framebuffer) override;
 
+    void SetThermalThrottling(bool throttled) override;
+
+    [[nodiscard]] std::chrono::nanoseconds FrameGpuTime() const override {
+        return rasterizer.FrameGpuTime();
+    }
+
     VideoCore::RasterizerInterface* ReadRasterizer() override {
         return &rasterizer;
     }
@@ -65,16 +107,14 @@ private:
     Tegra::MaxwellDeviceMemoryManager& device_memory;
     Tegra::GPU& gpu;
 
-    std::shared_ptr<Common::DynamicLibrary> library;
-    vk::InstanceDispatch dld;
-
-    vk::Instance instance;
-    vk::DebugUtilsMessenger debug_messenger;
+    std::unique_ptr<DeviceContext, DeviceContextDeleter> device_context;
+    vk::InstanceDispatch& dld;
+    vk::Instance& instance;
     vk::SurfaceKHR surface;
 
     ScreenInfo screen_info;
 
-    Device device;
+    Device& device;
     MemoryAllocator memory_allocator;
     StateTracker state_tracker;
     Scheduler scheduler;
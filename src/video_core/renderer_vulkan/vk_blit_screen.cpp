@@ -205,6 +205,7 @@ void BlitScreen::Draw(const Tegra::FramebufferConfig& framebuffer,
 
     scheduler.Wait(resource_ticks[image_index]);
     resource_ticks[image_index] = scheduler.CurrentTick();
+    scheduler.BeginProfiledPass(PassKey{.type = PassType::Present});
 
     VkImage source_image = use_accelerated ? screen_info.image : *raw_images[image_index];
     VkImageView source_image_view =
@@ -480,6 +481,7 @@ void BlitScreen::Draw(const Tegra::FramebufferConfig& framebuffer,
         cmdbuf.Draw(4, 1, 0, 0);
         cmdbuf.EndRenderPass();
     });
+    scheduler.EndProfiledPass();
 }
 
 void BlitScreen::DrawToSwapchain(Frame* frame, const Tegra::FramebufferConfig& framebuffer,
@@ -4,9 +4,12 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <limits>
 #include <span>
 #include <vector>
 
+#include "common/alignment.h"
+#include "common/metrics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
@@ -19,6 +22,15 @@
 
 namespace Vulkan {
 namespace {
+// Largest uniform buffer written straight to the stream buffer when it lives in video memory
+constexpr u32 DIRECT_UNIFORM_BUFFER_SKIP_CACHE_SIZE = 16 * 1024;
+
+// Fewest copies of an upload scattered by a compute pass, fewer are cheap enough as transfers
+constexpr size_t MIN_SCATTER_UPLOAD_COPIES = 64;
+
+// Index conversions remembered per submission before the list is searched for too long
+constexpr size_t MAX_INDEX_CONVERSIONS = 256;
+
 VkBufferCopy MakeBufferCopy(const VideoCommon::BufferCopy& copy) {
     return VkBufferCopy{
         .srcOffset = copy.src_offset,
@@ -64,6 +76,10 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
     if (device.IsExtConditionalRendering()) {
         flags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
     }
+    if (device.IsExtDescriptorBufferSupported()) {
+        // Descriptor buffers reference uniform and storage buffers by device address
+        flags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     const VkBufferCreateInfo buffer_ci = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -328,7 +344,9 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
       staging_pool{staging_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
       quad_index_pass(device, scheduler, descriptor_pool, staging_pool,
-                      compute_pass_descriptor_queue) {
+                      compute_pass_descriptor_queue),
+      buffer_scatter_pass(device, scheduler, descriptor_pool, staging_pool,
+                          compute_pass_descriptor_queue) {
     if (device.GetDriverID() != VK_DRIVER_ID_QUALCOMM_PROPRIETARY) {
         // TODO: FixMe: Uint8Pass compute shader does not build on some Qualcomm drivers.
         uint8_pass = std::make_unique<Uint8Pass>(device, scheduler, descriptor_pool, staging_pool,
@@ -338,6 +356,11 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                                                      scheduler_, staging_pool_);
     quad_strip_index_buffer = std::make_shared<QuadStripIndexBuffer>(device_, memory_allocator_,
                                                                      scheduler_, staging_pool_);
+    if (memory_allocator.HasLargeDeviceLocalHostVisibleHeap()) {
+        // With resizable BAR the stream buffer is device local, writing uniform buffers directly
+        // there is cheaper than uploading them to cached buffers with a copy and a barrier
+        uniform_buffer_skip_cache_size = DIRECT_UNIFORM_BUFFER_SKIP_CACHE_SIZE;
+    }
 }
 
 StagingBufferRef BufferCacheRuntime::UploadStagingBuffer(size_t size) {
@@ -396,6 +419,7 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     if (dst_buffer == VK_NULL_HANDLE || src_buffer == VK_NULL_HANDLE) {
         return;
     }
+    InvalidateIndexConversions(dst_buffer);
     static constexpr VkMemoryBarrier READ_BARRIER{
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
         .pNext = nullptr,
@@ -434,6 +458,63 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     });
 }
 
+void BufferCacheRuntime::UploadBuffer(Buffer& buffer, const StagingBufferRef& staging,
+                                      std::span<const VideoCommon::BufferCopy> copies,
+                                      bool can_reorder_upload) {
+    static auto& copy_regions = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_vulkan_buffer_upload_copy_regions_total",
+        "Regions uploaded to cached buffers with transfer copies");
+    static auto& scatter_uploads = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_vulkan_buffer_scatter_uploads_total",
+        "Uploads to cached buffers scattered by a compute pass");
+    static auto& scatter_ranges = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_vulkan_buffer_scatter_ranges_total",
+        "Ranges written by uploads scattered by a compute pass");
+
+    const auto is_word_aligned = [](const VideoCommon::BufferCopy& copy) {
+        return (copy.src_offset | copy.dst_offset | copy.size) % sizeof(u32) == 0;
+    };
+    // Bind only the parts of the buffers the copies touch, the destination one starting at an
+    // offset storage buffers can be bound at
+    const u64 dst_alignment = std::max<u64>(device.GetStorageBufferAlignment(), sizeof(u32));
+    u64 dst_begin = std::numeric_limits<u64>::max();
+    u64 dst_end = 0;
+    u64 src_end = 0;
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        dst_begin = std::min<u64>(dst_begin, copy.dst_offset);
+        dst_end = std::max<u64>(dst_end, copy.dst_offset + copy.size);
+        src_end = std::max<u64>(src_end, copy.src_offset + copy.size);
+    }
+    dst_begin = Common::AlignDown(dst_begin, dst_alignment);
+    const u64 src_size = src_end - staging.offset;
+    const u64 dst_size = dst_end - dst_begin;
+    const u64 max_range = device.GetMaxStorageBufferRange();
+    const bool can_scatter = copies.size() >= MIN_SCATTER_UPLOAD_COPIES &&
+                             src_size <= max_range && dst_size <= max_range &&
+                             std::ranges::all_of(copies, is_word_aligned);
+    if (!can_scatter) {
+        copy_regions.Increment(copies.size());
+        CopyBuffer(buffer, staging.buffer, copies, true, can_reorder_upload);
+        return;
+    }
+    InvalidateIndexConversions(buffer);
+
+    boost::container::small_vector<BufferScatterRange, 256> ranges(copies.size());
+    std::ranges::transform(copies, ranges.begin(), [&](const VideoCommon::BufferCopy& copy) {
+        return BufferScatterRange{
+            .src_offset = static_cast<u32>((copy.src_offset - staging.offset) / sizeof(u32)),
+            .dst_offset = static_cast<u32>((copy.dst_offset - dst_begin) / sizeof(u32)),
+            .size = static_cast<u32>(copy.size / sizeof(u32)),
+        };
+    });
+    const bool use_upload_cmdbuf = staging.buffer == staging_pool.StreamBuf() && can_reorder_upload;
+    buffer_scatter_pass.Scatter(buffer, dst_begin, dst_size, staging.buffer, staging.offset,
+                                src_size, std::span(ranges.data(), ranges.size()),
+                                use_upload_cmdbuf);
+    scatter_uploads.Increment();
+    scatter_ranges.Increment(copies.size());
+}
+
 void BufferCacheRuntime::PreCopyBarrier() {
     static constexpr VkMemoryBarrier READ_BARRIER{
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -466,6 +547,7 @@ void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t si
     if (dest_buffer == VK_NULL_HANDLE) {
         return;
     }
+    InvalidateIndexConversions(dest_buffer);
     static constexpr VkMemoryBarrier READ_BARRIER{
         .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
         .pNext = nullptr,
@@ -498,12 +580,12 @@ void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
         vk_index_type = VK_INDEX_TYPE_UINT32;
         std::tie(vk_buffer, vk_offset) =
-            quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
-                                     topology == PrimitiveTopology::QuadStrip);
+            ConvertIndexBuffer(topology, index_format, base_vertex, num_indices, buffer, offset);
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
-            std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            std::tie(vk_buffer, vk_offset) = ConvertIndexBuffer(topology, index_format, base_vertex,
+                                                                num_indices, buffer, offset);
         }
     }
     if (vk_buffer == VK_NULL_HANDLE) {
@@ -534,6 +616,59 @@ void BufferCacheRuntime::BindQuadIndexBuffer(PrimitiveTopology topology, u32 fir
     }
 }
 
+void BufferCacheRuntime::InvalidateIndexConversions(VkBuffer buffer) {
+    if (index_conversions.empty()) {
+        return;
+    }
+    std::erase_if(index_conversions, [buffer](const IndexConversion& conversion) {
+        return conversion.src_buffer == buffer;
+    });
+}
+
+std::pair<VkBuffer, VkDeviceSize> BufferCacheRuntime::ConvertIndexBuffer(
+    PrimitiveTopology topology, IndexFormat index_format, u32 base_vertex, u32 num_indices,
+    VkBuffer buffer, u32 offset) {
+    static auto& reused_conversions = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_vulkan_index_conversions_reused_total",
+        "Draws that reused indices converted earlier in the same submission");
+    if (index_conversions_tick != scheduler.CurrentTick()) {
+        // Converted indices live in staging buffers that are only reserved for one submission
+        index_conversions.clear();
+        index_conversions_tick = scheduler.CurrentTick();
+    }
+    const auto it = std::ranges::find_if(index_conversions, [&](const IndexConversion& conversion) {
+        return conversion.topology == topology && conversion.index_format == index_format &&
+               conversion.base_vertex == base_vertex && conversion.num_indices == num_indices &&
+               conversion.src_buffer == buffer && conversion.src_offset == offset;
+    });
+    if (it != index_conversions.end()) {
+        // Reusing the conversion also keeps the current render pass open
+        reused_conversions.Increment();
+        return {it->buffer, it->offset};
+    }
+    std::pair<VkBuffer, VkDeviceSize> result;
+    if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
+        result = quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
+                                          topology == PrimitiveTopology::QuadStrip);
+    } else {
+        result = uint8_pass->Assemble(num_indices, buffer, offset);
+    }
+    if (index_conversions.size() >= MAX_INDEX_CONVERSIONS) {
+        index_conversions.clear();
+    }
+    index_conversions.push_back({
+        .topology = topology,
+        .index_format = index_format,
+        .base_vertex = base_vertex,
+        .num_indices = num_indices,
+        .src_buffer = buffer,
+        .src_offset = offset,
+        .buffer = result.first,
+        .offset = result.second,
+    });
+    return result;
+}
+
 void BufferCacheRuntime::BindVertexBuffer(u32 index, VkBuffer buffer, u32 offset, u32 size,
                                           u32 stride) {
     if (index >= device.GetMaxVertexInputBindings()) {
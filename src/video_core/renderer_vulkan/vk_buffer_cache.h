@@ -93,6 +93,10 @@ public:
 
     u32 GetStorageBufferAlignment() const;
 
+    u32 GetUniformBufferSkipCacheSize() const noexcept {
+        return uniform_buffer_skip_cache_size;
+    }
+
     [[nodiscard]] StagingBufferRef UploadStagingBuffer(size_t size);
 
     [[nodiscard]] StagingBufferRef DownloadStagingBuffer(size_t size, bool deferred = false);
@@ -107,6 +111,11 @@ public:
                     std::span<const VideoCommon::BufferCopy> copies, bool barrier,
                     bool can_reorder_upload = false);
 
+    /// Uploads the copies from a staging buffer to a cached buffer, scattering them with a compute
+    /// pass when there are too many small ones for a transfer to handle efficiently
+    void UploadBuffer(Buffer& buffer, const StagingBufferRef& staging,
+                      std::span<const VideoCommon::BufferCopy> copies, bool can_reorder_upload);
+
     void PostCopyBarrier();
 
     void ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value);
@@ -116,6 +125,9 @@ public:
 
     void BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count);
 
+    /// Forgets the index conversions made from a buffer that is about to be written
+    void InvalidateIndexConversions(VkBuffer buffer);
+
     void BindVertexBuffer(u32 index, VkBuffer buffer, u32 offset, u32 size, u32 stride);
 
     void BindVertexBuffers(VideoCommon::HostBindings<Buffer>& bindings);
@@ -146,10 +158,27 @@ public:
     }
 
 private:
+    /// Index buffer converted by a compute pass, valid while its source buffer is not written
+    struct IndexConversion {
+        PrimitiveTopology topology;
+        IndexFormat index_format;
+        u32 base_vertex;
+        u32 num_indices;
+        VkBuffer src_buffer;
+        u32 src_offset;
+        VkBuffer buffer;
+        VkDeviceSize offset;
+    };
+
     void BindBuffer(VkBuffer buffer, u32 offset, u32 size) {
         guest_descriptor_queue.AddBuffer(buffer, offset, size);
     }
 
+    std::pair<VkBuffer, VkDeviceSize> ConvertIndexBuffer(PrimitiveTopology topology,
+                                                         IndexFormat index_format, u32 base_vertex,
+                                                         u32 num_indices, VkBuffer buffer,
+                                                         u32 offset);
+
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
@@ -164,8 +193,14 @@ private:
 
     vk::Buffer null_buffer;
 
+    u32 uniform_buffer_skip_cache_size = VideoCommon::DEFAULT_SKIP_CACHE_SIZE;
+
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
+    BufferScatterPass buffer_scatter_pass;
+
+    std::vector<IndexConversion> index_conversions;
+    u64 index_conversions_tick = 0;
 };
 
 struct BufferCacheParams {
@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -9,9 +11,11 @@
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/settings.h"
 #include "common/vector_math.h"
 #include "video_core/host_shaders/astc_decoder_comp_spv.h"
 #include "video_core/host_shaders/convert_msaa_to_non_msaa_comp_spv.h"
@@ -19,6 +23,9 @@
 #include "video_core/host_shaders/queries_prefix_scan_sum_comp_spv.h"
 #include "video_core/host_shaders/queries_prefix_scan_sum_nosubgroups_comp_spv.h"
 #include "video_core/host_shaders/resolve_conditional_render_comp_spv.h"
+#include "video_core/host_shaders/vulkan_bcn_encoder_comp_spv.h"
+#include "video_core/host_shaders/vulkan_buffer_scatter_comp_spv.h"
+#include "video_core/host_shaders/vulkan_dma_swizzle_comp_spv.h"
 #include "video_core/host_shaders/vulkan_quad_indexed_comp_spv.h"
 #include "video_core/host_shaders/vulkan_uint8_comp_spv.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
@@ -40,6 +47,10 @@ constexpr u32 ASTC_BINDING_INPUT_BUFFER = 0;
 constexpr u32 ASTC_BINDING_OUTPUT_IMAGE = 1;
 constexpr size_t ASTC_NUM_BINDINGS = 2;
 
+constexpr u32 BCN_ENCODER_BINDING_INPUT_IMAGE = 0;
+constexpr u32 BCN_ENCODER_BINDING_OUTPUT_BUFFER = 1;
+constexpr size_t BCN_ENCODER_NUM_BINDINGS = 2;
+
 template <size_t size>
 inline constexpr VkPushConstantRange COMPUTE_PUSH_CONSTANT_RANGE{
     .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
@@ -135,6 +146,34 @@ constexpr DescriptorBankInfo ASTC_BANK_INFO{
     .score = 2,
 };
 
+constexpr std::array<VkDescriptorSetLayoutBinding, BCN_ENCODER_NUM_BINDINGS>
+    BCN_ENCODER_DESCRIPTOR_SET_BINDINGS{{
+        {
+            .binding = BCN_ENCODER_BINDING_INPUT_IMAGE,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .pImmutableSamplers = nullptr,
+        },
+        {
+            .binding = BCN_ENCODER_BINDING_OUTPUT_BUFFER,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .pImmutableSamplers = nullptr,
+        },
+    }};
+
+constexpr DescriptorBankInfo BCN_ENCODER_BANK_INFO{
+    .uniform_buffers = 0,
+    .storage_buffers = 1,
+    .texture_buffers = 0,
+    .image_buffers = 0,
+    .textures = 0,
+    .images = 1,
+    .score = 2,
+};
+
 constexpr std::array<VkDescriptorSetLayoutBinding, ASTC_NUM_BINDINGS> MSAA_DESCRIPTOR_SET_BINDINGS{{
     {
         .binding = 0,
@@ -209,6 +248,26 @@ constexpr std::array<VkDescriptorUpdateTemplateEntry, ASTC_NUM_BINDINGS>
         },
     }};
 
+constexpr std::array<VkDescriptorUpdateTemplateEntry, BCN_ENCODER_NUM_BINDINGS>
+    BCN_ENCODER_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY{{
+        {
+            .dstBinding = BCN_ENCODER_BINDING_INPUT_IMAGE,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .offset = BCN_ENCODER_BINDING_INPUT_IMAGE * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+        {
+            .dstBinding = BCN_ENCODER_BINDING_OUTPUT_BUFFER,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .offset = BCN_ENCODER_BINDING_OUTPUT_BUFFER * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+    }};
+
 struct AstcPushConstants {
     std::array<u32, 2> blocks_dims;
     u32 layer_stride;
@@ -216,6 +275,14 @@ struct AstcPushConstants {
     u32 x_shift;
     u32 block_height;
     u32 block_height_mask;
+    u32 block_depth;
+    u32 block_depth_mask;
+};
+
+struct BCnEncoderPushConstants {
+    std::array<u32, 2> size;
+    u32 output_offset;
+    u32 is_bc3;
 };
 
 struct QueriesPrefixScanPushConstants {
@@ -224,6 +291,42 @@ struct QueriesPrefixScanPushConstants {
     u32 accumulation_limit;
     u32 buffer_offset;
 };
+
+struct DmaSwizzlePushConstants {
+    u32 block_linear_offset;
+    u32 pitch_linear_offset;
+    u32 pitch;
+    u32 origin_x;
+    u32 origin_y;
+    u32 extent_x;
+    u32 extent_y;
+    u32 block_size;
+    u32 x_shift;
+    u32 block_height;
+    u32 is_swizzle;
+};
+/// Barrier of the whole temporary image ASTC textures are decoded to, leaving it in general layout
+VkImageMemoryBarrier DecodedImageBarrier(VkImage image, VkAccessFlags src_access,
+                                         VkAccessFlags dst_access, VkImageLayout old_layout) {
+    return VkImageMemoryBarrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = src_access,
+        .dstAccessMask = dst_access,
+        .oldLayout = old_layout,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = VK_REMAINING_MIP_LEVELS,
+            .baseArrayLayer = 0,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        },
+    };
+}
 } // Anonymous namespace
 
 ComputePass::ComputePass(const Device& device_, DescriptorPool& descriptor_pool,
@@ -405,6 +508,78 @@ std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
     return {staging.buffer, staging.offset};
 }
 
+BufferScatterPass::BufferScatterPass(const Device& device_, Scheduler& scheduler_,
+                                     DescriptorPool& descriptor_pool_,
+                                     StagingBufferPool& staging_buffer_pool_,
+                                     ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, QUERIES_SCAN_DESCRIPTOR_SET_BINDINGS,
+                  QUERIES_SCAN_DESCRIPTOR_UPDATE_TEMPLATE, QUERIES_SCAN_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(u32)>, VULKAN_BUFFER_SCATTER_COMP_SPV),
+      scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BufferScatterPass::~BufferScatterPass() = default;
+
+void BufferScatterPass::Scatter(VkBuffer dst_buffer, VkDeviceSize dst_offset,
+                                VkDeviceSize dst_size, VkBuffer src_buffer,
+                                VkDeviceSize src_offset, VkDeviceSize src_size,
+                                std::span<const BufferScatterRange> ranges,
+                                bool use_upload_cmdbuf) {
+    // Every implementation supports at least this many workgroups in a dimension
+    static constexpr u32 MAX_RANGES_PER_DISPATCH = 65535;
+    static constexpr VkMemoryBarrier READ_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+    };
+    static constexpr VkMemoryBarrier WRITE_BARRIER{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+    };
+    const size_t table_size = ranges.size_bytes();
+    const StagingBufferRef table = staging_buffer_pool.Request(table_size, MemoryUsage::Upload);
+    std::memcpy(table.mapped_span.data(), ranges.data(), table_size);
+
+    compute_pass_descriptor_queue.Acquire();
+    compute_pass_descriptor_queue.AddBuffer(table.buffer, table.offset, table_size);
+    compute_pass_descriptor_queue.AddBuffer(src_buffer, src_offset, src_size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, dst_size);
+    const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+    const u32 num_ranges = static_cast<u32>(ranges.size());
+    const auto record = [this, descriptor_data, num_ranges](vk::CommandBuffer cmdbuf,
+                                                           bool barrier) {
+        const VkDescriptorSet set = descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+        if (barrier) {
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, READ_BARRIER);
+        }
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        for (u32 base_range = 0; base_range < num_ranges;
+             base_range += MAX_RANGES_PER_DISPATCH) {
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, base_range);
+            cmdbuf.Dispatch(std::min(num_ranges - base_range, MAX_RANGES_PER_DISPATCH), 1, 1);
+        }
+        // The scheduler only makes transfers of the upload command buffer visible
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
+    };
+    if (use_upload_cmdbuf) {
+        scheduler.RecordWithUploadBuffer(
+            [record](vk::CommandBuffer, vk::CommandBuffer upload_cmdbuf) {
+                record(upload_cmdbuf, false);
+            });
+        return;
+    }
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([record](vk::CommandBuffer cmdbuf) { record(cmdbuf, true); });
+}
+
 ConditionalRenderingResolvePass::ConditionalRenderingResolvePass(
     const Device& device_, Scheduler& scheduler_, DescriptorPool& descriptor_pool_,
     ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
@@ -522,6 +697,154 @@ void QueriesPrefixScanPass::Run(VkBuffer accumulation_buffer, VkBuffer dst_buffe
     }
 }
 
+DmaSwizzlePass::DmaSwizzlePass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, INPUT_OUTPUT_DESCRIPTOR_SET_BINDINGS,
+                  INPUT_OUTPUT_DESCRIPTOR_UPDATE_TEMPLATE, INPUT_OUTPUT_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(DmaSwizzlePushConstants)>,
+                  VULKAN_DMA_SWIZZLE_COMP_SPV),
+      scheduler{scheduler_}, compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+void DmaSwizzlePass::Copy(const DmaSwizzleCopy& copy) {
+    using namespace Tegra::Texture;
+    static constexpr u32 UNIT_SIZE = 16;
+    static constexpr u32 DISPATCH_SIZE = 8;
+
+    // Bind from the aligned offsets below the operands, the shader skips the rest
+    const size_t alignment = std::max<size_t>(device.GetStorageBufferAlignment(), UNIT_SIZE);
+    compute_pass_descriptor_queue.Acquire();
+    const auto add_buffer = [&](VkBuffer buffer, u32 offset, u32 size) {
+        const u32 aligned_offset = Common::AlignDown(offset, alignment);
+        compute_pass_descriptor_queue.AddBuffer(buffer, aligned_offset,
+                                                size + offset - aligned_offset);
+        return (offset - aligned_offset) / UNIT_SIZE;
+    };
+    const u32 stride = Common::AlignUpLog2(copy.width, GOB_SIZE_X_SHIFT);
+    const u32 gobs_in_x = Common::DivCeilLog2(stride, GOB_SIZE_X_SHIFT);
+    const u32 x_shift = GOB_SIZE_SHIFT + copy.block_height + copy.block_depth;
+    const DmaSwizzlePushConstants uniforms{
+        .block_linear_offset = add_buffer(copy.block_linear_buffer, copy.block_linear_offset,
+                                          copy.block_linear_size),
+        .pitch_linear_offset = add_buffer(copy.pitch_linear_buffer, copy.pitch_linear_offset,
+                                          copy.pitch_linear_size),
+        .pitch = copy.pitch / UNIT_SIZE,
+        .origin_x = copy.origin_x,
+        .origin_y = copy.origin_y,
+        .extent_x = copy.extent_x / UNIT_SIZE,
+        .extent_y = copy.extent_y,
+        .block_size = gobs_in_x << x_shift,
+        .x_shift = x_shift,
+        .block_height = copy.block_height,
+        .is_swizzle = copy.is_swizzle ? 1U : 0U,
+    };
+    const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([this, descriptor_data, uniforms](vk::CommandBuffer cmdbuf) {
+        static constexpr VkMemoryBarrier READ_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        };
+        static constexpr VkMemoryBarrier WRITE_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                             VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT |
+                             VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                             VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+        };
+        const VkDescriptorSet set = descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, READ_BARRIER);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+        cmdbuf.Dispatch(Common::DivCeil(uniforms.extent_x, DISPATCH_SIZE),
+                        Common::DivCeil(uniforms.extent_y, DISPATCH_SIZE), 1);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
+    });
+}
+
+BCnEncoderPass::BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, BCN_ENCODER_DESCRIPTOR_SET_BINDINGS,
+                  BCN_ENCODER_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, BCN_ENCODER_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BCnEncoderPushConstants)>,
+                  VULKAN_BCN_ENCODER_COMP_SPV),
+      scheduler{scheduler_}, compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BCnEncoderPass::~BCnEncoderPass() = default;
+
+boost::container::small_vector<VideoCommon::BufferImageCopy, 16> BCnEncoderPass::Encode(
+    const VideoCommon::ImageInfo& info, std::span<const VkImageView> level_views,
+    VkBuffer dst_buffer, VkDeviceSize dst_offset, VkDeviceSize dst_size, bool is_bc3) {
+    const u32 block_size = is_bc3 ? 16 : 8;
+    const bool is_3d = info.type == VideoCommon::ImageType::e3D;
+    boost::container::small_vector<VideoCommon::BufferImageCopy, 16> copies;
+    size_t output_offset = 0;
+
+    const VkPipeline vk_pipeline = *pipeline;
+    scheduler.Record([vk_pipeline](vk::CommandBuffer cmdbuf) {
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
+    });
+    for (s32 level = 0; level < info.resources.levels; ++level) {
+        const u32 width = std::max(info.size.width >> level, 1U);
+        const u32 height = std::max(info.size.height >> level, 1U);
+        const u32 num_blocks_x = Common::DivCeil(width, 4U);
+        const u32 num_blocks_y = Common::DivCeil(height, 4U);
+        // Slices of 3D images are encoded from the layers of the decoded image
+        const u32 depth = is_3d ? std::max(info.size.depth >> level, 1U) : 1U;
+        const u32 num_layers = is_3d ? depth : static_cast<u32>(info.resources.layers);
+        const size_t level_size =
+            static_cast<size_t>(num_blocks_x) * num_blocks_y * num_layers * block_size;
+        ASSERT(output_offset + level_size <= dst_size);
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddImage(level_views[level]);
+        compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, dst_size);
+        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+        const BCnEncoderPushConstants uniforms{
+            .size = {width, height},
+            .output_offset = static_cast<u32>(output_offset / sizeof(u32)),
+            .is_bc3 = is_bc3 ? 1U : 0U,
+        };
+        const u32 num_dispatches_x = Common::DivCeil(num_blocks_x, 8U);
+        const u32 num_dispatches_y = Common::DivCeil(num_blocks_y, 8U);
+        scheduler.Record([this, uniforms, num_dispatches_x, num_dispatches_y, num_layers,
+                          descriptor_data](vk::CommandBuffer cmdbuf) {
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+            cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, num_layers);
+        });
+        copies.push_back(VideoCommon::BufferImageCopy{
+            .buffer_offset = output_offset,
+            .buffer_size = level_size,
+            .buffer_row_length = num_blocks_x * 4,
+            .buffer_image_height = num_blocks_y * 4,
+            .image_subresource{
+                .base_level = level,
+                .base_layer = 0,
+                .num_layers = info.resources.layers,
+            },
+            .image_offset{0, 0, 0},
+            .image_extent{width, height, depth},
+        });
+        output_offset += level_size;
+    }
+    return copies;
+}
+
 ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                                  DescriptorPool& descriptor_pool_,
                                  StagingBufferPool& staging_buffer_pool_,
@@ -531,25 +854,27 @@ ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                   ASTC_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, ASTC_BANK_INFO,
                   COMPUTE_PUSH_CONSTANT_RANGE<sizeof(AstcPushConstants)>, ASTC_DECODER_COMP_SPV),
       scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
-      compute_pass_descriptor_queue{compute_pass_descriptor_queue_}, memory_allocator{
-                                                                         memory_allocator_} {}
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_},
+      memory_allocator{memory_allocator_}, bcn_encoder_pass(device_, scheduler_, descriptor_pool_,
+                                                            compute_pass_descriptor_queue_) {}
 
 ASTCDecoderPass::~ASTCDecoderPass() = default;
 
 void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
                                std::span<const VideoCommon::SwizzleParameters> swizzles) {
-    using namespace VideoCommon::Accelerated;
-    const std::array<u32, 2> block_dims{
-        VideoCore::Surface::DefaultBlockWidth(image.info.format),
-        VideoCore::Surface::DefaultBlockHeight(image.info.format),
-    };
+    if (True(image.flags & VideoCommon::ImageFlagBits::Recompressed)) {
+        AssembleRecompressed(image, map, swizzles);
+        return;
+    }
+    if (image.info.type == VideoCommon::ImageType::e3D) {
+        AssembleVolume(image, map, swizzles);
+        return;
+    }
     scheduler.RequestOutsideRenderPassOperationContext();
-    const VkPipeline vk_pipeline = *pipeline;
     const VkImageAspectFlags aspect_mask = image.AspectMask();
     const VkImage vk_image = image.Handle();
     const bool is_initialized = image.ExchangeInitialization();
-    scheduler.Record([vk_pipeline, vk_image, aspect_mask,
-                      is_initialized](vk::CommandBuffer cmdbuf) {
+    scheduler.Record([vk_image, aspect_mask, is_initialized](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
             .pNext = nullptr,
@@ -572,42 +897,12 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         cmdbuf.PipelineBarrier(is_initialized ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
                                               : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, image_barrier);
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
     });
-    for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
-        const size_t input_offset = swizzle.buffer_offset + map.offset;
-        const u32 num_dispatches_x = Common::DivCeil(swizzle.num_tiles.width, 8U);
-        const u32 num_dispatches_y = Common::DivCeil(swizzle.num_tiles.height, 8U);
-        const u32 num_dispatches_z = image.info.resources.layers;
-
-        compute_pass_descriptor_queue.Acquire();
-        compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
-                                                image.guest_size_bytes - swizzle.buffer_offset);
-        compute_pass_descriptor_queue.AddImage(image.StorageImageView(swizzle.level));
-        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
-
-        // To unswizzle the ASTC data
-        const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
-        ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
-        ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
-        ASSERT(params.bytes_per_block_log2 == 4);
-        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, block_dims,
-                          params, descriptor_data](vk::CommandBuffer cmdbuf) {
-            const AstcPushConstants uniforms{
-                .blocks_dims = block_dims,
-                .layer_stride = params.layer_stride,
-                .block_size = params.block_size,
-                .x_shift = params.x_shift,
-                .block_height = params.block_height,
-                .block_height_mask = params.block_height_mask,
-            };
-            const VkDescriptorSet set = descriptor_allocator.Commit();
-            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
-            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
-            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
-            cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, num_dispatches_z);
-        });
+    boost::container::small_vector<VkImageView, 16> level_views;
+    for (s32 level = 0; level < image.info.resources.levels; ++level) {
+        level_views.push_back(image.StorageImageView(level));
     }
+    RecordDecode(image, map, swizzles, level_views);
     scheduler.Record([vk_image, aspect_mask](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
@@ -633,6 +928,265 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
     scheduler.Finish();
 }
 
+void ASTCDecoderPass::AssembleRecompressed(
+    Image& image, const StagingBufferRef& map,
+    std::span<const VideoCommon::SwizzleParameters> swizzles) {
+    const VideoCommon::ImageInfo& info = image.info;
+    const DecodedImage decoded = CreateDecodedImage(info);
+    boost::container::small_vector<VkImageView, 16> level_views;
+    for (const vk::ImageView& view : decoded.level_views) {
+        level_views.push_back(*view);
+    }
+    const bool is_bc3 =
+        Settings::values.astc_recompression.GetValue() == Settings::AstcRecompression::Bc3;
+    const StagingBufferRef encoded =
+        staging_buffer_pool.Request(image.converted_size_bytes, MemoryUsage::DeviceLocal);
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const VkImage vk_decoded_image = *decoded.image;
+    scheduler.Record([vk_decoded_image](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                               DecodedImageBarrier(vk_decoded_image, VK_ACCESS_NONE,
+                                                   VK_ACCESS_SHADER_WRITE_BIT,
+                                                   VK_IMAGE_LAYOUT_UNDEFINED));
+    });
+    RecordDecode(image, map, swizzles, level_views);
+    scheduler.Record([vk_decoded_image](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                               DecodedImageBarrier(vk_decoded_image, VK_ACCESS_SHADER_WRITE_BIT,
+                                                   VK_ACCESS_SHADER_READ_BIT,
+                                                   VK_IMAGE_LAYOUT_GENERAL));
+    });
+    const auto copies = bcn_encoder_pass.Encode(info, level_views, encoded.buffer, encoded.offset,
+                                                image.converted_size_bytes, is_bc3);
+    scheduler.Record([](vk::CommandBuffer cmdbuf) {
+        static constexpr VkMemoryBarrier encoded_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT, 0, encoded_barrier);
+    });
+    image.UploadMemory(encoded.buffer, encoded.offset, copies);
+    // The decoded image is destroyed when this function returns, wait for the GPU to be done
+    scheduler.Finish();
+}
+
+void ASTCDecoderPass::AssembleVolume(Image& image, const StagingBufferRef& map,
+                                     std::span<const VideoCommon::SwizzleParameters> swizzles) {
+    const VideoCommon::ImageInfo& info = image.info;
+    const DecodedImage decoded = CreateDecodedImage(info);
+    boost::container::small_vector<VkImageView, 16> level_views;
+    boost::container::small_vector<VkImageCopy, 16> copies;
+    for (s32 level = 0; level < info.resources.levels; ++level) {
+        level_views.push_back(*decoded.level_views[level]);
+        const VideoCommon::Extent3D size{
+            .width = std::max(info.size.width >> level, 1U),
+            .height = std::max(info.size.height >> level, 1U),
+            .depth = std::max(info.size.depth >> level, 1U),
+        };
+        copies.push_back(VkImageCopy{
+            .srcSubresource{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .mipLevel = static_cast<u32>(level),
+                .baseArrayLayer = 0,
+                .layerCount = size.depth,
+            },
+            .srcOffset{0, 0, 0},
+            .dstSubresource{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .mipLevel = static_cast<u32>(level),
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+            .dstOffset{0, 0, 0},
+            .extent{size.width, size.height, size.depth},
+        });
+    }
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const VkImage vk_decoded_image = *decoded.image;
+    scheduler.Record([vk_decoded_image](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                               DecodedImageBarrier(vk_decoded_image, VK_ACCESS_NONE,
+                                                   VK_ACCESS_SHADER_WRITE_BIT,
+                                                   VK_IMAGE_LAYOUT_UNDEFINED));
+    });
+    RecordDecode(image, map, swizzles, level_views);
+
+    // The layers of the decoded image are copied to the slices of the 3D image
+    const VkImage vk_image = image.Handle();
+    const bool is_initialized = image.ExchangeInitialization();
+    scheduler.Record([vk_decoded_image, vk_image, is_initialized,
+                      copies](vk::CommandBuffer cmdbuf) {
+        const VkImageSubresourceRange range{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = VK_REMAINING_MIP_LEVELS,
+            .baseArrayLayer = 0,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        };
+        const std::array pre_barriers{
+            DecodedImageBarrier(vk_decoded_image, VK_ACCESS_SHADER_WRITE_BIT,
+                                VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL),
+            VkImageMemoryBarrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = static_cast<VkAccessFlags>(
+                    is_initialized ? VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT
+                                   : VK_ACCESS_NONE),
+                .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = vk_image,
+                .subresourceRange = range,
+            },
+        };
+        const VkImageMemoryBarrier post_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, {}, {}, pre_barriers);
+        cmdbuf.CopyImage(vk_decoded_image, VK_IMAGE_LAYOUT_GENERAL, vk_image,
+                         VK_IMAGE_LAYOUT_GENERAL, copies);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, post_barrier);
+    });
+    // The decoded image is destroyed when this function returns, wait for the GPU to be done
+    scheduler.Finish();
+}
+
+ASTCDecoderPass::DecodedImage ASTCDecoderPass::CreateDecodedImage(
+    const VideoCommon::ImageInfo& info) {
+    // Slices of 3D images are decoded to the layers of a 2D array, as storage views of them are
+    // not widely supported
+    const u32 num_layers = info.type == VideoCommon::ImageType::e3D
+                               ? info.size.depth
+                               : static_cast<u32>(info.resources.layers);
+    DecodedImage decoded;
+    decoded.image = memory_allocator.CreateImage(VkImageCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = VK_FORMAT_A8B8G8R8_UNORM_PACK32,
+        .extent{
+            .width = info.size.width,
+            .height = info.size.height,
+            .depth = 1,
+        },
+        .mipLevels = static_cast<u32>(info.resources.levels),
+        .arrayLayers = num_layers,
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+    });
+    for (s32 level = 0; level < info.resources.levels; ++level) {
+        decoded.level_views.push_back(device.GetLogical().CreateImageView(VkImageViewCreateInfo{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .image = *decoded.image,
+            .viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+            .format = VK_FORMAT_A8B8G8R8_UNORM_PACK32,
+            .components{
+                .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+            },
+            .subresourceRange{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = static_cast<u32>(level),
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        }));
+    }
+    return decoded;
+}
+
+void ASTCDecoderPass::RecordDecode(const Image& image, const StagingBufferRef& map,
+                                   std::span<const VideoCommon::SwizzleParameters> swizzles,
+                                   std::span<const VkImageView> level_views) {
+    using namespace VideoCommon::Accelerated;
+    const std::array<u32, 2> block_dims{
+        VideoCore::Surface::DefaultBlockWidth(image.info.format),
+        VideoCore::Surface::DefaultBlockHeight(image.info.format),
+    };
+    const bool is_3d = image.info.type == VideoCommon::ImageType::e3D;
+    const VkPipeline vk_pipeline = *pipeline;
+    scheduler.Record([vk_pipeline](vk::CommandBuffer cmdbuf) {
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
+    });
+    for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
+        const size_t input_offset = swizzle.buffer_offset + map.offset;
+        const u32 num_dispatches_x = Common::DivCeil(swizzle.num_tiles.width, 8U);
+        const u32 num_dispatches_y = Common::DivCeil(swizzle.num_tiles.height, 8U);
+        const u32 num_dispatches_z =
+            is_3d ? swizzle.num_tiles.depth : static_cast<u32>(image.info.resources.layers);
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
+                                                image.guest_size_bytes - swizzle.buffer_offset);
+        compute_pass_descriptor_queue.AddImage(level_views[swizzle.level]);
+        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+        // To unswizzle the ASTC data, slices of 3D images are offset like layers of blocks
+        AstcPushConstants uniforms{.blocks_dims = block_dims};
+        if (is_3d) {
+            const auto params = MakeBlockLinearSwizzle3DParams(swizzle, image.info);
+            ASSERT(params.bytes_per_block_log2 == 4);
+            uniforms.layer_stride = params.slice_size;
+            uniforms.block_size = params.block_size;
+            uniforms.x_shift = params.x_shift;
+            uniforms.block_height = params.block_height;
+            uniforms.block_height_mask = params.block_height_mask;
+            uniforms.block_depth = params.block_depth;
+            uniforms.block_depth_mask = params.block_depth_mask;
+        } else {
+            const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
+            ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
+            ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
+            ASSERT(params.bytes_per_block_log2 == 4);
+            uniforms.layer_stride = params.layer_stride;
+            uniforms.block_size = params.block_size;
+            uniforms.x_shift = params.x_shift;
+            uniforms.block_height = params.block_height;
+            uniforms.block_height_mask = params.block_height_mask;
+        }
+        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, uniforms,
+                          descriptor_data](vk::CommandBuffer cmdbuf) {
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+            cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, num_dispatches_z);
+        });
+    }
+}
+
 MSAACopyPass::MSAACopyPass(const Device& device_, Scheduler& scheduler_,
                            DescriptorPool& descriptor_pool_,
                            StagingBufferPool& staging_buffer_pool_,
@@ -7,6 +7,8 @@
 #include <span>
 #include <utility>
 
+#include <boost/container/small_vector.hpp>
+
 #include "common/common_types.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
@@ -16,8 +18,9 @@
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
+struct ImageInfo;
 struct SwizzleParameters;
-}
+} // namespace VideoCommon
 
 namespace Vulkan {
 
@@ -85,6 +88,35 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+/// Range copied by a scatter upload, offsets and size are in words
+struct BufferScatterRange {
+    u32 src_offset;
+    u32 dst_offset;
+    u32 size;
+};
+
+/// Copies many small ranges between two buffers with a single dispatch, instead of a transfer
+/// with as many regions
+class BufferScatterPass final : public ComputePass {
+public:
+    explicit BufferScatterPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               StagingBufferPool& staging_buffer_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BufferScatterPass();
+
+    /// Copies the ranges, relative to the bound parts of the buffers, in the upload command buffer
+    /// when the destination ranges are not in use by the commands recorded so far
+    void Scatter(VkBuffer dst_buffer, VkDeviceSize dst_offset, VkDeviceSize dst_size,
+                 VkBuffer src_buffer, VkDeviceSize src_offset, VkDeviceSize src_size,
+                 std::span<const BufferScatterRange> ranges, bool use_upload_cmdbuf);
+
+private:
+    Scheduler& scheduler;
+    StagingBufferPool& staging_buffer_pool;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class ConditionalRenderingResolvePass final : public ComputePass {
 public:
     explicit ConditionalRenderingResolvePass(
@@ -112,6 +144,60 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+/// Rectangle copied by the DMA engine between a block linear and a pitch linear buffer
+struct DmaSwizzleCopy {
+    VkBuffer block_linear_buffer;
+    u32 block_linear_offset;
+    u32 block_linear_size;
+    VkBuffer pitch_linear_buffer;
+    u32 pitch_linear_offset;
+    u32 pitch_linear_size;
+    u32 pitch;
+    /// Origin and size of the rectangle, x in bytes
+    u32 origin_x;
+    u32 origin_y;
+    u32 extent_x;
+    u32 extent_y;
+    /// Width in bytes and block dimensions of the block linear operand
+    u32 width;
+    u32 block_height;
+    u32 block_depth;
+    /// Copies from the pitch linear to the block linear buffer when true
+    bool is_swizzle;
+};
+
+class DmaSwizzlePass final : public ComputePass {
+public:
+    explicit DmaSwizzlePass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+
+    /// Copies the rectangle, its offsets, origin x, extent x and pitch must be multiples of 16
+    void Copy(const DmaSwizzleCopy& copy);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
+class BCnEncoderPass final : public ComputePass {
+public:
+    explicit BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnEncoderPass();
+
+    /// Records the dispatches encoding the RGBA8 levels of an image into BC1 or BC3 blocks
+    /// Returns the copies that upload the encoded blocks from dst_buffer to the encoded image
+    boost::container::small_vector<VideoCommon::BufferImageCopy, 16> Encode(
+        const VideoCommon::ImageInfo& info, std::span<const VkImageView> level_views,
+        VkBuffer dst_buffer, VkDeviceSize dst_offset, VkDeviceSize dst_size, bool is_bc3);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class ASTCDecoderPass final : public ComputePass {
 public:
     explicit ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -125,10 +211,32 @@ public:
                   std::span<const VideoCommon::SwizzleParameters> swizzles);
 
 private:
+    /// Decodes into a temporary RGBA8 image and recompresses it to the BCn format of the image
+    void AssembleRecompressed(Image& image, const StagingBufferRef& map,
+                              std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+    /// Decodes a 3D image into a temporary image and copies its layers to the slices of the image
+    void AssembleVolume(Image& image, const StagingBufferRef& map,
+                        std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+    struct DecodedImage {
+        vk::Image image;
+        boost::container::small_vector<vk::ImageView, 16> level_views;
+    };
+
+    /// Creates a temporary RGBA8 image to decode to, with a layer for each slice of 3D images
+    DecodedImage CreateDecodedImage(const VideoCommon::ImageInfo& info);
+
+    /// Records the dispatches decoding the ASTC data in map into the storage views of each level
+    void RecordDecode(const Image& image, const StagingBufferRef& map,
+                      std::span<const VideoCommon::SwizzleParameters> swizzles,
+                      std::span<const VkImageView> level_views);
+
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
     MemoryAllocator& memory_allocator;
+    BCnEncoderPass bcn_encoder_pass;
 };
 
 class MSAACopyPass final : public ComputePass {
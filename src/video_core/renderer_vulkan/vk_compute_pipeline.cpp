@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
+#include <span>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -24,15 +26,24 @@ using Shader::ImageBufferDescriptor;
 using Shader::Backend::SPIRV::RESCALING_LAYOUT_WORDS_OFFSET;
 using Tegra::Texture::TexturePair;
 
+namespace {
+bool IsSameEntry(const DescriptorUpdateEntry& lhs, const DescriptorUpdateEntry& rhs) {
+    // Only the active member of the union is written, stale bytes can only cause a mismatch
+    return std::memcmp(&lhs, &rhs, sizeof(DescriptorUpdateEntry)) == 0;
+}
+} // Anonymous namespace
+
 ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipeline_cache_,
                                  DescriptorPool& descriptor_pool,
+                                 DescriptorBuffer& descriptor_buffer_,
                                  GuestDescriptorQueue& guest_descriptor_queue_,
                                  Common::ThreadWorker* thread_worker,
                                  PipelineStatistics* pipeline_statistics,
                                  VideoCore::ShaderNotify* shader_notify, const Shader::Info& info_,
-                                 vk::ShaderModule spv_module_)
-    : device{device_},
-      pipeline_cache(pipeline_cache_), guest_descriptor_queue{guest_descriptor_queue_}, info{info_},
+                                 vk::ShaderModule spv_module_, u64 unique_hash_,
+                                 std::function<void()> on_built)
+    : device{device_}, pipeline_cache(pipeline_cache_), descriptor_buffer{descriptor_buffer_},
+      guest_descriptor_queue{guest_descriptor_queue_}, info{info_}, unique_hash{unique_hash_},
       spv_module(std::move(spv_module_)) {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
@@ -40,15 +51,27 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
     std::copy_n(info.constant_buffer_used_sizes.begin(), uniform_buffer_sizes.size(),
                 uniform_buffer_sizes.begin());
 
-    auto func{[this, &descriptor_pool, shader_notify, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{device};
-        builder.Add(info, VK_SHADER_STAGE_COMPUTE_BIT);
-
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(false);
+    DescriptorLayoutBuilder builder{device};
+    builder.Add(info, VK_SHADER_STAGE_COMPUTE_BIT);
+    uses_descriptor_buffer = descriptor_buffer.IsEnabled() && builder.CanUseDescriptorBuffer();
+    if (uses_descriptor_buffer) {
+        descriptor_set_layout = builder.CreateDescriptorSetLayout(false, true);
+        if (descriptor_set_layout) {
+            descriptor_buffer_layout =
+                descriptor_buffer.MakeLayout(*descriptor_set_layout, builder.Bindings());
+        }
+    }
+    auto func{[this, builder = std::move(builder), &descriptor_pool, shader_notify,
+               pipeline_statistics, on_built = std::move(on_built)] {
+        if (!uses_descriptor_buffer) {
+            descriptor_set_layout = builder.CreateDescriptorSetLayout(false);
+        }
         pipeline_layout = builder.CreatePipelineLayout(*descriptor_set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(*descriptor_set_layout, *pipeline_layout, false);
-        descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, info);
+        if (!uses_descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(*descriptor_set_layout, *pipeline_layout, false);
+            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, info);
+        }
         const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT subgroup_size_ci{
             .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT,
             .pNext = nullptr,
@@ -58,6 +81,9 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
         if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
             flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
         }
+        if (uses_descriptor_buffer) {
+            flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         pipeline = device.GetLogical().CreateComputePipeline(
             {
                 .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
@@ -82,6 +108,9 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
         if (pipeline_statistics) {
             pipeline_statistics->Collect(*pipeline);
         }
+        if (on_built) {
+            on_built();
+        }
         std::scoped_lock lock{build_mutex};
         is_built = true;
         build_condvar.notify_one();
@@ -90,7 +119,7 @@ ComputePipeline::ComputePipeline(const Device& device_, vk::PipelineCache& pipel
         }
     }};
     if (thread_worker) {
-        thread_worker->QueueWork(std::move(func));
+        thread_worker->QueuePriorityWork(std::move(func));
     } else {
         func();
     }
@@ -197,6 +226,11 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
     PushImageDescriptors(texture_cache, guest_descriptor_queue, info, rescaling, samplers_it,
                          views_it);
 
+    // Reserving descriptor buffer space may flush, do it before anything is recorded
+    VkDeviceSize descriptor_offset{};
+    if (uses_descriptor_buffer && descriptor_set_layout) {
+        descriptor_offset = descriptor_buffer.Allocate(descriptor_buffer_layout.size);
+    }
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
         scheduler.Record([this](vk::CommandBuffer) {
@@ -204,9 +238,38 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
             build_condvar.wait(lock, [this] { return is_built.load(std::memory_order::relaxed); });
         });
     }
-    const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
+    const DescriptorUpdateEntry* const descriptor_data{guest_descriptor_queue.UpdateData()};
     const bool is_rescaling = !info.texture_descriptors.empty() || !info.image_descriptors.empty();
-    scheduler.Record([this, descriptor_data, is_rescaling,
+    if (!uses_descriptor_buffer && descriptor_set_layout) {
+        // Back to back launches of the same kernel usually bind the same resources, reuse the
+        // descriptor set committed for the previous one while it is in the same command buffer
+        const std::span descriptors(descriptor_data, guest_descriptor_queue.UpdateSize());
+        const u64 current_tick{scheduler.CurrentTick()};
+        const bool is_repeated{last_tick == current_tick && last_rescaling == rescaling.Data() &&
+                               std::ranges::equal(last_descriptors, descriptors, IsSameEntry)};
+        if (is_repeated) {
+            scheduler.Record([this, is_rescaling, descriptor_set = last_descriptor_set,
+                              rescaling_data = rescaling.Data()](vk::CommandBuffer cmdbuf) {
+                cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+                if (is_rescaling) {
+                    cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT,
+                                         RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
+                                         rescaling_data.data());
+                }
+                cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
+                                          *descriptor_set, nullptr);
+            });
+            return;
+        }
+        last_descriptors.assign(descriptors.begin(), descriptors.end());
+        last_rescaling = rescaling.Data();
+        last_tick = current_tick;
+        // Several command buffers can be recorded at once, each repeated dispatch reads the set
+        // of the dispatch it repeats instead of a member
+        last_descriptor_set = std::make_shared<VkDescriptorSet>();
+    }
+    scheduler.Record([this, descriptor_data, descriptor_offset, is_rescaling,
+                      committed_set = last_descriptor_set,
                       rescaling_data = rescaling.Data()](vk::CommandBuffer cmdbuf) {
         cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
         if (!descriptor_set_layout) {
@@ -217,11 +280,19 @@ void ComputePipeline::Configure(Tegra::Engines::KeplerCompute& kepler_compute,
                                  RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
                                  rescaling_data.data());
         }
+        if (uses_descriptor_buffer) {
+            descriptor_buffer.Write(descriptor_buffer_layout, descriptor_offset, descriptor_data);
+            const u32 buffer_index = 0;
+            cmdbuf.SetDescriptorBufferOffsetsEXT(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout,
+                                                 0, buffer_index, descriptor_offset);
+            return;
+        }
         const VkDescriptorSet descriptor_set{descriptor_allocator.Commit()};
         const vk::Device& dev{device.GetLogical()};
         dev.UpdateDescriptorSet(descriptor_set, *descriptor_update_template, descriptor_data);
         cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
                                   descriptor_set, nullptr);
+        *committed_set = descriptor_set;
     });
 }
 
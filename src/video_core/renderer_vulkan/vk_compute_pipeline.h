@@ -3,14 +3,20 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
@@ -30,11 +36,13 @@ class ComputePipeline {
 public:
     explicit ComputePipeline(const Device& device, vk::PipelineCache& pipeline_cache,
                              DescriptorPool& descriptor_pool,
+                             DescriptorBuffer& descriptor_buffer,
                              GuestDescriptorQueue& guest_descriptor_queue,
                              Common::ThreadWorker* thread_worker,
                              PipelineStatistics* pipeline_statistics,
                              VideoCore::ShaderNotify* shader_notify, const Shader::Info& info,
-                             vk::ShaderModule spv_module);
+                             vk::ShaderModule spv_module, u64 unique_hash,
+                             std::function<void()> on_built);
 
     ComputePipeline& operator=(ComputePipeline&&) noexcept = delete;
     ComputePipeline(ComputePipeline&&) noexcept = delete;
@@ -45,11 +53,18 @@ public:
     void Configure(Tegra::Engines::KeplerCompute& kepler_compute, Tegra::MemoryManager& gpu_memory,
                    Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache);
 
+    /// Returns the unique hash of the compute shader
+    [[nodiscard]] u64 UniqueHash() const noexcept {
+        return unique_hash;
+    }
+
 private:
     const Device& device;
     vk::PipelineCache& pipeline_cache;
+    DescriptorBuffer& descriptor_buffer;
     GuestDescriptorQueue& guest_descriptor_queue;
     Shader::Info info;
+    u64 unique_hash;
 
     VideoCommon::ComputeUniformBufferSizes uniform_buffer_sizes{};
 
@@ -59,6 +74,15 @@ private:
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
+    DescriptorBufferLayout descriptor_buffer_layout;
+    bool uses_descriptor_buffer{false};
+
+    /// Bindings of the last dispatch, reused when the next one in the same command buffer matches
+    std::vector<DescriptorUpdateEntry> last_descriptors;
+    std::array<u32, Shader::Backend::SPIRV::NUM_TEXTURE_AND_IMAGE_SCALING_WORDS> last_rescaling{};
+    u64 last_tick{};
+    /// Set committed by the last dispatch, written when its command buffer is recorded
+    std::shared_ptr<VkDescriptorSet> last_descriptor_set;
 
     std::condition_variable build_condvar;
     std::mutex build_mutex;
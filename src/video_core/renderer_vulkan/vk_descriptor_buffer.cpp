@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+namespace {
+
+using namespace Common::Literals;
+
+// Descriptor buffer size in bytes, enough for tens of thousands of sets per submission
+constexpr VkDeviceSize MAX_DESCRIPTOR_BUFFER_SIZE = 16_MiB;
+
+constexpr VkBufferUsageFlags DESCRIPTOR_BUFFER_USAGE =
+    VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+    VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+
+u32 DescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties,
+                   VkDescriptorType type) {
+    // Robust buffer access is always enabled, buffers use the robust descriptor sizes
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return static_cast<u32>(properties.robustUniformBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return static_cast<u32>(properties.robustStorageBufferDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return static_cast<u32>(properties.combinedImageSamplerDescriptorSize);
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return static_cast<u32>(properties.storageImageDescriptorSize);
+    default:
+        ASSERT_MSG(false, "Invalid descriptor type={}", type);
+        return 0;
+    }
+}
+} // Anonymous namespace
+
+DescriptorBuffer::DescriptorBuffer(const Device& device_, MemoryAllocator& memory_allocator,
+                                   Scheduler& scheduler_)
+    : device{device_}, scheduler{scheduler_} {
+    if (!device.IsExtDescriptorBufferSupported()) {
+        return;
+    }
+    const auto& properties = device.GetDescriptorBufferProperties();
+    buffer_size = std::min({MAX_DESCRIPTOR_BUFFER_SIZE, properties.maxResourceDescriptorBufferRange,
+                            properties.maxSamplerDescriptorBufferRange,
+                            properties.resourceDescriptorBufferAddressSpaceSize,
+                            properties.samplerDescriptorBufferAddressSpaceSize});
+    region_size = buffer_size / NUM_SYNCS;
+    alignment = properties.descriptorBufferOffsetAlignment;
+
+    buffer = memory_allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = buffer_size,
+            .usage = DESCRIPTOR_BUFFER_USAGE | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Stream);
+    mapped = buffer.Mapped();
+    if (mapped.empty()) {
+        LOG_WARNING(Render_Vulkan, "Descriptor buffer is not host visible, using descriptor sets");
+        buffer = vk::Buffer{};
+        return;
+    }
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Descriptor Buffer");
+    }
+    address = device.GetLogical().GetBufferDeviceAddress(*buffer);
+}
+
+DescriptorBuffer::~DescriptorBuffer() = default;
+
+DescriptorBufferLayout DescriptorBuffer::MakeLayout(
+    VkDescriptorSetLayout layout, std::span<const VkDescriptorSetLayoutBinding> bindings) const {
+    const vk::Device& logical = device.GetLogical();
+    const auto& properties = device.GetDescriptorBufferProperties();
+    DescriptorBufferLayout result;
+    result.size = logical.GetDescriptorSetLayoutSizeEXT(layout);
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        result.bindings.push_back({
+            .offset = logical.GetDescriptorSetLayoutBindingOffsetEXT(layout, binding.binding),
+            .type = binding.descriptorType,
+            .count = binding.descriptorCount,
+            .descriptor_size = DescriptorSize(properties, binding.descriptorType),
+        });
+    }
+    return result;
+}
+
+VkDeviceSize DescriptorBuffer::Allocate(VkDeviceSize size) {
+    VkDeviceSize offset = Common::AlignUp(iterator, alignment);
+    if (offset + size > buffer_size) {
+        offset = 0;
+    }
+    const size_t first_region = Region(offset);
+    const size_t last_region = Region(offset + size - 1);
+    for (size_t region = first_region; region <= last_region; ++region) {
+        if (region != current_region && !scheduler.IsFree(sync_ticks[region])) {
+            // Wait for the GPU to stop reading the sets previously written in this region
+            scheduler.Wait(sync_ticks[region]);
+        }
+    }
+    const u64 current_tick = scheduler.CurrentTick();
+    std::fill(sync_ticks.begin() + first_region, sync_ticks.begin() + last_region + 1,
+              current_tick);
+    current_region = last_region;
+    iterator = offset + size;
+
+    // Waiting may have flushed the command buffer, bind after it
+    if (scheduler.UpdateDescriptorBuffer()) {
+        scheduler.Record([buffer_address = address](vk::CommandBuffer cmdbuf) {
+            const VkDescriptorBufferBindingInfoEXT binding_info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+                .pNext = nullptr,
+                .address = buffer_address,
+                .usage = DESCRIPTOR_BUFFER_USAGE,
+            };
+            cmdbuf.BindDescriptorBuffersEXT(binding_info);
+        });
+    }
+    return offset;
+}
+
+void DescriptorBuffer::Write(const DescriptorBufferLayout& layout, VkDeviceSize offset,
+                             const DescriptorUpdateEntry* entries) const {
+    u8* const set = mapped.data() + offset;
+    for (const DescriptorBufferLayout::Binding& binding : layout.bindings) {
+        u8* destination = set + binding.offset;
+        for (u32 index = 0; index < binding.count; ++index) {
+            WriteDescriptor(binding.type, *(entries++), binding.descriptor_size, destination);
+            destination += binding.descriptor_size;
+        }
+    }
+}
+
+void DescriptorBuffer::WriteDescriptor(VkDescriptorType type, const DescriptorUpdateEntry& entry,
+                                       u32 size, u8* destination) const {
+    const vk::Device& logical = device.GetLogical();
+    VkDescriptorAddressInfoEXT address_info;
+    const VkDescriptorAddressInfoEXT* buffer_info = nullptr;
+    if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER) {
+        // Null buffers are only bound when null descriptors are supported
+        if (entry.buffer.buffer != VK_NULL_HANDLE) {
+            const VkDeviceAddress buffer_address{
+                logical.GetBufferDeviceAddress(entry.buffer.buffer)};
+            address_info = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                .pNext = nullptr,
+                .address = buffer_address + entry.buffer.offset,
+                .range = entry.buffer.range,
+                .format = VK_FORMAT_UNDEFINED,
+            };
+            buffer_info = &address_info;
+        }
+    }
+    VkDescriptorGetInfoEXT get_info{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+        .pNext = nullptr,
+        .type = type,
+        .data{},
+    };
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        get_info.data.pUniformBuffer = buffer_info;
+        break;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        get_info.data.pStorageBuffer = buffer_info;
+        break;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        get_info.data.pCombinedImageSampler = &entry.image;
+        break;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        get_info.data.pStorageImage = &entry.image;
+        break;
+    default:
+        ASSERT_MSG(false, "Invalid descriptor type={}", type);
+        return;
+    }
+    logical.GetDescriptorEXT(get_info, size, destination);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MemoryAllocator;
+class Scheduler;
+
+struct DescriptorUpdateEntry;
+
+/// Placement of the bindings of a descriptor set layout inside a descriptor buffer.
+struct DescriptorBufferLayout {
+    struct Binding {
+        VkDeviceSize offset;   ///< Offset of the first descriptor relative to the set
+        VkDescriptorType type; ///< Type of the descriptors in the binding
+        u32 count;             ///< Number of descriptors in the binding
+        u32 descriptor_size;   ///< Size in bytes of a single descriptor
+    };
+
+    VkDeviceSize size{}; ///< Size in bytes of the whole set
+    boost::container::small_vector<Binding, 32> bindings;
+};
+
+/**
+ * Host visible ring buffer where descriptor sets are written directly with
+ * VK_EXT_descriptor_buffer, instead of being allocated from descriptor pools and updated with
+ * templates. Space is reserved on the GPU thread and descriptors are written when the command
+ * using them is recorded.
+ */
+class DescriptorBuffer {
+public:
+    static constexpr size_t NUM_SYNCS = 16;
+
+    explicit DescriptorBuffer(const Device& device, MemoryAllocator& memory_allocator,
+                              Scheduler& scheduler);
+    ~DescriptorBuffer();
+
+    DescriptorBuffer& operator=(const DescriptorBuffer&) = delete;
+    DescriptorBuffer(const DescriptorBuffer&) = delete;
+
+    /// Returns true when descriptor sets can be written to the descriptor buffer.
+    [[nodiscard]] bool IsEnabled() const noexcept {
+        return static_cast<bool>(buffer);
+    }
+
+    /// Queries where the bindings of a descriptor set layout are placed in the buffer.
+    [[nodiscard]] DescriptorBufferLayout MakeLayout(
+        VkDescriptorSetLayout layout,
+        std::span<const VkDescriptorSetLayoutBinding> bindings) const;
+
+    /// Reserves space for a descriptor set and binds the buffer to the current command buffer
+    /// when needed. Returns the offset of the set in the buffer.
+    [[nodiscard]] VkDeviceSize Allocate(VkDeviceSize size);
+
+    /// Writes the descriptors of a set, entries are laid out as in the descriptor queue.
+    /// This is thread safe as long as different offsets are written.
+    void Write(const DescriptorBufferLayout& layout, VkDeviceSize offset,
+               const DescriptorUpdateEntry* entries) const;
+
+private:
+    void WriteDescriptor(VkDescriptorType type, const DescriptorUpdateEntry& entry, u32 size,
+                         u8* destination) const;
+
+    size_t Region(VkDeviceSize offset) const noexcept {
+        return static_cast<size_t>(offset / region_size);
+    }
+
+    const Device& device;
+    Scheduler& scheduler;
+
+    vk::Buffer buffer;
+    std::span<u8> mapped;
+    VkDeviceAddress address{};
+    VkDeviceSize buffer_size{};
+    VkDeviceSize region_size{};
+    VkDeviceSize alignment{};
+
+    VkDeviceSize iterator{};
+    size_t current_region{};
+    std::array<u64, NUM_SYNCS> sync_ticks{};
+};
+
+} // namespace Vulkan
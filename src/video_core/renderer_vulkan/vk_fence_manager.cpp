@@ -1,8 +1,6 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <memory>
-
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_fence_manager.h"
 #include "video_core/renderer_vulkan/vk_query_cache.h"
@@ -12,34 +10,6 @@
 
 namespace Vulkan {
 
-InnerFence::InnerFence(Scheduler& scheduler_, bool is_stubbed_)
-    : FenceBase{is_stubbed_}, scheduler{scheduler_} {}
-
-InnerFence::~InnerFence() = default;
-
-void InnerFence::Queue() {
-    if (is_stubbed) {
-        return;
-    }
-    // Get the current tick so we can wait for it
-    wait_tick = scheduler.CurrentTick();
-    scheduler.Flush();
-}
-
-bool InnerFence::IsSignaled() const {
-    if (is_stubbed) {
-        return true;
-    }
-    return scheduler.IsFree(wait_tick);
-}
-
-void InnerFence::Wait() {
-    if (is_stubbed) {
-        return;
-    }
-    scheduler.Wait(wait_tick);
-}
-
 FenceManager::FenceManager(VideoCore::RasterizerInterface& rasterizer_, Tegra::GPU& gpu_,
                            TextureCache& texture_cache_, BufferCache& buffer_cache_,
                            QueryCache& query_cache_, const Device& device_, Scheduler& scheduler_)
@@ -47,19 +17,27 @@ FenceManager::FenceManager(VideoCore::RasterizerInterface& rasterizer_, Tegra::G
       scheduler{scheduler_} {}
 
 Fence FenceManager::CreateFence(bool is_stubbed) {
-    return std::make_shared<InnerFence>(scheduler, is_stubbed);
+    return Fence{is_stubbed};
 }
 
 void FenceManager::QueueFence(Fence& fence) {
-    fence->Queue();
+    if (fence.IsStubbed()) {
+        return;
+    }
+    // Get the current tick so we can wait for it
+    fence.wait_tick = scheduler.CurrentTick();
+    scheduler.Flush();
 }
 
 bool FenceManager::IsFenceSignaled(Fence& fence) const {
-    return fence->IsSignaled();
+    return fence.IsStubbed() || scheduler.IsFree(fence.wait_tick);
 }
 
 void FenceManager::WaitFence(Fence& fence) {
-    fence->Wait();
+    if (fence.IsStubbed()) {
+        return;
+    }
+    scheduler.Wait(fence.wait_tick);
 }
 
 } // namespace Vulkan
@@ -3,8 +3,6 @@
 
 #pragma once
 
-#include <memory>
-
 #include "video_core/fence_manager.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_query_cache.h"
@@ -23,22 +21,15 @@ namespace Vulkan {
 class Device;
 class Scheduler;
 
-class InnerFence : public VideoCommon::FenceBase {
+/// Guest fence resolved as a value of the scheduler's timeline semaphore, no host object is
+/// allocated for it
+class Fence : public VideoCommon::FenceBase {
 public:
-    explicit InnerFence(Scheduler& scheduler_, bool is_stubbed_);
-    ~InnerFence();
-
-    void Queue();
-
-    bool IsSignaled() const;
+    explicit Fence(bool is_stubbed_ = true) : FenceBase{is_stubbed_} {}
 
-    void Wait();
-
-private:
-    Scheduler& scheduler;
+    /// Timeline value signaled once the commands before the fence have finished
     u64 wait_tick = 0;
 };
-using Fence = std::shared_ptr<InnerFence>;
 
 struct FenceManagerParams {
     using FenceType = Fence;
@@ -6,10 +6,8 @@
 #include "common/settings.h"
 
 #include "video_core/fsr.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp16_comp_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp32_comp_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp16_comp_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp32_comp_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_fp16_comp_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_fp32_comp_spv.h"
 #include "video_core/renderer_vulkan/vk_fsr.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
@@ -59,7 +57,7 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImageView imag
                 },
         };
 
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *easu_pipeline);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
 
         const f32 input_image_width = static_cast<f32>(input_image_extent.width);
         const f32 input_image_height = static_cast<f32>(input_image_extent.height);
@@ -69,13 +67,16 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImageView imag
         const f32 viewport_x = crop_rect.left * input_image_width;
         const f32 viewport_height = (crop_rect.bottom - crop_rect.top) * input_image_height;
         const f32 viewport_y = crop_rect.top * input_image_height;
+        const float sharpening =
+            static_cast<float>(Settings::values.fsr_sharpening_slider.GetValue()) / 100.0f;
 
-        std::array<u32, 4 * 4> push_constants;
+        std::array<u32, 4 * 5> push_constants;
         FsrEasuConOffset(push_constants.data() + 0, push_constants.data() + 4,
                          push_constants.data() + 8, push_constants.data() + 12,
 
                          viewport_width, viewport_height, input_image_width, input_image_height,
                          output_image_width, output_image_height, viewport_x, viewport_y);
+        FsrRcasCon(push_constants.data() + 16, sharpening);
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, push_constants);
 
         {
@@ -88,68 +89,33 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImageView imag
         }
 
         cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
-                                  descriptor_sets[image_index * 2], {});
-        cmdbuf.Dispatch(Common::DivCeil(output_size.width, 16u),
-                        Common::DivCeil(output_size.height, 16u), 1);
-
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *rcas_pipeline);
-
-        const float sharpening =
-            static_cast<float>(Settings::values.fsr_sharpening_slider.GetValue()) / 100.0f;
-
-        FsrRcasCon(push_constants.data(), sharpening);
-        cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, push_constants);
-
-        {
-            std::array<VkImageMemoryBarrier, 2> barriers;
-            auto& fsr_read_barrier = barriers[0];
-            auto& blit_write_barrier = barriers[1];
-
-            fsr_read_barrier = base_barrier;
-            fsr_read_barrier.image = *images[image_index];
-            fsr_read_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-            fsr_read_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-            blit_write_barrier = base_barrier;
-            blit_write_barrier.image = *images[image_count + image_index];
-            blit_write_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            blit_write_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
-
-            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, {}, {}, barriers);
-        }
-
-        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
-                                  descriptor_sets[image_index * 2 + 1], {});
+                                  descriptor_sets[image_index], {});
         cmdbuf.Dispatch(Common::DivCeil(output_size.width, 16u),
                         Common::DivCeil(output_size.height, 16u), 1);
 
         {
-            std::array<VkImageMemoryBarrier, 1> barriers;
-            auto& blit_read_barrier = barriers[0];
-
-            blit_read_barrier = base_barrier;
-            blit_read_barrier.image = *images[image_count + image_index];
+            VkImageMemoryBarrier blit_read_barrier = base_barrier;
+            blit_read_barrier.image = *images[image_index];
             blit_read_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
             blit_read_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
             cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, {}, {}, barriers);
+                                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, blit_read_barrier);
         }
     });
 
-    return *image_views[image_count + image_index];
+    return *image_views[image_index];
 }
 
 void FSR::CreateDescriptorPool() {
     const std::array<VkDescriptorPoolSize, 2> pool_sizes{{
         {
             .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-            .descriptorCount = static_cast<u32>(image_count * 2),
+            .descriptorCount = static_cast<u32>(image_count),
         },
         {
             .type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
-            .descriptorCount = static_cast<u32>(image_count * 2),
+            .descriptorCount = static_cast<u32>(image_count),
         },
     }};
 
@@ -157,7 +123,7 @@ void FSR::CreateDescriptorPool() {
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
-        .maxSets = static_cast<u32>(image_count * 2),
+        .maxSets = static_cast<u32>(image_count),
         .poolSizeCount = static_cast<u32>(pool_sizes.size()),
         .pPoolSizes = pool_sizes.data(),
     };
@@ -194,7 +160,7 @@ void FSR::CreateDescriptorSetLayout() {
 }
 
 void FSR::CreateDescriptorSets() {
-    const u32 sets = static_cast<u32>(image_count * 2);
+    const u32 sets = static_cast<u32>(image_count);
     const std::vector layouts(sets, *descriptor_set_layout);
 
     const VkDescriptorSetAllocateInfo ai{
@@ -209,10 +175,10 @@ void FSR::CreateDescriptorSets() {
 }
 
 void FSR::CreateImages() {
-    images.resize(image_count * 2);
-    image_views.resize(image_count * 2);
+    images.resize(image_count);
+    image_views.resize(image_count);
 
-    for (size_t i = 0; i < image_count * 2; ++i) {
+    for (size_t i = 0; i < image_count; ++i) {
         images[i] = memory_allocator.CreateImage(VkImageCreateInfo{
             .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
             .pNext = nullptr,
@@ -266,7 +232,7 @@ void FSR::CreatePipelineLayout() {
     VkPushConstantRange push_const{
         .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
         .offset = 0,
-        .size = sizeof(std::array<u32, 4 * 4>),
+        .size = sizeof(std::array<u32, 4 * 5>),
     };
     VkPipelineLayoutCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
@@ -282,9 +248,6 @@ void FSR::CreatePipelineLayout() {
 }
 
 void FSR::UpdateDescriptorSet(std::size_t image_index, VkImageView image_view) const {
-    const auto fsr_image_view = *image_views[image_index];
-    const auto blit_image_view = *image_views[image_count + image_index];
-
     const VkDescriptorImageInfo image_info{
         .sampler = VK_NULL_HANDLE,
         .imageView = image_view,
@@ -292,19 +255,14 @@ void FSR::UpdateDescriptorSet(std::size_t image_index, VkImageView image_view) c
     };
     const VkDescriptorImageInfo fsr_image_info{
         .sampler = VK_NULL_HANDLE,
-        .imageView = fsr_image_view,
-        .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
-    };
-    const VkDescriptorImageInfo blit_image_info{
-        .sampler = VK_NULL_HANDLE,
-        .imageView = blit_image_view,
+        .imageView = *image_views[image_index],
         .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
     };
 
-    VkWriteDescriptorSet sampler_write{
+    const VkWriteDescriptorSet sampler_write{
         .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
         .pNext = nullptr,
-        .dstSet = descriptor_sets[image_index * 2],
+        .dstSet = descriptor_sets[image_index],
         .dstBinding = 0,
         .dstArrayElement = 0,
         .descriptorCount = 1,
@@ -314,10 +272,10 @@ void FSR::UpdateDescriptorSet(std::size_t image_index, VkImageView image_view) c
         .pTexelBufferView = nullptr,
     };
 
-    VkWriteDescriptorSet output_write{
+    const VkWriteDescriptorSet output_write{
         .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
         .pNext = nullptr,
-        .dstSet = descriptor_sets[image_index * 2],
+        .dstSet = descriptor_sets[image_index],
         .dstBinding = 1,
         .dstArrayElement = 0,
         .descriptorCount = 1,
@@ -328,13 +286,6 @@ void FSR::UpdateDescriptorSet(std::size_t image_index, VkImageView image_view) c
     };
 
     device.GetLogical().UpdateDescriptorSets(std::array{sampler_write, output_write}, {});
-
-    sampler_write.dstSet = descriptor_sets[image_index * 2 + 1];
-    sampler_write.pImageInfo = &fsr_image_info;
-    output_write.dstSet = descriptor_sets[image_index * 2 + 1];
-    output_write.pImageInfo = &blit_image_info;
-
-    device.GetLogical().UpdateDescriptorSets(std::array{sampler_write, output_write}, {});
 }
 
 void FSR::CreateSampler() {
@@ -364,57 +315,34 @@ void FSR::CreateSampler() {
 
 void FSR::CreateShaders() {
     if (device.IsFloat16Supported()) {
-        easu_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_EASU_FP16_COMP_SPV);
-        rcas_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP16_COMP_SPV);
+        shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_FP16_COMP_SPV);
     } else {
-        easu_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_EASU_FP32_COMP_SPV);
-        rcas_shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP32_COMP_SPV);
+        shader = BuildShader(device, VULKAN_FIDELITYFX_FSR_FP32_COMP_SPV);
     }
 }
 
 void FSR::CreatePipeline() {
-    VkPipelineShaderStageCreateInfo shader_stage_easu{
+    const VkPipelineShaderStageCreateInfo shader_stage{
         .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
         .stage = VK_SHADER_STAGE_COMPUTE_BIT,
-        .module = *easu_shader,
+        .module = *shader,
         .pName = "main",
         .pSpecializationInfo = nullptr,
     };
 
-    VkPipelineShaderStageCreateInfo shader_stage_rcas{
-        .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .stage = VK_SHADER_STAGE_COMPUTE_BIT,
-        .module = *rcas_shader,
-        .pName = "main",
-        .pSpecializationInfo = nullptr,
-    };
-
-    VkComputePipelineCreateInfo pipeline_ci_easu{
-        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .stage = shader_stage_easu,
-        .layout = *pipeline_layout,
-        .basePipelineHandle = VK_NULL_HANDLE,
-        .basePipelineIndex = 0,
-    };
-
-    VkComputePipelineCreateInfo pipeline_ci_rcas{
+    const VkComputePipelineCreateInfo pipeline_ci{
         .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
-        .stage = shader_stage_rcas,
+        .stage = shader_stage,
         .layout = *pipeline_layout,
         .basePipelineHandle = VK_NULL_HANDLE,
         .basePipelineIndex = 0,
     };
 
-    easu_pipeline = device.GetLogical().CreateComputePipeline(pipeline_ci_easu);
-    rcas_pipeline = device.GetLogical().CreateComputePipeline(pipeline_ci_rcas);
+    pipeline = device.GetLogical().CreateComputePipeline(pipeline_ci);
 }
 
 } // namespace Vulkan
@@ -40,10 +40,9 @@ private:
     vk::DescriptorSetLayout descriptor_set_layout;
     vk::DescriptorSets descriptor_sets;
     vk::PipelineLayout pipeline_layout;
-    vk::ShaderModule easu_shader;
-    vk::ShaderModule rcas_shader;
-    vk::Pipeline easu_pipeline;
-    vk::Pipeline rcas_pipeline;
+    /// Upscales with EASU and sharpens with RCAS in a single dispatch
+    vk::ShaderModule shader;
+    vk::Pipeline pipeline;
     vk::Sampler sampler;
     std::vector<vk::Image> images;
     std::vector<vk::ImageView> image_views;
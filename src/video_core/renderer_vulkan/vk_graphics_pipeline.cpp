@@ -237,14 +237,19 @@ ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& m
 GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
     vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
-    const Device& device_, DescriptorPool& descriptor_pool,
+    const Device& device_, DescriptorPool& descriptor_pool, DescriptorBuffer& descriptor_buffer_,
     GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
     PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
     const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
-    const std::array<const Shader::Info*, NUM_STAGES>& infos)
+    const std::array<const Shader::Info*, NUM_STAGES>& infos, std::function<void()> on_built)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
-      pipeline_cache(pipeline_cache_), scheduler{scheduler_},
+      pipeline_cache(pipeline_cache_), scheduler{scheduler_}, descriptor_buffer{descriptor_buffer_},
       guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+    // Pipelines built without a worker come from the disk cache, these are not waited on by
+    // draws, build them fully optimized in one go
+    if (device.IsExtGraphicsPipelineLibrarySupported()) {
+        library_worker = worker_thread;
+    }
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
@@ -258,24 +263,44 @@ GraphicsPipeline::GraphicsPipeline(
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
-        uses_push_descriptor = builder.CanUsePushDescriptor();
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
-        if (!uses_push_descriptor) {
-            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+    DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
+    uses_push_descriptor = builder.CanUsePushDescriptor();
+    uses_descriptor_buffer = !uses_push_descriptor && descriptor_buffer.IsEnabled() &&
+                             builder.CanUseDescriptorBuffer();
+    if (uses_descriptor_buffer) {
+        // The size of the set is needed to reserve descriptor buffer space, even before the
+        // pipeline is built
+        descriptor_set_layout = builder.CreateDescriptorSetLayout(false, true);
+        if (descriptor_set_layout) {
+            descriptor_buffer_layout =
+                descriptor_buffer.MakeLayout(*descriptor_set_layout, builder.Bindings());
+        }
+    }
+    auto func{[this, builder = std::move(builder), shader_notify, &render_pass_cache,
+               &descriptor_pool, pipeline_statistics, on_built = std::move(on_built)] {
+        if (!uses_descriptor_buffer) {
+            descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
+            if (!uses_push_descriptor) {
+                descriptor_allocator =
+                    descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+            }
         }
         const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
         pipeline_layout = builder.CreatePipelineLayout(set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        if (!uses_descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        }
 
         const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
         Validate();
-        MakePipeline(render_pass);
+        MakePipeline(render_pass, render_pass_cache.RenderingInfo(render_pass));
         if (pipeline_statistics) {
             pipeline_statistics->Collect(*pipeline);
         }
+        if (on_built) {
+            on_built();
+        }
 
         std::scoped_lock lock{build_mutex};
         is_built = true;
@@ -285,7 +310,7 @@ GraphicsPipeline::GraphicsPipeline(
         }
     }};
     if (worker_thread) {
-        worker_thread->QueueWork(std::move(func));
+        worker_thread->QueuePriorityWork(std::move(func));
     } else {
         func();
     }
@@ -490,6 +515,11 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
 
 void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
                                      const RenderAreaPushConstant& render_area) {
+    // Reserving descriptor buffer space may flush, do it before the render pass is requested
+    VkDeviceSize descriptor_offset{};
+    if (uses_descriptor_buffer && descriptor_set_layout) {
+        descriptor_offset = descriptor_buffer.Allocate(descriptor_buffer_layout.size);
+    }
     scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
 
     if (!is_built.load(std::memory_order::relaxed)) {
@@ -503,12 +533,12 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
     const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
     const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
-                      is_rescaling, update_rescaling,
+    scheduler.Record([this, descriptor_data, descriptor_offset, bind_pipeline,
+                      rescaling_data = rescaling.Data(), is_rescaling, update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, CurrentPipeline());
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -528,7 +558,13 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
         if (!descriptor_set_layout) {
             return;
         }
-        if (uses_push_descriptor) {
+        if (uses_descriptor_buffer) {
+            const auto entries{static_cast<const DescriptorUpdateEntry*>(descriptor_data)};
+            descriptor_buffer.Write(descriptor_buffer_layout, descriptor_offset, entries);
+            const u32 buffer_index = 0;
+            cmdbuf.SetDescriptorBufferOffsetsEXT(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline_layout,
+                                                 0, buffer_index, descriptor_offset);
+        } else if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
                                                     0, descriptor_data);
         } else {
@@ -541,7 +577,8 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+void GraphicsPipeline::MakePipeline(VkRenderPass render_pass,
+                                    const VkPipelineRenderingCreateInfo* rendering_ci) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -791,7 +828,7 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         .pAttachments = cb_attachments.data(),
         .blendConstants = {},
     };
-    static_vector<VkDynamicState, 28> dynamic_states{
+    static_vector<VkDynamicState, 34> dynamic_states{
         VK_DYNAMIC_STATE_VIEWPORT,           VK_DYNAMIC_STATE_SCISSOR,
         VK_DYNAMIC_STATE_DEPTH_BIAS,         VK_DYNAMIC_STATE_BLEND_CONSTANTS,
         VK_DYNAMIC_STATE_DEPTH_BOUNDS,       VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
@@ -840,6 +877,23 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
             };
             dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
         }
+        if (key.state.extended_dynamic_state_3_rasterization) {
+            static constexpr std::array extended3{
+                VK_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT,
+            };
+            dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
+            if (device.IsExtLineRasterizationSupported()) {
+                dynamic_states.push_back(VK_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT);
+            }
+            if (device.IsExtConservativeRasterizationSupported()) {
+                dynamic_states.push_back(VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT);
+            }
+            if (device.IsExtProvokingVertexSupported()) {
+                dynamic_states.push_back(VK_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT);
+            }
+        }
     }
     const VkPipelineDynamicStateCreateInfo dynamic_state_ci{
         .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
@@ -878,24 +932,111 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
-    pipeline = device.GetLogical().CreateGraphicsPipeline(
+    if (uses_descriptor_buffer) {
+        flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+    const VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = rendering_ci,
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = rendering_ci ? nullptr : render_pass,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    if (library_worker) {
+        MakeLibraryPipeline(pipeline_ci);
+    } else {
+        pipeline = device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+    }
+}
+
+void GraphicsPipeline::MakeLibraryPipeline(const VkGraphicsPipelineCreateInfo& pipeline_ci) {
+    // Fragment shaders are always the last stage
+    const std::span<const VkPipelineShaderStageCreateInfo> stages(pipeline_ci.pStages,
+                                                                  pipeline_ci.stageCount);
+    const auto fragment_it{std::ranges::find(stages, VK_SHADER_STAGE_FRAGMENT_BIT,
+                                             &VkPipelineShaderStageCreateInfo::stage)};
+    const std::span pre_raster_stages(stages.begin(), fragment_it);
+    const std::span fragment_stages(fragment_it, stages.end());
+
+    // Libraries ignore the state that doesn't belong to them, only the stages have to be split
+    const VkPipelineCreateFlags library_flags{
+        (pipeline_ci.flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) |
+        VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+        VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT};
+    const auto make_library{[&](VkGraphicsPipelineLibraryFlagsEXT library,
+                                std::span<const VkPipelineShaderStageCreateInfo> library_stages) {
+        const VkGraphicsPipelineLibraryCreateInfoEXT library_ci{
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            .pNext = pipeline_ci.pNext,
+            .flags = library,
+        };
+        VkGraphicsPipelineCreateInfo ci{pipeline_ci};
+        ci.pNext = &library_ci;
+        ci.flags = library_flags;
+        ci.stageCount = static_cast<u32>(library_stages.size());
+        ci.pStages = library_stages.empty() ? nullptr : library_stages.data();
+        return device.GetLogical().CreateGraphicsPipeline(ci, *pipeline_cache);
+    }};
+    libraries[0] = make_library(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, {});
+    libraries[1] = make_library(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                                pre_raster_stages);
+    libraries[2] =
+        make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, fragment_stages);
+    libraries[3] = make_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, {});
+
+    pipeline = LinkLibraries(pipeline_ci.flags);
+
+    library_worker->QueueWork([this, flags = pipeline_ci.flags] {
+        optimized_pipeline =
+            LinkLibraries(flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+        is_optimized.store(true, std::memory_order::release);
+        // Linked pipelines don't reference their libraries
+        libraries = {};
+    });
+}
+
+vk::Pipeline GraphicsPipeline::LinkLibraries(VkPipelineCreateFlags flags) const {
+    std::array<VkPipeline, std::tuple_size_v<decltype(libraries)>> handles;
+    std::ranges::transform(libraries, handles.begin(),
+                           [](const vk::Pipeline& library) { return *library; });
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(handles.size()),
+        .pLibraries = handles.data(),
+    };
+    return device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
+            .pNext = &library_ci,
             .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
             .layout = *pipeline_layout,
-            .renderPass = render_pass,
+            .renderPass = nullptr,
             .subpass = 0,
             .basePipelineHandle = nullptr,
             .basePipelineIndex = 0,
@@ -7,6 +7,7 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <type_traits>
 
@@ -15,6 +16,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -72,11 +74,11 @@ public:
     explicit GraphicsPipeline(
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
         vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
-        const Device& device, DescriptorPool& descriptor_pool,
+        const Device& device, DescriptorPool& descriptor_pool, DescriptorBuffer& descriptor_buffer,
         GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
         PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
         const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
-        const std::array<const Shader::Info*, NUM_STAGES>& infos);
+        const std::array<const Shader::Info*, NUM_STAGES>& infos, std::function<void()> on_built);
 
     GraphicsPipeline& operator=(GraphicsPipeline&&) noexcept = delete;
     GraphicsPipeline(GraphicsPipeline&&) noexcept = delete;
@@ -103,6 +105,10 @@ public:
         return is_built.load(std::memory_order::relaxed);
     }
 
+    [[nodiscard]] const GraphicsPipelineCacheKey& Key() const noexcept {
+        return key;
+    }
+
     template <typename Spec>
     static auto MakeConfigureSpecFunc() {
         return [](GraphicsPipeline* pl, bool is_indexed) { pl->ConfigureImpl<Spec>(is_indexed); };
@@ -120,7 +126,18 @@ private:
     void ConfigureDraw(const RescalingPushConstant& rescaling,
                        const RenderAreaPushConstant& render_are);
 
-    void MakePipeline(VkRenderPass render_pass);
+    void MakePipeline(VkRenderPass render_pass,
+                      const VkPipelineRenderingCreateInfo* rendering_ci);
+
+    /// Builds the pipeline as separate libraries and fast-links them, the optimized link is queued
+    /// on the library worker and replaces the fast-linked pipeline when it is ready
+    void MakeLibraryPipeline(const VkGraphicsPipelineCreateInfo& pipeline_ci);
+
+    [[nodiscard]] vk::Pipeline LinkLibraries(VkPipelineCreateFlags flags) const;
+
+    [[nodiscard]] VkPipeline CurrentPipeline() const noexcept {
+        return is_optimized.load(std::memory_order::acquire) ? *optimized_pipeline : *pipeline;
+    }
 
     void Validate();
 
@@ -132,6 +149,7 @@ private:
     BufferCache& buffer_cache;
     vk::PipelineCache& pipeline_cache;
     Scheduler& scheduler;
+    DescriptorBuffer& descriptor_buffer;
     GuestDescriptorQueue& guest_descriptor_queue;
 
     void (*configure_func)(GraphicsPipeline*, bool){};
@@ -148,14 +166,21 @@ private:
 
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
+    DescriptorBufferLayout descriptor_buffer_layout;
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
     vk::Pipeline pipeline;
 
+    Common::ThreadWorker* library_worker{};
+    std::array<vk::Pipeline, 4> libraries;
+    vk::Pipeline optimized_pipeline;
+    std::atomic_bool is_optimized{false};
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    bool uses_descriptor_buffer{false};
 };
 
 } // namespace Vulkan
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_pass_profiler.h"
+#include "video_core/texture_cache/formatter.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+namespace {
+using VideoCore::Surface::PixelFormat;
+
+/// Number of passes that can be timed at once
+constexpr u32 NUM_PASS_SLOTS = 2048;
+
+constexpr size_t MAX_LOGGED_PASSES = 16;
+
+constexpr std::array<std::string_view, 3> PASS_TYPE_NAMES{"render", "compute", "present"};
+constexpr std::array<std::string_view, 6> STAGE_NAMES{"vsa", "vs", "tcs", "tes", "gs", "fs"};
+
+std::string ShaderNames(const PassKey& key) {
+    if (key.type == PassType::Compute) {
+        return key.shader_hashes[0] != 0 ? fmt::format("cs:{:016x}", key.shader_hashes[0])
+                                         : "internal";
+    }
+    std::string names;
+    for (size_t stage = 0; stage < key.shader_hashes.size(); ++stage) {
+        if (key.shader_hashes[stage] != 0) {
+            names += fmt::format("{}{}:{:016x}", names.empty() ? "" : " ", STAGE_NAMES[stage],
+                                 key.shader_hashes[stage]);
+        }
+    }
+    return names.empty() ? "internal" : names;
+}
+
+std::string TargetNames(const PassKey& key) {
+    if (key.type != PassType::Render) {
+        return {};
+    }
+    std::string names;
+    for (const PixelFormat format : key.targets.color_formats) {
+        if (format != PixelFormat::Invalid) {
+            names += fmt::format("{}{}", names.empty() ? "" : "/", format);
+        }
+    }
+    if (key.targets.depth_format != PixelFormat::Invalid) {
+        names += fmt::format("{}{}", names.empty() ? "" : "/", key.targets.depth_format);
+    }
+    if (key.targets.samples != VK_SAMPLE_COUNT_1_BIT) {
+        names += fmt::format(" x{}", static_cast<u32>(key.targets.samples));
+    }
+    return names;
+}
+} // Anonymous namespace
+
+size_t PassKeyHash::operator()(const PassKey& key) const noexcept {
+    size_t value = std::hash<RenderPassKey>{}(key.targets) ^ static_cast<size_t>(key.type);
+    for (const u64 hash : key.shader_hashes) {
+        value ^= static_cast<size_t>(hash) + 0x9e3779b97f4a7c15ULL + (value << 6) + (value >> 2);
+    }
+    return value;
+}
+
+PassProfiler::PassProfiler(const Device& device_) : device{device_} {
+    query_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NUM_PASS_SLOTS * 2,
+        .pipelineStatistics = 0,
+    });
+    device.GetLogical().ResetQueryPool(*query_pool, 0, NUM_PASS_SLOTS * 2);
+    for (u32 slot = NUM_PASS_SLOTS; slot-- > 0;) {
+        free_slots.push_back(slot);
+    }
+}
+
+PassProfiler::~PassProfiler() = default;
+
+std::optional<u32> PassProfiler::BeginPass(const PassKey& key, u64 tick) {
+    if (free_slots.empty()) {
+        ++untimed_passes;
+        return std::nullopt;
+    }
+    const u32 slot = free_slots.back();
+    free_slots.pop_back();
+    pending_passes.push_back(PendingPass{
+        .tick = tick,
+        .slot = slot,
+        .key = key,
+    });
+    return slot * 2;
+}
+
+void PassProfiler::Collect(const MasterSemaphore& master_semaphore) {
+    const auto& dev = device.GetLogical();
+    while (!pending_passes.empty() && master_semaphore.IsFree(pending_passes.front().tick)) {
+        const PendingPass& pass = pending_passes.front();
+        std::array<u64, 2> timestamps{};
+        if (dev.GetQueryResults(*query_pool, pass.slot * 2, 2, sizeof(timestamps),
+                                timestamps.data(), sizeof(u64),
+                                VK_QUERY_RESULT_64_BIT) == VK_SUCCESS &&
+            timestamps[1] >= timestamps[0]) {
+            PassStats& stats = pass_stats[pass.key];
+            stats.ticks += timestamps[1] - timestamps[0];
+            ++stats.count;
+        }
+        dev.ResetQueryPool(*query_pool, pass.slot * 2, 2);
+        free_slots.push_back(pass.slot);
+        pending_passes.pop_front();
+    }
+}
+
+void PassProfiler::Report() const {
+    if (pass_stats.empty()) {
+        return;
+    }
+    const f64 ms_per_tick = static_cast<f64>(device.GetTimestampPeriod()) / 1'000'000.0;
+    std::vector<std::pair<const PassKey*, const PassStats*>> passes;
+    passes.reserve(pass_stats.size());
+    std::array<u64, PASS_TYPE_NAMES.size()> type_ticks{};
+    for (const auto& [key, stats] : pass_stats) {
+        passes.emplace_back(&key, &stats);
+        type_ticks[static_cast<size_t>(key.type)] += stats.ticks;
+    }
+    std::ranges::sort(passes, std::greater{}, [](const auto& pair) { return pair.second->ticks; });
+
+    std::string dump = "type,shaders,targets,passes,total_ms,mean_us\n";
+    std::string summary;
+    for (size_t index = 0; index < passes.size(); ++index) {
+        const auto& [key, stats] = passes[index];
+        const f64 total_ms = static_cast<f64>(stats->ticks) * ms_per_tick;
+        const f64 mean_us = total_ms * 1000.0 / static_cast<f64>(stats->count);
+        const std::string shaders = ShaderNames(*key);
+        const std::string targets = TargetNames(*key);
+        const std::string_view type = PASS_TYPE_NAMES[static_cast<size_t>(key->type)];
+        dump += fmt::format("{},{},{},{},{:.3f},{:.1f}\n", type, shaders, targets, stats->count,
+                            total_ms, mean_us);
+        if (index < MAX_LOGGED_PASSES) {
+            summary += fmt::format("{:10.1f} ms {:9} passes {:8.1f} us/pass {:7} {} {}\n",
+                                   total_ms, stats->count, mean_us, type, shaders, targets);
+        }
+    }
+
+    const auto log_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir)};
+    const auto filename{log_dir / "gpu_passes.csv"};
+    std::string location{Common::FS::PathToUTF8String(filename)};
+    std::ofstream file;
+    if (Common::FS::CreateDir(log_dir)) {
+        file.open(filename, std::ios::out | std::ios::trunc);
+    }
+    if (file) {
+        file << dump;
+    } else {
+        LOG_ERROR(Common_Filesystem, "Unable to open or create file at {}", location);
+        location = "nowhere";
+    }
+
+    const auto type_ms = [&](PassType type) {
+        return static_cast<f64>(type_ticks[static_cast<size_t>(type)]) * ms_per_tick;
+    };
+    LOG_INFO(Render_Vulkan,
+             "\nGPU passes that took the most time, all passes dumped to {}\n"
+             "Render {:.1f} ms, compute {:.1f} ms, present {:.1f} ms, {} passes not timed\n"
+             "======================================================================\n"
+             "{}",
+             location, type_ms(PassType::Render), type_ms(PassType::Compute),
+             type_ms(PassType::Present), untimed_passes, summary);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MasterSemaphore;
+
+/// Kind of GPU work timed by a profiled pass
+enum class PassType : u8 {
+    Render,  ///< Draws of a render pass with the same pipeline
+    Compute, ///< Dispatch of a compute shader
+    Present, ///< Composition of a frame for presentation or a screenshot
+};
+
+/// Identifies the passes whose GPU time is added up together
+struct PassKey {
+    bool operator==(const PassKey&) const noexcept = default;
+
+    PassType type{};
+    /// Unique hashes of the shader stages of the pipeline, zero for passes of the renderer itself
+    std::array<u64, 6> shader_hashes{};
+    /// Formats of the render targets, only set for render passes
+    RenderPassKey targets{};
+};
+
+struct PassKeyHash {
+    [[nodiscard]] size_t operator()(const PassKey& key) const noexcept;
+};
+
+/**
+ * Times passes of GPU work with pairs of timestamp queries, written by the scheduler around
+ * render passes and the pipeline changes in them, compute dispatches and the
+ * presentation of frames. The results are read without waiting once the submission that wrote
+ * them has completed, and the passes that took the most GPU time are reported on shutdown.
+ */
+class PassProfiler {
+public:
+    explicit PassProfiler(const Device& device);
+    ~PassProfiler();
+
+    PassProfiler(const PassProfiler&) = delete;
+    PassProfiler& operator=(const PassProfiler&) = delete;
+
+    /// Returns the first of the two queries timing a pass in the submission signalling the given
+    /// tick, or nullopt when too many passes are in flight to time another one.
+    [[nodiscard]] std::optional<u32> BeginPass(const PassKey& key, u64 tick);
+
+    [[nodiscard]] VkQueryPool QueryPool() const noexcept {
+        return *query_pool;
+    }
+
+    /// Adds up the times of the passes whose submissions have completed
+    void Collect(const MasterSemaphore& master_semaphore);
+
+    /// Logs the passes that took the most GPU time and dumps every pass to the log directory
+    void Report() const;
+
+private:
+    struct PendingPass {
+        u64 tick;
+        u32 slot;
+        PassKey key;
+    };
+
+    struct PassStats {
+        u64 ticks{};
+        u64 count{};
+    };
+
+    const Device& device;
+    vk::QueryPool query_pool;
+    std::vector<u32> free_slots;
+    std::deque<PendingPass> pending_passes;
+    std::unordered_map<PassKey, PassStats, PassKeyHash> pass_stats;
+    /// Passes not timed because every pair of queries was in flight
+    u64 untimed_passes{};
+};
+
+} // namespace Vulkan
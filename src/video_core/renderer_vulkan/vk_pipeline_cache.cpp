@@ -3,18 +3,24 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "common/bit_cast.h"
-#include "common/cityhash.h"
+#include "common/fast_hash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/microprofile.h"
 #include "common/thread_worker.h"
 #include "core/core.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
@@ -46,6 +52,7 @@ namespace {
 using Shader::Backend::SPIRV::EmitSPIRV;
 using Shader::Maxwell::ConvertLegacyToGeneric;
 using Shader::Maxwell::GenerateGeometryPassthrough;
+using Shader::Maxwell::LinkStages;
 using Shader::Maxwell::MergeDualVertexPrograms;
 using Shader::Maxwell::TranslateProgram;
 using VideoCommon::ComputeEnvironment;
@@ -53,7 +60,7 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 
-constexpr u32 CACHE_VERSION = 11;
+constexpr u32 CACHE_VERSION = Common::WithFastHashVersion(15);
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
 template <typename Container>
@@ -278,10 +285,150 @@ size_t GetTotalPipelineWorkers() {
 #endif
 }
 
+/// Lowers the number of active pipeline workers while the driver compile throughput holds.
+/// Drivers that serialize compilation internally gain nothing from extra threads.
+class PipelineWorkerTuner {
+public:
+    explicit PipelineWorkerTuner(Common::ThreadWorker& workers_)
+        : workers{workers_}, best_workers{workers.MaxActiveWorkers()} {}
+
+    /// Must be called after each pipeline is built, with external synchronization
+    void OnBuilt() {
+        static constexpr size_t WINDOW_SIZE = 64;
+        static constexpr double TOLERANCE = 0.95;
+
+        if (is_done || ++window_built < WINDOW_SIZE) {
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(now - window_start).count();
+        const double rate = static_cast<double>(window_built) / std::max(seconds, 1e-6);
+        window_built = 0;
+        window_start = now;
+
+        const size_t current_workers = workers.MaxActiveWorkers();
+        if (rate < best_rate * TOLERANCE) {
+            // Throughput dropped, go back to the last good worker count
+            workers.SetMaxActiveWorkers(best_workers);
+            is_done = true;
+            return;
+        }
+        best_rate = std::max(best_rate, rate);
+        best_workers = current_workers;
+        if (current_workers == 1) {
+            is_done = true;
+            return;
+        }
+        workers.SetMaxActiveWorkers(current_workers - std::max<size_t>(current_workers / 4, 1));
+    }
+
+    [[nodiscard]] size_t BestWorkers() const noexcept {
+        return best_workers;
+    }
+
+private:
+    Common::ThreadWorker& workers;
+    std::chrono::steady_clock::time_point window_start{std::chrono::steady_clock::now()};
+    size_t window_built{};
+    size_t best_workers{};
+    double best_rate{};
+    bool is_done{};
+};
+
+u64 ShaderHashesKey(const GraphicsPipelineCacheKey& key) {
+    return Common::FastHash64(key.unique_hashes.data(), sizeof(key.unique_hashes));
+}
+
+/// Returns true when a built pipeline draws like a pending one until it is ready. Both must share
+/// their shaders and state, except for the engine hint. The alpha test reference, the point size
+/// and early depth tests are baked into the shaders, so they have to match too.
+bool CanStandIn(const GraphicsPipelineCacheKey& built, const GraphicsPipelineCacheKey& pending) {
+    // Blending and vertex input are only left out of the key when they are dynamic
+    if (pending.state.dynamic_vertex_input == 0 ||
+        pending.state.extended_dynamic_state_3_blend == 0) {
+        return false;
+    }
+    if (built.unique_hashes != pending.unique_hashes) {
+        return false;
+    }
+    const auto normalize{[](FixedPipelineState state) {
+        state.app_stage.Assign(Tegra::Engines::Maxwell3D::EngineHint{});
+        return state;
+    }};
+    const FixedPipelineState lhs{normalize(built.state)};
+    const FixedPipelineState rhs{normalize(pending.state)};
+    return std::memcmp(&lhs, &rhs, rhs.Size()) == 0;
+}
 } // Anonymous namespace
 
+void PipelineCompileTimings::Record(u64 hash, const Shader::PassTimings& passes,
+                                    Clock::time_point translate, Clock::time_point emit,
+                                    Clock::time_point build, Clock::time_point end) {
+    const auto nanoseconds = [](Clock::duration duration) {
+        return static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    };
+    translate_ns.fetch_add(nanoseconds(emit - translate), std::memory_order::relaxed);
+    emit_ns.fetch_add(nanoseconds(build - emit), std::memory_order::relaxed);
+    build_ns.fetch_add(nanoseconds(end - build), std::memory_order::relaxed);
+    num_pipelines.fetch_add(1, std::memory_order::relaxed);
+
+    std::scoped_lock lock{mutex};
+    pass_ns += passes;
+    pipeline_ns.emplace_back(hash, nanoseconds(end - translate));
+}
+
+void PipelineCompileTimings::Report() {
+    const u64 count = num_pipelines.exchange(0, std::memory_order::relaxed);
+    const auto milliseconds = [](u64 value) { return static_cast<double>(value) / 1'000'000.0; };
+    const double translate = milliseconds(translate_ns.exchange(0, std::memory_order::relaxed));
+    const double emit = milliseconds(emit_ns.exchange(0, std::memory_order::relaxed));
+    const double build = milliseconds(build_ns.exchange(0, std::memory_order::relaxed));
+
+    std::unique_lock lock{mutex};
+    const Shader::PassTimings passes{std::exchange(pass_ns, {})};
+    std::vector<std::pair<u64, u64>> pipelines{std::exchange(pipeline_ns, {})};
+    lock.unlock();
+    if (count == 0) {
+        return;
+    }
+    LOG_INFO(Render_Vulkan,
+             "Compiled {} pipelines, translate {:.1f} ms, SPIR-V {:.1f} ms, pipeline {:.1f} ms "
+             "(CPU time summed over workers)",
+             count, translate, emit, build);
+
+    std::array<size_t, Shader::NUM_COMPILE_PASSES> order;
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::ranges::sort(order, std::greater{}, [&](size_t pass) { return passes.ns[pass]; });
+    const double total_passes = static_cast<double>(std::max<u64>(passes.Total(), 1));
+    std::string report;
+    for (const size_t pass : order) {
+        if (passes.ns[pass] == 0) {
+            break;
+        }
+        report += fmt::format("{:<28} {:9.1f} ms {:5.1f}%\n",
+                              Shader::NameOf(static_cast<Shader::CompilePass>(pass)),
+                              milliseconds(passes.ns[pass]),
+                              static_cast<double>(passes.ns[pass]) * 100.0 / total_passes);
+    }
+    constexpr size_t MAX_REPORTED_PIPELINES = 10;
+    const size_t num_reported = std::min(pipelines.size(), MAX_REPORTED_PIPELINES);
+    std::ranges::partial_sort(pipelines, pipelines.begin() + num_reported, std::greater{},
+                              &std::pair<u64, u64>::second);
+    report += "\nCostliest pipelines\n";
+    for (size_t index = 0; index < num_reported; ++index) {
+        report += fmt::format("0x{:016x}                   {:9.1f} ms\n", pipelines[index].first,
+                              milliseconds(pipelines[index].second));
+    }
+    LOG_INFO(Render_Vulkan,
+             "\nRecompiler passes by cost\n"
+             "==========================================\n"
+             "{}",
+             report);
+}
+
 size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::FastHash64(this, sizeof *this);
     return static_cast<size_t>(hash);
 }
 
@@ -290,7 +437,7 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::FastHash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
@@ -301,18 +448,22 @@ bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) c
 PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
                              const Device& device_, Scheduler& scheduler_,
                              DescriptorPool& descriptor_pool_,
+                             DescriptorBuffer& descriptor_buffer_,
                              GuestDescriptorQueue& guest_descriptor_queue_,
                              RenderPassCache& render_pass_cache_, BufferCache& buffer_cache_,
                              TextureCache& texture_cache_, VideoCore::ShaderNotify& shader_notify_)
     : VideoCommon::ShaderCache{device_memory_}, device{device_}, scheduler{scheduler_},
-      descriptor_pool{descriptor_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
+      descriptor_pool{descriptor_pool_}, descriptor_buffer{descriptor_buffer_},
+      guest_descriptor_queue{guest_descriptor_queue_},
       render_pass_cache{render_pass_cache_}, buffer_cache{buffer_cache_},
       texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
       workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
-              "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+              "VkPipelineBuilder", {}, Common::ThreadCoreClass::Efficiency),
+      stage_workers(std::min<size_t>(GetTotalPipelineWorkers(), Maxwell::MaxShaderProgram),
+                    "VkShaderTranslator"),
+      serialization_thread(1, "VkPipelineSerialization", {}, Common::ThreadCoreClass::Efficiency) {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -405,11 +556,14 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_extended_dynamic_state_2_extra = device.IsExtExtendedDynamicState2ExtrasSupported(),
         .has_extended_dynamic_state_3_blend = device.IsExtExtendedDynamicState3BlendingSupported(),
         .has_extended_dynamic_state_3_enables = device.IsExtExtendedDynamicState3EnablesSupported(),
+        .has_extended_dynamic_state_3_rasterization =
+            device.IsExtExtendedDynamicState3RasterizationSupported(),
         .has_dynamic_vertex_input = device.IsExtVertexInputDynamicStateSupported(),
     };
 }
 
 PipelineCache::~PipelineCache() {
+    compile_timings.Report();
     if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty()) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
@@ -468,6 +622,12 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         LOG_ERROR(Common_Filesystem, "Failed to create pipeline cache directories");
         return;
     }
+    LoadDiskResources(base_dir, stop_loading, callback);
+}
+
+void PipelineCache::LoadDiskResources(const std::filesystem::path& base_dir,
+                                      std::stop_token stop_loading,
+                                      const VideoCore::DiskResourceLoadCallback& callback) {
     pipeline_cache_filename = base_dir / "vulkan.bin";
 
     if (use_vulkan_pipeline_cache) {
@@ -487,17 +647,21 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const size_t initial_workers{workers.MaxActiveWorkers()};
+    PipelineWorkerTuner tuner{workers};
+
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
         ComputePipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
 
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
+        workers.QueueWork([this, key, env_ = std::move(env), &state, &tuner, &callback]() mutable {
             ShaderPools pools;
             auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
             }
+            tuner.OnBuilt();
             ++state.built;
             if (state.has_loaded) {
                 callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
@@ -505,7 +669,7 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
         GraphicsPipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
 
@@ -519,10 +683,13 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
                 dynamic_features.has_extended_dynamic_state_3_blend ||
             (key.state.extended_dynamic_state_3_enables != 0) !=
                 dynamic_features.has_extended_dynamic_state_3_enables ||
+            (key.state.extended_dynamic_state_3_rasterization != 0) !=
+                dynamic_features.has_extended_dynamic_state_3_rasterization ||
             (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
+        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &tuner,
+                           &callback]() mutable {
             ShaderPools pools;
             boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
             for (auto& env : envs_) {
@@ -533,8 +700,10 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
 
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
+                pipelines_by_shaders[ShaderHashesKey(key)].push_back(pipeline.get());
                 graphics_cache.emplace(key, std::move(pipeline));
             }
+            tuner.OnBuilt();
             ++state.built;
             if (state.has_loaded) {
                 callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
@@ -554,6 +723,14 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
 
     workers.WaitForRequests(stop_loading);
 
+    compile_timings.Report();
+    if (state.total > 0) {
+        LOG_INFO(Render_Vulkan, "Building pipelines on {} of {} workers", tuner.BestWorkers(),
+                 workers.NumWorkers());
+    }
+    // The tuned count only applies to the bulk preload, runtime builds are latency bound
+    workers.SetMaxActiveWorkers(initial_workers);
+
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
@@ -564,11 +741,75 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     }
 }
 
+ShaderBenchmarkResults PipelineCache::BenchmarkShaders(const std::filesystem::path& base_dir,
+                                                       u32 iterations,
+                                                       std::stop_token stop_loading) {
+    using Clock = PipelineCompileTimings::Clock;
+    const auto elapsed_ns{[](Clock::time_point start) {
+        return static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }};
+    ShaderBenchmarkResults results;
+    std::unordered_set<u64> visited;
+    ShaderPools pools;
+
+    const auto benchmark{[&](u64 unique_hash, Shader::Environment& env, u32 cfg_offset,
+                             bool exits_to_dispatcher, bool emit) {
+        if (unique_hash == 0 || !visited.insert(unique_hash).second) {
+            return;
+        }
+        try {
+            const auto translate_start{Clock::now()};
+            Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, exits_to_dispatcher);
+            auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+            results.translate_ns += elapsed_ns(translate_start);
+            if (emit) {
+                const auto emit_start{Clock::now()};
+                for (u32 iteration = 0; iteration < iterations; ++iteration) {
+                    results.num_words += EmitSPIRV(profile, program).size();
+                }
+                results.emit_ns += elapsed_ns(emit_start);
+            }
+            ++results.num_shaders;
+        } catch (const Shader::Exception& exception) {
+            LOG_ERROR(Render_Vulkan, "0x{:016x}: {}", unique_hash, exception.what());
+        }
+        pools.ReleaseContents();
+    }};
+    const auto load_compute{[&](std::istream& file, FileEnvironment env) {
+        ComputePipelineCacheKey key;
+        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        benchmark(key.unique_hash, env, env.StartAddress(), false, true);
+    }};
+    const auto load_graphics{[&](std::istream& file, std::vector<FileEnvironment> envs) {
+        GraphicsPipelineCacheKey key;
+        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        size_t env_index{0};
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            if (key.unique_hashes[index] == 0) {
+                continue;
+            }
+            FileEnvironment& env{envs[env_index]};
+            ++env_index;
+            // VertexA programs are only emitted after being merged with VertexB
+            const u32 cfg_offset{
+                static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+            benchmark(key.unique_hashes[index], env, cfg_offset, index == 0, index != 0);
+        }
+    }};
+    VideoCommon::LoadPipelines(stop_loading, base_dir / "vulkan.bin", CACHE_VERSION, load_compute,
+                               load_graphics);
+    return results;
+}
+
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
     if (is_new) {
         pipeline = CreateGraphicsPipeline();
+        if (pipeline) {
+            pipelines_by_shaders[ShaderHashesKey(graphics_key)].push_back(pipeline.get());
+        }
     }
     if (!pipeline) {
         return nullptr;
@@ -599,6 +840,16 @@ GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const
     if (draw_state.index_buffer.count <= 6 || draw_state.vertex_buffer.count <= 6) {
         return pipeline;
     }
+    // Draw with a built pipeline of the same shaders instead of skipping the draw
+    const auto it{pipelines_by_shaders.find(ShaderHashesKey(pipeline->Key()))};
+    if (it == pipelines_by_shaders.end()) {
+        return nullptr;
+    }
+    for (GraphicsPipeline* const candidate : it->second) {
+        if (candidate->IsBuilt() && CanStandIn(candidate->Key(), pipeline->Key())) {
+            return candidate;
+        }
+    }
     return nullptr;
 }
 
@@ -608,11 +859,64 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     bool build_in_parallel) try {
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
-    size_t env_index{0};
+    Shader::CompileArenaScope arena_scope;
+    Shader::PassTimings pass_timings;
+    const Shader::PassTimingsScope pass_timings_scope{pass_timings};
+    const auto translate_start{PipelineCompileTimings::Clock::now()};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
     const bool uses_vertex_a{key.unique_hashes[0] != 0};
     const bool uses_vertex_b{key.unique_hashes[1] != 0};
 
+    std::array<Shader::Environment*, Maxwell::MaxShaderProgram> stage_envs{};
+    size_t env_index{0};
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (key.unique_hashes[index] != 0) {
+            stage_envs[index] = envs[env_index];
+            ++env_index;
+        }
+    }
+    // VertexB is merged into VertexA once both are translated
+    Shader::IR::Program program_vb;
+    const auto translate_stage{[&](size_t index, ShaderPools& stage_pools) {
+        Shader::Environment& env{*stage_envs[index]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        Shader::Maxwell::Flow::CFG cfg(env, stage_pools.flow_block, cfg_offset, index == 0);
+        Shader::IR::Program& program{uses_vertex_a && index == 1 ? program_vb : programs[index]};
+        program = TranslateProgram(stage_pools.inst, stage_pools.block, env, cfg, host_info);
+    }};
+    if (build_in_parallel) {
+        // The draw waits for this pipeline, translate its stages at the same time
+        std::array<Shader::PassTimings, Maxwell::MaxShaderProgram> stage_timings;
+        std::array<std::exception_ptr, Maxwell::MaxShaderProgram> stage_exceptions;
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            if (stage_envs[index] == nullptr) {
+                continue;
+            }
+            stage_workers.QueueWork([&, index] {
+                Shader::CompileArenaScope stage_arena_scope;
+                const Shader::PassTimingsScope stage_timings_scope{stage_timings[index]};
+                try {
+                    translate_stage(index, main_stage_pools[index]);
+                } catch (...) {
+                    stage_exceptions[index] = std::current_exception();
+                }
+            });
+        }
+        stage_workers.WaitForRequests();
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            pass_timings += stage_timings[index];
+            if (stage_exceptions[index]) {
+                std::rethrow_exception(stage_exceptions[index]);
+            }
+        }
+    } else {
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            if (stage_envs[index] != nullptr) {
+                translate_stage(index, pools);
+            }
+        }
+    }
+
     // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
     Shader::IR::Program* layer_source_program{};
 
@@ -628,31 +932,37 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         if (key.unique_hashes[index] == 0) {
             continue;
         }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-        } else {
+        Shader::Environment& env{*stage_envs[index]};
+        if (uses_vertex_a && index == 1) {
             // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+            programs[index] = MergeDualVertexPrograms(programs[0], program_vb, env);
         }
 
         if (Settings::values.dump_shaders) {
             env.Dump(hash, key.unique_hashes[index]);
         }
+        if (programs[index].info.uses_global_memory) {
+            ReportGlobalMemoryFallback(key.unique_hashes[index]);
+        }
 
         if (programs[index].info.requires_layer_emulation) {
             layer_source_program = &programs[index];
         }
     }
+    // Transform feedback captures the outputs the fragment stage doesn't read
+    constexpr size_t fragment_index{static_cast<size_t>(Maxwell::ShaderType::Pixel)};
+    if (key.state.xfb_enabled == 0 && key.unique_hashes[fragment_index] != 0 &&
+        layer_source_program == nullptr) {
+        for (size_t index = fragment_index - 1; index > 0; --index) {
+            if (key.unique_hashes[index] != 0) {
+                LinkStages(programs[index], programs[fragment_index]);
+                break;
+            }
+        }
+    }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
     std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    const auto emit_start{PipelineCompileTimings::Clock::now()};
 
     const Shader::IR::Program* previous_stage{};
     Shader::Backend::Bindings binding;
@@ -672,6 +982,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         const auto runtime_info{MakeRuntimeInfo(programs, key, program, previous_stage)};
         ConvertLegacyToGeneric(program, runtime_info);
         const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding)};
+        shader_code_charge.Add(static_cast<s64>(code.size() * sizeof(u32)));
         device.SaveShader(code);
         modules[stage_index] = BuildShader(device, code);
         if (device.HasDebuggingToolAttached()) {
@@ -680,11 +991,17 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         }
         previous_stage = &program;
     }
+    const auto build_start{PipelineCompileTimings::Clock::now()};
+    // Async pipelines are built on the workers, their build time ends once they are built
+    auto on_built{[this, hash, pass_timings, translate_start, emit_start, build_start] {
+        compile_timings.Record(hash, pass_timings, translate_start, emit_start, build_start,
+                               PipelineCompileTimings::Clock::now());
+    }};
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        descriptor_pool, descriptor_buffer, guest_descriptor_queue, thread_worker, statistics,
+        render_pass_cache, key, std::move(modules), infos, std::move(on_built));
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -709,6 +1026,9 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
 
     main_pools.ReleaseContents();
+    for (ShaderPools& stage_pools : main_stage_pools) {
+        stage_pools.ReleaseContents();
+    }
     auto pipeline{
         CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(), nullptr, true)};
     if (!pipeline || pipeline_cache_filename.empty()) {
@@ -756,6 +1076,10 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     }
 
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
+    Shader::CompileArenaScope arena_scope;
+    Shader::PassTimings pass_timings;
+    const Shader::PassTimingsScope pass_timings_scope{pass_timings};
+    const auto translate_start{PipelineCompileTimings::Clock::now()};
 
     Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
 
@@ -765,17 +1089,29 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     }
 
     auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+    if (program.info.uses_global_memory) {
+        ReportGlobalMemoryFallback(key.unique_hash);
+    }
+    const auto emit_start{PipelineCompileTimings::Clock::now()};
     const std::vector<u32> code{EmitSPIRV(profile, program)};
+    shader_code_charge.Add(static_cast<s64>(code.size() * sizeof(u32)));
     device.SaveShader(code);
     vk::ShaderModule spv_module{BuildShader(device, code)};
     if (device.HasDebuggingToolAttached()) {
         const auto name{fmt::format("Shader {:016x}", key.unique_hash)};
         spv_module.SetObjectNameEXT(name.c_str());
     }
+    const auto build_start{PipelineCompileTimings::Clock::now()};
+    // Async pipelines are built on the workers, their build time ends once they are built
+    auto on_built{[this, hash, pass_timings, translate_start, emit_start, build_start] {
+        compile_timings.Record(hash, pass_timings, translate_start, emit_start, build_start,
+                               PipelineCompileTimings::Clock::now());
+    }};
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
-    return std::make_unique<ComputePipeline>(device, vulkan_pipeline_cache, descriptor_pool,
-                                             guest_descriptor_queue, thread_worker, statistics,
-                                             &shader_notify, program.info, std::move(spv_module));
+    return std::make_unique<ComputePipeline>(
+        device, vulkan_pipeline_cache, descriptor_pool, descriptor_buffer, guest_descriptor_queue,
+        thread_worker, statistics, &shader_notify, program.info, std::move(spv_module),
+        key.unique_hash, std::move(on_built));
 
 } catch (const Shader::Exception& exception) {
     LOG_ERROR(Render_Vulkan, "{}", exception.what());
@@ -4,20 +4,26 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 #include "common/thread_worker.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/pass_timings.h"
 #include "shader_recompiler/profile.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
@@ -97,10 +103,41 @@ struct ShaderPools {
     Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
 };
 
+/// Accumulated time spent in each stage of pipeline compilation
+class PipelineCompileTimings {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Records the compilation of a pipeline, from the start of each stage to the end
+    void Record(u64 hash, const Shader::PassTimings& passes, Clock::time_point translate,
+                Clock::time_point emit, Clock::time_point build, Clock::time_point end);
+
+    /// Logs the accumulated timings sorted by cost and resets them
+    void Report();
+
+private:
+    std::mutex mutex;
+    Shader::PassTimings pass_ns;
+    std::vector<std::pair<u64, u64>> pipeline_ns; ///< Hash and total time of each pipeline
+    std::atomic<u64> translate_ns{};
+    std::atomic<u64> emit_ns{};
+    std::atomic<u64> build_ns{};
+    std::atomic<u64> num_pipelines{};
+};
+
+/// Results of replaying the shaders of a pipeline cache through the recompiler
+struct ShaderBenchmarkResults {
+    size_t num_shaders{};
+    size_t num_words{};
+    u64 translate_ns{};
+    u64 emit_ns{};
+};
+
 class PipelineCache : public VideoCommon::ShaderCache {
 public:
     explicit PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, const Device& device,
                            Scheduler& scheduler, DescriptorPool& descriptor_pool,
+                           DescriptorBuffer& descriptor_buffer,
                            GuestDescriptorQueue& guest_descriptor_queue,
                            RenderPassCache& render_pass_cache, BufferCache& buffer_cache,
                            TextureCache& texture_cache, VideoCore::ShaderNotify& shader_notify_);
@@ -113,6 +150,16 @@ public:
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback);
 
+    /// Loads the pipeline cache files of a directory, building every pipeline in them
+    void LoadDiskResources(const std::filesystem::path& base_dir, std::stop_token stop_loading,
+                           const VideoCore::DiskResourceLoadCallback& callback);
+
+    /// Translates every unique shader of a pipeline cache directory once and emits it to SPIR-V
+    /// the given number of times, without building any pipeline
+    [[nodiscard]] ShaderBenchmarkResults BenchmarkShaders(const std::filesystem::path& base_dir,
+                                                          u32 iterations,
+                                                          std::stop_token stop_loading);
+
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
@@ -143,6 +190,7 @@ private:
     const Device& device;
     Scheduler& scheduler;
     DescriptorPool& descriptor_pool;
+    DescriptorBuffer& descriptor_buffer;
     GuestDescriptorQueue& guest_descriptor_queue;
     RenderPassCache& render_pass_cache;
     BufferCache& buffer_cache;
@@ -156,8 +204,12 @@ private:
 
     std::unordered_map<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>> compute_cache;
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
+    /// Graphics pipelines indexed by the hash of their shaders, to find stand-ins for pending ones
+    std::unordered_map<u64, std::vector<GraphicsPipeline*>> pipelines_by_shaders;
 
     ShaderPools main_pools;
+    /// Pools of the stages translated in parallel for the pipelines the draw waits for
+    std::array<ShaderPools, Maxwell::MaxShaderProgram> main_stage_pools;
 
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
@@ -167,7 +219,13 @@ private:
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
+    PipelineCompileTimings compile_timings;
+    /// Size of the SPIR-V emitted for the pipelines, released after the workers have stopped
+    Common::MemoryAccounting::Charge shader_code_charge{
+        Common::MemoryAccounting::Category::ShaderCache};
+
     Common::ThreadWorker workers;
+    Common::ThreadWorker stage_workers;
     Common::ThreadWorker serialization_thread;
     DynamicFeatures dynamic_features;
 };
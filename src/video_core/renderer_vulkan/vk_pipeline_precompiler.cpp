@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/settings.h"
+#include "core/frontend/emu_window.h"
+#include "video_core/renderer_vulkan/renderer_vulkan.h"
+#include "video_core/renderer_vulkan/vk_pipeline_precompiler.h"
+#include "video_core/vulkan_common/vulkan_instance.h"
+#include "video_core/vulkan_common/vulkan_library.h"
+
+namespace Vulkan {
+
+PipelinePrecompiler::PipelinePrecompiler()
+    : library(OpenLibrary()),
+      instance(CreateInstance(*library, dld, VK_API_VERSION_1_1,
+                              Core::Frontend::WindowSystemType::Headless,
+                              Settings::values.renderer_debug.GetValue())),
+      device(CreateDevice(instance, dld, nullptr)), memory_allocator(device),
+      scheduler(device, state_tracker), device_memory(guest_memory),
+      staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, scheduler),
+      descriptor_buffer(device, memory_allocator, scheduler),
+      guest_descriptor_queue(device, scheduler), compute_pass_descriptor_queue(device, scheduler),
+      render_pass_cache(device),
+      blit_image(device, scheduler, state_tracker, descriptor_pool, render_pass_cache),
+      texture_cache_runtime{
+          device,     scheduler,         memory_allocator, staging_pool,
+          blit_image, render_pass_cache, descriptor_pool,  compute_pass_descriptor_queue},
+      texture_cache(texture_cache_runtime, device_memory),
+      buffer_cache_runtime(device, memory_allocator, scheduler, staging_pool,
+                           guest_descriptor_queue, compute_pass_descriptor_queue, descriptor_pool),
+      buffer_cache(device_memory, buffer_cache_runtime),
+      pipeline_cache(device_memory, device, scheduler, descriptor_pool, descriptor_buffer,
+                     guest_descriptor_queue, render_pass_cache, buffer_cache, texture_cache,
+                     shader_notify) {}
+
+PipelinePrecompiler::~PipelinePrecompiler() {
+    scheduler.Finish();
+}
+
+void PipelinePrecompiler::Compile(const std::filesystem::path& base_dir,
+                                  std::stop_token stop_token,
+                                  const VideoCore::DiskResourceLoadCallback& callback) {
+    pipeline_cache.LoadDiskResources(base_dir, stop_token, callback);
+}
+
+ShaderBenchmarkResults PipelinePrecompiler::Benchmark(const std::filesystem::path& base_dir,
+                                                      u32 iterations, std::stop_token stop_token) {
+    return pipeline_cache.BenchmarkShaders(base_dir, iterations, stop_token);
+}
+
+} // namespace Vulkan
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "common/dynamic_library.h"
+#include "common/polyfill_thread.h"
+#include "core/device_memory.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_vulkan/blit_image.h"
+#include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_pipeline_cache.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
+#include "video_core/renderer_vulkan/vk_state_tracker.h"
+#include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/shader_notify.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+/**
+ * Headless pipeline cache builder.
+ * Replays the environments of a pipeline cache through the shader recompiler and the pipeline
+ * cache on the device selected in the settings, without booting a title. The driver pipeline
+ * cache is only written when use_vulkan_driver_pipeline_cache is enabled before construction.
+ */
+class PipelinePrecompiler {
+public:
+    explicit PipelinePrecompiler();
+    ~PipelinePrecompiler();
+
+    PipelinePrecompiler(const PipelinePrecompiler&) = delete;
+    PipelinePrecompiler& operator=(const PipelinePrecompiler&) = delete;
+
+    /// Builds every pipeline of base_dir/vulkan.bin, writing base_dir/vulkan_pipelines.bin
+    void Compile(const std::filesystem::path& base_dir, std::stop_token stop_token,
+                 const VideoCore::DiskResourceLoadCallback& callback);
+
+    /// Measures the shader recompiler on every unique shader of base_dir/vulkan.bin
+    [[nodiscard]] ShaderBenchmarkResults Benchmark(const std::filesystem::path& base_dir,
+                                                   u32 iterations, std::stop_token stop_token);
+
+    [[nodiscard]] const Device& GetDevice() const noexcept {
+        return device;
+    }
+
+private:
+    std::shared_ptr<Common::DynamicLibrary> library;
+    vk::InstanceDispatch dld;
+    vk::Instance instance;
+    Device device;
+    MemoryAllocator memory_allocator;
+    StateTracker state_tracker;
+    Scheduler scheduler;
+
+    Core::DeviceMemory guest_memory;
+    Tegra::MaxwellDeviceMemoryManager device_memory;
+    VideoCore::ShaderNotify shader_notify;
+
+    StagingBufferPool staging_pool;
+    DescriptorPool descriptor_pool;
+    DescriptorBuffer descriptor_buffer;
+    GuestDescriptorQueue guest_descriptor_queue;
+    ComputePassDescriptorQueue compute_pass_descriptor_queue;
+    RenderPassCache render_pass_cache;
+    BlitImageHelper blit_image;
+
+    TextureCacheRuntime texture_cache_runtime;
+    TextureCache texture_cache;
+    BufferCacheRuntime buffer_cache_runtime;
+    BufferCache buffer_cache;
+    PipelineCache pipeline_cache;
+};
+
+} // namespace Vulkan
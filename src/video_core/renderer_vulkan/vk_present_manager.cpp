@@ -5,6 +5,7 @@
 #include "common/settings.h"
 #include "common/thread.h"
 #include "core/frontend/emu_window.h"
+#include "video_core/gpu.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_swapchain.h"
@@ -18,6 +19,11 @@ MICROPROFILE_DEFINE(Vulkan_CopyToSwapchain, "Vulkan", "Copy to swapchain", MP_RG
 
 namespace {
 
+using PresentClock = std::chrono::steady_clock;
+
+// Longest time the present thread blocks on a single presentation to be displayed
+constexpr u64 PRESENT_WAIT_TIMEOUT_NS = 50'000'000;
+
 bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat format) {
     const VkFormatProperties props{physical_device.GetFormatProperties(format)};
     return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
@@ -97,12 +103,13 @@ bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat form
 PresentManager::PresentManager(const vk::Instance& instance_,
                                Core::Frontend::EmuWindow& render_window_, const Device& device_,
                                MemoryAllocator& memory_allocator_, Scheduler& scheduler_,
-                               Swapchain& swapchain_, vk::SurfaceKHR& surface_)
+                               Swapchain& swapchain_, vk::SurfaceKHR& surface_, Tegra::GPU& gpu_)
     : instance{instance_}, render_window{render_window_}, device{device_},
       memory_allocator{memory_allocator_}, scheduler{scheduler_}, swapchain{swapchain_},
-      surface{surface_}, blit_supported{CanBlitToSwapchain(device.GetPhysical(),
-                                                           swapchain.GetImageViewFormat())},
-      use_present_thread{Settings::values.async_presentation.GetValue()} {
+      surface{surface_}, gpu{gpu_}, blit_supported{CanBlitToSwapchain(
+                                        device.GetPhysical(), swapchain.GetImageViewFormat())},
+      use_present_thread{Settings::values.async_presentation.GetValue()},
+      low_latency{Settings::values.low_latency_presentation.GetValue()} {
     SetImageCount();
 
     auto& dld = device.GetLogical();
@@ -158,6 +165,8 @@ Frame* PresentManager::GetRenderFrame() {
 }
 
 void PresentManager::Present(Frame* frame) {
+    frame->submit_time = PresentClock::now();
+
     if (!use_present_thread) {
         scheduler.WaitWorker();
         CopyToSwapchain(frame);
@@ -297,6 +306,10 @@ void PresentManager::SetImageCount() {
     // FRAMES_IN_FLIGHT is 8, and the cache TICKS_TO_DESTROY is 8.
     // Mali drivers will give us 6.
     image_count = std::min<size_t>(swapchain.GetImageCount(), 7);
+
+    // The queue is at most image_count - 1 presentations deep, or one in low latency mode
+    present_submit_times.assign(image_count + 1, {});
+    queue_depth = 1;
 }
 
 void PresentManager::CopyToSwapchain(Frame* frame) {
@@ -483,6 +496,62 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
 
     // Present
     swapchain.Present(render_semaphore);
+
+    PacePresentation(frame);
+}
+
+void PresentManager::PacePresentation(const Frame* frame) {
+    if (!use_present_thread) {
+        // Presenting on the GPU thread, blocking on the display would stall emulation
+        return;
+    }
+    const u64 last_id = swapchain.GetLastPresentId();
+    if (last_id == 0) {
+        // Present wait is not supported, presentation is paced by the swapchain images
+        return;
+    }
+    const auto now = PresentClock::now();
+    const auto frame_interval = now - last_present_time;
+    last_present_time = now;
+    present_submit_times[last_id % present_submit_times.size()] = frame->submit_time;
+
+    // Keep at most queue_depth presentations waiting to be displayed
+    const u64 depth = low_latency ? 1 : queue_depth;
+    if (last_id <= depth) {
+        return;
+    }
+    const u64 wait_id = last_id - depth;
+    if (!swapchain.WaitForPresent(wait_id, PRESENT_WAIT_TIMEOUT_NS)) {
+        return;
+    }
+    const auto displayed = PresentClock::now();
+    gpu.RendererFrameDisplayedNotify(displayed);
+
+    // Input was sampled by the guest around one frame before the frame was submitted. Ids
+    // presented before the swapchain was recreated have no submission time.
+    const auto submit_time = present_submit_times[wait_id % present_submit_times.size()];
+    if (submit_time != PresentClock::time_point{}) {
+        gpu.RendererPresentLatencyNotify(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            displayed - submit_time + frame_interval));
+    }
+
+    if (low_latency || frame_interval <= PresentClock::duration::zero() ||
+        frame_interval > std::chrono::nanoseconds{PRESENT_WAIT_TIMEOUT_NS}) {
+        return;
+    }
+    // Blocking for most of the frame means the display is the bottleneck and the queue only adds
+    // latency. Barely blocking means frames arrive just in time and a deeper queue smooths out
+    // variations in the frame time.
+    const double ratio = std::chrono::duration<double>(displayed - now) /
+                         std::chrono::duration<double>(frame_interval);
+    wait_ratio = wait_ratio * 0.9 + ratio * 0.1;
+    if (wait_ratio > 0.5 && queue_depth > 1) {
+        --queue_depth;
+        wait_ratio = 0.25;
+    } else if (wait_ratio < 0.125 && queue_depth + 1 < image_count) {
+        ++queue_depth;
+        wait_ratio = 0.25;
+    }
 }
 
 } // namespace Vulkan
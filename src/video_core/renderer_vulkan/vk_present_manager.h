@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -16,6 +18,10 @@ namespace Core::Frontend {
 class EmuWindow;
 } // namespace Core::Frontend
 
+namespace Tegra {
+class GPU;
+}
+
 namespace Vulkan {
 
 class Device;
@@ -31,13 +37,14 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    std::chrono::steady_clock::time_point submit_time;
 };
 
 class PresentManager {
 public:
     PresentManager(const vk::Instance& instance, Core::Frontend::EmuWindow& render_window,
                    const Device& device, MemoryAllocator& memory_allocator, Scheduler& scheduler,
-                   Swapchain& swapchain, vk::SurfaceKHR& surface);
+                   Swapchain& swapchain, vk::SurfaceKHR& surface, Tegra::GPU& gpu);
     ~PresentManager();
 
     /// Returns the last used presentation frame
@@ -64,6 +71,9 @@ private:
 
     void SetImageCount();
 
+    /// Limits the number of presentations queued for display and measures their latency
+    void PacePresentation(const Frame* frame);
+
 private:
     const vk::Instance& instance;
     Core::Frontend::EmuWindow& render_window;
@@ -72,6 +82,7 @@ private:
     Scheduler& scheduler;
     Swapchain& swapchain;
     vk::SurfaceKHR& surface;
+    Tegra::GPU& gpu;
     vk::CommandPool cmdpool;
     std::vector<Frame> frames;
     std::queue<Frame*> present_queue;
@@ -84,7 +95,15 @@ private:
     std::jthread present_thread;
     bool blit_supported;
     bool use_present_thread;
+    bool low_latency;
     std::size_t image_count{};
+
+    /// Submission times of the presentations that can still be waited on, by present id modulo
+    /// a size above the deepest queue, so a waited id never shares a slot with the latest one
+    std::vector<std::chrono::steady_clock::time_point> present_submit_times;
+    std::chrono::steady_clock::time_point last_present_time{};
+    u64 queue_depth{1};
+    double wait_ratio{};
 };
 
 } // namespace Vulkan
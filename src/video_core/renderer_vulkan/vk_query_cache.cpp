@@ -63,20 +63,8 @@ public:
         next_bank = 0;
     }
 
-    void Sync(size_t start, size_t size) {
-        const auto& dev = device.GetLogical();
-        const VkResult query_result = dev.GetQueryResults(
-            *query_pool, static_cast<u32>(start), static_cast<u32>(size), sizeof(u64) * size,
-            &host_results[start], sizeof(u64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-        switch (query_result) {
-        case VK_SUCCESS:
-            return;
-        case VK_ERROR_DEVICE_LOST:
-            device.ReportLoss();
-            [[fallthrough]];
-        default:
-            throw vk::Exception(query_result);
-        }
+    void Sync(std::span<const u8> readback, size_t start, size_t size) {
+        std::memcpy(&host_results[start], readback.data(), sizeof(u64) * size);
     }
 
     VkQueryPool GetInnerPool() {
@@ -110,15 +98,30 @@ struct HostSyncValues {
     static constexpr bool GeneratesBaseBuffer = false;
 };
 
+/// Results of a set of sample queries copied to host memory, read once its fence is signaled
+struct SamplesReadback {
+    struct Range {
+        size_t bank_id;
+        size_t start;
+        size_t amount;
+        size_t offset;
+    };
+
+    StagingBufferRef staging;
+    std::vector<Range> ranges;
+    std::vector<size_t> queries;
+};
+
 class SamplesStreamer : public BaseStreamer {
 public:
     explicit SamplesStreamer(size_t id_, QueryCacheRuntime& runtime_,
                              VideoCore::RasterizerInterface* rasterizer_, const Device& device_,
                              Scheduler& scheduler_, const MemoryAllocator& memory_allocator_,
+                             StagingBufferPool& staging_pool_,
                              ComputePassDescriptorQueue& compute_pass_descriptor_queue,
                              DescriptorPool& descriptor_pool)
         : BaseStreamer(id_), runtime{runtime_}, rasterizer{rasterizer_}, device{device_},
-          scheduler{scheduler_}, memory_allocator{memory_allocator_} {
+          scheduler{scheduler_}, memory_allocator{memory_allocator_}, staging_pool{staging_pool_} {
         current_bank = nullptr;
         current_query = nullptr;
         amend_value = 0;
@@ -352,23 +355,69 @@ public:
     void PushUnsyncedQueries() override {
         PauseCounter();
         current_bank->Close();
-        {
-            std::scoped_lock lk(flush_guard);
-            pending_flush_sets.emplace_back(std::move(pending_flush_queries));
+
+        // Copy the results of the whole set with a single copy per bank, so they can be read from
+        // host memory once the fence is signaled instead of waiting on each query pool
+        SamplesReadback readback;
+        size_t readback_size = 0;
+        ApplyBanksWideOp<true>(pending_flush_queries, [&](SamplesQueryBank* bank, size_t start,
+                                                          size_t amount) {
+            readback.ranges.push_back({
+                .bank_id = bank->GetIndex(),
+                .start = start,
+                .amount = amount,
+                .offset = readback_size,
+            });
+            readback_size += amount * SamplesQueryBank::QUERY_SIZE;
+        });
+        readback.staging = staging_pool.Request(readback_size, MemoryUsage::Download, true);
+        std::vector<std::pair<VkQueryPool, SamplesReadback::Range>> copies;
+        copies.reserve(readback.ranges.size());
+        for (const SamplesReadback::Range& range : readback.ranges) {
+            copies.emplace_back(bank_pool.GetBank(range.bank_id).GetInnerPool(), range);
+        }
+        static constexpr VkMemoryBarrier READ_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+        };
+        scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.Record([copies = std::move(copies), buffer = readback.staging.buffer,
+                          base_offset = readback.staging.offset](vk::CommandBuffer cmdbuf) {
+            for (const auto& [query_pool, range] : copies) {
+                cmdbuf.CopyQueryPoolResults(query_pool, static_cast<u32>(range.start),
+                                            static_cast<u32>(range.amount), buffer,
+                                            base_offset + range.offset,
+                                            SamplesQueryBank::QUERY_SIZE,
+                                            VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
+            }
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+                                   READ_BARRIER);
+        });
+        readback.queries = std::move(pending_flush_queries);
+
+        std::scoped_lock lk(flush_guard);
+        for (auto& staging_ref : free_queue) {
+            staging_pool.FreeDeferred(staging_ref);
         }
+        free_queue.clear();
+        pending_flush_sets.emplace_back(std::move(readback));
     }
 
     void PopUnsyncedQueries() override {
-        std::vector<size_t> current_flush_queries;
+        SamplesReadback readback;
         {
             std::scoped_lock lk(flush_guard);
-            current_flush_queries = std::move(pending_flush_sets.front());
+            readback = std::move(pending_flush_sets.front());
             pending_flush_sets.pop_front();
         }
-        ApplyBanksWideOp<false>(
-            current_flush_queries,
-            [](SamplesQueryBank* bank, size_t start, size_t amount) { bank->Sync(start, amount); });
-        for (auto q : current_flush_queries) {
+        const std::span<const u8> mapped = readback.staging.mapped_span;
+        for (const SamplesReadback::Range& range : readback.ranges) {
+            bank_pool.GetBank(range.bank_id).Sync(mapped.subspan(range.offset), range.start,
+                                                  range.amount);
+        }
+        for (auto q : readback.queries) {
             auto* query = GetQuery(q);
             u64 total = 0;
             ApplyBankOp(query, [&total](SamplesQueryBank* bank, size_t start, size_t amount) {
@@ -380,6 +429,9 @@ public:
             query->value = total;
             query->flags |= VideoCommon::QueryFlagBits::IsFinalValueSynced;
         }
+
+        std::scoped_lock lk(flush_guard);
+        free_queue.emplace_back(readback.staging);
     }
 
 private:
@@ -557,6 +609,7 @@ private:
     const Device& device;
     Scheduler& scheduler;
     const MemoryAllocator& memory_allocator;
+    StagingBufferPool& staging_pool;
     VideoCommon::BankPool<SamplesQueryBank> bank_pool;
     std::deque<vk::Buffer> buffers;
     std::array<size_t, 32> resolve_table{};
@@ -570,7 +623,8 @@ private:
 
     // flush levels
     std::vector<size_t> pending_flush_queries;
-    std::deque<std::vector<size_t>> pending_flush_sets;
+    std::deque<SamplesReadback> pending_flush_sets;
+    std::vector<StagingBufferRef> free_queue;
 
     // State Machine
     size_t current_bank_slot;
@@ -1166,8 +1220,8 @@ struct QueryCacheRuntimeImpl {
           memory_allocator{memory_allocator_}, scheduler{scheduler_}, staging_pool{staging_pool_},
           guest_streamer(0, runtime),
           sample_streamer(static_cast<size_t>(QueryType::ZPassPixelCount64), runtime, rasterizer,
-                          device, scheduler, memory_allocator, compute_pass_descriptor_queue,
-                          descriptor_pool),
+                          device, scheduler, memory_allocator, staging_pool,
+                          compute_pass_descriptor_queue, descriptor_pool),
           tfb_streamer(static_cast<size_t>(QueryType::StreamingByteCount), runtime, device,
                        scheduler, memory_allocator, staging_pool),
           primitives_succeeded_streamer(
@@ -3,19 +3,23 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 
 #include "common/assert.h"
+#include "common/boot_timeline.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "video_core/buffer_cache/buffer_cache.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/engines/draw_manager.h"
+#include "video_core/engines/engine_upload.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
@@ -35,6 +39,7 @@
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/shader_cache.h"
 #include "video_core/texture_cache/texture_cache_base.h"
+#include "video_core/textures/decoders.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -171,8 +176,10 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
     : gpu{gpu_}, device_memory{device_memory_}, screen_info{screen_info_}, device{device_},
       memory_allocator{memory_allocator_}, state_tracker{state_tracker_}, scheduler{scheduler_},
       staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, scheduler),
+      descriptor_buffer(device, memory_allocator, scheduler),
       guest_descriptor_queue(device, scheduler), compute_pass_descriptor_queue(device, scheduler),
-      blit_image(device, scheduler, state_tracker, descriptor_pool), render_pass_cache(device),
+      render_pass_cache(device),
+      blit_image(device, scheduler, state_tracker, descriptor_pool, render_pass_cache),
       texture_cache_runtime{
           device,     scheduler,         memory_allocator, staging_pool,
           blit_image, render_pass_cache, descriptor_pool,  compute_pass_descriptor_queue},
@@ -183,9 +190,11 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
       query_cache_runtime(this, device_memory, buffer_cache, device, memory_allocator, scheduler,
                           staging_pool, compute_pass_descriptor_queue, descriptor_pool),
       query_cache(gpu, *this, device_memory, query_cache_runtime),
-      pipeline_cache(device_memory, device, scheduler, descriptor_pool, guest_descriptor_queue,
-                     render_pass_cache, buffer_cache, texture_cache, gpu.ShaderNotify()),
-      accelerate_dma(buffer_cache, texture_cache, scheduler),
+      pipeline_cache(device_memory, device, scheduler, descriptor_pool, descriptor_buffer,
+                     guest_descriptor_queue, render_pass_cache, buffer_cache, texture_cache,
+                     gpu.ShaderNotify()),
+      dma_swizzle_pass(device, scheduler, descriptor_pool, compute_pass_descriptor_queue),
+      accelerate_dma(buffer_cache, texture_cache, scheduler, dma_swizzle_pass),
       fence_manager(*this, gpu, texture_cache, buffer_cache, query_cache, device, scheduler),
       wfi_event(device.GetLogical().CreateEvent()) {
     scheduler.SetQueryCache(query_cache);
@@ -341,6 +350,8 @@ void RasterizerVulkan::Clear(u32 layer_count) {
     texture_cache.UpdateRenderTargets(true);
     const Framebuffer* const framebuffer = texture_cache.GetFramebuffer();
     const VkExtent2D render_area = framebuffer->RenderArea();
+    // Dynamic state is set before the render pass is requested, so clears can be folded into it
+    UpdateViewportsState(regs);
     scheduler.RequestRenderpass(framebuffer);
 
     u32 up_scale = 1;
@@ -349,7 +360,6 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         up_scale = Settings::values.resolution_info.up_scale;
         down_shift = Settings::values.resolution_info.down_shift;
     }
-    UpdateViewportsState(regs);
 
     VkRect2D default_scissor;
     default_scissor.offset.x = 0;
@@ -370,6 +380,11 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         .width = std::min(clear_rect.rect.extent.width, render_area.width),
         .height = std::min(clear_rect.rect.extent.height, render_area.height),
     };
+    const bool is_full_clear = clear_rect.rect.offset.x == 0 && clear_rect.rect.offset.y == 0 &&
+                               clear_rect.rect.extent.width == render_area.width &&
+                               clear_rect.rect.extent.height == render_area.height &&
+                               clear_rect.baseArrayLayer == 0 &&
+                               clear_rect.layerCount == framebuffer->Attachments().num_layers;
 
     const u32 color_attachment = regs.clear_surface.RT;
     if (use_color && framebuffer->HasAspectColorBit(color_attachment)) {
@@ -397,14 +412,18 @@ void RasterizerVulkan::Clear(u32 layer_count) {
 
         if (regs.clear_surface.R && regs.clear_surface.G && regs.clear_surface.B &&
             regs.clear_surface.A) {
-            scheduler.Record([color_attachment, clear_value, clear_rect](vk::CommandBuffer cmdbuf) {
-                const VkClearAttachment attachment{
-                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                    .colorAttachment = color_attachment,
-                    .clearValue = clear_value,
-                };
-                cmdbuf.ClearAttachments(attachment, clear_rect);
-            });
+            // Tilers clear the attachment for free when it is cleared on load
+            if (!is_full_clear || !scheduler.FoldColorClear(color_attachment, clear_value.color)) {
+                scheduler.Record(
+                    [color_attachment, clear_value, clear_rect](vk::CommandBuffer cmdbuf) {
+                        const VkClearAttachment attachment{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .colorAttachment = color_attachment,
+                            .clearValue = clear_value,
+                        };
+                        cmdbuf.ClearAttachments(attachment, clear_rect);
+                    });
+            }
         } else {
             u8 color_mask = static_cast<u8>(regs.clear_surface.R | regs.clear_surface.G << 1 |
                                             regs.clear_surface.B << 2 | regs.clear_surface.A << 3);
@@ -443,15 +462,20 @@ void RasterizerVulkan::Clear(u32 layer_count) {
                                      static_cast<u8>(regs.stencil_front_mask), regs.clear_stencil,
                                      regs.stencil_front_func_mask, dst_region);
     } else {
-        scheduler.Record([clear_depth = regs.clear_depth, clear_stencil = regs.clear_stencil,
-                          clear_rect, aspect_flags](vk::CommandBuffer cmdbuf) {
-            VkClearAttachment attachment;
-            attachment.aspectMask = aspect_flags;
-            attachment.colorAttachment = 0;
-            attachment.clearValue.depthStencil.depth = clear_depth;
-            attachment.clearValue.depthStencil.stencil = clear_stencil;
-            cmdbuf.ClearAttachments(attachment, clear_rect);
-        });
+        const VkClearDepthStencilValue value{
+            .depth = regs.clear_depth,
+            .stencil = regs.clear_stencil,
+        };
+        if (!is_full_clear || !scheduler.FoldDepthStencilClear(aspect_flags, value)) {
+            scheduler.Record([value, clear_rect, aspect_flags](vk::CommandBuffer cmdbuf) {
+                const VkClearAttachment attachment{
+                    .aspectMask = aspect_flags,
+                    .colorAttachment = 0,
+                    .clearValue{.depthStencil = value},
+                };
+                cmdbuf.ClearAttachments(attachment, clear_rect);
+            });
+        }
     }
 }
 
@@ -475,15 +499,19 @@ void RasterizerVulkan::DispatchCompute() {
         const auto [buffer, offset] =
             buffer_cache.ObtainBuffer(*indirect_address, 12, sync_info, post_op);
         scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.ProfileComputeDispatch(pipeline->UniqueHash());
         scheduler.Record([indirect_buffer = buffer->Handle(),
                           indirect_offset = offset](vk::CommandBuffer cmdbuf) {
             cmdbuf.DispatchIndirect(indirect_buffer, indirect_offset);
         });
+        scheduler.EndProfiledPass();
         return;
     }
     const std::array<u32, 3> dim{qmd.grid_dim_x, qmd.grid_dim_y, qmd.grid_dim_z};
     scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.ProfileComputeDispatch(pipeline->UniqueHash());
     scheduler.Record([dim](vk::CommandBuffer cmdbuf) { cmdbuf.Dispatch(dim[0], dim[1], dim[2]); });
+    scheduler.EndProfiledPass();
 }
 
 void RasterizerVulkan::ResetCounter(VideoCommon::QueryType type) {
@@ -552,6 +580,14 @@ VideoCore::RasterizerDownloadArea RasterizerVulkan::GetFlushArea(DAddr addr, u64
             return *area;
         }
     }
+    if (Settings::GetHotSettings().use_readback_prediction) {
+        // Buffers that were not predicted are downloaded when the guest reads them
+        std::scoped_lock lock{buffer_cache.mutex};
+        auto area = buffer_cache.GetFlushArea(addr, size);
+        if (area) {
+            return *area;
+        }
+    }
     VideoCore::RasterizerDownloadArea new_area{
         .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
         .end_address = Common::AlignUp(addr + size, Core::DEVICE_PAGESIZE),
@@ -638,6 +674,34 @@ void RasterizerVulkan::OnCacheInvalidation(DAddr addr, u64 size) {
     pipeline_cache.InvalidateRegion(addr, size);
 }
 
+void RasterizerVulkan::OnCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> ranges) {
+    // Same as invalidating each range on its own, taking every lock once
+    const auto is_empty{[](const std::pair<DAddr, std::size_t>& range) {
+        return range.first == 0 || range.second == 0;
+    }};
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& range : ranges) {
+            if (!is_empty(range)) {
+                texture_cache.WriteMemory(range.first, range.second);
+            }
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& range : ranges) {
+            if (!is_empty(range)) {
+                buffer_cache.WriteMemory(range.first, range.second);
+            }
+        }
+    }
+    for (const auto& range : ranges) {
+        if (!is_empty(range)) {
+            pipeline_cache.InvalidateRegion(range.first, range.second);
+        }
+    }
+}
+
 void RasterizerVulkan::InvalidateGPUCache() {
     gpu.InvalidateGPUCache();
 }
@@ -735,6 +799,17 @@ void RasterizerVulkan::TickFrame() {
     compute_pass_descriptor_queue.TickFrame();
     fence_manager.TickFrame();
     staging_pool.TickFrame();
+    frame_gpu_time = scheduler.CollectGpuTime();
+    static auto& render_pass_restarts = Common::Metrics::GetRegistry().RegisterHistogram(
+        "yuzu_vulkan_render_pass_restarts",
+        "Render passes begun again on the targets of the previous one, per frame",
+        {0, 1, 2, 4, 8, 16, 32, 64, 128, 256});
+    render_pass_restarts.Observe(scheduler.ResetRenderPassRestarts());
+    UpdateDynamicResolution();
+    if (++frames_since_memory_metrics >= MEMORY_METRICS_INTERVAL) {
+        frames_since_memory_metrics = 0;
+        memory_allocator.UpdateMetrics();
+    }
     {
         std::scoped_lock lock{texture_cache.mutex};
         texture_cache.TickFrame();
@@ -745,6 +820,33 @@ void RasterizerVulkan::TickFrame() {
     }
 }
 
+void RasterizerVulkan::UpdateDynamicResolution() {
+    const auto& resolution = Settings::values.resolution_info;
+    bool is_native = false;
+    if (!Settings::values.dynamic_resolution.GetValue() || resolution.up_factor <= 1.0f) {
+        // Downscaled render targets are already cheaper than native ones
+        if (dynamic_resolution.IsNative()) {
+            // Disabled while running at native resolution
+            dynamic_resolution.Reset();
+        }
+    } else {
+        const u16 target_fps = Settings::values.dynamic_resolution_target_fps.GetValue();
+        const std::chrono::nanoseconds target{std::chrono::seconds{1}};
+        is_native = dynamic_resolution.Update(frame_gpu_time, target / target_fps,
+                                              resolution.up_factor * resolution.up_factor);
+    }
+    if (resolution.up_factor > 1.0f && thermal_throttled.load(std::memory_order_relaxed)) {
+        // Upscaling is the largest share of the GPU work that can be dropped without the guest
+        // noticing, the configured resolution comes back once the host has cooled down
+        is_native = true;
+    }
+    if (is_native != force_native_resolution) {
+        force_native_resolution = is_native;
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.SetForceNativeResolution(is_native);
+    }
+}
+
 bool RasterizerVulkan::AccelerateConditionalRendering() {
     gpu_memory->FlushCaching();
     return query_cache.AccelerateHostConditionalRendering();
@@ -783,6 +885,75 @@ void RasterizerVulkan::AccelerateInlineToMemory(GPUVAddr address, size_t copy_si
     query_cache.InvalidateRegion(*cpu_addr, copy_size);
 }
 
+bool RasterizerVulkan::AccelerateInlineToBlockLinear(const Tegra::Engines::Upload::Registers& regs,
+                                                     std::span<const u8> memory) {
+    static constexpr u32 UNIT_SIZE = 16;
+    const auto& dest = regs.dest;
+    const GPUVAddr address = dest.Address();
+    // Same restrictions as the swizzle of DMA copies on the GPU
+    if (dest.BlockWidth() != 0 || dest.depth != 1 || dest.y >= dest.height ||
+        regs.line_length_in == 0 || (dest.x | regs.line_length_in) % UNIT_SIZE != 0 ||
+        address % UNIT_SIZE != 0) {
+        return false;
+    }
+    const auto cpu_addr = gpu_memory->GpuToCpuAddress(address);
+    if (!cpu_addr) {
+        return false;
+    }
+    const u32 image_size = static_cast<u32>(Tegra::Texture::CalculateSize(
+        true, 1, dest.width, dest.height, 1, dest.BlockHeight(), dest.BlockDepth()));
+    const u32 extent_y = std::min(regs.line_count, dest.height - dest.y);
+    const u32 data_size = regs.line_length_in * extent_y;
+    if (image_size == 0 || memory.size() < data_size) {
+        return false;
+    }
+
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    // Only the latest contents held by the GPU make the write to guest memory a round trip, and
+    // images over the region are refreshed from guest memory so they need the write
+    if (!buffer_cache.IsRegionGpuModified(*cpu_addr, image_size)) {
+        return false;
+    }
+    Tegra::DMA::ImageOperand image_operand{};
+    image_operand.bytes_per_pixel = 1;
+    image_operand.params.block_size.height.Assign(dest.BlockHeight());
+    image_operand.params.block_size.depth.Assign(dest.BlockDepth());
+    image_operand.params.width = dest.width;
+    image_operand.params.height = dest.height;
+    image_operand.params.depth = dest.depth;
+    image_operand.params.layer = dest.layer;
+    image_operand.params.origin.x.Assign(dest.x);
+    image_operand.params.origin.y.Assign(dest.y);
+    image_operand.address = address;
+    if (texture_cache.DmaImageId(image_operand, true) != VideoCommon::NULL_IMAGE_ID) {
+        return false;
+    }
+
+    const auto staging = staging_pool.Request(data_size, MemoryUsage::Upload);
+    std::memcpy(staging.mapped_span.data(), memory.data(), data_size);
+    static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::FullSynchronize;
+    static constexpr auto post_op = VideoCommon::ObtainBufferOperation::MarkAsWritten;
+    const auto [buffer, offset] = buffer_cache.ObtainBuffer(address, image_size, sync_info, post_op);
+    dma_swizzle_pass.Copy(DmaSwizzleCopy{
+        .block_linear_buffer = buffer->Handle(),
+        .block_linear_offset = offset,
+        .block_linear_size = image_size,
+        .pitch_linear_buffer = staging.buffer,
+        .pitch_linear_offset = static_cast<u32>(staging.offset),
+        .pitch_linear_size = data_size,
+        .pitch = regs.line_length_in,
+        .origin_x = dest.x,
+        .origin_y = dest.y,
+        .extent_x = regs.line_length_in,
+        .extent_y = extent_y,
+        .width = dest.width,
+        .block_height = dest.BlockHeight(),
+        .block_depth = dest.BlockDepth(),
+        .is_swizzle = true,
+    });
+    return true;
+}
+
 bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                          DAddr framebuffer_addr, u32 pixel_stride) {
     if (!framebuffer_addr) {
@@ -804,6 +975,8 @@ bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
 
 void RasterizerVulkan::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
+    const Common::BootTimeline::ScopedStage boot_stage{"disk_resources"};
+    texture_cache.LoadDiskResources(title_id);
     pipeline_cache.LoadDiskResources(title_id, stop_loading, callback);
 }
 
@@ -831,8 +1004,9 @@ void RasterizerVulkan::FlushWork() {
 }
 
 AccelerateDMA::AccelerateDMA(BufferCache& buffer_cache_, TextureCache& texture_cache_,
-                             Scheduler& scheduler_)
-    : buffer_cache{buffer_cache_}, texture_cache{texture_cache_}, scheduler{scheduler_} {}
+                             Scheduler& scheduler_, DmaSwizzlePass& swizzle_pass_)
+    : buffer_cache{buffer_cache_}, texture_cache{texture_cache_}, scheduler{scheduler_},
+      swizzle_pass{swizzle_pass_} {}
 
 bool AccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
     std::scoped_lock lock{buffer_cache.mutex};
@@ -851,7 +1025,7 @@ bool AccelerateDMA::DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
     std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
     const auto image_id = texture_cache.DmaImageId(image_operand, IS_IMAGE_UPLOAD);
     if (image_id == VideoCommon::NULL_IMAGE_ID) {
-        return false;
+        return DmaBufferSwizzle(copy_info, buffer_operand, image_operand, IS_IMAGE_UPLOAD);
     }
     const u32 buffer_size = static_cast<u32>(buffer_operand.pitch * buffer_operand.height);
     static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::FullSynchronize;
@@ -877,6 +1051,66 @@ bool AccelerateDMA::DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
     return true;
 }
 
+bool AccelerateDMA::DmaBufferSwizzle(const Tegra::DMA::ImageCopy& copy_info,
+                                     const Tegra::DMA::BufferOperand& buffer_operand,
+                                     const Tegra::DMA::ImageOperand& image_operand,
+                                     bool is_swizzle) {
+    const auto& params = image_operand.params;
+    // Same layouts as the swizzle done on the CPU, which also ignores the layer
+    if (image_operand.bytes_per_pixel != 1 || params.block_size.width != 0 || params.depth != 1 ||
+        params.origin.y >= params.height) {
+        return false;
+    }
+    // The shader moves 16 bytes at a time, their offsets and the pitch must be aligned to that
+    static constexpr u32 UNIT_SIZE = 16;
+    const u32 origin_x = params.origin.x;
+    if ((origin_x | copy_info.length_x | buffer_operand.pitch) % UNIT_SIZE != 0 ||
+        (buffer_operand.address | image_operand.address) % UNIT_SIZE != 0 ||
+        copy_info.length_x == 0 || copy_info.length_x > buffer_operand.pitch) {
+        return false;
+    }
+    const u32 extent_y = std::min(copy_info.length_y, params.height - params.origin.y);
+    const u32 block_height = params.block_size.height;
+    const u32 block_depth = params.block_size.depth;
+    const u32 image_size = static_cast<u32>(Tegra::Texture::CalculateSize(
+        true, 1, params.width, params.height, 1, block_height, block_depth));
+    const u32 buffer_size = buffer_operand.pitch * extent_y;
+    if (image_size == 0 || buffer_size == 0) {
+        return false;
+    }
+
+    const auto buffers =
+        is_swizzle ? buffer_cache.ObtainCopyBuffers(buffer_operand.address, buffer_size,
+                                                    image_operand.address, image_size)
+                   : buffer_cache.ObtainCopyBuffers(image_operand.address, image_size,
+                                                    buffer_operand.address, buffer_size);
+    if (!buffers) {
+        return false;
+    }
+    // Buffers start at caching page boundaries, so their offsets keep the alignment of the
+    // addresses
+    const auto [image_buffer, image_offset] = (*buffers)[is_swizzle ? 1 : 0];
+    const auto [buffer, buffer_offset] = (*buffers)[is_swizzle ? 0 : 1];
+    swizzle_pass.Copy(DmaSwizzleCopy{
+        .block_linear_buffer = image_buffer->Handle(),
+        .block_linear_offset = image_offset,
+        .block_linear_size = image_size,
+        .pitch_linear_buffer = buffer->Handle(),
+        .pitch_linear_offset = buffer_offset,
+        .pitch_linear_size = buffer_size,
+        .pitch = buffer_operand.pitch,
+        .origin_x = origin_x,
+        .origin_y = params.origin.y,
+        .extent_x = copy_info.length_x,
+        .extent_y = extent_y,
+        .width = params.width,
+        .block_height = block_height,
+        .block_depth = block_depth,
+        .is_swizzle = is_swizzle,
+    });
+    return true;
+}
+
 bool AccelerateDMA::ImageToBuffer(const Tegra::DMA::ImageCopy& copy_info,
                                   const Tegra::DMA::ImageOperand& image_operand,
                                   const Tegra::DMA::BufferOperand& buffer_operand) {
@@ -922,9 +1156,16 @@ void RasterizerVulkan::UpdateDynamicStates() {
         if (device.IsExtExtendedDynamicState2ExtrasSupported()) {
             UpdateLogicOp(regs);
         }
-        if (device.IsExtExtendedDynamicState3Supported()) {
+        if (device.IsExtExtendedDynamicState3BlendingSupported()) {
             UpdateBlending(regs);
         }
+        if (device.IsExtExtendedDynamicState3RasterizationSupported()) {
+            UpdatePolygonMode(regs);
+            UpdateAlphaToCoverage(regs);
+            UpdateLineRasterizationMode(regs);
+            UpdateConservativeRasterizationMode(regs);
+            UpdateProvokingVertexMode(regs);
+        }
     }
     if (device.IsExtVertexInputDynamicStateSupported()) {
         UpdateVertexInput(regs);
@@ -1455,6 +1696,58 @@ void RasterizerVulkan::UpdateStencilTestEnable(Tegra::Engines::Maxwell3D::Regs&
     });
 }
 
+void RasterizerVulkan::UpdatePolygonMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchPolygonMode()) {
+        return;
+    }
+    scheduler.Record([mode = MaxwellToVK::PolygonMode(regs.polygon_mode_front)](
+                         vk::CommandBuffer cmdbuf) { cmdbuf.SetPolygonModeEXT(mode); });
+}
+
+void RasterizerVulkan::UpdateAlphaToCoverage(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchAlphaToCoverage()) {
+        return;
+    }
+    scheduler.Record([control = regs.anti_alias_alpha_control](vk::CommandBuffer cmdbuf) {
+        cmdbuf.SetAlphaToCoverageEnableEXT(control.alpha_to_coverage != 0);
+        cmdbuf.SetAlphaToOneEnableEXT(control.alpha_to_one != 0);
+    });
+}
+
+void RasterizerVulkan::UpdateLineRasterizationMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!device.IsExtLineRasterizationSupported() ||
+        !state_tracker.TouchLineRasterizationMode()) {
+        return;
+    }
+    const VkLineRasterizationModeEXT mode = regs.line_anti_alias_enable != 0
+                                                ? VK_LINE_RASTERIZATION_MODE_RECTANGULAR_SMOOTH_EXT
+                                                : VK_LINE_RASTERIZATION_MODE_RECTANGULAR_EXT;
+    scheduler.Record(
+        [mode](vk::CommandBuffer cmdbuf) { cmdbuf.SetLineRasterizationModeEXT(mode); });
+}
+
+void RasterizerVulkan::UpdateConservativeRasterizationMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!device.IsExtConservativeRasterizationSupported() ||
+        !state_tracker.TouchConservativeRasterizationMode()) {
+        return;
+    }
+    const VkConservativeRasterizationModeEXT mode =
+        regs.conservative_raster_enable != 0 ? VK_CONSERVATIVE_RASTERIZATION_MODE_OVERESTIMATE_EXT
+                                             : VK_CONSERVATIVE_RASTERIZATION_MODE_DISABLED_EXT;
+    scheduler.Record(
+        [mode](vk::CommandBuffer cmdbuf) { cmdbuf.SetConservativeRasterizationModeEXT(mode); });
+}
+
+void RasterizerVulkan::UpdateProvokingVertexMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!device.IsExtProvokingVertexSupported() || !state_tracker.TouchProvokingVertexMode()) {
+        return;
+    }
+    const VkProvokingVertexModeEXT mode = regs.provoking_vertex == Maxwell::ProvokingVertex::Last
+                                              ? VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT
+                                              : VK_PROVOKING_VERTEX_MODE_FIRST_VERTEX_EXT;
+    scheduler.Record([mode](vk::CommandBuffer cmdbuf) { cmdbuf.SetProvokingVertexModeEXT(mode); });
+}
+
 void RasterizerVulkan::UpdateVertexInput(Tegra::Engines::Maxwell3D::Regs& regs) {
     auto& dirty{maxwell3d->dirty.flags};
     if (!dirty[Dirty::VertexInput]) {
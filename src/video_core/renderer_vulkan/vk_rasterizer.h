@@ -4,16 +4,21 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 
 #include <boost/container/static_vector.hpp>
 
 #include "common/common_types.h"
 #include "video_core/control/channel_state_cache.h"
+#include "video_core/dynamic_resolution.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_vulkan/blit_image.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_fence_manager.h"
 #include "video_core/renderer_vulkan/vk_pipeline_cache.h"
@@ -50,7 +55,7 @@ class StateTracker;
 class AccelerateDMA : public Tegra::Engines::AccelerateDMAInterface {
 public:
     explicit AccelerateDMA(BufferCache& buffer_cache, TextureCache& texture_cache,
-                           Scheduler& scheduler);
+                           Scheduler& scheduler, DmaSwizzlePass& swizzle_pass);
 
     bool BufferCopy(GPUVAddr start_address, GPUVAddr end_address, u64 amount) override;
 
@@ -68,9 +73,16 @@ private:
                             const Tegra::DMA::BufferOperand& src,
                             const Tegra::DMA::ImageOperand& dst);
 
+    /// Swizzles between the buffers of a copy on the GPU when no image is cached over the block
+    /// linear operand, instead of the CPU swizzling guest memory
+    bool DmaBufferSwizzle(const Tegra::DMA::ImageCopy& copy_info,
+                          const Tegra::DMA::BufferOperand& buffer_operand,
+                          const Tegra::DMA::ImageOperand& image_operand, bool is_swizzle);
+
     BufferCache& buffer_cache;
     TextureCache& texture_cache;
     Scheduler& scheduler;
+    DmaSwizzlePass& swizzle_pass;
 };
 
 class RasterizerVulkan final : public VideoCore::RasterizerInterface,
@@ -103,6 +115,7 @@ public:
                           VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
     void InnerInvalidation(std::span<const std::pair<DAddr, std::size_t>> sequences) override;
     void OnCacheInvalidation(DAddr addr, u64 size) override;
+    void OnCacheInvalidation(std::span<const std::pair<DAddr, std::size_t>> ranges) override;
     bool OnCPUWrite(DAddr addr, u64 size) override;
     void InvalidateGPUCache() override;
     void UnmapMemory(DAddr addr, u64 size) override;
@@ -119,6 +132,18 @@ public:
     void TiledCacheBarrier() override;
     void FlushCommands() override;
     void TickFrame() override;
+
+    /// Returns the GPU time of the submissions completed during the last frame
+    [[nodiscard]] std::chrono::nanoseconds FrameGpuTime() const noexcept {
+        return frame_gpu_time;
+    }
+
+    /// Draws rescalable render targets at native resolution while the host is throttled.
+    /// Safe to call from any thread, it takes effect at the end of the next frame.
+    void SetThermalThrottling(bool throttled) noexcept {
+        thermal_throttled.store(throttled, std::memory_order_relaxed);
+    }
+
     bool AccelerateConditionalRendering() override;
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
                                const Tegra::Engines::Fermi2D::Surface& dst,
@@ -126,6 +151,8 @@ public:
     Tegra::Engines::AccelerateDMAInterface& AccessAccelerateDMA() override;
     void AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
                                   std::span<const u8> memory) override;
+    bool AccelerateInlineToBlockLinear(const Tegra::Engines::Upload::Registers& regs,
+                                       std::span<const u8> memory) override;
     bool AccelerateDisplay(const Tegra::FramebufferConfig& config, DAddr framebuffer_addr,
                            u32 pixel_stride) override;
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
@@ -143,6 +170,8 @@ private:
     static constexpr size_t MAX_IMAGE_VIEWS = MAX_TEXTURES + MAX_IMAGES;
 
     static constexpr VkDeviceSize DEFAULT_BUFFER_SIZE = 4 * sizeof(float);
+    /// Frames between exports of the memory allocator metrics
+    static constexpr u32 MEMORY_METRICS_INTERVAL = 120;
 
     template <typename Func>
     void PrepareDraw(bool is_indexed, Func&&);
@@ -176,9 +205,16 @@ private:
     void UpdateStencilTestEnable(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateLogicOp(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateBlending(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdatePolygonMode(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdateAlphaToCoverage(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdateLineRasterizationMode(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdateConservativeRasterizationMode(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdateProvokingVertexMode(Tegra::Engines::Maxwell3D::Regs& regs);
 
     void UpdateVertexInput(Tegra::Engines::Maxwell3D::Regs& regs);
 
+    void UpdateDynamicResolution();
+
     Tegra::GPU& gpu;
     Tegra::MaxwellDeviceMemoryManager& device_memory;
 
@@ -190,10 +226,11 @@ private:
 
     StagingBufferPool staging_pool;
     DescriptorPool descriptor_pool;
+    DescriptorBuffer descriptor_buffer;
     GuestDescriptorQueue guest_descriptor_queue;
     ComputePassDescriptorQueue compute_pass_descriptor_queue;
-    BlitImageHelper blit_image;
     RenderPassCache render_pass_cache;
+    BlitImageHelper blit_image;
 
     TextureCacheRuntime texture_cache_runtime;
     TextureCache texture_cache;
@@ -202,6 +239,7 @@ private:
     QueryCacheRuntime query_cache_runtime;
     QueryCache query_cache;
     PipelineCache pipeline_cache;
+    DmaSwizzlePass dma_swizzle_pass;
     AccelerateDMA accelerate_dma;
     FenceManager fence_manager;
 
@@ -212,6 +250,12 @@ private:
     boost::container::static_vector<VkSampler, MAX_TEXTURES> sampler_handles;
 
     u32 draw_counter = 0;
+    u32 frames_since_memory_metrics = 0;
+
+    std::chrono::nanoseconds frame_gpu_time{};
+    VideoCommon::DynamicResolution dynamic_resolution;
+    std::atomic_bool thermal_throttled{};
+    bool force_native_resolution{};
 };
 
 } // namespace Vulkan
@@ -14,6 +14,7 @@
 namespace Vulkan {
 namespace {
 using VideoCore::Surface::PixelFormat;
+using VideoCore::Surface::SurfaceType;
 
 VkAttachmentDescription AttachmentDescription(const Device& device, PixelFormat format,
                                               VkSampleCountFlagBits samples) {
@@ -32,6 +33,77 @@ VkAttachmentDescription AttachmentDescription(const Device& device, PixelFormat
 }
 } // Anonymous namespace
 
+void BeginRenderPass(vk::CommandBuffer cmdbuf, VkRenderPass render_pass,
+                     VkFramebuffer framebuffer, const RenderingAttachments& attachments,
+                     VkExtent2D render_area, const RenderingClears& clears) {
+    if (framebuffer) {
+        cmdbuf.BeginRenderPass(
+            {
+                .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                .pNext = nullptr,
+                .renderPass = render_pass,
+                .framebuffer = framebuffer,
+                .renderArea{
+                    .offset{},
+                    .extent = render_area,
+                },
+                .clearValueCount = 0,
+                .pClearValues = nullptr,
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+        return;
+    }
+    const auto attachment_info{[](VkImageView image_view, bool clear, VkClearValue clear_value) {
+        // Tilers skip reading the attachment from memory when it is cleared on load
+        return VkRenderingAttachmentInfo{
+            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext = nullptr,
+            .imageView = image_view,
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .resolveMode = VK_RESOLVE_MODE_NONE,
+            .resolveImageView = nullptr,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp = clear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+            .clearValue = clear_value,
+        };
+    }};
+    std::array<VkRenderingAttachmentInfo, 8> color_attachments;
+    for (u32 index = 0; index < attachments.num_colors; ++index) {
+        color_attachments[index] =
+            attachment_info(attachments.color_views[index], ((clears.color_mask >> index) & 1) != 0,
+                            VkClearValue{.color = clears.colors[index]});
+    }
+    const VkClearValue depth_stencil_value{.depthStencil = clears.depth_stencil};
+    const VkRenderingAttachmentInfo depth_attachment{
+        attachment_info(attachments.depth_view, clears.depth, depth_stencil_value)};
+    const VkRenderingAttachmentInfo stencil_attachment{
+        attachment_info(attachments.depth_view, clears.stencil, depth_stencil_value)};
+    cmdbuf.BeginRendering({
+        .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .renderArea{
+            .offset{},
+            .extent = render_area,
+        },
+        .layerCount = attachments.num_layers,
+        .viewMask = 0,
+        .colorAttachmentCount = attachments.num_colors,
+        .pColorAttachments = color_attachments.data(),
+        .pDepthAttachment = attachments.has_depth ? &depth_attachment : nullptr,
+        .pStencilAttachment = attachments.has_stencil ? &stencil_attachment : nullptr,
+    });
+}
+
+void EndRenderPass(vk::CommandBuffer cmdbuf, VkFramebuffer framebuffer) {
+    if (framebuffer) {
+        cmdbuf.EndRenderPass();
+    } else {
+        cmdbuf.EndRendering();
+    }
+}
+
 RenderPassCache::RenderPassCache(const Device& device_) : device{&device_} {}
 
 VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
@@ -89,7 +161,55 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
         .dependencyCount = 0,
         .pDependencies = nullptr,
     });
+    if (device->IsKhrDynamicRenderingSupported()) {
+        AddRenderingFormats(*pair->second, key);
+    }
     return *pair->second;
 }
 
+const VkPipelineRenderingCreateInfo* RenderPassCache::RenderingInfo(VkRenderPass render_pass) {
+    std::scoped_lock lock{mutex};
+    const auto it = rendering_formats.find(render_pass);
+    return it != rendering_formats.end() ? &it->second.rendering_ci : nullptr;
+}
+
+void RenderPassCache::AddRenderingFormats(VkRenderPass render_pass, const RenderPassKey& key) {
+    using MaxwellToVK::SurfaceFormat;
+    // Entries are never erased, pipelines keep pointing to the formats after the lock is released
+    RenderingFormats& formats = rendering_formats[render_pass];
+    u32 num_colors{};
+    for (size_t index = 0; index < key.color_formats.size(); ++index) {
+        const PixelFormat format{key.color_formats[index]};
+        if (format == PixelFormat::Invalid) {
+            formats.color_formats[index] = VK_FORMAT_UNDEFINED;
+            continue;
+        }
+        formats.color_formats[index] =
+            SurfaceFormat(*device, FormatType::Optimal, true, format).format;
+        num_colors = static_cast<u32>(index + 1);
+    }
+    VkFormat depth_format{VK_FORMAT_UNDEFINED};
+    VkFormat stencil_format{VK_FORMAT_UNDEFINED};
+    if (key.depth_format != PixelFormat::Invalid) {
+        const VkFormat format{
+            SurfaceFormat(*device, FormatType::Optimal, true, key.depth_format).format};
+        const SurfaceType type{VideoCore::Surface::GetFormatType(key.depth_format)};
+        if (type == SurfaceType::Depth || type == SurfaceType::DepthStencil) {
+            depth_format = format;
+        }
+        if (type == SurfaceType::Stencil || type == SurfaceType::DepthStencil) {
+            stencil_format = format;
+        }
+    }
+    formats.rendering_ci = VkPipelineRenderingCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext = nullptr,
+        .viewMask = 0,
+        .colorAttachmentCount = num_colors,
+        .pColorAttachmentFormats = formats.color_formats.data(),
+        .depthAttachmentFormat = depth_format,
+        .stencilAttachmentFormat = stencil_format,
+    };
+}
+
 } // namespace Vulkan
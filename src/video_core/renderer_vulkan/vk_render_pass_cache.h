@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <mutex>
 #include <unordered_map>
 
@@ -19,6 +20,36 @@ struct RenderPassKey {
     VkSampleCountFlagBits samples;
 };
 
+/// Views bound to a render pass when rendering without framebuffer objects
+struct RenderingAttachments {
+    bool operator==(const RenderingAttachments&) const noexcept = default;
+
+    std::array<VkImageView, 8> color_views{};
+    VkImageView depth_view{};
+    u32 num_colors{};
+    u32 num_layers{1};
+    bool has_depth{};
+    bool has_stencil{};
+};
+
+/// Clears of whole attachments done by the load operations of a render pass
+struct RenderingClears {
+    std::array<VkClearColorValue, 8> colors{};
+    VkClearDepthStencilValue depth_stencil{};
+    u32 color_mask{};
+    bool depth{};
+    bool stencil{};
+};
+
+/// Begins a render pass, using dynamic rendering when no framebuffer object is given. Clears are
+/// only folded into dynamic render passes, render pass objects always load their attachments.
+void BeginRenderPass(vk::CommandBuffer cmdbuf, VkRenderPass render_pass,
+                     VkFramebuffer framebuffer, const RenderingAttachments& attachments,
+                     VkExtent2D render_area, const RenderingClears& clears = {});
+
+/// Ends a render pass started with BeginRenderPass
+void EndRenderPass(vk::CommandBuffer cmdbuf, VkFramebuffer framebuffer);
+
 } // namespace Vulkan
 
 namespace std {
@@ -45,9 +76,21 @@ public:
 
     VkRenderPass Get(const RenderPassKey& key);
 
+    /// Returns the attachment formats to chain to pipelines using the render pass, or nullptr
+    /// when the device renders with framebuffer objects
+    const VkPipelineRenderingCreateInfo* RenderingInfo(VkRenderPass render_pass);
+
 private:
+    struct RenderingFormats {
+        std::array<VkFormat, 8> color_formats{};
+        VkPipelineRenderingCreateInfo rendering_ci{};
+    };
+
+    void AddRenderingFormats(VkRenderPass render_pass, const RenderPassKey& key);
+
     const Device* device{};
     std::unordered_map<RenderPassKey, vk::RenderPass> cache;
+    std::unordered_map<VkRenderPass, RenderingFormats> rendering_formats;
     std::mutex mutex;
 };
 
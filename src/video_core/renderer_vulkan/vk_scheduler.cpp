@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -8,9 +10,12 @@
 
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
@@ -22,6 +27,27 @@ namespace Vulkan {
 
 MICROPROFILE_DECLARE(Vulkan_WaitForWorker);
 
+namespace {
+/// Number of worker threads recording command buffers
+size_t NumRecorders() {
+    if (!Settings::values.vulkan_parallel_recording.GetValue()) {
+        return 1;
+    }
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 2, 4);
+}
+
+/// Number of submissions that can be timed at once
+constexpr u32 NUM_TIMESTAMP_SLOTS = 64;
+
+/// Returns true when a feature or setting needs the GPU time of the submissions
+bool NeedsGpuTime() {
+    return Settings::values.dynamic_resolution.GetValue() || Settings::values.record_frame_times ||
+           Settings::values.profile_gpu_passes.GetValue() ||
+           (Settings::values.renderer_force_max_clock.GetValue() &&
+            Settings::values.force_max_clock_load.GetValue() > 0);
+}
+} // Anonymous namespace
+
 void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
                                          vk::CommandBuffer upload_cmdbuf) {
     auto command = first;
@@ -39,14 +65,36 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 
 Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
     : device{device_}, state_tracker{state_tracker_},
-      master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      master_semaphore{std::make_unique<MasterSemaphore>(device)} {
     AcquireNewChunk();
-    AllocateWorkerCommandBuffer();
-    worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
+    next_submit_tick = master_semaphore->CurrentTick();
+    statistics_start = std::chrono::steady_clock::now();
+
+    if (Settings::values.profile_gpu_passes.GetValue() && device.SupportsTimestamps()) {
+        pass_profiler = std::make_unique<PassProfiler>(device);
+    }
+
+    const size_t num_recorders = NumRecorders();
+    recorders.reserve(num_recorders);
+    worker_threads.reserve(num_recorders);
+    for (size_t index = 0; index < num_recorders; ++index) {
+        Recorder& recorder = *recorders.emplace_back(std::make_unique<Recorder>());
+        recorder.command_pool = std::make_unique<CommandPool>(*master_semaphore, device);
+        worker_threads.emplace_back(
+            [this, &recorder](std::stop_token token) { WorkerThread(token, recorder); });
+    }
+    if (recorders.size() > 1) {
+        LOG_INFO(Render_Vulkan, "Recording command buffers on {} threads", recorders.size());
+    }
 }
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler() {
+    if (pass_profiler) {
+        master_semaphore->Refresh();
+        pass_profiler->Collect(*master_semaphore);
+        pass_profiler->Report();
+    }
+}
 
 u64 Scheduler::Flush(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     // When flushing, we only send data to the worker thread; no waiting is necessary.
@@ -63,72 +111,159 @@ void Scheduler::Finish(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore)
     AllocateNewContext();
 }
 
+std::chrono::nanoseconds Scheduler::CollectGpuTime() {
+    if (pending_timestamp_slots.empty() && !pass_profiler) {
+        return std::chrono::nanoseconds{0};
+    }
+    master_semaphore->Refresh();
+    if (pass_profiler) {
+        pass_profiler->Collect(*master_semaphore);
+    }
+    const auto& dev = device.GetLogical();
+    u64 num_ticks = 0;
+    while (!pending_timestamp_slots.empty() &&
+           master_semaphore->IsFree(pending_timestamp_slots.front().first)) {
+        const u32 slot = pending_timestamp_slots.front().second;
+        pending_timestamp_slots.pop_front();
+        std::array<u64, 2> timestamps{};
+        if (dev.GetQueryResults(*timestamp_pool, slot * 2, 2, sizeof(timestamps),
+                                timestamps.data(), sizeof(u64),
+                                VK_QUERY_RESULT_64_BIT) == VK_SUCCESS &&
+            timestamps[1] > timestamps[0]) {
+            num_ticks += timestamps[1] - timestamps[0];
+        }
+        dev.ResetQueryPool(*timestamp_pool, slot * 2, 2);
+        free_timestamp_slots.push_back(slot);
+    }
+    const f64 nanoseconds = static_cast<f64>(num_ticks) * device.GetTimestampPeriod();
+    return std::chrono::nanoseconds{static_cast<s64>(nanoseconds)};
+}
+
 void Scheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
     DispatchWork();
 
-    // Ensure the queue is drained.
-    {
-        std::unique_lock ql{queue_mutex};
-        event_cv.wait(ql, [this] { return work_queue.empty(); });
+    // Wait for all dispatched chunks to be recorded.
+    if (pending_chunks.load(std::memory_order::acquire) == 0) {
+        return;
     }
-
-    // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+    std::unique_lock lock{idle_mutex};
+    idle_cv.wait(lock, [this] { return pending_chunks.load(std::memory_order::acquire) == 0; });
 }
 
 void Scheduler::DispatchWork() {
     if (chunk->Empty()) {
         return;
     }
-    {
-        std::scoped_lock ql{queue_mutex};
-        work_queue.push(std::move(chunk));
+    const bool has_submit = chunk->HasSubmit();
+    const size_t depth = pending_chunks.fetch_add(1, std::memory_order::relaxed) + 1;
+    if (depth > max_pending_chunks.load(std::memory_order::relaxed)) {
+        max_pending_chunks.store(depth, std::memory_order::relaxed);
+    }
+    recorders[dispatch_recorder]->work_queue.EmplaceWait(std::move(chunk));
+    if (has_submit) {
+        // Work after this chunk goes to new command buffers, possibly on another thread.
+        dispatch_recorder = (dispatch_recorder + 1) % recorders.size();
     }
-    event_cv.notify_all();
     AcquireNewChunk();
 }
 
 void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     const VkRenderPass renderpass = framebuffer->RenderPass();
     const VkFramebuffer framebuffer_handle = framebuffer->Handle();
+    const RenderingAttachments& attachments = framebuffer->Attachments();
     const VkExtent2D render_area = framebuffer->RenderArea();
     if (renderpass == state.renderpass && framebuffer_handle == state.framebuffer &&
-        render_area.width == state.render_area.width &&
+        attachments == state.attachments && render_area.width == state.render_area.width &&
         render_area.height == state.render_area.height) {
         return;
     }
     EndRenderPass();
     state.renderpass = renderpass;
     state.framebuffer = framebuffer_handle;
+    state.attachments = attachments;
+    state.targets = framebuffer->RenderTargets();
     state.render_area = render_area;
+    state.clears = {};
+    state.begin_pending = true;
 
-    Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
-        const VkRenderPassBeginInfo renderpass_bi{
-            .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-            .pNext = nullptr,
-            .renderPass = renderpass,
-            .framebuffer = framebuffer_handle,
-            .renderArea =
-                {
-                    .offset = {.x = 0, .y = 0},
-                    .extent = render_area,
-                },
-            .clearValueCount = 0,
-            .pClearValues = nullptr,
-        };
-        cmdbuf.BeginRenderPass(renderpass_bi, VK_SUBPASS_CONTENTS_INLINE);
-    });
     num_renderpass_images = framebuffer->NumImages();
     renderpass_images = framebuffer->Images();
     renderpass_image_ranges = framebuffer->ImageRanges();
+    profiled_pipeline = nullptr;
+}
+
+bool Scheduler::FoldColorClear(u32 attachment, const VkClearColorValue& value) {
+    if (!state.begin_pending || state.framebuffer) {
+        return false;
+    }
+    state.clears.colors[attachment] = value;
+    state.clears.color_mask |= 1U << attachment;
+    return true;
+}
+
+bool Scheduler::FoldDepthStencilClear(VkImageAspectFlags aspects,
+                                      const VkClearDepthStencilValue& value) {
+    if (!state.begin_pending || state.framebuffer) {
+        return false;
+    }
+    if ((aspects & VK_IMAGE_ASPECT_DEPTH_BIT) != 0) {
+        state.clears.depth_stencil.depth = value.depth;
+        state.clears.depth = true;
+    }
+    if ((aspects & VK_IMAGE_ASPECT_STENCIL_BIT) != 0) {
+        state.clears.depth_stencil.stencil = value.stencil;
+        state.clears.stencil = true;
+    }
+    return true;
 }
 
 void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
 
+void Scheduler::BeginProfiledPass(const PassKey& key) {
+    if (!pass_profiler) {
+        return;
+    }
+    EndProfiledPass();
+    profiled_pass_query = pass_profiler->BeginPass(key, CurrentTick());
+    if (!profiled_pass_query) {
+        return;
+    }
+    profiled_pass_key = key;
+    RecordWithUploadBuffer([pool = pass_profiler->QueryPool(), query = *profiled_pass_query](
+                               vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, query);
+    });
+}
+
+void Scheduler::EndProfiledPass() {
+    if (!profiled_pass_query) {
+        return;
+    }
+    RecordWithUploadBuffer([pool = pass_profiler->QueryPool(), query = *profiled_pass_query + 1](
+                               vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, query);
+    });
+    profiled_pass_query.reset();
+}
+
+void Scheduler::ProfileComputeDispatch(u64 shader_hash) {
+    BeginProfiledPass(PassKey{
+        .type = PassType::Compute,
+        .shader_hashes{shader_hash},
+    });
+}
+
 bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline) {
+    if (pass_profiler && profiled_pipeline != pipeline) {
+        profiled_pipeline = pipeline;
+        if (state.renderpass && !state.begin_pending) {
+            // Time the draws of each pipeline in the render pass apart
+            BeginProfiledPass(RenderPassProfileKey());
+        }
+    }
     if (state.graphics_pipeline == pipeline) {
         return false;
     }
@@ -145,69 +280,61 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
     return true;
 }
 
-void Scheduler::WorkerThread(std::stop_token stop_token) {
-    Common::SetCurrentThreadName("VulkanWorker");
+bool Scheduler::UpdateDescriptorBuffer() {
+    if (state.descriptor_buffer_bound) {
+        return false;
+    }
+    state.descriptor_buffer_bound = true;
+    return true;
+}
 
-    const auto TryPopQueue{[this](auto& work) -> bool {
-        if (work_queue.empty()) {
-            return false;
+void Scheduler::WorkerThread(std::stop_token stop_token, Recorder& recorder) {
+    Common::SetCurrentThreadName("VulkanWorker");
+    Common::SetCurrentThreadCoreClass(Common::ThreadCoreClass::Performance);
+
+    // Submissions are dispatched round robin, every chunk until a submit goes to the same worker.
+    // Chunks that were already dispatched are drained even when stopping, later submissions on
+    // other workers wait for ours to be sent to the queue.
+    bool begin_submission = true;
+    std::unique_ptr<CommandChunk> work;
+    while (recorder.work_queue.PopWait(work, stop_token)) {
+        if (begin_submission) {
+            AllocateWorkerCommandBuffer(recorder);
         }
 
-        work = std::move(work_queue.front());
-        work_queue.pop();
-        event_cv.notify_all();
-        return true;
-    }};
-
-    while (!stop_token.stop_requested()) {
-        std::unique_ptr<CommandChunk> work;
-
-        {
-            std::unique_lock lk{queue_mutex};
-
-            // Wait for work.
-            Common::CondvarWait(event_cv, lk, stop_token, [&] { return TryPopQueue(work); });
-
-            // If we've been asked to stop, we're done.
-            if (stop_token.stop_requested()) {
-                return;
-            }
-
-            // Exchange lock ownership so that we take the execution lock before
-            // the queue lock goes out of scope. This allows us to force execution
-            // to complete in the next step.
-            std::exchange(lk, std::unique_lock{execution_mutex});
-
-            // Perform the work, tracking whether the chunk was a submission
-            // before executing.
-            const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+        // Perform the work, tracking whether the chunk was a submission
+        // before executing.
+        begin_submission = work->HasSubmit();
+        work->ExecuteAll(recorder.cmdbuf, recorder.upload_cmdbuf);
+        executed_chunks.fetch_add(1, std::memory_order::relaxed);
 
-            // If the chunk was a submission, reallocate the command buffer.
-            if (has_submit) {
-                AllocateWorkerCommandBuffer();
-            }
+        // Recycle the chunk back to the GPU thread, dropping it if it has enough in reserve.
+        if (!recorder.free_queue.TryEmplace(std::move(work))) {
+            work.reset();
         }
 
-        {
-            std::scoped_lock rl{reserve_mutex};
-
-            // Recycle the chunk back to the reserve.
-            chunk_reserve.emplace_back(std::move(work));
+        if (pending_chunks.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+            std::scoped_lock lock{idle_mutex};
+            idle_cv.notify_all();
+        }
+        if (begin_submission) {
+            UpdateRecordingStatistics();
         }
     }
 }
 
-void Scheduler::AllocateWorkerCommandBuffer() {
-    current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_cmdbuf.Begin({
+void Scheduler::AllocateWorkerCommandBuffer(Recorder& recorder) {
+    recorder.cmdbuf =
+        vk::CommandBuffer(recorder.command_pool->Commit(), device.GetDispatchLoader());
+    recorder.cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_upload_cmdbuf.Begin({
+    recorder.upload_cmdbuf =
+        vk::CommandBuffer(recorder.command_pool->Commit(), device.GetDispatchLoader());
+    recorder.upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
@@ -215,12 +342,80 @@ void Scheduler::AllocateWorkerCommandBuffer() {
     });
 }
 
+void Scheduler::WaitForSubmitTurn(u64 signal_value) {
+    std::unique_lock lock{submit_order_mutex};
+    submit_order_cv.wait(lock, [this, signal_value] { return next_submit_tick == signal_value; });
+}
+
+void Scheduler::EndSubmitTurn(u64 signal_value) {
+    {
+        std::scoped_lock lock{submit_order_mutex};
+        next_submit_tick = signal_value + 1;
+    }
+    submit_order_cv.notify_all();
+}
+
+void Scheduler::UpdateRecordingStatistics() {
+    static constexpr auto STATISTICS_PERIOD = std::chrono::seconds{5};
+
+    std::unique_lock lock{statistics_mutex, std::try_to_lock};
+    if (!lock) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = now - statistics_start;
+    if (elapsed < STATISTICS_PERIOD) {
+        return;
+    }
+    const u64 chunks = executed_chunks.exchange(0);
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    LOG_DEBUG(Render_Vulkan,
+              "Recorded {:.0f} chunks per second on {} threads, maximum queue depth {}",
+              chunks / seconds, recorders.size(), ResetMaxQueueDepth());
+    statistics_start = now;
+}
+
+void Scheduler::CreateTimestampPool() {
+    timestamp_pool = device.GetLogical().CreateQueryPool({
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NUM_TIMESTAMP_SLOTS * 2,
+        .pipelineStatistics = 0,
+    });
+    device.GetLogical().ResetQueryPool(*timestamp_pool, 0, NUM_TIMESTAMP_SLOTS * 2);
+    for (u32 slot = NUM_TIMESTAMP_SLOTS; slot-- > 0;) {
+        free_timestamp_slots.push_back(slot);
+    }
+}
+
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     EndPendingOperations();
+    EndProfiledPass();
+    FlushImageBarriers();
     InvalidateState();
 
     const u64 signal_value = master_semaphore->NextTick();
-    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, signal_value,
+    const u64 sparse_wait_value = std::exchange(pending_sparse_bind_tick, 0);
+    const VkSemaphore sparse_wait_semaphore =
+        sparse_wait_value != 0 ? *sparse_bind_semaphore : VK_NULL_HANDLE;
+    VkQueryPool timestamp_query_pool = VK_NULL_HANDLE;
+    u32 timestamp_slot = 0;
+    const bool is_timed = NeedsGpuTime() && device.SupportsTimestamps();
+    if (is_timed && !timestamp_pool) {
+        // Created on first use, the settings needing it can be enabled while running
+        CreateTimestampPool();
+    }
+    if (is_timed && !free_timestamp_slots.empty()) {
+        // Submissions past the number of slots in flight are not timed
+        timestamp_query_pool = *timestamp_pool;
+        timestamp_slot = free_timestamp_slots.back();
+        free_timestamp_slots.pop_back();
+        pending_timestamp_slots.emplace_back(signal_value, timestamp_slot);
+    }
+    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, signal_value, sparse_wait_semaphore,
+                            sparse_wait_value, timestamp_query_pool, timestamp_slot,
                             this](vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf) {
         static constexpr VkMemoryBarrier WRITE_BARRIER{
             .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -230,31 +425,81 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
         };
         upload_cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
                                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, WRITE_BARRIER);
+        if (timestamp_query_pool) {
+            // The upload command buffer is submitted first, its end is where the work starts
+            upload_cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamp_query_pool,
+                                         timestamp_slot * 2);
+            cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamp_query_pool,
+                                  timestamp_slot * 2 + 1);
+        }
         upload_cmdbuf.End();
         cmdbuf.End();
 
+        // Submissions may be recorded on different threads, send them in order.
+        WaitForSubmitTurn(signal_value);
+
         if (on_submit) {
             on_submit();
         }
 
-        std::scoped_lock lock{submit_mutex};
-        switch (const VkResult result = master_semaphore->SubmitQueue(
-                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
-        case VK_SUCCESS:
-            break;
-        case VK_ERROR_DEVICE_LOST:
-            device.ReportLoss();
-            [[fallthrough]];
-        default:
-            vk::Check(result);
-            break;
+        {
+            std::scoped_lock lock{submit_mutex};
+            switch (const VkResult result = master_semaphore->SubmitQueue(
+                        cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value,
+                        sparse_wait_semaphore, sparse_wait_value)) {
+            case VK_SUCCESS:
+                break;
+            case VK_ERROR_DEVICE_LOST:
+                device.ReportLoss();
+                [[fallthrough]];
+            default:
+                vk::Check(result);
+                break;
+            }
         }
+        EndSubmitTurn(signal_value);
     });
     chunk->MarkSubmit();
     DispatchWork();
     return signal_value;
 }
 
+void Scheduler::BindSparse(const VkBindSparseInfo& bind_info) {
+    if (!sparse_bind_semaphore) {
+        static constexpr VkSemaphoreTypeCreateInfo semaphore_type_ci{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+            .pNext = nullptr,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+            .initialValue = 0,
+        };
+        sparse_bind_semaphore = device.GetLogical().CreateSemaphore({
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &semaphore_type_ci,
+            .flags = 0,
+        });
+    }
+    const u64 signal_value = ++sparse_bind_tick;
+    const VkSemaphore semaphore = *sparse_bind_semaphore;
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = bind_info.pNext,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &signal_value,
+    };
+    VkBindSparseInfo signalling_bind_info = bind_info;
+    signalling_bind_info.pNext = &timeline_si;
+    signalling_bind_info.signalSemaphoreCount = 1;
+    signalling_bind_info.pSignalSemaphores = &semaphore;
+    {
+        // Binds are queue operations, serialize them with the submissions of the workers
+        std::scoped_lock lock{submit_mutex};
+        vk::Check(device.GetGraphicsQueue().BindSparse(signalling_bind_info));
+    }
+    pending_sparse_bind_tick = signal_value;
+}
+
 void Scheduler::AllocateNewContext() {
     // Enable counters once again. These are disabled when a command buffer is finished.
     if (query_cache) {
@@ -272,6 +517,7 @@ void Scheduler::AllocateNewContext() {
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
     state.rescaling_defined = false;
+    state.descriptor_buffer_bound = false;
     state_tracker.InvalidateCommandBufferState();
 }
 
@@ -292,7 +538,16 @@ void Scheduler::EndRenderPass() {
     if (!state.renderpass) {
         return;
     }
-    Record([num_images = num_renderpass_images, images = renderpass_images,
+    const RenderingClears& clears = state.clears;
+    if (state.begin_pending && clears.color_mask == 0 && !clears.depth && !clears.stencil) {
+        // Nothing was rendered, beginning the render pass would only load and store the targets
+        state.begin_pending = false;
+        state.renderpass = nullptr;
+        num_renderpass_images = 0;
+        return;
+    }
+    Record([framebuffer = state.framebuffer, num_images = num_renderpass_images,
+            images = renderpass_images,
             ranges = renderpass_image_ranges](vk::CommandBuffer cmdbuf) {
         std::array<VkImageMemoryBarrier, 9> barriers;
         for (size_t i = 0; i < num_images; ++i) {
@@ -314,20 +569,80 @@ void Scheduler::EndRenderPass() {
                 .subresourceRange = ranges[i],
             };
         }
-        cmdbuf.EndRenderPass();
+        Vulkan::EndRenderPass(cmdbuf, framebuffer);
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
                                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, nullptr, nullptr,
                                vk::Span(barriers.data(), num_images));
     });
+    if (profiled_pass_key.type == PassType::Render) {
+        EndProfiledPass();
+    }
+    last_renderpass = state.renderpass;
+    last_framebuffer = state.framebuffer;
+    last_attachments = state.attachments;
     state.renderpass = nullptr;
     num_renderpass_images = 0;
 }
 
-void Scheduler::AcquireNewChunk() {
-    std::scoped_lock rl{reserve_mutex};
+void Scheduler::BeginPendingRenderPass() {
+    state.begin_pending = false;
+    if (state.renderpass == last_renderpass && state.framebuffer == last_framebuffer &&
+        state.attachments == last_attachments) {
+        ++render_pass_restarts;
+    }
+    if (pass_profiler) {
+        BeginProfiledPass(RenderPassProfileKey());
+    }
+    Record([renderpass = state.renderpass, framebuffer = state.framebuffer,
+            attachments = state.attachments, render_area = state.render_area,
+            clears = state.clears](vk::CommandBuffer cmdbuf) {
+        BeginRenderPass(cmdbuf, renderpass, framebuffer, attachments, render_area, clears);
+    });
+}
+
+PassKey Scheduler::RenderPassProfileKey() const {
+    PassKey key{
+        .type = PassType::Render,
+        .targets = state.targets,
+    };
+    if (profiled_pipeline) {
+        key.shader_hashes = profiled_pipeline->Key().unique_hashes;
+    }
+    return key;
+}
+
+bool Scheduler::HasPendingImageBarrier(VkImage image) const noexcept {
+    return std::ranges::any_of(pending_image_barriers,
+                               [image](const VkImageMemoryBarrier& barrier) {
+                                   return barrier.image == image;
+                               });
+}
+
+void Scheduler::FlushImageBarriers() {
+    if (pending_image_barriers.empty()) {
+        return;
+    }
+    // All deferred barriers come from transfers, one barrier covers them
+    RecordWithUploadBuffer([barriers = std::move(pending_image_barriers)](vk::CommandBuffer cmdbuf,
+                                                                          vk::CommandBuffer) {
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, nullptr, nullptr, barriers);
+    });
+    pending_image_barriers.clear();
+}
 
+void Scheduler::AcquireNewChunk() {
+    if (chunk_reserve.empty()) {
+        // Collect the chunks the workers have finished executing.
+        for (const auto& recorder : recorders) {
+            std::unique_ptr<CommandChunk> free_chunk;
+            while (recorder->free_queue.TryPop(free_chunk)) {
+                chunk_reserve.push_back(std::move(free_chunk));
+            }
+        }
+    }
     if (chunk_reserve.empty()) {
         // If we don't have anything reserved, we need to make a new chunk.
         chunk = std::make_unique<CommandChunk>();
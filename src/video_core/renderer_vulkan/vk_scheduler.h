@@ -3,18 +3,25 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
-#include <queue>
+#include <vector>
 
 #include "common/alignment.h"
+#include "common/bounded_threadsafe_queue.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_pass_profiler.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
@@ -52,19 +59,58 @@ public:
     /// Sends currently recorded work to the worker thread.
     void DispatchWork();
 
-    /// Requests to begin a renderpass.
+    /// Returns the number of chunks dispatched to worker threads and not executed yet.
+    [[nodiscard]] size_t QueueDepth() const noexcept {
+        return pending_chunks.load(std::memory_order::relaxed);
+    }
+
+    /// Returns the highest queue depth seen since the last call, and resets it.
+    [[nodiscard]] size_t ResetMaxQueueDepth() noexcept {
+        return max_pending_chunks.exchange(0, std::memory_order::relaxed);
+    }
+
+    /// Requests to begin a renderpass. It begins when the next command is recorded, and is
+    /// skipped when nothing is recorded before it ends.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Clears a whole color attachment when the requested render pass begins. Returns false when
+    /// the render pass has already begun or renders with a framebuffer object.
+    bool FoldColorClear(u32 attachment, const VkClearColorValue& value);
+
+    /// Clears the whole depth and stencil aspects when the requested render pass begins. Returns
+    /// false when the render pass has already begun or renders with a framebuffer object.
+    bool FoldDepthStencilClear(VkImageAspectFlags aspects, const VkClearDepthStencilValue& value);
+
+    /// Returns the render passes begun again on the targets of the previous one since the last
+    /// call, and resets the count. Every restart makes tilers store and reload the targets.
+    [[nodiscard]] u32 ResetRenderPassRestarts() noexcept {
+        return std::exchange(render_pass_restarts, 0);
+    }
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
 
+    /// Times the following commands as a pass of GPU work, ending the pass being timed. Render
+    /// passes are timed by the scheduler itself. Does nothing unless GPU passes are profiled.
+    void BeginProfiledPass(const PassKey& key);
+
+    /// Ends the pass being timed, if any.
+    void EndProfiledPass();
+
+    /// Times the following commands as a dispatch of a compute shader. The caller ends the pass
+    /// once the dispatch is recorded, so the work recorded after it is not charged to the shader.
+    void ProfileComputeDispatch(u64 shader_hash);
+
     /// Update the pipeline to the current execution context.
     bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline);
 
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
+    /// Returns true if the descriptor buffer has to be bound to the current command buffer.
+    bool UpdateDescriptorBuffer();
+
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
@@ -92,10 +138,32 @@ public:
     template <typename T>
         requires std::is_invocable_v<T, vk::CommandBuffer>
     void Record(T&& c) {
+        if (!pending_image_barriers.empty()) {
+            FlushImageBarriers();
+        }
+        if (state.begin_pending) {
+            BeginPendingRenderPass();
+        }
+        this->RecordWithUploadBuffer(
+            [command = std::move(c)](vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
+                command(cmdbuf);
+            });
+    }
+
+    /// Records a transfer command that only accesses the image of post_barrier. The barrier taking
+    /// the image out of its transfer layout is deferred, so the barriers of consecutive transfers
+    /// are recorded together before the next command that is not one of them.
+    template <typename T>
+        requires std::is_invocable_v<T, vk::CommandBuffer>
+    void RecordImageTransfer(const VkImageMemoryBarrier& post_barrier, T&& c) {
+        if (HasPendingImageBarrier(post_barrier.image)) {
+            FlushImageBarriers();
+        }
         this->RecordWithUploadBuffer(
             [command = std::move(c)](vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
                 command(cmdbuf);
             });
+        pending_image_barriers.push_back(post_barrier);
     }
 
     /// Returns the current command buffer tick.
@@ -108,6 +176,10 @@ public:
         return master_semaphore->IsFree(tick);
     }
 
+    /// Returns the GPU time spent on the submissions completed since the last call.
+    /// Submissions are only timed when a feature or setting needs the GPU time.
+    [[nodiscard]] std::chrono::nanoseconds CollectGpuTime();
+
     /// Waits for the given tick to trigger on the GPU.
     void Wait(u64 tick) {
         if (tick >= master_semaphore->CurrentTick()) {
@@ -117,6 +189,10 @@ public:
         master_semaphore->Wait(tick);
     }
 
+    /// Sends sparse memory binds to the queue without waiting for them. The next submission waits
+    /// for them on the GPU, so the commands recorded after this call see the memory bound.
+    void BindSparse(const VkBindSparseInfo& bind_info);
+
     /// Returns the master timeline semaphore.
     [[nodiscard]] MasterSemaphore& GetMasterSemaphore() const noexcept {
         return *master_semaphore;
@@ -209,37 +285,78 @@ private:
     struct State {
         VkRenderPass renderpass = nullptr;
         VkFramebuffer framebuffer = nullptr;
+        RenderingAttachments attachments{};
+        RenderPassKey targets{};
         VkExtent2D render_area = {0, 0};
+        RenderingClears clears{};
+        bool begin_pending = false;
         GraphicsPipeline* graphics_pipeline = nullptr;
         bool is_rescaling = false;
         bool rescaling_defined = false;
+        bool descriptor_buffer_bound = false;
     };
 
-    void WorkerThread(std::stop_token stop_token);
+    /// Maximum number of chunks in flight to a single worker thread
+    static constexpr size_t CHUNK_QUEUE_SIZE = 0x80;
+
+    using ChunkQueue = Common::SpinningSPSCQueue<std::unique_ptr<CommandChunk>, CHUNK_QUEUE_SIZE>;
+
+    /// Command buffers owned by a single worker thread.
+    struct Recorder {
+        std::unique_ptr<CommandPool> command_pool;
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+
+        /// Chunks dispatched by the GPU thread to this worker
+        ChunkQueue work_queue;
+
+        /// Executed chunks handed back to the GPU thread for reuse
+        ChunkQueue free_queue;
+    };
+
+    void WorkerThread(std::stop_token stop_token, Recorder& recorder);
+
+    void AllocateWorkerCommandBuffer(Recorder& recorder);
 
-    void AllocateWorkerCommandBuffer();
+    void CreateTimestampPool();
 
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
+    /// Blocks until all submissions signalling a lower tick have been sent to the queue.
+    void WaitForSubmitTurn(u64 signal_value);
+
+    /// Lets the submission signalling the next tick be sent to the queue.
+    void EndSubmitTurn(u64 signal_value);
+
+    void UpdateRecordingStatistics();
+
     void AllocateNewContext();
 
     void EndPendingOperations();
 
     void EndRenderPass();
 
+    /// Records the begin of the requested render pass, with the clears folded into it.
+    void BeginPendingRenderPass();
+
+    /// Returns the key of the render pass being recorded with the last pipeline bound in it.
+    PassKey RenderPassProfileKey() const;
+
+    /// Returns true when a deferred transfer barrier for the image has not been recorded yet.
+    bool HasPendingImageBarrier(VkImage image) const noexcept;
+
+    /// Records the barriers deferred by RecordImageTransfer.
+    void FlushImageBarriers();
+
     void AcquireNewChunk();
 
     const Device& device;
     StateTracker& state_tracker;
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
-    std::unique_ptr<CommandPool> command_pool;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
 
-    vk::CommandBuffer current_cmdbuf;
-    vk::CommandBuffer current_upload_cmdbuf;
-
     std::unique_ptr<CommandChunk> chunk;
     std::function<void()> on_submit;
 
@@ -249,13 +366,50 @@ private:
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
 
-    std::queue<std::unique_ptr<CommandChunk>> work_queue;
+    /// Targets of the last render pass that ended with commands recorded in it
+    VkRenderPass last_renderpass = nullptr;
+    VkFramebuffer last_framebuffer = nullptr;
+    RenderingAttachments last_attachments{};
+    u32 render_pass_restarts = 0;
+
+    std::vector<VkImageMemoryBarrier> pending_image_barriers;
+
     std::vector<std::unique_ptr<CommandChunk>> chunk_reserve;
-    std::mutex execution_mutex;
-    std::mutex reserve_mutex;
-    std::mutex queue_mutex;
-    std::condition_variable_any event_cv;
-    std::jthread worker_thread;
+    size_t dispatch_recorder = 0;
+
+    std::atomic<size_t> pending_chunks{};
+    std::atomic<size_t> max_pending_chunks{};
+    std::mutex idle_mutex;
+    std::condition_variable idle_cv;
+
+    std::mutex submit_order_mutex;
+    std::condition_variable submit_order_cv;
+    u64 next_submit_tick = 0;
+
+    std::atomic<u64> executed_chunks{};
+    std::mutex statistics_mutex;
+    std::chrono::steady_clock::time_point statistics_start;
+
+    /// Pairs of timestamps written at the start and the end of timed submissions
+    vk::QueryPool timestamp_pool;
+    std::vector<u32> free_timestamp_slots;
+    std::deque<std::pair<u64, u32>> pending_timestamp_slots;
+
+    /// Timeline signalled by sparse binds, created on the first bind
+    vk::Semaphore sparse_bind_semaphore;
+    u64 sparse_bind_tick = 0;
+    /// Value of the last sparse bind the next submission has to wait for, zero when none
+    u64 pending_sparse_bind_tick = 0;
+
+    /// Times passes of GPU work when they are profiled
+    std::unique_ptr<PassProfiler> pass_profiler;
+    std::optional<u32> profiled_pass_query;
+    PassKey profiled_pass_key{};
+    /// Last graphics pipeline used in the render pass being recorded
+    const GraphicsPipeline* profiled_pipeline = nullptr;
+
+    std::vector<std::unique_ptr<Recorder>> recorders;
+    std::vector<std::jthread> worker_threads;
 };
 
 } // namespace Vulkan
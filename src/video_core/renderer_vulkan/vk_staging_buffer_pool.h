@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/memory_accounting.h"
 
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -25,6 +26,22 @@ struct StagingBufferRef {
     u64 index;
 };
 
+/// Usage counters of the staging buffer pool
+struct StagingBufferPoolStats {
+    u64 stream_allocations = 0; ///< Number of uploads sub-allocated from the stream buffer
+    u64 stream_fallbacks = 0;   ///< Number of uploads that did not fit in the stream buffer
+    u64 stream_frame_bytes = 0; ///< Bytes sub-allocated from the stream buffer this frame
+    u64 stream_high_water = 0;  ///< Largest number of bytes sub-allocated in a single frame
+    u64 cached_bytes = 0;       ///< Size of the live staging buffers in the size-class caches
+    u64 cached_high_water = 0;  ///< Largest size of the live staging buffers in the caches
+};
+
+/**
+ * Staging memory for transfers. Uploads are sub-allocated from a persistently mapped stream
+ * buffer split in NUM_SYNCS regions, each region is reused once the GPU has consumed it.
+ * Downloads, deferred requests and uploads that do not fit in the ring use power-of-two sized
+ * buffers cached per size class.
+ */
 class StagingBufferPool {
 public:
     static constexpr size_t NUM_SYNCS = 16;
@@ -42,6 +59,10 @@ public:
 
     void TickFrame();
 
+    [[nodiscard]] const StagingBufferPoolStats& GetStats() const noexcept {
+        return stats;
+    }
+
 private:
     struct StreamBufferCommit {
         size_t upper_bound;
@@ -119,6 +140,10 @@ private:
     size_t current_delete_level = 0;
     u64 buffer_index = 0;
     u64 unique_ids{};
+
+    StagingBufferPoolStats stats;
+    Common::MemoryAccounting::Charge memory_charge{
+        Common::MemoryAccounting::Category::StagingBuffers};
 };
 
 } // namespace Vulkan
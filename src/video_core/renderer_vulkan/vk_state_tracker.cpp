@@ -58,6 +58,11 @@ Flags MakeInvalidationFlags() {
         ColorMask,
         BlendEquations,
         BlendEnable,
+        PolygonMode,
+        AlphaToCoverage,
+        LineRasterizationMode,
+        ConservativeRasterizationMode,
+        ProvokingVertexMode,
     };
     Flags flags{};
     for (const int flag : INVALIDATION_FLAGS) {
@@ -187,6 +192,15 @@ void SetupDirtySpecialOps(Tables& tables) {
     tables[0][OFF(logic_op.op)] = LogicOp;
 }
 
+void SetupDirtyRasterizationModes(Tables& tables) {
+    auto& table = tables[0];
+    table[OFF(polygon_mode_front)] = PolygonMode;
+    table[OFF(anti_alias_alpha_control)] = AlphaToCoverage;
+    table[OFF(line_anti_alias_enable)] = LineRasterizationMode;
+    table[OFF(conservative_raster_enable)] = ConservativeRasterizationMode;
+    table[OFF(provoking_vertex)] = ProvokingVertexMode;
+}
+
 void SetupDirtyViewportSwizzles(Tables& tables) {
     static constexpr size_t swizzle_offset = 6;
     for (size_t index = 0; index < Regs::NumViewports; ++index) {
@@ -236,6 +250,8 @@ void StateTracker::SetupTables(Tegra::Control::ChannelState& channel_state) {
     SetupDirtyVertexAttributes(tables);
     SetupDirtyVertexBindings(tables);
     SetupDirtySpecialOps(tables);
+    SetupDirtyRasterizationModes(tables);
+    channel_state.maxwell_3d->dirty.BuildMasks();
 }
 
 void StateTracker::ChangeChannel(Tegra::Control::ChannelState& channel_state) {
@@ -62,6 +62,12 @@ enum : u8 {
     ColorMask,
     ViewportSwizzles,
 
+    PolygonMode,
+    AlphaToCoverage,
+    LineRasterizationMode,
+    ConservativeRasterizationMode,
+    ProvokingVertexMode,
+
     Last,
 };
 static_assert(Last <= std::numeric_limits<u8>::max());
@@ -248,6 +254,26 @@ public:
         return Exchange(Dirty::LogicOp, false);
     }
 
+    bool TouchPolygonMode() {
+        return Exchange(Dirty::PolygonMode, false);
+    }
+
+    bool TouchAlphaToCoverage() {
+        return Exchange(Dirty::AlphaToCoverage, false);
+    }
+
+    bool TouchLineRasterizationMode() {
+        return Exchange(Dirty::LineRasterizationMode, false);
+    }
+
+    bool TouchConservativeRasterizationMode() {
+        return Exchange(Dirty::ConservativeRasterizationMode, false);
+    }
+
+    bool TouchProvokingVertexMode() {
+        return Exchange(Dirty::ProvokingVertexMode, false);
+    }
+
     bool ChangePrimitiveTopology(Maxwell::PrimitiveTopology new_topology) {
         const bool has_changed = current_topology != new_topology;
         current_topology = new_topology;
@@ -130,6 +130,9 @@ void Swapchain::Create(VkSurfaceKHR surface_, u32 width_, u32 height_) {
     CreateSwapchain(capabilities);
     CreateSemaphores();
 
+    // Presentations of the old swapchain can not be waited on anymore
+    first_present_id = present_id + 1;
+
     resource_ticks.clear();
     resource_ticks.resize(image_count);
 }
@@ -163,9 +166,19 @@ bool Swapchain::AcquireNextImage() {
 
 void Swapchain::Present(VkSemaphore render_semaphore) {
     const auto present_queue{device.GetPresentQueue()};
+    const bool track_present_id = device.IsKhrPresentWaitSupported();
+    if (track_present_id) {
+        ++present_id;
+    }
+    const VkPresentIdKHR present_id_info{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &present_id,
+    };
     const VkPresentInfoKHR present_info{
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .pNext = nullptr,
+        .pNext = track_present_id ? &present_id_info : nullptr,
         .waitSemaphoreCount = render_semaphore ? 1U : 0U,
         .pWaitSemaphores = &render_semaphore,
         .swapchainCount = 1,
@@ -196,6 +209,28 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
     }
 }
 
+bool Swapchain::WaitForPresent(u64 id, u64 timeout) const {
+    if (!device.IsKhrPresentWaitSupported() || !swapchain || id < first_present_id ||
+        id > present_id) {
+        return false;
+    }
+    const VkResult result = device.GetLogical().WaitForPresentKHR(*swapchain, id, timeout);
+    switch (result) {
+    case VK_SUCCESS:
+        return true;
+    case VK_TIMEOUT:
+    case VK_ERROR_OUT_OF_DATE_KHR:
+    case VK_SUBOPTIMAL_KHR:
+        return false;
+    case VK_ERROR_SURFACE_LOST_KHR:
+        vk::Check(result);
+        return false;
+    default:
+        LOG_ERROR(Render_Vulkan, "vkWaitForPresentKHR returned {}", vk::ToString(result));
+        return false;
+    }
+}
+
 void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const auto physical_device{device.GetPhysical()};
     const auto formats{physical_device.GetSurfaceFormatsKHR(surface)};
@@ -32,6 +32,15 @@ public:
     /// Presents the rendered image to the swapchain.
     void Present(VkSemaphore render_semaphore);
 
+    /// Waits until the presentation with the given id has been displayed, or the timeout in
+    /// nanoseconds expires. Returns false when the id can not be waited on.
+    bool WaitForPresent(u64 id, u64 timeout) const;
+
+    /// Returns the id of the last presentation, ids are tracked when present wait is supported.
+    u64 GetLastPresentId() const {
+        return present_id;
+    }
+
     /// Returns true when the swapchain needs to be recreated.
     bool NeedsRecreation() const {
         return IsSubOptimal() || NeedsPresentModeUpdate();
@@ -136,6 +145,9 @@ private:
 
     bool is_outdated{};
     bool is_suboptimal{};
+
+    u64 present_id{};       ///< Id of the last presentation, increases across recreations
+    u64 first_present_id{}; ///< First id presented with the current swapchain
 };
 
 } // namespace Vulkan
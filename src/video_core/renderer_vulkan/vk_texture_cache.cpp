@@ -3,12 +3,17 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
 #include <span>
 #include <vector>
 #include <boost/container/small_vector.hpp>
 
+#include "common/alignment.h"
 #include "common/bit_cast.h"
 #include "common/bit_util.h"
+#include "common/div_ceil.h"
+#include "common/literals.h"
+#include "common/metrics.h"
 #include "common/settings.h"
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
@@ -43,6 +48,11 @@ using VideoCore::Surface::IsPixelFormatInteger;
 using VideoCore::Surface::SurfaceType;
 
 namespace {
+using namespace Common::Literals;
+
+/// Minimum host size of an image to create it with sparse residency
+constexpr u32 SPARSE_IMAGE_MIN_SIZE = 32_MiB;
+
 constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     if (color == std::array<float, 4>{0, 0, 0, 0}) {
         return VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
@@ -155,12 +165,23 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     };
 }
 
+[[nodiscard]] VkImageCreateInfo MakeSparseImageCreateInfo(const Device& device,
+                                                          const ImageInfo& info) {
+    VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info);
+    // 2D views of 3D images can't be created from sparse images
+    image_ci.flags &= ~VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT;
+    image_ci.flags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    return image_ci;
+}
+
 [[nodiscard]] vk::Image MakeImage(const Device& device, const MemoryAllocator& allocator,
-                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
+                                  const ImageInfo& info, std::span<const VkFormat> view_formats,
+                                  bool is_sparse = false) {
     if (info.type == ImageType::Buffer) {
         return vk::Image{};
     }
-    VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info);
+    VkImageCreateInfo image_ci =
+        is_sparse ? MakeSparseImageCreateInfo(device, info) : MakeImageCreateInfo(device, info);
     const VkImageFormatListCreateInfo image_format_list = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO,
         .pNext = nullptr,
@@ -173,7 +194,7 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
             image_ci.pNext = &image_format_list;
         }
     }
-    return allocator.CreateImage(image_ci);
+    return is_sparse ? allocator.CreateSparseImage(image_ci) : allocator.CreateImage(image_ci);
 }
 
 [[nodiscard]] vk::ImageView MakeStorageView(const vk::Device& device, u32 level, VkImage image,
@@ -504,19 +525,20 @@ TransformBufferCopies(std::span<const VideoCommon::BufferCopy> copies, size_t bu
     }
 }
 
+constexpr VkAccessFlags UPLOAD_WRITE_ACCESS_FLAGS = VK_ACCESS_SHADER_WRITE_BIT |
+                                                   VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                                   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+constexpr VkAccessFlags UPLOAD_READ_ACCESS_FLAGS = VK_ACCESS_SHADER_READ_BIT |
+                                                  VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                                                  VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+
 void CopyBufferToImage(vk::CommandBuffer cmdbuf, VkBuffer src_buffer, VkImage image,
                        VkImageAspectFlags aspect_mask, bool is_initialized,
                        std::span<const VkBufferImageCopy> copies) {
-    static constexpr VkAccessFlags WRITE_ACCESS_FLAGS =
-        VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
-        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-    static constexpr VkAccessFlags READ_ACCESS_FLAGS = VK_ACCESS_SHADER_READ_BIT |
-                                                       VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
-                                                       VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
     const VkImageMemoryBarrier read_barrier{
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
         .pNext = nullptr,
-        .srcAccessMask = WRITE_ACCESS_FLAGS,
+        .srcAccessMask = UPLOAD_WRITE_ACCESS_FLAGS,
         .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
         .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
         .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -531,11 +553,22 @@ void CopyBufferToImage(vk::CommandBuffer cmdbuf, VkBuffer src_buffer, VkImage im
             .layerCount = VK_REMAINING_ARRAY_LAYERS,
         },
     };
-    const VkImageMemoryBarrier write_barrier{
+    // Transfers are always followed by a barrier to all commands, or by a barrier the scheduler
+    // records before the image is used again. Leaving them out lets consecutive uploads overlap.
+    static constexpr VkPipelineStageFlags SRC_STAGE_MASK =
+        VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    cmdbuf.PipelineBarrier(SRC_STAGE_MASK, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, read_barrier);
+    cmdbuf.CopyBufferToImage(src_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copies);
+}
+
+/// Returns the barrier making an upload visible, recorded by the scheduler after the copy
+[[nodiscard]] VkImageMemoryBarrier MakeUploadWriteBarrier(VkImage image,
+                                                          VkImageAspectFlags aspect_mask) {
+    return VkImageMemoryBarrier{
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
         .pNext = nullptr,
         .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-        .dstAccessMask = WRITE_ACCESS_FLAGS | READ_ACCESS_FLAGS,
+        .dstAccessMask = UPLOAD_WRITE_ACCESS_FLAGS | UPLOAD_READ_ACCESS_FLAGS,
         .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
         .newLayout = VK_IMAGE_LAYOUT_GENERAL,
         .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
@@ -549,12 +582,6 @@ void CopyBufferToImage(vk::CommandBuffer cmdbuf, VkBuffer src_buffer, VkImage im
             .layerCount = VK_REMAINING_ARRAY_LAYERS,
         },
     };
-    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                           read_barrier);
-    cmdbuf.CopyBufferToImage(src_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copies);
-    // TODO: Move this to another API
-    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
-                           write_barrier);
 }
 
 [[nodiscard]] VkImageBlit MakeImageBlit(const Region2D& dst_region, const Region2D& src_region,
@@ -832,6 +859,18 @@ void BlitScale(Scheduler& scheduler, VkImage src_image, VkImage dst_image, const
                                0, nullptr, nullptr, write_barriers);
     });
 }
+
+void CommitSparseCopies(Image& dst, std::span<const VideoCommon::ImageCopy> copies) {
+    const std::shared_ptr<SparseImage>& sparse = dst.Sparse();
+    if (!sparse) {
+        return;
+    }
+    for (const VideoCommon::ImageCopy& copy : copies) {
+        sparse->CommitRegion(copy.dst_subresource.base_level, copy.dst_subresource.base_layer,
+                             copy.dst_subresource.num_layers, MakeOffset3D(copy.dst_offset),
+                             MakeExtent3D(copy.extent));
+    }
+}
 } // Anonymous namespace
 
 TextureCacheRuntime::TextureCacheRuntime(const Device& device_, Scheduler& scheduler_,
@@ -852,6 +891,10 @@ TextureCacheRuntime::TextureCacheRuntime(const Device& device_, Scheduler& sched
         msaa_copy_pass = std::make_unique<MSAACopyPass>(
             device, scheduler, descriptor_pool, staging_buffer_pool, compute_pass_descriptor_queue);
     }
+    // Submissions wait for sparse binds through a timeline semaphore
+    use_sparse_residency = Settings::values.use_sparse_textures.GetValue() &&
+                           device.IsSparseResidencySupported(VK_IMAGE_TYPE_2D) &&
+                           device.HasTimelineSemaphore();
     if (!device.IsKhrImageFormatListSupported()) {
         return;
     }
@@ -927,8 +970,50 @@ void TextureCacheRuntime::BarrierFeedbackLoop() {
     scheduler.RequestOutsideRenderPassOperationContext();
 }
 
+bool TextureCacheRuntime::UseSparseResidency(const ImageInfo& info) const {
+    if (!use_sparse_residency || info.num_samples > 1) {
+        return false;
+    }
+    if (VideoCommon::CalculateUnswizzledSizeBytes(info) < SPARSE_IMAGE_MIN_SIZE) {
+        return false;
+    }
+    if (ImageAspectMask(info.format) != VK_IMAGE_ASPECT_COLOR_BIT) {
+        return false;
+    }
+    // Images converted on the GPU are written through storage views of the whole image
+    if ((IsPixelFormatASTC(info.format) && !device.IsOptimalAstcSupported()) ||
+        (IsPixelFormatBCn(info.format) && !device.IsOptimalBcnSupported())) {
+        return false;
+    }
+    switch (info.type) {
+    case ImageType::e2D:
+        if (info.resources.layers == 1) {
+            return false;
+        }
+        break;
+    case ImageType::e3D:
+        // Sparse 3D images can't be rendered to through 2D views, limit them to compressed
+        // formats that are only ever sampled
+        if (!IsPixelFormatASTC(info.format) && !IsPixelFormatBCn(info.format)) {
+            return false;
+        }
+        break;
+    default:
+        return false;
+    }
+    const VkImageCreateInfo image_ci = MakeSparseImageCreateInfo(device, info);
+    if (!device.IsSparseResidencySupported(image_ci.imageType)) {
+        return false;
+    }
+    return !device.GetPhysical()
+                .GetSparseImageFormatProperties(image_ci.format, image_ci.imageType,
+                                                image_ci.samples, image_ci.usage, image_ci.tiling)
+                .empty();
+}
+
 void TextureCacheRuntime::ReinterpretImage(Image& dst, Image& src,
                                            std::span<const VideoCommon::ImageCopy> copies) {
+    CommitSparseCopies(dst, copies);
     boost::container::small_vector<VkBufferImageCopy, 16> vk_in_copies(copies.size());
     boost::container::small_vector<VkBufferImageCopy, 16> vk_out_copies(copies.size());
     const VkImageAspectFlags src_aspect_mask = src.AspectMask();
@@ -1062,11 +1147,29 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
                                     const Region2D& dst_region, const Region2D& src_region,
                                     Tegra::Engines::Fermi2D::Filter filter,
                                     Tegra::Engines::Fermi2D::Operation operation) {
+    dst.CommitSparse();
     const VkImageAspectFlags aspect_mask = ImageAspectMask(src.format);
     const bool is_dst_msaa = dst.Samples() != VK_SAMPLE_COUNT_1_BIT;
     const bool is_src_msaa = src.Samples() != VK_SAMPLE_COUNT_1_BIT;
-    if (aspect_mask != ImageAspectMask(dst.format)) {
-        UNIMPLEMENTED_MSG("Incompatible blit from format {} to {}", src.format, dst.format);
+    const VkImageAspectFlags dst_aspect_mask = ImageAspectMask(dst.format);
+    if (aspect_mask != dst_aspect_mask) {
+        // Depth and color are blitted through the red channel, like the copies between them
+        const bool is_src_depth = (aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0;
+        const bool is_dst_depth = (dst_aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0;
+        if (is_src_msaa || is_dst_msaa) {
+            UNIMPLEMENTED_MSG("Incompatible MSAA blit from format {} to {}", src.format,
+                              dst.format);
+        } else if (is_src_depth && dst_aspect_mask == VK_IMAGE_ASPECT_COLOR_BIT) {
+            // Depth formats are not guaranteed to support linear filtering
+            blit_image_helper.BlitColor(dst_framebuffer, src.DepthView(), dst_region, src_region,
+                                        Tegra::Engines::Fermi2D::Filter::Point, operation);
+        } else if (aspect_mask == VK_IMAGE_ASPECT_COLOR_BIT && is_dst_depth) {
+            blit_image_helper.BlitColorToDepth(dst_framebuffer,
+                                               src.Handle(Shader::TextureType::Color2D),
+                                               dst_region, src_region, filter);
+        } else {
+            UNIMPLEMENTED_MSG("Incompatible blit from format {} to {}", src.format, dst.format);
+        }
         return;
     }
     if (aspect_mask == VK_IMAGE_ASPECT_COLOR_BIT && !is_src_msaa && !is_dst_msaa) {
@@ -1188,6 +1291,7 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
 }
 
 void TextureCacheRuntime::ConvertImage(Framebuffer* dst, ImageView& dst_view, ImageView& src_view) {
+    dst_view.CommitSparse();
     switch (dst_view.format) {
     case PixelFormat::R16_UNORM:
         if (src_view.format == PixelFormat::D16_UNORM) {
@@ -1255,6 +1359,7 @@ void TextureCacheRuntime::ConvertImage(Framebuffer* dst, ImageView& dst_view, Im
 
 void TextureCacheRuntime::CopyImage(Image& dst, Image& src,
                                     std::span<const VideoCommon::ImageCopy> copies) {
+    CommitSparseCopies(dst, copies);
     boost::container::small_vector<VkImageCopy, 16> vk_copies(copies.size());
     const VkImageAspectFlags aspect_mask = dst.AspectMask();
     ASSERT(aspect_mask == src.AspectMask());
@@ -1344,6 +1449,7 @@ void TextureCacheRuntime::CopyImage(Image& dst, Image& src,
 
 void TextureCacheRuntime::CopyImageMSAA(Image& dst, Image& src,
                                         std::span<const VideoCommon::ImageCopy> copies) {
+    CommitSparseCopies(dst, copies);
     const bool msaa_to_non_msaa = src.info.num_samples > 1 && dst.info.num_samples == 1;
     if (msaa_copy_pass) {
         return msaa_copy_pass->CopyImage(dst, src, copies, msaa_to_non_msaa);
@@ -1363,22 +1469,304 @@ bool TextureCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
 
-void TextureCacheRuntime::TickFrame() {}
+void TextureCacheRuntime::TickFrame() {
+    if (!use_sparse_residency) {
+        return;
+    }
+    static auto& num_images = Common::Metrics::GetRegistry().RegisterGauge(
+        "yuzu_vulkan_sparse_images", "Live images created with sparse residency");
+    static auto& reserved_bytes = Common::Metrics::GetRegistry().RegisterGauge(
+        "yuzu_vulkan_sparse_reserved_bytes",
+        "Memory the sparse images would take if they were fully resident");
+    static auto& committed_bytes = Common::Metrics::GetRegistry().RegisterGauge(
+        "yuzu_vulkan_sparse_committed_bytes", "Memory committed to sparse images");
+    static auto& committed_tiles = Common::Metrics::GetRegistry().RegisterGauge(
+        "yuzu_vulkan_sparse_committed_tiles", "Tiles of sparse images backed with memory");
+    num_images.Set(static_cast<s64>(sparse_stats.num_images));
+    reserved_bytes.Set(static_cast<s64>(sparse_stats.reserved_bytes));
+    committed_bytes.Set(static_cast<s64>(sparse_stats.committed_bytes));
+    committed_tiles.Set(static_cast<s64>(sparse_stats.committed_tiles));
+}
+
+SparseImage::SparseImage(TextureCacheRuntime& runtime_, VkImage image_,
+                         const VkImageCreateInfo& image_ci)
+    : runtime{&runtime_}, image{image_}, extent{image_ci.extent},
+      num_levels{static_cast<s32>(image_ci.mipLevels)},
+      num_layers{static_cast<s32>(image_ci.arrayLayers)} {
+    const auto& device = runtime->device.GetLogical();
+    requirements = device.GetImageMemoryRequirements(image);
+
+    ++runtime->sparse_stats.num_images;
+    runtime->sparse_stats.reserved_bytes += requirements.size;
+
+    bool has_color_requirements = false;
+    boost::container::small_vector<VkSparseMemoryBind, 4> metadata_binds;
+    for (const VkSparseImageMemoryRequirements& sparse_reqs :
+         device.GetImageSparseMemoryRequirements(image)) {
+        const VkImageAspectFlags aspect_mask = sparse_reqs.formatProperties.aspectMask;
+        if ((aspect_mask & VK_IMAGE_ASPECT_COLOR_BIT) != 0) {
+            sparse_requirements = sparse_reqs;
+            has_color_requirements = true;
+        }
+        if ((aspect_mask & VK_IMAGE_ASPECT_METADATA_BIT) == 0) {
+            continue;
+        }
+        // Metadata is not tracked and has to be always resident
+        const bool is_single = (sparse_reqs.formatProperties.flags &
+                                VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        for (s32 layer = 0; layer < (is_single ? 1 : num_layers); ++layer) {
+            metadata_binds.push_back(VkSparseMemoryBind{
+                .resourceOffset = sparse_reqs.imageMipTailOffset +
+                                  static_cast<VkDeviceSize>(layer) * sparse_reqs.imageMipTailStride,
+                .size = sparse_reqs.imageMipTailSize,
+                .memory = VK_NULL_HANDLE,
+                .memoryOffset = 0,
+                .flags = VK_SPARSE_MEMORY_BIND_METADATA_BIT,
+            });
+        }
+    }
+    if (!has_color_requirements) {
+        // The image can't be partially resident, bind all of it
+        is_fully_resident = true;
+        metadata_binds.clear();
+        const MemoryCommit& commit = Allocate(requirements.size);
+        const VkSparseMemoryBind bind{
+            .resourceOffset = 0,
+            .size = requirements.size,
+            .memory = commit.Memory(),
+            .memoryOffset = commit.Offset(),
+            .flags = 0,
+        };
+        Bind({}, std::span(&bind, 1));
+        return;
+    }
+    if (!metadata_binds.empty()) {
+        const VkDeviceSize stride = Common::AlignUp(metadata_binds[0].size, requirements.alignment);
+        const MemoryCommit& commit = Allocate(stride * metadata_binds.size());
+        for (size_t index = 0; index < metadata_binds.size(); ++index) {
+            metadata_binds[index].memory = commit.Memory();
+            metadata_binds[index].memoryOffset = commit.Offset() + stride * index;
+        }
+        Bind({}, metadata_binds);
+    }
+    const s32 mip_tail_first_lod =
+        std::min(static_cast<s32>(sparse_requirements.imageMipTailFirstLod), num_levels);
+    level_offsets.resize(mip_tail_first_lod);
+    for (s32 level = 0; level < mip_tail_first_lod; ++level) {
+        const VkExtent3D tiles = LevelTiles(level);
+        level_offsets[level] = tiles_per_layer;
+        tiles_per_layer += static_cast<size_t>(tiles.width) * tiles.height * tiles.depth;
+    }
+    committed_tiles.resize(Common::DivCeil(tiles_per_layer * num_layers, size_t{64}));
+    if (mip_tail_first_lod < num_levels) {
+        const bool is_single = (sparse_requirements.formatProperties.flags &
+                                VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+        committed_mip_tails.resize(is_single ? 1 : num_layers);
+    }
+}
+
+SparseImage::~SparseImage() {
+    SparseResidencyStats& stats = runtime->sparse_stats;
+    --stats.num_images;
+    stats.reserved_bytes -= requirements.size;
+    stats.committed_bytes -= committed_bytes;
+    stats.committed_tiles -= num_committed_tiles;
+}
+
+void SparseImage::CommitRegion(s32 level, s32 base_layer, s32 layers, VkOffset3D offset,
+                               VkExtent3D region) {
+    if (is_fully_resident) {
+        return;
+    }
+    if (level >= static_cast<s32>(level_offsets.size())) {
+        CommitMipTail(base_layer, layers);
+        return;
+    }
+    const VkExtent3D& granularity = sparse_requirements.formatProperties.imageGranularity;
+    const VkExtent3D level_extent = LevelExtent(level);
+    const VkExtent3D tiles = LevelTiles(level);
+    const u32 begin_x = static_cast<u32>(offset.x) / granularity.width;
+    const u32 begin_y = static_cast<u32>(offset.y) / granularity.height;
+    const u32 begin_z = static_cast<u32>(offset.z) / granularity.depth;
+    const u32 end_x =
+        std::min(Common::DivCeil(offset.x + region.width, granularity.width), tiles.width);
+    const u32 end_y =
+        std::min(Common::DivCeil(offset.y + region.height, granularity.height), tiles.height);
+    const u32 end_z =
+        std::min(Common::DivCeil(offset.z + region.depth, granularity.depth), tiles.depth);
+    const s32 end_layer = std::min(base_layer + layers, num_layers);
+
+    boost::container::small_vector<VkSparseImageMemoryBind, 16> binds;
+    for (s32 layer = base_layer; layer < end_layer; ++layer) {
+        const size_t layer_offset = tiles_per_layer * layer + level_offsets[level];
+        for (u32 z = begin_z; z < end_z; ++z) {
+            for (u32 y = begin_y; y < end_y; ++y) {
+                for (u32 x = begin_x; x < end_x; ++x) {
+                    const size_t index = layer_offset + (z * tiles.height + y) * tiles.width + x;
+                    u64& word = committed_tiles[index / 64];
+                    const u64 mask = u64{1} << (index % 64);
+                    if ((word & mask) != 0) {
+                        continue;
+                    }
+                    word |= mask;
+                    const VkOffset3D tile_offset{
+                        .x = static_cast<s32>(x * granularity.width),
+                        .y = static_cast<s32>(y * granularity.height),
+                        .z = static_cast<s32>(z * granularity.depth),
+                    };
+                    binds.push_back(VkSparseImageMemoryBind{
+                        .subresource{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .mipLevel = static_cast<u32>(level),
+                            .arrayLayer = static_cast<u32>(layer),
+                        },
+                        .offset = tile_offset,
+                        .extent{
+                            .width = std::min(granularity.width,
+                                              level_extent.width - tile_offset.x),
+                            .height = std::min(granularity.height,
+                                               level_extent.height - tile_offset.y),
+                            .depth = std::min(granularity.depth,
+                                              level_extent.depth - tile_offset.z),
+                        },
+                        .memory = VK_NULL_HANDLE,
+                        .memoryOffset = 0,
+                        .flags = 0,
+                    });
+                }
+            }
+        }
+    }
+    if (binds.empty()) {
+        return;
+    }
+    const VkDeviceSize tile_size = requirements.alignment;
+    const MemoryCommit& commit = Allocate(tile_size * binds.size());
+    for (size_t index = 0; index < binds.size(); ++index) {
+        binds[index].memory = commit.Memory();
+        binds[index].memoryOffset = commit.Offset() + tile_size * index;
+    }
+    num_committed_tiles += binds.size();
+    runtime->sparse_stats.committed_tiles += binds.size();
+    Bind(binds, {});
+}
+
+void SparseImage::CommitRange(const VideoCommon::SubresourceRange& range) {
+    const s32 end_level = std::min(range.base.level + range.extent.levels, num_levels);
+    for (s32 level = range.base.level; level < end_level; ++level) {
+        CommitRegion(level, range.base.layer, range.extent.layers, VkOffset3D{},
+                     LevelExtent(level));
+    }
+}
+
+VkExtent3D SparseImage::LevelExtent(s32 level) const noexcept {
+    return VkExtent3D{
+        .width = std::max(extent.width >> level, 1U),
+        .height = std::max(extent.height >> level, 1U),
+        .depth = std::max(extent.depth >> level, 1U),
+    };
+}
+
+VkExtent3D SparseImage::LevelTiles(s32 level) const noexcept {
+    const VkExtent3D& granularity = sparse_requirements.formatProperties.imageGranularity;
+    const VkExtent3D level_extent = LevelExtent(level);
+    return VkExtent3D{
+        .width = Common::DivCeil(level_extent.width, granularity.width),
+        .height = Common::DivCeil(level_extent.height, granularity.height),
+        .depth = Common::DivCeil(level_extent.depth, granularity.depth),
+    };
+}
+
+void SparseImage::CommitMipTail(s32 base_layer, s32 layers) {
+    if (committed_mip_tails.empty()) {
+        return;
+    }
+    const bool is_single = committed_mip_tails.size() == 1;
+    const s32 begin_layer = is_single ? 0 : base_layer;
+    const s32 end_layer = is_single ? 1 : std::min(base_layer + layers, num_layers);
+    boost::container::small_vector<VkSparseMemoryBind, 16> binds;
+    for (s32 layer = begin_layer; layer < end_layer; ++layer) {
+        if (committed_mip_tails[layer]) {
+            continue;
+        }
+        committed_mip_tails[layer] = true;
+        binds.push_back(VkSparseMemoryBind{
+            .resourceOffset = sparse_requirements.imageMipTailOffset +
+                              static_cast<VkDeviceSize>(layer) *
+                                  sparse_requirements.imageMipTailStride,
+            .size = sparse_requirements.imageMipTailSize,
+            .memory = VK_NULL_HANDLE,
+            .memoryOffset = 0,
+            .flags = 0,
+        });
+    }
+    if (binds.empty()) {
+        return;
+    }
+    const VkDeviceSize stride =
+        Common::AlignUp(sparse_requirements.imageMipTailSize, requirements.alignment);
+    const MemoryCommit& commit = Allocate(stride * binds.size());
+    for (size_t index = 0; index < binds.size(); ++index) {
+        binds[index].memory = commit.Memory();
+        binds[index].memoryOffset = commit.Offset() + stride * index;
+    }
+    Bind({}, binds);
+}
+
+MemoryCommit& SparseImage::Allocate(VkDeviceSize size) {
+    const VkMemoryRequirements commit_requirements{
+        .size = size,
+        .alignment = requirements.alignment,
+        .memoryTypeBits = requirements.memoryTypeBits,
+    };
+    committed_bytes += size;
+    runtime->sparse_stats.committed_bytes += size;
+    return commits.emplace_back(
+        runtime->memory_allocator.Commit(commit_requirements, MemoryUsage::DeviceLocal));
+}
+
+void SparseImage::Bind(std::span<const VkSparseImageMemoryBind> image_binds,
+                       std::span<const VkSparseMemoryBind> opaque_binds) {
+    const VkSparseImageOpaqueMemoryBindInfo opaque_bind_info{
+        .image = image,
+        .bindCount = static_cast<u32>(opaque_binds.size()),
+        .pBinds = opaque_binds.data(),
+    };
+    const VkSparseImageMemoryBindInfo image_bind_info{
+        .image = image,
+        .bindCount = static_cast<u32>(image_binds.size()),
+        .pBinds = image_binds.data(),
+    };
+    const VkBindSparseInfo bind_info{
+        .sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .bufferBindCount = 0,
+        .pBufferBinds = nullptr,
+        .imageOpaqueBindCount = opaque_binds.empty() ? 0U : 1U,
+        .pImageOpaqueBinds = &opaque_bind_info,
+        .imageBindCount = image_binds.empty() ? 0U : 1U,
+        .pImageBinds = &image_bind_info,
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores = nullptr,
+    };
+    // Sparse binds are not ordered with submissions, the next one waits for them on the GPU
+    runtime->scheduler.BindSparse(bind_info);
+}
 
 Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu_addr_,
              VAddr cpu_addr_)
     : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), scheduler{&runtime_.scheduler},
-      runtime{&runtime_}, original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
-                                                   runtime->ViewFormats(info.format))),
+      runtime{&runtime_}, is_sparse{runtime_.UseSparseResidency(info)},
+      original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
+                               runtime->ViewFormats(info.format), is_sparse)),
       aspect_mask(ImageAspectMask(info.format)) {
     if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported()) {
         switch (Settings::values.accelerate_astc.GetValue()) {
         case Settings::AstcDecodeMode::Gpu:
-            if (Settings::values.astc_recompression.GetValue() ==
-                    Settings::AstcRecompression::Uncompressed &&
-                info.size.depth == 1) {
-                flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
-            }
+            // Recompressed and 3D images are decoded to a temporary image on the GPU first
+            flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
             break;
         case Settings::AstcDecodeMode::CpuAsynchronous:
             flags |= VideoCommon::ImageFlagBits::AsynchronousDecode;
@@ -1388,6 +1776,10 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
         }
         flags |= VideoCommon::ImageFlagBits::Converted;
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
+        if (Settings::values.astc_recompression.GetValue() !=
+            Settings::AstcRecompression::Uncompressed) {
+            flags |= VideoCommon::ImageFlagBits::Recompressed;
+        }
     }
     if (IsPixelFormatBCn(info.format) && !runtime->device.IsOptimalBcnSupported()) {
         flags |= VideoCommon::ImageFlagBits::Converted;
@@ -1396,11 +1788,16 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
     if (runtime->device.HasDebuggingToolAttached()) {
         original_image.SetObjectNameEXT(VideoCommon::Name(*this).c_str());
     }
+    if (original_image && is_sparse) {
+        sparse = std::make_shared<SparseImage>(*runtime, *original_image,
+                                               MakeSparseImageCreateInfo(runtime->device, info));
+    }
     current_image = *original_image;
     storage_image_views.resize(info.resources.levels);
     if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported() &&
         Settings::values.astc_recompression.GetValue() ==
-            Settings::AstcRecompression::Uncompressed) {
+            Settings::AstcRecompression::Uncompressed &&
+        info.type != ImageType::e3D) {
         const auto& device = runtime->device.GetLogical();
         for (s32 level = 0; level < info.resources.levels; ++level) {
             storage_image_views[level] =
@@ -1422,14 +1819,24 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
     }
     scheduler->RequestOutsideRenderPassOperationContext();
     auto vk_copies = TransformBufferImageCopies(copies, offset, aspect_mask);
+    if (sparse) {
+        for (const VkBufferImageCopy& copy : vk_copies) {
+            sparse->CommitRegion(static_cast<s32>(copy.imageSubresource.mipLevel),
+                                 static_cast<s32>(copy.imageSubresource.baseArrayLayer),
+                                 static_cast<s32>(copy.imageSubresource.layerCount),
+                                 copy.imageOffset, copy.imageExtent);
+        }
+    }
     const VkBuffer src_buffer = buffer;
     const VkImage vk_image = *original_image;
     const VkImageAspectFlags vk_aspect_mask = aspect_mask;
     const bool is_initialized = std::exchange(initialized, true);
-    scheduler->Record([src_buffer, vk_image, vk_aspect_mask, is_initialized,
-                       vk_copies](vk::CommandBuffer cmdbuf) {
-        CopyBufferToImage(cmdbuf, src_buffer, vk_image, vk_aspect_mask, is_initialized, vk_copies);
-    });
+    scheduler->RecordImageTransfer(MakeUploadWriteBarrier(vk_image, vk_aspect_mask),
+                                   [src_buffer, vk_image, vk_aspect_mask, is_initialized,
+                                    vk_copies](vk::CommandBuffer cmdbuf) {
+                                       CopyBufferToImage(cmdbuf, src_buffer, vk_image,
+                                                         vk_aspect_mask, is_initialized, vk_copies);
+                                   });
     if (is_rescaled) {
         ScaleUp();
     }
@@ -1604,6 +2011,7 @@ bool Image::ScaleDown(bool ignore) {
     if (aspect_mask == 0) {
         aspect_mask = ImageAspectMask(info.format);
     }
+    CommitSparseRange(VideoCommon::SubresourceRange{.base{}, .extent = info.resources});
     if (NeedsScaleHelper()) {
         return BlitScaleHelper(false);
     } else {
@@ -1612,6 +2020,12 @@ bool Image::ScaleDown(bool ignore) {
     return true;
 }
 
+void Image::CommitSparseRange(const VideoCommon::SubresourceRange& range) {
+    if (sparse) {
+        sparse->CommitRange(range);
+    }
+}
+
 bool Image::BlitScaleHelper(bool scale_up) {
     using namespace VideoCommon;
     static constexpr auto BLIT_OPERATION = Tegra::Engines::Fermi2D::Operation::SrcCopy;
@@ -1693,10 +2107,14 @@ bool Image::NeedsScaleHelper() const {
 ImageView::ImageView(TextureCacheRuntime& runtime, const VideoCommon::ImageViewInfo& info,
                      ImageId image_id_, Image& image)
     : VideoCommon::ImageViewBase{info, image.info, image_id_, image.gpu_addr},
-      device{&runtime.device}, image_handle{image.Handle()},
+      device{&runtime.device}, sparse{image.Sparse()}, image_handle{image.Handle()},
       samples(ConvertSampleCount(image.info.num_samples)) {
     using Shader::TextureType;
 
+    if (info.IsRenderTarget()) {
+        CommitSparse();
+    }
+
     const VkImageAspectFlags aspect_mask = ImageViewAspectMask(info);
     std::array<SwizzleSource, 4> swizzle{
         SwizzleSource::R,
@@ -1844,6 +2262,7 @@ VkImageView ImageView::StorageView(Shader::TextureType texture_type,
     if (!image_handle) {
         return VK_NULL_HANDLE;
     }
+    CommitSparse();
     if (image_format == Shader::ImageFormat::Typeless) {
         return Handle(texture_type);
     }
@@ -1861,6 +2280,13 @@ VkImageView ImageView::StorageView(Shader::TextureType texture_type,
     return *view;
 }
 
+void ImageView::CommitSparse() {
+    // Views commit their whole range the first time they are written and drop the reference
+    if (const std::shared_ptr<SparseImage> sparse_image = std::exchange(sparse, nullptr)) {
+        sparse_image->CommitRange(range);
+    }
+}
+
 bool ImageView::IsRescaled() const noexcept {
     if (!slot_images) {
         return false;
@@ -1956,7 +2382,7 @@ Framebuffer::Framebuffer(TextureCacheRuntime& runtime, std::span<ImageView*, NUM
           .height = key.size.height,
       }} {
     CreateFramebuffer(runtime, color_buffers, depth_buffer, key.is_rescaled);
-    if (runtime.device.HasDebuggingToolAttached()) {
+    if (framebuffer && runtime.device.HasDebuggingToolAttached()) {
         framebuffer.SetObjectNameEXT(VideoCommon::Name(key).c_str());
     }
 }
@@ -1974,7 +2400,6 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                     std::span<ImageView*, NUM_RT> color_buffers,
                                     ImageView* depth_buffer, bool is_rescaled) {
     boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
-    RenderPassKey renderpass_key{};
     s32 num_layers = 1;
 
     const auto& resolution = runtime.resolution;
@@ -1992,6 +2417,8 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = std::min(height, is_rescaled ? resolution.ScaleUp(color_buffer->size.height)
                                               : color_buffer->size.height);
         attachments.push_back(color_buffer->RenderTarget());
+        rendering_attachments.color_views[index] = color_buffer->RenderTarget();
+        rendering_attachments.num_colors = static_cast<u32>(index + 1);
         renderpass_key.color_formats[index] = color_buffer->format;
         num_layers = std::max(num_layers, color_buffer->range.extent.layers);
         images[num_images] = color_buffer->ImageHandle();
@@ -2007,6 +2434,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = std::min(height, is_rescaled ? resolution.ScaleUp(depth_buffer->size.height)
                                               : depth_buffer->size.height);
         attachments.push_back(depth_buffer->RenderTarget());
+        rendering_attachments.depth_view = depth_buffer->RenderTarget();
         renderpass_key.depth_format = depth_buffer->format;
         num_layers = std::max(num_layers, depth_buffer->range.extent.layers);
         images[num_images] = depth_buffer->ImageHandle();
@@ -2026,6 +2454,16 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     render_area.height = std::min(render_area.height, height);
 
     num_color_buffers = static_cast<u32>(num_colors);
+    rendering_attachments.num_layers = static_cast<u32>(std::max(num_layers, 1));
+    rendering_attachments.has_depth = has_depth;
+    rendering_attachments.has_stencil = has_stencil;
+    if (runtime.device.IsKhrDynamicRenderingSupported()) {
+        // The views are bound when the render pass begins, nothing has to be created
+        return;
+    }
+    static auto& framebuffers_created = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_vulkan_framebuffers_created_total", "Framebuffer objects created for render targets");
+    framebuffers_created.Increment();
     framebuffer = runtime.device.GetLogical().CreateFramebuffer({
         .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -2035,7 +2473,7 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         .pAttachments = attachments.data(),
         .width = render_area.width,
         .height = render_area.height,
-        .layers = static_cast<u32>(std::max(num_layers, 1)),
+        .layers = rendering_attachments.num_layers,
     });
 }
 
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <memory>
 #include <span>
+#include <vector>
 
 #include "video_core/texture_cache/texture_cache_base.h"
 
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
@@ -37,6 +40,60 @@ class RenderPassCache;
 class StagingBufferPool;
 class Scheduler;
 
+/// Residency counters of the images created with sparse residency
+struct SparseResidencyStats {
+    u64 num_images = 0;      ///< Number of live sparse images
+    u64 reserved_bytes = 0;  ///< Size of the memory the sparse images would require when resident
+    u64 committed_bytes = 0; ///< Size of the memory committed to sparse images
+    u64 committed_tiles = 0; ///< Number of sparse tiles backed with memory
+};
+
+/// Sparse residency state of an image, memory is committed per tile on first write
+class SparseImage {
+public:
+    explicit SparseImage(TextureCacheRuntime& runtime, VkImage image,
+                         const VkImageCreateInfo& image_ci);
+    ~SparseImage();
+
+    SparseImage(const SparseImage&) = delete;
+    SparseImage& operator=(const SparseImage&) = delete;
+
+    /// Commits the tiles covering a region of a mip level in the given layers
+    void CommitRegion(s32 level, s32 base_layer, s32 num_layers, VkOffset3D offset,
+                      VkExtent3D extent);
+
+    /// Commits all the tiles of the given subresources
+    void CommitRange(const VideoCommon::SubresourceRange& range);
+
+private:
+    [[nodiscard]] VkExtent3D LevelExtent(s32 level) const noexcept;
+
+    [[nodiscard]] VkExtent3D LevelTiles(s32 level) const noexcept;
+
+    void CommitMipTail(s32 base_layer, s32 num_layers);
+
+    MemoryCommit& Allocate(VkDeviceSize size);
+
+    void Bind(std::span<const VkSparseImageMemoryBind> image_binds,
+              std::span<const VkSparseMemoryBind> opaque_binds);
+
+    TextureCacheRuntime* runtime;
+    VkImage image;
+    VkMemoryRequirements requirements{};
+    VkSparseImageMemoryRequirements sparse_requirements{};
+    VkExtent3D extent{};
+    s32 num_levels = 0;
+    s32 num_layers = 0;
+    size_t tiles_per_layer = 0;
+    std::vector<size_t> level_offsets;
+    std::vector<u64> committed_tiles;
+    std::vector<bool> committed_mip_tails;
+    std::vector<MemoryCommit> commits;
+    u64 committed_bytes = 0;
+    u64 num_committed_tiles = 0;
+    bool is_fully_resident = false;
+};
+
 class TextureCacheRuntime {
 public:
     explicit TextureCacheRuntime(const Device& device_, Scheduler& scheduler_,
@@ -112,6 +169,9 @@ public:
 
     void BarrierFeedbackLoop();
 
+    /// Returns true when the image should be created without backing memory
+    [[nodiscard]] bool UseSparseResidency(const VideoCommon::ImageInfo& info) const;
+
     const Device& device;
     Scheduler& scheduler;
     MemoryAllocator& memory_allocator;
@@ -125,6 +185,9 @@ public:
 
     static constexpr size_t indexing_slots = 8 * sizeof(size_t);
     std::array<vk::Buffer, indexing_slots> buffers{};
+
+    bool use_sparse_residency = false;
+    SparseResidencyStats sparse_stats;
 };
 
 class Image : public VideoCommon::ImageBase {
@@ -177,6 +240,13 @@ public:
 
     bool ScaleDown(bool ignore = false);
 
+    /// Commits sparse memory to the given subresources before they are written
+    void CommitSparseRange(const VideoCommon::SubresourceRange& range);
+
+    [[nodiscard]] const std::shared_ptr<SparseImage>& Sparse() const noexcept {
+        return sparse;
+    }
+
 private:
     bool BlitScaleHelper(bool scale_up);
 
@@ -185,6 +255,8 @@ private:
     Scheduler* scheduler{};
     TextureCacheRuntime* runtime{};
 
+    bool is_sparse = false;
+    std::shared_ptr<SparseImage> sparse;
     vk::Image original_image;
     std::vector<vk::ImageView> storage_image_views;
     VkImageAspectFlags aspect_mask = 0;
@@ -227,6 +299,9 @@ public:
 
     [[nodiscard]] bool IsRescaled() const noexcept;
 
+    /// Commits sparse memory to the subresources of the view before they are written
+    void CommitSparse();
+
     [[nodiscard]] VkImageView Handle(Shader::TextureType texture_type) const noexcept {
         return *image_views[static_cast<size_t>(texture_type)];
     }
@@ -261,6 +336,7 @@ private:
 
     const Device* device = nullptr;
     const SlotVector<Image>* slot_images = nullptr;
+    std::shared_ptr<SparseImage> sparse;
 
     std::array<vk::ImageView, Shader::NUM_TEXTURE_TYPES> image_views;
     std::unique_ptr<StorageViews> storage_views;
@@ -317,14 +393,25 @@ public:
                            std::span<ImageView*, NUM_RT> color_buffers, ImageView* depth_buffer,
                            bool is_rescaled = false);
 
+    /// Returns the framebuffer object, or a null handle when the views are bound with dynamic
+    /// rendering
     [[nodiscard]] VkFramebuffer Handle() const noexcept {
         return *framebuffer;
     }
 
+    [[nodiscard]] const RenderingAttachments& Attachments() const noexcept {
+        return rendering_attachments;
+    }
+
     [[nodiscard]] VkRenderPass RenderPass() const noexcept {
         return renderpass;
     }
 
+    /// Returns the formats and sample count of the render targets
+    [[nodiscard]] const RenderPassKey& RenderTargets() const noexcept {
+        return renderpass_key;
+    }
+
     [[nodiscard]] VkExtent2D RenderArea() const noexcept {
         return render_area;
     }
@@ -364,6 +451,8 @@ public:
 private:
     vk::Framebuffer framebuffer;
     VkRenderPass renderpass{};
+    RenderPassKey renderpass_key{};
+    RenderingAttachments rendering_attachments;
     VkExtent2D render_area{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
     u32 num_color_buffers = 0;
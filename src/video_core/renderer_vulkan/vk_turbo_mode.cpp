@@ -6,6 +6,8 @@
 #endif
 
 #include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
 #include "video_core/host_shaders/vulkan_turbo_mode_comp_spv.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
@@ -16,11 +18,38 @@ namespace Vulkan {
 
 using namespace Common::Literals;
 
-TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld)
+namespace {
+/// Time between keep alive probes while the GPU is lightly loaded
+constexpr std::chrono::milliseconds PROBE_INTERVAL{100};
+
+/// Returns the share of each frame the GPU has to be busy to boost, 0 to always boost
+f64 LoadThreshold([[maybe_unused]] bool measures_load) {
+    const u8 load_percent = Settings::values.force_max_clock_load.GetValue();
+    if (load_percent == 0) {
+        return 0.0;
+    }
+#ifdef ANDROID
+    // Clock drops are seen by timing the keep alive dispatch, which doesn't run here
+    LOG_WARNING(Render_Vulkan, "Forcing maximum clocks above a GPU load is not supported");
+    return 0.0;
+#else
+    if (!measures_load) {
+        // The load would read as idle and only the probes would keep the clocks up
+        LOG_WARNING(Render_Vulkan, "GPU timestamps are not supported, always forcing max clocks");
+        return 0.0;
+    }
+    return load_percent / 100.0;
+#endif
+}
+} // Anonymous namespace
+
+TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld,
+                     bool measures_load)
+    :
 #ifndef ANDROID
-    : m_device{CreateDevice(instance, dld, VK_NULL_HANDLE)}, m_allocator{m_device}
+      m_device{CreateDevice(instance, dld, VK_NULL_HANDLE)}, m_allocator{m_device},
 #endif
-{
+      m_governor{LoadThreshold(measures_load)} {
     {
         std::scoped_lock lk{m_submission_lock};
         m_submission_time = std::chrono::steady_clock::now();
@@ -36,6 +65,18 @@ void TurboMode::QueueSubmitted() {
     m_submission_cv.notify_one();
 }
 
+void TurboMode::FrameTimed(std::chrono::nanoseconds gpu_time) {
+    std::scoped_lock lk{m_submission_lock};
+    m_governor.FrameTimed(gpu_time, std::chrono::steady_clock::now());
+    m_submission_cv.notify_one();
+}
+
+void TurboMode::SetSuspended(bool suspended) {
+    std::scoped_lock lk{m_submission_lock};
+    m_suspended = suspended;
+    m_submission_cv.notify_one();
+}
+
 void TurboMode::Run(std::stop_token stop_token) {
 #ifndef ANDROID
     auto& dld = m_device.GetLogical();
@@ -151,6 +192,17 @@ void TurboMode::Run(std::stop_token stop_token) {
 #endif
 
     while (!stop_token.stop_requested()) {
+        {
+            std::unique_lock lk{m_submission_lock};
+            if (m_suspended) {
+#if defined(ANDROID) && defined(ARCHITECTURE_arm64)
+                adrenotools_set_turbo(false);
+#endif
+                Common::CondvarWait(m_submission_cv, lk, stop_token,
+                                    [this] { return !m_suspended; });
+                continue;
+            }
+        }
 #ifdef ANDROID
 #ifdef ARCHITECTURE_arm64
         adrenotools_set_turbo(true);
@@ -217,13 +269,29 @@ void TurboMode::Run(std::stop_token stop_token) {
             .pSignalSemaphores = nullptr,
         };
 
+        const auto submit_time = std::chrono::steady_clock::now();
         m_device.GetGraphicsQueue().Submit(std::array{submit_info}, *fence);
 
         // Wait for completion.
         fence.Wait();
+        const auto finish_time = std::chrono::steady_clock::now();
 #endif
-        // Wait for the next graphics queue submission if necessary.
         std::unique_lock lk{m_submission_lock};
+#ifndef ANDROID
+        // The dispatch is fixed work, it takes longer when the GPU lowers its clocks
+        m_governor.ProbeTimed(finish_time - submit_time, finish_time);
+#endif
+        if (!m_governor.ShouldBoost(std::chrono::steady_clock::now())) {
+#if defined(ANDROID) && defined(ARCHITECTURE_arm64)
+            adrenotools_set_turbo(false);
+#endif
+            // Only probe from time to time until the GPU gets busy
+            m_submission_cv.wait_for(lk, stop_token, PROBE_INTERVAL, [this] {
+                return m_governor.ShouldBoost(std::chrono::steady_clock::now());
+            });
+        }
+
+        // Wait for the next graphics queue submission if necessary.
         Common::CondvarWait(m_submission_cv, lk, stop_token, [this] {
             return (std::chrono::steady_clock::now() - m_submission_time) <=
                    std::chrono::milliseconds{100};
@@ -7,6 +7,7 @@
 #include <mutex>
 
 #include "common/polyfill_thread.h"
+#include "video_core/turbo_governor.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -15,11 +16,19 @@ namespace Vulkan {
 
 class TurboMode {
 public:
-    explicit TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld);
+    /// @param measures_load Whether the GPU time of each frame is reported through FrameTimed
+    explicit TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld,
+                       bool measures_load);
     ~TurboMode();
 
     void QueueSubmitted();
 
+    /// Accounts the GPU time of a presented frame
+    void FrameTimed(std::chrono::nanoseconds gpu_time);
+
+    /// Stops holding the GPU at high clocks until resumed
+    void SetSuspended(bool suspended);
+
 private:
     void Run(std::stop_token stop_token);
 
@@ -30,6 +39,8 @@ private:
     std::mutex m_submission_lock;
     std::condition_variable_any m_submission_cv;
     std::chrono::time_point<std::chrono::steady_clock> m_submission_time{};
+    VideoCommon::TurboGovernor m_governor;
+    bool m_suspended = false;
 
     std::jthread m_thread;
 };
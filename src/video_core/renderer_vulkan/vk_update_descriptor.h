@@ -47,6 +47,11 @@ public:
         return upload_start;
     }
 
+    /// Returns the number of entries pushed since the last acquire
+    size_t UpdateSize() const noexcept {
+        return static_cast<size_t>(payload_cursor - upload_start);
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
         *(payload_cursor++) = VkDescriptorImageInfo{
             .sampler = sampler,
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/object_pool.h"
 #include "video_core/control/channel_state.h"
@@ -111,13 +112,26 @@ void ShaderCache::GetGraphicsEnvironments(GraphicsEnvironments& result,
     }
 }
 
+void ShaderCache::ReportGlobalMemoryFallback(u64 unique_hash) {
+    std::scoped_lock lock{reported_mutex};
+    if (reported_global_memory.insert(unique_hash).second) {
+        LOG_WARNING(Render, "Shader 0x{:016x} uses slow global memory fallbacks", unique_hash);
+    }
+}
+
 ShaderInfo* ShaderCache::TryGet(VAddr addr) const {
+    if (const auto shader = recent_lookups.Find(addr)) {
+        return *shader;
+    }
+
     std::scoped_lock lock{lookup_mutex};
 
     const auto it = lookup_cache.find(addr);
     if (it == lookup_cache.end()) {
         return nullptr;
     }
+    // Inserted with the lookup lock held, so it can't race with the removal of the shader
+    recent_lookups.Insert(addr, it->second->data);
     return it->second->data;
 }
 
@@ -167,6 +181,7 @@ void ShaderCache::RemovePendingShaders() {
         const auto it = lookup_cache.find(entry->addr_start);
         ASSERT(it != lookup_cache.end());
         lookup_cache.erase(it);
+        recent_lookups.Erase(entry->addr_start);
     }
     marked_for_removal.clear();
 
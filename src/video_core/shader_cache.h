@@ -8,10 +8,12 @@
 #include <mutex>
 #include <span>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/concurrent_lru_cache.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
@@ -38,6 +40,7 @@ struct ShaderInfo {
 class ShaderCache : public VideoCommon::ChannelSetupCaches<VideoCommon::ChannelInfo> {
     static constexpr u64 YUZU_PAGEBITS = 14;
     static constexpr u64 YUZU_PAGESIZE = u64(1) << YUZU_PAGEBITS;
+    static constexpr size_t MAX_RECENT_LOOKUPS = 1024;
 
     static constexpr size_t NUM_PROGRAMS = 6;
 
@@ -93,6 +96,10 @@ protected:
     void GetGraphicsEnvironments(GraphicsEnvironments& result,
                                  const std::array<u64, NUM_PROGRAMS>& unique_hashes);
 
+    /// @brief Logs a shader accessing global memory that couldn't be tracked to storage buffers
+    /// @param unique_hash Hash of the shader, each shader is only logged once
+    void ReportGlobalMemoryFallback(u64 unique_hash);
+
     std::array<const ShaderInfo*, NUM_PROGRAMS> shader_infos{};
     bool last_shaders_valid = false;
 
@@ -152,9 +159,14 @@ private:
     std::mutex invalidation_mutex;
 
     std::unordered_map<u64, std::unique_ptr<Entry>> lookup_cache;
+    /// Shaders recently found in the lookup cache, looked up without taking lookup_mutex
+    mutable Common::ConcurrentLruCache<u64, ShaderInfo*> recent_lookups{MAX_RECENT_LOOKUPS};
     std::unordered_map<u64, std::vector<Entry*>> invalidation_cache;
     std::vector<std::unique_ptr<ShaderInfo>> storage;
     std::vector<Entry*> marked_for_removal;
+
+    std::mutex reported_mutex;
+    std::unordered_set<u64> reported_global_memory;
 };
 
 } // namespace VideoCommon
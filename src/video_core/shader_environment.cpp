@@ -2,17 +2,22 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <sstream>
+#include <streambuf>
+#include <unordered_set>
 #include <utility>
 
 #include "common/assert.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/fast_hash.h"
 #include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
@@ -26,6 +31,35 @@
 namespace VideoCommon {
 
 constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr size_t FILE_HEADER_SIZE = MAGIC_NUMBER.size() + sizeof(u32);
+
+constexpr u32 ENTRY_MAGIC = 0x45504950; // "PIPE"
+
+/// Header of a pipeline in the cache file, followed by its environments and key
+struct PipelineEntryHeader {
+    u32 magic;
+    u32 num_envs;
+    u64 key_hash;
+    u64 size;
+    u64 checksum;
+};
+static_assert(std::is_trivially_copyable_v<PipelineEntryHeader>);
+static_assert(sizeof(PipelineEntryHeader) == 32);
+
+/// Checksum of an entry, covering its header with the checksum cleared and its payload
+static u64 EntryChecksum(PipelineEntryHeader header, const void* payload, size_t payload_size) {
+    header.checksum = Common::FastHash64(payload, payload_size);
+    return Common::FastHash64(&header, sizeof(header));
+}
+
+/// Read-only stream buffer over memory, used to deserialize entries of a mapped cache file
+class MemoryStreamBuffer final : public std::streambuf {
+public:
+    explicit MemoryStreamBuffer(std::span<const u8> data) {
+        char* const begin = const_cast<char*>(reinterpret_cast<const char*>(data.data()));
+        setg(begin, begin, begin + data.size());
+    }
+};
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
@@ -156,7 +190,7 @@ std::optional<u64> GenericEnvironment::Analyze() {
     }
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(*size);
-    return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
+    return Common::FastHash64(code.data(), *size);
 }
 
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
@@ -186,14 +220,14 @@ u64 GenericEnvironment::CalculateHash() const {
     const size_t size{ReadSizeBytes()};
     const auto data{std::make_unique<char[]>(size)};
     gpu_memory->ReadBlock(program_base + read_lowest, data.get(), size);
-    return Common::CityHash64(data.get(), size);
+    return Common::FastHash64(data.get(), size);
 }
 
 void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::ostream& file) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
@@ -277,7 +311,7 @@ Tegra::Texture::TICEntry GenericEnvironment::ReadTextureInfo(GPUVAddr tic_addr,
     ASSERT(handle.first <= tic_limit);
     const GPUVAddr descriptor_addr{tic_addr + handle.first * sizeof(Tegra::Texture::TICEntry)};
     Tegra::Texture::TICEntry entry;
-    gpu_memory->ReadBlock(descriptor_addr, &entry, sizeof(entry));
+    gpu_memory->ReadBlockUnsafe(descriptor_addr, &entry, sizeof(entry));
     return entry;
 }
 
@@ -286,7 +320,7 @@ GraphicsEnvironment::GraphicsEnvironment(Tegra::Engines::Maxwell3D& maxwell3d_,
                                          Maxwell::ShaderType program, GPUVAddr program_base_,
                                          u32 start_address_)
     : GenericEnvironment{gpu_memory_, program_base_, start_address_}, maxwell3d{&maxwell3d_} {
-    gpu_memory->ReadBlock(program_base + start_address, &sph, sizeof(sph));
+    gpu_memory->ReadBlockUnsafe(program_base + start_address, &sph, sizeof(sph));
     initial_offset = sizeof(sph);
     gp_passthrough_mask = maxwell3d->regs.post_vtg_shader_attrib_skip_mask;
     switch (program) {
@@ -448,7 +482,7 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+void FileEnvironment::Deserialize(std::istream& file) {
     u64 code_size{};
     u64 num_texture_types{};
     u64 num_texture_pixel_formats{};
@@ -599,12 +633,24 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
-    const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    std::ostringstream payload_stream(std::ios::binary);
+    payload_stream.exceptions(std::ios::failbit);
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
-    }
-    file.write(key.data(), key.size_bytes());
+        env->Serialize(payload_stream);
+    }
+    payload_stream.write(key.data(), key.size_bytes());
+
+    const std::string payload{std::move(payload_stream).str()};
+    PipelineEntryHeader header{
+        .magic = ENTRY_MAGIC,
+        .num_envs = static_cast<u32>(envs.size()),
+        .key_hash = Common::FastHash64(key.data(), key.size_bytes()),
+        .size = payload.size(),
+        .checksum = 0,
+    };
+    header.checksum = EntryChecksum(header, payload.data(), payload.size());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        .write(payload.data(), payload.size());
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
@@ -616,22 +662,22 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
 
 void LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
+    Common::UniqueFunction<void, std::istream&, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::istream&, std::vector<FileEnvironment>> load_graphics) {
+    Common::FS::MappedFile mapped_file;
+    if (!mapped_file.Open(filename)) {
         return;
     }
-    file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
+    const std::span<const u8> data{mapped_file.Span()};
 
-    std::array<char, 8> magic_number;
-    u32 cache_version;
-    file.read(magic_number.data(), magic_number.size())
-        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    std::array<char, 8> magic_number{};
+    u32 cache_version{};
+    if (data.size() >= FILE_HEADER_SIZE) {
+        std::memcpy(magic_number.data(), data.data(), magic_number.size());
+        std::memcpy(&cache_version, data.data() + magic_number.size(), sizeof(cache_version));
+    }
     if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
-        file.close();
+        mapped_file.Close();
         if (Common::FS::RemoveFile(filename)) {
             if (magic_number != MAGIC_NUMBER) {
                 LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
@@ -646,28 +692,71 @@ void LoadPipelines(
         }
         return;
     }
-    while (file.tellg() != end) {
+
+    // Index the entries from their headers, only touching the pages of each header
+    std::vector<std::pair<PipelineEntryHeader, size_t>> entries;
+    size_t offset{FILE_HEADER_SIZE};
+    while (data.size() - offset >= sizeof(PipelineEntryHeader)) {
+        PipelineEntryHeader header;
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        const size_t payload_offset{offset + sizeof(header)};
+        if (header.magic != ENTRY_MAGIC || header.num_envs == 0 ||
+            header.num_envs > Maxwell::MaxShaderProgram ||
+            header.size > data.size() - payload_offset) {
+            break;
+        }
+        entries.emplace_back(header, payload_offset);
+        offset = payload_offset + header.size;
+    }
+    const size_t valid_size{offset};
+
+    size_t num_corrupt{};
+    std::unordered_set<u64> loaded_keys;
+    for (const auto& [header, payload_offset] : entries) {
         if (stop_loading.stop_requested()) {
             return;
         }
-        u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
-        std::vector<FileEnvironment> envs(num_envs);
-        for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
+        if (!loaded_keys.insert(header.key_hash).second) {
+            // Duplicated pipeline, the first entry has already been loaded
+            continue;
         }
-        if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
-        } else {
-            load_graphics(file, std::move(envs));
+        const std::span<const u8> payload{data.subspan(payload_offset, header.size)};
+        if (EntryChecksum(header, payload.data(), payload.size()) != header.checksum) {
+            ++num_corrupt;
+            continue;
+        }
+        MemoryStreamBuffer buffer{payload};
+        std::istream stream{&buffer};
+        stream.exceptions(std::ios::failbit);
+        try {
+            std::vector<FileEnvironment> envs(header.num_envs);
+            for (FileEnvironment& env : envs) {
+                env.Deserialize(stream);
+            }
+            if (envs.front().ShaderStage() == Shader::Stage::Compute) {
+                load_compute(stream, std::move(envs.front()));
+            } else {
+                load_graphics(stream, std::move(envs));
+            }
+        } catch (const std::ios_base::failure& e) {
+            LOG_ERROR(Common_Filesystem, "Failed to read pipeline cache entry: {}", e.what());
+            ++num_corrupt;
         }
     }
-
-} catch (const std::ios_base::failure& e) {
-    LOG_ERROR(Common_Filesystem, "{}", e.what());
-    if (!Common::FS::RemoveFile(filename)) {
-        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
-                  Common::FS::PathToUTF8String(filename));
+    if (num_corrupt > 0) {
+        LOG_WARNING(Common_Filesystem, "Skipped {} corrupt pipeline cache entries", num_corrupt);
+    }
+    if (valid_size != data.size()) {
+        // Drop the truncated tail, otherwise new entries would be appended after it
+        LOG_WARNING(Common_Filesystem, "Removing {} bytes of truncated pipeline cache data",
+                    data.size() - valid_size);
+        mapped_file.Close();
+        std::error_code ec;
+        std::filesystem::resize_file(filename, valid_size, ec);
+        if (ec) {
+            LOG_ERROR(Common_Filesystem, "Failed to truncate pipeline cache file {}: {}",
+                      Common::FS::PathToUTF8String(filename), ec.message());
+        }
     }
 }
 
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>
 
+#include "common/metrics.h"
 #include "video_core/shader_notify.h"
 
 using namespace std::chrono_literals;
@@ -31,4 +32,11 @@ int ShaderNotify::ShadersBuilding() noexcept {
     return now_building - report_base;
 }
 
+void ShaderNotify::MarkShaderComplete() noexcept {
+    static auto& shaders_built = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_shaders_built_total", "Shader pipelines built by the renderer");
+    shaders_built.Increment();
+    ++num_complete;
+}
+
 } // namespace VideoCore
@@ -11,10 +11,13 @@ class ShaderNotify {
 public:
     [[nodiscard]] int ShadersBuilding() noexcept;
 
-    void MarkShaderComplete() noexcept {
-        ++num_complete;
+    /// Returns the number of shaders that finished building since the start
+    [[nodiscard]] int ShadersCompleted() const noexcept {
+        return num_complete.load(std::memory_order::relaxed);
     }
 
+    void MarkShaderComplete() noexcept;
+
     void MarkShaderBuilding() noexcept {
         ++num_building;
     }
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <algorithm>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
@@ -26,10 +28,17 @@ public:
 
     void Invalidate() noexcept {
         std::ranges::fill(read_descriptors, 0);
+        std::ranges::fill(validated_descriptors, 0);
     }
 
     [[nodiscard]] std::pair<Descriptor, bool> Read(u32 index) {
         DEBUG_ASSERT(index <= current_limit);
+        if (IsDescriptorValidated(index)) {
+            // The pool was not written since the descriptor was last compared
+            ++num_cached_reads;
+            return {descriptors[index], false};
+        }
+        ++num_guest_reads;
         const GPUVAddr gpu_addr = current_gpu_addr + index * sizeof(Descriptor);
         std::pair<Descriptor, bool> result;
         gpu_memory.ReadBlockUnsafe(gpu_addr, &result.first, sizeof(Descriptor));
@@ -42,6 +51,9 @@ public:
         if (result.second) {
             descriptors[index] = result.first;
         }
+        if (tracked_range) {
+            MarkDescriptorAsValidated(index);
+        }
         return result;
     }
 
@@ -49,6 +61,54 @@ public:
         return current_limit;
     }
 
+    [[nodiscard]] GPUVAddr GpuAddr() const noexcept {
+        return current_gpu_addr;
+    }
+
+    [[nodiscard]] size_t SizeBytes() const noexcept {
+        return (static_cast<size_t>(current_limit) + 1) * sizeof(Descriptor);
+    }
+
+    /// Returns true when the pool changed and its new memory has to be tracked for writes
+    [[nodiscard]] bool NeedsTracking() const noexcept {
+        return needs_tracking;
+    }
+
+    /// Returns the device memory range tracked for writes to the pool, if any
+    [[nodiscard]] std::optional<std::pair<DAddr, size_t>> TrackedRange() const noexcept {
+        return tracked_range;
+    }
+
+    /// Sets the device memory range writes to the pool are reported for, descriptors are only
+    /// served without reading guest memory while a range is tracked
+    void SetTrackedRange(std::optional<std::pair<DAddr, size_t>> range) noexcept {
+        tracked_range = range;
+        needs_tracking = false;
+        MarkModified();
+    }
+
+    /// Stops trusting the tracked range, the pool is tracked again on the next synchronization
+    void ResetTracking() noexcept {
+        tracked_range = std::nullopt;
+        needs_tracking = true;
+        MarkModified();
+    }
+
+    [[nodiscard]] bool IsTrackedIn(DAddr addr, size_t size) const noexcept {
+        return tracked_range && addr < tracked_range->first + tracked_range->second &&
+               tracked_range->first < addr + size;
+    }
+
+    /// Compares the descriptors against guest memory again on their next read
+    void MarkModified() noexcept {
+        std::ranges::fill(validated_descriptors, 0);
+    }
+
+    /// Returns the reads served from the table and from guest memory since the last call
+    [[nodiscard]] std::pair<u64, u64> TakeReadCounts() noexcept {
+        return {std::exchange(num_cached_reads, 0), std::exchange(num_guest_reads, 0)};
+    }
+
 private:
     void Refresh(GPUVAddr gpu_addr, u32 limit) {
         current_gpu_addr = gpu_addr;
@@ -57,7 +117,10 @@ private:
         const size_t num_descriptors = static_cast<size_t>(limit) + 1;
         read_descriptors.clear();
         read_descriptors.resize(Common::DivCeil(num_descriptors, 64U), 0);
+        validated_descriptors.clear();
+        validated_descriptors.resize(read_descriptors.size(), 0);
         descriptors.resize(num_descriptors);
+        needs_tracking = true;
     }
 
     void MarkDescriptorAsRead(u32 index) noexcept {
@@ -68,11 +131,24 @@ private:
         return (read_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
     }
 
+    void MarkDescriptorAsValidated(u32 index) noexcept {
+        validated_descriptors[index / 64] |= 1ULL << (index % 64);
+    }
+
+    [[nodiscard]] bool IsDescriptorValidated(u32 index) const noexcept {
+        return (validated_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
+    }
+
     Tegra::MemoryManager& gpu_memory;
     GPUVAddr current_gpu_addr{};
     u32 current_limit{};
     std::vector<u64> read_descriptors;
+    std::vector<u64> validated_descriptors;
     std::vector<Descriptor> descriptors;
+    std::optional<std::pair<DAddr, size_t>> tracked_range;
+    bool needs_tracking = true;
+    u64 num_cached_reads = 0;
+    u64 num_guest_reads = 0;
 };
 
 } // namespace VideoCommon
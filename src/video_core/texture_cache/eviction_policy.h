@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/// Inputs of the eviction cost model for a single image
+struct EvictionCandidate {
+    u64 size_bytes;     ///< Host memory used by the image
+    u64 load_time_us;   ///< Measured time it took to load the image contents, zero when unknown
+    u64 age;            ///< Frames since the image was last used
+    bool costly_load;   ///< The image contents are converted on the CPU
+    bool must_download; ///< The image has to be downloaded to guest memory before eviction
+};
+
+/// Cost model used to decide which images are evicted first when memory is short.
+/// Costs are estimated in microseconds of work required to bring an image back.
+namespace EvictionCostModel {
+
+/// Estimated host to device upload throughput in bytes per microsecond
+constexpr double UPLOAD_BYTES_PER_US = 4096.0;
+/// Estimated device to host download throughput in bytes per microsecond
+constexpr double DOWNLOAD_BYTES_PER_US = 2048.0;
+/// Slowdown of loads converted on the CPU when the load time has not been measured
+constexpr double COSTLY_LOAD_FACTOR = 8.0;
+/// Stall caused by waiting for the GPU before downloading an image
+constexpr double DOWNLOAD_STALL_US = 1000.0;
+/// Age in frames at which an image is assumed to have even odds of being used again
+constexpr double REUSE_HALF_LIFE = 120.0;
+/// Cost per MiB that is accepted when memory usage is halfway to the critical threshold
+constexpr double BASE_BUDGET_PER_MIB = 2000.0;
+
+/// Returns the estimated cost of evicting an image
+[[nodiscard]] constexpr double Cost(const EvictionCandidate& candidate) noexcept {
+    const double size = static_cast<double>(candidate.size_bytes);
+    double reload_us = static_cast<double>(candidate.load_time_us);
+    if (candidate.load_time_us == 0) {
+        reload_us = size / UPLOAD_BYTES_PER_US;
+        if (candidate.costly_load) {
+            reload_us *= COSTLY_LOAD_FACTOR;
+        }
+    }
+    const double reuse_odds =
+        REUSE_HALF_LIFE / (REUSE_HALF_LIFE + static_cast<double>(candidate.age));
+    const double download_us =
+        candidate.must_download ? DOWNLOAD_STALL_US + size / DOWNLOAD_BYTES_PER_US : 0.0;
+    return reload_us * reuse_odds + download_us;
+}
+
+/// Returns the eviction cost of an image per MiB freed, lower scores are evicted first
+[[nodiscard]] constexpr double Score(const EvictionCandidate& candidate) noexcept {
+    const double size_mib = static_cast<double>(std::max<u64>(candidate.size_bytes, 1)) /
+                            static_cast<double>(1ULL << 20);
+    return Cost(candidate) / size_mib;
+}
+
+/// Returns how close memory usage is to the critical threshold, from 0.0 to 1.0
+[[nodiscard]] constexpr double Pressure(u64 used_memory, u64 minimum_memory,
+                                        u64 critical_memory) noexcept {
+    if (used_memory <= minimum_memory) {
+        return 0.0;
+    }
+    if (used_memory >= critical_memory || critical_memory <= minimum_memory) {
+        return 1.0;
+    }
+    return static_cast<double>(used_memory - minimum_memory) /
+           static_cast<double>(critical_memory - minimum_memory);
+}
+
+/// Returns the highest score that is evicted under the given memory pressure
+[[nodiscard]] constexpr double Budget(double pressure) noexcept {
+    if (pressure >= 1.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return BASE_BUDGET_PER_MIB * pressure / (1.0 - pressure);
+}
+
+} // namespace EvictionCostModel
+
+} // namespace VideoCommon
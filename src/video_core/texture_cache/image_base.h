@@ -41,7 +41,8 @@ enum class ImageFlagBits : u32 {
     IsRescalable = 1 << 15,
 
     AsynchronousDecode = 1 << 16,
-    IsDecoding = 1 << 17, ///< Is currently being decoded asynchronously.
+    IsDecoding = 1 << 17,   ///< Is currently being decoded asynchronously.
+    Recompressed = 1 << 18, ///< Converted contents are recompressed to a smaller host format
 };
 DECLARE_ENUM_FLAG_OPERATORS(ImageFlagBits)
 
@@ -91,6 +92,7 @@ struct ImageBase {
     u32 converted_size_bytes = 0;
     u32 scale_rating = 0;
     u64 scale_tick = 0;
+    u64 load_time_us = 0;
     bool has_scaled = false;
 
     size_t channel = 0;
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <bit>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Maps pages to the small list of objects overlapping them.
+ *
+ * Pages are stored in a flat open addressing table with linear probing, and the objects of each
+ * page are kept inline up to INLINE_CAPACITY. Pages are never removed, as the cache keeps reusing
+ * the same regions of memory; their lists are emptied instead.
+ *
+ * Buckets are moved when the table grows, references to them are only valid until the next
+ * insertion.
+ */
+template <typename T, size_t INLINE_CAPACITY = 4>
+class PageIndex {
+public:
+    using Bucket = boost::container::small_vector<T, INLINE_CAPACITY>;
+
+    /// Returns the objects of a page, or nullptr when nothing was ever added to it
+    [[nodiscard]] Bucket* Find(u64 page) noexcept {
+        if (keys.empty()) {
+            return nullptr;
+        }
+        for (size_t slot = Slot(page);; slot = (slot + 1) & mask) {
+            if (keys[slot] == page) {
+                return &buckets[slot];
+            }
+            if (keys[slot] == EMPTY_KEY) {
+                return nullptr;
+            }
+        }
+    }
+
+    /// Returns the objects of a page, adding the page when it is not in the index
+    [[nodiscard]] Bucket& operator[](u64 page) {
+        if ((num_pages + 1) * 2 > keys.size()) {
+            Grow();
+        }
+        size_t slot = Slot(page);
+        for (; keys[slot] != EMPTY_KEY; slot = (slot + 1) & mask) {
+            if (keys[slot] == page) {
+                return buckets[slot];
+            }
+        }
+        keys[slot] = page;
+        ++num_pages;
+        return buckets[slot];
+    }
+
+private:
+    static constexpr u64 EMPTY_KEY = std::numeric_limits<u64>::max();
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    size_t Slot(u64 page) const noexcept {
+        // Pages of an image are contiguous, Fibonacci hashing spreads them over the table
+        return static_cast<size_t>((page * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    void Grow() {
+        const size_t capacity = keys.empty() ? INITIAL_CAPACITY : keys.size() * 2;
+        std::vector<u64> old_keys(capacity, EMPTY_KEY);
+        std::vector<Bucket> old_buckets(capacity);
+        std::swap(keys, old_keys);
+        std::swap(buckets, old_buckets);
+        mask = capacity - 1;
+        shift = 64 - std::countr_zero(capacity);
+        for (size_t index = 0; index < old_keys.size(); ++index) {
+            if (old_keys[index] == EMPTY_KEY) {
+                continue;
+            }
+            size_t slot = Slot(old_keys[index]);
+            while (keys[slot] != EMPTY_KEY) {
+                slot = (slot + 1) & mask;
+            }
+            keys[slot] = old_keys[index];
+            buckets[slot] = std::move(old_buckets[index]);
+        }
+    }
+
+    std::vector<u64> keys;
+    std::vector<Bucket> buckets;
+    size_t num_pages = 0;
+    size_t mask = 0;
+    int shift = 64;
+};
+
+} // namespace VideoCommon
@@ -3,16 +3,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <unordered_set>
 #include <boost/container/small_vector.hpp>
 
 #include "common/alignment.h"
+#include "common/memory_accounting.h"
+#include "common/metrics.h"
 #include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/dirty_flags.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/texture_cache/eviction_policy.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/texture_cache/samples_helper.h"
 #include "video_core/texture_cache/texture_cache_base.h"
@@ -72,11 +77,40 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
 
 template <class P>
 void TextureCache<P>::RunGarbageCollector() {
-    bool high_priority_mode = total_used_memory >= expected_memory;
-    bool aggressive_mode = total_used_memory >= critical_memory;
+    const EvictionStats previous_stats = eviction_stats;
+    const auto policy = Settings::values.texture_eviction_policy.GetValue();
+    switch (policy) {
+    case Settings::TextureEvictionPolicy::Lru:
+        RunLruGarbageCollector();
+        break;
+    case Settings::TextureEvictionPolicy::CostModel:
+        RunCostModelGarbageCollector();
+        break;
+    }
+    if (eviction_stats.num_images == previous_stats.num_images) {
+        return;
+    }
+    LOG_DEBUG(HW_GPU,
+              "{} eviction freed {} images ({} MiB, {} downloads, {} costly), total {} images "
+              "({} MiB, {} downloads, {} costly)",
+              Settings::CanonicalizeEnum(policy),
+              eviction_stats.num_images - previous_stats.num_images,
+              (eviction_stats.num_bytes - previous_stats.num_bytes) >> 20,
+              eviction_stats.num_downloads - previous_stats.num_downloads,
+              eviction_stats.num_costly - previous_stats.num_costly, eviction_stats.num_images,
+              eviction_stats.num_bytes >> 20, eviction_stats.num_downloads,
+              eviction_stats.num_costly);
+}
+
+template <class P>
+void TextureCache<P>::RunLruGarbageCollector() {
+    // Past the host memory budget, collect aggressively until the excess has been freed
+    const u64 budget_bytes = eviction_stats.num_bytes + budget_excess;
+    bool high_priority_mode = total_used_memory >= expected_memory || budget_excess != 0;
+    bool aggressive_mode = total_used_memory >= critical_memory || budget_excess != 0;
     const u64 ticks_to_destroy = aggressive_mode ? 10ULL : high_priority_mode ? 25ULL : 50ULL;
     size_t num_iterations = aggressive_mode ? 40 : (high_priority_mode ? 20 : 10);
-    const auto clean_up = [this, &num_iterations, &high_priority_mode,
+    const auto clean_up = [this, budget_bytes, &num_iterations, &high_priority_mode,
                            &aggressive_mode](ImageId image_id) {
         if (num_iterations == 0) {
             return true;
@@ -96,20 +130,8 @@ void TextureCache<P>::RunGarbageCollector() {
         if (!high_priority_mode && must_download) {
             return false;
         }
-        if (must_download) {
-            auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
-            const auto copies = FullDownloadCopies(image.info);
-            image.DownloadMemory(map, copies);
-            runtime.Finish();
-            SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
-                         swizzle_data_buffer);
-        }
-        if (True(image.flags & ImageFlagBits::Tracked)) {
-            UntrackImage(image, image_id);
-        }
-        UnregisterImage(image_id);
-        DeleteImage(image_id, image.scale_tick > frame_tick + 5);
-        if (total_used_memory < critical_memory) {
+        EvictImage(image_id, must_download);
+        if (total_used_memory < critical_memory && eviction_stats.num_bytes >= budget_bytes) {
             if (aggressive_mode) {
                 // Sink the aggresiveness.
                 num_iterations >>= 2;
@@ -126,22 +148,114 @@ void TextureCache<P>::RunGarbageCollector() {
     lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, clean_up);
 }
 
+template <class P>
+void TextureCache<P>::RunCostModelGarbageCollector() {
+    // Images used in the last frames are never evicted, they are likely still in flight
+    static constexpr u64 MIN_TICKS_TO_DESTROY = 10;
+    static constexpr size_t MAX_CANDIDATES = 256;
+    static constexpr size_t MAX_EVICTIONS = 40;
+
+    eviction_entries.clear();
+    lru_cache.ForEachItemBelow(frame_tick - MIN_TICKS_TO_DESTROY, [this](ImageId image_id) {
+        if (eviction_entries.size() == MAX_CANDIDATES) {
+            return true;
+        }
+        auto& image = slot_images[image_id];
+        if (True(image.flags & ImageFlagBits::IsDecoding)) {
+            return false;
+        }
+        u64 size_bytes = std::max(
+            {image.guest_size_bytes, image.unswizzled_size_bytes, image.converted_size_bytes});
+        if (image.HasScaled()) {
+            size_bytes += GetScaledImageSizeBytes(image);
+        }
+        const bool must_download =
+            image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
+        const EvictionCandidate candidate{
+            .size_bytes = size_bytes,
+            .load_time_us = image.load_time_us,
+            .age = frame_tick - lru_cache.GetTick(image.lru_index),
+            .costly_load = True(image.flags & ImageFlagBits::CostlyLoad),
+            .must_download = must_download,
+        };
+        eviction_entries.push_back(EvictionEntry{
+            .score = EvictionCostModel::Score(candidate),
+            .image_id = image_id,
+            .must_download = must_download,
+        });
+        return false;
+    });
+    std::ranges::sort(eviction_entries, {}, &EvictionEntry::score);
+
+    // Past the host memory budget, evict at full pressure until the excess has been freed
+    const u64 budget_bytes = eviction_stats.num_bytes + budget_excess;
+    size_t num_evictions = 0;
+    for (const EvictionEntry& entry : eviction_entries) {
+        const double pressure =
+            eviction_stats.num_bytes < budget_bytes
+                ? 1.0
+                : EvictionCostModel::Pressure(total_used_memory, minimum_memory, critical_memory);
+        if (num_evictions == MAX_EVICTIONS || entry.score > EvictionCostModel::Budget(pressure)) {
+            break;
+        }
+        EvictImage(entry.image_id, entry.must_download);
+        ++num_evictions;
+    }
+}
+
+template <class P>
+void TextureCache<P>::EvictImage(ImageId image_id, bool must_download) {
+    auto& image = slot_images[image_id];
+    ++eviction_stats.num_images;
+    eviction_stats.num_bytes += std::max(
+        {image.guest_size_bytes, image.unswizzled_size_bytes, image.converted_size_bytes});
+    if (True(image.flags & ImageFlagBits::CostlyLoad)) {
+        ++eviction_stats.num_costly;
+    }
+    if (must_download) {
+        ++eviction_stats.num_downloads;
+        auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
+        const auto copies = FullDownloadCopies(image.info);
+        image.DownloadMemory(map, copies);
+        runtime.Finish();
+        SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
+                     swizzle_data_buffer);
+    }
+    if (True(image.flags & ImageFlagBits::Tracked)) {
+        UntrackImage(image, image_id);
+    }
+    UnregisterImage(image_id);
+    DeleteImage(image_id, image.scale_tick > frame_tick + 5);
+}
+
+template <class P>
+void TextureCache<P>::LoadDiskResources(u64 title_id) {
+    // The transcoded textures are stored next to the pipeline cache and share its lifetime
+    if (Settings::values.use_disk_shader_cache.GetValue() &&
+        Settings::values.use_disk_texture_cache.GetValue()) {
+        transcode_cache.Open(title_id);
+    }
+}
+
 template <class P>
 void TextureCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
     }
-    if (total_used_memory > minimum_memory) {
+    budget_excess = Common::MemoryAccounting::GetExcess();
+    if (total_used_memory > minimum_memory || budget_excess != 0) {
         RunGarbageCollector();
     }
     sentenced_images.Tick();
     sentenced_framebuffers.Tick();
     sentenced_image_view.Tick();
     TickAsyncDecode();
+    frame_arena.NextFrame();
 
     runtime.TickFrame();
     ++frame_tick;
+    TickDescriptorTables();
 
     if constexpr (IMPLEMENTS_ASYNC_DOWNLOADS) {
         for (auto& buffer : async_buffers_death_ring) {
@@ -188,7 +302,7 @@ void TextureCache<P>::FillComputeImageViews(std::span<ImageViewInOut> views) {
 
 template <class P>
 void TextureCache<P>::CheckFeedbackLoop(std::span<const ImageViewInOut> views) {
-    if (!Settings::values.barrier_feedback_loops.GetValue()) {
+    if (!Settings::GetHotSettings().barrier_feedback_loops) {
         return;
     }
 
@@ -288,6 +402,12 @@ void TextureCache<P>::SynchronizeGraphicsDescriptors() {
                                                         tic_limit)) {
         channel_state->graphics_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
     }
+    if (channel_state->graphics_sampler_table.NeedsTracking()) {
+        TrackDescriptorTable(channel_state->graphics_sampler_table);
+    }
+    if (channel_state->graphics_image_table.NeedsTracking()) {
+        TrackDescriptorTable(channel_state->graphics_image_table);
+    }
 }
 
 template <class P>
@@ -303,6 +423,70 @@ void TextureCache<P>::SynchronizeComputeDescriptors() {
                                                        tic_limit)) {
         channel_state->compute_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
     }
+    if (channel_state->compute_sampler_table.NeedsTracking()) {
+        TrackDescriptorTable(channel_state->compute_sampler_table);
+    }
+    if (channel_state->compute_image_table.NeedsTracking()) {
+        TrackDescriptorTable(channel_state->compute_image_table);
+    }
+}
+
+template <class P>
+template <typename Descriptor>
+void TextureCache<P>::TrackDescriptorTable(DescriptorTable<Descriptor>& table) {
+    UntrackDescriptorTable(table);
+    const GPUVAddr gpu_addr = table.GpuAddr();
+    const size_t size = table.SizeBytes();
+    const std::optional<DAddr> cpu_addr = gpu_memory->GpuToCpuAddress(gpu_addr);
+    if (!cpu_addr || !gpu_memory->IsContinuousRange(gpu_addr, size)) {
+        // Pools split over several mappings are read from guest memory on every access
+        table.SetTrackedRange(std::nullopt);
+        return;
+    }
+    device_memory.UpdatePagesCachedCount(*cpu_addr, size, 1);
+    table.SetTrackedRange(std::make_pair(*cpu_addr, size));
+}
+
+template <class P>
+template <typename Descriptor>
+void TextureCache<P>::UntrackDescriptorTable(DescriptorTable<Descriptor>& table) {
+    if (const auto range = table.TrackedRange()) {
+        device_memory.UpdatePagesCachedCount(range->first, range->second, -1);
+        table.ResetTracking();
+    }
+}
+
+template <class P>
+template <typename Func>
+void TextureCache<P>::ForEachDescriptorTable(Func&& func) {
+    for (const size_t c : active_channel_ids) {
+        auto& channel_info = channel_storage[c];
+        func(channel_info.graphics_image_table);
+        func(channel_info.graphics_sampler_table);
+        func(channel_info.compute_image_table);
+        func(channel_info.compute_sampler_table);
+    }
+}
+
+template <class P>
+void TextureCache<P>::TickDescriptorTables() {
+    static auto& cached_reads = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_texture_descriptor_cached_reads_total",
+        "Texture and sampler descriptors read without accessing unmodified guest memory");
+    static auto& guest_reads = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_texture_descriptor_guest_reads_total",
+        "Texture and sampler descriptors read from guest memory");
+    u64 num_cached_reads = 0;
+    u64 num_guest_reads = 0;
+    ForEachDescriptorTable([&](auto& table) {
+        const auto [table_cached_reads, table_guest_reads] = table.TakeReadCounts();
+        num_cached_reads += table_cached_reads;
+        num_guest_reads += table_guest_reads;
+        // GPU writes through the other caches are not reported here, compare once per frame
+        table.MarkModified();
+    });
+    cached_reads.Increment(num_cached_reads);
+    guest_reads.Increment(num_guest_reads);
 }
 
 template <class P>
@@ -353,6 +537,7 @@ bool TextureCache<P>::RescaleRenderTargets() {
             BindRenderTarget(&render_targets.depth_buffer_id, FindDepthBuffer());
         }
         check_rescale(render_targets.depth_buffer_id, tmp_depth_image);
+        can_rescale &= !force_native_resolution;
 
         if (can_rescale) {
             rescaled = any_rescaled || scale_rating >= 2;
@@ -515,6 +700,11 @@ FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
 
 template <class P>
 void TextureCache<P>::WriteMemory(DAddr cpu_addr, size_t size) {
+    ForEachDescriptorTable([cpu_addr, size](auto& table) {
+        if (table.IsTrackedIn(cpu_addr, size)) {
+            table.MarkModified();
+        }
+    });
     ForEachImageInRegion(cpu_addr, size, [this](ImageId image_id, Image& image) {
         if (True(image.flags & ImageFlagBits::CpuModified)) {
             return;
@@ -581,6 +771,11 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
 
 template <class P>
 void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
+    ForEachDescriptorTable([this, cpu_addr, size](auto& table) {
+        if (table.IsTrackedIn(cpu_addr, size)) {
+            UntrackDescriptorTable(table);
+        }
+    });
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegion(cpu_addr, size, [&](ImageId id, Image&) { deleted_images.push_back(id); });
     for (const ImageId id : deleted_images) {
@@ -595,6 +790,12 @@ void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
 
 template <class P>
 void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t size) {
+    // The channel of the address space isn't known here, untracking other pools is harmless
+    ForEachDescriptorTable([this, gpu_addr, size](auto& table) {
+        if (gpu_addr < table.GpuAddr() + table.SizeBytes() && table.GpuAddr() < gpu_addr + size) {
+            UntrackDescriptorTable(table);
+        }
+    });
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegionGPU(as_id, gpu_addr, size,
                             [&](ImageId id, Image&) { deleted_images.push_back(id); });
@@ -716,11 +917,11 @@ template <class P>
 typename P::ImageView* TextureCache<P>::TryFindFramebufferImageView(
     const Tegra::FramebufferConfig& config, DAddr cpu_addr) {
     // TODO: Properly implement this
-    const auto it = page_table.find(cpu_addr >> YUZU_PAGEBITS);
-    if (it == page_table.end()) {
+    const auto* const image_map_ids_ptr = page_table.Find(cpu_addr >> YUZU_PAGEBITS);
+    if (!image_map_ids_ptr) {
         return nullptr;
     }
-    const auto& image_map_ids = it->second;
+    const auto& image_map_ids = *image_map_ids_ptr;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
     for (const ImageMapId map_id : image_map_ids) {
         const ImageMapView& map = slot_map_views[map_id];
@@ -1041,9 +1242,13 @@ void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
         QueueAsyncDecode(image, image_id);
         return;
     }
+    const auto load_start = std::chrono::steady_clock::now();
     auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
     UploadImageContents(image, staging);
     runtime.InsertUploadMemoryBarrier();
+    const auto load_time = std::chrono::steady_clock::now() - load_start;
+    image.load_time_us = static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::microseconds>(load_time).count());
 }
 
 template <class P>
@@ -1064,10 +1269,23 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
         *gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
 
     if (True(image.flags & ImageFlagBits::Converted)) {
+        const bool use_transcode_cache = transcode_cache.IsOpen();
+        const u64 transcode_key =
+            use_transcode_cache ? TranscodeCache::Hash(swizzle_data, image.info) : 0;
+        boost::container::small_vector<BufferImageCopy, 16> copies;
+        if (use_transcode_cache && transcode_cache.Find(transcode_key, mapped_span, copies)) {
+            image.UploadMemory(staging, copies);
+            return;
+        }
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
-        auto copies =
+        copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer);
         ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        if (use_transcode_cache) {
+            const size_t converted_size =
+                std::min<size_t>(image.converted_size_bytes, mapped_span.size());
+            transcode_cache.Insert(transcode_key, mapped_span.first(converted_size), copies);
+        }
         image.UploadMemory(staging, copies);
     } else {
         const auto copies =
@@ -1116,9 +1334,15 @@ ImageViewId TextureCache<P>::CreateImageView(const TICEntry& config) {
 template <class P>
 ImageId TextureCache<P>::FindOrInsertImage(const ImageInfo& info, GPUVAddr gpu_addr,
                                            RelaxedOptions options) {
+    static auto& image_hits = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_texture_cache_hits_total", "Image lookups that found a cached image");
+    static auto& image_misses = Common::Metrics::GetRegistry().RegisterCounter(
+        "yuzu_texture_cache_misses_total", "Image lookups that created a new image");
     if (const ImageId image_id = FindImage(info, gpu_addr, options); image_id) {
+        image_hits.Increment();
         return image_id;
     }
+    image_misses.Increment();
     return InsertImage(info, gpu_addr, options);
 }
 
@@ -1276,13 +1500,17 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     auto func = [out_size, copies, info = image.info,
                  input = std::move(local_unswizzle_data_buffer),
                  async_decode = decode_ptr]() mutable {
+        const auto decode_start = std::chrono::steady_clock::now();
         async_decode->decoded_data.resize_destructive(out_size);
         std::span copies_span{copies.data(), copies.size()};
         ConvertImage(input, info, async_decode->decoded_data, copies_span);
+        const auto decode_time = std::chrono::steady_clock::now() - decode_start;
 
         // TODO: Do we need this lock?
         std::unique_lock lock{async_decode->mutex};
         async_decode->copies = std::move(copies);
+        async_decode->decode_time_us = static_cast<u64>(
+            std::chrono::duration_cast<std::chrono::microseconds>(decode_time).count());
         async_decode->complete = true;
     };
     texture_decode_worker.QueueWork(std::move(func));
@@ -1304,6 +1532,7 @@ void TextureCache<P>::TickAsyncDecode() {
         std::memcpy(staging.mapped_span.data(), async_decode->decoded_data.data(),
                     async_decode->decoded_data.size());
         image.UploadMemory(staging, async_decode->copies);
+        image.load_time_us = async_decode->decode_time_us;
         image.flags &= ~ImageFlagBits::IsDecoding;
         has_uploads = true;
         i = async_decodes.erase(i);
@@ -1322,6 +1551,7 @@ bool TextureCache<P>::ScaleUp(Image& image) {
     }
     if (!has_copy) {
         total_used_memory += GetScaledImageSizeBytes(image);
+        memory_charge.Add(static_cast<s64>(GetScaledImageSizeBytes(image)));
     }
     InvalidateScale(image);
     return true;
@@ -1787,15 +2017,15 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
     boost::container::small_vector<ImageId, 32> images;
     boost::container::small_vector<ImageMapId, 32> maps;
     ForEachCPUPage(cpu_addr, size, [this, &images, &maps, cpu_addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
+        const auto* const ids = page_table.Find(page);
+        if (!ids) {
             if constexpr (BOOL_BREAK) {
                 return false;
             } else {
                 return;
             }
         }
-        for (const ImageMapId map_id : it->second) {
+        for (const ImageMapId map_id : *ids) {
             ImageMapView& map = slot_map_views[map_id];
             if (map.picked) {
                 continue;
@@ -1845,15 +2075,15 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
     auto& gpu_page_table = gpu_page_table_storage[*storage_id];
     ForEachGPUPage(gpu_addr, size,
                    [this, &gpu_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = gpu_page_table.find(page);
-                       if (it == gpu_page_table.end()) {
+                       const auto* const ids = gpu_page_table.Find(page);
+                       if (!ids) {
                            if constexpr (BOOL_BREAK) {
                                return false;
                            } else {
                                return;
                            }
                        }
-                       for (const ImageId image_id : it->second) {
+                       for (const ImageId image_id : *ids) {
                            Image& image = slot_images[image_id];
                            if (True(image.flags & ImageFlagBits::Picked)) {
                                continue;
@@ -1887,15 +2117,15 @@ void TextureCache<P>::ForEachSparseImageInRegion(GPUVAddr gpu_addr, size_t size,
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
     boost::container::small_vector<ImageId, 8> images;
     ForEachGPUPage(gpu_addr, size, [this, &images, gpu_addr, size, func](u64 page) {
-        const auto it = sparse_page_table.find(page);
-        if (it == sparse_page_table.end()) {
+        const auto* const ids = sparse_page_table.Find(page);
+        if (!ids) {
             if constexpr (BOOL_BREAK) {
                 return false;
             } else {
                 return;
             }
         }
-        for (const ImageId image_id : it->second) {
+        for (const ImageId image_id : *ids) {
             Image& image = slot_images[image_id];
             if (True(image.flags & ImageFlagBits::Picked)) {
                 continue;
@@ -1960,12 +2190,15 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
                "Trying to register an already registered image");
     image.flags |= ImageFlagBits::Registered;
     u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
-    if ((IsPixelFormatASTC(image.info.format) &&
-         True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
-        True(image.flags & ImageFlagBits::Converted)) {
+    if (True(image.flags & ImageFlagBits::Recompressed)) {
+        tentative_size = std::max<u64>(tentative_size, image.converted_size_bytes);
+    } else if ((IsPixelFormatASTC(image.info.format) &&
+                True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
+               True(image.flags & ImageFlagBits::Converted)) {
         tentative_size = EstimatedDecompressedSize(tentative_size, image.info.format);
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
+    memory_charge.Add(static_cast<s64>(Common::AlignUp(tentative_size, 1024)));
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
@@ -2001,15 +2234,13 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     image.flags &= ~ImageFlagBits::BadOverlap;
     lru_cache.Free(image.lru_index);
     const auto& clear_page_table =
-        [image_id](u64 page,
-                   std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>&
-                       selected_page_table) {
-            const auto page_it = selected_page_table.find(page);
-            if (page_it == selected_page_table.end()) {
+        [image_id](u64 page, TextureCacheGPUMap& selected_page_table) {
+            auto* const image_ids_ptr = selected_page_table.Find(page);
+            if (!image_ids_ptr) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageId>& image_ids = page_it->second;
+            auto& image_ids = *image_ids_ptr;
             const auto vector_it = std::ranges::find(image_ids, image_id);
             if (vector_it == image_ids.end()) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
@@ -2024,12 +2255,12 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     if (False(image.flags & ImageFlagBits::Sparse)) {
         const auto map_id = image.map_view_id;
         ForEachCPUPage(image.cpu_addr, image.guest_size_bytes, [this, map_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
+            auto* const image_map_ids_ptr = page_table.Find(page);
+            if (!image_map_ids_ptr) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
+            auto& image_map_ids = *image_map_ids_ptr;
             const auto vector_it = std::ranges::find(image_map_ids, map_id);
             if (vector_it == image_map_ids.end()) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
@@ -2052,12 +2283,12 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
         const DAddr cpu_addr = map_range.cpu_addr;
         const std::size_t size = map_range.size;
         ForEachCPUPage(cpu_addr, size, [this, image_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
+            auto* const image_map_ids_ptr = page_table.Find(page);
+            if (!image_map_ids_ptr) {
                 ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
                 return;
             }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
+            auto& image_map_ids = *image_map_ids_ptr;
             auto vector_it = image_map_ids.begin();
             while (vector_it != image_map_ids.end()) {
                 ImageMapView& map = slot_map_views[*vector_it];
@@ -2127,14 +2358,18 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
     if (image.HasScaled()) {
         total_used_memory -= GetScaledImageSizeBytes(image);
+        memory_charge.Add(-static_cast<s64>(GetScaledImageSizeBytes(image)));
     }
     u64 tentative_size = std::max(image.guest_size_bytes, image.unswizzled_size_bytes);
-    if ((IsPixelFormatASTC(image.info.format) &&
-         True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
-        True(image.flags & ImageFlagBits::Converted)) {
+    if (True(image.flags & ImageFlagBits::Recompressed)) {
+        tentative_size = std::max<u64>(tentative_size, image.converted_size_bytes);
+    } else if ((IsPixelFormatASTC(image.info.format) &&
+                True(image.flags & ImageFlagBits::AcceleratedUpload)) ||
+               True(image.flags & ImageFlagBits::Converted)) {
         tentative_size = EstimatedDecompressedSize(tentative_size, image.info.format);
     }
     total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    memory_charge.Add(-static_cast<s64>(Common::AlignUp(tentative_size, 1024)));
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2337,15 +2572,19 @@ void TextureCache<P>::PrepareImageView(ImageViewId image_view_id, bool is_modifi
 }
 
 template <class P>
-void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies) {
+void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id,
+                                std::span<const ImageCopy> copies) {
     Image& dst = slot_images[dst_id];
     Image& src = slot_images[src_id];
     const bool is_rescaled = True(src.flags & ImageFlagBits::Rescaled);
+    std::pmr::vector<ImageCopy> scaled_copies{frame_arena.Resource()};
     if (is_rescaled) {
         ASSERT(True(dst.flags & ImageFlagBits::Rescaled));
         const bool both_2d{src.info.type == ImageType::e2D && dst.info.type == ImageType::e2D};
         const auto& resolution = Settings::values.resolution_info;
-        for (auto& copy : copies) {
+        scaled_copies.assign(copies.begin(), copies.end());
+        copies = scaled_copies;
+        for (auto& copy : scaled_copies) {
             copy.src_offset.x = resolution.ScaleUp(copy.src_offset.x);
             copy.dst_offset.x = resolution.ScaleUp(copy.dst_offset.x);
             copy.extent.width = resolution.ScaleUp(copy.extent.width);
@@ -2499,6 +2738,19 @@ void TextureCache<P>::CreateChannel(struct Tegra::Control::ChannelState& channel
     this_state->gpu_page_table = &gpu_page_table_storage[this_as_ref.storage_id];
 }
 
+template <class P>
+void TextureCache<P>::EraseChannel(s32 id) {
+    const auto it = channel_map.find(id);
+    ASSERT(it != channel_map.end() && id >= 0);
+    // The pools of the channel aren't synchronized anymore, and its storage is reused as is
+    auto& channel_info = channel_storage[it->second];
+    UntrackDescriptorTable(channel_info.graphics_image_table);
+    UntrackDescriptorTable(channel_info.graphics_sampler_table);
+    UntrackDescriptorTable(channel_info.compute_image_table);
+    UntrackDescriptorTable(channel_info.compute_sampler_table);
+    VideoCommon::ChannelSetupCaches<TextureCacheChannelInfo>::EraseChannel(id);
+}
+
 /// Bind a channel for execution.
 template <class P>
 void TextureCache<P>::OnGPUASRegister([[maybe_unused]] size_t map_id) {
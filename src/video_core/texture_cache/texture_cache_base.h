@@ -6,6 +6,7 @@
 #include <atomic>
 #include <deque>
 #include <limits>
+#include <memory_resource>
 #include <mutex>
 #include <span>
 #include <type_traits>
@@ -19,6 +20,7 @@
 #include "common/hash.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
+#include "common/memory_accounting.h"
 #include "common/polyfill_ranges.h"
 #include "common/scratch_buffer.h"
 #include "common/thread_worker.h"
@@ -26,13 +28,16 @@
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
 #include "video_core/engines/fermi_2d.h"
+#include "video_core/frame_arena.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/descriptor_table.h"
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/page_index.h"
 #include "video_core/texture_cache/render_targets.h"
 #include "video_core/texture_cache/slot_vector.h"
+#include "video_core/texture_cache/transcode_cache.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
 
@@ -59,11 +64,20 @@ struct AsyncDecodeContext {
     ImageId image_id;
     Common::ScratchBuffer<u8> decoded_data;
     boost::container::small_vector<BufferImageCopy, 16> copies;
+    u64 decode_time_us = 0;
     std::mutex mutex;
     std::atomic_bool complete;
 };
 
-using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
+/// Counters of the images evicted by the garbage collector
+struct EvictionStats {
+    u64 num_images = 0;    ///< Number of evicted images
+    u64 num_bytes = 0;     ///< Estimated memory freed by evictions
+    u64 num_downloads = 0; ///< Number of evicted images downloaded to guest memory
+    u64 num_costly = 0;    ///< Number of evicted images with contents converted on the CPU
+};
+
+using TextureCacheGPUMap = PageIndex<ImageId>;
 
 class TextureCacheChannelInfo : public ChannelInfo {
 public:
@@ -130,6 +144,9 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
 public:
     explicit TextureCache(Runtime&, Tegra::MaxwellDeviceMemoryManager&);
 
+    /// Load the disk cache of transcoded images for the given title
+    void LoadDiskResources(u64 title_id);
+
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
@@ -183,6 +200,11 @@ public:
     /// @retval True if the Render Targets have been rescaled.
     bool RescaleRenderTargets();
 
+    /// Draws render targets bound from now on at native resolution, even when they can be rescaled
+    void SetForceNativeResolution(bool force_native) noexcept {
+        force_native_resolution = force_native;
+    }
+
     /// Update bound render targets and upload memory if necessary
     /// @param is_clear True when the render targets are being used for clears
     void UpdateRenderTargets(bool is_clear);
@@ -246,6 +268,9 @@ public:
     /// Create channel state.
     void CreateChannel(Tegra::Control::ChannelState& channel) final override;
 
+    /// Erase channel's state, releasing the tracking of its descriptor pools.
+    void EraseChannel(s32 id) final override;
+
     /// Prepare an image to be used
     void PrepareImage(ImageId image_id, bool is_modification, bool invalidate);
 
@@ -288,6 +313,30 @@ private:
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
 
+    /// Evicts the least recently used images with fixed age thresholds.
+    void RunLruGarbageCollector();
+
+    /// Evicts the images that are cheapest to recreate under the current memory pressure.
+    void RunCostModelGarbageCollector();
+
+    /// Removes an image from the cache, downloading its contents first when requested.
+    void EvictImage(ImageId image_id, bool must_download);
+
+    /// Tracks the memory of a descriptor pool for writes after it moved
+    template <typename Descriptor>
+    void TrackDescriptorTable(DescriptorTable<Descriptor>& table);
+
+    /// Stops tracking the memory of a descriptor pool
+    template <typename Descriptor>
+    void UntrackDescriptorTable(DescriptorTable<Descriptor>& table);
+
+    /// Calls func on the descriptor pools of every active channel
+    template <typename Func>
+    void ForEachDescriptorTable(Func&& func);
+
+    /// Reports the descriptor reads of the frame and validates the pools against memory again
+    void TickDescriptorTables();
+
     /// Fills image_view_ids in the image views in indices
     template <bool has_blacklists>
     void FillImageViews(DescriptorTable<TICEntry>& table,
@@ -397,7 +446,7 @@ private:
     void PrepareImageView(ImageViewId image_view_id, bool is_modification, bool invalidate);
 
     /// Execute copies from one image to the other, even if they are incompatible
-    void CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies);
+    void CopyImage(ImageId dst_id, ImageId src_id, std::span<const ImageCopy> copies);
 
     /// Bind an image view as render target, downloading resources preemtively if needed
     void BindRenderTarget(ImageViewId* old_id, ImageViewId new_id);
@@ -430,18 +479,23 @@ private:
 
     std::unordered_map<RenderTargets, FramebufferId> framebuffers;
 
-    std::unordered_map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
-    std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>> sparse_page_table;
+    PageIndex<ImageMapId> page_table;
+    TextureCacheGPUMap sparse_page_table;
     std::unordered_map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
 
     DAddr virtual_invalid_space{};
 
     bool has_deleted_images = false;
     bool is_rescaling = false;
+    bool force_native_resolution = false;
     u64 total_used_memory = 0;
     u64 minimum_memory;
     u64 expected_memory;
     u64 critical_memory;
+    /// Bytes held beyond the host memory budget when the frame started
+    u64 budget_excess = 0;
+    Common::MemoryAccounting::Charge memory_charge{
+        Common::MemoryAccounting::Category::TextureCache};
 
     struct BufferDownload {
         GPUVAddr address;
@@ -476,6 +530,14 @@ private:
     };
     Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
 
+    struct EvictionEntry {
+        double score;
+        ImageId image_id;
+        bool must_download;
+    };
+    std::vector<EvictionEntry> eviction_entries;
+    EvictionStats eviction_stats;
+
     static constexpr size_t TICKS_TO_DESTROY = 8;
     DelayedDestructionRing<Image, TICKS_TO_DESTROY> sentenced_images;
     DelayedDestructionRing<ImageView, TICKS_TO_DESTROY> sentenced_image_view;
@@ -486,6 +548,10 @@ private:
     Common::ScratchBuffer<u8> swizzle_data_buffer;
     Common::ScratchBuffer<u8> unswizzle_data_buffer;
 
+    TranscodeCache transcode_cache;
+
+    FrameArena frame_arena;
+
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fast_hash.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/zstd_compression.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/transcode_cache.h"
+
+namespace VideoCommon {
+namespace {
+using namespace Common::Literals;
+
+constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 't', 'e', 'x', 'c'};
+constexpr u32 CACHE_VERSION = Common::WithFastHashVersion(2);
+constexpr size_t HEADER_SIZE = MAGIC_NUMBER.size() + sizeof(CACHE_VERSION);
+
+/// Stop growing the cache file past this size
+constexpr u64 MAX_FILE_SIZE = 4_GiB;
+} // Anonymous namespace
+
+TranscodeCache::TranscodeCache() = default;
+
+TranscodeCache::~TranscodeCache() = default;
+
+void TranscodeCache::Open(u64 title_id) {
+    if (title_id == 0) {
+        return;
+    }
+    const auto shader_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir)};
+    const auto base_dir{shader_dir / fmt::format("{:016x}", title_id)};
+    if (!Common::FS::CreateDir(shader_dir) || !Common::FS::CreateDir(base_dir)) {
+        LOG_ERROR(Common_Filesystem, "Failed to create transcoded texture cache directories");
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    filename = base_dir / "transcoded_textures.bin";
+    Index();
+
+    output.open(filename, std::ios::binary | std::ios::app);
+    if (!output.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open transcoded texture cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    if (file_size == 0) {
+        output.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
+            .write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION))
+            .flush();
+        file_size = HEADER_SIZE;
+    }
+    input.open(filename, std::ios::binary);
+    input.exceptions(std::ifstream::failbit);
+
+    LOG_INFO(Render, "Transcoded texture cache entries: {}", entries.size());
+}
+
+void TranscodeCache::Index() try {
+    entries.clear();
+    file_size = 0;
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const u64 end{static_cast<u64>(file.tellg())};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number{};
+    u32 cache_version{};
+    if (end >= HEADER_SIZE) {
+        file.read(magic_number.data(), magic_number.size())
+            .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    }
+    if (magic_number != MAGIC_NUMBER || cache_version != CACHE_VERSION) {
+        file.close();
+        if (!Common::FS::RemoveFile(filename)) {
+            LOG_ERROR(Common_Filesystem,
+                      "Invalid transcoded texture cache file and failed to delete it in \"{}\"",
+                      Common::FS::PathToUTF8String(filename));
+        }
+        return;
+    }
+    u64 offset = HEADER_SIZE;
+    while (offset + sizeof(EntryHeader) <= end) {
+        EntryHeader header;
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        const u64 entry_size =
+            sizeof(header) + header.num_copies * sizeof(BufferImageCopy) + header.compressed_size;
+        if (offset + entry_size > end) {
+            break;
+        }
+        entries.emplace(header.key, static_cast<std::streamoff>(offset));
+        offset += entry_size;
+    }
+    file.close();
+    if (offset != end) {
+        // Drop the last entry when it was not fully written
+        LOG_WARNING(Common_Filesystem, "Truncating transcoded texture cache file");
+        std::filesystem::resize_file(filename, offset);
+    }
+    file_size = offset;
+
+} catch (const std::exception& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to index transcoded texture cache: {}", e.what());
+    entries.clear();
+    file_size = 0;
+    if (!Common::FS::RemoveFile(filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete transcoded texture cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
+u64 TranscodeCache::Hash(std::span<const u8> guest_data, const ImageInfo& info) {
+    const bool is_linear = info.type == ImageType::Linear;
+    // Everything that changes how the guest data is converted has to be part of the key
+    const std::array<u32, 15> layout{
+        static_cast<u32>(info.format),
+        static_cast<u32>(info.type),
+        static_cast<u32>(info.resources.levels),
+        static_cast<u32>(info.resources.layers),
+        info.size.width,
+        info.size.height,
+        info.size.depth,
+        is_linear ? info.pitch : info.block.width,
+        is_linear ? 0 : info.block.height,
+        is_linear ? 0 : info.block.depth,
+        info.layer_stride,
+        info.num_samples,
+        info.tile_width_spacing,
+        static_cast<u32>(Settings::values.astc_recompression.GetValue()),
+        CACHE_VERSION,
+    };
+    const u64 layout_hash = Common::FastHash64(layout.data(), sizeof(layout));
+    return Common::FastHash64WithSeed(guest_data.data(), guest_data.size_bytes(), layout_hash);
+}
+
+bool TranscodeCache::Find(u64 key, std::span<u8> data,
+                          boost::container::small_vector<BufferImageCopy, 16>& copies) try {
+    std::scoped_lock lock{mutex};
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        return false;
+    }
+    EntryHeader header;
+    input.clear();
+    input.seekg(it->second);
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (header.key != key || header.uncompressed_size > data.size_bytes()) {
+        return false;
+    }
+    boost::container::small_vector<BufferImageCopy, 16> entry_copies(header.num_copies);
+    input.read(reinterpret_cast<char*>(entry_copies.data()),
+               entry_copies.size() * sizeof(BufferImageCopy));
+
+    std::vector<u8> compressed(header.compressed_size);
+    input.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+
+    const std::vector<u8> decompressed = Common::Compression::DecompressDataZSTD(compressed);
+    if (decompressed.size() != header.uncompressed_size) {
+        LOG_ERROR(Render, "Corrupted transcoded texture cache entry {:016x}", key);
+        entries.erase(it);
+        return false;
+    }
+    std::memcpy(data.data(), decompressed.data(), decompressed.size());
+    copies = std::move(entry_copies);
+    return true;
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    return false;
+}
+
+void TranscodeCache::Insert(u64 key, std::span<const u8> data,
+                            std::span<const BufferImageCopy> copies) try {
+    const std::vector<u8> compressed =
+        Common::Compression::CompressDataZSTDDefault(data.data(), data.size_bytes());
+
+    std::scoped_lock lock{mutex};
+    if (!output.is_open() || entries.contains(key)) {
+        return;
+    }
+    const u64 entry_size =
+        sizeof(EntryHeader) + copies.size_bytes() + static_cast<u64>(compressed.size());
+    if (file_size + entry_size > MAX_FILE_SIZE) {
+        return;
+    }
+    const EntryHeader header{
+        .key = key,
+        .uncompressed_size = data.size_bytes(),
+        .compressed_size = compressed.size(),
+        .num_copies = static_cast<u32>(copies.size()),
+        .reserved = 0,
+    };
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header))
+        .write(reinterpret_cast<const char*>(copies.data()), copies.size_bytes())
+        .write(reinterpret_cast<const char*>(compressed.data()), compressed.size())
+        .flush();
+    if (!output) {
+        LOG_ERROR(Common_Filesystem, "Failed to write transcoded texture cache entry");
+        output.close();
+        return;
+    }
+    entries.emplace(key, static_cast<std::streamoff>(file_size));
+    file_size += entry_size;
+
+} catch (const std::exception& e) {
+    LOG_ERROR(Render, "Failed to store transcoded texture: {}", e.what());
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/types.h"
+
+namespace VideoCommon {
+
+struct ImageInfo;
+
+/**
+ * Persistent cache of images converted on the CPU (ASTC and BCn decoding).
+ * Entries are keyed by a hash of the guest image contents and its layout, and stored in a single
+ * append only file per title with the converted data compressed with zstd.
+ */
+class TranscodeCache {
+public:
+    TranscodeCache();
+    ~TranscodeCache();
+
+    TranscodeCache(const TranscodeCache&) = delete;
+    TranscodeCache& operator=(const TranscodeCache&) = delete;
+
+    /// Opens the cache file of the title and indexes its entries
+    void Open(u64 title_id);
+
+    /// Returns true when the cache has been opened
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return output.is_open();
+    }
+
+    /// Returns the key of an image from its guest memory contents
+    [[nodiscard]] static u64 Hash(std::span<const u8> guest_data, const ImageInfo& info);
+
+    /**
+     * Looks up a converted image.
+     * @param key      Key of the image
+     * @param output   Converted image contents
+     * @param copies   Copies to upload the converted contents, replaced on success
+     * @returns True on success, false when the image is not in the cache
+     */
+    [[nodiscard]] bool Find(u64 key, std::span<u8> output,
+                            boost::container::small_vector<BufferImageCopy, 16>& copies);
+
+    /// Stores a converted image
+    void Insert(u64 key, std::span<const u8> data, std::span<const BufferImageCopy> copies);
+
+private:
+    struct EntryHeader {
+        u64 key;
+        u64 uncompressed_size;
+        u64 compressed_size;
+        u32 num_copies;
+        u32 reserved;
+    };
+    static_assert(std::is_trivially_copyable_v<EntryHeader>);
+
+    void Index();
+
+    std::filesystem::path filename;
+    std::ofstream output;
+    std::ifstream input;
+    std::unordered_map<u64, std::streamoff> entries;
+    u64 file_size = 0;
+    std::mutex mutex;
+};
+
+} // namespace VideoCommon
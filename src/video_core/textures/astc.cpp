@@ -15,10 +15,18 @@
 
 #include "common/alignment.h"
 #include "common/common_types.h"
+#include "common/microprofile.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/textures/astc.h"
 #include "video_core/textures/workers.h"
 
+MICROPROFILE_DEFINE(GPU_ASTCDecompress, "GPU", "ASTC Decompress", MP_RGB(128, 192, 128));
+
+/// Minimum number of blocks decoded by a single worker job
+constexpr u32 MIN_BLOCKS_PER_JOB = 256;
+/// Number of jobs queued per worker thread
+constexpr u32 JOBS_PER_WORKER = 4;
+
 class InputBitStream {
 public:
     constexpr explicit InputBitStream(std::span<const u8> data, size_t start_offset = 0)
@@ -1078,8 +1086,13 @@ static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
 static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector& weights,
                                    const TexelWeightParams& params, const u32 blockWidth,
                                    const u32 blockHeight) {
+    // Weight grids are at most 12x12, leave room for the texels past the end of the grid read by
+    // the bilinear infill so it can run without bounds checks.
+    static constexpr u32 MaxGridSize = 144;
+    static constexpr u32 GridPadding = 12 + 1;
+
     u32 weightIdx = 0;
-    u32 unquantized[2][144];
+    u32 unquantized[2][MaxGridSize + GridPadding];
 
     for (auto itr = weights.begin(); itr != weights.end(); ++itr) {
         unquantized[0][weightIdx] = UnquantizeTexelWeight(*itr);
@@ -1096,51 +1109,52 @@ static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector&
             break;
     }
 
+    // Texels outside of the grid contribute nothing to the infill
+    const u32 gridSize = params.m_Width * params.m_Height;
+    for (u32 plane = 0; plane < 2; plane++) {
+        std::fill_n(unquantized[plane] + gridSize, params.m_Width + 1, 0U);
+    }
+
     // Do infill if necessary (Section C.2.18) ...
     u32 Ds = (1024 + (blockWidth / 2)) / (blockWidth - 1);
     u32 Dt = (1024 + (blockHeight / 2)) / (blockHeight - 1);
 
-    const u32 kPlaneScale = params.m_bDualPlane ? 2U : 1U;
-    for (u32 plane = 0; plane < kPlaneScale; plane++)
-        for (u32 t = 0; t < blockHeight; t++)
-            for (u32 s = 0; s < blockWidth; s++) {
-                u32 cs = Ds * s;
-                u32 ct = Dt * t;
-
-                u32 gs = (cs * (params.m_Width - 1) + 32) >> 6;
-                u32 gt = (ct * (params.m_Height - 1) + 32) >> 6;
-
-                u32 js = gs >> 4;
-                u32 fs = gs & 0xF;
-
-                u32 jt = gt >> 4;
-                u32 ft = gt & 0x0F;
-
-                u32 w11 = (fs * ft + 8) >> 4;
-                u32 w10 = ft - w11;
-                u32 w01 = fs - w11;
-                u32 w00 = 16 - fs - ft + w11;
+    // The grid coordinates only depend on one axis each, compute them once per row and column
+    std::array<u32, 12> js;
+    std::array<u32, 12> fs;
+    for (u32 s = 0; s < blockWidth; s++) {
+        const u32 gs = (Ds * s * (params.m_Width - 1) + 32) >> 6;
+        js[s] = gs >> 4;
+        fs[s] = gs & 0xF;
+    }
 
-                u32 v0 = js + jt * params.m_Width;
+    const u32 kPlaneScale = params.m_bDualPlane ? 2U : 1U;
+    for (u32 plane = 0; plane < kPlaneScale; plane++) {
+        for (u32 t = 0; t < blockHeight; t++) {
+            const u32 gt = (Dt * t * (params.m_Height - 1) + 32) >> 6;
+            const u32 jt = gt >> 4;
+            const u32 ft = gt & 0x0F;
 
-#define FIND_TEXEL(tidx, bidx)                                                                     \
-    u32 p##bidx = 0;                                                                               \
-    do {                                                                                           \
-        if ((tidx) < (params.m_Width * params.m_Height)) {                                         \
-            p##bidx = unquantized[plane][(tidx)];                                                  \
-        }                                                                                          \
-    } while (0)
+            const u32* const row0 = unquantized[plane] + jt * params.m_Width;
+            const u32* const row1 = row0 + params.m_Width;
+            u32* const outRow = out[plane] + t * blockWidth;
 
-                FIND_TEXEL(v0, 00);
-                FIND_TEXEL(v0 + 1, 01);
-                FIND_TEXEL(v0 + params.m_Width, 10);
-                FIND_TEXEL(v0 + params.m_Width + 1, 11);
+            // Branch free so it can be vectorized by the compiler
+            for (u32 s = 0; s < blockWidth; s++) {
+                const u32 w11 = (fs[s] * ft + 8) >> 4;
+                const u32 w10 = ft - w11;
+                const u32 w01 = fs[s] - w11;
+                const u32 w00 = 16 - fs[s] - ft + w11;
 
-#undef FIND_TEXEL
+                const u32 p00 = row0[js[s]];
+                const u32 p01 = row0[js[s] + 1];
+                const u32 p10 = row1[js[s]];
+                const u32 p11 = row1[js[s] + 1];
 
-                out[plane][t * blockWidth + s] =
-                    (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
+                outRow[s] = (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
             }
+        }
+    }
 }
 
 // Transfers a bit as described in C.2.14
@@ -1653,41 +1667,62 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
 
 void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
                 uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
+    MICROPROFILE_SCOPE(GPU_ASTCDecompress);
+
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
 
-    Common::ThreadWorker& workers{GetThreadWorkers()};
-
-    for (u32 z = 0; z < depth; ++z) {
+    const auto decompress_row = [data, width, height, block_width, block_height, output, rows,
+                                 cols](u32 z, u32 y_index) {
         const u32 depth_offset = z * height * width * 4;
-        for (u32 y_index = 0; y_index < rows; ++y_index) {
-            auto decompress_stride = [data, width, height, block_width, block_height, output, rows,
-                                      cols, z, depth_offset, y_index] {
-                const u32 y = y_index * block_height;
-                for (u32 x_index = 0; x_index < cols; ++x_index) {
-                    const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
-                    const u32 x = x_index * block_width;
-
-                    const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
-
-                    // Blocks can be at most 12x12
-                    std::array<u32, 12 * 12> uncompData;
-                    DecompressBlock(blockPtr, block_width, block_height, uncompData);
-
-                    u32 decompWidth = std::min(block_width, width - x);
-                    u32 decompHeight = std::min(block_height, height - y);
-
-                    const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
-                    for (u32 h = 0; h < decompHeight; ++h) {
-                        std::memcpy(outRow.data() + h * width * 4,
-                                    uncompData.data() + h * block_width, decompWidth * 4);
-                    }
-                }
-            };
-            workers.QueueWork(std::move(decompress_stride));
+        const u32 y = y_index * block_height;
+        for (u32 x_index = 0; x_index < cols; ++x_index) {
+            const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
+            const u32 x = x_index * block_width;
+
+            const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
+
+            // Blocks can be at most 12x12
+            std::array<u32, 12 * 12> uncompData;
+            DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+            u32 decompWidth = std::min(block_width, width - x);
+            u32 decompHeight = std::min(block_height, height - y);
+
+            const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
+            for (u32 h = 0; h < decompHeight; ++h) {
+                std::memcpy(outRow.data() + h * width * 4, uncompData.data() + h * block_width,
+                            decompWidth * 4);
+            }
         }
-        workers.WaitForRequests();
+    };
+
+    // Small images are not worth waking up the workers for
+    const u32 total_rows = rows * depth;
+    if (total_rows * cols < MIN_BLOCKS_PER_JOB * 2) {
+        for (u32 row = 0; row < total_rows; ++row) {
+            decompress_row(row / rows, row % rows);
+        }
+        return;
+    }
+
+    // Split the whole image, all slices included, in bands of block rows. Queue a few bands per
+    // worker so uneven blocks (void extents, dual planes) balance out, and only wait once.
+    Common::ThreadWorker& workers{GetThreadWorkers()};
+    const u32 max_jobs = static_cast<u32>(workers.NumWorkers()) * JOBS_PER_WORKER;
+    const u32 min_rows_per_job = Common::DivideUp(MIN_BLOCKS_PER_JOB, cols);
+    const u32 rows_per_job =
+        std::max(Common::DivideUp(total_rows, max_jobs), std::max(min_rows_per_job, 1U));
+
+    for (u32 first_row = 0; first_row < total_rows; first_row += rows_per_job) {
+        const u32 last_row = std::min(first_row + rows_per_job, total_rows);
+        workers.QueueWork([decompress_row, rows, first_row, last_row] {
+            for (u32 row = first_row; row < last_row; ++row) {
+                decompress_row(row / rows, row % rows);
+            }
+        });
     }
+    workers.WaitForRequests();
 }
 
 } // namespace Tegra::Texture::ASTC
@@ -2,16 +2,29 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cmath>
 #include <cstring>
 #include <span>
 
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/div_ceil.h"
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
+#include "video_core/textures/decoders_simd.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include "common/x64/cpu_detect.h"
+#endif
 
 namespace Tegra::Texture {
 namespace {
@@ -151,9 +164,130 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
     }
 }
 
+#if defined(ARCHITECTURE_x86_64)
+struct SSE2Sectors {
+    template <bool SWIZZLE>
+    static void CopyGobLine(u8* dst, const u8* src) {
+        static constexpr std::array<u32, 4> swizzled_offsets{0, 32, 256, 288};
+        __m128i sectors[4];
+        for (u32 i = 0; i < 4; ++i) {
+            const u32 offset = SWIZZLE ? i * 16 : swizzled_offsets[i];
+            sectors[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + offset));
+        }
+        for (u32 i = 0; i < 4; ++i) {
+            const u32 offset = SWIZZLE ? swizzled_offsets[i] : i * 16;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + offset), sectors[i]);
+        }
+    }
+};
+#elif defined(ARCHITECTURE_arm64)
+struct NEONSectors {
+    template <bool SWIZZLE>
+    static void CopyGobLine(u8* dst, const u8* src) {
+        static constexpr std::array<u32, 4> swizzled_offsets{0, 32, 256, 288};
+        uint8x16_t sectors[4];
+        for (u32 i = 0; i < 4; ++i) {
+            sectors[i] = vld1q_u8(src + (SWIZZLE ? i * 16 : swizzled_offsets[i]));
+        }
+        for (u32 i = 0; i < 4; ++i) {
+            vst1q_u8(dst + (SWIZZLE ? swizzled_offsets[i] : i * 16), sectors[i]);
+        }
+    }
+};
+#endif
+
+SwizzleBackend DetectSwizzleBackend() {
+#if defined(ARCHITECTURE_x86_64)
+    return Common::GetCPUCaps().avx2 ? SwizzleBackend::AVX2 : SwizzleBackend::SSE2;
+#elif defined(ARCHITECTURE_arm64)
+    return SwizzleBackend::NEON;
+#else
+    return SwizzleBackend::Scalar;
+#endif
+}
+
+std::atomic<SwizzleBackend> swizzle_backend{DetectSwizzleBackend()};
+
+template <bool TO_LINEAR>
+SwizzleLineFunction GetSwizzleLineFunction(u32 bytes_per_pixel) {
+    // Pixels that straddle GOB sectors are copied as a unit by the scalar path, keep using it
+    if (!std::has_single_bit(bytes_per_pixel)) {
+        return nullptr;
+    }
+    switch (swizzle_backend.load(std::memory_order_relaxed)) {
+#if defined(ARCHITECTURE_x86_64)
+    case SwizzleBackend::SSE2:
+        return &CopySwizzledLine<TO_LINEAR, SSE2Sectors>;
+    case SwizzleBackend::AVX2:
+        return TO_LINEAR ? &SwizzleLineAVX2 : &UnswizzleLineAVX2;
+#elif defined(ARCHITECTURE_arm64)
+    case SwizzleBackend::NEON:
+        return &CopySwizzledLine<TO_LINEAR, NEONSectors>;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+/// Line based version of SwizzleSubrectImpl, copies whole GOB sectors at once.
+template <bool TO_LINEAR>
+void SwizzleLinesImpl(SwizzleLineFunction copy_line, std::span<u8> output,
+                      std::span<const u8> input, u32 bytes_per_pixel, u32 height, u32 depth,
+                      u32 origin_x, u32 origin_y, u32 extent_x, u32 num_lines, u32 block_height,
+                      u32 block_depth, u32 stride, u32 pitch) {
+    static constexpr u32 origin_z = 0;
+
+    const u32 gobs_in_x = Common::DivCeilLog2(stride, GOB_SIZE_X_SHIFT);
+    const u32 block_size = gobs_in_x << (GOB_SIZE_SHIFT + block_height + block_depth);
+    const u32 slice_size =
+        Common::DivCeilLog2(height, block_height + GOB_SIZE_Y_SHIFT) * block_size;
+
+    const u32 block_height_mask = (1U << block_height) - 1;
+    const u32 block_depth_mask = (1U << block_depth) - 1;
+    const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
+
+    const u32 x_begin = origin_x * bytes_per_pixel;
+    const u32 x_end = (origin_x + extent_x) * bytes_per_pixel;
+
+    u32 unprocessed_lines = num_lines;
+    u32 extent_y = std::min(num_lines, height - origin_y);
+
+    for (u32 slice = 0; slice < depth; ++slice) {
+        const u32 z = slice + origin_z;
+        const u32 offset_z = (z >> block_depth) * slice_size +
+                             ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
+        const u32 lines_in_y = std::min(unprocessed_lines, extent_y);
+        for (u32 line = 0; line < lines_in_y; ++line) {
+            const u32 y = line + origin_y;
+            const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
+
+            const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
+            const u32 offset_y = (block_y >> block_height) * block_size +
+                                 ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
+
+            const u32 swizzled_offset = offset_z + offset_y + swizzled_y;
+            const u32 unswizzled_offset = slice * pitch * height + line * pitch;
+
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            copy_line(dst, src, x_begin, x_end, x_shift);
+        }
+        unprocessed_lines -= lines_in_y;
+        if (unprocessed_lines == 0) {
+            return;
+        }
+    }
+}
+
 template <bool TO_LINEAR>
 void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
              u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment) {
+    if (const auto copy_line = GetSwizzleLineFunction<TO_LINEAR>(bytes_per_pixel)) {
+        return SwizzleLinesImpl<TO_LINEAR>(copy_line, output, input, bytes_per_pixel, height,
+                                           depth, 0, 0, width, height * depth, block_height,
+                                           block_depth, stride_alignment, width * bytes_per_pixel);
+    }
     switch (bytes_per_pixel) {
 #define BPP_CASE(x)                                                                                \
     case x:                                                                                        \
@@ -201,6 +335,12 @@ void SwizzleTexture(std::span<u8> output, std::span<const u8> input, u32 bytes_p
 void SwizzleSubrect(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
                     u32 height, u32 depth, u32 origin_x, u32 origin_y, u32 extent_x, u32 extent_y,
                     u32 block_height, u32 block_depth, u32 pitch_linear) {
+    if (const auto copy_line = GetSwizzleLineFunction<true>(bytes_per_pixel)) {
+        const u32 stride = Common::AlignUpLog2(width * bytes_per_pixel, GOB_SIZE_X_SHIFT);
+        return SwizzleLinesImpl<true>(copy_line, output, input, bytes_per_pixel, height, depth,
+                                      origin_x, origin_y, extent_x, extent_y, block_height,
+                                      block_depth, stride, pitch_linear);
+    }
     switch (bytes_per_pixel) {
 #define BPP_CASE(x)                                                                                \
     case x:                                                                                        \
@@ -225,6 +365,12 @@ void SwizzleSubrect(std::span<u8> output, std::span<const u8> input, u32 bytes_p
 void UnswizzleSubrect(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel,
                       u32 width, u32 height, u32 depth, u32 origin_x, u32 origin_y, u32 extent_x,
                       u32 extent_y, u32 block_height, u32 block_depth, u32 pitch_linear) {
+    if (const auto copy_line = GetSwizzleLineFunction<false>(bytes_per_pixel)) {
+        const u32 stride = Common::AlignUpLog2(width * bytes_per_pixel, GOB_SIZE_X_SHIFT);
+        return SwizzleLinesImpl<false>(copy_line, output, input, bytes_per_pixel, height, depth,
+                                       origin_x, origin_y, extent_x, extent_y, block_height,
+                                       block_depth, stride, pitch_linear);
+    }
     switch (bytes_per_pixel) {
 #define BPP_CASE(x)                                                                                \
     case x:                                                                                        \
@@ -246,6 +392,33 @@ void UnswizzleSubrect(std::span<u8> output, std::span<const u8> input, u32 bytes
     }
 }
 
+bool IsSwizzleBackendSupported(SwizzleBackend backend) {
+    switch (backend) {
+    case SwizzleBackend::Scalar:
+        return true;
+#if defined(ARCHITECTURE_x86_64)
+    case SwizzleBackend::SSE2:
+        return true;
+    case SwizzleBackend::AVX2:
+        return Common::GetCPUCaps().avx2;
+#elif defined(ARCHITECTURE_arm64)
+    case SwizzleBackend::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+SwizzleBackend GetSwizzleBackend() {
+    return swizzle_backend.load(std::memory_order_relaxed);
+}
+
+void SetSwizzleBackend(SwizzleBackend backend) {
+    ASSERT(IsSwizzleBackendSupported(backend));
+    swizzle_backend.store(backend, std::memory_order_relaxed);
+}
+
 std::size_t CalculateSize(bool tiled, u32 bytes_per_pixel, u32 width, u32 height, u32 depth,
                           u32 block_height, u32 block_depth) {
     if (tiled) {
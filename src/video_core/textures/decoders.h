@@ -41,6 +41,23 @@ constexpr SwizzleTable MakeSwizzleTable() {
     return table;
 }
 
+/// Host code paths used by the swizzle functions, selected at startup from the host CPU features.
+enum class SwizzleBackend : u32 {
+    Scalar, ///< Per pixel reference implementation
+    SSE2,
+    AVX2,
+    NEON,
+};
+
+/// Returns true when the host can run the given swizzle backend.
+[[nodiscard]] bool IsSwizzleBackendSupported(SwizzleBackend backend);
+
+/// Returns the swizzle backend currently in use.
+[[nodiscard]] SwizzleBackend GetSwizzleBackend();
+
+/// Overrides the swizzle backend selected at startup. Intended for testing.
+void SetSwizzleBackend(SwizzleBackend backend);
+
 /// Unswizzles a block linear texture into linear memory.
 void UnswizzleTexture(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel,
                       u32 width, u32 height, u32 depth, u32 block_height, u32 block_depth,
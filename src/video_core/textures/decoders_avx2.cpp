@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file is compiled with AVX2 enabled, only call it after checking the host CPU supports it.
+
+#include <immintrin.h>
+
+#include "video_core/textures/decoders_simd.h"
+
+namespace Tegra::Texture {
+namespace {
+struct AVX2Sectors {
+    template <bool SWIZZLE>
+    static void CopyGobLine(u8* dst, const u8* src) {
+        if constexpr (SWIZZLE) {
+            // Linear 32 byte halves are split into the sectors at +0/+32 and +256/+288
+            const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32),
+                             _mm256_extracti128_si256(low, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 256), _mm256_castsi256_si128(high));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 288),
+                             _mm256_extracti128_si256(high, 1));
+        } else {
+            const __m256i low = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32)), 1);
+            const __m256i high = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 256))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 288)), 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), low);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), high);
+        }
+    }
+};
+} // Anonymous namespace
+
+void SwizzleLineAVX2(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift) {
+    CopySwizzledLine<true, AVX2Sectors>(dst, src, x_begin, x_end, x_shift);
+}
+
+void UnswizzleLineAVX2(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift) {
+    CopySwizzledLine<false, AVX2Sectors>(dst, src, x_begin, x_end, x_shift);
+}
+
+} // namespace Tegra::Texture
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+
+#include "common/common_types.h"
+#include "video_core/textures/decoders.h"
+
+namespace Tegra::Texture {
+
+/**
+ * Copies the bytes [x_begin, x_end) of a single line between linear and block linear memory.
+ * The linear side of the copy points to the byte at x_begin, the block linear side points to the
+ * start of the line in the first GOB of the row (including the swizzled y offset).
+ */
+using SwizzleLineFunction = void (*)(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift);
+
+/**
+ * Walks a line in 16 byte GOB sectors.
+ * Whole 64 byte GOB lines are handed to Sectors::CopyGobLine, partial sectors are copied with
+ * memcpy. Avoid calling library functions here, this is instantiated in translation units
+ * compiled with different target flags.
+ */
+template <bool SWIZZLE, typename Sectors>
+void CopySwizzledLine(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift) {
+    u32 x = x_begin;
+    while (x < x_end) {
+        const u32 linear_offset = x - x_begin;
+        const u32 swizzled_offset = ((x >> GOB_SIZE_X_SHIFT) << x_shift) +
+                                    (((x & 32) << 3) | ((x & 16) << 1) | (x & 15));
+        u8* const line_dst = dst + (SWIZZLE ? swizzled_offset : linear_offset);
+        const u8* const line_src = src + (SWIZZLE ? linear_offset : swizzled_offset);
+        if ((x & (GOB_SIZE_X - 1)) == 0 && x_end - x >= GOB_SIZE_X) {
+            Sectors::template CopyGobLine<SWIZZLE>(line_dst, line_src);
+            x += GOB_SIZE_X;
+            continue;
+        }
+        const u32 sector_end = (x | 15) + 1;
+        const u32 size = (sector_end < x_end ? sector_end : x_end) - x;
+        std::memcpy(line_dst, line_src, size);
+        x += size;
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+void SwizzleLineAVX2(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift);
+void UnswizzleLineAVX2(u8* dst, const u8* src, u32 x_begin, u32 x_end, u32 x_shift);
+#endif
+
+} // namespace Tegra::Texture
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "video_core/turbo_governor.h"
+
+namespace VideoCommon {
+namespace {
+/// Weight of the last frame in the smoothed load
+constexpr f64 SMOOTHING = 0.2;
+/// Frames further apart than this are pauses, not a measure of the load
+constexpr std::chrono::milliseconds MAX_FRAME_INTERVAL{250};
+/// Slowdown of the probe over the fastest one that is taken as a clock drop
+constexpr f64 CLOCK_DROP_RATIO = 1.5;
+/// Time to keep boosting after a clock drop was seen
+constexpr std::chrono::seconds CLOCK_DROP_HOLD{1};
+} // Anonymous namespace
+
+TurboGovernor::TurboGovernor(f64 load_threshold_) : load_threshold{load_threshold_} {}
+
+void TurboGovernor::FrameTimed(std::chrono::nanoseconds gpu_time, Clock::time_point now) {
+    const Clock::time_point previous_frame = last_frame;
+    last_frame = now;
+    if (previous_frame == Clock::time_point{} || gpu_time.count() <= 0) {
+        return;
+    }
+    const auto interval = now - previous_frame;
+    if (interval <= Clock::duration::zero() || interval > MAX_FRAME_INTERVAL) {
+        return;
+    }
+    const f64 frame_load = std::chrono::duration<f64>(gpu_time) / interval;
+    load += SMOOTHING * (frame_load - load);
+}
+
+void TurboGovernor::ProbeTimed(std::chrono::nanoseconds duration, Clock::time_point now) {
+    if (duration.count() <= 0) {
+        return;
+    }
+    if (fastest_probe.count() == 0 || duration < fastest_probe) {
+        fastest_probe = duration;
+        return;
+    }
+    const f64 slowdown = std::chrono::duration<f64>(duration) / fastest_probe;
+    if (slowdown > CLOCK_DROP_RATIO) {
+        boost_until = now + CLOCK_DROP_HOLD;
+    }
+}
+
+bool TurboGovernor::ShouldBoost(Clock::time_point now) const noexcept {
+    return load >= load_threshold || now < boost_until;
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Decides when keep alive work has to run to hold the GPU at high clocks.
+ *
+ * Work is needed while the GPU is busy for most of each frame, or when the clocks are seen
+ * dropping. Drops are detected from the execution time of a small fixed probe, which gets slower
+ * as the GPU lowers its clocks; the fastest probe seen is taken as the time at full clocks.
+ */
+class TurboGovernor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @param load_threshold Fraction of the frame interval the GPU has to be busy to boost
+    explicit TurboGovernor(f64 load_threshold);
+
+    /// Adds the GPU time of a frame presented at the given time
+    void FrameTimed(std::chrono::nanoseconds gpu_time, Clock::time_point now);
+
+    /// Adds the execution time of a keep alive probe finished at the given time
+    void ProbeTimed(std::chrono::nanoseconds duration, Clock::time_point now);
+
+    /// Returns true when keep alive work should be submitted continuously
+    [[nodiscard]] bool ShouldBoost(Clock::time_point now) const noexcept;
+
+    [[nodiscard]] f64 Load() const noexcept {
+        return load;
+    }
+
+private:
+    f64 load_threshold;
+    f64 load = 0.0;
+    Clock::time_point last_frame{};
+    std::chrono::nanoseconds fastest_probe{};
+    Clock::time_point boost_until{};
+};
+
+} // namespace VideoCommon
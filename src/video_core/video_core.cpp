@@ -22,7 +22,12 @@ std::unique_ptr<VideoCore::RendererBase> CreateRenderer(
     auto& telemetry_session = system.TelemetrySession();
     auto& device_memory = system.Host1x().MemoryManager();
 
-    switch (Settings::values.renderer_backend.GetValue()) {
+    const auto backend = Settings::values.renderer_backend.GetValue();
+    if (backend != Settings::RendererBackend::Vulkan) {
+        // Don't hold on to a Vulkan device the session won't use
+        Vulkan::ReleaseParkedDeviceContext();
+    }
+    switch (backend) {
     case Settings::RendererBackend::OpenGL:
         return std::make_unique<OpenGL::RendererOpenGL>(telemetry_session, emu_window,
                                                         device_memory, gpu, std::move(context));
@@ -30,7 +35,8 @@ std::unique_ptr<VideoCore::RendererBase> CreateRenderer(
         return std::make_unique<Vulkan::RendererVulkan>(telemetry_session, emu_window,
                                                         device_memory, gpu, std::move(context));
     case Settings::RendererBackend::Null:
-        return std::make_unique<Null::RendererNull>(emu_window, gpu, std::move(context));
+        return std::make_unique<Null::RendererNull>(emu_window, device_memory, gpu,
+                                                    std::move(context));
     default:
         return nullptr;
     }
@@ -60,4 +66,8 @@ std::unique_ptr<Tegra::GPU> CreateGPU(Core::Frontend::EmuWindow& emu_window, Cor
     }
 }
 
+void ReleaseParkedDevices() {
+    Vulkan::ReleaseParkedDeviceContext();
+}
+
 } // namespace VideoCore
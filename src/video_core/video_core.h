@@ -24,4 +24,7 @@ class RendererBase;
 /// Creates an emulated GPU instance using the given system context.
 std::unique_ptr<Tegra::GPU> CreateGPU(Core::Frontend::EmuWindow& emu_window, Core::System& system);
 
+/// Destroys the host GPU devices kept from the previous emulation session.
+void ReleaseParkedDevices();
+
 } // namespace VideoCore
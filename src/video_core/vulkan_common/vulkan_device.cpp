@@ -469,6 +469,11 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
 
     supports_conditional_barriers = !(is_intel_anv || is_intel_windows);
 
+    // Sparse residency is only used when reads from unbound regions are well defined.
+    supports_sparse_residency = graphics_sparse_binding && features.features.sparseBinding &&
+                                features.features.sparseResidencyImage2D &&
+                                properties.properties.sparseProperties.residencyNonResidentStrict;
+
     CollectPhysicalMemoryInfo();
     CollectToolingInfo();
 
@@ -714,6 +719,7 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
                                VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
         dynamic_state3_blending = false;
         dynamic_state3_enables = false;
+        dynamic_state3_rasterization = false;
     }
 
     logical = vk::Device::Create(physical, queue_cis, ExtensionListForVulkan(loaded_extensions),
@@ -726,11 +732,27 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
     functions.vkGetDeviceProcAddr = dld.vkGetDeviceProcAddr;
 
+    VmaAllocatorCreateFlags allocator_flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT;
+    if (extensions.descriptor_buffer) {
+        allocator_flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
+    // Smaller blocks strand less memory when a few long lived allocations keep them alive, this
+    // outweighs the extra allocations on GPUs with little video memory
+    const auto memory_properties = physical.GetMemoryProperties().memoryProperties;
+    VkDeviceSize device_local_size = 0;
+    for (u32 heap = 0; heap < memory_properties.memoryHeapCount; ++heap) {
+        const VkMemoryHeap& memory_heap = memory_properties.memoryHeaps[heap];
+        if ((memory_heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0) {
+            device_local_size = std::max(device_local_size, memory_heap.size);
+        }
+    }
+    const VkDeviceSize block_size = device_local_size <= 4_GiB ? 64_MiB : 0;
+
     const VmaAllocatorCreateInfo allocator_info = {
-        .flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT,
+        .flags = allocator_flags,
         .physicalDevice = physical,
         .device = *logical,
-        .preferredLargeHeapBlockSize = 0,
+        .preferredLargeHeapBlockSize = block_size,
         .pAllocationCallbacks = nullptr,
         .pDeviceMemoryCallbacks = nullptr,
         .pHeapSizeLimit = nullptr,
@@ -1094,6 +1116,16 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
         SetNext(next, properties.transform_feedback);
     }
+    if (extensions.descriptor_buffer) {
+        properties.descriptor_buffer.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        SetNext(next, properties.descriptor_buffer);
+    }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1147,6 +1179,11 @@ void Device::RemoveUnsuitableExtensions() {
     RemoveExtensionFeatureIfUnsuitable(extensions.depth_clip_control, features.depth_clip_control,
                                        VK_EXT_DEPTH_CLIP_CONTROL_EXTENSION_NAME);
 
+    // VK_KHR_dynamic_rendering
+    extensions.dynamic_rendering = features.dynamic_rendering.dynamicRendering;
+    RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering, features.dynamic_rendering,
+                                       VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+
     // VK_EXT_extended_dynamic_state
     extensions.extended_dynamic_state = features.extended_dynamic_state.extendedDynamicState;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state,
@@ -1167,14 +1204,57 @@ void Device::RemoveUnsuitableExtensions() {
     dynamic_state3_enables =
         features.extended_dynamic_state3.extendedDynamicState3DepthClampEnable &&
         features.extended_dynamic_state3.extendedDynamicState3LogicOpEnable;
-
-    extensions.extended_dynamic_state3 = dynamic_state3_blending || dynamic_state3_enables;
+    // Line, conservative and provoking vertex modes are only set when their extension is in use
+    dynamic_state3_rasterization =
+        features.extended_dynamic_state3.extendedDynamicState3PolygonMode &&
+        features.extended_dynamic_state3.extendedDynamicState3AlphaToCoverageEnable &&
+        features.extended_dynamic_state3.extendedDynamicState3AlphaToOneEnable &&
+        features.extended_dynamic_state3.extendedDynamicState3LineRasterizationMode &&
+        features.extended_dynamic_state3.extendedDynamicState3ConservativeRasterizationMode &&
+        features.extended_dynamic_state3.extendedDynamicState3ProvokingVertexMode;
+
+    extensions.extended_dynamic_state3 =
+        dynamic_state3_blending || dynamic_state3_enables || dynamic_state3_rasterization;
     dynamic_state3_blending = dynamic_state3_blending && extensions.extended_dynamic_state3;
     dynamic_state3_enables = dynamic_state3_enables && extensions.extended_dynamic_state3;
+    dynamic_state3_rasterization =
+        dynamic_state3_rasterization && extensions.extended_dynamic_state3;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state3,
                                        features.extended_dynamic_state3,
                                        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
 
+    // VK_EXT_descriptor_buffer
+    extensions.descriptor_buffer = features.descriptor_buffer.descriptorBuffer &&
+                                   features.buffer_device_address.bufferDeviceAddress &&
+                                   properties.descriptor_buffer.maxDescriptorBufferBindings > 0;
+    RemoveExtensionFeatureIfUnsuitable(extensions.descriptor_buffer, features.descriptor_buffer,
+                                       VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    features.descriptor_buffer.descriptorBufferCaptureReplay = false;
+    features.descriptor_buffer.descriptorBufferPushDescriptors = false;
+
+    // VK_KHR_buffer_device_address, only used to write buffers into descriptor buffers
+    if (extensions.descriptor_buffer) {
+        features.buffer_device_address.bufferDeviceAddressCaptureReplay = false;
+        features.buffer_device_address.bufferDeviceAddressMultiDevice = false;
+    } else {
+        RemoveExtensionFeature(extensions.buffer_device_address, features.buffer_device_address,
+                               VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+    }
+
+    // VK_EXT_graphics_pipeline_library
+    // Without fast linking, linking libraries costs about as much as building the whole pipeline
+    extensions.graphics_pipeline_library =
+        features.graphics_pipeline_library.graphicsPipelineLibrary && extensions.pipeline_library &&
+        properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking;
+    RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                       features.graphics_pipeline_library,
+                                       VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+    // VK_KHR_pipeline_library, only used to link graphics pipeline libraries
+    if (!extensions.graphics_pipeline_library) {
+        RemoveExtension(extensions.pipeline_library, VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+    }
+
     // VK_EXT_provoking_vertex
     extensions.provoking_vertex =
         features.provoking_vertex.provokingVertexLast &&
@@ -1235,6 +1315,14 @@ void Device::RemoveUnsuitableExtensions() {
                                VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME);
     }
 
+    // VK_KHR_present_id and VK_KHR_present_wait, only used together
+    extensions.present_wait = features.present_id.presentId && features.present_wait.presentWait;
+    extensions.present_id = extensions.present_wait;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_wait, features.present_wait,
+                                       VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_id, features.present_id,
+                                       VK_KHR_PRESENT_ID_EXTENSION_NAME);
+
     // VK_KHR_workgroup_memory_explicit_layout
     extensions.workgroup_memory_explicit_layout =
         features.features.shaderInt16 &&
@@ -1251,6 +1339,7 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     const std::vector queue_family_properties = physical.GetQueueFamilyProperties();
     std::optional<u32> graphics;
     std::optional<u32> present;
+    bool sparse_binding = false;
     for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
         if (graphics && (present || !surface)) {
             break;
@@ -1261,6 +1350,7 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
         }
         if (queue_family.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
             graphics = index;
+            sparse_binding = (queue_family.queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0;
         }
         if (surface && physical.GetSurfaceSupportKHR(index, surface)) {
             present = index;
@@ -1276,6 +1366,7 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     }
     if (graphics) {
         graphics_family = *graphics;
+        graphics_sparse_binding = sparse_binding;
     }
     if (present) {
         present_family = *present;
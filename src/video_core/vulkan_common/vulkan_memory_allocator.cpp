@@ -2,15 +2,19 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <optional>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/literals.h"
 #include "common/logging/log.h"
+#include "common/metrics.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/vulkan_common/vma.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -135,6 +139,25 @@ public:
         return memory_mapped_span;
     }
 
+    /// Returns the heap the allocation was made from.
+    [[nodiscard]] u32 HeapIndex(const VkPhysicalDeviceMemoryProperties& properties) const {
+        return properties.memoryTypes[std::countr_zero(shifted_memory_type)].heapIndex;
+    }
+
+    /// Returns the size of the allocation.
+    [[nodiscard]] u64 Size() const noexcept {
+        return allocation_size;
+    }
+
+    /// Returns the bytes of the allocation used by commits.
+    [[nodiscard]] u64 CommittedSize() const noexcept {
+        u64 size = 0;
+        for (const Range& range : commits) {
+            size += range.end - range.begin;
+        }
+        return size;
+    }
+
     /// Returns whether this allocation is compatible with the arguments.
     [[nodiscard]] bool IsCompatible(VkMemoryPropertyFlags flags, u32 type_mask) const {
         return (flags & property_flags) == flags && (type_mask & shifted_memory_type) != 0;
@@ -214,12 +237,15 @@ MemoryAllocator::MemoryAllocator(const Device& device_)
       properties{device_.GetPhysical().GetMemoryProperties().memoryProperties},
       buffer_image_granularity{
           device_.GetPhysical().GetProperties().limits.bufferImageGranularity} {
+    using namespace Common::Literals;
+    ForEachDeviceLocalHostVisibleHeap(device, [this](size_t, VkMemoryHeap& heap) {
+        has_large_device_local_host_visible_heap |= heap.size > 256_MiB;
+    });
     // GPUs not supporting rebar may only have a region with less than 256MB host visible/device
     // local memory. In that case, opening 2 RenderDoc captures side-by-side is not possible due to
     // the heap running out of memory. With RenderDoc attached and only a small host/device region,
     // only allow the stream buffer in this memory heap.
     if (device.HasDebuggingToolAttached()) {
-        using namespace Common::Literals;
         ForEachDeviceLocalHostVisibleHeap(device, [this](size_t index, VkMemoryHeap& heap) {
             if (heap.size <= 256_MiB) {
                 valid_memory_types &= ~(1u << index);
@@ -251,6 +277,15 @@ vk::Image MemoryAllocator::CreateImage(const VkImageCreateInfo& ci) const {
                      device.GetDispatchLoader());
 }
 
+vk::Image MemoryAllocator::CreateSparseImage(const VkImageCreateInfo& ci) const {
+    const auto& dld = device.GetDispatchLoader();
+    VkImage handle{};
+    vk::Check(dld.vkCreateImage(*device.GetLogical(), &ci, nullptr, &handle));
+
+    // A null allocation makes VMA destroy the image without touching any memory
+    return vk::Image(handle, *device.GetLogical(), allocator, nullptr, dld);
+}
+
 vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const {
     const VmaAllocationCreateInfo alloc_ci = {
         .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
@@ -361,6 +396,61 @@ VkMemoryPropertyFlags MemoryAllocator::MemoryPropertyFlags(u32 type_mask,
     return 0;
 }
 
+std::vector<HeapStatistics> MemoryAllocator::GetHeapStatistics() const {
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+    vmaGetHeapBudgets(allocator, budgets.data());
+
+    std::vector<HeapStatistics> heaps(properties.memoryHeapCount);
+    for (u32 heap = 0; heap < properties.memoryHeapCount; ++heap) {
+        const VmaBudget& budget = budgets[heap];
+        heaps[heap] = HeapStatistics{
+            .block_bytes = budget.statistics.blockBytes,
+            .allocation_bytes = budget.statistics.allocationBytes,
+            .usage = budget.usage,
+            .budget = budget.budget,
+        };
+    }
+    // Commits are suballocated outside of VMA
+    for (const auto& allocation : allocations) {
+        HeapStatistics& heap = heaps[allocation->HeapIndex(properties)];
+        heap.block_bytes += allocation->Size();
+        heap.allocation_bytes += allocation->CommittedSize();
+    }
+    return heaps;
+}
+
+void MemoryAllocator::UpdateMetrics() const {
+    auto& registry = Common::Metrics::GetRegistry();
+    const std::vector<HeapStatistics> heaps = GetHeapStatistics();
+    for (size_t index = 0; index < heaps.size(); ++index) {
+        const HeapStatistics& heap = heaps[index];
+        registry
+            .RegisterGauge(fmt::format("yuzu_vulkan_heap{}_block_bytes", index),
+                           "Device memory allocated from the heap by the memory allocator")
+            .Set(static_cast<s64>(heap.block_bytes));
+        registry
+            .RegisterGauge(fmt::format("yuzu_vulkan_heap{}_allocation_bytes", index),
+                           "Bytes of the heap blocks used by live allocations")
+            .Set(static_cast<s64>(heap.allocation_bytes));
+        registry
+            .RegisterGauge(fmt::format("yuzu_vulkan_heap{}_usage_bytes", index),
+                           "Heap usage of the process as reported by the driver")
+            .Set(static_cast<s64>(heap.usage));
+        registry
+            .RegisterGauge(fmt::format("yuzu_vulkan_heap{}_budget_bytes", index),
+                           "Heap bytes the process can use before allocations may fail")
+            .Set(static_cast<s64>(heap.budget));
+
+        // Share of the allocated blocks that no live allocation uses
+        const u64 unused_bytes = heap.block_bytes - heap.allocation_bytes;
+        registry
+            .RegisterGauge(fmt::format("yuzu_vulkan_heap{}_fragmentation_percent", index),
+                           "Percentage of the allocated heap blocks not used by allocations")
+            .Set(heap.block_bytes != 0 ? static_cast<s64>(unused_bytes * 100 / heap.block_bytes)
+                                       : 0);
+    }
+}
+
 std::optional<u32> MemoryAllocator::FindType(VkMemoryPropertyFlags flags, u32 type_mask) const {
     for (u32 type_index = 0; type_index < properties.memoryTypeCount; ++type_index) {
         const VkMemoryPropertyFlags type_flags = properties.memoryTypes[type_index].propertyFlags;
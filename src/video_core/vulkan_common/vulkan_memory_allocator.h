@@ -39,6 +39,14 @@ void ForEachDeviceLocalHostVisibleHeap(const Device& device, F&& f) {
     }
 }
 
+/// Memory use of a heap
+struct HeapStatistics {
+    u64 block_bytes;      ///< Device memory allocated from the heap by the allocator
+    u64 allocation_bytes; ///< Bytes of those blocks used by live allocations
+    u64 usage;            ///< Heap usage of the whole process, as reported by the driver
+    u64 budget;           ///< Bytes the process can use before allocations may fail
+};
+
 /// Ownership handle of a memory commitment.
 /// Points to a subregion of a memory allocation.
 class MemoryCommit {
@@ -99,6 +107,9 @@ public:
 
     vk::Image CreateImage(const VkImageCreateInfo& ci) const;
 
+    /// Creates an image without backing memory, memory has to be bound sparsely by the caller.
+    vk::Image CreateSparseImage(const VkImageCreateInfo& ci) const;
+
     vk::Buffer CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const;
 
     /**
@@ -114,6 +125,18 @@ public:
     /// Commits memory required by the buffer and binds it.
     MemoryCommit Commit(const vk::Buffer& buffer, MemoryUsage usage);
 
+    /// Returns true when a device local heap larger than the legacy 256 MiB BAR window is host
+    /// visible (resizable BAR), stream buffers can then be written directly in video memory.
+    bool HasLargeDeviceLocalHostVisibleHeap() const noexcept {
+        return has_large_device_local_host_visible_heap;
+    }
+
+    /// Returns the memory use of each heap
+    std::vector<HeapStatistics> GetHeapStatistics() const;
+
+    /// Exports the memory use and fragmentation of each heap as metrics
+    void UpdateMetrics() const;
+
 private:
     /// Tries to allocate a chunk of memory.
     bool TryAllocMemory(VkMemoryPropertyFlags flags, u32 type_mask, u64 size);
@@ -138,6 +161,7 @@ private:
     VkDeviceSize buffer_image_granularity; // The granularity for adjacent offsets between buffers
                                            // and optimal images
     u32 valid_memory_types{~0u};
+    bool has_large_device_local_host_visible_heap{};
 };
 
 } // namespace Vulkan
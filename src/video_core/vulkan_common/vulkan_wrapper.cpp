@@ -78,8 +78,10 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdBeginConditionalRenderingEXT);
     X(vkCmdBeginQuery);
     X(vkCmdBeginRenderPass);
+    X(vkCmdBeginRendering);
     X(vkCmdBeginTransformFeedbackEXT);
     X(vkCmdBeginDebugUtilsLabelEXT);
+    X(vkCmdBindDescriptorBuffersEXT);
     X(vkCmdBindDescriptorSets);
     X(vkCmdBindIndexBuffer);
     X(vkCmdBindPipeline);
@@ -105,6 +107,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdEndConditionalRenderingEXT);
     X(vkCmdEndQuery);
     X(vkCmdEndRenderPass);
+    X(vkCmdEndRendering);
     X(vkCmdEndTransformFeedbackEXT);
     X(vkCmdEndDebugUtilsLabelEXT);
     X(vkCmdFillBuffer);
@@ -122,17 +125,25 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetStencilWriteMask);
     X(vkCmdSetViewport);
     X(vkCmdWaitEvents);
+    X(vkCmdWriteTimestamp);
     X(vkCmdBindVertexBuffers2EXT);
     X(vkCmdSetCullModeEXT);
     X(vkCmdSetDepthBoundsTestEnableEXT);
     X(vkCmdSetDepthCompareOpEXT);
     X(vkCmdSetDepthTestEnableEXT);
     X(vkCmdSetDepthWriteEnableEXT);
+    X(vkCmdSetDescriptorBufferOffsetsEXT);
     X(vkCmdSetPrimitiveRestartEnableEXT);
     X(vkCmdSetRasterizerDiscardEnableEXT);
     X(vkCmdSetDepthBiasEnableEXT);
     X(vkCmdSetLogicOpEnableEXT);
     X(vkCmdSetDepthClampEnableEXT);
+    X(vkCmdSetPolygonModeEXT);
+    X(vkCmdSetAlphaToCoverageEnableEXT);
+    X(vkCmdSetAlphaToOneEnableEXT);
+    X(vkCmdSetLineRasterizationModeEXT);
+    X(vkCmdSetConservativeRasterizationModeEXT);
+    X(vkCmdSetProvokingVertexModeEXT);
     X(vkCmdSetFrontFaceEXT);
     X(vkCmdSetLogicOpEXT);
     X(vkCmdSetPatchControlPointsEXT);
@@ -191,11 +202,16 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkFreeCommandBuffers);
     X(vkFreeDescriptorSets);
     X(vkFreeMemory);
+    X(vkGetBufferDeviceAddress);
     X(vkGetBufferMemoryRequirements2);
+    X(vkGetDescriptorEXT);
+    X(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    X(vkGetDescriptorSetLayoutSizeEXT);
     X(vkGetDeviceQueue);
     X(vkGetEventStatus);
     X(vkGetFenceStatus);
     X(vkGetImageMemoryRequirements);
+    X(vkGetImageSparseMemoryRequirements);
     X(vkGetPipelineCacheData);
     X(vkGetMemoryFdKHR);
 #ifdef _WIN32
@@ -206,6 +222,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkGetPipelineExecutableStatisticsKHR);
     X(vkGetSemaphoreCounterValue);
     X(vkMapMemory);
+    X(vkQueueBindSparse);
     X(vkQueueSubmit);
     X(vkResetFences);
     X(vkResetQueryPool);
@@ -215,6 +232,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkUpdateDescriptorSetWithTemplate);
     X(vkUpdateDescriptorSets);
     X(vkWaitForFences);
+    X(vkWaitForPresentKHR);
     X(vkWaitSemaphores);
 
     // Support for timeline semaphores is mandatory in Vulkan 1.2
@@ -223,6 +241,11 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
         Proc(dld.vkWaitSemaphores, dld, "vkWaitSemaphoresKHR", device);
     }
 
+    // Support for buffer device addresses is mandatory in Vulkan 1.2
+    if (!dld.vkGetBufferDeviceAddress) {
+        Proc(dld.vkGetBufferDeviceAddress, dld, "vkGetBufferDeviceAddressKHR", device);
+    }
+
     // Support for host query reset is mandatory in Vulkan 1.2
     if (!dld.vkResetQueryPool) {
         Proc(dld.vkResetQueryPool, dld, "vkResetQueryPoolEXT", device);
@@ -233,6 +256,12 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
         Proc(dld.vkCmdDrawIndirectCount, dld, "vkCmdDrawIndirectCountKHR", device);
         Proc(dld.vkCmdDrawIndexedIndirectCount, dld, "vkCmdDrawIndexedIndirectCountKHR", device);
     }
+
+    // Support for dynamic rendering is mandatory in Vulkan 1.3
+    if (!dld.vkCmdBeginRendering) {
+        Proc(dld.vkCmdBeginRendering, dld, "vkCmdBeginRenderingKHR", device);
+        Proc(dld.vkCmdEndRendering, dld, "vkCmdEndRenderingKHR", device);
+    }
 #undef X
 }
 
@@ -275,6 +304,7 @@ bool Load(VkInstance instance, InstanceDispatch& dld) noexcept {
     X(vkGetPhysicalDeviceSurfaceFormatsKHR);
     X(vkGetPhysicalDeviceSurfacePresentModesKHR);
     X(vkGetPhysicalDeviceSurfaceSupportKHR);
+    X(vkGetPhysicalDeviceSparseImageFormatProperties);
     X(vkGetPhysicalDeviceToolProperties);
     X(vkGetSwapchainImagesKHR);
     X(vkQueuePresentKHR);
@@ -910,6 +940,37 @@ VkMemoryRequirements Device::GetImageMemoryRequirements(VkImage image) const noe
     return requirements;
 }
 
+VkDeviceAddress Device::GetBufferDeviceAddress(VkBuffer buffer) const noexcept {
+    const VkBufferDeviceAddressInfo info{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext = nullptr,
+        .buffer = buffer,
+    };
+    return dld->vkGetBufferDeviceAddress(handle, &info);
+}
+
+VkDeviceSize Device::GetDescriptorSetLayoutSizeEXT(VkDescriptorSetLayout layout) const noexcept {
+    VkDeviceSize size;
+    dld->vkGetDescriptorSetLayoutSizeEXT(handle, layout, &size);
+    return size;
+}
+
+VkDeviceSize Device::GetDescriptorSetLayoutBindingOffsetEXT(VkDescriptorSetLayout layout,
+                                                            u32 binding) const noexcept {
+    VkDeviceSize offset;
+    dld->vkGetDescriptorSetLayoutBindingOffsetEXT(handle, layout, binding, &offset);
+    return offset;
+}
+
+std::vector<VkSparseImageMemoryRequirements> Device::GetImageSparseMemoryRequirements(
+    VkImage image) const {
+    u32 num;
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, nullptr);
+    std::vector<VkSparseImageMemoryRequirements> requirements(num);
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, requirements.data());
+    return requirements;
+}
+
 std::vector<VkPipelineExecutablePropertiesKHR> Device::GetPipelineExecutablePropertiesKHR(
     VkPipeline pipeline) const {
     const VkPipelineInfoKHR info{
@@ -995,6 +1056,21 @@ std::vector<VkQueueFamilyProperties> PhysicalDevice::GetQueueFamilyProperties()
     return properties;
 }
 
+std::vector<VkSparseImageFormatProperties> PhysicalDevice::GetSparseImageFormatProperties(
+    VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+    VkImageTiling tiling) const {
+    if (!dld->vkGetPhysicalDeviceSparseImageFormatProperties) {
+        return {};
+    }
+    u32 num;
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, nullptr);
+    std::vector<VkSparseImageFormatProperties> properties(num);
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, properties.data());
+    return properties;
+}
+
 std::vector<VkPhysicalDeviceToolProperties> PhysicalDevice::GetPhysicalDeviceToolProperties()
     const {
     u32 num = 0;
@@ -2,8 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <nlohmann/json.hpp>
-#include "common/detached_tasks.h"
 #include "web_service/telemetry_json.h"
+#include "web_service/upload_queue.h"
 #include "web_service/web_backend.h"
 #include "web_service/web_result.h"
 
@@ -106,11 +106,8 @@ void TelemetryJson::Complete() {
     impl->SerializeSection(Telemetry::FieldType::UserConfig, "UserConfig");
     impl->SerializeSection(Telemetry::FieldType::UserSystem, "UserSystem");
 
-    auto content = impl->TopSection().dump();
-    // Send the telemetry async but don't handle the errors since they were written to the log
-    Common::DetachedTasks::AddTask([host{impl->host}, content]() {
-        Client{host, "", ""}.PostJson("/telemetry", content, true);
-    });
+    // Send the telemetry in the background, the session shutdown doesn't wait on the network
+    QueueUpload(impl->host, "/telemetry", impl->TopSection().dump());
 }
 
 bool TelemetryJson::SubmitTestcase() {
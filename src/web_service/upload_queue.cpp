@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "common/detached_tasks.h"
+#include "common/logging/log.h"
+#include "web_service/upload_queue.h"
+#include "web_service/web_backend.h"
+#include "web_service/web_result.h"
+
+namespace WebService {
+namespace {
+
+/// Time waited after the first queued upload for others to send along with it
+constexpr std::chrono::seconds BATCH_WINDOW{1};
+
+/// Timeout of each step of a queued upload, far shorter than the one of interactive requests
+constexpr std::chrono::seconds UPLOAD_TIMEOUT{5};
+
+/// Time after which the uploads still queued are dropped instead of sent
+constexpr std::chrono::seconds DRAIN_BUDGET{10};
+
+constexpr std::size_t MAX_QUEUED_UPLOADS = 64;
+
+struct Upload {
+    std::string host;
+    std::string path;
+    std::string content;
+};
+
+struct UploadQueue {
+    std::mutex mutex;
+    std::vector<Upload> uploads;
+    bool draining = false;
+};
+
+UploadQueue& GetQueue() {
+    static UploadQueue queue;
+    return queue;
+}
+
+void Drain() {
+    std::this_thread::sleep_for(BATCH_WINDOW);
+    const auto deadline = std::chrono::steady_clock::now() + DRAIN_BUDGET;
+
+    UploadQueue& queue = GetQueue();
+    std::size_t dropped = 0;
+    while (true) {
+        std::vector<Upload> batch;
+        {
+            std::scoped_lock lk{queue.mutex};
+            if (queue.uploads.empty()) {
+                queue.draining = false;
+                break;
+            }
+            batch = std::move(queue.uploads);
+            queue.uploads.clear();
+        }
+        // Uploads to the same host reuse the connection of the previous one
+        std::ranges::stable_sort(batch, {}, &Upload::host);
+
+        std::optional<Client> client;
+        const std::string* client_host = nullptr;
+        for (const Upload& upload : batch) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                ++dropped;
+                continue;
+            }
+            if (!client || *client_host != upload.host) {
+                client.emplace(upload.host, "", "");
+                client->SetTimeout(UPLOAD_TIMEOUT);
+                client->SetCompress(true);
+                client_host = &upload.host;
+            }
+            // The errors of the uploads are only written to the log
+            void(client->PostJson(upload.path, upload.content, true));
+        }
+    }
+    if (dropped != 0) {
+        LOG_WARNING(WebService, "Dropped {} uploads that did not complete in time", dropped);
+    }
+}
+
+} // Anonymous namespace
+
+void QueueUpload(std::string host, std::string path, std::string content) {
+    UploadQueue& queue = GetQueue();
+    std::scoped_lock lk{queue.mutex};
+    if (queue.uploads.size() >= MAX_QUEUED_UPLOADS) {
+        LOG_WARNING(WebService, "Too many uploads queued, dropping the upload to {}", host + path);
+        return;
+    }
+    queue.uploads.push_back(Upload{
+        .host = std::move(host),
+        .path = std::move(path),
+        .content = std::move(content),
+    });
+    if (!queue.draining) {
+        queue.draining = true;
+        Common::DetachedTasks::AddTask(Drain);
+    }
+}
+
+} // namespace WebService
@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+namespace WebService {
+
+/**
+ * Queues a JSON document to be posted anonymously to the web service, without waiting on the
+ * network. The documents queued within a short window are sent together from one background task
+ * over a single compressed connection per host, with short timeouts and a bounded time budget so
+ * that the program exit, which waits for the detached tasks, is not held up by a slow network.
+ * @param host the web API URL
+ * @param path the URL segment after the host address.
+ * @param content String of JSON data to use for the body of the POST request.
+ */
+void QueueUpload(std::string host, std::string path, std::string content);
+
+} // namespace WebService
@@ -79,9 +79,10 @@ struct Client::Impl {
             return {};
         }
 
-        cli->set_connection_timeout(TIMEOUT_SECONDS);
-        cli->set_read_timeout(TIMEOUT_SECONDS);
-        cli->set_write_timeout(TIMEOUT_SECONDS);
+        cli->set_connection_timeout(timeout);
+        cli->set_read_timeout(timeout);
+        cli->set_write_timeout(timeout);
+        cli->set_compress(compress);
 
         httplib::Headers params;
         if (!jwt_.empty()) {
@@ -159,6 +160,8 @@ struct Client::Impl {
     std::string token;
     std::string jwt;
     std::unique_ptr<httplib::Client> cli;
+    std::chrono::seconds timeout{TIMEOUT_SECONDS};
+    bool compress = false;
 
     struct JWTCache {
         std::mutex mutex;
@@ -174,6 +177,14 @@ Client::Client(std::string host, std::string username, std::string token)
 
 Client::~Client() = default;
 
+void Client::SetTimeout(std::chrono::seconds timeout) {
+    impl->timeout = timeout;
+}
+
+void Client::SetCompress(bool compress) {
+    impl->compress = compress;
+}
+
 WebResult Client::PostJson(const std::string& path, const std::string& data, bool allow_anonymous) {
     return impl->GenericRequest("POST", path, data, allow_anonymous, "application/json");
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -15,6 +16,18 @@ public:
     Client(std::string host, std::string username, std::string token);
     ~Client();
 
+    /**
+     * Limits the time spent connecting, sending and receiving in each request.
+     * @param timeout the time after which each of these steps fails, 30 seconds by default.
+     */
+    void SetTimeout(std::chrono::seconds timeout);
+
+    /**
+     * Compresses the body of the requests with gzip when httplib is built with zlib.
+     * @param compress If true, compress the requests.
+     */
+    void SetCompress(bool compress);
+
     /**
      * Posts JSON to the specified path.
      * @param path the URL segment after the host address.
@@ -64,8 +64,7 @@ QtControllerSelectorDialog::QtControllerSelectorDialog(
     QWidget* parent, Core::Frontend::ControllerParameters parameters_,
     InputCommon::InputSubsystem* input_subsystem_, Core::System& system_)
     : QDialog(parent), ui(std::make_unique<Ui::QtControllerSelectorDialog>()),
-      parameters(std::move(parameters_)), input_subsystem{input_subsystem_},
-      input_profiles(std::make_unique<InputProfiles>()), system{system_} {
+      parameters(std::move(parameters_)), input_subsystem{input_subsystem_}, system{system_} {
     ui->setupUi(this);
 
     player_widgets = {
@@ -305,6 +304,10 @@ void QtControllerSelectorDialog::CallConfigureMotionTouchDialog() {
 }
 
 void QtControllerSelectorDialog::CallConfigureInputProfileDialog() {
+    if (!input_profiles) {
+        // Reads every profile from disk, which would delay opening the applet
+        input_profiles = std::make_unique<InputProfiles>();
+    }
     ConfigureInputProfileDialog dialog(this, input_subsystem, input_profiles.get(), system);
 
     dialog.setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint |
@@ -114,6 +114,7 @@ private:
 
     InputCommon::InputSubsystem* input_subsystem;
 
+    // Loaded the first time the profiles are managed from the applet
     std::unique_ptr<InputProfiles> input_profiles;
 
     Core::System& system;
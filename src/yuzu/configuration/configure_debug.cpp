@@ -69,6 +69,20 @@ void ConfigureDebug::SetConfiguration() {
     ui->disable_macro_jit->setChecked(Settings::values.disable_macro_jit.GetValue());
     ui->disable_macro_hle->setEnabled(runtime_lock);
     ui->disable_macro_hle->setChecked(Settings::values.disable_macro_hle.GetValue());
+    ui->profile_macros->setEnabled(runtime_lock);
+    ui->profile_macros->setChecked(Settings::values.profile_macros.GetValue());
+    ui->profile_gpu_passes->setEnabled(runtime_lock);
+    ui->profile_gpu_passes->setChecked(Settings::values.profile_gpu_passes.GetValue());
+    ui->profile_svcs->setEnabled(runtime_lock);
+    ui->profile_svcs->setChecked(Settings::values.profile_svcs.GetValue());
+    ui->profile_guest->setEnabled(runtime_lock);
+    ui->profile_guest->setChecked(Settings::values.profile_guest.GetValue());
+    ui->use_huge_pages->setEnabled(runtime_lock);
+    ui->use_huge_pages->setChecked(Settings::values.use_huge_pages.GetValue());
+    ui->profile_tlb_misses->setEnabled(runtime_lock);
+    ui->profile_tlb_misses->setChecked(Settings::values.profile_tlb_misses.GetValue());
+    ui->null_renderer_caches->setEnabled(runtime_lock);
+    ui->null_renderer_caches->setChecked(Settings::values.null_renderer_caches.GetValue());
     ui->disable_loop_safety_checks->setEnabled(runtime_lock);
     ui->disable_loop_safety_checks->setChecked(
         Settings::values.disable_shader_loop_safety_checks.GetValue());
@@ -108,6 +122,13 @@ void ConfigureDebug::ApplyConfiguration() {
         ui->disable_loop_safety_checks->isChecked();
     Settings::values.disable_macro_jit = ui->disable_macro_jit->isChecked();
     Settings::values.disable_macro_hle = ui->disable_macro_hle->isChecked();
+    Settings::values.profile_macros = ui->profile_macros->isChecked();
+    Settings::values.profile_gpu_passes = ui->profile_gpu_passes->isChecked();
+    Settings::values.profile_svcs = ui->profile_svcs->isChecked();
+    Settings::values.profile_guest = ui->profile_guest->isChecked();
+    Settings::values.use_huge_pages = ui->use_huge_pages->isChecked();
+    Settings::values.profile_tlb_misses = ui->profile_tlb_misses->isChecked();
+    Settings::values.null_renderer_caches = ui->null_renderer_caches->isChecked();
     Settings::values.extended_logging = ui->extended_logging->isChecked();
     Settings::values.perform_vulkan_check = ui->perform_vulkan_check->isChecked();
     UISettings::values.disable_web_applet = ui->disable_web_applet->isChecked();
@@ -32,6 +32,9 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, audio_input_device_id, tr("Input Device:"), QStringLiteral());
     INSERT(Settings, audio_muted, tr("Mute audio"), QStringLiteral());
     INSERT(Settings, volume, tr("Volume:"), QStringLiteral());
+    INSERT(Settings, audio_time_stretching, tr("Stretch audio during slowdowns"),
+           tr("Slows the audio down instead of cutting out when the emulation cannot keep up.\n"
+              "Adds around 10ms of audio latency."));
     INSERT(Settings, dump_audio_commands, QStringLiteral(), QStringLiteral());
     INSERT(UISettings, mute_when_in_background, tr("Mute audio when in background"),
            QStringLiteral());
@@ -41,6 +44,13 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, memory_layout_mode, tr("Memory Layout"), QStringLiteral());
     INSERT(Settings, use_speed_limit, QStringLiteral(), QStringLiteral());
     INSERT(Settings, speed_limit, tr("Limit Speed Percent"), QStringLiteral());
+    INSERT(Settings, memory_budget, tr("Memory Budget (MiB):"),
+           tr("Host memory the emulated console and the caches may use before the caches are "
+              "trimmed early.\n0 uses three quarters of the physical memory."));
+    INSERT(Settings, use_jit_block_profile, tr("Prewarm the CPU recompiler"),
+           tr("Records the guest code recompiled while playing, and recompiles it in the "
+              "background on the next boot, reducing stutter early in the game.\nOnly applies to "
+              "64-bit games with multicore CPU emulation and the Dynarmic backend."));
 
     // Cpu
     INSERT(Settings, cpu_accuracy, tr("Accuracy:"), QStringLiteral());
@@ -80,12 +90,20 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     INSERT(Settings, vulkan_device, tr("Device:"), QStringLiteral());
     INSERT(Settings, shader_backend, tr("Shader Backend:"), QStringLiteral());
     INSERT(Settings, resolution_setup, tr("Resolution:"), QStringLiteral());
+    INSERT(Settings, dynamic_resolution, tr("Dynamic resolution (Vulkan only)"),
+           tr("Renders at native resolution while the GPU can't hold the target frame rate at "
+              "the selected resolution."));
+    INSERT(Settings, dynamic_resolution_target_fps, tr("Dynamic resolution target FPS:"),
+           QStringLiteral());
     INSERT(Settings, scaling_filter, tr("Window Adapting Filter:"), QStringLiteral());
     INSERT(Settings, fsr_sharpening_slider, tr("FSR Sharpness:"), QStringLiteral());
     INSERT(Settings, anti_aliasing, tr("Anti-Aliasing Method:"), QStringLiteral());
     INSERT(Settings, fullscreen_mode, tr("Fullscreen Mode:"), QStringLiteral());
     INSERT(Settings, aspect_ratio, tr("Aspect Ratio:"), QStringLiteral());
     INSERT(Settings, use_disk_shader_cache, tr("Use disk pipeline cache"), QStringLiteral());
+    INSERT(Settings, use_disk_texture_cache, tr("Use disk transcoded texture cache"),
+           tr("Stores ASTC and BCn textures decoded on the CPU on disk, and reuses them on the "
+              "next boot instead of decoding them again.\nRequires the disk pipeline cache."));
     INSERT(Settings, use_asynchronous_gpu_emulation, tr("Use asynchronous GPU emulation"),
            QStringLiteral());
     INSERT(Settings, nvdec_emulation, tr("NVDEC emulation:"), QStringLiteral());
@@ -105,10 +123,26 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     // Renderer (Advanced Graphics)
     INSERT(Settings, async_presentation, tr("Enable asynchronous presentation (Vulkan only)"),
            QStringLiteral());
+    INSERT(Settings, low_latency_presentation, tr("Low latency presentation (Vulkan only)"),
+           tr("Keeps a single frame queued for display instead of adapting the queue depth to "
+              "the frame time.\nReduces input latency at the cost of smoothness when the frame "
+              "time varies. Requires VK_KHR_present_wait and asynchronous presentation."));
+    INSERT(Settings, vsync_follows_present, tr("Align VSync with the display (Vulkan only)"),
+           tr("Shifts the emulated VSync towards the moments the host display shows frames.\n"
+              "Reduces judder when the display refresh does not match the game. Requires "
+              "VK_KHR_present_wait and asynchronous presentation."));
     INSERT(
         Settings, renderer_force_max_clock, tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
            "lowering its clock speed."));
+    INSERT(Settings, force_max_clock_load, tr("Force maximum clocks above GPU load:"),
+           tr("Only runs the background work while the GPU is busy for at least this part of "
+              "each frame, or when its clocks are seen dropping. 0% always runs it.\nIgnored when "
+              "the GPU does not support timestamps."));
+    INSERT(Settings, vulkan_parallel_recording,
+           tr("Record command buffers on multiple threads (Vulkan only, experimental)"),
+           tr("Records consecutive queue submissions on separate worker threads.\nCan improve "
+              "performance in games that submit often, at the cost of extra CPU threads."));
     INSERT(Settings, max_anisotropy, tr("Anisotropic Filtering:"), QStringLiteral());
     INSERT(Settings, gpu_accuracy, tr("Accuracy Level:"), QStringLiteral());
     INSERT(
@@ -131,11 +165,27 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
         Settings, use_reactive_flushing, tr("Enable Reactive Flushing"),
         tr("Uses reactive flushing instead of predictive flushing, allowing more accurate memory "
            "syncing."));
+    INSERT(Settings, use_readback_prediction, tr("Predict buffer readbacks (experimental)"),
+           tr("Only downloads GPU written buffers ahead of time when the game read them back "
+              "before, other buffers are downloaded when the game reads them.\nRequires reactive "
+              "flushing. Can improve performance in compute heavy games."));
+    INSERT(Settings, speculative_query_results, tr("Speculative query results (experimental)"),
+           tr("Games reading occlusion queries before the GPU finished them see the last known "
+              "result instead of waiting for the GPU.\nQueries used as fences are always "
+              "waited on. Can improve performance in games using occlusion culling."));
     INSERT(Settings, use_video_framerate, tr("Sync to framerate of video playback"),
            tr("Run the game at normal speed during video playback, even when the framerate is "
               "unlocked."));
     INSERT(Settings, barrier_feedback_loops, tr("Barrier feedback loops"),
            tr("Improves rendering of transparency effects in specific games."));
+    INSERT(Settings, use_sparse_textures, tr("Use sparse textures (Vulkan only, experimental)"),
+           tr("Creates large 3D and array textures without backing memory and only commits the "
+              "regions the game uploads or renders to.\nReduces video memory usage in games "
+              "with huge volume textures."));
+    INSERT(Settings, texture_eviction_policy, tr("Texture eviction policy:"),
+           tr("Selects how textures are evicted when video memory runs low.\nCost model keeps "
+              "textures that are expensive to recreate, such as decoded ASTC textures, for "
+              "longer."));
 
     // Renderer (Debug)
 
@@ -217,6 +267,11 @@ std::unique_ptr<ComboboxTranslationMap> ComboboxEnumeration(QWidget* parent) {
              PAIR(AstcRecompression, Bc1, tr("BC1 (Low quality)")),
              PAIR(AstcRecompression, Bc3, tr("BC3 (Medium quality)")),
          }});
+    translations->insert({Settings::EnumMetadata<Settings::TextureEvictionPolicy>::Index(),
+                          {
+                              PAIR(TextureEvictionPolicy, Lru, tr("Least recently used")),
+                              PAIR(TextureEvictionPolicy, CostModel, tr("Cost model")),
+                          }});
     translations->insert({Settings::EnumMetadata<Settings::RendererBackend>::Index(),
                           {
 #ifdef HAS_OPENGL
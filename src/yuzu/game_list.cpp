@@ -792,6 +792,10 @@ void GameList::changeEvent(QEvent* event) {
     if (event->type() == QEvent::LanguageChange) {
         RetranslateUI();
     }
+    if (event->type() == QEvent::EnabledChange && isEnabled() && refresh_pending) {
+        refresh_pending = false;
+        RefreshGameDirectory();
+    }
 
     QWidget::changeEvent(event);
 }
@@ -870,10 +874,17 @@ const QStringList GameList::supported_file_extensions = {
     QStringLiteral("xci"), QStringLiteral("nsp"), QStringLiteral("kip")};
 
 void GameList::RefreshGameDirectory() {
-    if (!UISettings::values.game_dirs.empty() && current_worker != nullptr) {
-        LOG_INFO(Frontend, "Change detected in the games directory. Reloading game list.");
-        PopulateAsync(UISettings::values.game_dirs);
+    if (UISettings::values.game_dirs.empty() || current_worker == nullptr) {
+        return;
+    }
+    if (!isEnabled()) {
+        // The list is disabled while a game runs. Scanning would compete with it for the CPU and
+        // replace the content it uses, so reload once it stops.
+        refresh_pending = true;
+        return;
     }
+    LOG_INFO(Frontend, "Change detected in the games directory. Reloading game list.");
+    PopulateAsync(UISettings::values.game_dirs);
 }
 
 void GameList::ToggleFavorite(u64 program_id) {
@@ -171,6 +171,8 @@ private:
     QStandardItemModel* item_model = nullptr;
     std::unique_ptr<GameListWorker> current_worker;
     QFileSystemWatcher* watcher = nullptr;
+    /// Set when the game directories changed while a game was running
+    bool refresh_pending = false;
     ControllerNavigation* controller_navigation = nullptr;
     CompatibilityList compatibility_list;
 
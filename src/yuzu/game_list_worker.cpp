@@ -1,18 +1,27 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <QDataStream>
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
 #include <QSettings>
 
+#include "common/cityhash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -31,6 +40,12 @@
 
 namespace {
 
+/// Most threads reading files for the game list at once
+constexpr size_t MaxScanThreads = 8;
+
+/// Serializes the accesses to the game list cache, files are scanned in parallel
+std::mutex cache_mutex;
+
 QString GetGameListCachedObject(const std::string& filename, const std::string& ext,
                                 const std::function<QString()>& generator) {
     if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
@@ -46,6 +61,7 @@ QString GetGameListCachedObject(const std::string& filename, const std::string&
     if (!Common::FS::Exists(path)) {
         const auto str = generator();
 
+        std::scoped_lock lk{cache_mutex};
         QFile file{QString::fromStdString(path)};
         if (file.open(QFile::WriteOnly)) {
             file.write(str.toUtf8());
@@ -54,6 +70,7 @@ QString GetGameListCachedObject(const std::string& filename, const std::string&
         return str;
     }
 
+    std::scoped_lock lk{cache_mutex};
     QFile file{QString::fromStdString(path)};
     if (file.open(QFile::ReadOnly)) {
         return QString::fromUtf8(file.readAll());
@@ -82,6 +99,7 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
     if (!Common::FS::Exists(path1) || !Common::FS::Exists(path2)) {
         const auto [icon, nacp] = generator();
 
+        std::scoped_lock lk{cache_mutex};
         QFile file1{QString::fromStdString(path1)};
         if (!file1.open(QFile::WriteOnly)) {
             LOG_ERROR(Frontend, "Failed to open cache file.");
@@ -107,6 +125,7 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
         return std::make_pair(icon, nacp);
     }
 
+    std::scoped_lock lk{cache_mutex};
     QFile file1(QString::fromStdString(path1));
     QFile file2(QString::fromStdString(path2));
 
@@ -139,6 +158,107 @@ void GetMetadataFromControlNCA(const FileSys::PatchManager& patch_manager, const
         });
 }
 
+/// Metadata read from a game file, cached until the file changes
+struct FileMetadata {
+    struct Program {
+        u64 program_id;
+        std::string name;
+        std::vector<u8> icon;
+    };
+
+    Loader::FileType file_type{};
+    bool has_multiple_programs{};
+    std::vector<Program> programs;
+};
+
+constexpr quint32 FileMetadataCacheVersion = 1;
+
+std::string GetFileMetadataCachePath(const std::string& physical_name) {
+    return Common::FS::PathToUTF8String(
+        Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "game_list" /
+        fmt::format("{:016X}.file.bin",
+                    Common::CityHash64(physical_name.data(), physical_name.size())));
+}
+
+std::optional<FileMetadata> LoadCachedFileMetadata(const std::string& physical_name,
+                                                   const QFileInfo& file_info) {
+    if (!UISettings::values.cache_game_list) {
+        return std::nullopt;
+    }
+
+    std::scoped_lock lk{cache_mutex};
+    QFile file{QString::fromStdString(GetFileMetadataCachePath(physical_name))};
+    if (!file.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
+
+    QDataStream stream{&file};
+    quint32 version{};
+    QString path;
+    qint64 size{};
+    qint64 modified{};
+    quint32 file_type{};
+    bool has_multiple_programs{};
+    quint32 num_programs{};
+    stream >> version >> path >> size >> modified >> file_type >> has_multiple_programs >>
+        num_programs;
+    if (stream.status() != QDataStream::Ok || version != FileMetadataCacheVersion ||
+        path != QString::fromStdString(physical_name) || size != file_info.size() ||
+        modified != file_info.lastModified().toMSecsSinceEpoch()) {
+        return std::nullopt;
+    }
+
+    FileMetadata metadata{
+        .file_type = static_cast<Loader::FileType>(file_type),
+        .has_multiple_programs = has_multiple_programs,
+        .programs{},
+    };
+    for (quint32 i = 0; i < num_programs && stream.status() == QDataStream::Ok; ++i) {
+        quint64 program_id{};
+        QByteArray name;
+        QByteArray icon;
+        stream >> program_id >> name >> icon;
+        metadata.programs.push_back({
+            .program_id = program_id,
+            .name = name.toStdString(),
+            .icon = std::vector<u8>(icon.begin(), icon.end()),
+        });
+    }
+    if (stream.status() != QDataStream::Ok) {
+        return std::nullopt;
+    }
+    return metadata;
+}
+
+void StoreCachedFileMetadata(const std::string& physical_name, const QFileInfo& file_info,
+                             const FileMetadata& metadata) {
+    if (!UISettings::values.cache_game_list) {
+        return;
+    }
+
+    const auto path = GetFileMetadataCachePath(physical_name);
+    void(Common::FS::CreateParentDirs(path));
+
+    std::scoped_lock lk{cache_mutex};
+    QFile file{QString::fromStdString(path)};
+    if (!file.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open cache file.");
+        return;
+    }
+
+    QDataStream stream{&file};
+    stream << FileMetadataCacheVersion << QString::fromStdString(physical_name)
+           << file_info.size() << file_info.lastModified().toMSecsSinceEpoch()
+           << static_cast<quint32>(metadata.file_type) << metadata.has_multiple_programs
+           << static_cast<quint32>(metadata.programs.size());
+    for (const auto& program : metadata.programs) {
+        stream << static_cast<quint64>(program.program_id)
+               << QByteArray::fromStdString(program.name)
+               << QByteArray(reinterpret_cast<const char*>(program.icon.data()),
+                             static_cast<qsizetype>(program.icon.size()));
+    }
+}
+
 bool HasSupportedFileExtension(const std::string& file_name) {
     const QFileInfo file = QFileInfo(QString::fromStdString(file_name));
     return GameList::supported_file_extensions.contains(file.suffix(), Qt::CaseInsensitive);
@@ -191,12 +311,24 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
     return out;
 }
 
+QString GetPatchVersions(const FileSys::PatchManager& patch,
+                         const std::function<Loader::AppLoader*()>& get_loader) {
+    return GetGameListCachedObject(
+        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &get_loader] {
+            Loader::AppLoader* const loader = get_loader();
+            if (loader == nullptr) {
+                return QString{};
+            }
+            return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+        });
+}
+
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
                                         const std::size_t size, const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader, u64 program_id,
+                                        Loader::FileType file_type, u64 program_id,
+                                        const QString& patch_versions,
                                         const CompatibilityList& compatibility_list,
-                                        const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch) {
+                                        const PlayTime::PlayTimeManager& play_time_manager) {
     const auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
 
     // The game list uses this as compatibility number for untested games
@@ -205,7 +337,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         compatibility = it->second.first;
     }
 
-    const auto file_type = loader.GetFileType();
     const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
     QList<QStandardItem*> list{
@@ -217,10 +348,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         new GameListItemPlayTime(play_time_manager.GetPlayTime(program_id)),
     };
 
-    const auto patch_versions = GetGameListCachedObject(
-        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-        });
     list.insert(2, new GameListItem(patch_versions));
 
     return list;
@@ -328,15 +455,151 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
             GetMetadataFromControlNCA(patch, *control, icon, name);
         }
 
-        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon, *loader,
-                                       program_id, compatibility_list, play_time_manager, patch);
-        RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
+        const auto patch_versions = GetPatchVersions(patch, [&loader] { return loader.get(); });
+        RecordEvent([=, this, path = file->GetFullPath(), size = file->GetSize(),
+                     file_type = loader->GetFileType()](GameList* game_list) {
+            game_list->AddEntry(MakeGameListEntry(path, name, size, icon, file_type, program_id,
+                                                  patch_versions, compatibility_list,
+                                                  play_time_manager),
+                                parent_dir);
+        });
+    }
+}
+
+void GameListWorker::FillManualContentProvider(const std::string& physical_name) {
+    const auto file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
+    if (!file) {
+        return;
+    }
+
+    const auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
+
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+
+    if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
+        provider->AddEntry(FileSys::TitleType::Application,
+                           FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()), program_id,
+                           file);
+    } else if (res2 == Loader::ResultStatus::Success &&
+               (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        const auto nsp = file_type == Loader::FileType::NSP
+                             ? std::make_shared<FileSys::NSP>(file)
+                             : FileSys::XCI{file}.GetSecurePartitionNSP();
+        for (const auto& title : nsp->GetNCAs()) {
+            for (const auto& entry : title.second) {
+                provider->AddEntry(entry.first.first, entry.first.second, title.first,
+                                   entry.second->GetBaseFile());
+            }
+        }
+    }
+}
+
+void GameListWorker::AddFileToGameList(const std::string& physical_name,
+                                       GameListDir* parent_dir) {
+    const QFileInfo file_info{QString::fromStdString(physical_name)};
+
+    // The file and its loaders are only opened when the cached metadata is missing or stale.
+    FileSys::VirtualFile file;
+    std::vector<std::unique_ptr<Loader::AppLoader>> loaders;
+    auto metadata = LoadCachedFileMetadata(physical_name, file_info);
+    if (!metadata) {
+        file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
+        if (!file) {
+            return;
+        }
+
+        auto loader = Loader::GetLoader(system, file);
+        if (!loader) {
+            return;
+        }
+
+        const auto file_type = loader->GetFileType();
+        if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+            return;
+        }
+
+        u64 program_id = 0;
+        const auto res2 = loader->ReadProgramId(program_id);
+
+        std::vector<u64> program_ids;
+        loader->ReadProgramIds(program_ids);
+
+        metadata.emplace();
+        metadata->file_type = file_type;
+        metadata->has_multiple_programs =
+            res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+            (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP);
+        if (metadata->has_multiple_programs) {
+            for (const auto id : program_ids) {
+                auto program_loader = Loader::GetLoader(system, file, id);
+                if (!program_loader) {
+                    continue;
+                }
+
+                std::vector<u8> icon;
+                [[maybe_unused]] const auto res1 = program_loader->ReadIcon(icon);
+
+                std::string name = " ";
+                [[maybe_unused]] const auto res3 = program_loader->ReadTitle(name);
+
+                metadata->programs.push_back({id, std::move(name), std::move(icon)});
+                loaders.push_back(std::move(program_loader));
+            }
+        } else {
+            std::vector<u8> icon;
+            [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
+
+            std::string name = " ";
+            [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+
+            metadata->programs.push_back({program_id, std::move(name), std::move(icon)});
+            loaders.push_back(std::move(loader));
+        }
+        StoreCachedFileMetadata(physical_name, file_info, *metadata);
+    }
+    loaders.resize(metadata->programs.size());
+
+    for (size_t i = 0; i < metadata->programs.size(); ++i) {
+        const auto& program = metadata->programs[i];
+        const FileSys::PatchManager patch{program.program_id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+        const auto patch_versions = GetPatchVersions(patch, [&]() -> Loader::AppLoader* {
+            if (!loaders[i]) {
+                if (!file) {
+                    file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
+                }
+                if (file) {
+                    loaders[i] = metadata->has_multiple_programs
+                                     ? Loader::GetLoader(system, file, program.program_id)
+                                     : Loader::GetLoader(system, file);
+                }
+            }
+            return loaders[i].get();
+        });
+
+        RecordEvent([=, this, size = static_cast<std::size_t>(file_info.size()),
+                     file_type = metadata->file_type](GameList* game_list) {
+            game_list->AddEntry(MakeGameListEntry(physical_name, program.name, size, program.icon,
+                                                  file_type, program.program_id, patch_versions,
+                                                  compatibility_list, play_time_manager),
+                                parent_dir);
+        });
     }
 }
 
 void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                                     GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+    std::vector<std::string> files;
+    const auto callback = [this, &files](const std::filesystem::path& path) -> bool {
         if (stop_requested) {
             // Breaks the callback loop.
             return false;
@@ -347,88 +610,7 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
 
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
-            const auto file = vfs->OpenFile(physical_name, FileSys::Mode::Read);
-            if (!file) {
-                return true;
-            }
-
-            auto loader = Loader::GetLoader(system, file);
-            if (!loader) {
-                return true;
-            }
-
-            const auto file_type = loader->GetFileType();
-            if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
-                return true;
-            }
-
-            u64 program_id = 0;
-            const auto res2 = loader->ReadProgramId(program_id);
-
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
-                    }
-                }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
-
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
-
-                        std::vector<u8> icon;
-                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                        std::string name = " ";
-                        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                          system.GetContentProvider()};
-
-                        auto entry = MakeGameListEntry(
-                            physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                            id, compatibility_list, play_time_manager, patch);
-
-                        RecordEvent(
-                            [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                    }
-                } else {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                    const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
-
-                    auto entry = MakeGameListEntry(
-                        physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                        program_id, compatibility_list, play_time_manager, patch);
-
-                    RecordEvent(
-                        [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                }
-            }
+            files.push_back(physical_name);
         } else if (is_dir) {
             watch_list.append(QString::fromStdString(physical_name));
         }
@@ -442,6 +624,30 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     } else {
         Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
     }
+
+    if (target == ScanTarget::FillManualContentProvider) {
+        // The loaders read the content providers we are filling, so this pass stays serial.
+        for (const auto& physical_name : files) {
+            if (stop_requested) {
+                break;
+            }
+            FillManualContentProvider(physical_name);
+        }
+        return;
+    }
+
+    // The content providers are only read from now on, scan the files in parallel.
+    Common::ThreadWorker workers{
+        std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MaxScanThreads),
+        "GameListScan"};
+    for (auto& physical_name : files) {
+        workers.QueueWork([this, parent_dir, physical_name = std::move(physical_name)] {
+            if (!stop_requested) {
+                AddFileToGameList(physical_name, parent_dir);
+            }
+        });
+    }
+    workers.WaitForRequests();
 }
 
 void GameListWorker::run() {
@@ -75,6 +75,8 @@ private:
 
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                         GameListDir* parent_dir);
+    void FillManualContentProvider(const std::string& physical_name);
+    void AddFileToGameList(const std::string& physical_name, GameListDir* parent_dir);
 
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
@@ -99,6 +99,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #include "common/literals.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
+#include "common/memory_accounting.h"
 #include "common/memory_detect.h"
 #include "common/microprofile.h"
 #include "common/scm_rev.h"
@@ -1048,10 +1049,13 @@ void GMainWindow::InitializeWidgets() {
     emu_frametime_label = new QLabel();
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
-           "full-speed emulation this should be at most 16.67 ms."));
+           "full-speed emulation this should be at most 16.67 ms.\nThe GPU time of the game "
+           "frames is shown when the renderer measures it."));
+    audio_stats_label = new QLabel();
+    memory_label = new QLabel();
 
     for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+                        emu_frametime_label, audio_stats_label, memory_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -2179,6 +2183,8 @@ void GMainWindow::OnEmulationStopped() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    audio_stats_label->setVisible(false);
+    memory_label->setVisible(false);
     renderer_status_button->setEnabled(!UISettings::values.has_broken_vulkan);
 
     if (!firmware_label->text().isEmpty()) {
@@ -4392,6 +4398,10 @@ void GMainWindow::UpdateStatusBar() {
         status_bar_update_timer.stop();
         return;
     }
+    if (statusBar()->isHidden()) {
+        // Nothing is shown, keep accumulating the stats until the status bar comes back
+        return;
+    }
 
     if (Settings::values.tas_enable) {
         tas_label->setText(GetTasStateDescription());
@@ -4429,12 +4439,47 @@ void GMainWindow::UpdateStatusBar() {
         game_fps_label->setText(
             tr("Game: %1 FPS").arg(std::round(results.average_game_fps), 0, 'f', 0));
     }
-    emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    if (results.gpu_frametime > 0.0) {
+        emu_frametime_label->setText(tr("Frame: %1 ms, GPU: %2 ms")
+                                         .arg(results.frametime * 1000.0, 0, 'f', 2)
+                                         .arg(results.gpu_frametime * 1000.0, 0, 'f', 2));
+    } else {
+        emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    }
+    audio_stats_label->setText(
+        tr("Audio: %1 ms, %n underrun(s)", "", static_cast<int>(results.audio_underruns))
+            .arg(results.audio_latency * 1000.0, 0, 'f', 0));
+    audio_stats_label->setToolTip(
+        tr("Duration of audio queued for the output device, and how many times it ran out of "
+           "audio since the last update.\nAudio rendering: %1 ms per frame, must stay below 5 ms.")
+            .arg(results.audio_render_time * 1000.0, 0, 'f', 2));
+
+    using Common::MemoryAccounting::Category;
+    u64 memory_total = 0;
+    QString memory_breakdown;
+    for (u32 index = 0; index < static_cast<u32>(Category::Count); ++index) {
+        const auto category = static_cast<Category>(index);
+        const std::string_view name = Common::MemoryAccounting::GetName(category);
+        const u64 bytes = Common::MemoryAccounting::Get(category);
+        memory_total += bytes;
+        memory_breakdown +=
+            QStringLiteral("\n%1: %2 MiB")
+                .arg(QString::fromLatin1(name.data(), static_cast<int>(name.size())))
+                .arg(bytes >> 20);
+    }
+    memory_label->setText(tr("RAM: %1 / %2 MiB")
+                              .arg(memory_total >> 20)
+                              .arg(Common::MemoryAccounting::GetBudget() >> 20));
+    memory_label->setToolTip(tr("Host memory held by the emulated console and the caches, and the "
+                                "budget past which the caches are trimmed early.%1")
+                                 .arg(memory_breakdown));
 
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    audio_stats_label->setVisible(results.audio_latency > 0.0);
+    memory_label->setVisible(true);
     firmware_label->setVisible(false);
 }
 
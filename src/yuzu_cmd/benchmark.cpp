@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "common/fs/file.h"
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "video_core/gpu.h"
+#include "video_core/renderer_base.h"
+#include "video_core/shader_notify.h"
+#include "yuzu_cmd/benchmark.h"
+#include "yuzu_cmd/emu_window/emu_window_sdl2.h"
+
+namespace {
+
+/// Time between checks for the end of the run
+constexpr std::chrono::milliseconds WATCH_INTERVAL{100};
+
+/// Groups worker threads under one name, "CPUCore_2" and "VkPipelineBuilder" become "CPUCore"
+/// and "VkPipelineBuild" as Linux truncates thread names to 15 characters
+std::string ThreadGroupName(std::string name) {
+    while (!name.empty() &&
+           (std::isdigit(static_cast<unsigned char>(name.back())) || name.back() == '_' ||
+            name.back() == ':' || name.back() == ' ')) {
+        name.pop_back();
+    }
+    std::erase_if(name, [](char c) { return c == '"' || c == '\\'; });
+    return name.empty() ? "unnamed" : name;
+}
+
+} // Anonymous namespace
+
+Benchmark::Benchmark(Core::System& system_, EmuWindow_SDL2& emu_window_, BenchmarkOptions options_)
+    : system{system_}, emu_window{emu_window_}, options{std::move(options_)} {
+    if (!options.frame_log_path.empty()) {
+        emu_window.SetFrameDisplayedCallback([this] { FrameDisplayed(); });
+    }
+}
+
+Benchmark::~Benchmark() = default;
+
+void Benchmark::Start() {
+    void(system.GetAndResetPerfStats());
+    start_time = Clock::now();
+    start_frames = emu_window.DisplayedFrames();
+    start_shaders = system.GPU().ShaderNotify().ShadersCompleted();
+    start_thread_times = SampleThreadTimes();
+
+    if (!options.frame_log_path.empty()) {
+        system.GetPerfStats().SetFrameCallback([this](Core::PerfStats::Clock::duration work_time) {
+            pending_cpu_ns.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(work_time).count(),
+                std::memory_order_relaxed);
+        });
+        std::scoped_lock lock{frames_mutex};
+        logging_frames = true;
+        last_frame_time = start_time;
+        pending_cpu_ns.store(0, std::memory_order_relaxed);
+    }
+
+    LOG_INFO(Frontend, "Benchmark started for {} seconds and {} frames",
+             options.duration.count(), options.frames);
+    watch_thread = std::jthread([this](std::stop_token stop_token) { Watch(stop_token); });
+}
+
+bool Benchmark::WriteReport() {
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start_time).count();
+    const u64 frames = emu_window.DisplayedFrames() - start_frames;
+    const int shaders = system.GPU().ShaderNotify().ShadersCompleted() - start_shaders;
+    const auto results = system.GetAndResetPerfStats();
+
+    std::string comparison;
+    if (!options.frame_log_path.empty()) {
+        system.GetPerfStats().SetFrameCallback({});
+        std::vector<FrameCost> frames_logged;
+        {
+            std::scoped_lock lock{frames_mutex};
+            logging_frames = false;
+            frames_logged = std::move(frame_costs);
+        }
+        comparison = WriteFrameLog(frames_logged);
+    }
+
+    std::string cpu_times;
+    for (const auto& [name, seconds] : SampleThreadTimes()) {
+        const auto it = start_thread_times.find(name);
+        const double start_seconds = it != start_thread_times.end() ? it->second : 0.0;
+        cpu_times += fmt::format("{}\n    \"{}\": {:.3f}", cpu_times.empty() ? "" : ",", name,
+                                 seconds - start_seconds);
+    }
+
+    const auto& stutters = results.stutters;
+    const std::string report = fmt::format(
+        "{{\n"
+        "  \"title_id\": \"{:016X}\",\n"
+        "  \"duration_s\": {:.3f},\n"
+        "  \"frames\": {},\n"
+        "  \"fps\": {:.2f},\n"
+        "  \"system_fps\": {:.2f},\n"
+        "  \"emulation_speed\": {:.3f},\n"
+        "  \"game_frametime_ms\": {{\"p50\": {:.2f}, \"p95\": {:.2f}, \"p99\": {:.2f}, "
+        "\"max\": {:.2f}}},\n"
+        "  \"gpu_frametime_ms\": {:.2f},\n"
+        "  \"stutters\": {{\"shader_build\": {}, \"file_system\": {}, \"unknown\": {}}},\n"
+        "  \"shaders_built\": {},\n"
+        "{}"
+        "  \"cpu_time_s\": {{{}{}}}\n"
+        "}}\n",
+        system.GetApplicationProcessProgramID(), elapsed, frames,
+        elapsed > 0.0 ? static_cast<double>(frames) / elapsed : 0.0, results.system_fps,
+        results.emulation_speed, results.game_frametime_p50 * 1000.0,
+        results.game_frametime_p95 * 1000.0, results.game_frametime_p99 * 1000.0,
+        results.game_frametime_max * 1000.0, results.gpu_frametime * 1000.0,
+        stutters[static_cast<std::size_t>(Core::StutterCause::ShaderBuild)],
+        stutters[static_cast<std::size_t>(Core::StutterCause::FileSystem)],
+        stutters[static_cast<std::size_t>(Core::StutterCause::Unknown)], shaders, comparison,
+        cpu_times,
+        cpu_times.empty() ? "" : "\n  ");
+
+    if (options.report_path.empty()) {
+        std::fputs(report.c_str(), stdout);
+        return true;
+    }
+    Common::FS::IOFile file(options.report_path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile);
+    if (file.WriteString(report) != report.size()) {
+        LOG_ERROR(Frontend, "Failed to write the benchmark report to {}", options.report_path);
+        return false;
+    }
+    LOG_INFO(Frontend, "Benchmark report written to {}", options.report_path);
+    return true;
+}
+
+void Benchmark::Watch(std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+        std::this_thread::sleep_for(WATCH_INTERVAL);
+
+        const bool time_elapsed =
+            options.duration.count() != 0 && Clock::now() - start_time >= options.duration;
+        const bool frames_shown =
+            options.frames != 0 && emu_window.DisplayedFrames() - start_frames >= options.frames;
+        if (time_elapsed || frames_shown) {
+            emu_window.RequestClose();
+            return;
+        }
+    }
+}
+
+void Benchmark::FrameDisplayed() {
+    const auto now = Clock::now();
+    std::scoped_lock lock{frames_mutex};
+    if (!logging_frames) {
+        return;
+    }
+    const s64 cpu_ns = pending_cpu_ns.exchange(0, std::memory_order_relaxed);
+    frame_costs.push_back(FrameCost{
+        .frame_time = std::chrono::duration<double, std::milli>(now - last_frame_time).count(),
+        .cpu_time = static_cast<double>(cpu_ns) / 1'000'000.0,
+        .gpu_time =
+            std::chrono::duration<double, std::milli>(system.Renderer().FrameGpuTime()).count(),
+    });
+    last_frame_time = now;
+}
+
+std::string Benchmark::WriteFrameLog(const std::vector<FrameCost>& frames) {
+    std::vector<FrameCost> base_frames;
+    if (!options.compare_path.empty()) {
+        std::ifstream base_file(options.compare_path);
+        std::string line;
+        // Skip the header
+        std::getline(base_file, line);
+        while (std::getline(base_file, line)) {
+            FrameCost cost{};
+            if (std::sscanf(line.c_str(), "%*u,%lf,%lf,%lf", &cost.frame_time, &cost.cpu_time,
+                            &cost.gpu_time) != 3) {
+                break;
+            }
+            base_frames.push_back(cost);
+        }
+        if (base_frames.empty()) {
+            LOG_ERROR(Frontend, "Failed to read the frame log to compare against from {}",
+                      options.compare_path);
+        }
+    }
+
+    std::string log = "frame,frame_time_ms,cpu_ms,gpu_ms";
+    if (!base_frames.empty()) {
+        log += ",base_frame_time_ms,base_cpu_ms,base_gpu_ms,cpu_delta_ms,gpu_delta_ms";
+    }
+    log += '\n';
+    FrameCost delta_sum{};
+    double worst_cpu_delta = 0.0;
+    size_t worst_cpu_frame = 0;
+    for (size_t frame = 0; frame < frames.size(); ++frame) {
+        const FrameCost& cost = frames[frame];
+        log += fmt::format("{},{:.3f},{:.3f},{:.3f}", frame, cost.frame_time, cost.cpu_time,
+                           cost.gpu_time);
+        if (frame < base_frames.size()) {
+            const FrameCost& base = base_frames[frame];
+            const double cpu_delta = cost.cpu_time - base.cpu_time;
+            const double gpu_delta = cost.gpu_time - base.gpu_time;
+            log += fmt::format(",{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}", base.frame_time,
+                               base.cpu_time, base.gpu_time, cpu_delta, gpu_delta);
+            delta_sum.frame_time += cost.frame_time - base.frame_time;
+            delta_sum.cpu_time += cpu_delta;
+            delta_sum.gpu_time += gpu_delta;
+            if (cpu_delta > worst_cpu_delta) {
+                worst_cpu_delta = cpu_delta;
+                worst_cpu_frame = frame;
+            }
+        } else if (!base_frames.empty()) {
+            log += ",,,,,";
+        }
+        log += '\n';
+    }
+
+    Common::FS::IOFile file(options.frame_log_path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile);
+    if (file.WriteString(log) != log.size()) {
+        LOG_ERROR(Frontend, "Failed to write the frame log to {}", options.frame_log_path);
+    }
+
+    const size_t compared = std::min(frames.size(), base_frames.size());
+    if (compared == 0) {
+        return {};
+    }
+    const double count = static_cast<double>(compared);
+    return fmt::format("  \"comparison\": {{\"frames\": {}, \"frame_time_ms_delta_mean\": {:.3f}, "
+                       "\"cpu_ms_delta_mean\": {:.3f}, \"gpu_ms_delta_mean\": {:.3f}, "
+                       "\"worst_cpu_frame\": {}, \"worst_cpu_delta_ms\": {:.3f}}},\n",
+                       compared, delta_sum.frame_time / count, delta_sum.cpu_time / count,
+                       delta_sum.gpu_time / count, worst_cpu_frame, worst_cpu_delta);
+}
+
+Benchmark::ThreadTimes Benchmark::SampleThreadTimes() {
+    ThreadTimes times;
+#ifdef __linux__
+    const double ticks_per_second = static_cast<double>(sysconf(_SC_CLK_TCK));
+    std::error_code ec;
+    for (const auto& task : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+        std::ifstream comm_file(task.path() / "comm");
+        std::ifstream stat_file(task.path() / "stat");
+        std::string name;
+        std::string stat;
+        if (!std::getline(comm_file, name) || !std::getline(stat_file, stat)) {
+            continue;
+        }
+        // The thread name in parentheses may contain spaces, the fields after it don't
+        const auto name_end = stat.rfind(')');
+        if (name_end == std::string::npos) {
+            continue;
+        }
+        std::istringstream fields(stat.substr(name_end + 1));
+        std::vector<std::string> values;
+        for (std::string value; fields >> value;) {
+            values.push_back(std::move(value));
+        }
+        // utime and stime are the 14th and 15th fields, the first after the name is the 3rd
+        if (values.size() < 13) {
+            continue;
+        }
+        const double ticks = std::stod(values[11]) + std::stod(values[12]);
+        times[ThreadGroupName(std::move(name))] += ticks / ticks_per_second;
+    }
+#endif
+    return times;
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+class EmuWindow_SDL2;
+
+struct BenchmarkOptions {
+    /// Walltime to run for, zero to not limit the run by time
+    std::chrono::seconds duration{};
+    /// Number of displayed frames to run for, zero to not limit the run by frames
+    u64 frames{};
+    /// File the JSON report is written to, standard output when empty
+    std::string report_path;
+    /// CSV file the cost of each displayed frame is written to, not written when empty
+    std::string frame_log_path;
+    /// Frame log of a previous run to compare each frame against, no comparison when empty
+    std::string compare_path;
+};
+
+/**
+ * Measures a run of the emulated title for regression testing.
+ *
+ * Once started, the run is ended by closing the window after the requested time or number of
+ * frames. The report then holds the frame rates, frame time percentiles, number of shaders built
+ * and the CPU time spent by each group of emulator threads during the run. The cost of each
+ * frame can be logged too, and compared frame by frame against the log of a previous run of the
+ * same recorded session, which is only meaningful with deterministic emulation settings.
+ */
+class Benchmark {
+public:
+    explicit Benchmark(Core::System& system, EmuWindow_SDL2& emu_window, BenchmarkOptions options);
+    ~Benchmark();
+
+    /// Resets the statistics and starts watching for the end of the run
+    void Start();
+
+    /// Writes the report of the run, returns true on success
+    bool WriteReport();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// CPU time in seconds of the threads of the process, grouped by thread name
+    using ThreadTimes = std::map<std::string, double>;
+
+    /// Cost of a displayed frame, in milliseconds
+    struct FrameCost {
+        double frame_time;
+        double cpu_time;
+        double gpu_time;
+    };
+
+    void Watch(std::stop_token stop_token);
+
+    /// Called from the GPU thread on each displayed frame
+    void FrameDisplayed();
+
+    /// Writes the frame log, compared against the base frame log when there is one, and returns
+    /// the JSON object summarizing the comparison
+    std::string WriteFrameLog(const std::vector<FrameCost>& frames);
+
+    static ThreadTimes SampleThreadTimes();
+
+    Core::System& system;
+    EmuWindow_SDL2& emu_window;
+    BenchmarkOptions options;
+
+    Clock::time_point start_time;
+    u64 start_frames{};
+    int start_shaders{};
+    ThreadTimes start_thread_times;
+
+    /// Walltime the CPU spent emulating system frames since the last displayed frame
+    std::atomic<s64> pending_cpu_ns{};
+    std::mutex frames_mutex;
+    bool logging_frames{};
+    Clock::time_point last_frame_time;
+    std::vector<FrameCost> frame_costs;
+
+    std::jthread watch_thread;
+};
@@ -11,6 +11,7 @@
 #include "hid_core/hid_core.h"
 #include "input_common/drivers/keyboard.h"
 #include "input_common/drivers/mouse.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/drivers/touch_screen.h"
 #include "input_common/main.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
@@ -101,6 +102,28 @@ bool EmuWindow_SDL2::IsOpen() const {
     return is_open;
 }
 
+void EmuWindow_SDL2::RequestClose() {
+    SDL_Event event{};
+    event.type = SDL_QUIT;
+    SDL_PushEvent(&event);
+}
+
+u64 EmuWindow_SDL2::DisplayedFrames() const {
+    return displayed_frames.load(std::memory_order_relaxed);
+}
+
+void EmuWindow_SDL2::OnFrameDisplayed() {
+    input_subsystem->GetTas()->UpdateThread();
+    displayed_frames.fetch_add(1, std::memory_order_relaxed);
+    if (frame_displayed_callback) {
+        frame_displayed_callback();
+    }
+}
+
+void EmuWindow_SDL2::SetFrameDisplayedCallback(std::function<void()> callback) {
+    frame_displayed_callback = std::move(callback);
+}
+
 bool EmuWindow_SDL2::IsShown() const {
     return is_shown;
 }
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <utility>
 
 #include "core/frontend/emu_window.h"
@@ -33,6 +35,19 @@ public:
     /// Wait for the next event on the main thread.
     void WaitEvent();
 
+    /// Asks the main thread to close the window, can be called from any thread.
+    void RequestClose();
+
+    /// Returns the number of frames displayed since the window was created
+    u64 DisplayedFrames() const;
+
+    /// Advances the TAS script and counts the frame, called from the GPU thread.
+    void OnFrameDisplayed() override;
+
+    /// Sets a function called from the GPU thread on each displayed frame. Must be set before
+    /// emulation starts.
+    void SetFrameDisplayedCallback(std::function<void()> callback);
+
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
@@ -85,6 +100,12 @@ protected:
     /// Keeps track of how often to update the title bar during gameplay
     u32 last_time = 0;
 
+    /// Number of frames presented by the renderer
+    std::atomic<u64> displayed_frames{};
+
+    /// Called on each displayed frame
+    std::function<void()> frame_displayed_callback;
+
     /// Input subsystem to use with this window.
     InputCommon::InputSubsystem* input_subsystem;
 
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <thread>
@@ -11,6 +12,7 @@
 #include <fmt/ostream.h>
 
 #include "common/detached_tasks.h"
+#include "common/fs/path_util.h"
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
@@ -30,10 +32,12 @@
 #include "core/loader/loader.h"
 #include "core/telemetry_session.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
 #include "video_core/renderer_base.h"
+#include "yuzu_cmd/benchmark.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_gl.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_null.h"
@@ -70,17 +74,45 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark       Run without speed limit and report the performance\n"
                  "-c, --config          Load the specified configuration file\n"
+                 "-C, --compare         Frame log of a previous benchmark to compare against\n"
+                 "-d, --duration        Seconds to run the benchmark for, 60 by default\n"
+                 "-D, --deterministic   Emulate on one core with synchronous GPU and shaders\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
                  "-h, --help            Display this help and exit\n"
+                 "-l, --frame-log       CSV file to write the benchmark cost of each frame to\n"
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
+                 "-n, --frames          Frames to run the benchmark for\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-r, --report          File to write the benchmark report to, instead of stdout\n"
+                 "-R, --record-tas      Record the input of player 1 to the TAS directory\n"
+                 "-t, --tas             Directory of the TAS scripts to play from boot\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-v, --version         Output version information and exit\n";
 }
 
+/// Turns off the emulator's own sources of variance between runs: multicore and asynchronous
+/// GPU work, the disk shader cache, the RTC and the RNG seed. This does not make runs identical,
+/// the TAS script advances with the frames the host presents and the guest may still poll input
+/// or finish frames at a different point of its timeline
+static void ApplyDeterministicSettings() {
+    // Single core CoreTiming advances by emulated ticks instead of host time
+    Settings::values.use_multi_core.SetValue(false);
+    Settings::values.use_asynchronous_gpu_emulation.SetValue(false);
+    Settings::values.use_asynchronous_shaders.SetValue(false);
+    Settings::values.use_disk_shader_cache.SetValue(false);
+    Settings::values.async_presentation.SetValue(false);
+    // Boot at the same time with the same seed, 2024-01-01 00:00:00 UTC
+    Settings::values.custom_rtc_enabled.SetValue(true);
+    Settings::values.custom_rtc.SetValue(1704067200);
+    Settings::values.rng_seed_enabled.SetValue(true);
+    Settings::values.rng_seed.SetValue(0);
+    LOG_INFO(Frontend, "Using deterministic emulation settings");
+}
+
 static void PrintVersion() {
     std::cout << "yuzu " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
 }
@@ -211,6 +243,12 @@ int main(int argc, char** argv) {
     std::string program_args;
     std::optional<int> selected_user;
 
+    bool benchmark = false;
+    BenchmarkOptions benchmark_options{};
+    std::optional<std::string> tas_path;
+    bool record_tas = false;
+    bool deterministic = false;
+
     bool use_multiplayer = false;
     bool fullscreen = false;
     std::string nickname{};
@@ -220,12 +258,21 @@ int main(int argc, char** argv) {
 
     static struct option long_options[] = {
         // clang-format off
+        {"benchmark", no_argument, 0, 'b'},
         {"config", required_argument, 0, 'c'},
+        {"compare", required_argument, 0, 'C'},
+        {"duration", required_argument, 0, 'd'},
+        {"deterministic", no_argument, 0, 'D'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
         {"game", required_argument, 0, 'g'},
+        {"frame-log", required_argument, 0, 'l'},
         {"multiplayer", required_argument, 0, 'm'},
+        {"frames", required_argument, 0, 'n'},
         {"program", optional_argument, 0, 'p'},
+        {"report", required_argument, 0, 'r'},
+        {"record-tas", no_argument, 0, 'R'},
+        {"tas", required_argument, 0, 't'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -233,12 +280,26 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:", long_options, &option_index);
+        int arg =
+            getopt_long(argc, argv, "g:fhvp::c:u:bd:n:r:t:C:Dl:R", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
+            case 'b':
+                benchmark = true;
+                break;
             case 'c':
                 config_path = optarg;
                 break;
+            case 'C':
+                benchmark_options.compare_path = optarg;
+                break;
+            case 'd':
+                benchmark_options.duration =
+                    std::chrono::seconds{std::strtoul(optarg, nullptr, 0)};
+                break;
+            case 'D':
+                deterministic = true;
+                break;
             case 'f':
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
@@ -246,6 +307,9 @@ int main(int argc, char** argv) {
             case 'h':
                 PrintHelp(argv[0]);
                 return 0;
+            case 'l':
+                benchmark_options.frame_log_path = optarg;
+                break;
             case 'g': {
                 const std::string str_arg(optarg);
                 filepath = str_arg;
@@ -284,6 +348,18 @@ int main(int argc, char** argv) {
                 }
                 break;
             }
+            case 'n':
+                benchmark_options.frames = std::strtoull(optarg, nullptr, 0);
+                break;
+            case 'r':
+                benchmark_options.report_path = optarg;
+                break;
+            case 'R':
+                record_tas = true;
+                break;
+            case 't':
+                tas_path = optarg;
+                break;
             case 'p':
                 program_args = argv[optind];
                 ++optind;
@@ -305,6 +381,12 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (record_tas && !tas_path.has_value()) {
+        std::cout << "Option --record-tas requires the --tas directory to record to\n";
+        PrintHelp(argv[0]);
+        return -1;
+    }
+
     SdlConfig config{config_path};
 
     // apply the log_filter setting
@@ -321,6 +403,27 @@ int main(int argc, char** argv) {
         Settings::values.current_user = std::clamp(*selected_user, 0, 7);
     }
 
+    if (deterministic) {
+        ApplyDeterministicSettings();
+    }
+
+    if (benchmark) {
+        Settings::values.use_speed_limit.SetValue(false);
+        if (benchmark_options.duration.count() == 0 && benchmark_options.frames == 0) {
+            benchmark_options.duration = std::chrono::seconds{60};
+        }
+        if (!benchmark_options.frame_log_path.empty()) {
+            // Also makes the renderers measure the GPU time of each frame
+            Settings::values.record_frame_times = true;
+        }
+    }
+
+    if (tas_path.has_value()) {
+        // The TAS driver loads the scripts when the input subsystem is initialized
+        Common::FS::SetYuzuPath(Common::FS::YuzuPath::TASDir, *tas_path);
+        Settings::values.tas_enable.SetValue(true);
+    }
+
 #ifdef _WIN32
     LocalFree(argv_w);
 #endif
@@ -424,7 +527,17 @@ int main(int argc, char** argv) {
             [](VideoCore::LoadCallbackStage, size_t value, size_t total) {});
     }
 
+    std::optional<Benchmark> benchmark_run;
+    if (benchmark) {
+        benchmark_run.emplace(system, *emu_window, std::move(benchmark_options));
+    }
+
     system.RegisterExitCallback([&] {
+        if (benchmark_run) {
+            // Still report the run when the title exits early
+            emu_window->RequestClose();
+            return;
+        }
         // Just exit right away.
         exit(0);
     });
@@ -437,9 +550,26 @@ int main(int argc, char** argv) {
     if (system.DebuggerEnabled()) {
         system.InitializeDebugger();
     }
+    if (tas_path.has_value()) {
+        if (record_tas) {
+            input_subsystem.GetTas()->Record();
+        } else {
+            input_subsystem.GetTas()->StartStop();
+        }
+    }
+    if (benchmark_run) {
+        benchmark_run->Start();
+    }
     while (emu_window->IsOpen()) {
         emu_window->WaitEvent();
     }
+    const bool report_written = !benchmark_run || benchmark_run->WriteReport();
+    benchmark_run.reset();
+    if (tas_path.has_value() && record_tas) {
+        // Stop recording and save it as the script of player 1 to replay it later
+        input_subsystem.GetTas()->Record();
+        input_subsystem.GetTas()->SaveRecording(true);
+    }
     system.DetachDebugger();
     void(system.Pause());
     system.ShutdownMainProcess();
@@ -449,5 +579,5 @@ int main(int argc, char** argv) {
 #endif
 
     detached_tasks.WaitForAllTasks();
-    return 0;
+    return report_written ? 0 : -1;
 }
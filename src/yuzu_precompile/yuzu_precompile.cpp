@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright 2026 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/scm_rev.h"
+#include "common/settings.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_vulkan/vk_pipeline_precompiler.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+static void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <cache directory>\n"
+                 "Builds the Vulkan driver pipeline cache (vulkan_pipelines.bin) from the pipeline\n"
+                 "environments (vulkan.bin) in a cache directory, without running the title.\n\n"
+                 "-b, --benchmark       Translate and emit every shader the given number of\n"
+                 "                      times and print the timings, no pipeline is built\n"
+                 "-d, --device          Index of the Vulkan device to compile on\n"
+                 "-t, --title           Title ID, uses the cache directory of the title\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-v, --version         Output version information and exit\n";
+}
+
+static void PrintVersion() {
+    std::cout << "yuzu-precompile " << Common::g_scm_branch << " " << Common::g_scm_desc
+              << std::endl;
+}
+
+static void PrintBenchmark(const Vulkan::ShaderBenchmarkResults& results, u32 iterations) {
+    std::cout << fmt::format("{} shaders, {} iterations\n", results.num_shaders, iterations);
+    if (results.num_shaders == 0) {
+        return;
+    }
+    const double num_shaders = static_cast<double>(results.num_shaders);
+    const double translate_us = static_cast<double>(results.translate_ns) / 1000.0 / num_shaders;
+    const double emit_us = static_cast<double>(results.emit_ns) / 1000.0 / num_shaders /
+                           static_cast<double>(iterations);
+    std::cout << fmt::format("translate: {:.1f} us/shader\n", translate_us)
+              << fmt::format("emit:      {:.1f} us/shader, {} words/shader\n", emit_us,
+                             results.num_words / results.num_shaders / iterations);
+}
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    std::filesystem::path base_dir;
+    u32 benchmark_iterations = 0;
+    int option_index = 0;
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"benchmark", required_argument, 0, 'b'},
+        {"device", required_argument, 0, 'd'},
+        {"title", required_argument, 0, 't'},
+        {"help", no_argument, 0, 'h'},
+        {"version", no_argument, 0, 'v'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+
+    while (optind < argc) {
+        const int arg = getopt_long(argc, argv, "b:d:t:hv", long_options, &option_index);
+        if (arg != -1) {
+            switch (static_cast<char>(arg)) {
+            case 'b':
+                benchmark_iterations = std::max(std::atoi(optarg), 1);
+                break;
+            case 'd':
+                Settings::values.vulkan_device.SetValue(std::atoi(optarg));
+                break;
+            case 't': {
+                const u64 title_id = std::strtoull(optarg, nullptr, 16);
+                base_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::ShaderDir) /
+                           fmt::format("{:016x}", title_id);
+                break;
+            }
+            case 'h':
+                PrintHelp(argv[0]);
+                return 0;
+            case 'v':
+                PrintVersion();
+                return 0;
+            default:
+                PrintHelp(argv[0]);
+                return -1;
+            }
+        } else {
+            base_dir = argv[optind];
+            optind++;
+        }
+    }
+    if (base_dir.empty()) {
+        PrintHelp(argv[0]);
+        return -1;
+    }
+    if (!Common::FS::Exists(base_dir / "vulkan.bin")) {
+        LOG_CRITICAL(Frontend, "No pipeline cache found in {}",
+                     Common::FS::PathToUTF8String(base_dir));
+        return -1;
+    }
+
+    // The driver pipeline cache is the output, always write it
+    if (benchmark_iterations == 0) {
+        Settings::values.use_vulkan_driver_pipeline_cache.SetValue(true);
+    }
+
+    MicroProfileOnThreadCreate("PrecompileThread");
+    try {
+        Vulkan::PipelinePrecompiler precompiler;
+        LOG_INFO(Frontend, "Compiling pipelines on {}", precompiler.GetDevice().GetModelName());
+
+        if (benchmark_iterations != 0) {
+            PrintBenchmark(precompiler.Benchmark(base_dir, benchmark_iterations, {}),
+                           benchmark_iterations);
+        } else {
+            size_t last_percent = 0;
+            precompiler.Compile(
+                base_dir, {}, [&](VideoCore::LoadCallbackStage stage, size_t value, size_t total) {
+                    if (stage != VideoCore::LoadCallbackStage::Build || total == 0) {
+                        return;
+                    }
+                    const size_t percent = value * 100 / total;
+                    if (percent != last_percent) {
+                        last_percent = percent;
+                        std::cout << fmt::format("\r{}/{} pipelines ({}%)", value, total, percent)
+                                  << std::flush;
+                    }
+                });
+            std::cout << std::endl;
+        }
+    } catch (const vk::Exception& exception) {
+        LOG_CRITICAL(Frontend, "Failed to compile pipelines: {}", exception.what());
+        MicroProfileShutdown();
+        return -1;
+    }
+    MicroProfileShutdown();
+    return 0;
+}